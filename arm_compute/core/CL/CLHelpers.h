@@ -28,6 +28,7 @@
 #include "arm_compute/core/Helpers.h"
 #include "support/ToolchainSupport.h"
 
+#include <set>
 #include <string>
 
 namespace arm_compute
@@ -103,6 +104,19 @@ std::unique_ptr<Kernel> create_kernel()
     return k;
 }
 
+/** Translates a fused activation to the set of build options implementing it in the producing kernel.
+ *
+ * The returned options select one of the FUSED_ACTIVATION variants of helpers.h, which the kernel
+ * applies to its output right before storing it. Only RELU, BOUNDED_RELU and LEAKY_RELU can be
+ * fused; an empty set is returned when @p act_info is disabled.
+ *
+ * @param[in] act_info  Activation to fuse into the producing kernel.
+ * @param[in] data_type Data type the kernel operates on.
+ *
+ * @return The build options implementing the activation.
+ */
+std::set<std::string> get_build_options_from_activation(const ActivationLayerInfo &act_info, DataType data_type);
+
 /** Helper function to get the GPU target from CL device
  *
  * @param[in] device A CL device
@@ -223,14 +223,38 @@ public:
      * @return The created kernel.
      */
     Kernel create_kernel(const std::string &kernel_name, const StringSet &build_options_set = {}) const;
-    /** Serializes and saves programs to a binary.
+    /** Creates a kernel from a runtime-generated source string.
      *
+     * The built program is cached under @p program_name and the build options like library
+     * programs are, so @p program_name must uniquely identify @p source. Generated sources can
+     * use the library's helper macros: the helpers header is prepended for embedded-kernel
+     * builds and resolved through the kernel path otherwise.
+     *
+     * @param[in] kernel_name       Name of the kernel within @p source.
+     * @param[in] program_name      Name identifying the generated program in the cache.
+     * @param[in] source            OpenCL source of the program.
+     * @param[in] build_options_set Kernel build options as a set.
+     *
+     * @return The created kernel.
      */
-    void save_binary();
-    /** Load serialized binary with all the programs.
+    Kernel create_kernel_from_source(const std::string &kernel_name, const std::string &program_name, const std::string &source, const StringSet &build_options_set = {}) const;
+    /** Serializes and saves the built programs' binaries to a file.
+     *
+     * The cache is keyed by program name + build options and tagged with the device name:
+     * loading it back on subsequent runs (load_binary()) skips clBuildProgram entirely,
+     * turning seconds of startup compilation into milliseconds.
+     *
+     * @param[in] filename File to write the binary cache to.
+     */
+    void save_binary(const std::string &filename);
+    /** Loads program binaries previously saved with save_binary().
+     *
+     * A cache written for a different device is ignored, as are unreadable files, in which
+     * case programs are simply rebuilt from source on first use.
      *
+     * @param[in] filename File to read the binary cache from.
      */
-    void load_binary();
+    void load_binary(const std::string &filename);
     /** Find the maximum number of local work items in a workgroup can be supported for the kernel.
      *
      */
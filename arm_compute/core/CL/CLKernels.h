@@ -101,6 +101,7 @@
 #include "arm_compute/core/CL/kernels/CLTransposeKernel.h"
 #include "arm_compute/core/CL/kernels/CLWarpAffineKernel.h"
 #include "arm_compute/core/CL/kernels/CLWarpPerspectiveKernel.h"
+#include "arm_compute/core/CL/kernels/CLWinogradConvolutionLayerKernel.h"
 #include "arm_compute/core/CL/kernels/CLWeightsReshapeKernel.h"
 
 #endif /* __ARM_COMPUTE_CLKERNELS_H__ */
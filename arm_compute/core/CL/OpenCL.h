@@ -39,6 +39,17 @@ namespace cl
 static const NDRange Range_128_1 = NDRange(128, 1);
 } // namespace cl
 
+/* Tokens of the cl_arm_import_memory extension, for toolchains whose CL headers predate it */
+#ifndef CL_IMPORT_TYPE_ARM
+typedef intptr_t cl_import_properties_arm;
+#define CL_IMPORT_TYPE_ARM 0x40B2
+#define CL_IMPORT_TYPE_HOST_ARM 0x40B3
+#define CL_IMPORT_TYPE_DMA_BUF_ARM 0x40B4
+#define CL_IMPORT_TYPE_SECURE_ARM 0x40B5
+#endif /* CL_IMPORT_TYPE_ARM */
+
+extern "C" cl_mem clImportMemoryARM(cl_context context, cl_mem_flags flags, const cl_import_properties_arm *properties, void *memory, size_t size, cl_int *errcode_ret);
+
 namespace arm_compute
 {
 bool opencl_is_available();
@@ -85,6 +96,7 @@ public:
     using clRetainEvent_func             = cl_int (*)(cl_event);
     using clGetPlatformIDs_func          = cl_int (*)(cl_uint, cl_platform_id *, cl_uint *);
     using clGetKernelWorkGroupInfo_func  = cl_int (*)(cl_kernel, cl_device_id, cl_kernel_work_group_info, size_t, void *, size_t *);
+    using clImportMemoryARM_func         = cl_mem (*)(cl_context, cl_mem_flags, const cl_import_properties_arm *, void *, size_t, cl_int *);
 
     clBuildProgram_func            clBuildProgram            = nullptr;
     clEnqueueNDRangeKernel_func    clEnqueueNDRangeKernel    = nullptr;
@@ -117,6 +129,8 @@ public:
     clRetainEvent_func             clRetainEvent             = nullptr;
     clGetPlatformIDs_func          clGetPlatformIDs          = nullptr;
     clGetKernelWorkGroupInfo_func  clGetKernelWorkGroupInfo  = nullptr;
+    // Mali extension entry point, left to nullptr when the driver does not export it
+    clImportMemoryARM_func clImportMemoryARM = nullptr;
 
 private:
     std::pair<bool, bool> _loaded{ false, false };
@@ -55,6 +55,7 @@ public:
      *
      * @param[in]  input1 First tensor input. Data types supported: U8/QS8/QS16/S16/F16/F32.
      * @param[in]  input2 Second tensor input. Data types supported: U8/QS8 (only if @p input1 is QS8), QS16 (only if @p input1 is QS16), S16/F16/F32.
+     * @note This kernel can run in-place: @p output may be the same tensor as @p input1 or @p input2 (for matching data types).
      * @param[out] output Output tensor. Data types supported: U8 (Only if both inputs are U8), QS8 (only if both inputs are QS8), QS16 (only if both inputs are QS16), S16/F16/F32.
      * @param[in]  policy Policy to use to handle overflow.
      */
@@ -50,9 +50,10 @@ public:
      * @param[in]  input     Source tensor. DataType supported: F32.
      * @param[out] output    Destination tensor. Data type supported: Same as @p input.
      * @param[in]  weights   Weights tensor. These are 3D tensors with dimensions [3, 3, IFM]. Data type supported: Same as @p input.
+     * @param[in]  biases    (Optional) Biases tensor. A 1D tensor with dimensions [IFM]. Must be nullptr if not needed. Data type supported: Same as @p input.
      * @param[in]  conv_info Padding and stride information to use for the convolution.
      */
-    void configure(const ICLTensor *input, ICLTensor *output, const ICLTensor *weights, const PadStrideInfo &conv_info);
+    void configure(const ICLTensor *input, ICLTensor *output, const ICLTensor *weights, const ICLTensor *biases, const PadStrideInfo &conv_info);
 
     // Inherited methods overridden:
     void run(const Window &window, cl::CommandQueue &queue) override;
@@ -63,6 +64,7 @@ private:
     const ICLTensor *_input;
     ICLTensor       *_output;
     const ICLTensor *_weights;
+    const ICLTensor *_biases;
     unsigned int     _conv_stride_x;
     unsigned int     _conv_stride_y;
     unsigned int     _conv_pad_x;
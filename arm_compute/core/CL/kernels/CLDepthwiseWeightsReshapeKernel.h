@@ -52,8 +52,9 @@ public:
      *
      * @param[in]  input  The input tensor to convert. 3 lower dimensions represent a single input [width, height, IFM]. Data type supported: F32.
      * @param[out] output The output tensor. Data type supported: same as @p input.
+     * @param[in]  biases (Optional) The input biases to add. Shape [IFM]. Must be nullptr if not needed. Data type supported: same as @p input.
      */
-    void configure(const ICLTensor *input, ICLTensor *output);
+    void configure(const ICLTensor *input, ICLTensor *output, const ICLTensor *biases);
 
     // Inherited methods overridden:
     void run(const Window &window, cl::CommandQueue &queue) override;
@@ -61,6 +62,7 @@ public:
 private:
     const ICLTensor *_input;
     ICLTensor       *_output;
+    const ICLTensor *_biases;
 };
 } // arm_compute
 #endif /*__ARM_COMPUTE_CLDEPTHWISEWEIGHTSRESHAPEKERNEL_H__ */
@@ -64,8 +64,13 @@ public:
      * @param[out] output    Output tensor.
      *                       The 3rd dimensions must be equal to the 4th dimension of the @p kernels tensor. Data types supported: Same as @p input.
      * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  act_info  (Optional) Activation to fuse into the kernel, applied to the output right before storing it. Only RELU, BOUNDED_RELU and LEAKY_RELU on F16/F32 can be fused.
+     * @param[in]  acc_precision (Optional) Precision of the intermediate accumulation. F16 accumulates in F16 by default;
+     *                       @ref AccumulatePrecision::FULL accumulates in F32 instead (1x1 and 3x3 kernels only).
+     *                       Fixed point types always accumulate in their promoted type and F32 is already full precision, so the policy is a no-op for them.
      */
-    void configure(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info);
+    void configure(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info = ActivationLayerInfo(),
+                   AccumulatePrecision acc_precision = AccumulatePrecision::REDUCED);
 
     // Inherited methods overridden:
     BorderSize border_size() const override;
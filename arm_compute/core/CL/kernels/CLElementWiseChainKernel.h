@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLELEMENTWISECHAINKERNEL_H__
+#define __ARM_COMPUTE_CLELEMENTWISECHAINKERNEL_H__
+
+#include "arm_compute/core/CL/ICLKernel.h"
+#include "arm_compute/core/Types.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+class ICLTensor;
+
+/** Element-wise operations that can be chained into a single generated kernel */
+enum class ElementWiseOp
+{
+    ADD, /**< Accumulator plus the next input */
+    SUB, /**< Accumulator minus the next input */
+    MUL, /**< Accumulator times the next input */
+    MIN, /**< Element-wise minimum of the accumulator and the next input */
+    MAX  /**< Element-wise maximum of the accumulator and the next input */
+};
+
+/** Kernel running a chain of element-wise operations generated and compiled at configure time.
+ *
+ * The chain starts from the first input and folds each following input in with the matching
+ * operation; an optional activation is applied to the result before storing. The kernel source
+ * is generated from the chain, compiled through @ref CLKernelLibrary::create_kernel_from_source
+ * and cached, so an N-pass chain of library kernels becomes a single traversal of the tensors.
+ */
+class CLElementWiseChainKernel : public ICLKernel
+{
+public:
+    /** Default constructor.*/
+    CLElementWiseChainKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers). */
+    CLElementWiseChainKernel(const CLElementWiseChainKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers). */
+    CLElementWiseChainKernel &operator=(const CLElementWiseChainKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    CLElementWiseChainKernel(CLElementWiseChainKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    CLElementWiseChainKernel &operator=(CLElementWiseChainKernel &&) = default;
+    /** Initialise the kernel's inputs, output and operation chain.
+     *
+     * @param[in]  inputs   Input tensors, one more than there are operations; all of the same
+     *                      shape. Data types supported: F16/F32 (all matching).
+     * @param[out] output   The output tensor. Data type supported: same as the inputs.
+     * @param[in]  ops      Operations folding each input after the first into the accumulator.
+     * @param[in]  act_info (Optional) Activation applied to the result before storing.
+     *                      Only activations coverable by @ref get_build_options_from_activation
+     *                      are supported.
+     */
+    void configure(const std::vector<const ICLTensor *> &inputs, ICLTensor *output, const std::vector<ElementWiseOp> &ops, const ActivationLayerInfo &act_info = ActivationLayerInfo());
+
+    // Inherited methods overridden:
+    void run(const Window &window, cl::CommandQueue &queue) override;
+
+private:
+    std::vector<const ICLTensor *> _inputs;
+    ICLTensor                     *_output;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_CLELEMENTWISECHAINKERNEL_H__ */
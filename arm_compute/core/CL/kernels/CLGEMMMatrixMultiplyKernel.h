@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_CLGEMMMATRIXMULTIPLYKERNEL_H__
 
 #include "arm_compute/core/CL/ICLKernel.h"
+#include "arm_compute/core/Types.h"
 
 namespace arm_compute
 {
@@ -37,6 +38,8 @@ class ICLTensor;
  *
  * @attention The second input tensor must have at least 2 dimensions (matrix)
  *
+ * @note Batched matrix multiplications (3D inputs) are supported by the non-reshaped kernels, which range over the
+ *       batch on the z dimension of the dispatch. Matrix B can either be shared across the batch (2D) or batched (3D).
  */
 class CLGEMMMatrixMultiplyKernel : public ICLKernel
 {
@@ -58,8 +61,9 @@ public:
      * @param[out] output                    Output tensor to store the result of matrix multiplication. Data type supported: same as @p input0
      * @param[in]  alpha                     Weight of the matrix product
      * @param[in]  is_interleaved_transposed (Optional) True if input0 and input1 have been reshaped respectively using @ref CLGEMMInterleave4x4Kernel and @ref CLGEMMTranspose1xWKernel
+     * @param[in]  act_info                  (Optional) Activation to fuse into the kernel, applied to the output right before storing it. Only RELU, BOUNDED_RELU and LEAKY_RELU on F16/F32 can be fused.
      */
-    void configure(const ICLTensor *input0, const ICLTensor *input1, ICLTensor *output, float alpha, bool is_interleaved_transposed = true);
+    void configure(const ICLTensor *input0, const ICLTensor *input1, ICLTensor *output, float alpha, bool is_interleaved_transposed = true, const ActivationLayerInfo &act_info = ActivationLayerInfo());
 
     // Inherited methods overridden:
     void run(const Window &window, cl::CommandQueue &queue) override;
@@ -68,6 +72,7 @@ private:
     const ICLTensor *_input0;
     const ICLTensor *_input1;
     ICLTensor       *_output;
+    bool             _is_interleaved_transposed;
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_CLGEMMMATRIXMULTIPLYKERNEL_H__ */
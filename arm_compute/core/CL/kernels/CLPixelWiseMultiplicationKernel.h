@@ -51,6 +51,7 @@ public:
      *
      * @param[in]  input1          An input tensor. Data types supported: U8/QS8/QS16/S16/F16/F32.
      * @param[in]  input2          An input tensor. Data types supported: same as @p input1.
+     * @note This kernel can run in-place: @p output may be the same tensor as @p input1 or @p input2 (for matching data types).
      * @param[out] output          The output tensor, Data types supported: same as @p input1. Note: U8 (QS8, QS16) requires both inputs to be U8 (QS8, QS16).
      * @param[in]  scale           Scale to apply after multiplication.
      *                             Scale must be positive and its value must be either 1/255 or 1/2^n where n is between 0 and 15. For QS8 and QS16 scale must be 1.
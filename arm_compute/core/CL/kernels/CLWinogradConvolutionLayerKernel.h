@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLWINOGRADCONVOLUTIONLAYERKERNEL_H__
+#define __ARM_COMPUTE_CLWINOGRADCONVOLUTIONLAYERKERNEL_H__
+
+#include "arm_compute/core/CL/ICLKernel.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ICLTensor;
+
+/** Interface for the Winograd F(2x2,3x3) input transform kernel.
+ *
+ * Transforms each (overlapping) 4x4 input tile d into V = B^T d B and scatters the 16
+ * coefficients over the z dimension of a [num_tiles, IFM, 16] tensor.
+ */
+class CLWinogradInputTransformKernel : public ICLKernel
+{
+public:
+    /** Default constructor */
+    CLWinogradInputTransformKernel();
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input     Source tensor. 3 lower dimensions represent a single input [width, height, IFM]. Data types supported: F32
+     * @param[out] output    Destination tensor with shape [num_tiles, IFM, 16]. Data types supported: same as @p input
+     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo. Only stride 1 and padding of at most 1 are supported.
+     */
+    void configure(const ICLTensor *input, ICLTensor *output, const PadStrideInfo &conv_info);
+
+    // Inherited methods overridden:
+    void run(const Window &window, cl::CommandQueue &queue) override;
+    BorderSize border_size() const override;
+
+private:
+    const ICLTensor *_input;
+    ICLTensor       *_output;
+    BorderSize       _border_size;
+};
+
+/** Interface for the Winograd F(2x2,3x3) filter transform kernel.
+ *
+ * Transforms each 3x3 filter g into U = G g G^T and scatters the 16 coefficients over the
+ * z dimension of a [OFM, IFM, 16] tensor. The filters only need transforming when they
+ * change, so this kernel typically runs once.
+ */
+class CLWinogradFilterTransformKernel : public ICLKernel
+{
+public:
+    /** Default constructor */
+    CLWinogradFilterTransformKernel();
+    /** Set the input and output tensors.
+     *
+     * @param[in]  weights Weights tensor. Weights are 4D tensor with dimensions [3, 3, IFM, OFM]. Data types supported: F32
+     * @param[out] output  Destination tensor with shape [OFM, IFM, 16]. Data types supported: same as @p weights
+     */
+    void configure(const ICLTensor *weights, ICLTensor *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window, cl::CommandQueue &queue) override;
+
+private:
+    const ICLTensor *_weights;
+    ICLTensor       *_output;
+};
+
+/** Interface for the Winograd F(2x2,3x3) batched matrix multiplication kernel.
+ *
+ * Computes the 16 independent [num_tiles, IFM] x [IFM, OFM] matrix products (one per
+ * transform plane) between the transformed input and the transformed filters.
+ */
+class CLWinogradBatchedGEMMKernel : public ICLKernel
+{
+public:
+    /** Default constructor */
+    CLWinogradBatchedGEMMKernel();
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input0 Transformed input tensor with shape [num_tiles, IFM, 16]. Data types supported: F32
+     * @param[in]  input1 Transformed filter tensor with shape [OFM, IFM, 16]. Data types supported: same as @p input0
+     * @param[out] output Destination tensor with shape [num_tiles, OFM, 16]. Data types supported: same as @p input0
+     */
+    void configure(const ICLTensor *input0, const ICLTensor *input1, ICLTensor *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window, cl::CommandQueue &queue) override;
+
+private:
+    const ICLTensor *_input0;
+    const ICLTensor *_input1;
+    ICLTensor       *_output;
+};
+
+/** Interface for the Winograd F(2x2,3x3) output transform kernel.
+ *
+ * Transforms each multiplied tile m into Y = A^T m A, adds the optional bias and writes the
+ * resulting 2x2 block to the output tensor.
+ */
+class CLWinogradOutputTransformKernel : public ICLKernel
+{
+public:
+    /** Default constructor */
+    CLWinogradOutputTransformKernel();
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input  Source tensor with shape [num_tiles, OFM, 16]. Data types supported: F32
+     * @param[in]  biases Biases tensor. Biases are 1D tensor with dimensions [OFM]. Can be nullptr. Data type supported: same as @p input
+     * @param[out] output Destination tensor. 3 lower dimensions represent a single output [width, height, OFM]. Data types supported: same as @p input
+     * @param[in]  num_tiles_x Number of Winograd tiles along the x direction of the output
+     */
+    void configure(const ICLTensor *input, const ICLTensor *biases, ICLTensor *output, unsigned int num_tiles_x);
+
+    // Inherited methods overridden:
+    void run(const Window &window, cl::CommandQueue &queue) override;
+
+private:
+    const ICLTensor *_input;
+    const ICLTensor *_biases;
+    ICLTensor       *_output;
+};
+}
+#endif /* __ARM_COMPUTE_CLWINOGRADCONVOLUTIONLAYERKERNEL_H__ */
@@ -24,6 +24,8 @@
 #ifndef __ARM_COMPUTE_CPP_TYPES_H__
 #define __ARM_COMPUTE_CPP_TYPES_H__
 
+#include <cstddef>
+
 namespace arm_compute
 {
 /** Available CPU Targets */
@@ -38,6 +40,9 @@ enum class CPUTarget
     A7x        = 0x0070,
     A5x        = 0x0050,
     DOT        = 0x1000,
+    SVE        = 0x2000,
+
+    ARMV8_2_DOT = (ARMV8_2 | DOT),
 
     A53     = (ARMV8 | A7x | 0x3),
     A55     = (ARMV8_2 | A5x | 0x5),
@@ -55,11 +60,44 @@ struct CPUInfo
     int       L2_size{ 0 };
 };
 
+/** Check whether a CPU supports half-precision floating point arithmetic (ARMv8.2-A and above)
+ *
+ * @param[in] info CPU information to check
+ *
+ * @return True if the CPU implements the fp16 arithmetic extension
+ */
+inline bool cpu_has_fp16(const CPUInfo &info)
+{
+    return (static_cast<unsigned int>(info.CPU) & static_cast<unsigned int>(CPUTarget::ARCH_MASK)) >= static_cast<unsigned int>(CPUTarget::ARMV8_2);
+}
+
+/** Check whether a CPU implements the Scalable Vector Extension
+ *
+ * @param[in] info CPU information to check
+ *
+ * @return True if the CPU implements SVE
+ */
+inline bool cpu_has_sve(const CPUInfo &info)
+{
+    return (static_cast<unsigned int>(info.CPU) & static_cast<unsigned int>(CPUTarget::SVE)) != 0;
+}
+
+/** CPU cluster a thread has been pinned to */
+enum class CPUCluster
+{
+    Unknown, /**< The thread is not pinned to a specific cluster */
+    Little,  /**< LITTLE (high-efficiency) cluster */
+    Big      /**< big (high-performance) cluster */
+};
+
 struct ThreadInfo
 {
-    int     thread_id{ 0 };
-    int     num_threads{ 1 };
-    CPUInfo cpu_info{};
+    int        thread_id{ 0 };
+    int        num_threads{ 1 };
+    CPUCluster cluster{ CPUCluster::Unknown }; /**< Cluster the thread is pinned to, kernels can size their blocking accordingly */
+    CPUInfo    cpu_info{};
+    void      *workspace{ nullptr };           /**< Scratch arena private to this thread, reserved through IScheduler::reserve_workspace() */
+    size_t     workspace_size{ 0 };            /**< Size in bytes of the scratch arena */
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_CPP_TYPES_H__ */
@@ -35,6 +35,14 @@ class Window;
 class ICPPKernel : public IKernel
 {
 public:
+    /** Resource a kernel's throughput is limited by, used by the scheduler to size and place dispatches */
+    enum class ResourceProfile
+    {
+        GENERIC,        /**< No dominant bottleneck known */
+        COMPUTE_BOUND,  /**< Limited by the cores' arithmetic throughput; scales with the thread count */
+        BANDWIDTH_BOUND /**< Limited by memory bandwidth; stops scaling once the memory system is saturated */
+    };
+
     /** Default destructor */
     virtual ~ICPPKernel() = default;
 
@@ -50,6 +58,46 @@ public:
      * @param[in] info   Info about executing thread and CPU.
      */
     virtual void run(const Window &window, const ThreadInfo &info) = 0;
+
+    /** Name of the kernel, used e.g. by the scheduler's telemetry.
+     *
+     * @return Kernel name.
+     */
+    virtual const char *name() const
+    {
+        return "UnknownKernel";
+    }
+
+    /** Relative cost of processing one iteration of the kernel's window.
+     *
+     * Used by the scheduler together with Window::num_iterations() to decide whether fanning the
+     * kernel out to the thread pool is worth the wake-up latency: workloads whose total estimated
+     * cost falls below the scheduler's threshold run inline on the calling thread. The unit is
+     * arbitrary; 1 corresponds to a cheap element-wise operation on one window row. Kernels doing
+     * significant work per iteration (convolutions, GEMM blocks) should return a larger value.
+     *
+     * @return Estimated cost of one window iteration.
+     */
+    virtual unsigned int cost_per_iteration() const
+    {
+        return 1;
+    }
+
+    /** Resource profile of the kernel.
+     *
+     * The scheduler caps the thread count of bandwidth-bound kernels (extra threads past the
+     * memory system's saturation point only add contention and evict the caches for the
+     * kernels that follow) and can co-schedule them alongside an independent compute-bound
+     * kernel. The default is conservative; kernels known to saturate memory bandwidth should
+     * override this, and the profile of a kernel can be measured with the scheduler's
+     * telemetry by comparing dispatch times across thread counts.
+     *
+     * @return The kernel's resource profile.
+     */
+    virtual ResourceProfile resource_profile() const
+    {
+        return ResourceProfile::GENERIC;
+    }
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_ICPPKERNEL_H__ */
@@ -26,8 +26,8 @@
 
 #include "arm_compute/core/IArray.h"
 #include "arm_compute/core/NEON/INEKernel.h"
-#include "support/Mutex.h"
 
+#include <atomic>
 #include <cstdint>
 
 namespace arm_compute
@@ -57,18 +57,17 @@ public:
      *
      * @param[in]  input                 Source image (harris score). Format supported F32
      * @param[out] output                Destination array of InternalKeypoint
-     * @param[out] num_corner_candidates Number of corner candidates
+     * @param[out] num_corner_candidates Number of corner candidates, updated atomically from all the scheduler threads
      */
-    void configure(const IImage *input, InternalKeypoint *output, int32_t *num_corner_candidates);
+    void configure(const IImage *input, InternalKeypoint *output, std::atomic<int32_t> *num_corner_candidates);
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
 
 private:
-    int32_t           *_num_corner_candidates;   /**< Number of corner candidates */
-    arm_compute::Mutex _corner_candidates_mutex; /**< Mutex to preventing race conditions */
-    const IImage      *_input;                   /**< Source image - Harris score */
-    InternalKeypoint *_output;                   /**< Array of NEInternalKeypoint */
+    std::atomic<int32_t> *_num_corner_candidates; /**< Number of corner candidates */
+    const IImage         *_input;                 /**< Source image - Harris score */
+    InternalKeypoint     *_output;                /**< Array of NEInternalKeypoint */
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_CPPCORNERCANDIDATESKERNEL_H__ */
@@ -27,8 +27,8 @@
 #include "arm_compute/core/CPP/ICPPKernel.h"
 #include "arm_compute/core/IArray.h"
 
+#include <atomic>
 #include <cstdint>
-#include <mutex>
 
 namespace arm_compute
 {
@@ -53,15 +53,15 @@ public:
      * @param[in]     num_corner_candidates Pointer to the number of corner candidates in the input array
      * @param[in]     min_distance          Radial Euclidean distance to use
      */
-    void configure(InternalKeypoint *in_out, IKeyPointArray *output, const int32_t *num_corner_candidates, float min_distance);
+    void configure(InternalKeypoint *in_out, IKeyPointArray *output, const std::atomic<int32_t> *num_corner_candidates, float min_distance);
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
     bool is_parallelisable() const override;
 
 private:
-    const int32_t    *_num_corner_candidates; /**< Number of corner candidates */
-    float             _min_distance;          /**< Radial Euclidean distance */
+    const std::atomic<int32_t> *_num_corner_candidates; /**< Number of corner candidates */
+    float                       _min_distance;           /**< Radial Euclidean distance */
     InternalKeypoint *_in_out;                /**< Source array of InternalKeypoint */
     IKeyPointArray   *_output;                /**< Destination array of IKeyPointArray */
 };
@@ -78,13 +78,13 @@
  * @param[in] cond Condition to evaluate.
  * @param[in] ...  Message to print if cond is false.
  */
-#define ARM_COMPUTE_ERROR_ON_MSG(cond, ...) \
-    do                                      \
-    {                                       \
-        if(cond)                            \
-        {                                   \
-            ARM_COMPUTE_ERROR(__VA_ARGS__); \
-        }                                   \
+#define ARM_COMPUTE_ERROR_ON_MSG(cond, ...)                   \
+    do                                                        \
+    {                                                         \
+        if(::arm_compute::validation_enabled() && (cond))     \
+        {                                                     \
+            ARM_COMPUTE_ERROR(__VA_ARGS__);                   \
+        }                                                     \
     } while(0)
 
 /** If the condition is true, the given message is printed and an exception is thrown
@@ -98,7 +98,7 @@
 #define ARM_COMPUTE_ERROR_ON_LOC_MSG(cond, func, file, line, ...) \
     do                                                            \
     {                                                             \
-        if(cond)                                                  \
+        if(::arm_compute::validation_enabled() && (cond))         \
         {                                                         \
             ARM_COMPUTE_ERROR_LOC(func, file, line, __VA_ARGS__); \
         }                                                         \
@@ -110,7 +110,7 @@
  * @param[in] val  Value to be returned.
  * @param[in] msg  Message to print if cond is false.
  */
-#define ARM_COMPUTE_CONST_ON_ERROR(cond, val, msg) (cond) ? throw std::logic_error(msg) : val;
+#define ARM_COMPUTE_CONST_ON_ERROR(cond, val, msg) (::arm_compute::validation_enabled() && (cond)) ? throw std::logic_error(msg) : val;
 #else /* ARM_COMPUTE_ASSERTS_ENABLED */
 #define ARM_COMPUTE_ERROR_ON_MSG(cond, ...)
 #define ARM_COMPUTE_ERROR_ON_LOC_MSG(cond, func, file, line, ...)
@@ -155,6 +155,53 @@ namespace arm_compute
  * @param[in] ...      Variable number of arguments of the message.
  */
 void debug(const char *function, const char *file, const int line, const char *msg, ...);
+
+/** Returns whether the calling thread's validation checks are currently executed.
+ *
+ * @return True if validation checks run, false while they are suspended.
+ */
+bool validation_enabled();
+
+/** Enables or disables the runtime validation checks of asserts-enabled builds.
+ *
+ * Thread-affine: only the calling thread's checks are affected. While disabled, every
+ * ARM_COMPUTE_ERROR_ON* check - including the tensor and window validation built on top of
+ * them in Validate.h - reduces to a flag check and its condition is not evaluated. Intended
+ * for validate-once, run-many use: keep validation on for the first configuration of a
+ * pipeline, then suspend it around steady-state reconfiguration and execution (see
+ * @ref ValidationSuspender). Builds without ARM_COMPUTE_ASSERTS_ENABLED compile the checks
+ * out entirely and ignore this switch.
+ *
+ * @param[in] enabled True to execute validation checks on the calling thread.
+ */
+void set_validation_enabled(bool enabled);
+
+/** Scope guard suspending the calling thread's validation checks.
+ *
+ * Restores the previous state on destruction, so suspended scopes nest.
+ */
+class ValidationSuspender
+{
+public:
+    /** Constructor: suspends validation on the calling thread */
+    ValidationSuspender()
+        : _was_enabled(validation_enabled())
+    {
+        set_validation_enabled(false);
+    }
+    /** Destructor: restores the state validation was in before */
+    ~ValidationSuspender()
+    {
+        set_validation_enabled(_was_enabled);
+    }
+    /** Prevent instances of this class from being copied */
+    ValidationSuspender(const ValidationSuspender &) = delete;
+    /** Prevent instances of this class from being copied */
+    ValidationSuspender &operator=(const ValidationSuspender &) = delete;
+
+private:
+    bool _was_enabled; /**< State to restore on destruction */
+};
 }
 
 #endif /* __ARM_COMPUTE_ERROR_H__ */
@@ -41,6 +41,7 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace arm_compute
 {
@@ -298,6 +299,16 @@ public:
      */
     void reset(size_t dimension);
 
+    /** Prefetch into the cache the line holding the byte at the given offset from the current position.
+     *
+     * Emits the architecture's prefetch-for-read hint (PLD on ARM, PRFM on AArch64). Intended for
+     * strided access patterns the hardware prefetcher does not follow, e.g. reading the rows the
+     * next window iteration will touch while the current one computes.
+     *
+     * @param[in] offset Offset in bytes from the current position to the byte to prefetch.
+     */
+    void prefetch(int offset) const;
+
 private:
     uint8_t *_ptr;
 
@@ -327,6 +338,38 @@ private:
 template <typename L, typename... Ts>
 inline void execute_window_loop(const Window &w, L &&lambda_function, Ts &&... iterators);
 
+/** Iterate through the first two dimensions of the passed window in cache-sized square blocks,
+ * calling the function once per block with the block's sub-window.
+ *
+ * Kernels whose access pattern strides through memory (e.g. transposes) use this to walk
+ * l1_block-sided blocks nested inside l2_block-sided ones, so each block's working set stays
+ * resident in the respective cache level. The block sides must be multiples of the window's
+ * steps (see @ref cache_block_side) and higher window dimensions are left untouched.
+ *
+ * @param[in] w               Window to iterate through.
+ * @param[in] l1_block        Side length of the inner blocks, in elements.
+ * @param[in] l2_block        Side length of the outer blocks, in elements. Must not be smaller than @p l1_block.
+ * @param[in] lambda_function The function of type void(function)( const Window & block ) to call for each block.
+ */
+template <typename L>
+inline void execute_window_blocked(const Window &w, int l1_block, int l2_block, L &&lambda_function);
+
+/** Iterate through the passed window one row at a time, visiting every plane (dimension Z) of a
+ * row before moving to the next row, and calling the function once per row with the row's
+ * sub-window.
+ *
+ * The default loop nest of @ref execute_window_loop finishes a whole plane before touching the
+ * next one. Kernels whose per-element work reads across planes (e.g. cross-map normalization)
+ * use this channel-major order instead, so the plane rows a neighbourhood revisits are still
+ * cache resident rather than re-fetched once per plane. Window dimensions above Z are left
+ * untouched.
+ *
+ * @param[in] w               Window to iterate through.
+ * @param[in] lambda_function The function of type void(function)( const Window & row ) to call for each row.
+ */
+template <typename L>
+inline void execute_window_channel_major(const Window &w, L &&lambda_function);
+
 /** Update window and padding size for each of the access patterns.
  *
  * First the window size is reduced based on all access patterns that are not
@@ -393,6 +436,60 @@ Window calculate_max_window_horizontal(const ITensorInfo &info, const Steps &ste
  */
 Window calculate_max_enlarged_window(const ITensorInfo &info, const Steps &steps = Steps(), BorderSize border_size = BorderSize());
 
+/** Collapse the dimensions above Window::DimY of a kernel window into one flat loop when every
+ * given tensor is stored contiguously in memory.
+ *
+ * Element-wise kernels pay per-dimension bookkeeping on every window step even though they only
+ * stream elements. When none of the tensors have padding, rows and planes tile the buffers back
+ * to back, so the dimensions above DimY can be folded into it and the kernel degrades to a
+ * single pointer-bump loop per scheduler split.
+ *
+ * @note A tensor's padding can be extended by later-configured kernels until it is allocated, so
+ *       this must only be called once every tensor's layout is final - kernels defer it to their
+ *       first dispatch through @ref IKernel::collapse_window_when_contiguous.
+ *
+ * @param[in] window  Maximum window calculated for the kernel.
+ * @param[in] tensors Infos of all the tensors the kernel accesses through the window.
+ *
+ * @return The collapsed window if all tensors are contiguous, the unchanged window otherwise.
+ */
+Window collapse_window_if_contiguous(const Window &window, std::initializer_list<const ITensorInfo *> tensors);
+/** @overload
+ *
+ * @param[in] window  Maximum window calculated for the kernel.
+ * @param[in] tensors Infos of all the tensors the kernel accesses through the window.
+ *
+ * @return The collapsed window if all tensors are contiguous, the unchanged window otherwise.
+ */
+Window collapse_window_if_contiguous(const Window &window, const std::vector<const ITensorInfo *> &tensors);
+
+/** Largest block side length whose square working set fits in about half of a cache.
+ *
+ * Companion of @ref execute_window_blocked: a block of the returned side touches
+ * 2 * side^2 * element_size bytes between its source and destination, targeting half the
+ * cache so other data is not fully evicted.
+ *
+ * @param[in] cache_size   Size of the targeted cache level in bytes.
+ * @param[in] element_size Size of one element in bytes.
+ * @param[in] step         Window step the block side must be a multiple of.
+ *
+ * @return The block side length in elements, always a non-zero multiple of @p step.
+ */
+int cache_block_side(size_t cache_size, size_t element_size, int step);
+
+/** Check whether a kernel has to execute without growing any tensor padding.
+ *
+ * A tensor whose layout is already fixed - allocated, imported from external memory or
+ * explicitly marked non-resizable - and which carries no border cannot satisfy a kernel's
+ * padded access pattern; the kernel has to fall back to an execution path that handles the
+ * borders itself. Kernels supporting such a path call this at configure time.
+ *
+ * @param[in] tensors Infos of all the tensors the kernel accesses. Null entries are ignored.
+ *
+ * @return True if at least one tensor's layout is fixed without padding.
+ */
+bool padding_less_execution_required(std::initializer_list<const ITensorInfo *> tensors);
+
 /** Intersect multiple valid regions.
  *
  * @param[in] regions Valid regions.
@@ -132,6 +132,52 @@ inline void execute_window_loop(const Window &w, L &&lambda_function, Ts &&... i
     ForEachDimension<Coordinates::num_max_dimensions>::unroll(w, id, std::forward<L>(lambda_function), std::forward<Ts>(iterators)...);
 }
 
+template <typename L>
+inline void execute_window_blocked(const Window &w, int l1_block, int l2_block, L &&lambda_function)
+{
+    ARM_COMPUTE_ERROR_ON(l1_block <= 0 || l2_block < l1_block);
+    ARM_COMPUTE_ERROR_ON(l1_block % w.x().step() != 0 || l1_block % std::max(w.y().step(), 1) != 0);
+
+    Window block(w);
+
+    for(int y2 = w.y().start(); y2 < w.y().end(); y2 += l2_block)
+    {
+        const int y2_end = std::min(y2 + l2_block, w.y().end());
+        for(int x2 = w.x().start(); x2 < w.x().end(); x2 += l2_block)
+        {
+            const int x2_end = std::min(x2 + l2_block, w.x().end());
+            for(int y1 = y2; y1 < y2_end; y1 += l1_block)
+            {
+                block.set(Window::DimY, Window::Dimension(y1, std::min(y1 + l1_block, y2_end), w.y().step()));
+                for(int x1 = x2; x1 < x2_end; x1 += l1_block)
+                {
+                    block.set(Window::DimX, Window::Dimension(x1, std::min(x1 + l1_block, x2_end), w.x().step()));
+                    lambda_function(block);
+                }
+            }
+        }
+    }
+}
+
+template <typename L>
+inline void execute_window_channel_major(const Window &w, L &&lambda_function)
+{
+    const int step_y = std::max(w.y().step(), 1);
+    const int step_z = std::max(w.z().step(), 1);
+
+    Window row(w);
+
+    for(int y = w.y().start(); y < w.y().end(); y += step_y)
+    {
+        row.set(Window::DimY, Window::Dimension(y, y + step_y, w.y().step()));
+        for(int z = w.z().start(); z < w.z().end(); z += step_z)
+        {
+            row.set(Window::DimZ, Window::Dimension(z, z + step_z, w.z().step()));
+            lambda_function(row);
+        }
+    }
+}
+
 inline constexpr Iterator::Iterator()
     : _ptr(nullptr), _dims()
 {
@@ -197,6 +243,11 @@ inline void Iterator::reset(const size_t dimension)
     }
 }
 
+inline void Iterator::prefetch(const int offset) const
+{
+    __builtin_prefetch(ptr() + offset);
+}
+
 inline bool auto_init_if_empty(ITensorInfo &info, const TensorShape &shape, int num_channels, DataType data_type, int fixed_point_position)
 {
     if(info.tensor_shape().total_size() == 0)
@@ -25,6 +25,8 @@
 #define __ARM_COMPUTE_IARRAY_H__
 
 #include "arm_compute/core/Error.h"
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 
@@ -36,7 +38,11 @@ struct DetectionWindow;
 class Size2D;
 struct ROI;
 
-/** Array of type T */
+/** Array of type T
+ *
+ * Values are appended with an atomic slot reservation, so all the threads of a multi-threaded
+ * kernel can push_back() concurrently without serializing on a lock.
+ */
 template <class T>
 class IArray
 {
@@ -52,6 +58,18 @@ public:
         : _num_values(0), _max_size(max_num_values)
     {
     }
+    /** Allow instances of this class to be moved */
+    IArray(IArray &&other)
+        : _num_values(other._num_values.load(std::memory_order_relaxed)), _max_size(other._max_size)
+    {
+    }
+    /** Allow instances of this class to be moved */
+    IArray &operator=(IArray &&other)
+    {
+        _num_values.store(other._num_values.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        _max_size = other._max_size;
+        return *this;
+    }
     /** Maximum number of values which can be stored in this array
      *
      * @return Maximum number of values
@@ -68,9 +86,13 @@ public:
      */
     size_t num_values() const
     {
-        return _num_values;
+        return std::min(_num_values.load(std::memory_order_relaxed), _max_size + 1);
     }
     /** Append the passed argument to the end of the array if there is room.
+     *
+     * Thread-safe: each caller claims its slot with an atomic counter increment, so values can
+     * be emitted from all scheduler threads in parallel. Slots only become visible to other
+     * threads once the producing kernel has completed.
      *
      * @param[in] val Value to add to the array.
      *
@@ -79,19 +101,18 @@ public:
     bool push_back(const T &val)
     {
         ARM_COMPUTE_ERROR_ON(0 == _max_size);
-        if(_num_values >= max_num_values())
+        const size_t idx = _num_values.fetch_add(1, std::memory_order_relaxed);
+        if(idx >= max_num_values())
         {
-            _num_values = max_num_values() + 1;
             return false;
         }
-        at(_num_values) = val;
-        _num_values++;
+        at(idx) = val;
         return true;
     }
     /** Clear all the points from the array. */
     void clear()
     {
-        _num_values = 0;
+        _num_values.store(0, std::memory_order_relaxed);
     }
     /** Did we lose some values because the array is too small?
      *
@@ -100,7 +121,7 @@ public:
      */
     bool overflow() const
     {
-        return _num_values > max_num_values();
+        return _num_values.load(std::memory_order_relaxed) > max_num_values();
     }
     /** Pointer to the first element of the array
      *
@@ -129,12 +150,12 @@ public:
     void resize(size_t num)
     {
         ARM_COMPUTE_ERROR_ON(num > max_num_values());
-        _num_values = num;
+        _num_values.store(num, std::memory_order_relaxed);
     };
 
 private:
-    size_t _num_values;
-    size_t _max_size;
+    std::atomic<size_t> _num_values; /**< Number of claimed slots, may exceed the capacity when producers overflow */
+    size_t              _max_size;
 };
 using IKeyPointArray        = IArray<KeyPoint>;
 using ICoordinates2DArray   = IArray<Coordinates2D>;
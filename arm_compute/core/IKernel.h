@@ -27,8 +27,13 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Window.h"
 
+#include <initializer_list>
+#include <vector>
+
 namespace arm_compute
 {
+class ITensorInfo;
+
 /** Common information for all the kernels */
 class IKernel
 {
@@ -57,6 +62,25 @@ public:
      * @return The maximum window the kernel can be executed on.
      */
     const Window &window() const;
+    /** Trim the execution window to an actual shape smaller than the configured maximum
+     *
+     * This is the cheap path for variable input sizes: the kernel is configured once against the
+     * maximum shape (so the tensors are allocated once, padded to the maximum) and only the window
+     * is shrunk per sample, avoiding reconfiguration and reallocation entirely. Each dimension's
+     * end is clamped to the actual extent rounded up to the window step, so kernels processing
+     * several elements per iteration keep doing so and read into the maximum-sized padding. The
+     * tensors must keep their maximum shape (and therefore strides): the actual data is expected
+     * in the top-left corner of the maximum-sized buffer.
+     *
+     * Only valid for kernels which take their extents from the window alone; kernels which bake
+     * the configure-time shape into internal state must be reconfigured instead.
+     *
+     * @param[in] shape Actual shape to execute on. Dimensions beyond the shape's dimensionality
+     *                  keep their configured extent.
+     */
+    void trim_window(const TensorShape &shape);
+    /** Restore the execution window to the configured maximum */
+    void reset_window();
 
 protected:
     /** Configure the kernel's window
@@ -64,9 +88,27 @@ protected:
      * @param[in] window The maximum window which will be returned by window()
      */
     void configure(const Window &window);
+    /** Request collapsing the window with @ref collapse_window_if_contiguous at the first dispatch
+     *
+     * A tensor's padding can still be extended by later-configured kernels up to its allocation,
+     * so contiguity cannot be decided when this kernel is configured. The decision is instead
+     * deferred to the first call to window(), by which time every tensor has been allocated and
+     * its padding is final. The given infos must stay valid until then.
+     *
+     * @note A call to trim_window() drops a pending collapse: trimmed execution leaves part of
+     *       each dimension unused, so the tensors are never contiguous along the trimmed window.
+     *
+     * @param[in] tensors Infos of all the tensors the kernel accesses through the window.
+     */
+    void collapse_window_when_contiguous(std::initializer_list<const ITensorInfo *> tensors);
 
 private:
-    Window _window;
+    /** Perform a requested window collapse, once, at the first dispatch */
+    void resolve_deferred_collapse() const;
+
+    mutable Window                           _window;
+    mutable Window                           _max_window;
+    mutable std::vector<const ITensorInfo *> _collapse_tensors;
 };
 }
 #endif /*__ARM_COMPUTE_IKERNEL_H__ */
@@ -125,6 +125,26 @@ public:
      * @return The fixed point position that expresses the number of bits for the fractional part of the number
      */
     virtual int fixed_point_position() const = 0;
+    /** Get the quantization settings (scale and offset) of the tensor.
+     *
+     * @return A QuantizationInfo containing the scale and offset.
+     */
+    virtual QuantizationInfo quantization_info() const = 0;
+    /** Set the quantization settings (scale and offset) of the tensor.
+     *
+     * @param[in] quantization_info QuantizationInfo containing the scale and offset
+     */
+    virtual void set_quantization_info(QuantizationInfo quantization_info) = 0;
+    /** Get the data layout of the tensor.
+     *
+     * @return The layout the tensor dimensions map to (NCHW unless set otherwise).
+     */
+    virtual DataLayout data_layout() const = 0;
+    /** Set the data layout of the tensor.
+     *
+     * @param[in] data_layout Layout the tensor dimensions map to
+     */
+    virtual void set_data_layout(DataLayout data_layout) = 0;
     /** Element size in bytes calculated as data_size() * num_channels()
      *
      * @return The size of one element in bytes
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEKERNELREGISTRY_H__
+#define __ARM_COMPUTE_NEKERNELREGISTRY_H__
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/CPP/ICPPKernel.h"
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+/** Registry of micro-architecture-specialized kernel variants, resolved at configure time
+ *
+ * Kernel selection in the library is mostly a compile-time affair; this registry complements it
+ * with a runtime dispatch step so one shipped binary runs the best available implementation on
+ * every device. Each operation is identified by name and can hold several variants, each tagged
+ * with the @ref CPUTarget it requires: an architecture level at minimum, optionally a concrete
+ * CPU model (e.g. an in-order-friendly Cortex-A53 schedule) or an instruction set feature such
+ * as the ARMv8.2 dot product extension. @ref create resolves the most specific variant the
+ * running CPU satisfies, so functions query the registry once in their configure() step.
+ *
+ * The registry is pre-populated with the library's own assembly GEMM/GEMV kernels; additional
+ * variants can be registered before the first configure() call and override the built-ins.
+ */
+class NEKernelRegistry final
+{
+public:
+    /** Common factory signature creating one unconfigured variant of an operation's kernel */
+    using KernelFactory = std::function<std::unique_ptr<ICPPKernel>()>;
+
+    /** Access the registry's singleton
+     *
+     * @return The kernel registry
+     */
+    static NEKernelRegistry &get();
+    /** Registers a micro-architecture variant of an operation
+     *
+     * @param[in] op      Name of the operation the kernel implements
+     * @param[in] target  CPU target the variant requires. The architecture level gates
+     *                    eligibility, model and feature bits make the variant more specific.
+     * @param[in] factory Factory creating an unconfigured kernel instance
+     */
+    void register_variant(std::string op, CPUTarget target, KernelFactory factory);
+    /** Creates the most specific registered variant the given CPU can run
+     *
+     * @param[in] op   Name of the operation
+     * @param[in] info CPU to dispatch for, normally the scheduler's
+     *
+     * @return An unconfigured kernel instance, nullptr if no registered variant is eligible
+     */
+    std::unique_ptr<ICPPKernel> create(const std::string &op, const CPUInfo &info) const;
+    /** Creates the most specific registered variant the given CPU can run, as the operation's base type
+     *
+     * All variants registered under @p op must derive from @p T.
+     *
+     * @param[in] op   Name of the operation
+     * @param[in] info CPU to dispatch for, normally the scheduler's
+     *
+     * @return An unconfigured kernel instance, nullptr if no registered variant is eligible
+     */
+    template <typename T>
+    std::unique_ptr<T> create_as(const std::string &op, const CPUInfo &info) const
+    {
+        return std::unique_ptr<T>(static_cast<T *>(create(op, info).release()));
+    }
+
+private:
+    /** Constructor, registers the library's built-in variants */
+    NEKernelRegistry();
+
+    /** One registered variant of an operation */
+    struct Variant
+    {
+        CPUTarget     _target;  /**< CPU target the variant requires */
+        KernelFactory _factory; /**< Factory creating the kernel */
+    };
+
+    std::map<std::string, std::vector<Variant>> _variants; /**< Registered variants, grouped by operation name */
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NEKERNELREGISTRY_H__ */
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEVECTORTRAITS_H__
+#define __ARM_COMPUTE_NEVECTORTRAITS_H__
+
+#if defined(__ARM_FEATURE_SVE)
+#include <arm_sve.h>
+#else /* defined(__ARM_FEATURE_SVE) */
+#include <arm_neon.h>
+#endif /* defined(__ARM_FEATURE_SVE) */
+
+#include <algorithm>
+#include <cstring>
+
+namespace arm_compute
+{
+/** Vector-length-agnostic (VLA) kernel primitives.
+ *
+ * NEON kernels traditionally bake the 128-bit register width into their windows (fixed 16-byte
+ * steps) and their inner loops. Kernels written against this namespace instead query the vector
+ * length at configure time and run one predicated loop per row: the same source compiles to
+ * 128-bit NEON today and to whatever register length an SVE machine provides, without forking
+ * the kernel per instruction set.
+ *
+ * The programming model follows SVE: every operation takes a predicate obtained from
+ * @ref active_lanes_f32, and the loop's final, partial iteration is handled by the predicate
+ * rather than by a scalar tail. On the NEON fallback the "predicate" is an active-lane count
+ * and partial accesses are realised with small buffered copies, so the tail stays correct at
+ * unchanged full-vector throughput.
+ */
+namespace vla
+{
+/** Width in bytes of the vector registers of the machine the library is running on
+ *
+ * @return The vector width in bytes
+ */
+inline unsigned int vector_width_bytes()
+{
+#if defined(__ARM_FEATURE_SVE)
+    return static_cast<unsigned int>(svcntb());
+#else  /* defined(__ARM_FEATURE_SVE) */
+    return 16;
+#endif /* defined(__ARM_FEATURE_SVE) */
+}
+
+/** Number of elements of type @p T one vector register holds
+ *
+ * VLA kernels use this as their window step instead of a hardcoded element count.
+ *
+ * @return The number of lanes of type @p T
+ */
+template <typename T>
+inline unsigned int num_lanes()
+{
+    return vector_width_bytes() / sizeof(T);
+}
+
+#if defined(__ARM_FEATURE_SVE)
+
+using vec_f32 = svfloat32_t; /**< VLA vector of F32 elements */
+using pred    = svbool_t;    /**< VLA loop predicate */
+
+/** Predicate enabling lanes [@p i, @p n) of the current iteration */
+inline pred active_lanes_f32(unsigned int i, unsigned int n)
+{
+    return svwhilelt_b32(i, n);
+}
+
+/** Broadcast @p value to every lane */
+inline vec_f32 vdup(pred pg, float value)
+{
+    (void)pg;
+    return svdup_f32(value);
+}
+
+/** Load the active lanes from @p ptr, inactive lanes are zero */
+inline vec_f32 vload(pred pg, const float *ptr)
+{
+    return svld1_f32(pg, ptr);
+}
+
+/** Store the active lanes to @p ptr */
+inline void vstore(pred pg, float *ptr, vec_f32 v)
+{
+    svst1_f32(pg, ptr, v);
+}
+
+/** Lane-wise maximum */
+inline vec_f32 vmax(pred pg, vec_f32 a, vec_f32 b)
+{
+    return svmax_f32_x(pg, a, b);
+}
+
+/** Lane-wise minimum */
+inline vec_f32 vmin(pred pg, vec_f32 a, vec_f32 b)
+{
+    return svmin_f32_x(pg, a, b);
+}
+
+/** Lane-wise absolute value */
+inline vec_f32 vabs(pred pg, vec_f32 a)
+{
+    return svabs_f32_x(pg, a);
+}
+
+/** Lane-wise multiply-accumulate: acc + a * b */
+inline vec_f32 vmla(pred pg, vec_f32 acc, vec_f32 a, vec_f32 b)
+{
+    return svmla_f32_x(pg, acc, a, b);
+}
+
+#else /* defined(__ARM_FEATURE_SVE) */
+
+using vec_f32 = float32x4_t; /**< VLA vector of F32 elements */
+using pred    = unsigned int; /**< VLA loop predicate: number of active leading lanes */
+
+/** Predicate enabling lanes [@p i, @p n) of the current iteration */
+inline pred active_lanes_f32(unsigned int i, unsigned int n)
+{
+    return std::min(4U, (n > i) ? (n - i) : 0U);
+}
+
+/** Broadcast @p value to every lane */
+inline vec_f32 vdup(pred pg, float value)
+{
+    (void)pg;
+    return vdupq_n_f32(value);
+}
+
+/** Load the active lanes from @p ptr, inactive lanes are zero */
+inline vec_f32 vload(pred pg, const float *ptr)
+{
+    if(pg >= 4)
+    {
+        return vld1q_f32(ptr);
+    }
+    float buf[4] = { 0.f, 0.f, 0.f, 0.f };
+    std::memcpy(buf, ptr, pg * sizeof(float));
+    return vld1q_f32(buf);
+}
+
+/** Store the active lanes to @p ptr */
+inline void vstore(pred pg, float *ptr, vec_f32 v)
+{
+    if(pg >= 4)
+    {
+        vst1q_f32(ptr, v);
+        return;
+    }
+    float buf[4];
+    vst1q_f32(buf, v);
+    std::memcpy(ptr, buf, pg * sizeof(float));
+}
+
+/** Lane-wise maximum */
+inline vec_f32 vmax(pred pg, vec_f32 a, vec_f32 b)
+{
+    (void)pg;
+    return vmaxq_f32(a, b);
+}
+
+/** Lane-wise minimum */
+inline vec_f32 vmin(pred pg, vec_f32 a, vec_f32 b)
+{
+    (void)pg;
+    return vminq_f32(a, b);
+}
+
+/** Lane-wise absolute value */
+inline vec_f32 vabs(pred pg, vec_f32 a)
+{
+    (void)pg;
+    return vabsq_f32(a);
+}
+
+/** Lane-wise multiply-accumulate: acc + a * b */
+inline vec_f32 vmla(pred pg, vec_f32 acc, vec_f32 a, vec_f32 b)
+{
+    (void)pg;
+    return vmlaq_f32(acc, a, b);
+}
+
+#endif /* defined(__ARM_FEATURE_SVE) */
+} // namespace vla
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NEVECTORTRAITS_H__ */
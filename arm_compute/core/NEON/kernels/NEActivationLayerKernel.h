@@ -27,6 +27,8 @@
 #include "arm_compute/core/FixedPoint.h"
 #include "arm_compute/core/NEON/INEKernel.h"
 
+#include <array>
+
 #ifdef ARM_COMPUTE_ENABLE_FP16
 #include <arm_fp16.h>
 #endif /* ARM_COMPUTE_ENABLE_FP16 */
@@ -49,16 +51,36 @@ public:
     NEActivationLayerKernel &operator=(const NEActivationLayerKernel &) = delete;
     /** Default move assignment operator */
     NEActivationLayerKernel &operator=(NEActivationLayerKernel &&) = default;
+    /** Number of consecutive row elements summarized by one byte of the zero mask */
+    static constexpr unsigned int zero_mask_segment_size = 16;
+
     /** Set the input and output tensor.
      *
      * @note If the output tensor is a nullptr, the activation function will be performed in-place
      *
+     * @note If a tensor's layout is already fixed without padding (e.g. memory imported from a
+     *       camera buffer), the kernel runs in padding-less mode: the vector loop covers the
+     *       aligned part of each row and the leftover columns are processed with a scalar tail.
+     *       Only supported for F32.
+     *
+     * @note For 8-bit data types (QS8/QASYMM8) the LOGISTIC, TANH and SOFT_RELU activations
+     *       are precomputed into a 256-entry lookup table at configure time and applied with a
+     *       plain table lookup instead of vector transcendental math.
+     *
+     * @note If @p zero_mask is set, the kernel additionally emits a sparsity summary of its
+     *       result: one byte per @ref zero_mask_segment_size consecutive elements of each row.
+     *       A zero byte guarantees that every element of the segment is zero, which lets
+     *       downstream kernels (e.g. @ref NEPoolingLayerKernel) skip all-zero regions of
+     *       zero-heavy post-ReLU feature maps. Only supported for F32.
+     *
      * @param[in, out] input           Source tensor. In case of @p output tensor = nullptr, this tensor will store the result
-     *                                 of the activation function. Data types supported: QS8/QS16/F32.
+     *                                 of the activation function. Data types supported: QS8/QASYMM8/QS16/F32.
      * @param[out]     output          Destination tensor. Data type supported: same as @p input
      * @param[in]      activation_info Activation layer information.
+     * @param[out]     zero_mask       (Optional) Zero mask tensor. Data type supported: U8. Its first dimension must be
+     *                                 ceil(width / @ref zero_mask_segment_size) and the remaining dimensions must match the input.
      */
-    void configure(ITensor *input, ITensor *output, ActivationLayerInfo activation_info);
+    void configure(ITensor *input, ITensor *output, ActivationLayerInfo activation_info, ITensor *zero_mask = nullptr);
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
@@ -95,13 +117,47 @@ private:
      *  @param[in] window Region on which to execute the kernel
      */
     template <ActivationLayerInfo::ActivationFunction F, typename T>
+    typename std::enable_if<std::is_same<T, uint8_t>::value, void>::type activation(const Window &window);
+    /** Function to apply an activation function on a tensor.
+     *
+     *  @param[in] window Region on which to execute the kernel
+     */
+    template <ActivationLayerInfo::ActivationFunction F, typename T>
     typename std::enable_if<std::is_same<T, qint16_t>::value, void>::type activation(const Window &window);
+    /** Vector-length-agnostic variant applying the activation function through the @ref vla primitives
+     *
+     * One predicated loop covers the whole row, including the partial final iteration, so the
+     * window step is the runtime vector length and no scalar tail or padding is needed. Used in
+     * padding-less mode for the activations expressible with the VLA primitive set.
+     *
+     *  @param[in] window Region on which to execute the kernel
+     */
+    template <ActivationLayerInfo::ActivationFunction F>
+    void activation_vla_f32(const Window &window);
+    /** Scalar epilogue applying the activation function to the columns the vector loop left over
+     *
+     *  @param[in] window Region on which to execute the kernel, with a step of one in X
+     */
+    void activation_scalar_f32(const Window &window);
+    /** Summarize the rows of the result covered by @p window into the zero mask
+     *
+     *  @param[in] window Region the activation function has been executed on
+     */
+    void compute_zero_mask(const Window &window);
+    /** Apply the activation function through the 256-entry lookup table built at configure time
+     *
+     *  @param[in] window Region on which to execute the kernel
+     */
+    void activation_lut(const Window &window);
 
 private:
     ITensor                      *_input;
     ITensor                      *_output;
+    ITensor                      *_zero_mask;
     ActivationFunctionExecutorPtr _func;
     ActivationLayerInfo           _act_info;
+    bool                          _padding_less;
+    std::array<uint8_t, 256>      _lut;
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEACTIVATIONLAYERKERNEL_H__ */
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEARGMAXKERNEL_H__
+#define __ARM_COMPUTE_NEARGMAXKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the kernel computing the index of the maximum value of each row.
+ *
+ * Because quantization is monotonic, the argmax of the quantized logits equals the argmax
+ * of the real values: classifiers that only need the class index can run this kernel
+ * directly on the quantized network output, skipping dequantization and softmax entirely.
+ */
+class NEArgMaxKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEArgMaxKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEArgMaxKernel(const NEArgMaxKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEArgMaxKernel &operator=(const NEArgMaxKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEArgMaxKernel(NEArgMaxKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEArgMaxKernel &operator=(NEArgMaxKernel &&) = default;
+    /** Default destructor */
+    ~NEArgMaxKernel() = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input  Source tensor. The maximum is taken along the X dimension.
+     *                    Data types supported: QS8/QASYMM8/QS16/F32.
+     * @param[out] output Destination tensor holding one index per row, the first occurrence
+     *                    of the maximum. Its first dimension must be 1 and the remaining
+     *                    dimensions must match the input. Data type supported: U32.
+     */
+    void configure(const ITensor *input, ITensor *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    using ArgMaxFunction = void(const ITensor *in, ITensor *out, const Window &window);
+
+private:
+    ArgMaxFunction *_func;
+    const ITensor  *_input;
+    ITensor        *_output;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NEARGMAXKERNEL_H__ */
@@ -64,6 +64,7 @@ public:
      *
      * @param[in]  input1 An input tensor. Data types supported: U8/QS8/QS16/S16/F16/F32
      * @param[in]  input2 An input tensor. Data types supported: U8/QS8/QS16/S16/F16/F32
+     * @note This kernel can run in-place: @p output may be the same tensor as @p input1 or @p input2 (for matching data types).
      * @param[out] output The output tensor. Data types supported: U8/QS8/QS16/S16/F16/F32.
      * @param[in]  policy Overflow policy.
      */
@@ -77,6 +78,7 @@ private:
      *
      * @param[in]  input1 An input tensor. Data types supported: U8/QS8/QS16/S16/F16/F32
      * @param[in]  input2 An input tensor. Data types supported: U8/QS8/QS16/S16/F16/F32
+     * @note This kernel can run in-place: @p output may be the same tensor as @p input1 or @p input2 (for matching data types).
      * @param[out] output The output tensor. Data types supported: U8/QS8/QS16/S16/F16/F32.
      * @param[in]  window Region on which to execute the kernel.
      */
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEBACKGROUNDMODELKERNEL_H__
+#define __ARM_COMPUTE_NEBACKGROUNDMODELKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the fused background model update kernel
+ *
+ * Maintains a per-pixel running mean and running variance of the input frames and emits a
+ * foreground mask, all in a single traversal of the frame. Given the blending factor
+ * @f$ \alpha @f$ the state is updated as:
+ * @f[ mean(x,y) = mean(x,y) + \alpha * (frame(x,y) - mean(x,y)) @f]
+ * @f[ var(x,y) = var(x,y) + \alpha * ((frame(x,y) - mean(x,y))^2 - var(x,y)) @f]
+ * and a pixel is flagged as foreground (255, background is 0) when its squared deviation from
+ * the mean exceeds @f$ threshold^2 @f$ times the variance, both taken before the update.
+ *
+ * This replaces an accumulate, accumulate-squared, absolute difference and threshold pass over
+ * the same frame when modelling a mostly-static background.
+ */
+class NEBackgroundModelKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEBackgroundModelKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBackgroundModelKernel(const NEBackgroundModelKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBackgroundModelKernel &operator=(const NEBackgroundModelKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEBackgroundModelKernel(NEBackgroundModelKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEBackgroundModelKernel &operator=(NEBackgroundModelKernel &&) = default;
+    /** Default destructor */
+    ~NEBackgroundModelKernel() = default;
+
+    /** Set the frame, the state tensors and the output mask
+    *
+    * The mean and variance tensors carry the model from frame to frame and must be
+    * initialised by the caller before the first run (e.g. mean to the first frame and
+    * variance to zero).
+    *
+    * @param[in]     frame     Source frame. Data type supported: U8.
+    * @param[in,out] mean      Running mean of the frames. Data type supported: F32.
+    * @param[in,out] variance  Running variance of the frames. Data type supported: F32.
+    * @param[out]    mask      Foreground mask, 255 for foreground and 0 for background. Data type supported: U8.
+    * @param[in]     alpha     Blending factor in the range [0.0f, 1.0f].
+    * @param[in]     threshold Number of standard deviations a pixel may differ from the mean before it is flagged as foreground.
+    */
+    void configure(const ITensor *frame, ITensor *mean, ITensor *variance, ITensor *mask, float alpha, float threshold);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_frame;     /**< Input frame */
+    ITensor       *_mean;      /**< Running mean of the frames */
+    ITensor       *_variance;  /**< Running variance of the frames */
+    ITensor       *_mask;      /**< Output foreground mask */
+    float          _alpha;     /**< Blending factor */
+    float          _threshold; /**< Foreground threshold in standard deviations */
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEBACKGROUNDMODELKERNEL_H__ */
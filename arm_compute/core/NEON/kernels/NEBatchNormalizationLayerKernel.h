@@ -62,20 +62,89 @@ public:
      * @param[out]     output  Destination tensor. Output will have the same number of dimensions as input. Data type supported: same as @p input
      */
     void configure(ITensor *input, ITensor *output, const ITensor *mean, const ITensor *var, const ITensor *beta, const ITensor *gamma, float epsilon);
+    /** Set the input and output tensors using pre-folded parameters.
+     *
+     * At inference time mean/var/beta/gamma are frozen, so batch normalization reduces to an
+     * affine transform per feature map. This overload consumes the (scale, shift) form produced
+     * by @ref NEBatchNormalizationFoldKernel and applies it with a single fused multiply-add,
+     * instead of recomputing 1/sqrt(var + epsilon) on every run.
+     *
+     * @note If the output tensor is a nullptr, the batch normalization function will be performed in-place
+     *
+     * @param[in, out] input  Source tensor. In case of @p output tensor = nullptr, this tensor will store the result.
+     *                        3 lower dimensions represent a single input with dimensions [width, height, FM].
+     *                        The rest are optional and used for representing batches. Data types supported: F32.
+     * @param[in]      scale  Folded scale tensor. 1 dimension with size equal to the feature maps [FM]. Data types supported: Same as @p input
+     * @param[in]      shift  Folded shift tensor. 1 dimension with size equal to the feature maps [FM]. Data types supported: Same as @p input
+     * @param[out]     output Destination tensor. Output will have the same number of dimensions as input. Data type supported: same as @p input
+     */
+    void configure(ITensor *input, ITensor *output, const ITensor *scale, const ITensor *shift);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    using BatchNormFunction       = void(ITensor *input, ITensor *output, const ITensor *mean, const ITensor *var, const ITensor *beta, const ITensor *gamma, float epsilon, const Window &window);
+    using FoldedBatchNormFunction = void(ITensor *input, ITensor *output, const ITensor *scale, const ITensor *shift, const Window &window);
+    BatchNormFunction       *_func;
+    FoldedBatchNormFunction *_folded_func;
+    ITensor                 *_input;
+    ITensor                 *_output;
+    const ITensor           *_mean;
+    const ITensor           *_var;
+    const ITensor           *_gamma;
+    const ITensor           *_beta;
+    const ITensor           *_scale;
+    const ITensor           *_shift;
+    float                    _epsilon;
+};
+
+/** Interface for the kernel which folds frozen batch normalization parameters.
+ *
+ * Collapses the mean/var/beta/gamma tensors and epsilon into the two tensors of the equivalent
+ * affine transform, computed once at configure time of the owning function:
+ *
+ * scale = gamma / sqrt(var + epsilon)
+ * shift = beta - mean * scale
+ */
+class NEBatchNormalizationFoldKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEBatchNormalizationFoldKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBatchNormalizationFoldKernel(const NEBatchNormalizationFoldKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBatchNormalizationFoldKernel &operator=(const NEBatchNormalizationFoldKernel &) = delete;
+    /** Default Move Constructor. */
+    NEBatchNormalizationFoldKernel(NEBatchNormalizationFoldKernel &&) = default;
+    /** Default move assignment operator. */
+    NEBatchNormalizationFoldKernel &operator=(NEBatchNormalizationFoldKernel &&) = default;
+    /** Default destructor */
+    ~NEBatchNormalizationFoldKernel() = default;
+    /** Set the source and destination tensors.
+     *
+     * @param[in]  mean    Mean values tensor. 1 dimension with size equal to the feature maps [FM]. Data types supported: F32.
+     * @param[in]  var     Variance values tensor. 1 dimension with size equal to the feature maps [FM]. Data types supported: Same as @p mean
+     * @param[in]  beta    Beta values tensor. 1 dimension with size equal to the feature maps [FM]. Data types supported: Same as @p mean
+     * @param[in]  gamma   Gamma values tensor. 1 dimension with size equal to the feature maps [FM]. Data types supported: Same as @p mean
+     * @param[in]  epsilon Small value to avoid division with zero.
+     * @param[out] scale   Destination scale tensor. 1 dimension with size equal to the feature maps [FM]. Data types supported: Same as @p mean
+     * @param[out] shift   Destination shift tensor. 1 dimension with size equal to the feature maps [FM]. Data types supported: Same as @p mean
+     */
+    void configure(const ITensor *mean, const ITensor *var, const ITensor *beta, const ITensor *gamma, float epsilon, ITensor *scale, ITensor *shift);
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
 
 private:
-    using BatchNormFunction = void(ITensor *input, ITensor *output, const ITensor *mean, const ITensor *var, const ITensor *beta, const ITensor *gamma, float epsilon, const Window &window);
-    BatchNormFunction *_func;
-    ITensor           *_input;
-    ITensor           *_output;
-    const ITensor     *_mean;
-    const ITensor     *_var;
-    const ITensor     *_gamma;
-    const ITensor     *_beta;
-    float              _epsilon;
+    const ITensor *_mean;
+    const ITensor *_var;
+    const ITensor *_beta;
+    const ITensor *_gamma;
+    ITensor       *_scale;
+    ITensor       *_shift;
+    float          _epsilon;
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEBATCHNORMALIZATIONLAYERKERNEL_H__ */
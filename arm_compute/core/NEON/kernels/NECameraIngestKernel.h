@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NECAMERAINGESTKERNEL_H__
+#define __ARM_COMPUTE_NECAMERAINGESTKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+#include <array>
+
+namespace arm_compute
+{
+class IMultiImage;
+class ITensor;
+
+/** NEON kernel which converts a camera frame into a network input tensor in a single traversal.
+ *
+ * Fuses NV12/NV21 to RGB conversion, optional bilinear resizing and optional per-channel
+ * normalization, writing planar F32 directly into the (possibly padded) destination tensor.
+ * This removes the intermediate RGB image, the extra copy and the separate scale pass of the
+ * equivalent @ref NEColorConvertKernel + @ref NEScale pipeline.
+ */
+class NECameraIngestKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NECameraIngestKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NECameraIngestKernel(const NECameraIngestKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NECameraIngestKernel &operator=(const NECameraIngestKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NECameraIngestKernel(NECameraIngestKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NECameraIngestKernel &operator=(NECameraIngestKernel &&) = default;
+    /** Default destructor */
+    ~NECameraIngestKernel() = default;
+
+    /** Set the input and output of the kernel
+     *
+     * If the output width/height differ from the luma plane of the input, the frame is resized
+     * with bilinear interpolation while it is converted. If @p mean and @p std are provided,
+     * each output value is normalized to (value / 255 - mean[channel]) / std[channel], otherwise
+     * the raw 0..255 range is written as F32.
+     *
+     * @param[in]  input  Multi-planar source image. Formats supported: NV12/NV21.
+     * @param[out] output Destination tensor. 3D tensor with dimensions [width, height, 3] holding
+     *                    the R, G and B planes. Data type supported: F32.
+     * @param[in]  mean   (Optional) Pointer to 3 per-channel mean values in the 0..1 range. Can be nullptr (no normalization).
+     * @param[in]  std    (Optional) Pointer to 3 per-channel standard deviations. Must be nullptr if and only if @p mean is nullptr.
+     */
+    void configure(const IMultiImage *input, ITensor *output, const float *mean = nullptr, const float *std = nullptr);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Convert without resizing, 32 pixels and two rows per iteration */
+    void ingest_direct(const Window &window);
+    /** Convert while resizing with bilinear interpolation, one output pixel at a time */
+    void ingest_resize(const Window &window);
+
+    using IngestFunction = void (NECameraIngestKernel::*)(const Window &window);
+
+    const IMultiImage   *_input;
+    ITensor             *_output;
+    IngestFunction       _func;
+    bool                 _uv;     /**< True for NV12 (U before V), false for NV21 */
+    std::array<float, 3> _scale;  /**< Per-channel multiplier folded from the normalization parameters */
+    std::array<float, 3> _offset; /**< Per-channel offset folded from the normalization parameters */
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NECAMERAINGESTKERNEL_H__ */
@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_NECOL2IMKERNEL_H__
 
 #include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
 
 namespace arm_compute
 {
@@ -70,8 +71,13 @@ public:
      * @param[out] output         The output tensor. 3 lower dimensions represent a single output [width, height, OFM],
      *                            while the rest represent batch of outputs. Data types supported: Same as @p input
      * @param[in]  convolved_dims Output convolved dimensions.
+     * @param[in]  act_info       (Optional) Activation to fuse into the output stage. Only RELU, BOUNDED_RELU and
+     *                            LU_BOUNDED_RELU are supported and only for F32, disabled by default.
+     * @param[in]  biases         (Optional) 1D bias tensor added per output channel while the element is in-register,
+     *                            before the activation. Only supported for F32, nullptr by default.
      */
-    void configure(const ITensor *input, ITensor *output, std::pair<unsigned int, unsigned int> convolved_dims);
+    void configure(const ITensor *input, ITensor *output, std::pair<unsigned int, unsigned int> convolved_dims, const ActivationLayerInfo &act_info = ActivationLayerInfo(),
+                   const ITensor *biases = nullptr);
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
@@ -84,15 +90,30 @@ private:
     template <typename T>
     void run_col2im(const Window &window);
 
+    /** Template function to run the col2im with a fused bias add on F32 data
+     *
+     * @param[in] window Region on which to execute the kernel. (Must be a valid region of the window returned by window()).
+     */
+    void run_col2im_f32_bias(const Window &window);
+
+    /** Template function to run the col2im with a fused activation (and optionally bias add) on F32 data
+     *
+     * @param[in] window Region on which to execute the kernel. (Must be a valid region of the window returned by window()).
+     */
+    template <ActivationLayerInfo::ActivationFunction F, bool has_bias>
+    void run_col2im_f32_act(const Window &window);
+
     /** Common signature for all the specialised col2im functions
      *
      * @param[in] window Region on which to execute the kernel.
      */
     using Col2ImFunctionPtr = void (NECol2ImKernel::*)(const Window &window);
 
-    Col2ImFunctionPtr _func;
-    const ITensor    *_input;
-    ITensor          *_output;
+    Col2ImFunctionPtr   _func;
+    const ITensor      *_input;
+    ITensor            *_output;
+    const ITensor      *_biases;
+    ActivationLayerInfo _act_info;
     std::pair<unsigned int, unsigned int> _convolved_dims;
 };
 } // namespace arm_compute
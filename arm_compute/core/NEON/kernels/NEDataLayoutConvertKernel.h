@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEDATALAYOUTCONVERTKERNEL_H__
+#define __ARM_COMPUTE_NEDATALAYOUTCONVERTKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to convert a tensor between the NCHW and NHWC data layouts.
+ *
+ * The direction of the conversion is taken from the data layout of the input tensor:
+ * an NCHW input produces an NHWC output and vice versa. The 3 lower dimensions of
+ * the output are permuted accordingly, any higher dimension (e.g. batches) is kept.
+ */
+class NEDataLayoutConvertKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEDataLayoutConvertKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDataLayoutConvertKernel(const NEDataLayoutConvertKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDataLayoutConvertKernel &operator=(const NEDataLayoutConvertKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEDataLayoutConvertKernel(NEDataLayoutConvertKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEDataLayoutConvertKernel &operator=(NEDataLayoutConvertKernel &&) = default;
+    /** Set the source and destination of the kernel.
+     *
+     * @param[in]  input  Source tensor. Data types supported: U8/S8/QS8/QASYMM8/U16/S16/QS16/F16/U32/S32/F32.
+     * @param[out] output Destination tensor. Data type supported: same as @p input. The data layout is set to the opposite of @p input.
+     */
+    void configure(const ITensor *input, ITensor *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input;
+    ITensor       *_output;
+    bool           _nchw_to_nhwc;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NEDATALAYOUTCONVERTKERNEL_H__ */
@@ -56,14 +56,15 @@ public:
      *   - U16 -> U8, U32
      *   - S16 -> U8, S32
      *   - QS16 -> QS16, F32
-     *   - F32 -> QS8
+     *   - F16 -> F32
+     *   - F32 -> QS8, F16
      *
      * @warning In case of in-place fixed point position conversion make sure that configure has been called
      *          before the updated tensor is used in other functions, as the TensorInfo of the tensor will be
      *          altered. In-place is only supported for QS8 -> QS8, QS16 -> QS16.
      *
-     * @param[in, out] input  The input tensor to convert (Written in case of in-place computation). Data types supported: U8/QS8/U16/S16/F32.
-     * @param[out]     output The output tensor. Can be null in case of in-place computation. Data types supported: U8/QS8/U16/S16/U32/S32/F32.
+     * @param[in, out] input  The input tensor to convert (Written in case of in-place computation). Data types supported: U8/QS8/U16/S16/F16/F32.
+     * @param[out]     output The output tensor. Can be null in case of in-place computation. Data types supported: U8/QS8/U16/S16/U32/S32/F16/F32.
      * @param[in]      policy Conversion policy.
      * @param[in]      shift  (Optional) Value for down/up conversions. Must be 0 <= shift < 8.
      *                         In case of fixed point position conversion, it specifies the new fixed point position, if operation is in-place.
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEDEPTHWISECONVOLUTION3X3KERNEL_H__
+#define __ARM_COMPUTE_NEDEPTHWISECONVOLUTION3X3KERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the kernel to run a 3x3 depthwise convolution on a tensor.
+ *
+ * Each input channel is convolved with its own 3x3 filter and the optional per-channel bias
+ * is fused into the accumulation, so depthwise layers run in a single pass.
+ */
+class NEDepthwiseConvolution3x3Kernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEDepthwiseConvolution3x3Kernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDepthwiseConvolution3x3Kernel(const NEDepthwiseConvolution3x3Kernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDepthwiseConvolution3x3Kernel &operator=(const NEDepthwiseConvolution3x3Kernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEDepthwiseConvolution3x3Kernel(NEDepthwiseConvolution3x3Kernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEDepthwiseConvolution3x3Kernel &operator=(NEDepthwiseConvolution3x3Kernel &&) = default;
+    /** Initialize the kernel's input, weights, biases and output.
+     *
+     * @param[in]  input     Source tensor. 3 lower dimensions represent a single input [width, height, IFM] for NCHW
+     *                       or [IFM, width, height] for NHWC. Data types supported: F32.
+     * @param[out] output    Destination tensor. 3 lower dimensions represent a single output. Data type and layout supported: same as @p input.
+     * @param[in]  weights   Weights tensor. These are 3D tensors with dimensions [3, 3, IFM] for NCHW or [IFM, 3, 3] for NHWC. Data type supported: same as @p input.
+     * @param[in]  biases    Biases tensor. These are 1D tensors with dimensions [IFM]. Can be nullptr. Data type supported: same as @p input.
+     * @param[in]  conv_info Padding and stride information to use for the convolution. Only strides 1 and 2 are supported.
+     */
+    void configure(const ITensor *input, ITensor *output, const ITensor *weights, const ITensor *biases, const PadStrideInfo &conv_info);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+    BorderSize border_size() const override;
+
+private:
+    /** Run the kernel on tensors with NHWC data layout, vectorizing across the channels.
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    void run_nhwc(const Window &window);
+
+    BorderSize     _border_size;
+    const ITensor *_input;
+    ITensor       *_output;
+    const ITensor *_weights;
+    const ITensor *_biases;
+    int            _conv_stride_x;
+    int            _conv_stride_y;
+    int            _conv_pad_x;
+    int            _conv_pad_y;
+};
+}
+#endif /* __ARM_COMPUTE_NEDEPTHWISECONVOLUTION3X3KERNEL_H__ */
@@ -55,6 +55,10 @@ public:
      * @param[in]      bias   The shared bias tensor to add. It must be 1D Tensor. Data type supported: Same as @p input
      * @param[out]     output (Optional) If the output tensor is specified the accumulation is done out-of-place. (Defaults to nullptr)
      *                         Data type supported: Same as @p input
+     *
+     * @note If a tensor's layout is already fixed without padding, the kernel runs in
+     *       padding-less mode: the leftover columns of each row are accumulated with a scalar
+     *       tail instead of requiring a padded allocation. Only supported for F32.
      */
     void configure(ITensor *input, const ITensor *bias, ITensor *output = nullptr);
 
@@ -69,6 +73,7 @@ private:
     ITensor              *_input;
     const ITensor        *_bias;
     ITensor              *_output;
+    bool                  _padding_less;
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEDIRECTCONVOLUTIONLAYERBIASACCUMULATEKERNEL_H__ */
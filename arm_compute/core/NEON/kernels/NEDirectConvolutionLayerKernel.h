@@ -49,8 +49,15 @@ public:
     /** Set the input, weights, and output tensors.
      *
      * @note: DirectConvolution only works in the following configurations:
-     *        1x1 convolution with stride_x = 1/2/3, stride_y = 1/2/3
-     *        3x3 convolution with stride_x = 1/2/3, stride_y = 1/2/3
+     *        1x1 convolution with stride_x = 1/2/3/4, stride_y = 1/2/3/4
+     *        3x3 convolution with stride_x = 1/2/3/4, stride_y = 1/2/3/4
+     *        5x5 convolution with stride_x = 1/2/3/4, stride_y = 1/2/3/4
+     *        7x7 convolution with stride_x = 1/2/3/4, stride_y = 1/2/3/4
+     *        7x7 convolutions and stride 4 are only supported for F32.
+     *
+     * @note If a tensor's layout is already fixed without padding, the kernel runs in
+     *       padding-less mode: a scalar loop skips the out-of-bounds contributions itself
+     *       instead of requiring zero-filled borders. Only supported for F32.
      *
      * @param[in]  input     The input tensor to convolve. 3 lower dimensions represent a single input [width, height, IFM],
      *                       while every optional dimension from 4 and above represent a batch of inputs. Data types supported: QS8/QS16/F16/F32.
@@ -77,6 +84,7 @@ private:
     unsigned int   _num_weight_elems_read_per_row;
     unsigned int   _num_elems_read_per_iteration;
     unsigned int   _num_elems_written_per_iteration;
+    bool           _padding_less;
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEDIRECTCONVOLUTIONLAYERKERNEL_H__ */
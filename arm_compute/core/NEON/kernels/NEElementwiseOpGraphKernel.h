@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEELEMENTWISEOPGRAPHKERNEL_H__
+#define __ARM_COMPUTE_NEELEMENTWISEOPGRAPHKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to evaluate a small graph of element-wise U8 operations in a single pass.
+ *
+ * Chains of @ref NEThresholdKernel and NEBitwise* kernels over the same source are bandwidth
+ * bound: each kernel re-reads its whole input from memory to apply a few cycles of arithmetic.
+ * This kernel evaluates a user-composed graph of thresholds and bitwise operations while the
+ * data is in-register, reading each input once and writing any number of output tensors.
+ *
+ * The graph is built with the add_* methods, which return a handle usable as an operand of
+ * later nodes, and sealed with @ref configure():
+ *
+ * @code
+ * NEElementwiseOpGraphKernel::NodeId src  = kernel.add_input(&image);
+ * NEElementwiseOpGraphKernel::NodeId low  = kernel.add_threshold(src, 40, 0, 255);
+ * NEElementwiseOpGraphKernel::NodeId high = kernel.add_threshold(src, 200, 0, 255);
+ * kernel.add_output(low, &mask_low);
+ * kernel.add_output(kernel.add_and(low, high), &mask_band);
+ * kernel.configure();
+ * @endcode
+ */
+class NEElementwiseOpGraphKernel : public INEKernel
+{
+public:
+    /** Handle to a node of the graph, usable as the operand of later nodes */
+    using NodeId = unsigned int;
+
+    /** Maximum number of nodes (inputs and operations) a graph can hold */
+    static constexpr unsigned int max_nodes = 32;
+
+    /** Default constructor */
+    NEElementwiseOpGraphKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEElementwiseOpGraphKernel(const NEElementwiseOpGraphKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEElementwiseOpGraphKernel &operator=(const NEElementwiseOpGraphKernel &) = delete;
+
+    /** Add a source tensor to the graph.
+     *
+     * @param[in] input Input tensor. Data type supported: U8. All inputs must have the same shape.
+     *
+     * @return Handle to the new node
+     */
+    NodeId add_input(const ITensor *input);
+    /** Add a thresholding node, following the semantics of @ref NEThresholdKernel.
+     *
+     * @param[in] src         Operand node.
+     * @param[in] threshold   Threshold. When the threshold type is RANGE, this is used as the lower threshold.
+     * @param[in] false_value Value to set when the condition is not respected.
+     * @param[in] true_value  Value to set when the condition is respected.
+     * @param[in] type        (Optional) Thresholding type. Either RANGE or BINARY, BINARY by default.
+     * @param[in] upper       (Optional) Upper threshold. Only used when the thresholding type is RANGE.
+     *
+     * @return Handle to the new node
+     */
+    NodeId add_threshold(NodeId src, uint8_t threshold, uint8_t false_value, uint8_t true_value, ThresholdType type = ThresholdType::BINARY, uint8_t upper = 0);
+    /** Add a bitwise AND node.
+     *
+     * @param[in] src0 First operand node.
+     * @param[in] src1 Second operand node.
+     *
+     * @return Handle to the new node
+     */
+    NodeId add_and(NodeId src0, NodeId src1);
+    /** Add a bitwise OR node.
+     *
+     * @param[in] src0 First operand node.
+     * @param[in] src1 Second operand node.
+     *
+     * @return Handle to the new node
+     */
+    NodeId add_or(NodeId src0, NodeId src1);
+    /** Add a bitwise XOR node.
+     *
+     * @param[in] src0 First operand node.
+     * @param[in] src1 Second operand node.
+     *
+     * @return Handle to the new node
+     */
+    NodeId add_xor(NodeId src0, NodeId src1);
+    /** Add a bitwise NOT node.
+     *
+     * @param[in] src Operand node.
+     *
+     * @return Handle to the new node
+     */
+    NodeId add_not(NodeId src);
+    /** Bind the value of a node to an output tensor. A node can feed any number of outputs.
+     *
+     * @param[in]  node   Node whose value is written out.
+     * @param[out] output Output tensor. Data type supported: U8. Shape must match the inputs.
+     */
+    void add_output(NodeId node, ITensor *output);
+    /** Seal the graph and configure the kernel window. No nodes can be added afterwards. */
+    void configure();
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Operation performed by a node of the graph */
+    enum class NodeOp
+    {
+        INPUT,            /**< Load from a source tensor */
+        THRESHOLD_BINARY, /**< Binary thresholding */
+        THRESHOLD_RANGE,  /**< Range thresholding */
+        AND,              /**< Bitwise AND of two nodes */
+        OR,               /**< Bitwise OR of two nodes */
+        XOR,              /**< Bitwise XOR of two nodes */
+        NOT               /**< Bitwise NOT of a node */
+    };
+
+    /** A node of the graph. Nodes are stored in insertion order, which the builder
+     *  guarantees to be a valid evaluation order as operands must exist before use. */
+    struct Node
+    {
+        NodeOp         op;          /**< Operation */
+        NodeId         src0;        /**< First operand (unused for INPUT) */
+        NodeId         src1;        /**< Second operand (binary operations only) */
+        const ITensor *tensor;      /**< Source tensor (INPUT only) */
+        uint8_t        threshold;   /**< (Lower) threshold (thresholding only) */
+        uint8_t        false_value; /**< Value when the condition fails (thresholding only) */
+        uint8_t        true_value;  /**< Value when the condition holds (thresholding only) */
+        uint8_t        upper;       /**< Upper threshold (range thresholding only) */
+    };
+
+    /** Binding of a node's value to an output tensor */
+    struct OutputBinding
+    {
+        NodeId   node;   /**< Node whose value is written out */
+        ITensor *tensor; /**< Destination tensor */
+    };
+
+    NodeId add_node(const Node &node);
+
+    std::vector<Node>          _nodes;
+    std::vector<OutputBinding> _outputs;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEELEMENTWISEOPGRAPHKERNEL_H__ */
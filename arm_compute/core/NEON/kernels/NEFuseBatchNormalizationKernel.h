@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEFUSEBATCHNORMALIZATIONKERNEL_H__
+#define __ARM_COMPUTE_NEFUSEBATCHNORMALIZATIONKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to fold batch normalization parameters into convolution weights and biases.
+ *
+ * At inference time batch normalization is the affine transform
+ * out = gamma * (in - mean) / sqrt(var + epsilon) + beta, which can be baked into the
+ * preceding convolution:
+ *
+ * fused_weights[..., ofm] = weights[..., ofm] * gamma[ofm] / sqrt(var[ofm] + epsilon)
+ * fused_bias[ofm]         = (bias[ofm] - mean[ofm]) * gamma[ofm] / sqrt(var[ofm] + epsilon) + beta[ofm]
+ *
+ * The fused tensors can then be passed to @ref NEConvolutionLayer in place of the original
+ * weights and biases, removing the batch normalization pass entirely.
+ */
+class NEFuseBatchNormalizationKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEFuseBatchNormalizationKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFuseBatchNormalizationKernel(const NEFuseBatchNormalizationKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFuseBatchNormalizationKernel &operator=(const NEFuseBatchNormalizationKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEFuseBatchNormalizationKernel(NEFuseBatchNormalizationKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEFuseBatchNormalizationKernel &operator=(NEFuseBatchNormalizationKernel &&) = default;
+    /** Set the source and destination tensors.
+     *
+     * @param[in]  weights       Convolution weights tensor. 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: F32.
+     * @param[in]  bias          Convolution biases tensor. 1D tensor with dimensions [OFM]. Can be nullptr. Data type supported: same as @p weights.
+     * @param[out] fused_weights Destination weights tensor. Same shape as @p weights. Data type supported: same as @p weights.
+     * @param[out] fused_bias    Destination biases tensor. 1D tensor with dimensions [OFM]. Data type supported: same as @p weights.
+     * @param[in]  mean          Batch normalization mean tensor. 1D tensor with dimensions [OFM]. Data type supported: same as @p weights.
+     * @param[in]  var           Batch normalization variance tensor. 1D tensor with dimensions [OFM]. Data type supported: same as @p weights.
+     * @param[in]  beta          Batch normalization beta tensor. 1D tensor with dimensions [OFM]. Can be nullptr (treated as 0). Data type supported: same as @p weights.
+     * @param[in]  gamma         Batch normalization gamma tensor. 1D tensor with dimensions [OFM]. Can be nullptr (treated as 1). Data type supported: same as @p weights.
+     * @param[in]  epsilon       Small value to avoid division with zero.
+     */
+    void configure(const ITensor *weights, const ITensor *bias, ITensor *fused_weights, ITensor *fused_bias,
+                   const ITensor *mean, const ITensor *var, const ITensor *beta, const ITensor *gamma, float epsilon);
+    /** Set the source and destination tensors using pre-folded batch normalization parameters.
+     *
+     * Consumes the (scale, shift) form produced by @ref NEBatchNormalizationFoldKernel instead
+     * of the raw parameter tensors, so 1/sqrt(var + epsilon) is not recomputed here:
+     *
+     * fused_weights[..., ofm] = weights[..., ofm] * scale[ofm]
+     * fused_bias[ofm]         = bias[ofm] * scale[ofm] + shift[ofm]
+     *
+     * @param[in]  weights       Convolution weights tensor. 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: F32.
+     * @param[in]  bias          Convolution biases tensor. 1D tensor with dimensions [OFM]. Can be nullptr. Data type supported: same as @p weights.
+     * @param[out] fused_weights Destination weights tensor. Same shape as @p weights. Data type supported: same as @p weights.
+     * @param[out] fused_bias    Destination biases tensor. 1D tensor with dimensions [OFM]. Data type supported: same as @p weights.
+     * @param[in]  scale         Folded scale tensor. 1D tensor with dimensions [OFM]. Data type supported: same as @p weights.
+     * @param[in]  shift         Folded shift tensor. 1D tensor with dimensions [OFM]. Data type supported: same as @p weights.
+     */
+    void configure(const ITensor *weights, const ITensor *bias, ITensor *fused_weights, ITensor *fused_bias,
+                   const ITensor *scale, const ITensor *shift);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_weights;
+    const ITensor *_bias;
+    ITensor       *_fused_weights;
+    ITensor       *_fused_bias;
+    const ITensor *_mean;
+    const ITensor *_var;
+    const ITensor *_beta;
+    const ITensor *_gamma;
+    const ITensor *_scale;
+    const ITensor *_shift;
+    float          _epsilon;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NEFUSEBATCHNORMALIZATIONKERNEL_H__ */
@@ -26,6 +26,9 @@
 
 #include "arm_compute/core/NEON/INEKernel.h"
 
+#include <cstdint>
+#include <vector>
+
 namespace arm_compute
 {
 class ITensor;
@@ -61,7 +64,7 @@ public:
      * The input matrices @p input0 and @p input1 must be the output of the kernels: @ref NEGEMMInterleave4x4Kernel and @ref NEGEMMTranspose1xWKernel. These two
      * kernels change the layout of the original matrices to be more cache-friendly.
      *
-     * @param[in]  input0          Input tensor containing the interleaved Matrix A. Data type supported: U8
+     * @param[in]  input0          Input tensor containing the interleaved Matrix A. Data type supported: U8/QASYMM8
      * @param[in]  input1          Input tensor containing the transposed Matrix B. Data type supported: same as @p input0
      * @param[out] output          Output tensor to store the result of matrix multiplication, Data type supported: same as @p input0
      * @param[in]  a_offset        Offset to be added to each element of the matrix A.
@@ -71,6 +74,25 @@ public:
      * @param[in]  shift           Number of bits to shift right the result.
      */
     void configure(const ITensor *input0, const ITensor *input1, ITensor *output, int32_t a_offset, int32_t b_offset, int32_t output_offset, int32_t output_mult_int, int32_t shift);
+    /** Initialise the kernel's input and output with per-channel requantization.
+     *
+     * Instead of one global multiplier, every output column (i.e. every output channel when the
+     * product implements a convolution) is requantized with its own fixed-point multiplier:
+     * the int32 accumulator is scaled by a saturating rounding-doubling high multiply with the
+     * column's Q31 multiplier, rounding-shifted by the column's exponent, and @p output_offset
+     * is added afterwards.
+     *
+     * @param[in]  input0             Input tensor containing the interleaved Matrix A. Data type supported: U8/QASYMM8
+     * @param[in]  input1             Input tensor containing the transposed Matrix B. Data type supported: same as @p input0
+     * @param[out] output             Output tensor to store the result of matrix multiplication, Data type supported: same as @p input0
+     * @param[in]  a_offset           Offset to be added to each element of the matrix A.
+     * @param[in]  b_offset           Offset to be added to each element of the matrix B.
+     * @param[in]  output_offset      Offset to be added to each requantized element of the output matrix.
+     * @param[in]  output_multipliers Q31 fixed-point multiplier of each output column, in [2^30, 2^31). Must have one entry per column.
+     * @param[in]  output_shifts      Shift applied after the multiplication of each output column (negative = rounding right shift). Must have one entry per column.
+     */
+    void configure(const ITensor *input0, const ITensor *input1, ITensor *output, int32_t a_offset, int32_t b_offset, int32_t output_offset,
+                   const std::vector<int32_t> &output_multipliers, const std::vector<int32_t> &output_shifts);
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
 
@@ -83,6 +105,8 @@ private:
     int32_t        _output_offset;
     int32_t        _output_mult_int;
     int32_t        _shift;
+    std::vector<int32_t> _output_multipliers; /**< Per-column Q31 multipliers, padded to the window width. Empty in global mode */
+    std::vector<int32_t> _output_shifts;      /**< Per-column shifts for vrshlq, padded to the window width. Empty in global mode */
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEGEMMLOWPMATRIXMULTIPLYKERNEL_H__*/
\ No newline at end of file
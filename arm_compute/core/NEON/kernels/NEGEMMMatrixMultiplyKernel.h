@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_NEGEMMMATRIXMULTIPLYKERNEL_H__
 
 #include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
 
 namespace arm_compute
 {
@@ -61,15 +62,58 @@ public:
      * @param[in]  alpha  Weight of the matrix product
      */
     void configure(const ITensor *input0, const ITensor *input1, ITensor *output, float alpha);
+    /** Initialise the kernel to pack the A panels itself instead of reading an interleaved matrix A.
+     *
+     * Each 4-row panel of the un-reshaped matrix A is packed into a small per-thread buffer carved out of
+     * @p workspace right before the multiply loops that consume it, and stays resident while all the output
+     * blocks of its row are computed. This removes the full write and re-read of the interleaved A operand
+     * that a standalone @ref NEGEMMInterleave4x4Kernel pass costs every run, which matters when A holds
+     * activations that change every frame.
+     *
+     * @param[in]  input0    Input tensor containing the un-reshaped Matrix A. Data type supported: F32
+     * @param[in]  input1    Input tensor containing the transposed Matrix B (reshaped with @ref NEGEMMTranspose1xWKernel). Data type supported: same as @p input0
+     * @param[out] output    Output tensor to store the result of matrix multiplication. Data type supported: same as @p input0.
+     * @param[in]  workspace Buffer of at least @ref packing_workspace_size bytes for the per-thread A panels.
+     * @param[in]  alpha     Weight of the matrix product
+     */
+    void configure(const ITensor *input0, const ITensor *input1, ITensor *output, ITensor *workspace, float alpha);
+    /** Number of workspace bytes needed by the fused-packing path
+     *
+     * @param[in] k           Number of columns of the un-reshaped matrix A
+     * @param[in] num_threads Number of threads the kernel can be scheduled on
+     *
+     * @return Required workspace size in bytes
+     */
+    static size_t packing_workspace_size(unsigned int k, unsigned int num_threads);
+    /** Fuse an epilogue into the output store of the F32 paths. Must be called after @ref configure.
+     *
+     * The bias add, the beta * C accumulation and the activation are applied to the accumulators
+     * while they are still in registers, right before the result is stored. Each stage replaces a
+     * kernel that would otherwise re-read and re-write the whole output matrix
+     * (@ref NEGEMMMatrixAccumulateBiasesKernel, @ref NEGEMMMatrixAdditionKernel, activation layer).
+     *
+     * @param[in] biases   1D tensor added to every row of the output, or nullptr. Data type supported: F32
+     * @param[in] matrix_c Matrix accumulated into the output as beta * C, or nullptr. Data type supported: F32
+     * @param[in] beta     Weight of the matrix C accumulation
+     * @param[in] act_info (Optional) Activation applied last. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU
+     *                     are supported, disabled by default.
+     */
+    void set_fused_epilogue(const ITensor *biases, const ITensor *matrix_c, float beta, const ActivationLayerInfo &act_info = ActivationLayerInfo());
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
 
 private:
-    const ITensor *_input0;
-    const ITensor *_input1;
-    ITensor       *_output;
-    float          _alpha;
+    const ITensor      *_input0;
+    const ITensor      *_input1;
+    ITensor            *_output;
+    ITensor            *_workspace;
+    float               _alpha;
+    const ITensor      *_biases;
+    const ITensor      *_matrix_c;
+    float               _beta;
+    ActivationLayerInfo _act_info;
+    bool                _has_epilogue;
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEGEMMMATRIXMULTIPLYKERNEL_H__*/
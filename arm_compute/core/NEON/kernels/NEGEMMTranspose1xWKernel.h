@@ -64,19 +64,36 @@ class ITensor;
  *
  * @note The output matrix will have the following shape: [ height * W, ceil(width / W) ], where W = (16 / element size of the tensor)
  *
+ * The kernel can also unpack codebook-compressed F32 weights while transposing: the input then
+ * holds 8-bit codebook indices and each element is decoded as codebook[code] * scale[row] on its
+ * way into the packed F32 output, so the full-precision weights never exist in memory.
  */
 class NEGEMMTranspose1xWKernel : public INESimpleKernel
 {
 public:
+    /** Default constructor */
+    NEGEMMTranspose1xWKernel();
     /** Initialise the kernel's input and output.
      *
      * @param[in]  input  Input tensor. Data types supported: U8/S8/QS8/U16/S16/QS16/F16/U32/S32/F32
      * @param[out] output Output tensor. Data type supported: same as @p input.
      */
     void configure(const ITensor *input, ITensor *output);
+    /** Initialise the kernel to decode codebook-compressed weights into the packed F32 output.
+     *
+     * @param[in]  input    Codebook indices of the weights, one per element. Data type supported: U8
+     * @param[out] output   Output tensor with shape [ height * 4, ceil(width / 4) ]. Data type supported: F32
+     * @param[in]  codebook Shared codebook of 256 entries. Data type supported: F32
+     * @param[in]  scales   Per-row scale factors, one per input row. Data type supported: F32
+     */
+    void configure(const ITensor *input, ITensor *output, const ITensor *codebook, const ITensor *scales);
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_codebook; /**< Codebook used to decode compressed weights, nullptr when the input is not compressed */
+    const ITensor *_scales;   /**< Per-row scales used to decode compressed weights */
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEGEMMTRANSPOSE1xWKERNEL_H__ */
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEGEMVKERNEL_H__
+#define __ARM_COMPUTE_NEGEMVKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to multiply a vector by a matrix reshaped with @ref NEGEMMTranspose1xWKernel (SGEMV).
+ *
+ * In the reshaped layout each row of the matrix holds a panel of four interleaved columns of "B", so one
+ * panel of four outputs is produced from a single contiguous stream of loads. The kernel walks two panels
+ * at a time to keep more outstanding memory requests in flight: a vector-matrix product reuses no element
+ * of "B" and is therefore bound by memory bandwidth, not arithmetic. This is the preferred kernel for
+ * batch-1 fully connected layers, where @ref NEGEMMMatrixMultiplyKernel gathers the matrix column-wise.
+ */
+class NEGEMVKernel : public INEKernel
+{
+public:
+    /** Constructor */
+    NEGEMVKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMVKernel(const NEGEMVKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMVKernel &operator=(const NEGEMVKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEGEMVKernel(NEGEMVKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEGEMVKernel &operator=(NEGEMVKernel &&) = default;
+    /** Initialise the kernel's input and output.
+     *
+     * @param[in]  input0 Input tensor containing the vector A of size K. Data type supported: F32
+     * @param[in]  input1 Input tensor containing the matrix B reshaped with @ref NEGEMMTranspose1xWKernel. Data type supported: same as @p input0
+     * @param[out] output Output vector of size N. Data type supported: same as @p input0.
+     */
+    void configure(const ITensor *input0, const ITensor *input1, ITensor *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input0;
+    const ITensor *_input1;
+    ITensor       *_output;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEGEMVKERNEL_H__*/
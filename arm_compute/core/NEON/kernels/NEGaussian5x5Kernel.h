@@ -53,6 +53,28 @@ private:
     BorderSize _border_size;
 };
 
+/** NEON kernel to perform a Gaussian 5x5 filter in a single fused pass.
+ *
+ * The horizontal pass writes its result into a small ring buffer of rows which the vertical
+ * pass consumes immediately, so no frame-sized intermediate tensor is needed and the
+ * intermediate rows stay cache resident.
+ */
+class NEGaussian5x5FusedKernel : public INESimpleKernel
+{
+public:
+    /** Initialise the kernel's source, destination and border mode.
+     *
+     * @param[in]  input            Source tensor. Data type supported: U8.
+     * @param[out] output           Destination tensor, Data type supported: U8.
+     * @param[in]  border_undefined True if the border mode is undefined. False if it's replicate or constant.
+     */
+    void configure(const ITensor *input, ITensor *output, bool border_undefined);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+    BorderSize border_size() const override;
+};
+
 /** NEON kernel to perform a Gaussian 5x5 filter (vertical pass) */
 class NEGaussian5x5VertKernel : public INESimpleKernel
 {
@@ -96,5 +96,44 @@ public:
 private:
     int _t2_load_offset;
 };
+
+/** NEON kernel to compute a GaussianPyramid level in a single pass.
+ *
+ * The horizontal and vertical convolutions are fused: the horizontally
+ * filtered rows are kept in registers and consumed directly by the vertical
+ * pass, so the intermediate S16 image is never written to memory.
+ */
+class NEGaussianPyramidFusedKernel : public INESimpleKernel
+{
+public:
+    /** Default constructor */
+    NEGaussianPyramidFusedKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGaussianPyramidFusedKernel(NEGaussianPyramidFusedKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGaussianPyramidFusedKernel &operator=(NEGaussianPyramidFusedKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEGaussianPyramidFusedKernel(NEGaussianPyramidFusedKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEGaussianPyramidFusedKernel &operator=(NEGaussianPyramidFusedKernel &&) = default;
+    /** Default destructor */
+    ~NEGaussianPyramidFusedKernel() = default;
+
+    /** Initialise the kernel's source, destination and border mode.
+     *
+     * @param[in]  input            Source tensor. Data type supported: U8.
+     * @param[out] output           Destination tensor, half the width and height of @p input. Data type supported: U8.
+     * @param[in]  border_undefined True if the border mode is undefined. False if it's replicate or constant.
+     */
+    void configure(const ITensor *input, ITensor *output, bool border_undefined);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+    BorderSize border_size() const override;
+
+private:
+    int _l2_load_offset;
+    int _t2_load_offset;
+};
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEGAUSSIANPYRAMIDKERNEL_H__ */
@@ -25,8 +25,8 @@
 #define __ARM_COMPUTE_NEHISTOGRAMKERNEL_H__
 
 #include "arm_compute/core/NEON/INEKernel.h"
-#include "support/Mutex.h"
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 
@@ -55,22 +55,28 @@ public:
 
     /** Set the input image and the distribution output.
      *
-     * @param[in]     input      Source image. Data type supported: U8.
-     * @param[out]    output     Destination distribution.
-     * @param[in,out] local_hist Array that the threads use to save their local histograms.
-     *                           It's size should be equal to (number_of_threads * num_bins),
-     *                           and the Window::thread_id() is used to determine the part of the array
-     *                           used by each thread.
-     * @param[out]    window_lut LUT with pre-calculated possible window values.
-     *                           The size of the LUT should be equal to max_range_size and it will be filled
-     *                           during the configure stage, while it re-used in every run, therefore can be
-     *                           safely shared among threads.
+     * @note Each thread accumulates its local histogram in the scratch arena handed to run()
+     *       through ThreadInfo::workspace, which must hold at least num_bins + 2 uint32_t
+     *       values (the bins, one overflow bin for out-of-range pixels and the fold counter
+     *       of the merge tree), reserved by the caller on the scheduler.
+     *
+     * @param[in]  input      Source image. Data type supported: U8.
+     * @param[out] output     Destination distribution.
+     * @param[out] window_lut LUT with pre-calculated possible window values.
+     *                        The size of the LUT should be equal to max_range_size and it will be filled
+     *                        during the configure stage, while it re-used in every run, therefore can be
+     *                        safely shared among threads.
      */
-    void configure(const IImage *input, IDistribution1D *output, uint32_t *local_hist, uint32_t *window_lut);
+    void configure(const IImage *input, IDistribution1D *output, uint32_t *window_lut);
     /** Set the input image and the distribution output.
      *
      * @note Used for histogram of fixed size equal to 256
      *
+     * @note Each thread accumulates its local histogram in the scratch arena handed to run()
+     *       through ThreadInfo::workspace, which must hold at least 257 uint32_t values
+     *       (the bins and the fold counter of the merge tree), reserved by the caller on
+     *       the scheduler.
+     *
      * @param[in]  input  Source image. Data type supported: U8.
      * @param[out] output Destination distribution which must be of 256 bins..
      */
@@ -80,19 +86,19 @@ public:
     void run(const Window &window, const ThreadInfo &info) override;
 
 private:
-    /** Function to merge multiple partial histograms.
+    /** Folds the partial histograms of all threads into the output distribution.
      *
-     *  @param[out] global_hist Pointer to the final histogram.
-     *  @param[in]  local_hist  Pointer to the partial histograms.
-     *  @param[in]  bins        Number of bins.
-     */
-    void merge_histogram(uint32_t *global_hist, const uint32_t *local_hist, size_t bins);
-    /** Function to merge multiple minimum values of partial histograms.
+     * Lock-free pairwise tree merge: a finished thread either parks its partial
+     * histogram for a later thread to pick up, or grabs a parked one and folds it
+     * into its own. Each partial carries the number of partials folded into it in
+     * the slot behind its counters, so the thread that ends up holding them all
+     * joins the result into the output distribution without any global lock.
      *
-     *  @param[out] global_min Pointer to the global min value.
-     *  @param[in]  local_min  Local min value.
+     *  @param[in,out] local_hist  Partial histogram of the calling thread, followed by its fold counter.
+     *  @param[in]     bins        Number of counters in each partial (including the overflow bin, if any).
+     *  @param[in]     num_threads Number of threads taking part in the dispatch.
      */
-    void merge_min(uint8_t *global_min, const uint8_t &local_min);
+    void merge_histogram(uint32_t *local_hist, size_t bins, unsigned int num_threads);
     /** Function to perform histogram on the given window
       *
      *  @param[in] win  Region on which to execute the kernel
@@ -122,9 +128,8 @@ private:
     HistogramFunctionPtr          _func; ///< Histogram function to use for the particular image types passed to configure()
     const IImage                 *_input;
     IDistribution1D              *_output;
-    uint32_t                     *_local_hist;
     uint32_t                     *_window_lut;
-    arm_compute::Mutex            _hist_mtx;
+    std::atomic<uint32_t *>       _pending; ///< Partial histogram parked by a finished thread, waiting to be folded
     static constexpr unsigned int _max_range_size{ 256 }; ///< 256 possible pixel values as we handle only U8 images
 };
 } // namespace arm_compute
@@ -25,11 +25,11 @@
 #define __ARM_COMPUTE_NEIM2COLKERNEL_H__
 
 #include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Size2D.h"
 
 namespace arm_compute
 {
 class ITensor;
-class Size2D;
 
 /** Interface for the im2col reshape kernel.
  *
@@ -78,8 +78,9 @@ public:
      * @param[in]  kernel_dims The kernel dimensions (width and height).
      * @param[in]  conv_info   Contains padding and stride information described in @ref PadStrideInfo.
      * @param[in]  has_bias    In case biases are provided expands the matrix with 1.
+     * @param[in]  dilation    (Optional) Dilation of the convolution: spacing between the kernel taps. Defaults to (1, 1), i.e. a dense kernel.
      */
-    void configure(const ITensor *input, ITensor *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info, bool has_bias);
+    void configure(const ITensor *input, ITensor *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info, bool has_bias, const Size2D &dilation = Size2D(1U, 1U));
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
@@ -110,6 +111,7 @@ private:
     PadStrideInfo _conv_info;
     unsigned int  _kernel_width;
     unsigned int  _kernel_height;
+    Size2D        _dilation;
     bool          _has_bias;
 };
 } // namespace arm_compute
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEIMPLICITGEMMCONVOLUTIONKERNEL_H__
+#define __ARM_COMPUTE_NEIMPLICITGEMMCONVOLUTIONKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Size2D.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to compute a convolution as an implicit GEMM.
+ *
+ * Instead of materializing the full im2col matrix, small tiles of the GEMM A operand are
+ * gathered on the fly from the input tensor with computed offsets into the per-thread scratch
+ * arena the scheduler hands to run() and immediately multiplied against every column block of the 1xW transposed weights
+ * (as produced by @ref NEConvolutionLayerReshapeWeights). The result is written directly to
+ * the convolution output, so neither the im2col intermediate, the interleaved input nor the
+ * GEMM output matrix have to be allocated.
+ */
+class NEImplicitGEMMConvolutionKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEImplicitGEMMConvolutionKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEImplicitGEMMConvolutionKernel(const NEImplicitGEMMConvolutionKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEImplicitGEMMConvolutionKernel &operator=(const NEImplicitGEMMConvolutionKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEImplicitGEMMConvolutionKernel(NEImplicitGEMMConvolutionKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEImplicitGEMMConvolutionKernel &operator=(NEImplicitGEMMConvolutionKernel &&) = default;
+    /** Default destructor */
+    ~NEImplicitGEMMConvolutionKernel() = default;
+    /** Set the input and output of the kernel.
+     *
+     * @note The gathered A operand tiles live in the scratch arena handed to run() through
+     *       ThreadInfo::workspace, which must hold at least 4 * mat_weights_rows float values
+     *       (reserved by the caller on the scheduler).
+     *
+     * @param[in]  input       Input tensor. 3 lower dimensions represent a single input [width, height, IFM]. Data types supported: F32.
+     * @param[in]  weights     Weights tensor reshaped and 1xW transposed with @ref NEConvolutionLayerReshapeWeights
+     *                         (biases embedded if @p has_bias is true). Data types supported: same as @p input.
+     * @param[out] output      Output tensor. 3 lower dimensions represent a single output [width, height, OFM]. Data types supported: same as @p input.
+     * @param[in]  kernel_dims The kernel dimensions (width and height).
+     * @param[in]  conv_info   Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  has_bias    In case biases are provided they are embedded in @p weights and a tile row of ones is appended.
+     */
+    void configure(const ITensor *input, const ITensor *weights, ITensor *output,
+                   const Size2D &kernel_dims, const PadStrideInfo &conv_info, bool has_bias);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input;
+    const ITensor *_weights;
+    ITensor       *_output;
+    Size2D         _kernel_dims;
+    PadStrideInfo  _conv_info;
+    bool           _has_bias;
+    std::pair<unsigned int, unsigned int> _convolved_dims;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEIMPLICITGEMMCONVOLUTIONKERNEL_H__ */
@@ -24,13 +24,18 @@
 #ifndef __ARM_COMPUTE_NEINTEGRALIMAGEKERNEL_H__
 #define __ARM_COMPUTE_NEINTEGRALIMAGEKERNEL_H__
 
+#include "arm_compute/core/NEON/INEKernel.h"
 #include "arm_compute/core/NEON/INESimpleKernel.h"
 
 namespace arm_compute
 {
 class ITensor;
 
-/** Kernel to perform an image integral on an image */
+/** Kernel to compute the row-wise prefix sums of an image, the first stage of an image integral
+ *
+ * Each row only depends on itself, so this stage splits across rows. The column-wise
+ * accumulation completing the summed-area table is performed by @ref NEIntegralImageVertKernel.
+ */
 class NEIntegralImageKernel : public INESimpleKernel
 {
 public:
@@ -44,7 +49,40 @@ public:
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
     BorderSize border_size() const override;
-    bool       is_parallelisable() const override;
+};
+
+/** Kernel to accumulate row-wise prefix sums down the image columns, the second stage of an image integral
+ *
+ * Runs in place on the output of @ref NEIntegralImageKernel. Each 16-column strip keeps its
+ * running sums in registers and only depends on itself, so this stage splits across columns.
+ */
+class NEIntegralImageVertKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEIntegralImageVertKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEIntegralImageVertKernel(const NEIntegralImageVertKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEIntegralImageVertKernel &operator=(const NEIntegralImageVertKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEIntegralImageVertKernel(NEIntegralImageVertKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEIntegralImageVertKernel &operator=(NEIntegralImageVertKernel &&) = default;
+    /** Default destructor */
+    ~NEIntegralImageVertKernel() = default;
+
+    /** Set the tensor to accumulate.
+     *
+     * @param[in,out] output Tensor holding the row-wise prefix sums, replaced by the image integral. Data type supported: U32.
+     */
+    void configure(ITensor *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    ITensor *_output;
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEINTEGRALIMAGEKERNEL_H__ */
@@ -49,7 +49,10 @@ public:
     /** Set the input and output tensors.
      *
      * @param[in]  input   Source tensor. Data types supported: F32.
-     * @param[in]  sum     Sum values tensor. Data types supported: same as @p input.
+     * @param[in]  sum     Sum values tensor. Data types supported: same as @p input. Can be nullptr:
+     *                     the kernel then runs in fused mode, computing each row's sum of squares
+     *                     itself in a first traversal and rescaling the row immediately while it is
+     *                     still in cache, so no separate reduction pass is needed.
      * @param[out] output  Destination tensor. Data types supported: same as @p input.
      * @param[in]  axis    Dimension along which to reduce. Supported reduction axis : 0
      * @param[in]  epsilon Lower bound value for the normalization.
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NELSTMCELLUPDATEKERNEL_H__
+#define __ARM_COMPUTE_NELSTMCELLUPDATEKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel which applies the gate activations and state updates of an LSTM cell in a single pass.
+ *
+ * Given the pre-activations of the four gates (as produced by one packed matrix multiply plus bias),
+ * the kernel computes for each element of the cell state:
+ *
+ * @f[ c_t = \sigma(f) \cdot c_{t-1} + \sigma(i) \cdot \tanh(g) @f]
+ * @f[ h_t = \sigma(o) \cdot \tanh(c_t) @f]
+ *
+ * fusing what would otherwise be four activation passes and four element-wise passes with their
+ * intermediate tensors into one traversal of the state.
+ */
+class NELSTMCellUpdateKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NELSTMCellUpdateKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELSTMCellUpdateKernel(const NELSTMCellUpdateKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELSTMCellUpdateKernel &operator=(const NELSTMCellUpdateKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NELSTMCellUpdateKernel(NELSTMCellUpdateKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NELSTMCellUpdateKernel &operator=(NELSTMCellUpdateKernel &&) = default;
+    /** Set the input and output of the kernel
+     *
+     * @param[in]      gates      Gate pre-activations. Vector of size 4 * hidden_size holding the input,
+     *                            forget, cell and output gate in this order. Data type supported: F32
+     * @param[in,out]  cell_state Cell state c. Vector of size hidden_size, read as @f$ c_{t-1} @f$ and
+     *                            overwritten with @f$ c_t @f$. Data type supported: same as @p gates
+     * @param[out]     output     Hidden state output h. Vector of size hidden_size. Data type supported: same as @p gates
+     */
+    void configure(const ITensor *gates, ITensor *cell_state, ITensor *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_gates;
+    ITensor       *_cell_state;
+    ITensor       *_output;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NELSTMCELLUPDATEKERNEL_H__ */
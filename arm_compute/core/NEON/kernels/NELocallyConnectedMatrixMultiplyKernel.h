@@ -46,11 +46,17 @@ public:
     NELocallyConnectedMatrixMultiplyKernel &operator=(NELocallyConnectedMatrixMultiplyKernel &&) = default;
     /** Initialise the kernel's input and output
      *
-     * @param[in]  input0 First input tensor. Data types supported: F16, F32
-     * @param[in]  input1 Second input tensor containing the Matrix B. Data type supported: same as @p input0
-     * @param[out] output Output tensor to store the result of matrix multiplication. Data type supported: same as @p input0
+     * When @p packed_weights is true the weights must hold, for every output position, panels of four
+     * interleaved matrix columns laid out contiguously (as packed by @ref NELocallyConnectedLayer), so
+     * each panel of four outputs is computed from one contiguous stream instead of strided row loads.
+     * The packed layout is supported for F32 only.
+     *
+     * @param[in]  input0         First input tensor. Data types supported: F16, F32
+     * @param[in]  input1         Second input tensor containing the Matrix B. Data type supported: same as @p input0
+     * @param[out] output         Output tensor to store the result of matrix multiplication. Data type supported: same as @p input0
+     * @param[in]  packed_weights (Optional) True if @p input1 holds contiguously packed panels of four interleaved columns per output position.
      */
-    void configure(const ITensor *input0, const ITensor *input1, ITensor *output);
+    void configure(const ITensor *input0, const ITensor *input1, ITensor *output, bool packed_weights = false);
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
@@ -59,6 +65,7 @@ private:
     const ITensor *_input0;
     const ITensor *_input1;
     ITensor       *_output;
+    bool           _is_packed;
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_NELOCALLYCONNECTEDMATRIXMULTIPLYKERNEL_H__ */
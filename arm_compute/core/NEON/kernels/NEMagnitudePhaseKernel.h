@@ -27,6 +27,9 @@
 #include "arm_compute/core/NEON/INEKernel.h"
 #include "arm_compute/core/Types.h"
 
+#include <cstdint>
+#include <vector>
+
 namespace arm_compute
 {
 class ITensor;
@@ -94,6 +97,76 @@ private:
     ITensor                  *_phase;     /**< Output - Phase */
 };
 
+/** Template interface for the kernel to compute magnitude and a quantized phase bin
+ *
+ * Instead of evaluating an atan2 approximation per pixel and letting the consumer quantize
+ * the angle afterwards, this kernel derives the orientation bin directly from the gradient
+ * signs and from branch-free comparisons of gy/gx against precomputed tangent thresholds
+ * (one Q15 cos/sin pair per bin boundary), so no angle is ever computed. It is intended for
+ * HOG-style consumers which only need the bin index.
+ */
+template <MagnitudeType mag_type, PhaseType phase_type>
+class NEMagnitudeQuantizedPhaseKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEMagnitudeQuantizedPhaseKernel();
+    /** Destructor */
+    ~NEMagnitudeQuantizedPhaseKernel() = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEMagnitudeQuantizedPhaseKernel(const NEMagnitudeQuantizedPhaseKernel &) = delete;
+    /** Default move constructor */
+    NEMagnitudeQuantizedPhaseKernel(NEMagnitudeQuantizedPhaseKernel &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEMagnitudeQuantizedPhaseKernel &operator=(const NEMagnitudeQuantizedPhaseKernel &) = delete;
+    /** Default move assignment operator */
+    NEMagnitudeQuantizedPhaseKernel &operator=(NEMagnitudeQuantizedPhaseKernel &&) = default;
+
+    /** Initialise the kernel's input, output and number of orientation bins.
+     *
+     * The bins partition [0, 180) degrees for PhaseType::UNSIGNED and [0, 360) degrees for
+     * PhaseType::SIGNED into @p num_bins equal sectors; each output pixel is the index of the
+     * sector its gradient falls in. Pixels with gy == 0 and gx < 0 (an angle of exactly 180
+     * degrees) land in the bin below that boundary.
+     *
+     * @param[in]  gx        Gradient X tensor. Data type supported: S16.
+     * @param[in]  gy        Gradient Y tensor. Data type supported: S16.
+     * @param[out] magnitude (Optional) The output tensor - Magnitude. Data type supported: S16.
+     * @param[out] phase     The output tensor - Orientation bin index. Data type supported: U8.
+     * @param[in]  num_bins  Number of orientation bins, in the range [2, 255]. Must be even for PhaseType::SIGNED.
+     */
+    void configure(const ITensor *gx, const ITensor *gy, ITensor *magnitude, ITensor *phase, unsigned int num_bins);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Function to compute the quantized phase bin on the given window
+     *
+     *  @param[in] window Region on which to execute the kernel
+     */
+    void phase_bin(const Window &window);
+    /** Function to compute magnitude and the quantized phase bin on the given window
+     *
+     *  @param[in] window Region on which to execute the kernel
+     */
+    void magnitude_phase_bin(const Window &window);
+
+    /** Common signature for all the specialised quantized phase functions
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    using QuantizedPhaseFunctionPtr = void (NEMagnitudeQuantizedPhaseKernel::*)(const Window &window);
+    /** Quantized phase function to use for the outputs passed to configure() */
+    QuantizedPhaseFunctionPtr _func;
+    const ITensor            *_gx;         /**< Input gradient X */
+    const ITensor            *_gy;         /**< Input gradient Y */
+    ITensor                  *_magnitude;  /**< Output - Magnitude */
+    ITensor                  *_phase;      /**< Output - Orientation bin index */
+    std::vector<int16_t>      _thresholds; /**< Interleaved Q15 (cos, sin) pair per internal bin boundary */
+    int16_t                   _half_bins;  /**< Bins covering half a turn, added to the bin of reflected gradients for PhaseType::SIGNED */
+};
+
 #ifdef ARM_COMPUTE_ENABLE_FP16
 /** Template interface for the kernel to compute magnitude and phase */
 template <MagnitudeType mag_type, PhaseType phase_type>
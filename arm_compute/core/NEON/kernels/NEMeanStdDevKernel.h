@@ -25,8 +25,8 @@
 #define __ARM_COMPUTE_NEMEANSTDDEVKERNEL_H__
 
 #include "arm_compute/core/NEON/INEKernel.h"
-#include "support/Mutex.h"
 
+#include <atomic>
 #include <cstdint>
 
 namespace arm_compute
@@ -52,6 +52,10 @@ public:
     ~NEMeanStdDevKernel() = default;
 
     /** Initialise the kernel's input and outputs.
+     *
+     * @note Each thread merges its partial sums into @p global_sum / @p global_sum_squared with a
+     *       single atomic addition; the last thread to merge computes the final statistics, so the
+     *       reduction scales with cores instead of serializing on a lock.
      *
      * @param[in]  input              Input image. Data type supported: U8.
      * @param[out] mean               Input average pixel value.
@@ -59,7 +63,7 @@ public:
      * @param[out] stddev             (Optional) Output standard deviation of pixel values.
      * @param[out] global_sum_squared (Optional if stddev is not set, required if stddev is set) Keeps global sum of squared pixel values.
      */
-    void configure(const IImage *input, float *mean, uint64_t *global_sum, float *stddev = nullptr, uint64_t *global_sum_squared = nullptr);
+    void configure(const IImage *input, float *mean, std::atomic<uint64_t> *global_sum, float *stddev = nullptr, std::atomic<uint64_t> *global_sum_squared = nullptr);
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
@@ -67,13 +71,13 @@ public:
     BorderSize border_size() const override;
 
 private:
-    const IImage      *_input;
-    float             *_mean;
-    float             *_stddev;
-    uint64_t          *_global_sum;
-    uint64_t          *_global_sum_squared;
-    arm_compute::Mutex _mtx;
-    BorderSize         _border_size;
+    const IImage          *_input;
+    float                 *_mean;
+    float                 *_stddev;
+    std::atomic<uint64_t> *_global_sum;
+    std::atomic<uint64_t> *_global_sum_squared;
+    std::atomic<int>       _num_merged; /**< Number of threads which have merged their partial sums into the current reduction */
+    BorderSize             _border_size;
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_NEMEANSTDDEVKERNEL_H__ */
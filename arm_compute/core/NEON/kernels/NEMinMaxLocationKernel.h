@@ -28,6 +28,8 @@
 #include "arm_compute/core/NEON/INEKernel.h"
 #include "support/Mutex.h"
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 
 namespace arm_compute
@@ -98,7 +100,13 @@ private:
     arm_compute::Mutex _mtx;   /**< Mutex used for result reduction. */
 };
 
-/** Interface for the kernel to find min max locations of an image. */
+/** Interface for the kernel to find the min/max values and their locations in an image.
+ *
+ * Single-pass engine: each thread scans its strip once, tracking its local min/max with
+ * vector compares and only dropping to scalar code for the rare blocks containing a new
+ * or repeated extreme, then the per-thread partials are folded into the user outputs with
+ * the same lock-free pairwise tree merge as NEHistogramKernel.
+ */
 class NEMinMaxLocationKernel : public INEKernel
 {
 public:
@@ -116,6 +124,10 @@ public:
     ~NEMinMaxLocationKernel() = default;
 
     /** Initialise the kernel's input and outputs.
+     *
+     * @note Each thread accumulates its partial result in the scratch arena handed to run()
+     *       through ThreadInfo::workspace, which must hold at least workspace_size() bytes,
+     *       reserved by the caller on the scheduler.
      *
      * @param[in]  input     Input Image. Data types supported: U8/S16/F32.
      * @param[out] min       Minimum value of image. Data types supported: S32 if input type is U8/S16, F32 if input type is F32.
@@ -128,23 +140,44 @@ public:
     void configure(const IImage *input, void *min, void *max,
                    ICoordinates2DArray *min_loc = nullptr, ICoordinates2DArray *max_loc = nullptr,
                    uint32_t *min_count = nullptr, uint32_t *max_count = nullptr);
+    /** Per-thread scratch size the kernel needs in ThreadInfo::workspace.
+     *
+     * Holds one partial result: the thread's min/max values, counts and as many candidate
+     * locations as the output arrays can store. Must be called after configure().
+     *
+     * @return Required scratch arena size in bytes.
+     */
+    size_t workspace_size() const;
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
-    bool is_parallelisable() const override;
 
 private:
     /** Performs the min/max location algorithm on T type images on a given window.
      *
-     * @param win The window to run the algorithm on.
+     * @param win  The window to run the algorithm on.
+     * @param info Info about the executing thread.
      */
     template <class T, bool count_min, bool count_max, bool loc_min, bool loc_max>
-    void minmax_loc(const Window &win);
+    void minmax_loc(Window win, const ThreadInfo &info);
+    /** Folds the per-thread partial results into the user outputs.
+     *
+     * Lock-free pairwise tree merge: a finished thread either parks its partial result for
+     * a later thread to pick up, or grabs a parked one and folds it into its own. The thread
+     * that ends up holding every partial writes the min/max values, the counts and the
+     * location arrays without any global lock.
+     *
+     * @param[in,out] local_partial Partial result of the calling thread, laid out in its scratch arena.
+     * @param[in]     num_threads   Number of threads taking part in the dispatch.
+     */
+    template <typename T, bool count_min, bool count_max, bool loc_min, bool loc_max>
+    void merge_min_max_loc(void *local_partial, unsigned int num_threads);
     /** Common signature for all the specialised MinMaxLoc functions
      *
      * @param[in] window Region on which to execute the kernel.
+     * @param[in] info   Info about the executing thread.
      */
-    using MinMaxLocFunction = void (NEMinMaxLocationKernel::*)(const Window &window);
+    using MinMaxLocFunction = void (NEMinMaxLocationKernel::*)(Window window, const ThreadInfo &info);
     /** MinMaxLoc function to use for the particular image types passed to configure() */
     MinMaxLocFunction _func;
     /** Helper to create a function pointer table for the parameterized MinMaxLocation functions. */
@@ -158,6 +191,7 @@ private:
     uint32_t            *_max_count; /**< Count of maximum value encounters. */
     ICoordinates2DArray *_min_loc;   /**< Locations of minimum values. */
     ICoordinates2DArray *_max_loc;   /**< Locations of maximum values. */
+    std::atomic<void *>  _pending;   /**< Partial result parked by a finished thread, waiting to be folded */
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEMINMAXLOCATIONKERNEL_H__ */
@@ -49,8 +49,9 @@ public:
     ~NENormalizationLayerKernel() = default;
     /** Set the input and output tensors.
      *
-     * @param[in]  input         Source tensor. 3 lower dims represent a single input with dimensions [width, height, IFM],
-     *                           and an optional 4th dimension for batch of inputs. Data types supported: QS8/QS16/FP16/F32.
+     * @param[in]  input         Source tensor. 3 lower dims represent a single input with dimensions [width, height, IFM] for NCHW
+     *                           or [IFM, width, height] for NHWC, and an optional 4th dimension for batch of inputs.
+     *                           Data types supported: QS8/QS16/FP16/F32 (NHWC is only supported for FP16/F32).
      * @param[in]  input_squared Source with each element has been squared. 3 lower dims represent a single input with dimensions [width, height, IFM],
      *                           Data type supported: same as @p input
      * @param[out] output        Destination tensor. Output will have the same number of dimensions as input. Data type supported: same as @p input
@@ -61,6 +62,7 @@ public:
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
     BorderSize border_size() const override;
+    ResourceProfile resource_profile() const override;
 
 private:
     /** Function to perform normalization depending on the given template
@@ -101,6 +103,7 @@ private:
     ITensor               *_output;
     NormalizationLayerInfo _norm_info;
     BorderSize             _border_size;
+    bool                   _channel_major; /**< True if the window is traversed channel-major (see @ref execute_window_channel_major) */
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NENORMALIZATIONLAYERKERNEL_H__ */
@@ -55,6 +55,7 @@ public:
      *
      * @param[in]  input1          An input tensor. Data types supported: U8/QS8/QS16/S16/F16/F32
      * @param[in]  input2          An input tensor. Data types supported: U8, QS8 (only if @p input1 is QS8), QS16 (only if @p input1 is QS16), S16/F16 (only if @p input1 is F16), F32 (only if @p input1 is F32).
+     * @note This kernel can run in-place: @p output may be the same tensor as @p input1 or @p input2 (for matching data types).
      * @param[out] output          The output tensor. Data types supported: U8 (Only if both inputs are U8), QS8 (only if both inputs are QS8), QS16 (only if both inputs are QS16), S16/F16 (only if @p input1 is F16), F32 (only if both inputs are F32).
      * @param[in]  scale           Scale to apply after multiplication.
      *                             Scale must be positive and its value must be either 1/255 or 1/2^n where n is between 0 and 15.
@@ -67,29 +68,37 @@ public:
     void run(const Window &window, const ThreadInfo &info) override;
 
 private:
-    /** Common signature for all the specialised multiplication functions with integer scaling factor
+    /** Common signature for the specialised multiplication loops with integer scaling factor
      *
-     * @param[in]  input1_ptr Pointer to the first input tensor.
-     * @param[in]  input2_ptr Pointer to the second input tensor.
-     * @param[out] output_ptr Pointer to the output tensor.
+     * Each loop is a template instantiation over the per-element multiplication, selected once
+     * at configure time, so the loop body contains no indirect call or runtime branch.
+     *
+     * @param[in]  input1 First input tensor.
+     * @param[in]  input2 Second input tensor.
+     * @param[out] output Output tensor.
+     * @param[in]  window Region on which to execute the loop.
+     * @param[in]  scale  Scaling exponent.
      */
-    using MulFunctionInt = void(const void *__restrict input1_ptr, const void *__restrict input2_ptr, void *__restrict output_ptr, int scale);
-    /** Common signature for all the specialised multiplication functions with fixed-point values
+    using MulFunctionInt = void(const ITensor *input1, const ITensor *input2, ITensor *output, const Window &window, int scale);
+    /** Common signature for the specialised multiplication loops with fixed-point values
      *
-     * @param[in]  input1_ptr           Pointer to the first input tensor.
-     * @param[in]  input2_ptr           Pointer to the second input tensor.
-     * @param[in]  scale                Scaling factor.
+     * @param[in]  input1               First input tensor.
+     * @param[in]  input2               Second input tensor.
+     * @param[out] output               Output tensor.
+     * @param[in]  window               Region on which to execute the loop.
+     * @param[in]  scale                Scaling exponent.
      * @param[in]  fixed_point_position Fixed-point position that expresses the number of bits for the fractional part of the number.
-     * @param[out] output_ptr           Pointer to the output tensor.
      */
-    using MulFunctionQInt = void(const void *__restrict input1_ptr, const void *__restrict input2_ptr, void *__restrict output_ptr, int scale, int fixed_point_position);
-    /** Common signature for all the specialised multiplication functions with float scaling factor
+    using MulFunctionQInt = void(const ITensor *input1, const ITensor *input2, ITensor *output, const Window &window, int scale, int fixed_point_position);
+    /** Common signature for the specialised multiplication loops with float scaling factor
      *
-     * @param[in]  input1_ptr Pointer to the first input tensor.
-     * @param[in]  input2_ptr Pointer to the second input tensor.
-     * @param[out] output_ptr Pointer to the output tensor.
+     * @param[in]  input1 First input tensor.
+     * @param[in]  input2 Second input tensor.
+     * @param[out] output Output tensor.
+     * @param[in]  window Region on which to execute the loop.
+     * @param[in]  scale  Scaling factor.
      */
-    using MulFunctionFloat = void(const void *__restrict input1_ptr, const void *__restrict input2_ptr, void *__restrict output_ptr, float scale);
+    using MulFunctionFloat = void(const ITensor *input1, const ITensor *input2, ITensor *output, const Window &window, float scale);
 
     MulFunctionFloat *_func_float;
     MulFunctionInt   *_func_int;
@@ -48,13 +48,24 @@ public:
     ~NEPoolingLayerKernel() = default;
     /** Set the input and output tensors.
      *
-     * @note QS8, QS16 and F16 are supported for pool sizes 2 and 3 only
+     * @note F16 is supported for pool sizes 2 and 3 only
+     * @note The NHWC data layout is supported for F32 only
+     * @note If a tensor's layout is already fixed without padding, or the pooling geometry
+     *       cannot be expressed through a border-filled input (asymmetric padding, or a
+     *       ceil-mode window overhanging the padded region), the kernel runs in padding-less
+     *       mode: a scalar loop clamps the pooling region itself, so no border fill pass or
+     *       padded allocation is required. Only supported for F32 with NCHW layout.
+     * @note If @p zero_mask is set, pooling regions the mask guarantees to be all-zero are
+     *       skipped and a zero is stored instead of reading the input. The mask must have been
+     *       produced for @p input by @ref NEActivationLayerKernel. Supported for F32 with
+     *       NCHW layout and pool sizes 2 and 3; it is ignored for the other configurations.
      *
-     * @param[in]  input     Source tensor. Data types supported: QS8/QS16/F16/F32.
+     * @param[in]  input     Source tensor. Data types supported: QS8/QASYMM8/QS16/F16/F32.
      * @param[out] output    Destination tensor. Data types supported: Same as @p input.
      * @param[in]  pool_info Contains pooling operation information described in @ref PoolingLayerInfo.
+     * @param[in]  zero_mask (Optional) Zero mask summarizing the sparsity of @p input. Data type supported: U8.
      */
-    void configure(const ITensor *input, ITensor *output, const PoolingLayerInfo &pool_info);
+    void configure(const ITensor *input, ITensor *output, const PoolingLayerInfo &pool_info, const ITensor *zero_mask = nullptr);
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
@@ -83,6 +94,13 @@ private:
      */
     template <PoolingType pooling_type>
     void pooling2_q8(const Window &window_input, const Window &window);
+    /** Function to perform 2x2 pooling for 8bit asymmetric quantized.
+     *
+     * @param[in] window_input Input region on which to execute the kernel.
+     * @param[in] window       Output region on which to execute the kernel.
+     */
+    template <PoolingType pooling_type>
+    void pooling2_qasymm8(const Window &window_input, const Window &window);
     /** Function to perform 2x2 pooling for 16bit fixed point.
      *
      * @param[in] window_input Input region on which to execute the kernel.
@@ -111,6 +129,13 @@ private:
      */
     template <PoolingType pooling_type>
     void pooling3_q8(const Window &window_input, const Window &window);
+    /** Function to perform 3x3 pooling for 8bit asymmetric quantized.
+     *
+     * @param[in] window_input Input region on which to execute the kernel.
+     * @param[in] window       Output region on which to execute the kernel.
+     */
+    template <PoolingType pooling_type>
+    void pooling3_qasymm8(const Window &window_input, const Window &window);
     /** Function to perform 3x3 pooling for 16bit fixed point.
      *
      * @param[in] window_input Input region on which to execute the kernel.
@@ -132,6 +157,48 @@ private:
      */
     template <PoolingType pooling_type>
     void poolingN_f32(const Window &window_input, const Window &window);
+    /** Function to perform NxN pooling for 8bit fixed point.
+     *
+     * @param[in] window_input Input region on which to execute the kernel.
+     * @param[in] window       Output region on which to execute the kernel.
+     */
+    template <PoolingType pooling_type>
+    void poolingN_q8(const Window &window_input, const Window &window);
+    /** Function to perform NxN pooling for 16bit fixed point.
+     *
+     * @param[in] window_input Input region on which to execute the kernel.
+     * @param[in] window       Output region on which to execute the kernel.
+     */
+    template <PoolingType pooling_type>
+    void poolingN_q16(const Window &window_input, const Window &window);
+    /** Function to perform global pooling, reducing each input map to a single value in one pass.
+     *
+     * @param[in] window_input Input region on which to execute the kernel.
+     * @param[in] window       Output region on which to execute the kernel.
+     */
+    template <PoolingType pooling_type>
+    void pooling_global_f32(const Window &window_input, const Window &window);
+    /** Function to perform global pooling on quantized asymmetric 8-bit input, reducing each input map to a single value in one pass.
+     *
+     * @param[in] window_input Input region on which to execute the kernel.
+     * @param[in] window       Output region on which to execute the kernel.
+     */
+    template <PoolingType pooling_type>
+    void pooling_global_qasymm8(const Window &window_input, const Window &window);
+    /** Function to perform NxN pooling on tensors with NHWC data layout.
+     *
+     * @param[in] window_input Input region on which to execute the kernel.
+     * @param[in] window       Output region on which to execute the kernel.
+     */
+    template <PoolingType pooling_type>
+    void pooling_f32_nhwc(const Window &window_input, const Window &window);
+    /** Function to perform NxN pooling without tensor padding, clamping the pooling region.
+     *
+     * @param[in] window_input Input region on which to execute the kernel.
+     * @param[in] window       Output region on which to execute the kernel.
+     */
+    template <PoolingType pooling_type>
+    void pooling_f32_padding_less(const Window &window_input, const Window &window);
     /** Common signature for all the specialised Pooling functions
      *
      * @param[in] window_input Input region on which to execute the kernel.
@@ -144,8 +211,10 @@ private:
     const ITensor   *_input;
     ITensor         *_output;
     PoolingLayerInfo _pool_info;
+    const ITensor   *_zero_mask;
     int              _num_elems_processed_per_iteration;
     BorderSize       _border_size;
+    bool             _padding_less;
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEPOOLINGLAYERKERNEL_H__ */
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEROIGATHERKERNEL_H__
+#define __ARM_COMPUTE_NEROIGATHERKERNEL_H__
+
+#include "arm_compute/core/IArray.h"
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the kernel gathering regions of interest of a frame into a batched tensor.
+ *
+ * Each Z slice of the output receives one region of interest of the source frame, resized to
+ * the slice dimensions with bilinear interpolation (samples are clamped to the frame borders).
+ * Slices beyond the number of regions in the array are zeroed, so a partially filled batch can
+ * still be run through batched functions. The number of regions may change between runs
+ * without reconfiguring, as long as it fits the batch dimension of the output.
+ */
+class NEROIGatherKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEROIGatherKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEROIGatherKernel(const NEROIGatherKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEROIGatherKernel &operator=(const NEROIGatherKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEROIGatherKernel(NEROIGatherKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEROIGatherKernel &operator=(NEROIGatherKernel &&) = default;
+    /** Default destructor */
+    ~NEROIGatherKernel() = default;
+    /** Set the input frame, the regions of interest and the output batch.
+     *
+     * @param[in]  input  Source frame. Data types supported: U8/F32.
+     * @param[in]  rois   Array of regions of interest to gather. The batch_idx field is ignored.
+     * @param[out] output Destination tensor of 3 dimensions: each region is resized to the
+     *                    first two dimensions, the third is the batch. Data types supported:
+     *                    same as @p input.
+     */
+    void configure(const ITensor *input, const IROIArray *rois, ITensor *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    using ROIGatherFunction = void(const ITensor *in, const IROIArray *rois, ITensor *out, const Window &window);
+
+private:
+    ROIGatherFunction *_func;
+    const ITensor     *_input;
+    const IROIArray   *_rois;
+    ITensor           *_output;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NEROIGATHERKERNEL_H__ */
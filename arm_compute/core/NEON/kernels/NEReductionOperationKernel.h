@@ -24,8 +24,11 @@
 #ifndef __ARM_COMPUTE_NEREDUCTIONOPERATIONKERNEL_H__
 #define __ARM_COMPUTE_NEREDUCTIONOPERATIONKERNEL_H__
 
+#include "arm_compute/core/Coordinates.h"
 #include "arm_compute/core/NEON/INEKernel.h"
 
+#include <array>
+
 namespace arm_compute
 {
 class ITensor;
@@ -50,10 +53,21 @@ public:
      *
      * @param[in]  input  Source tensor. Data type supported: F32.
      * @param[out] output Destination tensor.Data types supported: same as @p input.
-     * @param[in]  axis   Axis along which to reduce. Supported reduction axis : 0
+     * @param[in]  axis   Axis along which to reduce.
      * @param[in]  op     Reduction operation to perform.
      */
     void configure(const ITensor *input, ITensor *output, unsigned int axis, ReductionOperation op);
+    /** Set the source, destination of the kernel, reducing several axes in a single pass
+     *
+     * The listed axes are all collapsed to 1 in the destination shape and every destination
+     * element accumulates the matching elements of the source in one traversal.
+     *
+     * @param[in]  input  Source tensor. Data type supported: F32.
+     * @param[out] output Destination tensor. Data types supported: same as @p input.
+     * @param[in]  axes   Axes along which to reduce. Each entry is a dimension index of @p input.
+     * @param[in]  op     Reduction operation to perform.
+     */
+    void configure(const ITensor *input, ITensor *output, const Coordinates &axes, ReductionOperation op);
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
     BorderSize border_size() const override;
@@ -61,7 +75,8 @@ public:
 private:
     const ITensor     *_input;
     ITensor           *_output;
-    unsigned int       _reduction_axis;
+    std::array<bool, Coordinates::num_max_dimensions> _reduced_axes;
+    size_t             _num_reduced_elements;
     ReductionOperation _op;
     BorderSize         _border_size;
 };
@@ -27,6 +27,9 @@
 #include "arm_compute/core/NEON/INEKernel.h"
 #include "arm_compute/core/Types.h"
 
+#include <cstdint>
+#include <vector>
+
 namespace arm_compute
 {
 class ITensor;
@@ -50,22 +53,49 @@ public:
 
     /** Initialize the kernel's input, output and border mode.
      *
-     * @param[in]  input  Source tensor. Data type supported: U8.
-     * @param[in]  map_x  Map for X coordinates. Data type supported: F32.
-     * @param[in]  map_y  Map for Y coordinates. Data type supported: F32.
-     * @param[out] output Destination tensor. Data types supported: U8. All but the lowest two dimensions must be the same size as in the input tensor, i.e. remapping is only performed within the XY-plane.
-     * @param[in]  policy The interpolation type.
+     * In compiled-map mode the map tensors are treated as immutable: compile_maps() turns them
+     * once into clamped integer offsets plus 8-bit fixed-point weights, and the per-frame run
+     * is reduced to a gather plus fixed-point blend per pixel. Samples are clamped to the
+     * image interior (i.e. the borders replicate), and the 8-bit weights can differ from the
+     * floating-point path by one intensity step.
+     *
+     * @param[in]  input         Source tensor. Data type supported: U8.
+     * @param[in]  map_x         Map for X coordinates. Data type supported: F32.
+     * @param[in]  map_y         Map for Y coordinates. Data type supported: F32.
+     * @param[out] output        Destination tensor. Data types supported: U8. All but the lowest two dimensions must be the same size as in the input tensor, i.e. remapping is only performed within the XY-plane.
+     * @param[in]  policy        The interpolation type.
+     * @param[in]  compiled_maps (Optional) True to precompute the maps with compile_maps() and run the compiled gather loop.
      */
-    void configure(const ITensor *input, const ITensor *map_x, const ITensor *map_y, ITensor *output, InterpolationPolicy policy);
+    void configure(const ITensor *input, const ITensor *map_x, const ITensor *map_y, ITensor *output, InterpolationPolicy policy, bool compiled_maps = false);
+    /** Compiles the map tensors into per-pixel offsets and fixed-point weights.
+     *
+     * Must be called after the maps have been filled and before the first run in compiled-map
+     * mode; call it again if the map contents ever change. The maps themselves are not
+     * accessed during run() afterwards.
+     */
+    void compile_maps();
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
 
 private:
+    /** One precomputed destination pixel: clamped source offset plus Q8 bilinear weights */
+    struct CompiledMapEntry
+    {
+        int32_t offset;  /**< Byte offset of the top-left sample from the input plane start */
+        uint8_t dx;      /**< Q8 weight of the right-hand samples */
+        uint8_t dy;      /**< Q8 weight of the bottom samples */
+        uint8_t unused0; /**< Padding, keeps entries at 8 bytes */
+        uint8_t unused1; /**< Padding, keeps entries at 8 bytes */
+    };
     /** function to perform nearest interpolation on the given window */
     void remap_nearest(const Window &window);
     /** function to perform bilinear interpolation on the given window */
     void remap_bilinear(const Window &window);
+    /** function to gather the output through the compiled nearest-neighbour offset table */
+    void remap_nearest_compiled(const Window &window);
+    /** function to gather and blend the output through the compiled bilinear map table */
+    void remap_bilinear_compiled(const Window &window);
     /** Remap function to use for the particular interpolation type passed to configure() */
     void (NERemapKernel::*_func)(const Window &window);
 
@@ -73,6 +103,10 @@ private:
     ITensor       *_output; /**< Output image */
     const ITensor *_map_x;  /**< Input remap x coordinates */
     const ITensor *_map_y;  /**< Input remap y coordinates */
+
+    std::vector<CompiledMapEntry> _compiled_map;     /**< Compiled bilinear map, one entry per destination pixel */
+    std::vector<int32_t>          _compiled_offsets; /**< Compiled nearest-neighbour map, one offset per destination pixel */
+    unsigned int                  _compiled_stride;  /**< Entries per compiled row (output width rounded up to the window step), 0 when not in compiled-map mode */
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEREMAPKERNEL_H__ */
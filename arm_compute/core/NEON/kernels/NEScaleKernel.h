@@ -27,6 +27,8 @@
 #include "arm_compute/core/NEON/INEKernel.h"
 #include "arm_compute/core/Types.h"
 
+#include <vector>
+
 namespace arm_compute
 {
 class ITensor;
@@ -84,6 +86,8 @@ private:
     const ITensor *_dy;
     const ITensor *_input;
     ITensor       *_output;
+    /** Byte offset of the input row sampled for each output row, precomputed at configure time */
+    std::vector<int> _input_row_offsets;
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NESCALEKERNEL_H__ */
@@ -73,6 +73,51 @@ private:
     BorderSize     _border_size; /**< Border size */
 };
 
+/** Interface for the kernel to run the 5x5 Sobel filter in a single fused pass.
+ *
+ * The horizontal pass writes its result into small ring buffers of rows which the vertical
+ * pass consumes immediately, so no frame-sized intermediate tensors are needed and the
+ * intermediate rows stay cache resident.
+ */
+class NESobel5x5FusedKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NESobel5x5FusedKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NESobel5x5FusedKernel(const NESobel5x5FusedKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NESobel5x5FusedKernel &operator=(const NESobel5x5FusedKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NESobel5x5FusedKernel(NESobel5x5FusedKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NESobel5x5FusedKernel &operator=(NESobel5x5FusedKernel &&) = default;
+    /** Default destructor */
+    ~NESobel5x5FusedKernel() = default;
+
+    /** Initialise the kernel's source, destinations and border mode.
+     *
+     * @note At least one of output_x or output_y must be set
+     *
+     * @param[in]  input            Source tensor. Data type supported: U8.
+     * @param[out] output_x         (Optional) Destination tensor for the X gradient. Data type supported: S16.
+     * @param[out] output_y         (Optional) Destination tensor for the Y gradient. Data type supported: S16.
+     * @param[in]  border_undefined True if the border mode is undefined. False if it's replicate or constant.
+     */
+    void configure(const ITensor *input, ITensor *output_x, ITensor *output_y, bool border_undefined);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+    BorderSize border_size() const override;
+
+private:
+    const ITensor *_input;       /**< Input tensor */
+    ITensor       *_output_x;    /**< X output of sobel */
+    ITensor       *_output_y;    /**< Y output of sobel */
+    bool           _run_sobel_x; /**< Do we need to run Sobel X? */
+    bool           _run_sobel_y; /**< Do we need to run Sobel Y? */
+};
+
 /** Interface for the kernel to run the vertical pass of 5x5 Sobel Y filter on a tensor.
  *
 */
@@ -131,5 +131,51 @@ private:
     const ITensor        *_sum;
     ITensor              *_output;
 };
+
+/** Interface for the fused softmax kernel
+ *
+ * Computes the whole softmax of each 1D row in a single kernel: the maximum, the shifted
+ * exponentials with their sum and the final normalization are chained per row, so the row
+ * stays resident in the cache across the three phases instead of being streamed from memory
+ * three times as with the @ref NELogits1DMaxKernel / @ref NELogits1DShiftExpSumKernel /
+ * @ref NELogits1DNormKernel chain. No intermediate tensors and no input border are required.
+ */
+class NELogits1DSoftmaxKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NELogits1DSoftmaxKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELogits1DSoftmaxKernel(const NELogits1DSoftmaxKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELogits1DSoftmaxKernel &operator=(const NELogits1DSoftmaxKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NELogits1DSoftmaxKernel(NELogits1DSoftmaxKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NELogits1DSoftmaxKernel &operator=(NELogits1DSoftmaxKernel &&) = default;
+    /** Default destructor */
+    ~NELogits1DSoftmaxKernel() = default;
+    /** Set the input and output tensors.
+     *
+     * @note For QASYMM8 the exponentials are looked up in a 256-entry table built at dispatch
+     *       time and the result is requantized with the output's quantization information
+     *       (defaulted to scale 1/256, offset 0), so no dequantization of the logits is needed.
+     *
+     * @param[in]  input  Source tensor. Data types supported: QASYMM8/F16/F32.
+     * @param[out] output Destination tensor. Data types supported: same as @p input.
+     */
+    void configure(const ITensor *input, ITensor *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    using Logits1DSoftmaxFunction = void(const ITensor *in, ITensor *out, const Window &window);
+
+private:
+    Logits1DSoftmaxFunction *_func;
+    const ITensor           *_input;
+    ITensor                 *_output;
+};
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NESOFTMAXLAYERKERNEL_H__ */
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NETILECHECKSUMKERNEL_H__
+#define __ARM_COMPUTE_NETILECHECKSUMKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to compute a content checksum per horizontal band of rows of a tensor.
+ *
+ * Each tile covers @p tile_rows consecutive rows of the input; the kernel hashes the raw
+ * bytes of every row in the band into one U32 value per tile. The checksum is cheap enough
+ * to run every frame and order-sensitive within each vector lane, so comparing a tile's
+ * value against the previous frame detects content changes with high probability.
+ * Used by @ref NETileCache to skip recomputation of unchanged regions.
+ */
+class NETileChecksumKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NETileChecksumKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NETileChecksumKernel(const NETileChecksumKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NETileChecksumKernel &operator=(const NETileChecksumKernel &) = delete;
+
+    /** Set the input tensor, the checksum output and the tile height.
+     *
+     * @param[in]  input     Input tensor; its raw bytes are hashed, so any data type is supported.
+     *                       Must have at most 2 dimensions.
+     * @param[out] output    1D tensor holding one checksum per tile. Data type supported: U32.
+     *                       Its length must be ceil(input height / @p tile_rows).
+     * @param[in]  tile_rows Number of input rows covered by each tile. Must be greater than 0.
+     */
+    void configure(const ITensor *input, ITensor *output, unsigned int tile_rows);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input;
+    ITensor       *_output;
+    unsigned int   _tile_rows;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NETILECHECKSUMKERNEL_H__ */
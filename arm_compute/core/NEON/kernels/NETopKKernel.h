@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NETOPKKERNEL_H__
+#define __ARM_COMPUTE_NETOPKKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the kernel performing the parallel phase of a top-k selection.
+ *
+ * The kernel is meant to be scheduled split along the X dimension: each thread scans its
+ * slice of the scores and keeps its k best (value, index) pairs in a per-thread candidate
+ * slot, using the current k-th best value as a vectorized rejection threshold so blocks of
+ * scores below it are discarded without any scalar work. A thread that is given several
+ * chunks of the window keeps accumulating into the same slot. The final merge of the
+ * per-thread candidates is performed by @ref NETopK.
+ */
+class NETopKKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NETopKKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NETopKKernel(const NETopKKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NETopKKernel &operator=(const NETopKKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NETopKKernel(NETopKKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NETopKKernel &operator=(NETopKKernel &&) = default;
+    /** Default destructor */
+    ~NETopKKernel() = default;
+    /** Set the input tensor and the per-thread candidate tensors.
+     *
+     * @param[in]     input             Source tensor holding the scores along the X dimension. Must be 1D.
+     *                                  Data types supported: QASYMM8/F32.
+     * @param[in,out] candidate_values  Per-thread candidate values, one row of @p k entries per thread,
+     *                                  sorted in descending order. Data types supported: same as @p input.
+     * @param[in,out] candidate_indices Per-thread candidate indices, same layout as @p candidate_values.
+     *                                  Data type supported: U32.
+     * @param[in,out] candidate_counts  Number of valid candidates per thread. Must be zeroed before each
+     *                                  scheduling of the kernel. Data type supported: U32.
+     * @param[in]     k                 Number of elements to select. Must be in [1, input width].
+     */
+    void configure(const ITensor *input, ITensor *candidate_values, ITensor *candidate_indices, ITensor *candidate_counts, unsigned int k);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    using TopKFunction = void(const ITensor *in, ITensor *values, ITensor *indices, ITensor *counts, unsigned int k, const Window &window, const ThreadInfo &info);
+
+private:
+    TopKFunction *_func;
+    const ITensor *_input;
+    ITensor       *_candidate_values;
+    ITensor       *_candidate_indices;
+    ITensor       *_candidate_counts;
+    unsigned int   _k;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NETOPKKERNEL_H__ */
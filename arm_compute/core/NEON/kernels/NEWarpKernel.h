@@ -79,6 +79,15 @@ protected:
      *  @param[in] window Region on which to execute the kernel
      */
     virtual void warp_replicate(const Window &window) = 0;
+    /** Source bounding box area read per squared destination tile side
+     *
+     * Used by run() to choose a destination tile size whose source footprint fits in the L1
+     * cache: a square destination tile of side T reads a source bounding box of roughly
+     * source_area_scale() * T^2 pixels.
+     *
+     * @return Source footprint area scale of the transformation
+     */
+    virtual float source_area_scale() const = 0;
     /** Common signature for all the specialised warp functions
      *
      * @param[in] window Region on which to execute the kernel.
@@ -102,6 +111,7 @@ private:
     void warp_undefined(const Window &window) override;
     void warp_constant(const Window &window) override;
     void warp_replicate(const Window &window) override;
+    float source_area_scale() const override;
 };
 
 /** Template interface for the kernel to compute warp perspective
@@ -115,6 +125,7 @@ private:
     void warp_undefined(const Window &window) override;
     void warp_constant(const Window &window) override;
     void warp_replicate(const Window &window) override;
+    float source_area_scale() const override;
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEWARPKERNEL_H__ */
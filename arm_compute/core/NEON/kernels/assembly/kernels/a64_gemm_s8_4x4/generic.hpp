@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <arm_neon.h>
+
+// Kernel implementation.
+//
+// Assume that "Apanel" points to a chunk of A blocks (each size 4xK) in read-order.
+// Assume that "Bpanel" points to a chunk of B blocks (each size 4xK) in read-order.
+// Assume that "Cpanel" points to a chunk of C output blocks (each size
+// 4x4), the chunks being arranged in a row major fashion.
+//
+// The K interleave is 16, so each block is a sequence of 16-byte subblocks,
+// one per row (column for B), repeated along K.  Products are widened to 16
+// bits and accumulated pairwise into 32-bit lanes, which are reduced to the
+// scalar result once the K loop is done.
+
+inline void a64_gemm_s8_4x4(const int8_t *Apanel, const int8_t *Bpanel, int32_t *Cpanel, int ablocks, int bblocks, int K) {
+    const int8_t *a_ptr = Apanel;
+    int32_t *c_ptr = Cpanel;
+
+    // K is rounded up to a multiple of the 16-wide unroll by the caller.
+    const int blocks = K / 16;
+
+    for (int yb=0; yb<ablocks; yb++) {
+        const int8_t *a_ptr0 = a_ptr;
+        const int8_t *b_ptr = Bpanel;
+
+        for (int xb=0; xb<bblocks; xb++) {
+            a_ptr = a_ptr0;
+
+            int32x4_t acc[4][4];
+            for (int r=0; r<4; r++) {
+                for (int c=0; c<4; c++) {
+                    acc[r][c] = vdupq_n_s32(0);
+                }
+            }
+
+            for (int k=0; k<blocks; k++) {
+                int8x16_t a[4];
+                int8x16_t b[4];
+
+                for (int r=0; r<4; r++) {
+                    a[r] = vld1q_s8(a_ptr + 16 * r);
+                }
+                for (int c=0; c<4; c++) {
+                    b[c] = vld1q_s8(b_ptr + 16 * c);
+                }
+
+                for (int r=0; r<4; r++) {
+                    for (int c=0; c<4; c++) {
+                        int16x8_t prod = vmull_s8(vget_low_s8(a[r]), vget_low_s8(b[c]));
+                        prod        = vmlal_s8(prod, vget_high_s8(a[r]), vget_high_s8(b[c]));
+                        acc[r][c]   = vpadalq_s16(acc[r][c], prod);
+                    }
+                }
+
+                a_ptr += 64;
+                b_ptr += 64;
+            }
+
+            for (int r=0; r<4; r++) {
+                for (int c=0; c<4; c++) {
+                    *c_ptr++ = vaddvq_s32(acc[r][c]);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#if defined(__aarch64__) && defined(__ARM_FEATURE_DOTPROD)
+
+// Actual kernel implementations
+#include "a64_gemm_s8_4x4_dot/generic.hpp"
+
+// 4x4 int8_t GEMM "strategy" class using the ARMv8.2 dot product instructions.
+//
+// Both operands are interleaved in blocks of 4 along K so each 32-bit vector
+// lane holds one row's (column's) 4-element K chunk and a single SDOT computes
+// four multiply-accumulates per lane.  Requires a CPU implementing the dot
+// product extension; the registry only selects this variant when the DOT
+// feature bit is set.
+class gemm_s8_4x4_dot {
+public:
+    typedef int8_t operand_type;
+    typedef int32_t result_type;
+
+    typedef void (*kern_type)(const int8_t *, const int8_t *, int32_t *, int, int, int);
+
+    /* Describes the data layout for A input */
+    static const int A_interleave = 4;
+    static const int A_block = 4;
+    static const int A_transpose = 0;
+
+    /* Same for B input */
+    static const int B_interleave = 4;
+    static const int B_block = 4;
+    static const int B_transpose = 1;
+
+    /* Kernel blocking parameters */
+    static const int out_width = 4;
+    static const int out_height = 4;
+    static const int k_unroll = 4;
+
+    kern_type kernel{nullptr};
+
+    gemm_s8_4x4_dot(const CPUInfo *ci) {
+        kernel = a64_gemm_s8_4x4_dot;
+    }
+};
+
+#endif // defined(__aarch64__) && defined(__ARM_FEATURE_DOTPROD)
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <arm_neon.h>
+
+// Kernel implementation.
+//
+// Assume that "Apanel" points to a chunk of A blocks (each size 4xK) in read-order.
+// Assume that "Bpanel" points to a chunk of B blocks (each size 4xK) in read-order.
+// Assume that "Cpanel" points to a chunk of C output blocks (each size
+// 4x4), the chunks being arranged in a row major fashion.
+//
+// The K interleave is 4, so one 16-byte vector of the A panel carries the
+// 4-element K chunk of all four rows (one row per 32-bit lane), and likewise
+// for the B panel's columns.  Each UDOT-by-element accumulates a whole row of
+// the 4x4 block, replacing the widening multiply-accumulate chains of the
+// generic kernel with one instruction per row and K chunk.
+
+inline void a64_gemm_u8_4x4_dot(const uint8_t *Apanel, const uint8_t *Bpanel, uint32_t *Cpanel, int ablocks, int bblocks, int K) {
+    const uint8_t *a_ptr = Apanel;
+    uint32_t *c_ptr = Cpanel;
+
+    // K is rounded up to a multiple of the 4-wide unroll by the caller.
+    const int blocks = K / 4;
+
+    for (int yb=0; yb<ablocks; yb++) {
+        const uint8_t *a_ptr0 = a_ptr;
+        const uint8_t *b_ptr = Bpanel;
+
+        for (int xb=0; xb<bblocks; xb++) {
+            a_ptr = a_ptr0;
+
+            uint32x4_t acc[4];
+            for (int r=0; r<4; r++) {
+                acc[r] = vdupq_n_u32(0);
+            }
+
+            for (int k=0; k<blocks; k++) {
+                const uint8x16_t a = vld1q_u8(a_ptr);
+                const uint8x16_t b = vld1q_u8(b_ptr);
+
+                // acc[r] lane c accumulates dot(A row r, B column c) over this K chunk
+                acc[0] = vdotq_laneq_u32(acc[0], b, a, 0);
+                acc[1] = vdotq_laneq_u32(acc[1], b, a, 1);
+                acc[2] = vdotq_laneq_u32(acc[2], b, a, 2);
+                acc[3] = vdotq_laneq_u32(acc[3], b, a, 3);
+
+                a_ptr += 16;
+                b_ptr += 16;
+            }
+
+            for (int r=0; r<4; r++) {
+                vst1q_u32(c_ptr, acc[r]);
+                c_ptr += 4;
+            }
+        }
+    }
+}
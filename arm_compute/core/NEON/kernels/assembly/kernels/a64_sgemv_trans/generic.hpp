@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <arm_neon.h>
+
+// Kernel implementation - transposed GEMV
+//
+// Computes y = beta * y + alpha * x^T A, where A is stored "transposed"
+// with respect to the classic GEMV: M rows of length N with row stride
+// lda, so the N dimension is innermost.  This means the kernel streams A
+// with unit-stride vector loads, accumulating 16 output columns at a time,
+// which is the fast case for the batch-1 fully connected layers this is
+// used for.
+
+inline void a64_sgemv_trans(const float *Astart, const float *Xstart, float *Ystart, float alpha, float beta, int lda, int M, int N) {
+    const float32x4_t valpha    = vdupq_n_f32(alpha);
+    const float32x4_t vbeta     = vdupq_n_f32(beta);
+    const bool        zero_beta = (beta == 0.0f);
+
+    int x = 0;
+
+    for (; x <= (N - 16); x += 16) {
+        const float *a_ptr = Astart + x;
+
+        float32x4_t acc0 = vdupq_n_f32(0.0f);
+        float32x4_t acc1 = vdupq_n_f32(0.0f);
+        float32x4_t acc2 = vdupq_n_f32(0.0f);
+        float32x4_t acc3 = vdupq_n_f32(0.0f);
+
+        for (int m = 0; m < M; m++) {
+            const float32x4_t xv = vdupq_n_f32(Xstart[m]);
+
+            acc0 = vfmaq_f32(acc0, vld1q_f32(a_ptr + 0), xv);
+            acc1 = vfmaq_f32(acc1, vld1q_f32(a_ptr + 4), xv);
+            acc2 = vfmaq_f32(acc2, vld1q_f32(a_ptr + 8), xv);
+            acc3 = vfmaq_f32(acc3, vld1q_f32(a_ptr + 12), xv);
+
+            a_ptr += lda;
+        }
+
+        // Don't read the output if beta is zero - it may be uninitialized.
+        const float32x4_t y0 = zero_beta ? vdupq_n_f32(0.0f) : vmulq_f32(vld1q_f32(Ystart + x + 0), vbeta);
+        const float32x4_t y1 = zero_beta ? vdupq_n_f32(0.0f) : vmulq_f32(vld1q_f32(Ystart + x + 4), vbeta);
+        const float32x4_t y2 = zero_beta ? vdupq_n_f32(0.0f) : vmulq_f32(vld1q_f32(Ystart + x + 8), vbeta);
+        const float32x4_t y3 = zero_beta ? vdupq_n_f32(0.0f) : vmulq_f32(vld1q_f32(Ystart + x + 12), vbeta);
+
+        vst1q_f32(Ystart + x + 0, vfmaq_f32(y0, acc0, valpha));
+        vst1q_f32(Ystart + x + 4, vfmaq_f32(y1, acc1, valpha));
+        vst1q_f32(Ystart + x + 8, vfmaq_f32(y2, acc2, valpha));
+        vst1q_f32(Ystart + x + 12, vfmaq_f32(y3, acc3, valpha));
+    }
+
+    for (; x <= (N - 4); x += 4) {
+        const float *a_ptr = Astart + x;
+
+        float32x4_t acc = vdupq_n_f32(0.0f);
+
+        for (int m = 0; m < M; m++) {
+            acc = vfmaq_f32(acc, vld1q_f32(a_ptr), vdupq_n_f32(Xstart[m]));
+            a_ptr += lda;
+        }
+
+        const float32x4_t y = zero_beta ? vdupq_n_f32(0.0f) : vmulq_f32(vld1q_f32(Ystart + x), vbeta);
+
+        vst1q_f32(Ystart + x, vfmaq_f32(y, acc, valpha));
+    }
+
+    for (; x < N; x++) {
+        const float *a_ptr = Astart + x;
+
+        float acc = 0.0f;
+
+        for (int m = 0; m < M; m++) {
+            acc += a_ptr[0] * Xstart[m];
+            a_ptr += lda;
+        }
+
+        Ystart[x] = (zero_beta ? 0.0f : beta * Ystart[x]) + alpha * acc;
+    }
+}
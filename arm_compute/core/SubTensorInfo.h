@@ -110,6 +110,26 @@ public:
         ARM_COMPUTE_ERROR_ON(_parent == nullptr);
         return _parent->fixed_point_position();
     }
+    QuantizationInfo quantization_info() const override
+    {
+        ARM_COMPUTE_ERROR_ON(_parent == nullptr);
+        return _parent->quantization_info();
+    }
+    void set_quantization_info(QuantizationInfo quantization_info) override
+    {
+        ARM_COMPUTE_ERROR_ON(_parent == nullptr);
+        _parent->set_quantization_info(quantization_info);
+    }
+    DataLayout data_layout() const override
+    {
+        ARM_COMPUTE_ERROR_ON(_parent == nullptr);
+        return _parent->data_layout();
+    }
+    void set_data_layout(DataLayout data_layout) override
+    {
+        ARM_COMPUTE_ERROR_ON(_parent == nullptr);
+        _parent->set_data_layout(data_layout);
+    }
     size_t element_size() const override
     {
         ARM_COMPUTE_ERROR_ON(_parent == nullptr);
@@ -97,6 +97,14 @@ public:
      * @param[in] fixed_point_position (Optional) Fixed point position that expresses the number of bits for the fractional part of the number when the tensor's data type is QS8 or QS16.
      */
     TensorInfo(const TensorShape &tensor_shape, size_t num_channels, DataType data_type, int fixed_point_position = 0);
+    /** Constructor
+     *
+     * @param[in] tensor_shape      It specifies the size for each dimension of the tensor in number of elements.
+     * @param[in] num_channels      It indicates the number of channels for each tensor element
+     * @param[in] data_type         Data type to use for each tensor element
+     * @param[in] quantization_info Quantization settings (scale and offset) for the tensor. Only used when the data type is QASYMM8.
+     */
+    TensorInfo(const TensorShape &tensor_shape, size_t num_channels, DataType data_type, QuantizationInfo quantization_info);
     /** Constructor
      *
      * @param[in] hog_info HOG's metadata used to allocate normalized HOG space
@@ -205,6 +213,8 @@ public:
     void set_format(Format format) override;
     void set_tensor_shape(TensorShape shape) override;
     void set_fixed_point_position(int fixed_point_position) override;
+    void set_quantization_info(QuantizationInfo quantization_info) override;
+    void set_data_layout(DataLayout data_layout) override;
     bool auto_padding() override;
     bool extend_padding(const PaddingSize &padding) override;
     size_t dimension(size_t index) const override
@@ -224,6 +234,14 @@ public:
     {
         return _fixed_point_position;
     }
+    QuantizationInfo quantization_info() const override
+    {
+        return _quantization_info;
+    }
+    DataLayout data_layout() const override
+    {
+        return _data_layout;
+    }
     size_t element_size() const override
     {
         return data_size_from_type(_data_type) * _num_channels;
@@ -295,6 +313,8 @@ private:
     bool        _is_resizable;
     ValidRegion _valid_region;
     PaddingSize _padding;
+    QuantizationInfo _quantization_info;
+    DataLayout       _data_layout;
 };
 }
 #endif /*__ARM_COMPUTE_TENSORINFO_H__ */
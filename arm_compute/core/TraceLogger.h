@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __ARM_COMPUTE_TRACELOGGER_H__
+#define __ARM_COMPUTE_TRACELOGGER_H__
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/** Records a binary trace event. Costs a single relaxed atomic load when tracing is disabled. */
+#define ARM_COMPUTE_TRACE_EVENT(event_id, arg0, arg1)                               \
+    do                                                                              \
+    {                                                                               \
+        if(arm_compute::TraceLogger::get().enabled())                               \
+        {                                                                           \
+            arm_compute::TraceLogger::get().record((event_id), (arg0), (arg1));     \
+        }                                                                           \
+    } while(false)
+
+namespace arm_compute
+{
+/** Fixed-size binary trace record */
+struct TraceEvent
+{
+    uint32_t event_id;  /**< Identifier of the traced event */
+    uint32_t thread_id; /**< Identifier of the recording thread's ring buffer */
+    uint64_t timestamp; /**< Time of the event in nanoseconds of the steady clock */
+    uint64_t args[2];   /**< Free-form event arguments */
+};
+
+/** Low-overhead binary trace logger.
+ *
+ * Unlike @ref Logger, which formats through a stream on the caller's thread, record() only
+ * stamps a fixed-size binary record into a lock-free per-thread ring buffer: no allocation,
+ * no formatting and no synchronization with other threads on the recording path, so tracing
+ * can stay enabled in production builds without perturbing kernel dispatch timing.
+ * Formatting happens offline when the rings are drained.
+ *
+ * The rings are bounded: once full, a thread's ring overwrites its oldest records, keeping
+ * the most recent window of activity.
+ */
+class TraceLogger
+{
+public:
+    /** Access the trace logger singleton
+     *
+     * @return The trace logger
+     */
+    static TraceLogger &get();
+    /** Enables or disables trace recording.
+     *
+     * @param[in] enabled True to record trace events.
+     */
+    void set_enabled(bool enabled);
+    /** Returns true if trace recording is enabled.
+     *
+     * @return True if trace recording is enabled.
+     */
+    bool enabled() const;
+    /** Records one event into the calling thread's ring buffer. No-op when tracing is disabled.
+     *
+     * @param[in] event_id Identifier of the event.
+     * @param[in] arg0     First event argument.
+     * @param[in] arg1     Second event argument.
+     */
+    void record(uint32_t event_id, uint64_t arg0 = 0, uint64_t arg1 = 0);
+    /** Associates a human readable name with an event identifier, used by format().
+     *
+     * @param[in] event_id Identifier of the event.
+     * @param[in] name     Name to print for the event.
+     */
+    void set_event_name(uint32_t event_id, std::string name);
+    /** Empties every thread's ring buffer and returns the recorded events sorted by timestamp.
+     *
+     * Meant to be called while the traced threads are quiescent; events recorded concurrently
+     * with the drain may be missed.
+     *
+     * @return The recorded events, oldest first.
+     */
+    std::vector<TraceEvent> drain();
+    /** Drains the ring buffers and writes the events to the given stream, one line per event.
+     *
+     * @param[out] stream Stream to format the events into.
+     */
+    void format(std::ostream &stream);
+
+private:
+    /** Default constructor */
+    TraceLogger();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    TraceLogger(const TraceLogger &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    TraceLogger &operator=(const TraceLogger &) = delete;
+
+    /** Number of records each per-thread ring buffer can hold */
+    static constexpr unsigned int ring_capacity = 4096;
+
+    /** Ring buffer written by exactly one thread; the head counter never wraps so the
+     * oldest retained record can be located when the ring has overflowed */
+    struct Ring
+    {
+        std::atomic<uint64_t> head{ 0 };        /**< Total number of records written */
+        uint32_t              thread_id{ 0 };   /**< Identifier reported in the records */
+        std::array<TraceEvent, ring_capacity> events{ {} }; /**< Record storage */
+    };
+
+    /** Returns the calling thread's ring buffer, registering a new one on first use. */
+    Ring &thread_ring();
+
+    std::atomic<bool>                  _enabled;
+    std::mutex                         _rings_mutex;
+    std::vector<std::unique_ptr<Ring>> _rings;
+    std::map<uint32_t, std::string>    _event_names;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_TRACELOGGER_H__ */
@@ -27,7 +27,9 @@
 #include "arm_compute/core/Coordinates.h"
 #include "arm_compute/core/TensorShape.h"
 #include "support/Half.h"
+#include "support/ToolchainSupport.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <string>
@@ -67,6 +69,7 @@ enum class DataType
     U8,
     S8,
     QS8,
+    QASYMM8,
     U16,
     S16,
     QS16,
@@ -81,9 +84,74 @@ enum class DataType
     SIZET
 };
 
+/** Supported tensor data layouts */
+enum class DataLayout
+{
+    NCHW, /**< Width is the innermost (contiguous) dimension, followed by height and channels */
+    NHWC  /**< Channels is the innermost (contiguous) dimension, followed by width and height */
+};
+
 /** Constant value of the border pixels when using BorderMode::CONSTANT */
 constexpr uint8_t CONSTANT_BORDER_VALUE = 199;
 
+/** Quantization settings (used for QASYMM8 data type)
+ *
+ * Describes the affine mapping real_value = (quantized_value - offset) * scale
+ */
+struct QuantizationInfo
+{
+    /** Default constructor */
+    QuantizationInfo()
+        : scale(0.f), offset(0)
+    {
+    }
+    /** Construct quantization info.
+     *
+     * @param[in] scale  Scale.
+     * @param[in] offset Offset.
+     */
+    QuantizationInfo(float scale, int offset)
+        : scale(scale), offset(offset)
+    {
+    }
+
+    float scale;  /**< scale */
+    int   offset; /**< offset */
+
+    /** Quantizes a value using the scale/offset in this QuantizationInfo
+     *
+     * @param[in] value Value to quantize
+     *
+     * @return the quantized value
+     */
+    uint8_t quantize(float value) const
+    {
+        int quantized = static_cast<int>(support::cpp11::round(value / scale)) + offset;
+        quantized     = std::max(0, std::min(quantized, 255));
+        return static_cast<uint8_t>(quantized);
+    }
+
+    /** Dequantizes a value using the scale/offset in this QuantizationInfo
+     *
+     * @param[in] value Value to dequantize
+     *
+     * @return the original value before quantization
+     */
+    float dequantize(uint8_t value) const
+    {
+        return (static_cast<int>(value) - offset) * scale;
+    }
+
+    /** Indicates whether this QuantizationInfo has valid settings or not
+     *
+     * @return True if the this has invalid settings.
+     */
+    bool empty() const
+    {
+        return scale == 0;
+    }
+};
+
 /* Constant value used to indicate a half-scale pyramid */
 constexpr float SCALE_PYRAMID_HALF = 0.5f;
 
@@ -234,6 +302,13 @@ enum class ThresholdType
     RANGE   /**< Threshold with two values*/
 };
 
+/** Precision of the intermediate accumulation in kernels that support a precision policy */
+enum class AccumulatePrecision
+{
+    FULL,   /**< Accumulate in at least 32-bit precision regardless of the data type */
+    REDUCED /**< Accumulate in the data type of the tensors */
+};
+
 /** Rounding method */
 enum class RoundingPolicy
 {
@@ -351,6 +426,9 @@ enum class ReductionOperation
 {
     SUM_SQUARE, /**< Sum of squares */
     SUM,        /**< Sum */
+    MEAN,       /**< Arithmetic mean */
+    MAX,        /**< Maximum */
+    MIN,        /**< Minimum */
 };
 
 /** The normalization type used for the normalization layer */
@@ -364,9 +442,10 @@ enum class NormType
 /** Normalization type for Histogram of Oriented Gradients (HOG) */
 enum class HOGNormType
 {
-    L2_NORM    = 1, /**< L2-norm */
-    L2HYS_NORM = 2, /**< L2-norm followed by clipping */
-    L1_NORM    = 3  /**< L1 norm */
+    L2_NORM     = 1, /**< L2-norm */
+    L2HYS_NORM  = 2, /**< L2-norm followed by clipping */
+    L1_NORM     = 3, /**< L1 norm */
+    L1SQRT_NORM = 4  /**< L1 norm followed by an element-wise square root */
 };
 
 /** Detection window used for the object detection. The detection window keeps the following information:
@@ -418,7 +497,32 @@ public:
                   unsigned int pad_x = 0, unsigned int pad_y = 0,
                   DimensionRoundingType round = DimensionRoundingType::FLOOR)
         : _stride(std::make_pair(stride_x, stride_y)),
-          _pad(std::make_pair(pad_x, pad_y)),
+          _pad_left(pad_x),
+          _pad_top(pad_y),
+          _pad_right(pad_x),
+          _pad_bottom(pad_y),
+          _round_type(round)
+    {
+    }
+    /** Constructor with asymmetric padding
+     *
+     * @param[in] stride_x   Stride, in elements, across x.
+     * @param[in] stride_y   Stride, in elements, across y.
+     * @param[in] pad_left   Padding, in elements, at the left edge.
+     * @param[in] pad_right  Padding, in elements, at the right edge.
+     * @param[in] pad_top    Padding, in elements, at the top edge.
+     * @param[in] pad_bottom Padding, in elements, at the bottom edge.
+     * @param[in] round      Dimensions rounding.
+     */
+    PadStrideInfo(unsigned int stride_x, unsigned int stride_y,
+                  unsigned int pad_left, unsigned int pad_right,
+                  unsigned int pad_top, unsigned int pad_bottom,
+                  DimensionRoundingType round)
+        : _stride(std::make_pair(stride_x, stride_y)),
+          _pad_left(pad_left),
+          _pad_top(pad_top),
+          _pad_right(pad_right),
+          _pad_bottom(pad_bottom),
           _round_type(round)
     {
     }
@@ -426,9 +530,35 @@ public:
     {
         return _stride;
     }
+    /** Returns the (left, top) padding pair.
+     *
+     * Kept for the common symmetric case; use the explicit accessors when the
+     * padding may have been set asymmetrically.
+     */
     std::pair<unsigned int, unsigned int> pad() const
     {
-        return _pad;
+        return std::make_pair(_pad_left, _pad_top);
+    }
+    unsigned int pad_left() const
+    {
+        return _pad_left;
+    }
+    unsigned int pad_right() const
+    {
+        return _pad_right;
+    }
+    unsigned int pad_top() const
+    {
+        return _pad_top;
+    }
+    unsigned int pad_bottom() const
+    {
+        return _pad_bottom;
+    }
+    /** Checks whether the padding is symmetric on both axes */
+    bool padding_is_symmetric() const
+    {
+        return (_pad_left == _pad_right) && (_pad_top == _pad_bottom);
     }
     DimensionRoundingType round() const
     {
@@ -437,7 +567,10 @@ public:
 
 private:
     std::pair<unsigned int, unsigned int> _stride;
-    std::pair<unsigned int, unsigned int> _pad;
+    unsigned int _pad_left;
+    unsigned int _pad_top;
+    unsigned int _pad_right;
+    unsigned int _pad_bottom;
     DimensionRoundingType _round_type;
 };
 
@@ -535,7 +668,12 @@ public:
      * @param[in] b (Optional) The beta parameter used by some activation functions (@ref ActivationFunction::LINEAR, @ref ActivationFunction::LU_BOUNDED_RELU, @ref ActivationFunction::TANH).
      */
     ActivationLayerInfo(ActivationFunction f, float a = 0.0f, float b = 0.0f)
-        : _act(f), _a(a), _b(b)
+        : _act(f), _a(a), _b(b), _enabled(true)
+    {
+    }
+    /** Default Constructor: describes the absence of an activation (enabled() returns false) */
+    ActivationLayerInfo()
+        : _act(ActivationFunction::LOGISTIC), _a(0.0f), _b(0.0f), _enabled(false)
     {
     }
     ActivationFunction activation() const
@@ -550,11 +688,16 @@ public:
     {
         return _b;
     }
+    bool enabled() const
+    {
+        return _enabled;
+    }
 
 private:
     ActivationFunction _act;
     float              _a;
     float              _b;
+    bool               _enabled;
 };
 
 /** Normalization Layer Information class */
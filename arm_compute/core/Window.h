@@ -221,6 +221,20 @@ public:
      * @return The subwindow "id" out of "total"
      */
     Window split_window(size_t dimension, size_t id, size_t total) const;
+    /** Clip the window against a region of interest
+     *
+     * The intersection is snapped outwards to the window's step grid so every surviving
+     * iteration processes a full step while the region of interest stays fully covered.
+     * Dimensions beyond the dimensionality of @p shape are left untouched. The result is
+     * always contained in this window, so the border and padding guarantees the window was
+     * configured with still hold.
+     *
+     * @param[in] anchor Coordinates of the top-left corner of the region of interest.
+     * @param[in] shape  Shape of the region of interest.
+     *
+     * @return The clipped window.
+     */
+    Window clipped_to(const Coordinates &anchor, const TensorShape &shape) const;
     /** First 1D slice of the window
      *
      * @return The first slice of the window.
@@ -295,15 +309,27 @@ public:
     }
 
     /* Collapse the dimensions higher than @p first if possible.
+     *
+     * A dimension is collapsable if it starts from 0 and matches the corresponding dimension in the full_window
+     *
+     * @param[in]  full_window   Full window @p window has been created from.
+     * @param[in]  first         Dimensions into which the following are collapsed.
+     * @param[out] has_collapsed (Optional) Set to true if at least one dimension has been collapsed.
+     *
+     * @return Collapsed window.
+     */
+    Window collapse_if_possible(const Window &full_window, size_t first, bool *has_collapsed = nullptr) const;
+
+    /* Collapse the dimensions higher than @p first.
      *
      * A dimension is collapsable if it starts from 0 and matches the corresponding dimension in the full_window
      *
      * @param[in] full_window Full window @p window has been created from.
      * @param[in] first       Dimensions into which the following are collapsed.
      *
-     * @return Collapsed window.
+     * @return Collapsed window. It must collapse at least one dimension, an error is raised otherwise.
      */
-    Window collapse_if_possible(const Window &full_window, size_t first) const;
+    Window collapse(const Window &full_window, size_t first) const;
 
 private:
     /** First slice of the window
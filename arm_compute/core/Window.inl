@@ -43,15 +43,17 @@ inline void Window::set(size_t dimension, const Window::Dimension &dim)
     _dims[dimension] = dim;
 }
 
-inline Window Window::collapse_if_possible(const Window &full_window, size_t first) const
+inline Window Window::collapse_if_possible(const Window &full_window, size_t first, bool *has_collapsed) const
 {
     bool   is_collapsable = false;
+    bool   collapsed_any  = false;
     Window collapsed;
     for(size_t d = 0; d < Coordinates::num_max_dimensions; ++d)
     {
         if(is_collapsable)
         {
             collapsed.set(first, Window::Dimension(collapsed[first].end() * _dims[d].start(), collapsed[first].end() * _dims[d].end()));
+            collapsed_any = true;
         }
         else
         {
@@ -69,6 +71,19 @@ inline Window Window::collapse_if_possible(const Window &full_window, size_t fir
             is_collapsable = false;
         }
     }
+    if(has_collapsed != nullptr)
+    {
+        *has_collapsed = collapsed_any;
+    }
+    return collapsed;
+}
+
+inline Window Window::collapse(const Window &full_window, size_t first) const
+{
+    bool   has_collapsed = false;
+    Window collapsed     = collapse_if_possible(full_window, first, &has_collapsed);
+    // Make sure that the window has collapsed
+    ARM_COMPUTE_ERROR_ON(!has_collapsed);
     return collapsed;
 }
 
@@ -159,6 +174,41 @@ inline Window Window::split_window(size_t dimension, size_t id, size_t total) co
     return out;
 }
 
+inline Window Window::clipped_to(const Coordinates &anchor, const TensorShape &shape) const
+{
+    Window out(*this);
+
+    for(size_t d = 0; d < shape.num_dimensions(); ++d)
+    {
+        const Dimension &dim  = _dims[d];
+        const int        step = dim.step();
+
+        int start = dim.start();
+        int end   = dim.end();
+
+        if(step != 0)
+        {
+            if(anchor[d] > start)
+            {
+                // Snap the new start down to the step grid of the configured window
+                start = std::min(start + ((anchor[d] - start) / step) * step, end);
+            }
+
+            const int roi_end = anchor[d] + static_cast<int>(shape[d]);
+
+            if(roi_end < end)
+            {
+                // Snap the new end up to the step grid of the configured window
+                end = std::min(start + ceil_to_multiple(std::max(roi_end - start, 0), step), end);
+            }
+        }
+
+        out.set(d, Dimension(start, end, step));
+    }
+
+    return out;
+}
+
 template <unsigned int window_dimension>
 inline bool Window::slide_window_slice(Window &slice) const
 {
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_GRAPH_CONVOLUTION_METHOD_TABLE_H__
+#define __ARM_COMPUTE_GRAPH_CONVOLUTION_METHOD_TABLE_H__
+
+#include "arm_compute/graph/Types.h"
+
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Table of measured per-shape-class convolution method decisions
+ *
+ * Backs @ref ConvolutionMethodHint::AUTO: the first time a layer of a given shape class runs,
+ * both the GEMM and the direct method are timed and the winner is recorded here, so every later
+ * layer (and every later process, when a file is bound) of that class selects its method without
+ * measuring. The right answer depends on the device, which is why the table is measured rather
+ * than hard-coded: direct convolution tends to win for small kernels with few channels on
+ * in-order cores while GEMM wins on wider out-of-order ones.
+ */
+class ConvolutionMethodTable
+{
+public:
+    /** Access the process-wide decision table
+     *
+     * @return The decision table
+     */
+    static ConvolutionMethodTable &get();
+    /** Binds the table to a file, loading any decisions it already contains
+     *
+     * Decisions recorded after the call rewrite the file, so a table measured on the first run
+     * (or by an offline tuning pass) persists across processes. Without a bound file the table
+     * lives only as long as the process.
+     *
+     * @param[in] filename File holding the decisions, created on the first recorded decision if it does not exist
+     */
+    void bind_file(const std::string &filename);
+    /** Looks up the recorded method for a shape class
+     *
+     * @param[in]  key    Shape class key
+     * @param[out] method Recorded method, unchanged if the class has no recorded decision
+     *
+     * @return True if the shape class has a recorded decision
+     */
+    bool lookup(const std::string &key, ConvolutionMethodHint &method) const;
+    /** Records the measured method for a shape class and rewrites the bound file
+     *
+     * @param[in] key    Shape class key
+     * @param[in] method Measured method
+     */
+    void store(const std::string &key, ConvolutionMethodHint method);
+
+private:
+    /** Default constructor */
+    ConvolutionMethodTable() = default;
+
+    std::map<std::string, ConvolutionMethodHint> _table;    /**< Recorded decisions, keyed by shape class */
+    std::string                                  _filename; /**< Bound file, empty when the table is process-local */
+    mutable std::mutex                           _mutex;    /**< Protects the table against concurrent graphs */
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_GRAPH_CONVOLUTION_METHOD_TABLE_H__ */
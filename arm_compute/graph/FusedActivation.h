@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_GRAPH_FUSED_ACTIVATION_H__
+#define __ARM_COMPUTE_GRAPH_FUSED_ACTIVATION_H__
+
+#include "arm_compute/graph/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+
+namespace graph
+{
+/** Function running a wrapped function followed by an in-place activation on its output
+ *
+ * Used by nodes that absorb a following ActivationLayer node but whose backend function
+ * cannot apply the activation in its own output stage: both functions still run as a
+ * single pipeline stage, without an intermediate tensor.
+ */
+class FusedActivationFunction final : public arm_compute::IFunction
+{
+public:
+    /** Constructor
+     *
+     * @param[in] func       Main function to run
+     * @param[in] activation Activation function configured in-place on @p func's output
+     */
+    FusedActivationFunction(std::unique_ptr<arm_compute::IFunction> func, std::unique_ptr<arm_compute::IFunction> activation);
+
+    // Inherited methods overriden:
+    void run() override;
+    void prepare() override;
+
+private:
+    std::unique_ptr<arm_compute::IFunction> _func;       /**< Main function */
+    std::unique_ptr<arm_compute::IFunction> _activation; /**< In-place activation function */
+};
+
+/** Creates an activation function configured to run in-place on @p tensor
+ *
+ * @param[in]     target_hint Target to instantiate the activation for
+ * @param[in,out] tensor      Tensor the activation is applied to
+ * @param[in]     act_info    Activation layer information
+ *
+ * @return The in-place activation function
+ */
+std::unique_ptr<arm_compute::IFunction> instantiate_in_place_activation(TargetHint target_hint, ITensor *tensor, const ActivationLayerInfo &act_info);
+} // namespace graph
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_GRAPH_FUSED_ACTIVATION_H__ */
@@ -27,16 +27,30 @@
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/Types.h"
+#include "arm_compute/runtime/IScheduler.h"
 #include "support/ToolchainSupport.h"
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace arm_compute
 {
 class IFunction;
+class ITensor;
 
 namespace graph
 {
+/** Accumulated timing of one pipeline stage, as returned by @ref Graph::profiling_report */
+struct GraphStageProfile
+{
+    std::string name;     /**< Layer type name of the stage */
+    std::string shape;    /**< Output tensor shape of the stage */
+    unsigned int runs;    /**< Number of times the stage has run */
+    double total_time_us; /**< Accumulated wall time in microseconds */
+    double last_time_us;  /**< Wall time of the most recent run in microseconds */
+};
+
 /** Graph class */
 class Graph final
 {
@@ -55,11 +69,71 @@ public:
     Graph &operator=(Graph &&) = delete;
     /** Executes the graph */
     void run();
+    /** Runs one frame up to the given cut point
+     *
+     * Calls the input accessor and executes the stages up to, and including, the marked
+     * node's stage, leaving the rest of the pipeline untouched. The returned tensor holds
+     * the node's result for the frame and stays valid until @ref run_from completes the
+     * frame. OpenCL-backed tensors must be mapped before the host reads them.
+     *
+     * @note Cannot be combined with pipelined or sub-batched execution. The frame deadline
+     *       is not applied to partial execution.
+     *
+     * @param[in] name Name of the cut point to stop at
+     *
+     * @return The cut point's boundary tensor, or nullptr if no frame was delivered
+     */
+    const arm_compute::ITensor *run_to(const std::string &name);
+    /** Completes the frame started by @ref run_to from the given cut point
+     *
+     * Executes the remaining stages on the intermediate results left by run_to and calls
+     * the output accessor. May run on a different thread than run_to, e.g. in the
+     * background while the caller consumes the cut point's tensor.
+     *
+     * @param[in] name Name of the cut point to continue from
+     *
+     * @return True if the frame's output was delivered
+     */
+    bool run_from(const std::string &name);
+    /** Requests the running graph to stop as soon as possible
+     *
+     * Callable from any thread while run() executes on another. The in-flight frame is
+     * abandoned at the next stage boundary - a NEON kernel in progress additionally stops at
+     * its next window-chunk boundary - its output accessor is not called, and run() returns.
+     * Tensors of the abandoned frame hold partial results; the next run() recomputes them.
+     */
+    void cancel();
+    /** Prepares the graph for low-latency execution
+     *
+     * Forces all the one-shot work that otherwise happens during the first run - memory pool
+     * allocation, weight reshaping, OpenCL kernel compilation and tuner sweeps - by planning
+     * the memory, preparing every stage and running one dry pass over the (uninitialized)
+     * input tensor. Accessors are not called during the dry pass. After finalize() returns,
+     * the first real run() executes at steady-state speed.
+     *
+     * @note Optional: running the graph without it is functionally identical, only the first
+     *       frame is slower. Must be called after the graph's output tensor has been added.
+     */
+    void finalize();
     /** Adds a node to the graph
      *
      * @param[in] node Node to add
      */
     void add_node(std::unique_ptr<INode> node);
+    /** Marks a named cut point after the most recently added node
+     *
+     * A cut point splits the pipeline between the node's stage and its consumers, so the
+     * graph can be executed in two parts with @ref run_to and @ref run_from. The typical
+     * use is a backbone/heads split: the backbone result is available as soon as run_to
+     * returns, while the heads complete in the background. A pending cut point blocks
+     * fusion into the marked node, so the node's own result is what gets exposed.
+     *
+     * @note Must be placed after at least one node and before the output tensor. Names
+     *       must be unique within the graph.
+     *
+     * @param[in] name Name identifying the cut point
+     */
+    void mark_cut_point(const std::string &name);
     /** Adds a tensor to the graph
      *
      * @param[in] tensor Tensor to add
@@ -76,6 +150,127 @@ public:
      * @return Graph hints
      */
     GraphHints &hints();
+    /** Binds a scheduler instance to the graph, used for all its NEON kernels while it runs
+     *
+     * @param[in] scheduler Scheduler to use, nullptr to use the process-wide scheduler
+     */
+    void set_scheduler(arm_compute::IScheduler *scheduler);
+    /** Sets the dispatch priority of the graph's NEON kernels
+     *
+     * While the graph runs, its kernel dispatches carry the given priority on the CPU
+     * scheduler: @ref arm_compute::IScheduler::Priority::Interactive dispatches overtake
+     * work queued by normal-priority graphs sharing the same thread pool, so a
+     * latency-critical graph waits at most for the kernel currently on the pool instead of
+     * another graph's backlog.
+     *
+     * @note Can be changed between runs; it applies from the next call to run().
+     *
+     * @param[in] priority Priority of the graph's kernel dispatches
+     */
+    void set_priority(arm_compute::IScheduler::Priority priority);
+    /** Limits the time the graph may spend producing one frame
+     *
+     * The budget starts when the input accessor delivers a frame. Once it expires the frame
+     * is abandoned: the remaining stages are skipped (a NEON kernel in progress stops at its
+     * next window-chunk boundary), the output accessor is not called, and the run loop
+     * continues with the next frame. Bounds the latency of an interactive path at the cost
+     * of dropping the frames that exceed their budget.
+     *
+     * @note Can be toggled at any time, including between runs. Not applied to pipelined
+     *       execution.
+     *
+     * @param[in] deadline_us Frame budget in microseconds. 0 (default) disables the deadline.
+     */
+    void set_frame_deadline(unsigned int deadline_us);
+    /** Enables pipelined execution for streaming workloads
+     *
+     * The graph is split in two segments at the first target transition (e.g. NEON to OpenCL)
+     * and the boundary tensor is double-buffered: while the second segment processes frame N,
+     * the first segment already processes frame N+1 on another thread, overlapping the NEON
+     * and OpenCL portions of a hybrid graph. Results are identical to sequential execution,
+     * each output is just delivered one run-loop iteration later. Graphs without a target
+     * transition run sequentially as before.
+     *
+     * @note Must be called before the graph is built.
+     *
+     * @param[in] enabled True to run the graph as a two-stage pipeline
+     */
+    void set_pipelining_enabled(bool enabled);
+    /** Splits each batch into sub-batches that run through the graph one at a time
+     *
+     * The pipeline is configured for batch_size / @p num_sub_batches samples and executed
+     * @p num_sub_batches times per run-loop iteration, copying one batch slice in and out at
+     * the graph boundary. The accessors still see the full batch, so feeding code does not
+     * change. Smaller sub-batches shrink the intermediate tensors and the latency to the
+     * first result; the full batch remains the throughput-friendly default.
+     *
+     * @note Must be called before the graph is built, and the input's batch dimension must
+     *       be a multiple of @p num_sub_batches. Cannot be combined with pipelined execution.
+     *
+     * @param[in] num_sub_batches Number of sub-batches to split each batch into
+     */
+    void set_num_sub_batches(unsigned int num_sub_batches);
+    /** Enables readahead of each layer's weights while the preceding layers compute
+     *
+     * Before a stage runs, the graph issues madvise(MADV_WILLNEED) for the weight pages of the
+     * next weight-bearing stage, so the kernel pages them in from storage concurrently with
+     * the current layer's compute. Intended for models whose weights are mapped from a file
+     * (see @ref TensorAllocator::import_memory) and do not all fit in RAM: without the
+     * prefetch, every evicted weight page is faulted in serially when its layer runs,
+     * stalling the whole pipeline on storage latency. The advice is harmless on resident or
+     * anonymous memory, and OpenCL-backed weights are skipped.
+     *
+     * @note Can be toggled at any time, including between runs.
+     *
+     * @param[in] enabled True to prefetch the next layer's weights one stage ahead of their use
+     */
+    void set_weights_prefetch_enabled(bool enabled);
+    /** Enables hybrid precision execution with automatic F16 islands
+     *
+     * While building the graph, a precision-assignment pass runs eligible interior layers in
+     * F16 and inserts depth-convert stages at the island boundaries, halving the memory
+     * bandwidth of the layers inside an island. A layer joins an island when its node type
+     * supports F16 on its target, it is not hinted @ref PrecisionHint::FULL, and the
+     * estimated saving outweighs the boundary conversions; a user-typed intermediate or
+     * output tensor pins the adjacent layer to the tensor's precision. Mark accuracy-critical
+     * nodes (typically the first and last layers) with PrecisionHint::FULL.
+     *
+     * @note Must be called before the graph is built. Weights of layers inside an island are
+     *       declared F16, so their accessors must supply F16 data.
+     * @note On NEON targets islands are only formed when the library is built with
+     *       ARM_COMPUTE_ENABLE_FP16.
+     *
+     * @param[in] enabled True to let the graph form F16 islands
+     */
+    void set_auto_fp16_enabled(bool enabled);
+    /** Enables or disables per-stage profiling
+     *
+     * While enabled, the graph records the wall time of every pipeline stage. OpenCL-target
+     * stages are timed host-side around a command queue synchronization, so their figure
+     * includes the device execution time of the enqueued kernels. When disabled (the
+     * default) the only overhead left in the run loop is a single branch per stage, so
+     * production builds can ship with the instrumentation compiled in.
+     *
+     * @note Can be toggled at any time, including between runs.
+     *
+     * @param[in] enabled True to record per-stage timings
+     */
+    void set_profiling_enabled(bool enabled);
+    /** Returns the accumulated per-stage timings recorded while profiling was enabled
+     *
+     * Stages appear in execution order, identified by their layer type name and output shape.
+     *
+     * @return Per-stage timing report
+     */
+    std::vector<GraphStageProfile> profiling_report() const;
+    /** Writes the recorded stage executions as a chrome://tracing JSON file
+     *
+     * Load the file in a Chromium browser's about://tracing page (or any Trace Event viewer)
+     * to inspect the timeline, including the thread overlap of pipelined graphs.
+     *
+     * @param[in] filename Path of the trace file to write
+     */
+    void dump_trace(const std::string &filename) const;
 
 private:
     class Private;
@@ -114,6 +309,14 @@ Graph &operator<<(Graph &graph, TargetHint target_hint);
  * @return Updated graph
  */
 Graph &operator<<(Graph &graph, ConvolutionMethodHint conv_method_hint);
+/** Overloaded stream operator to provide a precision hint to the graph
+ *
+ * @param[in, out] graph          Graph to provide the hint to
+ * @param[in]      precision_hint Precision hint to be considered
+ *
+ * @return Updated graph
+ */
+Graph &operator<<(Graph &graph, PrecisionHint precision_hint);
 /** Overloaded stream operator to add a node to the graph
  *
  * @param[in, out] graph Graph to add the tensor
@@ -28,6 +28,8 @@
 
 namespace arm_compute
 {
+class IScheduler;
+
 namespace graph
 {
 /** Hints that can be passed to the graph to expose parameterization */
@@ -35,8 +37,9 @@ class GraphHints
 {
 public:
     /** Default Constructor */
-    GraphHints(TargetHint            target_hint      = TargetHint::DONT_CARE,
-               ConvolutionMethodHint conv_method_hint = ConvolutionMethodHint::GEMM);
+    GraphHints(TargetHint            target_hint       = TargetHint::DONT_CARE,
+               ConvolutionMethodHint conv_method_hint  = ConvolutionMethodHint::GEMM,
+               float                 cooperative_ratio = 0.f);
     /** Sets target execution hint
      *
      * @param target_hint Target execution hint
@@ -57,10 +60,56 @@ public:
      * @return convolution method hint
      */
     ConvolutionMethodHint convolution_method_hint() const;
+    /** Sets the share of a layer's output feature maps computed on the GPU when both devices cooperate
+     *
+     * A value in (0, 1) splits eligible layers between an OpenCL enqueue and a NEON schedule
+     * running concurrently; 0 (the default) disables cooperative execution. The ratio is
+     * typically calibrated offline from the relative throughput of the two devices.
+     *
+     * @param[in] cooperative_ratio GPU share of the output feature maps
+     */
+    void set_cooperative_ratio(float cooperative_ratio);
+    /** Returns the GPU share of cooperatively executed layers
+     *
+     * @return Cooperative ratio, 0 if cooperative execution is disabled
+     */
+    float cooperative_ratio() const;
+    /** Sets the precision of intermediate accumulations in kernels that support a precision policy
+     *
+     * Reduced-precision data types accumulate in their own type by default, which is the
+     * bandwidth-friendly choice; @ref AccumulatePrecision::FULL requests at least 32-bit
+     * accumulation for layers whose backend supports it (currently the OpenCL direct convolution).
+     *
+     * @param[in] accumulate_precision Accumulation precision to request
+     */
+    void set_accumulate_precision(AccumulatePrecision accumulate_precision);
+    /** Returns the requested precision of intermediate accumulations
+     *
+     * @return Accumulation precision
+     */
+    AccumulatePrecision accumulate_precision() const;
+    /** Marks the following nodes for the graph's hybrid precision pass
+     *
+     * @ref PrecisionHint::FULL keeps accuracy-critical nodes (typically the first and last
+     * layers of a network) at the graph's full precision; the pass only considers nodes
+     * hinted DONT_CARE (the default) for its F16 islands. Ignored unless
+     * @ref Graph::set_auto_fp16_enabled has been called.
+     *
+     * @param[in] precision_hint Precision hint to be considered
+     */
+    void set_precision_hint(PrecisionHint precision_hint);
+    /** Returns the precision hint
+     *
+     * @return Precision hint
+     */
+    PrecisionHint precision_hint() const;
 
 private:
     TargetHint            _target_hint;             /**< Target execution hint */
     ConvolutionMethodHint _convolution_method_hint; /**< Convolution method hint */
+    float                 _cooperative_ratio;       /**< GPU share of cooperatively executed layers, 0 disables the mode */
+    AccumulatePrecision   _accumulate_precision;    /**< Precision of intermediate accumulations */
+    PrecisionHint         _precision_hint;          /**< Precision hint for the hybrid precision pass */
 };
 
 /** Graph context */
@@ -79,9 +128,24 @@ public:
      * @return Graph hints
      */
     const GraphHints &hints() const;
+    /** Binds a scheduler to the graph
+     *
+     * While the graph executes, the given scheduler (and thus its thread pool) is used for all
+     * the graph's NEON kernels instead of the process-wide one, allowing several graphs to run
+     * truly concurrently on disjoint pools. The caller keeps ownership of the scheduler.
+     *
+     * @param[in] scheduler Scheduler to use, nullptr to use the process-wide scheduler
+     */
+    void set_scheduler(arm_compute::IScheduler *scheduler);
+    /** Returns the scheduler bound to the graph
+     *
+     * @return Bound scheduler, nullptr if none
+     */
+    arm_compute::IScheduler *scheduler() const;
 
 private:
-    GraphHints _hints; /**< Graph hints */
+    GraphHints               _hints;               /**< Graph hints */
+    arm_compute::IScheduler *_scheduler{ nullptr }; /**< Scheduler bound to the graph */
 };
 } // namespace graph
 } // namespace arm_compute
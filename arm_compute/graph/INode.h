@@ -29,6 +29,7 @@
 #include "arm_compute/runtime/IFunction.h"
 
 #include <memory>
+#include <vector>
 
 namespace arm_compute
 {
@@ -49,14 +50,76 @@ public:
     virtual std::unique_ptr<arm_compute::IFunction> instantiate_node(GraphContext &ctx, ITensor *input, ITensor *output) = 0;
     /** Override the existing target hint
      *
-     * @note If the input is DONT_CARE then the method has to pick a technology,
-     *       else it can accept the hint or override it (But not with DONT_CARE)
+     * @note DONT_CARE is passed through: the graph resolves it later with its
+     *       placement cost model, once the node's input shape is known
      *
      * @param[in] target_hint Target hint to be considered
      *
      * @return The updated target hint
      */
     TargetHint override_target_hint(TargetHint target_hint) const;
+    /** Estimated computational cost of the node in operations
+     *
+     * Used by the graph's automatic placement pass to weigh NEON against OpenCL execution.
+     * The default assumes one operation per input element, which fits element-wise layers;
+     * arithmetic-heavy nodes override this with a shape-based estimate.
+     *
+     * @param[in] input Input tensor info of the node
+     *
+     * @return Estimated number of operations per run
+     */
+    virtual float estimated_ops(const TensorInfo &input) const;
+    /** Indicates whether the node can run with output == input
+     *
+     * Element-wise nodes that read and write each element exactly once can execute in-place,
+     * letting the graph reuse the input buffer instead of allocating a separate output.
+     *
+     * @return True if the node supports in-place execution
+     */
+    virtual bool supports_in_place() const;
+    /** Indicates whether the node's backends can run on F16 data
+     *
+     * Queried by the graph's hybrid precision pass (see @ref Graph::set_auto_fp16_enabled)
+     * when it decides which nodes join an F16 island. The default is conservative; node
+     * types whose NEON and OpenCL functions both handle F16 override it.
+     *
+     * @return True if the node can run in F16
+     */
+    virtual bool supports_fp16() const;
+    /** Attempts to absorb the node that follows this one in the graph
+     *
+     * Called by the graph builder before this node is finalized. A node that can execute
+     * the next node's operation as part of its own function (e.g. a convolution applying
+     * the following activation on its output) takes ownership of the operation and returns
+     * true; the graph then drops @p next instead of instantiating it as a separate stage.
+     *
+     * @param[in] next Node that follows this one in the graph
+     *
+     * @return True if @p next has been absorbed into this node
+     */
+    virtual bool try_fuse(INode *next);
+    /** Name of the node's layer type, used by logging and profiling
+     *
+     * @return Layer type name
+     */
+    virtual const char *name() const = 0;
+    /** Releases constant data the node's function no longer reads
+     *
+     * Called by Graph::finalize once every stage has been prepared: constant subexpressions
+     * (weight reshapes, folded parameters) have executed by then and their results are baked
+     * into the functions' own tensors, so nodes can free the original constant inputs.
+     * The default implementation keeps everything.
+     */
+    virtual void release_constant_data();
+    /** Returns the constant tensors (weights, biases) the node's function reads on every run
+     *
+     * Used by the graph's weights prefetch (see @ref Graph::set_weights_prefetch_enabled) to
+     * issue readahead for a layer's weight pages while its predecessor computes. The default
+     * implementation returns no tensors, which fits nodes without constant inputs.
+     *
+     * @return Constant input tensors read at run time
+     */
+    virtual std::vector<ITensor *> retained_constants();
 
 protected:
     /** Interface to be implement that override the hints
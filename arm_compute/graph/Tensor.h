@@ -125,12 +125,22 @@ public:
      * @return Target of the tensor
      */
     TargetHint target() const;
+    /** Makes this tensor an alias of another tensor's backing memory (in-place execution)
+     *
+     * The tensor does not allocate anything of its own; tensor() returns @p other's internal
+     * tensor and allocate() becomes a no-op. Used by the graph to run in-place capable nodes
+     * without a separate output buffer.
+     *
+     * @param[in] other Tensor to share the backing memory of. Must already have a target set and must outlive this tensor.
+     */
+    void share_tensor_of(Tensor &other);
 
 private:
     TargetHint                       _target;   /**< Target that this tensor is pinned on */
     TensorInfo                       _info;     /**< Tensor metadata */
     std::unique_ptr<ITensorAccessor> _accessor; /**< Tensor Accessor */
     std::unique_ptr<ITensor>         _tensor;   /**< Tensor */
+    ITensor                         *_alias{ nullptr }; /**< Borrowed tensor this tensor aliases when running in-place */
 };
 } // namespace graph
 } // namespace arm_compute
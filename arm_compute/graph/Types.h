@@ -41,6 +41,7 @@ using arm_compute::TensorShape;
 using arm_compute::PadStrideInfo;
 using arm_compute::WeightsInfo;
 using arm_compute::ActivationLayerInfo;
+using arm_compute::AccumulatePrecision;
 using arm_compute::NormType;
 using arm_compute::NormalizationLayerInfo;
 using arm_compute::PoolingLayerInfo;
@@ -57,8 +58,17 @@ enum class TargetHint
 /**< Convolution method hint to the graph executor */
 enum class ConvolutionMethodHint
 {
-    GEMM,  /**< Convolution using GEMM */
-    DIRECT /**< Direct convolution */
+    GEMM,     /**< Convolution using GEMM */
+    DIRECT,   /**< Direct convolution */
+    WINOGRAD, /**< Winograd convolution; falls back to GEMM when the layer is not a 3x3 stride-1 F32 convolution */
+    AUTO      /**< Select GEMM or direct per layer from the measured decision table (see @ref ConvolutionMethodTable) */
+};
+
+/**< Precision hint to the graph's hybrid precision pass (see @ref Graph::set_auto_fp16_enabled) */
+enum class PrecisionHint
+{
+    DONT_CARE, /**< The pass may run the node in reduced precision */
+    FULL       /**< Accuracy-critical node: keep the graph's full precision */
 };
 } // namespace graph
 } // namespace arm_compute
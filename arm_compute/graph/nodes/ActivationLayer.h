@@ -43,8 +43,17 @@ public:
      */
     ActivationLayer(const ActivationLayerInfo activation_info);
 
+    /** Returns the node's activation information
+     *
+     * @return The activation layer information
+     */
+    const ActivationLayerInfo &activation_info() const;
+
     // Inherited methods overriden:
     std::unique_ptr<arm_compute::IFunction> instantiate_node(GraphContext &ctx, ITensor *input, ITensor *output) override;
+    const char *name() const override;
+    bool supports_fp16() const override;
+    bool supports_in_place() const override;
 
 private:
     const ActivationLayerInfo _activation_info; /**< Activation layer info */
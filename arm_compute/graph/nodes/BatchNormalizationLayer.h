@@ -47,19 +47,23 @@ public:
      */
     template <typename AccessorType>
     BatchNormalizationLayer(AccessorType &&mean, AccessorType &&var, AccessorType &&gamma, AccessorType &&beta, float epsilon)
-        : _mean(std::move(mean)), _var(std::move(var)), _gamma(std::move(gamma)), _beta(std::move(beta)), _epsilon(epsilon)
+        : _mean(std::move(mean)), _var(std::move(var)), _gamma(std::move(gamma)), _beta(std::move(beta)), _epsilon(epsilon), _fused_act()
     {
     }
 
     // Inherited methods overriden:
     std::unique_ptr<arm_compute::IFunction> instantiate_node(GraphContext &ctx, ITensor *input, ITensor *output) override;
+    const char *name() const override;
+    bool supports_fp16() const override;
+    bool try_fuse(INode *next) override;
 
 private:
-    Tensor _mean;
-    Tensor _var;
-    Tensor _gamma;
-    Tensor _beta;
-    float  _epsilon;
+    Tensor              _mean;
+    Tensor              _var;
+    Tensor              _gamma;
+    Tensor              _beta;
+    float               _epsilon;
+    ActivationLayerInfo _fused_act; /**< Activation absorbed from a following ActivationLayer node */
 };
 } // namespace graph
 } // namespace arm_compute
@@ -69,6 +69,7 @@ public:
           _conv_info(std::move(conv_info)),
           _num_groups(num_groups),
           _weights_info(std::move(weights_info)),
+          _fused_act(),
           _is(nullptr),
           _os(nullptr),
           _ws(nullptr),
@@ -78,6 +79,12 @@ public:
 
     // Inherited methods overriden:
     std::unique_ptr<arm_compute::IFunction> instantiate_node(GraphContext &ctx, ITensor *input, ITensor *output) override;
+    const char *name() const override;
+    bool supports_fp16() const override;
+    bool try_fuse(INode *next) override;
+    float estimated_ops(const TensorInfo &input) const override;
+    void release_constant_data() override;
+    std::vector<ITensor *> retained_constants() override;
 
 private:
     /** Instantiates a non-grouped convolution
@@ -85,19 +92,37 @@ private:
      * @param[in] input            Input tensor
      * @param[in] output           Output tensor
      * @param[in] conv_method_hint Hint that specifies which convolution layer method to use
+     * @param[in] act_info         Activation to fuse in the convolution's output stage
+     * @param[in] acc_precision    Precision of intermediate accumulations, honoured by backends that support a precision policy
      *
      * @return Convolution function
      */
-    std::unique_ptr<arm_compute::IFunction> instantiate_convolution(ITensor *input, ITensor *output, ConvolutionMethodHint conv_method_hint);
+    std::unique_ptr<arm_compute::IFunction> instantiate_convolution(ITensor *input, ITensor *output, ConvolutionMethodHint conv_method_hint, const ActivationLayerInfo &act_info,
+                                                                    AccumulatePrecision acc_precision);
     /** Instantiates a grouped convolution
      *
      * @param[in] input            Input tensor
      * @param[in] output           Output tensor
      * @param[in] conv_method_hint Hint that specifies which convolution layer method to use
+     * @param[in] act_info         Activation to fuse in each group's output stage
+     * @param[in] acc_precision    Precision of intermediate accumulations, honoured by backends that support a precision policy
      *
      * @return Grouped Convolution function
      */
-    std::unique_ptr<arm_compute::IFunction> instantiate_grouped_convolution(ITensor *input, ITensor *output, ConvolutionMethodHint conv_method_hint);
+    std::unique_ptr<arm_compute::IFunction> instantiate_grouped_convolution(ITensor *input, ITensor *output, ConvolutionMethodHint conv_method_hint, const ActivationLayerInfo &act_info,
+                                                                            AccumulatePrecision acc_precision);
+    /** Instantiates a convolution whose output feature maps are split between the GPU and the CPU
+     *
+     * @param[in] input            Input tensor, must be backed by OpenCL memory
+     * @param[in] output           Output tensor, must be backed by OpenCL memory
+     * @param[in] conv_method_hint Hint that specifies which convolution layer method to use
+     * @param[in] act_info         Activation to fuse in both halves' output stages
+     * @param[in] gpu_ofm          Number of output feature maps computed on the GPU, in (0, ofm)
+     *
+     * @return Cooperative convolution function
+     */
+    std::unique_ptr<arm_compute::IFunction> instantiate_cooperative_convolution(ITensor *input, ITensor *output, ConvolutionMethodHint conv_method_hint, const ActivationLayerInfo &act_info,
+                                                                                unsigned int gpu_ofm);
 
 private:
     unsigned int        _conv_width;   /**< Convolution width */
@@ -108,6 +133,8 @@ private:
     const PadStrideInfo _conv_info;    /**< Convolution layer information */
     unsigned int        _num_groups;   /**< Number of groups */
     const WeightsInfo   _weights_info; /**< Convolution layer weights information */
+    ActivationLayerInfo _fused_act;    /**< Activation absorbed from a following ActivationLayer node */
+    arm_compute::IFunction *_conv_function{ nullptr }; /**< Instantiated backend convolution, observed for constant release */
 
     std::unique_ptr<SubTensor[]> _is; /**< Input tensor sub-tensors used for grouped convolution */
     std::unique_ptr<SubTensor[]> _os; /**< Output tensor sub-tensors used for grouped convolution */
@@ -38,6 +38,7 @@ class FloorLayer : public INode
 public:
     // Inherited methods overriden:
     std::unique_ptr<arm_compute::IFunction> instantiate_node(GraphContext &ctx, ITensor *input, ITensor *output) override;
+    const char *name() const override;
 };
 
 } // namespace graph
@@ -51,12 +51,18 @@ public:
 
     // Inherited methods overriden:
     std::unique_ptr<arm_compute::IFunction> instantiate_node(GraphContext &ctx, ITensor *input, ITensor *output) override;
+    const char *name() const override;
+    bool supports_fp16() const override;
+    void release_constant_data() override;
+    std::vector<ITensor *> retained_constants() override;
+    float estimated_ops(const TensorInfo &input) const override;
 
     // Inherited methods overriden:
 private:
     unsigned int _num_neurons; /**< Number of neurons */
     Tensor       _weights;     /**< Weights tensor */
     Tensor       _biases;      /**< Biases tensor */
+    arm_compute::IFunction *_fc_function{ nullptr }; /**< Instantiated backend function, observed for constant release */
 };
 } // namespace graph
 } // namespace arm_compute
@@ -44,6 +44,8 @@ public:
 
     // Inherited methods overriden:
     std::unique_ptr<arm_compute::IFunction> instantiate_node(GraphContext &ctx, ITensor *input, ITensor *output) override;
+    const char *name() const override;
+    bool supports_fp16() const override;
 
 private:
     const NormalizationLayerInfo _norm_info; /**< Normalization layer information */
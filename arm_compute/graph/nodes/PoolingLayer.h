@@ -45,6 +45,9 @@ public:
 
     // Inherited methods overriden:
     std::unique_ptr<arm_compute::IFunction> instantiate_node(GraphContext &ctx, ITensor *input, ITensor *output) override;
+    const char *name() const override;
+    bool supports_fp16() const override;
+    float estimated_ops(const TensorInfo &input) const override;
 
 private:
     const PoolingLayerInfo _pool_info; /**< Pooling layer information */
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_GRAPH_RESIDUAL_LAYER_H__
+#define __ARM_COMPUTE_GRAPH_RESIDUAL_LAYER_H__
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/Types.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Residual connection node
+ *
+ * Runs its input through a branch of sub-nodes and adds the branch output element-wise to
+ * the unmodified input (the identity path), as used by ResNet-style networks:
+ *
+ * @code{.cpp}
+ * graph << ResidualLayer(ConvolutionLayer(...), BatchNormalizationLayer(...));
+ * @endcode
+ *
+ * The branch output must have the same shape as the node input. The whole connection runs
+ * as one pipeline stage and supports in-place execution: the sum can be written straight
+ * into the input buffer, so the identity path costs no extra intermediate tensor.
+ */
+class ResidualLayer final : public INode
+{
+public:
+    /** Default Constructor
+     *
+     * @param[in] branch_nodes Nodes of the non-identity branch, in execution order
+     */
+    template <typename... Ns>
+    ResidualLayer(Ns &&... branch_nodes)
+        : _branch(), _branch_tensors()
+    {
+        _branch.reserve(sizeof...(Ns));
+        int dummy[] = { 0, (_branch.emplace_back(arm_compute::support::cpp14::make_unique<Ns>(std::move(branch_nodes))), 0)... };
+        ARM_COMPUTE_UNUSED(dummy);
+        ARM_COMPUTE_ERROR_ON_MSG(_branch.empty(), "A residual connection needs at least one branch node");
+    }
+
+    // Inherited methods overriden:
+    std::unique_ptr<arm_compute::IFunction> instantiate_node(GraphContext &ctx, ITensor *input, ITensor *output) override;
+    const char *name() const override;
+    bool supports_fp16() const override;
+    bool supports_in_place() const override;
+    float estimated_ops(const TensorInfo &input) const override;
+
+private:
+    std::vector<std::unique_ptr<INode>>  _branch;         /**< Nodes of the non-identity branch */
+    std::vector<std::unique_ptr<Tensor>> _branch_tensors; /**< Intermediate tensors of the branch */
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_GRAPH_RESIDUAL_LAYER_H__ */
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_BATCHPARALLELEXECUTOR_H__
+#define __ARM_COMPUTE_BATCHPARALLELEXECUTOR_H__
+
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/SubTensor.h"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+class IScheduler;
+class ITensor;
+
+/** Executor running copies of a function pipeline over batch slices in parallel.
+ *
+ * Splits a batch-N input (and output) into sub-tensor views along the batch dimension and
+ * configures one instance of the caller's function pipeline per slice. run() then executes
+ * the slices concurrently, one thread per slice, parallelizing across samples instead of
+ * within each kernel — which scales much better when the per-sample tensors are too small
+ * to keep all cores busy through intra-kernel window splitting.
+ *
+ * Every slice beyond the first needs its own @ref IScheduler instance (bound to the slice's
+ * thread via @ref Scheduler::bind_to_thread while it runs): scheduler instances confined to
+ * disjoint cores (see @ref CPPScheduler::set_affinity_policy / set_numa_node) give each slice
+ * a private set of cores and near-linear batch scaling.
+ */
+class BatchParallelExecutor : public IFunction
+{
+public:
+    /** Callback configuring the function pipeline of one slice over its sub-tensor views */
+    using SliceFunctionBuilder = std::function<std::unique_ptr<IFunction>(ITensor *input, ITensor *output)>;
+
+    /** Default constructor */
+    BatchParallelExecutor();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    BatchParallelExecutor(const BatchParallelExecutor &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    BatchParallelExecutor &operator=(const BatchParallelExecutor &) = delete;
+    /** Split the batch into slices and configure one function pipeline per slice.
+     *
+     * The batch dimension is the last dimension of each tensor and must be a multiple of
+     * @p num_slices. The builder is invoked once per slice with the slice's input and output
+     * sub-tensor views and must return the configured pipeline for that slice.
+     *
+     * @param[in]  input                Input tensor holding the full batch.
+     * @param[out] output               Output tensor holding the full batch.
+     * @param[in]  num_slices           Number of batch slices to run in parallel.
+     * @param[in]  build_slice_function Callback configuring one slice's function pipeline.
+     */
+    void configure(ITensor *input, ITensor *output, unsigned int num_slices, const SliceFunctionBuilder &build_slice_function);
+    /** Assign a scheduler instance to a slice.
+     *
+     * The first slice runs on the calling thread and keeps the caller's scheduler unless one
+     * is assigned here; every other slice must be assigned a scheduler before run().
+     * The caller keeps ownership of the scheduler and must keep it alive while the executor runs.
+     *
+     * @param[in] slice     Index of the slice, in [0, num_slices).
+     * @param[in] scheduler Scheduler the slice's pipeline will run on.
+     */
+    void set_slice_scheduler(unsigned int slice, IScheduler *scheduler);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    std::vector<std::unique_ptr<SubTensor>> _slice_inputs;     /**< Per-slice input views */
+    std::vector<std::unique_ptr<SubTensor>> _slice_outputs;    /**< Per-slice output views */
+    std::vector<std::unique_ptr<IFunction>> _slice_functions;  /**< Per-slice function pipelines */
+    std::vector<IScheduler *>               _slice_schedulers; /**< Per-slice scheduler instances, not owned */
+};
+}
+#endif /* __ARM_COMPUTE_BATCHPARALLELEXECUTOR_H__ */
@@ -59,6 +59,10 @@ public:
     std::unique_ptr<IMemoryPool> create_pool(IAllocator *allocator) override;
     bool        are_all_finalized() const override;
     MappingType mapping_type() const override;
+    size_t      total_pool_size() const override;
+    std::vector<size_t> pool_chunk_sizes() const override;
+    size_t total_registered_size() const override;
+    void   print_placement(std::ostream &os) const override;
 
 private:
     /** Update blobs and mappings */
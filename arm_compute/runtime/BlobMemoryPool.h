@@ -75,9 +75,10 @@ private:
     void free_blobs();
 
 private:
-    IAllocator         *_allocator;  /**< Allocator to use for internal allocation */
-    std::vector<void *> _blobs;      /**< Vector holding all the memory blobs */
-    std::vector<size_t> _blob_sizes; /**< Sizes of each blob */
+    IAllocator         *_allocator;        /**< Allocator to use for internal allocation */
+    std::vector<void *> _blobs;            /**< Vector holding all the memory blobs */
+    std::vector<void *> _blob_allocations; /**< Underlying allocations the blobs start inside, offset when @ref MemoryColoring is enabled */
+    std::vector<size_t> _blob_sizes;       /**< Sizes of each blob */
 };
 } // arm_compute
 #endif /* __ARM_COMPUTE_BLOBMEMORYPOOL_H__ */
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLINPUTSTAGE_H__
+#define __ARM_COMPUTE_CLINPUTSTAGE_H__
+
+#include "arm_compute/core/CL/OpenCL.h"
+
+#include <array>
+#include <cstddef>
+
+namespace arm_compute
+{
+class ICLTensor;
+
+/** Double-buffered host-to-device staging for the input tensor of a CL pipeline.
+ *
+ * Mapping a pipeline's input tensor directly stalls the host until the GPU drains the queue.
+ * This helper keeps two host-visible staging buffers: while the GPU computes from the data
+ * copied out of one slot, the host fills the other through a map on a dedicated transfer
+ * queue, so uploads of frame N+1 overlap the compute of frame N.
+ *
+ * @code
+ * CLInputStage input_stage;
+ * input_stage.configure(&input_tensor);
+ * for(...)
+ * {
+ *     void *dst = input_stage.begin_write();
+ *     // fill dst with the next frame
+ *     input_stage.end_write();
+ *     // order the pipeline after input_stage.transfer_event(), then run it
+ * }
+ * @endcode
+ */
+class CLInputStage
+{
+public:
+    /** Default constructor */
+    CLInputStage();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLInputStage(const CLInputStage &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLInputStage &operator=(const CLInputStage &) = delete;
+
+    /** Set the tensor to feed and the transfer queue.
+     *
+     * @param[out] target            Allocated tensor the pipeline reads its input from.
+     * @param[in]  transfer_queue_id (Optional) Scheduler queue used for maps and copies, 1 by
+     *                               default. The scheduler grows its queue set if needed.
+     */
+    void configure(ICLTensor *target, unsigned int transfer_queue_id = 1);
+
+    /** Map the free staging slot for host writing.
+     *
+     * Waits only for the transfer queue to finish the previous copy out of this slot, not for
+     * the compute queue.
+     *
+     * @return Host pointer to fill with the next frame
+     */
+    void *begin_write();
+    /** Unmap the slot and enqueue the staging-to-target copy on the transfer queue. */
+    void end_write();
+    /** Event signalling that the target tensor holds the last written frame.
+     *
+     * Pass it to @ref CLScheduler::enqueue_with_events for the first kernel of the pipeline.
+     *
+     * @return Completion event of the last staging-to-target copy
+     */
+    cl::Event transfer_event() const;
+
+private:
+    ICLTensor *_target;                  /**< Tensor the pipeline reads */
+    std::array<cl::Buffer, 2> _staging;  /**< Host-visible staging slots */
+    std::array<cl::Event, 2>  _copies;   /**< Pending copy out of each slot */
+    cl::Event    _last_copy;             /**< Copy of the most recently written frame */
+    void        *_mapping;               /**< Host pointer of the currently mapped slot */
+    size_t       _size;                  /**< Transfer size in bytes */
+    unsigned int _queue_id;              /**< Scheduler queue the transfers run on */
+    unsigned int _index;                 /**< Slot the next write goes to */
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_CLINPUTSTAGE_H__ */
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLOUTPUTSTAGE_H__
+#define __ARM_COMPUTE_CLOUTPUTSTAGE_H__
+
+#include "arm_compute/core/CL/OpenCL.h"
+
+#include <array>
+#include <cstddef>
+
+namespace arm_compute
+{
+class ICLTensor;
+
+/** Double-buffered device-to-host staging for the output tensor of a CL pipeline.
+ *
+ * Mapping a pipeline's output tensor directly stalls the host until the GPU drains the queue,
+ * then post-processing runs while the GPU idles. This helper snapshots the output into one of
+ * two host-visible staging slots on a dedicated transfer queue, ordered after the compute
+ * already enqueued; the host then maps a completed slot and post-processes frame N while the
+ * main queue computes frame N+1.
+ *
+ * @code
+ * CLOutputStage output_stage;
+ * output_stage.configure(&output_tensor);
+ * for(...)
+ * {
+ *     // run the pipeline for this frame (no sync)
+ *     output_stage.stage();
+ *     // optionally run the next frame's pipeline here
+ *     const void *src = output_stage.begin_read();
+ *     // post-process src
+ *     output_stage.end_read();
+ * }
+ * @endcode
+ */
+class CLOutputStage
+{
+public:
+    /** Default constructor */
+    CLOutputStage();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLOutputStage(const CLOutputStage &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLOutputStage &operator=(const CLOutputStage &) = delete;
+
+    /** Set the tensor to snapshot and the transfer queue.
+     *
+     * @param[in] source            Allocated tensor the pipeline writes its output to.
+     * @param[in] transfer_queue_id (Optional) Scheduler queue used for maps and copies, 1 by
+     *                              default. The scheduler grows its queue set if needed.
+     */
+    void configure(const ICLTensor *source, unsigned int transfer_queue_id = 1);
+
+    /** Snapshot the source tensor into the next staging slot.
+     *
+     * The copy is ordered after everything already enqueued on the compute queue and runs on
+     * the transfer queue, so later kernels overwriting the source can start immediately.
+     * At most two snapshots can be pending before @ref begin_read consumes one.
+     */
+    void stage();
+    /** Map the oldest pending snapshot for host reading.
+     *
+     * Waits only for that snapshot's copy on the transfer queue, not for the compute queue.
+     *
+     * @return Host pointer to the staged output
+     */
+    const void *begin_read();
+    /** Unmap the slot returned by @ref begin_read, making it available for staging again. */
+    void end_read();
+
+private:
+    const ICLTensor *_source;            /**< Tensor the pipeline writes */
+    std::array<cl::Buffer, 2> _staging;  /**< Host-visible staging slots */
+    std::array<cl::Event, 2>  _copies;   /**< Pending copy into each slot */
+    void        *_mapping;               /**< Host pointer of the currently mapped slot */
+    size_t       _size;                  /**< Transfer size in bytes */
+    unsigned int _queue_id;              /**< Scheduler queue the transfers run on */
+    unsigned int _write_index;           /**< Slot the next snapshot goes to */
+    unsigned int _read_index;            /**< Slot the next read comes from */
+    unsigned int _num_staged;            /**< Number of pending snapshots */
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_CLOUTPUTSTAGE_H__ */
@@ -32,6 +32,8 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/CL/CLTuner.h"
 
+#include <vector>
+
 #if defined(ARM_COMPUTE_DEBUG_ENABLED)
 namespace
 {
@@ -96,6 +98,22 @@ public:
      */
     void enqueue(ICLKernel &kernel, bool flush = true);
 
+    /** Schedule the execution of the passed kernel in several separately enqueued chunks.
+     *
+     * The kernel's execution window is split along its outermost non-trivial dimension into
+     * @p num_chunks sub-windows, each enqueued and flushed on its own. The flush between chunks
+     * is the yield point: the driver submits every chunk as an independent batch, so other work
+     * sharing the GPU (typically the display pipeline) can be scheduled between chunks instead
+     * of waiting out one monolithic NDRange, and no single job runs long enough to trip the GPU
+     * watchdog on very large tensors. Chunks of one kernel remain ordered by the in-order queue,
+     * so the result is identical to a single enqueue.
+     *
+     * @param[in] kernel     Kernel to execute.
+     * @param[in] num_chunks Number of chunks to split the execution into. 1 behaves like enqueue().
+     * @param[in] flush      (Optional) Specifies if the command queue will be flushed after the last chunk.
+     */
+    void enqueue_chunked(ICLKernel &kernel, unsigned int num_chunks, bool flush = true);
+
     /** Initialises the context and command queue to be used by the scheduler.
      *
      * @param[in] context  A CL context.
@@ -143,6 +161,81 @@ public:
         return _queue;
     }
 
+    /** Sets the number of command queues available for concurrent kernel submission.
+     *
+     * Queue 0 is the default queue; the additional queues are created in-order on the same
+     * context and device. Independent branches of a graph enqueued on different queues can
+     * overlap on GPUs able to run multiple kernels concurrently, instead of serializing on
+     * the single default queue.
+     *
+     * @param[in] num_queues Total number of queues (minimum 1).
+     */
+    void set_num_queues(unsigned int num_queues)
+    {
+        ARM_COMPUTE_ERROR_ON(!_is_initialised);
+        ARM_COMPUTE_ERROR_ON(num_queues == 0);
+        const auto devices = _context.getInfo<CL_CONTEXT_DEVICES>();
+        while(_extra_queues.size() + 1 < num_queues)
+        {
+            _extra_queues.emplace_back(_context, devices[0]);
+        }
+        _extra_queues.resize(num_queues - 1, cl::CommandQueue());
+    }
+
+    /** Returns the number of command queues available for concurrent kernel submission.
+     *
+     * @return Number of available queues.
+     */
+    unsigned int num_queues() const
+    {
+        return _extra_queues.size() + 1;
+    }
+
+    /** Accessor for one of the scheduler's command queues.
+     *
+     * @param[in] queue_id Id of the queue to access, in [0, num_queues()). Id 0 is the default queue.
+     *
+     * @return The requested CL command queue.
+     */
+    cl::CommandQueue &queue(unsigned int queue_id)
+    {
+        ARM_COMPUTE_ERROR_ON(!_is_initialised);
+        ARM_COMPUTE_ERROR_ON(queue_id >= num_queues());
+        return (queue_id == 0) ? _queue : _extra_queues[queue_id - 1];
+    }
+
+    /** Schedule the execution of the passed kernel after the given events complete and return its completion event.
+     *
+     * The kernel is ordered after every event of @p wait_list (which may come from other queues
+     * or from enqueue_sync_event()) and the returned event signals its completion, so stages of
+     * a pipeline can be chained without a whole-queue clFinish and the host thread stays free.
+     *
+     * @param[in] kernel    Kernel to execute.
+     * @param[in] wait_list Events that must complete before the kernel starts. Can be empty.
+     * @param[in] flush     (Optional) Specifies if the command queue will be flushed after running the kernel.
+     *
+     * @return An event which completes once the kernel has finished executing.
+     */
+    cl::Event enqueue_with_events(ICLKernel &kernel, const std::vector<cl::Event> &wait_list, bool flush = true);
+
+    /** Schedule the execution of the passed kernel on a specific command queue.
+     *
+     * @param[in] kernel   Kernel to execute.
+     * @param[in] queue_id Id of the queue to submit the kernel to, in [0, num_queues()).
+     * @param[in] flush    (Optional) Specifies if the command queue will be flushed after running the kernel.
+     */
+    void enqueue_on(ICLKernel &kernel, unsigned int queue_id, bool flush = true);
+
+    /** Blocks until all commands in every command queue have finished. */
+    void sync_all()
+    {
+        for(auto &q : _extra_queues)
+        {
+            q.finish();
+        }
+        _queue.finish();
+    }
+
     /** Get the target GPU.
      *
      * @return The target GPU.
@@ -199,11 +292,12 @@ private:
      */
     cl::NDRange tune_kernel(ICLKernel &kernel);
 
-    cl::Context      _context;
-    cl::CommandQueue _queue;
-    GPUTarget        _target;
-    bool             _is_initialised;
-    ICLTuner        *_cl_tuner;
+    cl::Context                   _context;
+    cl::CommandQueue              _queue;
+    std::vector<cl::CommandQueue> _extra_queues;
+    GPUTarget                     _target;
+    bool                          _is_initialised;
+    ICLTuner                     *_cl_tuner;
 };
 }
 #endif /* __ARM_COMPUTE_CLSCHEDULER_H__ */
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLSTAGINGBUFFERPOOL_H__
+#define __ARM_COMPUTE_CLSTAGINGBUFFERPOOL_H__
+
+#include "arm_compute/core/CL/OpenCL.h"
+#include "arm_compute/runtime/CL/CLBufferAllocator.h"
+#include "support/Mutex.h"
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+namespace arm_compute
+{
+class ICLTensor;
+
+/** Pool of pinned staging buffers for repeated host<->device tensor transfers.
+ *
+ * Updating a device tensor every frame either maps it (stalling the host behind the compute
+ * queue) or stages the data through a transient host buffer allocated per transfer. This pool
+ * keeps CL_MEM_ALLOC_HOST_PTR buffers (allocated through @ref CLBufferAllocator) alive between
+ * transfers, recycled by power-of-two size class, so the copies run out of DMA-friendly pinned
+ * memory without any per-frame allocation.
+ *
+ * Writes are asynchronous: the host data is memcpy'd into a pinned buffer, the device copy is
+ * enqueued, and the buffer returns to the pool once the copy has completed. For tensors bound
+ * to a fixed pipeline slot @ref CLInputStage remains the better fit; this pool serves transfers
+ * whose target or size varies between frames.
+ */
+class CLStagingBufferPool
+{
+public:
+    /** Default constructor: the pool allocates from the scheduler's context */
+    CLStagingBufferPool();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLStagingBufferPool(const CLStagingBufferPool &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLStagingBufferPool &operator=(const CLStagingBufferPool &) = delete;
+    /** Destructor: releases the pooled buffers. Pending copies must have completed */
+    ~CLStagingBufferPool();
+
+    /** Copy host data into a device tensor through a pinned staging buffer.
+     *
+     * The copy is enqueued asynchronously on the scheduler's queue: the host buffer may be
+     * reused as soon as this call returns, and kernels enqueued afterwards on the same queue
+     * see the updated tensor. The staging buffer is recycled once the copy has completed.
+     *
+     * @param[out] tensor Allocated tensor to update.
+     * @param[in]  src    Host data to copy.
+     * @param[in]  size   Number of bytes to copy.
+     *
+     * @return Completion event of the device copy
+     */
+    cl::Event enqueue_write(ICLTensor &tensor, const void *src, size_t size);
+
+    /** Copy a device tensor into host memory through a pinned staging buffer.
+     *
+     * Blocks until the data has arrived in @p dst.
+     *
+     * @param[in]  tensor Allocated tensor to read.
+     * @param[out] dst    Host destination.
+     * @param[in]  size   Number of bytes to copy.
+     */
+    void read(ICLTensor &tensor, void *dst, size_t size);
+
+    /** Release every idle pooled buffer. Buffers of in-flight copies are kept */
+    void clear();
+
+private:
+    /** Take a pinned buffer of the given size class from the free list, allocating on miss */
+    cl_mem acquire(size_t size_class);
+    /** Return the buffers of completed copies to their free lists. Must be called with the lock held */
+    void recycle_completed();
+    /** Smallest power-of-two size class holding @p size bytes */
+    static size_t size_class_for(size_t size);
+
+    /** An in-flight copy and the staging buffer it borrows */
+    struct PendingCopy
+    {
+        cl_mem    buffer;     /**< Borrowed staging buffer */
+        size_t    size_class; /**< Free list the buffer returns to */
+        cl::Event copy_done;  /**< Completion event of the copy */
+    };
+
+    CLBufferAllocator                     _allocator;    /**< Allocator providing the pinned buffers */
+    std::map<size_t, std::vector<cl_mem>> _free_buffers; /**< Idle buffers keyed by size class */
+    std::vector<PendingCopy>              _pending;      /**< Buffers borrowed by in-flight copies */
+    arm_compute::Mutex                    _mutex;        /**< Protects the free lists and pending copies */
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_CLSTAGINGBUFFERPOOL_H__ */
@@ -78,6 +78,39 @@ public:
      */
     void unmap(cl::CommandQueue &q, uint8_t *mapping);
 
+    /** Import an existing host buffer as the tensor's backing memory.
+     *
+     * The buffer is wrapped with CL_MEM_USE_HOST_PTR: on shared-memory GPUs (e.g. Mali) the
+     * device accesses the caller's memory directly and map() returns the same pointer, so
+     * feeding externally produced data (camera frames) needs no clEnqueueWriteBuffer copy.
+     *
+     * @note The tensor must not already be allocated and must not belong to a memory group.
+     *
+     * @param[in] ptr Host buffer of at least TensorInfo::total_size() bytes. Must satisfy the
+     *                device's base address alignment and outlive the tensor's allocation.
+     */
+    void import_memory(void *ptr);
+
+    /** Import a dma-buf (e.g. ION/gralloc) buffer as the tensor's backing memory.
+     *
+     * The buffer is wrapped through the cl_arm_import_memory extension, so camera or video
+     * frames delivered as dma-buf handles are consumed by the CL pipeline without a CPU
+     * map-and-copy. The import neither duplicates nor closes the descriptor: the caller keeps
+     * ownership of it and must keep the underlying buffer alive until the tensor is freed.
+     *
+     * @note The tensor must not already be allocated and must not belong to a memory group.
+     * @note Only available on drivers exporting cl_arm_import_memory, see @ref dma_buf_import_supported.
+     *
+     * @param[in] fd dma-buf file descriptor of a buffer of at least TensorInfo::total_size() bytes.
+     */
+    void import_dma_buf(int fd);
+
+    /** Check whether the OpenCL driver supports importing dma-buf buffers
+     *
+     * @return True if the driver exports the cl_arm_import_memory entry point
+     */
+    static bool dma_buf_import_supported();
+
     /** Allocate size specified by TensorInfo of OpenCL memory.
      *
      * @note: The tensor must not already be allocated when calling this function.
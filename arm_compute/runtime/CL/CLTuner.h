@@ -27,6 +27,7 @@
 #include "arm_compute/core/CL/OpenCL.h"
 #include "arm_compute/runtime/CL/ICLTuner.h"
 
+#include <string>
 #include <unordered_map>
 
 namespace arm_compute
@@ -55,6 +56,26 @@ public:
      */
     const std::unordered_map<std::string, cl::NDRange> &export_lws_table();
 
+    /** Save the LWS table to a file
+     *
+     * Tuning is then paid once per device: a subsequent run can restore the table with
+     * load_from_file() instead of brute-forcing every kernel again. The same mechanism can ship
+     * a pre-tuned database with the application, one file per GPU target.
+     *
+     * @param[in] filename File to write the table to
+     *
+     * @return True if the table was successfully written
+     */
+    bool save_to_file(const std::string &filename) const;
+
+    /** Load the LWS table from a file, replacing the current table
+     *
+     * @param[in] filename File to read the table from, as written by save_to_file()
+     *
+     * @return True if the table was successfully read
+     */
+    bool load_from_file(const std::string &filename);
+
     // Inherited methods overridden:
     void tune_kernel(ICLKernel &kernel) override;
 
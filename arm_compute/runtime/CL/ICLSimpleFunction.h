@@ -29,6 +29,7 @@
 #include "arm_compute/runtime/IFunction.h"
 
 #include <memory>
+#include <vector>
 
 namespace arm_compute
 {
@@ -42,9 +43,32 @@ public:
     // Inherited methods overridden:
     void run() override final;
 
+    /** Run the function after the given events complete and return its completion event.
+     *
+     * Unlike run(), no implicit queue synchronization is required afterwards: the caller chains
+     * further functions or host work on the returned event, enabling frame pipelining.
+     *
+     * @param[in] wait_list Events that must complete before the function starts. Can be empty.
+     *
+     * @return An event which completes once the function has finished executing.
+     */
+    cl::Event run_async(const std::vector<cl::Event> &wait_list = {});
+
+    /** Sets the number of chunks the function's kernel is enqueued in.
+     *
+     * With more than one chunk the kernel's NDRange is split into that many separately
+     * enqueued and flushed slices (see @ref CLScheduler::enqueue_chunked), so a long-running
+     * kernel on a very large tensor shares the GPU with concurrent work such as rendering
+     * instead of monopolising it for the whole range.
+     *
+     * @param[in] num_chunks Number of chunks to enqueue (default 1: a single enqueue).
+     */
+    void set_chunking(unsigned int num_chunks);
+
 protected:
     std::unique_ptr<ICLKernel> _kernel;         /**< Kernel to run */
     CLFillBorderKernel         _border_handler; /**< Kernel to handle  borders */
+    unsigned int               _num_chunks;     /**< Number of separately enqueued chunks */
 };
 }
 #endif /*__ARM_COMPUTE_ICLSIMPLEFUNCTION_H__ */
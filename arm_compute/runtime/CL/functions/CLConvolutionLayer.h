@@ -27,6 +27,7 @@
 #include "arm_compute/runtime/IFunction.h"
 
 #include "arm_compute/core/CL/kernels/CLCol2ImKernel.h"
+#include "arm_compute/core/CL/kernels/CLDirectConvolutionLayerKernel.h"
 #include "arm_compute/core/CL/kernels/CLFillBorderKernel.h"
 #include "arm_compute/core/CL/kernels/CLGEMMInterleave4x4Kernel.h"
 #include "arm_compute/core/CL/kernels/CLGEMMMatrixMultiplyKernel.h"
@@ -81,6 +82,10 @@ private:
  * -# @ref CLGEMMInterleave4x4Kernel
  * -# @ref CLGEMMMatrixMultiplyKernel
  * -# @ref CLCol2ImKernel
+ *
+ * 1x1 stride-1 convolutions are a plain matrix multiply that needs no im2col: they run through
+ * a single @ref CLDirectConvolutionLayerKernel, which reads the input in place and uses the
+ * weights as they come, with no reshape and no intermediate tensors.
  */
 class CLConvolutionLayer : public IFunction
 {
@@ -99,11 +104,24 @@ public:
      * @param[in]  conv_info    Contains padding and stride information described in @ref PadStrideInfo.
      * @param[in]  weights_info Specifies if the weights tensor has been reshaped with NEWeightsReshapeKernel. If this is not part of the fully connected layer the weights
      *                          tensor has also been transposed with NEGEMMTranspose1xWKernel. Data type supported: Same as @p input.
+     * @param[in]  act_info     (Optional) Activation to fuse into the matrix multiply kernel, saving the DDR round-trip of a separate @ref CLActivationLayer pass.
+     *                          Only RELU, BOUNDED_RELU and LEAKY_RELU on F16/F32 can be fused.
+     * @param[in]  dilation     (Optional) Dilation of the convolution: spacing between the kernel taps, as used by atrous convolutions.
      */
-    void configure(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info = WeightsInfo());
+    void configure(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info = WeightsInfo(),
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo(), const Size2D &dilation = Size2D(1U, 1U));
 
     // Inherited methods overridden:
     void run() override;
+    void prepare() override;
+    /** Indicates whether the function still reads the caller's weights tensor after @ref prepare
+     *
+     * When false, the weights have been baked into the function's own reshaped tensor and the
+     * caller may free the original weights once every function sharing them has been prepared.
+     *
+     * @return True if the original weights are still read at run time
+     */
+    bool original_weights_retained() const;
 
 private:
     CLMemoryGroup                    _memory_group;
@@ -111,6 +129,7 @@ private:
     CLIm2ColKernel                   _input_im2col_kernel;
     CLGEMMInterleave4x4Kernel        _input_interleave_kernel;
     CLGEMMMatrixMultiplyKernel       _mm_kernel;
+    CLDirectConvolutionLayerKernel   _direct_conv_kernel;
     CLCol2ImKernel                   _output_col2im_kernel;
     CLTensor                         _input_im2col_reshaped;
     CLTensor                         _input_interleaved_reshaped;
@@ -120,6 +139,8 @@ private:
     bool                             _has_bias;
     bool                             _is_fully_connected_convolution;
     bool                             _are_weights_reshaped;
+    bool                             _run_direct_convolution;
+    bool                             _original_weights_retained;
 };
 }
 #endif /* __ARM_COMPUTE_CLCONVOLUTIONLAYER_H__ */
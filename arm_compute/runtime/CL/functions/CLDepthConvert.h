@@ -50,10 +50,11 @@ public:
      *   - S16 -> U8, U32, S32
      *   - U32 -> U8, U16, S16
      *   - S32 -> U8, U16, S16
-     *   - F32 -> QS8, QS16
+     *   - F16 -> F32
+     *   - F32 -> QS8, QS16, F16
      *
-     * @param[in]  input  The input tensor to convert. Data types supported: QS8/U8/U16/S16/Q16/U32/S32/F32.
-     * @param[out] output The output tensor. Data types supported: QS8/U8/U16/S16/QS16/U32/S32/F32.
+     * @param[in]  input  The input tensor to convert. Data types supported: QS8/U8/U16/S16/Q16/U32/S32/F16/F32.
+     * @param[out] output The output tensor. Data types supported: QS8/U8/U16/S16/QS16/U32/S32/F16/F32.
      * @param[in]  policy Conversion policy.
      * @param[in]  shift  Value for down/up conversions. Must be 0 <= shift < 8.
      *                    It is not used on fixed point conversion.
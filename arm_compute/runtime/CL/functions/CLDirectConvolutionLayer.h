@@ -51,8 +51,13 @@ public:
      * @param[out] output    Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
      *                       Data types supported: Same as @p input.
      * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  act_info  (Optional) Activation to fuse into the convolution kernel, saving the DDR round-trip of a separate @ref CLActivationLayer pass.
+     *                       Only RELU, BOUNDED_RELU and LEAKY_RELU on F16/F32 can be fused.
+     * @param[in]  acc_precision (Optional) Precision of the intermediate accumulation. F16 accumulates in F16 by default;
+     *                       @ref AccumulatePrecision::FULL accumulates in F32 instead (1x1 and 3x3 kernels only).
      */
-    void configure(ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info);
+    void configure(ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info = ActivationLayerInfo(),
+                   AccumulatePrecision acc_precision = AccumulatePrecision::REDUCED);
 
     // Inherited methods overridden:
     void run() override;
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLELEMENTWISECHAIN_H__
+#define __ARM_COMPUTE_CLELEMENTWISECHAIN_H__
+
+#include "arm_compute/core/CL/kernels/CLElementWiseChainKernel.h"
+#include "arm_compute/runtime/CL/ICLSimpleFunction.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+class ICLTensor;
+
+/** Basic function to run @ref CLElementWiseChainKernel
+ *
+ * Fuses a chain of element-wise operations into one kernel generated and compiled at configure
+ * time, e.g. multiply, add and an activation become a single traversal of the tensors instead
+ * of three kernel launches with full tensor round-trips.
+ */
+class CLElementWiseChain : public ICLSimpleFunction
+{
+public:
+    /** Initialise the function's inputs, output and operation chain.
+     *
+     * @param[in]  inputs   Input tensors, one more than there are operations; all of the same
+     *                      shape. Data types supported: F16/F32 (all matching).
+     * @param[out] output   The output tensor. Data type supported: same as the inputs.
+     * @param[in]  ops      Operations folding each input after the first into the accumulator.
+     * @param[in]  act_info (Optional) Activation applied to the result before storing.
+     */
+    void configure(const std::vector<const ICLTensor *> &inputs, ICLTensor *output, const std::vector<ElementWiseOp> &ops, const ActivationLayerInfo &act_info = ActivationLayerInfo());
+};
+}
+#endif /* __ARM_COMPUTE_CLELEMENTWISECHAIN_H__ */
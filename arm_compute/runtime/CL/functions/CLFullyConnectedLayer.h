@@ -79,6 +79,15 @@ public:
 
     //Inherited methods override
     void run() override;
+    void prepare() override;
+    /** Indicates whether the function still reads the caller's weights tensor after @ref prepare
+     *
+     * When false, the weights have been baked into the function's own reshaped tensor and the
+     * caller may free the original weights once every function sharing them has been prepared.
+     *
+     * @return True if the original weights are still read at run time
+     */
+    bool original_weights_retained() const;
 
 private:
     void configure_fc_fc(const ICLTensor *input, const ICLTensor *weights, ICLTensor *output);
@@ -94,6 +103,7 @@ private:
     bool                                _are_weights_reshaped;
     bool                                _is_fc_after_conv;
     bool                                _accumulate_biases;
+    bool                                _original_weights_retained;
 };
 }
 #endif /* __ARM_COMPUTE_CLFULLYCONNECTEDLAYER_H__ */
@@ -29,6 +29,7 @@
 #include "arm_compute/core/CL/kernels/CLGEMMMatrixAdditionKernel.h"
 #include "arm_compute/core/CL/kernels/CLGEMMMatrixMultiplyKernel.h"
 #include "arm_compute/core/CL/kernels/CLGEMMTranspose1xWKernel.h"
+#include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/CL/CLMemoryGroup.h"
 #include "arm_compute/runtime/CL/CLTensor.h"
 #include "arm_compute/runtime/IFunction.h"
@@ -61,14 +62,16 @@ public:
      *
      * @note Whilst the first input tensor can be a vector, the second input tensor must be at least a matrix
      *
-     * @param[in]  a      First input tensor  (Matrix or Vector A). Data types supported: QS8/QS16/F16/F32
-     * @param[in]  b      Second input tensor (Matrix B). Data type supported: same as @p a.
-     * @param[in]  c      Third input tensor  (Matrix C). It can be a nullptr if just the multiplication between @p a and @p b is needed. Data type supported: same as @p a.
-     * @param[out] output Output tensor. Data type supported: same as @p a
-     * @param[in]  alpha  Weight of the matrix product
-     * @param[in]  beta   Weight of matrix C
+     * @param[in]  a        First input tensor  (Matrix or Vector A). 3 dimensions denote a batch of multiplications. Data types supported: QS8/QS16/F16/F32
+     * @param[in]  b        Second input tensor (Matrix B). Can be 2D (shared across the batch) or batched like @p a. Data type supported: same as @p a.
+     * @param[in]  c        Third input tensor  (Matrix C). It can be a nullptr if just the multiplication between @p a and @p b is needed. Data type supported: same as @p a.
+     * @param[out] output   Output tensor. Data type supported: same as @p a
+     * @param[in]  alpha    Weight of the matrix product
+     * @param[in]  beta     Weight of matrix C
+     * @param[in]  act_info (Optional) Activation to fuse into the matrix multiply kernel, saving the DDR round-trip of a separate @ref CLActivationLayer pass.
+     *                      Only RELU, BOUNDED_RELU and LEAKY_RELU on F16/F32 can be fused, and not together with the addition of matrix C.
      */
-    void configure(const ICLTensor *a, const ICLTensor *b, const ICLTensor *c, ICLTensor *output, float alpha, float beta);
+    void configure(const ICLTensor *a, const ICLTensor *b, const ICLTensor *c, ICLTensor *output, float alpha, float beta, const ActivationLayerInfo &act_info = ActivationLayerInfo());
 
     // Inherited methods overridden:
     void run() override;
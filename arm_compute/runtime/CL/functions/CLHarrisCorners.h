@@ -37,6 +37,7 @@
 #include "arm_compute/runtime/IMemoryManager.h"
 
 #include <cstdint>
+#include <atomic>
 #include <memory>
 
 namespace arm_compute
@@ -99,7 +100,7 @@ private:
     CLImage                             _score;                 /**< Source image - Harris score */
     CLImage                             _nonmax;                /**< Source image - Non-Maxima suppressed image */
     std::unique_ptr<InternalKeypoint[]> _corners_list;          /**< Array of InternalKeypoint. It stores the potential corner candidates */
-    int32_t                             _num_corner_candidates; /**< Number of potential corner candidates */
+    std::atomic<int32_t>                _num_corner_candidates; /**< Number of potential corner candidates */
     ICLKeyPointArray                   *_corners;               /**< Output corners array */
 };
 }
@@ -39,6 +39,7 @@ public:
      *
      * @param[in]  input1          First tensor input. Data types supported: U8, S16, F16 or F32.
      * @param[in]  input2          Second tensor input. Data types supported: U8, S16, F16 or F32.
+     * @note This function can run in-place: @p output may be the same tensor as @p input1 or @p input2 (for matching data types).
      * @param[out] output          Output tensor. Data types supported: U8(Only if both inputs are U8), S16, F16 or F32.
      * @param[in]  scale           Scale to apply after multiplication. Must be positive.
      * @param[in]  overflow_policy Overflow policy. Supported overflow policies: Wrap, Saturate
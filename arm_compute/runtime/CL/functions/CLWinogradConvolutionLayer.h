@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLWINOGRADCONVOLUTIONLAYER_H__
+#define __ARM_COMPUTE_CLWINOGRADCONVOLUTIONLAYER_H__
+
+#include "arm_compute/core/CL/kernels/CLFillBorderKernel.h"
+#include "arm_compute/core/CL/kernels/CLWinogradConvolutionLayerKernel.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/CL/CLMemoryGroup.h"
+#include "arm_compute/runtime/CL/CLTensor.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ICLTensor;
+
+/** Basic function to execute a Winograd F(2x2,3x3) convolution.
+ *
+ * For 3x3 stride-1 layers the Winograd algorithm computes each 2x2 output block with 16
+ * multiplies instead of the 36 of the direct method, a 2.25x reduction. This function calls
+ * the following OpenCL kernels:
+ *
+ * -# @ref CLFillBorderKernel (zero-pads the input for the tile reads)
+ * -# @ref CLWinogradFilterTransformKernel (once, on the first run)
+ * -# @ref CLWinogradInputTransformKernel
+ * -# @ref CLWinogradBatchedGEMMKernel
+ * -# @ref CLWinogradOutputTransformKernel
+ */
+class CLWinogradConvolutionLayer : public IFunction
+{
+public:
+    /** Default constructor */
+    CLWinogradConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input     Source tensor. 3 lower dimensions represent a single input [width, height, IFM]. Data types supported: F32.
+     * @param[in]  weights   Weights tensor. Weights are 4D tensor with dimensions [3, 3, IFM, OFM]. Data type supported: same as @p input.
+     * @param[in]  biases    Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Can be nullptr. Data type supported: same as @p input.
+     * @param[out] output    Destination tensor. 3 lower dimensions represent a single output [width, height, OFM]. Data types supported: same as @p input.
+     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo. Only stride 1 and padding of at most 1 are supported.
+     */
+    void configure(ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info);
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    CLMemoryGroup                   _memory_group;
+    CLFillBorderKernel              _border_handler;
+    CLWinogradInputTransformKernel  _input_transform;
+    CLWinogradFilterTransformKernel _filter_transform;
+    CLWinogradBatchedGEMMKernel     _batched_gemm;
+    CLWinogradOutputTransformKernel _output_transform;
+    CLTensor                        _input_transformed;
+    CLTensor                        _filter_transformed;
+    CLTensor                        _batched_gemm_output;
+    bool                            _is_first_run;
+};
+}
+#endif /* __ARM_COMPUTE_CLWINOGRADCONVOLUTIONLAYER_H__ */
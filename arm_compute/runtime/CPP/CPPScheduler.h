@@ -26,16 +26,37 @@
 
 #include "arm_compute/runtime/IScheduler.h"
 
+#include <functional>
 #include <list>
+#include <memory>
 
 namespace arm_compute
 {
+class AsyncKernelQueue;
+class PoolGate;
 class Thread;
 
 /** C++11 implementation of a pool of threads to automatically split a kernel's execution among several threads. */
 class CPPScheduler : public IScheduler
 {
 public:
+    /** Constructor: create an independent scheduler instance with its own pool of threads.
+     *
+     * Independent instances allow concurrent pipelines to run on disjoint pools (combined with
+     * set_affinity_policy() each pool can also be confined to its own cores) instead of
+     * serializing on the process-wide singleton returned by get().
+     *
+     * @param[in] num_threads If set to 0, the maximum number of threads supported by C++11 will be used, otherwise the number of threads specified.
+     */
+    explicit CPPScheduler(unsigned int num_threads = 0);
+
+    /** Strategy used to distribute a kernel's execution window across the thread pool. */
+    enum class Mode
+    {
+        Static,      /**< Split the window into one equally sized chunk per thread. */
+        WorkStealing /**< Split the window into one chunk per thread but let idle threads steal the chunks other threads have not started yet. */
+    };
+
     /** Sets the number of threads the scheduler will use to run the kernels.
      *
      * @param[in] num_threads If set to 0, then the maximum number of threads supported by C++11 will be used, otherwise the number of threads specified.
@@ -47,6 +68,45 @@ public:
      */
     unsigned int num_threads() const override;
 
+    /** Sets the strategy used to distribute the execution window across the threads.
+     *
+     * With Mode::Static each thread receives a single equally sized chunk: on asymmetric systems
+     * (e.g. big.LITTLE) the whole kernel is then gated by the slowest core.
+     * With Mode::WorkStealing the chunks are claimed dynamically instead: a thread which finishes
+     * early (or a delayed thread's chunk) is picked up by whichever thread is idle, so a stalled
+     * worker never leaves part of the window waiting on it.
+     *
+     * Both modes honour the same kernel-facing contract: each chunk executes exactly once as its
+     * own logical thread, with a distinct ThreadInfo::thread_id, num_threads equal to the number
+     * of run() calls made and a private scratch arena. Kernels which stripe work by thread id or
+     * count run() arrivals therefore behave identically in either mode.
+     *
+     * @param[in] mode Scheduling mode to use.
+     */
+    void set_mode(Mode mode);
+    /** Returns the scheduling mode currently in use.
+     *
+     * @return The scheduling mode.
+     */
+    Mode mode() const;
+
+    /** Confines the pool to a NUMA node: every worker thread is pinned to one of the node's cores.
+     *
+     * On multi-socket parts this keeps a pool's memory traffic node-local; one scheduler
+     * instance per socket (see the public constructor) together with node-bound allocations
+     * (Allocator) gives each socket's threads node-local operand slices. Overrides any
+     * previously applied affinity policy. Pass -1 to undo the confinement.
+     *
+     * @param[in] numa_node Node to confine the pool to, -1 to unpin.
+     */
+    void set_numa_node(int numa_node);
+
+    /** Sets the policy used to place the worker threads on the CPU cores and (re)pins the pool accordingly.
+     *
+     * @param[in] policy Affinity policy to apply to the worker threads.
+     */
+    void set_affinity_policy(AffinityPolicy policy) override;
+
     /** Access the scheduler singleton
      *
      * @return The scheduler
@@ -62,13 +122,95 @@ public:
      * @param[in] split_dimension Dimension along which to split the kernel's execution window.
      */
     void schedule(ICPPKernel *kernel, unsigned int split_dimension) override;
+    /** Multithread the execution of the passed kernel over a 2D grid of window tiles.
+     *
+     * The thread count is factorized into an MxN grid which maximizes the number of busy
+     * threads given the iteration counts of the two dimensions, so kernels where a single
+     * dimension is shorter than the thread count can still use the whole pool.
+     *
+     * @param[in] kernel            Kernel to execute.
+     * @param[in] split_dimension_0 First dimension along which to split the kernel's execution window.
+     * @param[in] split_dimension_1 Second dimension along which to split the kernel's execution window.
+     */
+    void schedule(ICPPKernel *kernel, unsigned int split_dimension_0, unsigned int split_dimension_1) override;
+    /** Queues the kernel on the dispatcher thread and returns immediately.
+     *
+     * Queued kernels are executed in submission order on the same thread pool as schedule();
+     * synchronous schedule() calls drain the queue first, so the two can be freely mixed.
+     *
+     * @param[in] kernel          Kernel to execute.
+     * @param[in] split_dimension Dimension along which to split the kernel's execution window.
+     * @param[in] dependencies    Tickets of previously submitted kernels this kernel depends on.
+     *
+     * @return Ticket which can be waited on or passed as a dependency of a later submission.
+     */
+    Ticket schedule_async(ICPPKernel *kernel, unsigned int split_dimension, const std::vector<Ticket> &dependencies = {}) override;
+    /** Multithread the execution of the given sub-region of the kernel's window.
+     *
+     * Splits @p window among the pool threads exactly like schedule() splits the
+     * kernel's full window.
+     *
+     * @param[in] kernel          Kernel to execute.
+     * @param[in] window          Region of the kernel's window to execute.
+     * @param[in] split_dimension Dimension along which to split @p window.
+     */
+    void schedule_window(ICPPKernel *kernel, const Window &window, unsigned int split_dimension) override;
+    /** Run a pre-built sequence of kernels with the pool threads kept resident throughout.
+     *
+     * The workers enter the pool once, then claim window slices of each kernel through an
+     * atomic counter and spin on the previous kernel's completion counter between kernels,
+     * so the whole sequence costs a single pool entry/exit instead of one barrier per kernel.
+     *
+     * @param[in] items Kernels to execute, in order, with their split dimensions.
+     */
+    void schedule_sequence(const std::vector<WorkItem> &items) override;
+    /** Run two independent kernels at the same time on a partitioned thread pool.
+     *
+     * The first kernel receives at most its concurrency limit (see
+     * @ref IScheduler::set_bandwidth_bound_threads) and the second kernel runs on the remaining
+     * threads, so a bandwidth-bound kernel no longer occupies cores it cannot use while an
+     * independent compute-bound kernel waits for the pool.
+     *
+     * @param[in] kernel_0          First kernel to execute.
+     * @param[in] split_dimension_0 Dimension along which to split the first kernel's execution window.
+     * @param[in] kernel_1          Second kernel to execute.
+     * @param[in] split_dimension_1 Dimension along which to split the second kernel's execution window.
+     */
+    void schedule_concurrent(ICPPKernel *kernel_0, unsigned int split_dimension_0, ICPPKernel *kernel_1, unsigned int split_dimension_1) override;
+    // Inherited methods overridden
+    void wait_for(Ticket ticket) override;
+    void wait_all() override;
+
+    /** Destructor: join the asynchronous dispatcher and the pool. */
+    ~CPPScheduler();
 
 private:
-    /** Constructor: create a pool of threads. */
-    CPPScheduler();
+    /** Split the given window and run the kernel on the thread pool, blocking until completion.
+     *
+     * @param[in] kernel          Kernel to execute.
+     * @param[in] window          Region of the kernel's window to execute.
+     * @param[in] split_dimension Dimension along which to split @p window.
+     */
+    void execute(ICPPKernel *kernel, const Window &window, unsigned int split_dimension);
+
+    /** Pin (or unpin) every thread of the pool according to the current affinity policy. */
+    void apply_affinity_policy();
+
+    /** Run one thread's share of a dispatch, recording a telemetry event for it when telemetry is enabled.
+     *
+     * @param[in] kernel          Kernel being executed.
+     * @param[in] split_dimension Dimension the execution window was split along.
+     * @param[in] num_iterations  Total number of window iterations of the dispatch.
+     * @param[in] info            Thread related information.
+     * @param[in] workload        The share of the dispatch to execute.
+     */
+    void run_instrumented(ICPPKernel *kernel, unsigned int split_dimension, unsigned int num_iterations, const ThreadInfo &info, const std::function<void()> &workload);
 
-    unsigned int      _num_threads;
-    std::list<Thread> _threads;
+    unsigned int                      _num_threads;
+    Mode                              _mode;
+    std::list<Thread>                 _threads;
+    std::unique_ptr<AsyncKernelQueue> _async_queue;
+    std::unique_ptr<PoolGate>         _pool_gate;
 };
 }
 #endif /* __ARM_COMPUTE_CPPSCHEDULER_H__ */
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CPUTUNER_H__
+#define __ARM_COMPUTE_CPUTUNER_H__
+
+#include <string>
+#include <unordered_map>
+
+namespace arm_compute
+{
+/** Device profile for the CPU schedulers, the NEON counterpart of @ref CLTuner.
+ *
+ * Holds per-kernel split dimensions and a recommended thread count determined
+ * offline for a specific device (see the neon_tuner example). A scheduler with
+ * a tuner attached (IScheduler::set_tuner()) consults the profile on every
+ * dispatch and overrides the split dimension hardcoded in the functions.
+ */
+class CPUTuner
+{
+public:
+    /** Constructor */
+    CPUTuner() = default;
+
+    /** Import split dimension table, replacing the current table
+     *
+     * @param[in] split_table Map of kernel name to split dimension
+     */
+    void import_split_table(const std::unordered_map<std::string, unsigned int> &split_table);
+
+    /** Export split dimension table
+     *
+     * @return The split dimension table as unordered_map container
+     */
+    const std::unordered_map<std::string, unsigned int> &export_split_table() const;
+
+    /** Set the split dimension to use for a kernel
+     *
+     * @param[in] kernel_name     Name of the kernel (ICPPKernel::name())
+     * @param[in] split_dimension Dimension to split the kernel's window along
+     */
+    void set_split_dimension(const std::string &kernel_name, unsigned int split_dimension);
+
+    /** Split dimension to use for a kernel
+     *
+     * @param[in] kernel_name             Name of the kernel (ICPPKernel::name())
+     * @param[in] default_split_dimension Dimension requested by the function
+     *
+     * @return The tuned split dimension, or @p default_split_dimension if the kernel is not in the profile
+     */
+    unsigned int optimal_split_dimension(const char *kernel_name, unsigned int default_split_dimension) const;
+
+    /** Set the recommended number of scheduler threads for this device
+     *
+     * @param[in] num_threads Number of threads, 0 leaves the scheduler's thread count untouched
+     */
+    void set_num_threads(unsigned int num_threads);
+
+    /** Recommended number of scheduler threads for this device
+     *
+     * @return Number of threads, 0 if the profile does not recommend one
+     */
+    unsigned int num_threads() const;
+
+    /** Save the profile to a file
+     *
+     * Tuning is then paid once per device: a subsequent run can restore the
+     * profile with load_from_file() instead of sweeping every kernel again.
+     *
+     * @param[in] filename File to write the profile to
+     *
+     * @return True if the profile was successfully written
+     */
+    bool save_to_file(const std::string &filename) const;
+
+    /** Load the profile from a file, replacing the current profile
+     *
+     * @param[in] filename File to read the profile from, as written by save_to_file()
+     *
+     * @return True if the profile was successfully read
+     */
+    bool load_from_file(const std::string &filename);
+
+private:
+    std::unordered_map<std::string, unsigned int> _split_table{};
+    unsigned int                                  _num_threads{ 0 };
+};
+}
+#endif /*__ARM_COMPUTE_CPUTUNER_H__ */
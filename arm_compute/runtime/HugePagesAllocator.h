@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_HUGEPAGESALLOCATOR_H__
+#define __ARM_COMPUTE_HUGEPAGESALLOCATOR_H__
+
+#include "arm_compute/runtime/IAllocator.h"
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+
+namespace arm_compute
+{
+/** Allocator backing large allocations with 2MB huge pages.
+ *
+ * Large long-lived buffers (GEMM workspaces, reshaped weights panels) cover thousands of 4K pages
+ * and put heavy pressure on the TLB. This allocator maps them with 2MB pages instead: it first
+ * tries an explicit huge page mapping (MAP_HUGETLB), then falls back to transparent huge pages
+ * (madvise(MADV_HUGEPAGE)), and finally to a regular allocation, so it is always safe to use.
+ * Pass it wherever an @ref IAllocator is accepted, e.g. when finalizing @ref MemoryManagerOnDemand.
+ */
+class HugePagesAllocator : public IAllocator
+{
+public:
+    /** Default constructor */
+    HugePagesAllocator() = default;
+
+    // Inherited methods overridden:
+    void *allocate(size_t size, size_t alignment) override;
+    void free(void *ptr) override;
+
+private:
+    std::map<void *, size_t> _mappings; /**< Sizes of the ranges this allocator has mmap'd */
+    std::mutex               _mutex;    /**< Protects @p _mappings */
+};
+} // arm_compute
+#endif /*__ARM_COMPUTE_HUGEPAGESALLOCATOR_H__ */
@@ -45,10 +45,22 @@ public:
      * @note The function will not block until the kernels are executed. It is the user's responsibility to wait.
      */
     virtual void run() = 0;
+    /** Prepare the function for execution
+     *
+     * Any one shot work (e.g. weights reshaping or transposing) is executed here, so that
+     * calling prepare() at load time moves that cost out of the latency critical first run().
+     * Calling it is optional: run() still triggers the preparation on demand, and calling it
+     * more than once has no effect. Functions without one shot work do not override it.
+     */
+    virtual void prepare();
     /** Destructor
      *
      */
     virtual ~IFunction() = default;
 };
+
+inline void IFunction::prepare()
+{
+}
 }
 #endif /*__ARM_COMPUTE_IFUNCTION_H__ */
@@ -28,6 +28,7 @@
 #include "arm_compute/runtime/Types.h"
 
 #include <cstddef>
+#include <ostream>
 #include <vector>
 
 namespace arm_compute
@@ -75,6 +76,30 @@ public:
      * @return Mapping type of the lifetime manager
      */
     virtual MappingType mapping_type() const = 0;
+    /** Amount of backing memory a pool created by this manager allocates
+     *
+     * @return Total pool size in bytes
+     */
+    virtual size_t total_pool_size() const = 0;
+    /** Sizes of the chunks the pool is carved into: one entry per blob for blob managers,
+     *  a single entry for offset managers
+     *
+     * @return Sizes of the pool chunks in bytes
+     */
+    virtual std::vector<size_t> pool_chunk_sizes() const = 0;
+    /** Sum of the sizes of all the objects registered with the manager, i.e. the memory that
+     *  would be needed without lifetime analysis
+     *
+     * @return Total registered object size in bytes
+     */
+    virtual size_t total_registered_size() const = 0;
+    /** Prints the memory requirements and the placement (group and blob/offset) of every managed object
+     *
+     * @note Meaningful once all registered groups have been finalized
+     *
+     * @param[out] os Output stream to print to
+     */
+    virtual void print_placement(std::ostream &os) const = 0;
 };
 } // arm_compute
 #endif /* __ARM_COMPUTE_ILIFETIMEMANAGER_H__ */
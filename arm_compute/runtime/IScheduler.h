@@ -26,14 +26,56 @@
 
 #include "arm_compute/core/CPP/CPPTypes.h"
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
 namespace arm_compute
 {
+class Coordinates;
+class CPUTuner;
 class ICPPKernel;
+class TensorShape;
+class Window;
 
 /** Scheduler interface to run kernels */
 class IScheduler
 {
 public:
+    /** Policy used to place worker threads on the CPU cores */
+    enum class AffinityPolicy
+    {
+        None,        /**< Threads float freely, placement is left to the OS (default) */
+        OnePerCore,  /**< Pin one thread to each core in core id order, avoiding mid-layer migrations */
+        PinToBig,    /**< Pin all threads to the big (high-performance) cluster */
+        PinToLittle  /**< Pin all threads to the LITTLE (high-efficiency) cluster */
+    };
+
+    /** Dispatch priority of a thread submitting work to the scheduler */
+    enum class Priority
+    {
+        Normal,     /**< Dispatches wait for previously queued work (default) */
+        Interactive /**< Dispatches overtake queued Normal work, waiting at most for the kernel currently running */
+    };
+
+    /** Token identifying a kernel dispatched with schedule_async() */
+    using Ticket = uint64_t;
+
+    /** Telemetry record covering one thread's share of a kernel dispatch */
+    struct KernelEvent
+    {
+        const char  *kernel_name{ nullptr }; /**< Name of the kernel (ICPPKernel::name()) */
+        unsigned int split_dimension{ 0 };   /**< Dimension the execution window was split along */
+        unsigned int num_iterations{ 0 };    /**< Total number of window iterations of the dispatch */
+        int          thread_id{ 0 };         /**< Thread which executed this share */
+        int          num_threads{ 0 };       /**< Number of threads the dispatch was split across */
+        uint64_t     start_ns{ 0 };          /**< Start timestamp (monotonic clock, in ns) */
+        uint64_t     end_ns{ 0 };            /**< End timestamp (monotonic clock, in ns) */
+    };
+
     /** Default constructor. */
     IScheduler();
 
@@ -59,20 +101,380 @@ public:
      */
     virtual void schedule(ICPPKernel *kernel, unsigned int split_dimension) = 0;
 
+    /** Runs the kernel in the same thread as the caller synchronously, splitting the execution window over a 2D grid of tiles.
+     *
+     * Useful when a single dimension has fewer iterations than there are threads (e.g. GEMM on
+     * tall-skinny matrices): splitting over two dimensions still gives every thread a tile.
+     * By default this falls back to a 1D split along @p split_dimension_0; schedulers able to run
+     * a 2D grid override it.
+     *
+     * @param[in] kernel            Kernel to execute.
+     * @param[in] split_dimension_0 First dimension along which to split the kernel's execution window.
+     * @param[in] split_dimension_1 Second dimension along which to split the kernel's execution window.
+     */
+    virtual void schedule(ICPPKernel *kernel, unsigned int split_dimension_0, unsigned int split_dimension_1);
+
+    /** Runs the kernel over the given sub-region of its execution window synchronously.
+     *
+     * Lets functions drive a kernel strip by strip instead of over the whole frame in one
+     * dispatch, e.g. to chain several kernels over a strip of rows while it is still cache
+     * resident. @p window must be a valid sub-window of the kernel's configured window.
+     * The base implementation runs the strip on the calling thread; schedulers with a
+     * thread pool override it to split the strip like schedule() does.
+     *
+     * @param[in] kernel          Kernel to execute.
+     * @param[in] window          Region of the kernel's window to execute.
+     * @param[in] split_dimension Dimension along which to split @p window.
+     */
+    virtual void schedule_window(ICPPKernel *kernel, const Window &window, unsigned int split_dimension);
+
+    /** Runs the kernel over the intersection of its execution window and a region of interest.
+     *
+     * Intended for incremental updates where only a sub-region of a frame changed (e.g.
+     * motion detection): the kernel's configured window is clipped to the given rectangle
+     * with @ref Window::clipped_to and only that region is processed, split across threads
+     * like a regular schedule() call. An empty intersection runs nothing.
+     *
+     * @param[in] kernel          Kernel to execute.
+     * @param[in] anchor          Coordinates of the top-left corner of the region of interest.
+     * @param[in] shape           Shape of the region of interest.
+     * @param[in] split_dimension Dimension along which to split the clipped window.
+     */
+    void schedule_roi(ICPPKernel *kernel, const Coordinates &anchor, const TensorShape &shape, unsigned int split_dimension);
+
+    /** One step of a pre-built execution sequence: a kernel and the dimension to split it along */
+    struct WorkItem
+    {
+        ICPPKernel  *kernel;          /**< Kernel to execute */
+        unsigned int split_dimension; /**< Dimension along which to split the kernel's execution window */
+    };
+
+    /** Runs a pre-built sequence of kernels back to back, synchronizing between consecutive kernels.
+     *
+     * Each kernel starts only once the previous one has fully completed, matching the semantics of
+     * calling schedule() once per kernel. The base implementation does exactly that; schedulers
+     * with a thread pool override it to keep their workers resident across the whole sequence and
+     * replace the per-kernel pool entry/exit with lightweight synchronization, so a deep network
+     * costs one pool round-trip instead of one per layer.
+     *
+     * @param[in] items Kernels to execute, in order, with their split dimensions.
+     */
+    virtual void schedule_sequence(const std::vector<WorkItem> &items);
+
+    /** Runs two independent kernels at the same time, partitioning the thread pool between them.
+     *
+     * Meant to pair a bandwidth-bound kernel with a compute-bound one (see
+     * @ref ICPPKernel::resource_profile): the bandwidth-bound kernel only receives the threads it
+     * can use before saturating the memory system and the other kernel runs on the remaining
+     * cores, instead of each dispatch occupying the whole pool in turn. The kernels must not
+     * depend on each other's output. The base implementation runs them back to back; schedulers
+     * with a thread pool override it.
+     *
+     * @param[in] kernel_0          First kernel to execute.
+     * @param[in] split_dimension_0 Dimension along which to split the first kernel's execution window.
+     * @param[in] kernel_1          Second kernel to execute.
+     * @param[in] split_dimension_1 Dimension along which to split the second kernel's execution window.
+     */
+    virtual void schedule_concurrent(ICPPKernel *kernel_0, unsigned int split_dimension_0, ICPPKernel *kernel_1, unsigned int split_dimension_1);
+
+    /** Queues the kernel for asynchronous execution and returns without waiting for its completion.
+     *
+     * Queued kernels execute in submission order, so @p dependencies may only refer to tickets
+     * returned by earlier submissions. This lets functions overlap independent kernels with work
+     * done on the calling thread (e.g. preparing the next stage) instead of barrier-synchronizing
+     * after every schedule() call. The base implementation runs the kernel synchronously.
+     *
+     * @param[in] kernel          Kernel to execute.
+     * @param[in] split_dimension Dimension along which to split the kernel's execution window.
+     * @param[in] dependencies    Tickets of previously submitted kernels this kernel depends on.
+     *
+     * @return Ticket which can be waited on or passed as a dependency of a later submission.
+     */
+    virtual Ticket schedule_async(ICPPKernel *kernel, unsigned int split_dimension, const std::vector<Ticket> &dependencies = {});
+
+    /** Blocks until the kernel identified by @p ticket has finished executing.
+     *
+     * @param[in] ticket Ticket returned by schedule_async().
+     */
+    virtual void wait_for(Ticket ticket);
+
+    /** Blocks until every kernel submitted with schedule_async() has finished executing. */
+    virtual void wait_all();
+
     /** Sets the target CPU architecture.
      *
      * @param[in] target Target CPU.
      */
     void set_target(CPUTarget target);
 
+    /** Sets the policy used to place worker threads on the CPU cores.
+     *
+     * Uses the CPU part detection already performed for CPUInfo to tell big cores from LITTLE
+     * ones. Schedulers without their own thread pool ignore the policy. On systems with a single
+     * cluster PinToBig and PinToLittle behave like OnePerCore.
+     *
+     * @param[in] policy Affinity policy to apply to the worker threads.
+     */
+    virtual void set_affinity_policy(AffinityPolicy policy);
+
+    /** Returns the affinity policy applied to the worker threads.
+     *
+     * @return The affinity policy.
+     */
+    AffinityPolicy affinity_policy() const;
+
+    /** Enables or disables per-dispatch telemetry.
+     *
+     * When enabled, every schedule() call records one KernelEvent per participating thread
+     * (kernel name, window size, split dimension, per-thread start/stop timestamps) into a
+     * fixed-size lock-free ring buffer. The overhead is two clock reads per thread, making it
+     * safe to leave enabled in production. When the buffer is full the oldest events are
+     * overwritten; drain_telemetry() empties it.
+     *
+     * @param[in] enabled True to record telemetry events.
+     */
+    void set_telemetry_enabled(bool enabled);
+
+    /** Returns true if telemetry recording is enabled.
+     *
+     * @return True if telemetry recording is enabled.
+     */
+    bool telemetry_enabled() const;
+
+    /** Empties the telemetry ring buffer and returns the recorded events.
+     *
+     * Events are best-effort: draining while kernels execute may miss the events being written.
+     *
+     * @return The recorded events, oldest first (modulo ring buffer wrap-around).
+     */
+    std::vector<KernelEvent> drain_telemetry();
+
+    /** Sets the workload cost below which a kernel is run inline on the calling thread.
+     *
+     * The cost of a dispatch is estimated as Window::num_iterations() times the kernel's
+     * ICPPKernel::cost_per_iteration(): when it does not exceed the threshold, waking the
+     * worker threads costs more than it saves (e.g. pooling over 7x7 tail layers), so the
+     * kernel runs single-threaded without touching the pool.
+     *
+     * @note Opt-in: the fast path is disabled by default. Most kernels report the default
+     *       per-iteration cost of 1 regardless of the work an iteration does, so a non-zero
+     *       threshold large enough to catch tail layers would also force heavy kernels with
+     *       few window iterations (GEMM and convolution split in row blocks) onto one core.
+     *       Enable it with a threshold calibrated for the kernels of the targeted pipeline.
+     *
+     * @param[in] threshold Cost threshold. 0 (default) disables the inline fast path.
+     */
+    void set_inline_cost_threshold(unsigned int threshold);
+
+    /** Returns the workload cost below which kernels run inline on the calling thread.
+     *
+     * @return The cost threshold.
+     */
+    unsigned int inline_cost_threshold() const;
+
+    /** Sets the number of threads bandwidth-bound kernels are capped to.
+     *
+     * Kernels reporting @ref ICPPKernel::ResourceProfile::BANDWIDTH_BOUND stop scaling once the
+     * memory system is saturated; threads past that point only add contention and evict the
+     * caches for the kernels that follow. The saturation point is platform dependent and can be
+     * measured with the scheduler's telemetry by comparing dispatch times across thread counts.
+     *
+     * @param[in] num_threads Thread cap for bandwidth-bound kernels. 0 restores the default of
+     *                        half the pool.
+     */
+    void set_bandwidth_bound_threads(unsigned int num_threads);
+
+    /** Returns the number of threads bandwidth-bound kernels are capped to.
+     *
+     * @return The thread cap, or 0 when the default of half the pool is in use.
+     */
+    unsigned int bandwidth_bound_threads() const;
+
+    /** Sets the time worker threads keep busy-waiting for new work before parking in the kernel.
+     *
+     * For networks made of many small kernels the wake/sleep round-trip of a blocking wait can
+     * cost more than the kernel itself. Spinning for a short while keeps back-to-back dispatches
+     * in userspace. The spin duration should stay in the order of a few dispatch periods:
+     * longer values waste power and can slow down co-running workloads.
+     *
+     * @param[in] spin_wait_us Spin duration in microseconds. If set to 0 (default), threads park immediately.
+     */
+    void set_spin_wait_duration(unsigned int spin_wait_us);
+
+    /** Returns the time worker threads busy-wait for new work before parking.
+     *
+     * @return Spin duration in microseconds.
+     */
+    unsigned int spin_wait_duration() const;
+
+    /** Sets the dispatch priority of the calling thread.
+     *
+     * Thread-affine, like @ref Scheduler::bind_to_thread: each thread dispatching kernels
+     * carries its own priority. Interactive dispatches enter the worker pool ahead of queued
+     * and waiting Normal work in schedulers with a priority lane (currently
+     * @ref CPPScheduler), so a latency-critical caller sharing the pool with background work
+     * waits at most for the kernel currently running, never for the backlog behind it.
+     * Interactive dispatches do not wait for pending schedule_async() submissions either, so
+     * a thread mixing asynchronous and synchronous dispatches on the same tensors must stay
+     * at Normal priority.
+     *
+     * @param[in] priority Priority applied to the calling thread's dispatches.
+     */
+    static void set_caller_priority(Priority priority);
+
+    /** Returns the dispatch priority of the calling thread.
+     *
+     * @return The calling thread's priority.
+     */
+    static Priority caller_priority();
+
+    /** Binds a cancellation flag to the calling thread's dispatches.
+     *
+     * Thread-affine. While bound, dispatches poll the flag between window chunks (in
+     * work-stealing mode and in kernel sequences) and stop claiming further work once it is
+     * set, so another thread can abandon a long-running kernel mid-flight. A cancelled
+     * dispatch returns normally with its output only partially written; the caller is
+     * expected to discard the result.
+     *
+     * @param[in] flag Flag to poll, owned by the caller. nullptr unbinds.
+     */
+    static void set_cancellation_flag(const std::atomic<bool> *flag);
+
+    /** Returns the cancellation flag bound to the calling thread.
+     *
+     * @return The bound flag, nullptr if none.
+     */
+    static const std::atomic<bool> *cancellation_flag();
+
+    /** Binds a deadline to the calling thread's dispatches.
+     *
+     * Thread-affine, checked at the same points as the cancellation flag: once the monotonic
+     * clock passes the deadline, dispatches stop claiming further window chunks. Lets a frame
+     * budget cut a kernel short from within the blocked dispatching thread itself, where no
+     * one is left to set a cancellation flag.
+     *
+     * @param[in] deadline_ns Deadline as a monotonic clock timestamp in nanoseconds (same
+     *                        epoch as the @ref KernelEvent timestamps). 0 unbinds.
+     */
+    static void set_dispatch_deadline(uint64_t deadline_ns);
+
+    /** Returns the deadline bound to the calling thread.
+     *
+     * @return The bound deadline in nanoseconds, 0 if none.
+     */
+    static uint64_t dispatch_deadline();
+
+    /** Grows the per-thread scratch arena handed to kernels through ThreadInfo::workspace.
+     *
+     * Kernels needing per-thread temporaries (histogram bins, gathered GEMM tiles) used to
+     * either allocate them in run() or receive a buffer sized for every possible thread.
+     * Instead, functions call this in their configure() step with the scratch size one thread
+     * needs: the scheduler keeps one arena per thread, sized to the largest reservation seen,
+     * and hands each thread its own arena on every dispatch. The memory is reused across
+     * kernels and dispatches, stays local to the thread that works in it and no allocation
+     * happens while kernels run.
+     *
+     * @param[in] size Scratch size in bytes each thread must be able to use.
+     */
+    void reserve_workspace(size_t size);
+
+    /** Returns the size in bytes of the per-thread scratch arenas.
+     *
+     * @return The reserved scratch size.
+     */
+    size_t workspace_size() const;
+
     /** Get CPU info.
      *
      * @return CPU info.
      */
     CPUInfo cpu_info() const;
 
+    /** Attaches a device profile to the scheduler.
+     *
+     * While attached, every dispatch looks the kernel up in the profile and
+     * uses the tuned split dimension instead of the one hardcoded in the
+     * function. If the profile recommends a thread count it is applied
+     * immediately. The caller keeps ownership of the tuner and must keep it
+     * alive while attached.
+     *
+     * @param[in] tuner Device profile to consult, or nullptr to detach.
+     */
+    void set_tuner(CPUTuner *tuner);
+
+    /** Returns the attached device profile.
+     *
+     * @return The attached tuner, nullptr if none is attached.
+     */
+    CPUTuner *tuner() const;
+
 protected:
-    CPUInfo _info{};
+    /** Returns the split dimension to use for a kernel, honouring the attached tuner.
+     *
+     * @param[in] kernel          Kernel about to be dispatched.
+     * @param[in] split_dimension Split dimension requested by the function.
+     *
+     * @return The tuned split dimension, or @p split_dimension if no tuner is attached.
+     */
+    unsigned int tuned_split_dimension(const ICPPKernel *kernel, unsigned int split_dimension) const;
+
+    /** Records an event into the telemetry ring buffer. No-op when telemetry is disabled.
+     *
+     * @param[in] event Event to record.
+     */
+    void record_kernel_event(const KernelEvent &event);
+
+    /** Ensures a scratch arena exists for every thread about to take part in a dispatch.
+     *
+     * Called on the dispatching thread before any ThreadInfo is handed out, so that
+     * thread_workspace() is a plain lookup afterwards and can be used concurrently.
+     *
+     * @param[in] num_threads Number of threads the dispatch may use.
+     */
+    void prepare_workspaces(unsigned int num_threads);
+
+    /** Returns a thread's scratch arena.
+     *
+     * @param[in] thread_id Id of the thread the arena belongs to.
+     *
+     * @return The arena, nullptr if no workspace has been reserved.
+     */
+    void *thread_workspace(int thread_id) const;
+
+    /** Returns the number of threads the given kernel may be fanned out to.
+     *
+     * Applies the bandwidth-bound cap on top of the pool size according to the kernel's
+     * @ref ICPPKernel::resource_profile.
+     *
+     * @param[in] kernel Kernel about to be dispatched.
+     *
+     * @return Maximum number of threads to use for the kernel.
+     */
+    unsigned int concurrency_limit(const ICPPKernel *kernel) const;
+
+    CPUInfo        _info{};
+    unsigned int   _spin_wait_us{ 0 };
+    unsigned int   _inline_cost_threshold{ 0 };
+    unsigned int   _bandwidth_bound_threads{ 0 };
+    AffinityPolicy _affinity_policy{ AffinityPolicy::None };
+    CPUTuner      *_tuner{ nullptr };
+    Ticket         _next_ticket{ 0 };
+
+private:
+    /** Number of events the telemetry ring buffer can hold */
+    static constexpr unsigned int telemetry_capacity = 2048;
+
+    /** Lock-free telemetry ring buffer, allocated on first enablement */
+    struct Telemetry
+    {
+        std::atomic<bool>                           enabled{ false }; /**< True while events are being recorded */
+        std::atomic<unsigned int>                   next{ 0 };        /**< Total number of events recorded so far */
+        std::array<KernelEvent, telemetry_capacity> events{ {} };     /**< Event storage */
+    };
+    std::unique_ptr<Telemetry> _telemetry{ nullptr };
+
+    size_t                                  _workspace_size{ 0 }; /**< Size in bytes of each thread's scratch arena */
+    std::vector<std::unique_ptr<uint8_t[]>> _workspaces{};        /**< Per-thread scratch arenas, indexed by thread id */
 };
 }
 #endif /* __ARM_COMPUTE_ISCHEDULER_H__ */
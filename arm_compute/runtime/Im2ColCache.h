@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_IM2COLCACHE_H__
+#define __ARM_COMPUTE_IM2COLCACHE_H__
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Process wide cache of shared im2col results.
+ *
+ * Several convolutions running over the same feature map (e.g. the heads of a multi-head
+ * detection model) each redo the im2col reshape of an identical input. When the cache is
+ * enabled, @ref NEConvolutionLayer instances configured with the same input tensor and
+ * convolution geometry share a single im2col tensor instead: the first instance configured
+ * with a given key becomes the producer and recomputes the reshape every run, the others
+ * only consume it. Exactly one copy is kept live, owned by the cache rather than the
+ * per-function memory groups so it outlives every consumer's dispatch.
+ *
+ * Unlike @ref WeightsCache the cached content is not constant — it is recomputed each frame —
+ * so entries are keyed by tensor object identity: sharing is only valid between functions
+ * configured on the very same input tensor, whose execution order within a graph guarantees
+ * the producer runs before its consumers.
+ *
+ * The cache is disabled by default and has to be switched on with @ref set_enabled before
+ * the functions are configured.
+ */
+class Im2ColCache
+{
+public:
+    /** Access the cache singleton
+     *
+     * @return The cache
+     */
+    static Im2ColCache &get();
+    /** Prevent instances of this class from being copied */
+    Im2ColCache(const Im2ColCache &) = delete;
+    /** Prevent instances of this class from being copied */
+    Im2ColCache &operator=(const Im2ColCache &) = delete;
+
+    /** Enable or disable the cache. Has to be set before the functions are configured */
+    void set_enabled(bool enabled);
+    /** True if functions should use the cache */
+    bool is_enabled() const;
+
+    /** Return the tensor caching the im2col result of the given input and geometry, creating
+     *  and allocating it on first use.
+     *
+     * @param[in]  input    Input tensor the im2col reshape is applied to.
+     * @param[in]  geometry Identifier of the applied convolution geometry.
+     * @param[in]  info     Tensor info of the im2col result, used when the slot is created.
+     * @param[out] produce  Set to true when the caller is the entry's producer and must run
+     *                      its im2col kernel every frame, false when another function
+     *                      instance already does.
+     *
+     * @return The shared tensor holding the im2col result
+     */
+    ITensor *acquire(const ITensor *input, const std::string &geometry, const TensorInfo &info, bool &produce);
+
+    /** Drop all cache entries and release their memory */
+    void clear();
+
+private:
+    Im2ColCache() = default;
+
+    struct Entry
+    {
+        std::unique_ptr<Tensor> tensor{};
+        bool                    has_producer{ false };
+    };
+
+    using Key = std::pair<const ITensor *, std::string>;
+
+    std::map<Key, Entry> _cache{};
+    mutable std::mutex   _mutex{};
+    bool                 _enabled{ false };
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_IM2COLCACHE_H__ */
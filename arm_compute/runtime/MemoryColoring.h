@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_MEMORYCOLORING_H__
+#define __ARM_COMPUTE_MEMORYCOLORING_H__
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+
+#include <atomic>
+#include <cstddef>
+
+namespace arm_compute
+{
+/** Policy staggering the start offsets of successive allocations across cache sets.
+ *
+ * Allocators align tensor starts to the element size only, so concurrently-accessed buffers
+ * (e.g. the A/B/C panels of a GEMM) frequently begin at the same L1-set alignment and evict
+ * each other's lines. When coloring is enabled, @ref TensorAllocator and @ref BlobMemoryPool
+ * over-allocate each buffer by a small offset drawn round-robin from this policy, spreading
+ * buffer starts over the cache sets of one way. Disabled by default; the offset sequence is
+ * global so buffers allocated together land on different colors.
+ */
+class MemoryColoring
+{
+public:
+    /** Access the coloring policy
+     *
+     * @return The coloring policy singleton
+     */
+    static MemoryColoring &get();
+
+    /** Prevent instances of this class from being copied (As this class is a singleton) */
+    MemoryColoring(const MemoryColoring &) = delete;
+    /** Prevent instances of this class from being copied (As this class is a singleton) */
+    MemoryColoring &operator=(const MemoryColoring &) = delete;
+
+    /** Enable or disable coloring. Takes effect for subsequent allocations only */
+    void set_enabled(bool enabled);
+    /** Returns whether coloring is enabled
+     *
+     * @return True if subsequent allocations are colored
+     */
+    bool is_enabled() const;
+    /** Set the offset stride between successive allocations and the window the offsets wrap in.
+     *
+     * @param[in] stride Offset distance between consecutive allocations. Rounded up to a
+     *                   multiple of the cache line size; odd line multiples spread best.
+     * @param[in] window Range the offsets cycle through, typically the size of one cache way.
+     *                   Rounded up to a multiple of @p stride.
+     */
+    void configure(size_t stride, size_t window);
+    /** Derive the coloring window from the detected cache geometry.
+     *
+     * Uses one way of the L1 data cache as the window, assuming the 4-way associativity
+     * common to the Cortex-A cores this library targets.
+     *
+     * @param[in] info CPU information holding the detected cache sizes.
+     */
+    void configure_from(const CPUInfo &info);
+
+    /** Offset in bytes to apply to the next allocation, 0 when coloring is disabled.
+     *
+     * @return Offset the allocator shifts the buffer start by
+     */
+    size_t next_offset();
+    /** Largest offset @ref next_offset can return; allocators over-allocate by this much.
+     *
+     * @return Upper bound of the offset range in bytes
+     */
+    size_t max_offset() const;
+
+private:
+    MemoryColoring() = default;
+
+    /** Line size the offsets are quantized to, matching the Cortex-A L1 line */
+    static constexpr size_t cache_line_size = 64;
+
+    std::atomic<size_t> _next{ 0 };                    /**< Global offset sequence position */
+    size_t              _stride{ 5 * cache_line_size };/**< Offset distance between consecutive allocations */
+    size_t              _window{ 10 * 5 * cache_line_size }; /**< Range the offsets cycle through */
+    bool                _enabled{ false };             /**< True if subsequent allocations are colored */
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_MEMORYCOLORING_H__ */
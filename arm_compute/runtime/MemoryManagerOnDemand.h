@@ -53,6 +53,10 @@ public:
     /** Allow instances of this class to be moved */
     MemoryManagerOnDemand &operator=(MemoryManagerOnDemand &&) = default;
     /** Sets the number of pools to create
+     *
+     * Create one pool per worker thread to run the same configured function set concurrently
+     * within a process: each call to run() locks its own pool, so up to @p num_pools requests
+     * execute in parallel without serializing on pool acquisition.
      *
      * @param[in] num_pools Number of pools
      */
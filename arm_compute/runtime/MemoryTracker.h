@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_MEMORYTRACKER_H__
+#define __ARM_COMPUTE_MEMORYTRACKER_H__
+
+#include "support/Mutex.h"
+
+#include <cstddef>
+#include <map>
+
+namespace arm_compute
+{
+/** Process-wide tally of the bytes held by the allocator layer.
+ *
+ * Every allocator (@ref Allocator, @ref TensorAllocator, CLBufferAllocator, ...)
+ * reports its allocations and frees here, keyed by pointer, so tools can read
+ * the live byte count and the high-water mark without instrumenting each
+ * allocator separately. Allocations are infrequent compared to kernel work,
+ * so the bookkeeping cost is negligible.
+ */
+class MemoryTracker
+{
+public:
+    /** Access the tracker singleton.
+     *
+     * @return The tracker.
+     */
+    static MemoryTracker &get();
+
+    /** Record an allocation.
+     *
+     * @param[in] ptr  Address (or handle) identifying the allocation.
+     * @param[in] size Size of the allocation in bytes.
+     */
+    void record_allocation(const void *ptr, size_t size);
+
+    /** Record that an allocation has been freed.
+     *
+     * Pointers that were never recorded (e.g. imported memory) are ignored.
+     *
+     * @param[in] ptr Address (or handle) identifying the allocation.
+     */
+    void record_free(const void *ptr);
+
+    /** Bytes currently held by the allocator layer.
+     *
+     * @return The live byte count.
+     */
+    size_t live_bytes() const;
+
+    /** Largest live byte count seen since the last @ref reset_peak.
+     *
+     * @return The high-water mark in bytes.
+     */
+    size_t peak_bytes() const;
+
+    /** Restart the high-water mark from the current live byte count. */
+    void reset_peak();
+
+private:
+    MemoryTracker() = default;
+
+    mutable arm_compute::Mutex _mutex{};
+    std::map<const void *, size_t> _allocations{};
+    size_t _live{ 0 };
+    size_t _peak{ 0 };
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_MEMORYTRACKER_H__ */
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_MEMORYTRAFFIC_H__
+#define __ARM_COMPUTE_MEMORYTRAFFIC_H__
+
+#include "arm_compute/runtime/IScheduler.h"
+
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+namespace arm_compute
+{
+class ITensorInfo;
+class Window;
+
+/** Theoretical memory traffic of one kernel dispatch, derived from its execution window and
+ * the shapes of the tensors it touches.
+ *
+ * Every element inside the windowed region is counted once, so the estimate is the compulsory
+ * traffic of the dispatch: the bandwidth floor a perfectly cached execution cannot go below.
+ * Combined with the scheduler's telemetry timestamps this gives an always-available roofline
+ * view of a pipeline on devices without PMU access.
+ */
+struct KernelTraffic
+{
+    uint64_t bytes_read{ 0 };    /**< Bytes read from the input tensors */
+    uint64_t bytes_written{ 0 }; /**< Bytes written to the output tensors */
+};
+
+/** Achieved bandwidth of one kernel dispatch */
+struct KernelBandwidth
+{
+    const char *kernel_name{ nullptr };         /**< Name of the kernel the events belong to */
+    uint64_t    bytes{ 0 };                     /**< Total traffic of the dispatch (read + written) */
+    uint64_t    duration_ns{ 0 };               /**< Wall time of the dispatch across all threads, in ns */
+    double      gigabytes_per_second{ 0.0 };    /**< Achieved bandwidth */
+};
+
+/** Bytes of @p info touched when a kernel iterates @p window.
+ *
+ * Dimensions the tensor does not have are treated as broadcast: the tensor is re-read once per
+ * iteration of such a dimension (e.g. weights re-read for every batch).
+ *
+ * @param[in] window Execution window of the kernel (IKernel::window()).
+ * @param[in] info   Metadata of the accessed tensor.
+ *
+ * @return The traffic in bytes.
+ */
+uint64_t compute_tensor_traffic(const Window &window, const ITensorInfo &info);
+
+/** Theoretical traffic of one kernel dispatch over its input and output tensors.
+ *
+ * @param[in] window  Execution window of the kernel (IKernel::window()).
+ * @param[in] inputs  Metadata of the tensors the kernel reads.
+ * @param[in] outputs Metadata of the tensors the kernel writes.
+ *
+ * @return The per-direction traffic in bytes.
+ */
+KernelTraffic estimate_kernel_traffic(const Window &window, std::initializer_list<const ITensorInfo *> inputs, std::initializer_list<const ITensorInfo *> outputs);
+
+/** Combine a dispatch's traffic estimate with its telemetry events into an achieved bandwidth.
+ *
+ * @p events must be the telemetry records of a single dispatch (one per participating thread,
+ * as returned by IScheduler::drain_telemetry()); the dispatch duration is taken from the
+ * earliest start to the latest end among them.
+ *
+ * @param[in] events  Telemetry events of the dispatch.
+ * @param[in] traffic Theoretical traffic of the dispatch.
+ *
+ * @return The achieved bandwidth. Zero-valued when @p events is empty.
+ */
+KernelBandwidth achieved_bandwidth(const std::vector<IScheduler::KernelEvent> &events, const KernelTraffic &traffic);
+}
+#endif /* __ARM_COMPUTE_MEMORYTRAFFIC_H__ */
@@ -38,6 +38,15 @@ class INESimpleFunction : public IFunction
 public:
     /** Constructor */
     INESimpleFunction();
+    /** Trim the execution to an actual shape smaller than the configured maximum
+     *
+     * Allows running the function on variable input sizes without reconfiguration: configure
+     * against the maximum shape (tensors stay allocated to it), then call this per sample
+     * before @ref run(). See @ref IKernel::trim_window for the exact contract.
+     *
+     * @param[in] shape Actual shape to execute on.
+     */
+    void set_actual_shape(const TensorShape &shape);
 
     // Inherited methods overridden:
     void run() override final;
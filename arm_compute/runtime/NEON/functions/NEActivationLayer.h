@@ -44,11 +44,12 @@ public:
      * @note If the output tensor is a nullptr, the activation function will be performed in-place
      *
      * @param[in, out] input           Source tensor. In case of @p output tensor = nullptr, this tensor will store the result
-     *                                 of the activation function. Data types supported: QS8/QS16/F32.
+     *                                 of the activation function. Data types supported: QS8/QASYMM8/QS16/F32.
      * @param[out]     output          Destination tensor. Data type supported: same as @p input
      * @param[in]      activation_info Activation layer parameters.
+     * @param[out]     zero_mask       (Optional) Zero mask summarizing the sparsity of the result, see @ref NEActivationLayerKernel::configure. Data type supported: U8.
      */
-    void configure(ITensor *input, ITensor *output, ActivationLayerInfo activation_info);
+    void configure(ITensor *input, ITensor *output, ActivationLayerInfo activation_info, ITensor *zero_mask = nullptr);
 };
 }
 #endif /* __ARM_COMPUTE_NEACTIVATIONLAYER_H__ */
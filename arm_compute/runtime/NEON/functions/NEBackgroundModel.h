@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEBACKGROUNDMODEL_H__
+#define __ARM_COMPUTE_NEBACKGROUNDMODEL_H__
+
+#include "arm_compute/runtime/NEON/INESimpleFunction.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to run @ref NEBackgroundModelKernel */
+class NEBackgroundModel : public INESimpleFunction
+{
+public:
+    /** Set the frame, the state tensors and the output mask
+     *
+     * The mean and variance tensors carry the background model from frame to frame and must
+     * be initialised by the caller before the first run.
+     *
+     * @param[in]     frame     Source frame. Data type supported: U8.
+     * @param[in,out] mean      Running mean of the frames. Data type supported: F32.
+     * @param[in,out] variance  Running variance of the frames. Data type supported: F32.
+     * @param[out]    mask      Foreground mask, 255 for foreground and 0 for background. Data type supported: U8.
+     * @param[in]     alpha     Blending factor in the range [0.0f, 1.0f].
+     * @param[in]     threshold Number of standard deviations a pixel may differ from the mean before it is flagged as foreground.
+     */
+    void configure(const ITensor *frame, ITensor *mean, ITensor *variance, ITensor *mask, float alpha, float threshold);
+};
+}
+#endif /*__ARM_COMPUTE_NEBACKGROUNDMODEL_H__ */
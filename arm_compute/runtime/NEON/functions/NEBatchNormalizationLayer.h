@@ -27,6 +27,7 @@
 #include "arm_compute/core/NEON/kernels/NEBatchNormalizationLayerKernel.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/Tensor.h"
 
 namespace arm_compute
 {
@@ -58,12 +59,30 @@ public:
      * @param[out]     output  Destination tensor. Output will have the same number of dimensions as input. Data type supported: same as @p input
      */
     void configure(ITensor *input, ITensor *output, const ITensor *mean, const ITensor *var, const ITensor *beta, const ITensor *gamma, float epsilon);
+    /** Folded scale tensor of the equivalent affine transform: gamma / sqrt(var + epsilon)
+     *
+     * For F32 inputs the parameters are collapsed once into (scale, shift) on the first run,
+     * so batch normalization fusion passes can consume the folded form directly.
+     *
+     * @return The folded scale tensor, or nullptr if the data type does not use the folded path. Only valid after the first run.
+     */
+    const ITensor *folded_scale() const;
+    /** Folded shift tensor of the equivalent affine transform: beta - mean * scale
+     *
+     * @return The folded shift tensor, or nullptr if the data type does not use the folded path. Only valid after the first run.
+     */
+    const ITensor *folded_shift() const;
 
     // Inherited methods overridden:
     void run() override;
 
 private:
-    NEBatchNormalizationLayerKernel _norm_kernel; /**< Batch normalization layer kernel */
+    NEBatchNormalizationLayerKernel _norm_kernel;  /**< Batch normalization layer kernel */
+    NEBatchNormalizationFoldKernel  _fold_kernel;  /**< Kernel which folds the parameters into (scale, shift), run once */
+    Tensor                          _scale;        /**< Folded scale, one value per feature map */
+    Tensor                          _shift;        /**< Folded shift, one value per feature map */
+    bool                            _is_folded;    /**< True if the folded affine path is used */
+    bool                            _is_first_run; /**< True until the parameters have been folded */
 };
 }
 #endif /* __ARM_COMPUTE_NEBATCHNORMALIZATIONLAYER_H__ */
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NECAMERAINGEST_H__
+#define __ARM_COMPUTE_NECAMERAINGEST_H__
+
+#include "arm_compute/runtime/NEON/INESimpleFunction.h"
+
+namespace arm_compute
+{
+class IMultiImage;
+class ITensor;
+
+/** Basic function to run @ref NECameraIngestKernel
+ *
+ * Converts an NV12/NV21 camera frame into a planar F32 network input tensor in a single
+ * traversal, fusing the color conversion with optional bilinear resizing and optional
+ * per-channel normalization.
+ */
+class NECameraIngest : public INESimpleFunction
+{
+public:
+    /** Initialize the function's source and destination.
+     *
+     * If the output width/height differ from the luma plane of the input, the frame is resized
+     * with bilinear interpolation while it is converted. If @p mean and @p std are provided,
+     * each output value is normalized to (value / 255 - mean[channel]) / std[channel], otherwise
+     * the raw 0..255 range is written as F32.
+     *
+     * @param[in]  input  Multi-planar source image. Formats supported: NV12/NV21.
+     * @param[out] output Destination tensor. 3D tensor with dimensions [width, height, 3] holding
+     *                    the R, G and B planes. Data type supported: F32.
+     * @param[in]  mean   (Optional) Pointer to 3 per-channel mean values in the 0..1 range. Can be nullptr (no normalization).
+     * @param[in]  std    (Optional) Pointer to 3 per-channel standard deviations. Must be nullptr if and only if @p mean is nullptr.
+     */
+    void configure(const IMultiImage *input, ITensor *output, const float *mean = nullptr, const float *std = nullptr);
+};
+}
+#endif /* __ARM_COMPUTE_NECAMERAINGEST_H__ */
@@ -49,6 +49,10 @@ class ITensor;
  *  -# @ref NEEdgeNonMaxSuppressionKernel
  *  -# @ref NEEdgeTraceKernel
  *
+ * With gradient_size == 3 and border_mode == UNDEFINED the function chains the Sobel,
+ * gradient and non-maxima suppression kernels over strips of rows instead of running
+ * each of them over the whole frame: a strip's intermediate tensors are consumed while
+ * still cache resident, leaving only the hysteresis trace as a full-frame pass.
  */
 class NECannyEdge : public IFunction
 {
@@ -83,7 +87,8 @@ public:
 
 private:
     MemoryGroup                   _memory_group;        /**< Function's memory group */
-    std::unique_ptr<IFunction>    _sobel;               /**< Pointer to Sobel kernel */
+    std::unique_ptr<IFunction>    _sobel;               /**< Pointer to Sobel function (staged execution) */
+    std::unique_ptr<INEKernel>    _sobel_kernel;        /**< Sobel kernel driven strip by strip (tile-chained execution) */
     std::unique_ptr<INEKernel>    _gradient;            /**< Gradient kernel */
     NEEdgeNonMaxSuppressionKernel _non_max_suppr;       /**< Non-Maxima suppression kernel */
     NEEdgeTraceKernel             _edge_trace;          /**< Edge tracing kernel */
@@ -95,6 +100,7 @@ private:
     Tensor                        _phase;               /**< Source tensor - Phase */
     Tensor                        _nonmax;              /**< Source tensor - Non-Maxima suppressed */
     ITensor                      *_output;              /**< Output tensor provided by the user. */
+    bool                          _tile_chaining;       /**< True if gradient, magnitude and non-maxima suppression are chained over row strips */
 };
 }
 #endif /* __ARM_COMPUTE_NECANNYEDGE_H */
@@ -37,6 +37,8 @@ class NEColorConvert : public INESimpleFunction
 {
 public:
     /** Initialize the function's source, destination
+     *
+     * @note A batch of images can be converted in a single call by passing 3D tensors with the batch as the third dimension.
      *
      * @param[in] input  The input single-planar tensor from which to convert
      * @param[in] output The converted single-planar output tensor
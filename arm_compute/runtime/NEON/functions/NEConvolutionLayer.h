@@ -27,18 +27,23 @@
 #include "arm_compute/runtime/IFunction.h"
 
 #include "arm_compute/core/NEON/kernels/NECol2ImKernel.h"
+#include "arm_compute/core/NEON/kernels/NEDirectConvolutionLayerBiasAccumulateKernel.h"
+#include "arm_compute/core/NEON/kernels/NEDirectConvolutionLayerKernel.h"
 #include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMAssemblyBaseKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMInterleave4x4Kernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMMatrixMultiplyKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMTranspose1xWKernel.h"
 #include "arm_compute/core/NEON/kernels/NEIm2ColKernel.h"
+#include "arm_compute/core/NEON/kernels/NEImplicitGEMMConvolutionKernel.h"
 #include "arm_compute/core/NEON/kernels/NEWeightsReshapeKernel.h"
+#include "arm_compute/core/Size2D.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/Tensor.h"
 
 #include <memory>
+#include <string>
 
 namespace arm_compute
 {
@@ -80,6 +85,14 @@ private:
  * -# @ref NEGEMMInterleave4x4Kernel (executed only in case GEMM is required for the operation)
  * -# @ref NEGEMMMatrixMultiplyKernel
  * -# @ref NECol2ImKernel
+ *
+ * For non fully connected F32 convolutions without fused activation the im2col, interleave,
+ * matrix multiply and col2im kernels are replaced by a single @ref NEImplicitGEMMConvolutionKernel,
+ * which gathers the GEMM A operand on the fly and does not materialize the im2col intermediate.
+ *
+ * 1x1 stride-1 convolutions on the remaining data types are a plain matrix multiply that needs
+ * no im2col at all: they run through @ref NEDirectConvolutionLayerKernel, which reads the input
+ * in place, with no weights reshape and no intermediate tensors.
  */
 class NEConvolutionLayer : public IFunction
 {
@@ -99,28 +112,59 @@ public:
      * @param[in]  conv_info    Contains padding and stride information described in @ref PadStrideInfo.
      * @param[in]  weights_info Specifies if the weights tensor has been reshaped with NEWeightsReshapeKernel. If this is not part of the fully connected layer the weights
      *                          tensor has also been transposed with NEGEMMTranspose1xWKernel. Data type supported: Same as @p input.
+     * @param[in]  act_info     (Optional) Activation to fuse into the output stage (see @ref NECol2ImKernel). Only RELU, BOUNDED_RELU and
+     *                          LU_BOUNDED_RELU are supported and only for F32, disabled by default.
+     * @param[in]  dilation     (Optional) Dilation of the convolution: spacing between the kernel taps, as used by atrous convolutions.
+     *                          Defaults to (1, 1), i.e. a dense kernel.
      */
-    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info = WeightsInfo());
+    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info = WeightsInfo(),
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo(), const Size2D &dilation = Size2D(1U, 1U));
 
     // Inherited methods overridden:
     void run() override;
+    void prepare() override;
+    /** Indicates whether the function still reads the caller's weights tensor after @ref prepare
+     *
+     * When false, the weights have been baked into the function's own reshaped tensor and the
+     * caller may free the original weights once every function sharing them has been prepared.
+     *
+     * @return True if the original weights are still read at run time
+     */
+    bool original_weights_retained() const;
 
 private:
+    /** Configure the weights reshape, sharing the reshaped tensor through @ref WeightsCache when the cache is enabled
+     *
+     * @return The tensor the reshaped weights will be written to
+     */
+    const ITensor *prepare_reshaped_weights(const ITensor *weights, const ITensor *biases, const TensorInfo &info, const char *transform, bool transpose1xW);
+
     MemoryGroup                               _memory_group;
     NEIm2ColKernel                            _input_im2col_kernel;
     NEGEMMInterleave4x4Kernel                 _input_interleave_kernel;
     NEConvolutionLayerReshapeWeights          _reshape_weights;
     NEGEMMMatrixMultiplyKernel                _mm_kernel;
     std::unique_ptr<NEGEMMAssemblyBaseKernel> _mm_optimised_kernel;
+    NEImplicitGEMMConvolutionKernel           _implicit_gemm_kernel;
+    NEDirectConvolutionLayerKernel            _direct_conv_kernel;
+    NEDirectConvolutionLayerBiasAccumulateKernel _accumulate_bias_kernel;
     NECol2ImKernel                            _output_col2im_kernel;
     Tensor                                    _input_im2col_reshaped;
+    ITensor                                  *_im2col_output;
     Tensor                                    _input_interleaved_reshaped;
     Tensor                                    _weights_reshaped;
     Tensor                                    _gemm_output;
+    Tensor                                    _accumulator;
     Tensor                                    _workspace;
+    const ITensor                            *_original_weights;
+    std::string                               _weights_transform;
     bool                                      _has_bias;
+    bool                                      _run_im2col;
     bool                                      _is_fully_connected_convolution;
     bool                                      _are_weights_reshaped;
+    bool                                      _run_implicit_gemm;
+    bool                                      _run_direct_convolution;
+    bool                                      _original_weights_retained;
 };
 }
 #endif /* __ARM_COMPUTE_NECONVOLUTIONLAYER_H__ */
@@ -28,6 +28,7 @@
 
 #include "arm_compute/core/NEON/kernels/NEDepthConcatenateKernel.h"
 #include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
+#include "arm_compute/runtime/SubTensor.h"
 
 #include <memory>
 #include <vector>
@@ -53,6 +54,22 @@ public:
      * @param[out]    output        Output tensor. Data types supported: Same as @p inputs_vector.
      */
     void configure(std::vector<ITensor *> inputs_vector, ITensor *output);
+    /** Create zero-copy depth concatenation views into a concatenation output.
+     *
+     * Instead of running branch functions into their own tensors and copying them here, configure
+     * each branch function with the returned sub-tensor as its output: the branch then writes its
+     * result directly at the right depth offset of @p output and the concatenation costs nothing.
+     * @p output must be initialized with the concatenated shape and must outlive the views.
+     *
+     * @note Branch kernels must not require padding on their output, as the views share the
+     *       parent's strides (branch functions in this library fall back to unpadded stores).
+     *
+     * @param[in]     branch_shapes Shapes of the branch outputs to concatenate, in depth order.
+     * @param[in,out] output        Tensor the branches will be concatenated into. Data types supported: QS8/QS16/F16/F32.
+     *
+     * @return One sub-tensor view per branch, placed at increasing depth offsets of @p output
+     */
+    static std::vector<std::unique_ptr<SubTensor>> create_subtensor_outputs(const std::vector<TensorShape> &branch_shapes, ITensor *output);
 
     // Inherited methods overridden:
     void run() override;
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEELEMENTWISEOPGRAPH_H__
+#define __ARM_COMPUTE_NEELEMENTWISEOPGRAPH_H__
+
+#include "arm_compute/core/NEON/kernels/NEElementwiseOpGraphKernel.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <cstdint>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to run @ref NEElementwiseOpGraphKernel.
+ *
+ * Evaluates a user-composed graph of U8 thresholds and bitwise operations in a single pass
+ * over its inputs, writing any number of output tensors. The graph is built with the add_*
+ * methods and sealed with @ref configure():
+ *
+ * @code
+ * NEElementwiseOpGraph graph;
+ * auto src  = graph.add_input(&image);
+ * auto low  = graph.add_threshold(src, 40, 0, 255);
+ * auto high = graph.add_threshold(src, 200, 0, 255);
+ * graph.add_output(low, &mask_low);
+ * graph.add_output(graph.add_and(low, high), &mask_band);
+ * graph.configure();
+ * @endcode
+ */
+class NEElementwiseOpGraph : public IFunction
+{
+public:
+    /** Handle to a node of the graph, usable as the operand of later nodes */
+    using NodeId = NEElementwiseOpGraphKernel::NodeId;
+
+    /** Add a source tensor to the graph.
+     *
+     * @param[in] input Input tensor. Data type supported: U8. All inputs must have the same shape.
+     *
+     * @return Handle to the new node
+     */
+    NodeId add_input(const ITensor *input);
+    /** Add a thresholding node, following the semantics of @ref NEThresholdKernel.
+     *
+     * @param[in] src         Operand node.
+     * @param[in] threshold   Threshold. When the threshold type is RANGE, this is used as the lower threshold.
+     * @param[in] false_value Value to set when the condition is not respected.
+     * @param[in] true_value  Value to set when the condition is respected.
+     * @param[in] type        (Optional) Thresholding type. Either RANGE or BINARY, BINARY by default.
+     * @param[in] upper       (Optional) Upper threshold. Only used when the thresholding type is RANGE.
+     *
+     * @return Handle to the new node
+     */
+    NodeId add_threshold(NodeId src, uint8_t threshold, uint8_t false_value, uint8_t true_value, ThresholdType type = ThresholdType::BINARY, uint8_t upper = 0);
+    /** Add a bitwise AND node.
+     *
+     * @param[in] src0 First operand node.
+     * @param[in] src1 Second operand node.
+     *
+     * @return Handle to the new node
+     */
+    NodeId add_and(NodeId src0, NodeId src1);
+    /** Add a bitwise OR node.
+     *
+     * @param[in] src0 First operand node.
+     * @param[in] src1 Second operand node.
+     *
+     * @return Handle to the new node
+     */
+    NodeId add_or(NodeId src0, NodeId src1);
+    /** Add a bitwise XOR node.
+     *
+     * @param[in] src0 First operand node.
+     * @param[in] src1 Second operand node.
+     *
+     * @return Handle to the new node
+     */
+    NodeId add_xor(NodeId src0, NodeId src1);
+    /** Add a bitwise NOT node.
+     *
+     * @param[in] src Operand node.
+     *
+     * @return Handle to the new node
+     */
+    NodeId add_not(NodeId src);
+    /** Bind the value of a node to an output tensor. A node can feed any number of outputs.
+     *
+     * @param[in]  node   Node whose value is written out.
+     * @param[out] output Output tensor. Data type supported: U8. Shape must match the inputs.
+     */
+    void add_output(NodeId node, ITensor *output);
+    /** Seal the graph and configure the underlying kernel. No nodes can be added afterwards. */
+    void configure();
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    NEElementwiseOpGraphKernel _kernel;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEELEMENTWISEOPGRAPH_H__ */
@@ -24,8 +24,9 @@
 #ifndef __ARM_COMPUTE_NEFLATTENLAYER_H__
 #define __ARM_COMPUTE_NEFLATTENLAYER_H__
 
+#include "arm_compute/core/NEON/kernels/NEIm2ColKernel.h"
 #include "arm_compute/core/Types.h"
-#include "arm_compute/runtime/NEON/INESimpleFunction.h"
+#include "arm_compute/runtime/IFunction.h"
 
 namespace arm_compute
 {
@@ -35,10 +36,16 @@ class ITensor;
 *
 * -# @ref NEIm2ColKernel
 *
+* When both tensors are dense (no padding) flattening preserves the memory layout, so the copy
+* can be elided: if the output tensor has not been allocated by the time of the first run (or of
+* prepare()), its allocator imports the input's buffer and the kernel is never scheduled.
+* Allocating the output as usual keeps the copying behaviour.
 */
-class NEFlattenLayer : public INESimpleFunction
+class NEFlattenLayer : public IFunction
 {
 public:
+    /** Default constructor */
+    NEFlattenLayer();
     /** Initialise the kernel's input and output.
      *
      * @param[in]  input  First input tensor to flatten with at least 3 dimensions. The dimensions over the third will be interpreted as batches. Data types supported: QS8/QS16/F16/F32
@@ -46,6 +53,17 @@ public:
      *             w = width input tensor, h = height input tensor and d = depth input tensor. Data type supported: same as @p input
      */
     void configure(const ITensor *input, ITensor *output);
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    NEIm2ColKernel _kernel;      /**< Kernel used when the copy cannot be elided */
+    const ITensor *_input;       /**< Source tensor */
+    ITensor       *_output;      /**< Destination tensor */
+    bool           _is_aliased;  /**< True if the output aliases the input's buffer */
+    bool           _is_prepared; /**< True if the aliasing decision has been taken */
 };
 } // namespace arm_compute
 
@@ -30,11 +30,14 @@
 #include "arm_compute/core/NEON/kernels/NEGEMMMatrixAccumulateBiasesKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMMatrixMultiplyKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMTranspose1xWKernel.h"
+#include "arm_compute/core/NEON/kernels/NEGEMVKernel.h"
 #include "arm_compute/core/NEON/kernels/NEIm2ColKernel.h"
 #include "arm_compute/core/NEON/kernels/NETransposeKernel.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/Tensor.h"
 
+#include <string>
+
 namespace arm_compute
 {
 /** Basic function to reshape the weights of Fully Connected layer with NEON. This function calls the following kernels:
@@ -74,6 +77,7 @@ private:
  *  -# @ref NEIm2ColKernel                      (called when the input comes from a convolutional layer)
  *  -# @ref NEFullyConnectedLayerReshapeWeights (if @p are_weights_reshaped flag is set to false) (called once)
  *  -# @ref NEGEMMInterleave4x4Kernel (called if we have a multi-batch input)
+ *  -# @ref NEGEMVKernel (called instead of @ref NEGEMMMatrixMultiplyKernel for batch-1 F32 inputs)
  *  -# @ref NEGEMMMatrixMultiplyKernel
  *  -# @ref NEGEMMMatrixAccumulateBiasesKernel (if @p biases is not equal to nullptr)
  *
@@ -97,6 +101,15 @@ public:
 
     //Inherited methods override
     void run() override;
+    void prepare() override;
+    /** Indicates whether the function still reads the caller's weights tensor after @ref prepare
+     *
+     * When false, the weights have been baked into the function's own reshaped tensor and the
+     * caller may free the original weights once every function sharing them has been prepared.
+     *
+     * @return True if the original weights are still read at run time
+     */
+    bool original_weights_retained() const;
 
 private:
     MemoryGroup                         _memory_group;
@@ -104,14 +117,19 @@ private:
     NEFullyConnectedLayerReshapeWeights _reshape_weights_kernel;
     NEGEMMInterleave4x4Kernel           _interleave4x4_kernel;
     NEGEMMMatrixMultiplyKernel          _mm_kernel;
+    NEGEMVKernel                        _gemv_kernel;
     NEGEMMMatrixAccumulateBiasesKernel  _accumulate_biases_kernel;
     Tensor                              _im2col_output;
     Tensor                              _interleave4x4_output;
     Tensor                              _reshape_weights_output;
+    const ITensor                      *_original_weights;
+    std::string                         _weights_transform;
     bool                                _are_weights_reshaped;
     bool                                _is_batched_fc_layer;
+    bool                                _use_gemv;
     bool                                _linearize_input;
     bool                                _accumulate_biases;
+    bool                                _original_weights_retained;
 };
 }
 #endif /* __ARM_COMPUTE_NEFULLYCONNECTEDLAYER_H__ */
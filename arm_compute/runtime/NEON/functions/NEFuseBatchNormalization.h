@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEFUSEBATCHNORMALIZATION_H__
+#define __ARM_COMPUTE_NEFUSEBATCHNORMALIZATION_H__
+
+#include "arm_compute/runtime/NEON/INESimpleFunction.h"
+
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to run @ref NEFuseBatchNormalizationKernel
+ *
+ * Folds batch normalization parameters into convolution weights and biases at configure time,
+ * so the fused tensors can be passed to @ref NEConvolutionLayer and the batch normalization
+ * pass can be dropped from the inference graph.
+ */
+class NEFuseBatchNormalization : public INESimpleFunction
+{
+public:
+    /** Set the source and destination tensors.
+     *
+     * @param[in]  weights       Convolution weights tensor. 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: F32.
+     * @param[in]  bias          Convolution biases tensor. 1D tensor with dimensions [OFM]. Can be nullptr. Data type supported: same as @p weights.
+     * @param[out] fused_weights Destination weights tensor. Same shape as @p weights. Data type supported: same as @p weights.
+     * @param[out] fused_bias    Destination biases tensor. 1D tensor with dimensions [OFM]. Data type supported: same as @p weights.
+     * @param[in]  mean          Batch normalization mean tensor. 1D tensor with dimensions [OFM]. Data type supported: same as @p weights.
+     * @param[in]  var           Batch normalization variance tensor. 1D tensor with dimensions [OFM]. Data type supported: same as @p weights.
+     * @param[in]  beta          Batch normalization beta tensor. 1D tensor with dimensions [OFM]. Can be nullptr (treated as 0). Data type supported: same as @p weights.
+     * @param[in]  gamma         Batch normalization gamma tensor. 1D tensor with dimensions [OFM]. Can be nullptr (treated as 1). Data type supported: same as @p weights.
+     * @param[in]  epsilon       Small value to avoid division with zero.
+     */
+    void configure(const ITensor *weights, const ITensor *bias, ITensor *fused_weights, ITensor *fused_bias,
+                   const ITensor *mean, const ITensor *var, const ITensor *beta, const ITensor *gamma, float epsilon);
+    /** Set the source and destination tensors using the folded (scale, shift) form of the
+     * batch normalization parameters, e.g. as exposed by @ref NEBatchNormalizationLayer.
+     *
+     * @param[in]  weights       Convolution weights tensor. 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: F32.
+     * @param[in]  bias          Convolution biases tensor. 1D tensor with dimensions [OFM]. Can be nullptr. Data type supported: same as @p weights.
+     * @param[out] fused_weights Destination weights tensor. Same shape as @p weights. Data type supported: same as @p weights.
+     * @param[out] fused_bias    Destination biases tensor. 1D tensor with dimensions [OFM]. Data type supported: same as @p weights.
+     * @param[in]  scale         Folded scale tensor. 1D tensor with dimensions [OFM]. Data type supported: same as @p weights.
+     * @param[in]  shift         Folded shift tensor. 1D tensor with dimensions [OFM]. Data type supported: same as @p weights.
+     */
+    void configure(const ITensor *weights, const ITensor *bias, ITensor *fused_weights, ITensor *fused_bias,
+                   const ITensor *scale, const ITensor *shift);
+};
+}
+#endif /* __ARM_COMPUTE_NEFUSEBATCHNORMALIZATION_H__ */
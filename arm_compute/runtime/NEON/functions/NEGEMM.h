@@ -81,6 +81,7 @@ private:
     Tensor                                    _tmp_b;
     Tensor                                    _workspace;
     bool                                      _run_vector_matrix_multiplication;
+    bool                                      _run_interleave;
     bool                                      _run_addition;
 };
 }
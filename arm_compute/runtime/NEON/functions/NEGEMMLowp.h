@@ -36,6 +36,7 @@
 #include "arm_compute/runtime/MemoryGroup.h"
 
 #include <memory>
+#include <vector>
 
 namespace arm_compute
 {
@@ -65,7 +66,7 @@ public:
     *  -# Multiply each entry of the result and round to the nearest integer
     *  -# Clamp the resulting int32 values to the [0..255] range and cast to uint8.
     *
-    * @param[in]  a               First input tensor  (Matrix A). Data type supported: U8.
+    * @param[in]  a               First input tensor  (Matrix A). Data type supported: U8/QASYMM8.
     * @param[in]  b               Second input tensor (Matrix B). Data type supported: same as @p a
     * @param[out] output          Output tensor. Data type supported: same as @p a.
     * @param[in]  a_offset        Offset to be added to each element of the matrix A.
@@ -75,10 +76,41 @@ public:
     * @param[in]  shift           Number of bits to shift right the result.
     */
     void configure(const ITensor *a, const ITensor *b, ITensor *output, int32_t a_offset, int32_t b_offset, int32_t output_offset, int32_t output_mult_int, int32_t shift);
+    /** Initialise the kernel's inputs and output, deriving the requantization parameters from the tensors' QuantizationInfo
+    *
+    * The matrix offsets and the fixed-point multiplier applied to the int32 accumulator are computed from the
+    * QuantizationInfo of @p a, @p b and @p output, so that each uint8 value q represents the real value
+    * (q - offset) * scale in the corresponding tensor's quantization space.
+    *
+    * @param[in]  a      First input tensor  (Matrix A). Data type supported: QASYMM8.
+    * @param[in]  b      Second input tensor (Matrix B). Data type supported: same as @p a
+    * @param[out] output Output tensor. Data type supported: same as @p a.
+    */
+    void configure(const ITensor *a, const ITensor *b, ITensor *output);
+    /** Initialise the kernel's inputs and output with a per-channel requantization multiplier
+    *
+    * Each output column (i.e. each output channel when the product implements a convolution) is
+    * requantized with its own real multiplier, typically (a_scale * b_scale(channel)) / out_scale
+    * for per-channel quantized weights. Every multiplier is decomposed into a Q31 fixed-point
+    * multiplier and a shift, which the matrix multiply kernel applies with saturating
+    * rounding-doubling arithmetic in its epilogue.
+    *
+    * @param[in]  a                  First input tensor  (Matrix A). Data type supported: U8/QASYMM8.
+    * @param[in]  b                  Second input tensor (Matrix B). Data type supported: same as @p a
+    * @param[out] output             Output tensor. Data type supported: same as @p a.
+    * @param[in]  a_offset           Offset to be added to each element of the matrix A.
+    * @param[in]  b_offset           Offset to be added to each element of the matrix B.
+    * @param[in]  output_offset      Offset to be added to each requantized element of the output matrix.
+    * @param[in]  output_multipliers Real multiplier of each output column, in (0, 1). Must have one entry per column.
+    */
+    void configure(const ITensor *a, const ITensor *b, ITensor *output, int32_t a_offset, int32_t b_offset, int32_t output_offset, const std::vector<float> &output_multipliers);
     // Inherited methods overridden:
     void run() override;
 
 private:
+    /** Validate the matrix shapes and configure the interleave and transpose kernels with their intermediate buffers */
+    void configure_reshaping(const ITensor *a, const ITensor *b, const ITensor *output);
+
     MemoryGroup                    _memory_group;
     NEGEMMInterleave4x4Kernel      _interleave_kernel;
     NEGEMMTranspose1xWKernel       _transpose_kernel;
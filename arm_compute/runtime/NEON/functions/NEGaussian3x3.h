@@ -43,6 +43,8 @@ class NEGaussian3x3 : public INESimpleFunction
 {
 public:
     /** Initialise the function's input, output and border mode.
+     *
+     * @note A batch of images can be filtered in a single call by passing 3D tensors with the batch as the third dimension.
      *
      * @param[in, out] input                 Source tensor. Data type supported: U8. (Written to only for @p border_mode != UNDEFINED)
      * @param[out]     output                Destination tensor, Data type supported: U8.
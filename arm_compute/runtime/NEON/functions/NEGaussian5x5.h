@@ -29,8 +29,6 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
-#include "arm_compute/runtime/MemoryGroup.h"
-#include "arm_compute/runtime/Tensor.h"
 
 #include <cstdint>
 #include <memory>
@@ -42,14 +40,16 @@ class ITensor;
 /** Basic function to execute gaussian filter 5x5. This function calls the following NEON kernels:
  *
  * -# @ref NEFillBorderKernel (executed if border_mode == CONSTANT or border_mode == REPLICATE)
- * -# @ref NEGaussian5x5HorKernel
- * -# @ref NEGaussian5x5VertKernel
+ * -# @ref NEGaussian5x5FusedKernel
  *
  */
 class NEGaussian5x5 : public IFunction
 {
 public:
     /** Default constructor
+     *
+     * @note The memory manager is accepted for API compatibility but is not used: the fused
+     *       kernel has no frame-sized intermediate to manage.
      */
     NEGaussian5x5(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
     /** Initialise the function's input, output and border mode.
@@ -65,11 +65,8 @@ public:
     void run() override;
 
 protected:
-    MemoryGroup             _memory_group;   /**< Function memory group */
-    NEGaussian5x5HorKernel  _kernel_hor;     /**< kernel for horizontal pass */
-    NEGaussian5x5VertKernel _kernel_vert;    /**< kernel for vertical pass */
-    Tensor                  _tmp;            /**< temporary buffer for output of horizontal pass */
-    NEFillBorderKernel      _border_handler; /**< kernel to handle tensor borders */
+    NEGaussian5x5FusedKernel _kernel;         /**< fused kernel for the horizontal and vertical passes */
+    NEFillBorderKernel       _border_handler; /**< kernel to handle tensor borders */
 };
 }
 #endif /*__ARM_COMPUTE_NEGAUSSIAN5x5_H__ */
@@ -25,16 +25,19 @@
 #define __ARM_COMPUTE_NEGAUSSIANPYRAMID_H__
 
 #include "arm_compute/core/IPyramid.h"
+#include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
+#include "arm_compute/core/NEON/kernels/NEGaussian5x5Kernel.h"
 #include "arm_compute/core/NEON/kernels/NEGaussianPyramidKernel.h"
+#include "arm_compute/core/NEON/kernels/NEScaleKernel.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
-#include "arm_compute/runtime/NEON/functions/NEGaussian5x5.h"
-#include "arm_compute/runtime/NEON/functions/NEScale.h"
+#include "arm_compute/runtime/IScheduler.h"
 #include "arm_compute/runtime/Pyramid.h"
 #include "arm_compute/runtime/Tensor.h"
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace arm_compute
 {
@@ -76,8 +79,7 @@ protected:
 /** Basic function to execute gaussian pyramid with HALF scale factor. This function calls the following NEON kernels:
  *
  * -# @ref NEFillBorderKernel (executed if border_mode == CONSTANT or border_mode == REPLICATE)
- * -# @ref NEGaussianPyramidHorKernel
- * -# @ref NEGaussianPyramidVertKernel
+ * -# @ref NEGaussianPyramidFusedKernel
  *
  */
 class NEGaussianPyramidHalf : public NEGaussianPyramid
@@ -91,17 +93,19 @@ public:
     void run() override;
 
 private:
-    std::unique_ptr<NEFillBorderKernel[]>          _border_handler;
-    std::unique_ptr<NEGaussianPyramidHorKernel[]>  _horizontal_reduction;
-    std::unique_ptr<NEGaussianPyramidVertKernel[]> _vertical_reduction;
+    std::unique_ptr<NEFillBorderKernel[]>           _border_handler;
+    std::unique_ptr<NEGaussianPyramidFusedKernel[]> _reduction;
 };
 
-/** Basic function to execute gaussian pyramid with ORB scale factor. This function calls the following NEON kernels and functions:
+/** Basic function to execute gaussian pyramid with ORB scale factor. This function calls the following NEON kernels:
  *
  * -# @ref NEFillBorderKernel (executed if border_mode == CONSTANT or border_mode == REPLICATE)
- * -# @ref NEGaussian5x5
+ * -# @ref NEGaussian5x5FusedKernel
  * -# @ref NEScaleKernel
  *
+ * The scale ratio of every level is fixed, so all per-level state (kernel windows and the
+ * nearest-neighbour offset tables of the resamples) is built once at configure time and the
+ * whole level chain runs as a single pre-built kernel sequence per frame.
  */
 class NEGaussianPyramidOrb : public NEGaussianPyramid
 {
@@ -114,8 +118,11 @@ public:
     void run() override;
 
 private:
-    std::unique_ptr<NEGaussian5x5[]> _gaus5x5;
-    std::unique_ptr<NEScale[]>       _scale_nearest;
+    std::unique_ptr<NEFillBorderKernel[]>       _border_handler;
+    std::unique_ptr<NEGaussian5x5FusedKernel[]> _gaus5x5;
+    std::unique_ptr<NEScaleKernel[]>            _scale_nearest;
+    std::unique_ptr<Tensor[]>                   _offsets;
+    std::vector<IScheduler::WorkItem>           _sequence;
 };
 }
 #endif /*__ARM_COMPUTE_NEGAUSSIANPYRAMID_H__ */
@@ -25,7 +25,9 @@
 #define __ARM_COMPUTE_NEHISTOGRAM_H__
 
 #include "arm_compute/core/NEON/kernels/NEHistogramKernel.h"
+#include "arm_compute/runtime/Distribution1D.h"
 #include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/Tensor.h"
 
 #include <cstddef>
 #include <cstdint>
@@ -43,19 +45,50 @@ public:
     NEHistogram();
     /** Initialise the kernel's inputs.
      *
-     * @param[in]  input  Input image. Data type supported: U8.
-     * @param[out] output Output distribution.
+     * @param[in]  input       Input image. Data type supported: U8.
+     * @param[out] output      Output distribution.
+     * @param[in]  incremental (Optional) If true, keep a snapshot of the last processed frame so
+     *                         that @ref update can refresh the distribution from a changed region
+     *                         only. Costs one U8 copy of the frame.
      */
-    void configure(const IImage *input, IDistribution1D *output);
+    void configure(const IImage *input, IDistribution1D *output, bool incremental = false);
+
+    /** Refresh the distribution from a changed region of the input.
+     *
+     * Subtracts the snapshot's contribution over the region, accumulates the current pixels and
+     * refreshes the snapshot, leaving the distribution as if the whole frame had been re-read.
+     * Intended for video streams where consecutive frames differ little: pixels outside the
+     * region must be unchanged since the previous @ref run or @ref update.
+     *
+     * @note The function must have been configured as incremental and run at least once.
+     *
+     * @param[in] anchor Coordinates of the top-left corner of the changed region.
+     * @param[in] shape  Shape of the changed region. Clipped to the image boundaries.
+     */
+    void update(const Coordinates &anchor, const TensorShape &shape);
 
     // Inherited methods overridden:
     void run() override;
 
 private:
-    NEHistogramKernel           _histogram_kernel;
-    std::unique_ptr<uint32_t[]> _local_hist;
-    std::unique_ptr<uint32_t[]> _window_lut;
-    size_t                      _local_hist_size;
+    /** Copies a region of the input image into the snapshot
+     *
+     * @param[in] start_x First column to copy
+     * @param[in] end_x   Column to stop copying at
+     * @param[in] start_y First row to copy
+     * @param[in] end_y   Row to stop copying at
+     */
+    void refresh_snapshot(int start_x, int end_x, int start_y, int end_y);
+
+    NEHistogramKernel               _histogram_kernel;
+    NEHistogramKernel               _snapshot_kernel; /**< Kernel computing the stale contribution of the changed region */
+    std::unique_ptr<uint32_t[]>     _window_lut;
+    const IImage                   *_input;           /**< Input image */
+    IDistribution1D                *_output;          /**< Output distribution */
+    Tensor                          _snapshot;        /**< Copy of the last processed frame, kept while incremental */
+    std::unique_ptr<Distribution1D> _stale_dist;      /**< Histogram of the changed region of the snapshot */
+    bool                            _incremental;     /**< Whether a snapshot of the last frame is maintained */
+    bool                            _has_snapshot;    /**< Whether the snapshot holds a processed frame */
     /** 256 possible pixel values as we handle only U8 images */
     static constexpr unsigned int window_lut_default_size = 256;
 };
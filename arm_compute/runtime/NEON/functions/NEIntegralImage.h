@@ -24,22 +24,41 @@
 #ifndef __ARM_COMPUTE_NEINTEGRALIMAGE_H__
 #define __ARM_COMPUTE_NEINTEGRALIMAGE_H__
 
-#include "arm_compute/runtime/NEON/INESimpleFunction.h"
+#include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
+#include "arm_compute/core/NEON/kernels/NEIntegralImageKernel.h"
+#include "arm_compute/runtime/IFunction.h"
 
 namespace arm_compute
 {
 class ITensor;
 
-/** Basic function to run a @ref NEIntegralImageKernel */
-class NEIntegralImage : public INESimpleFunction
+/** Basic function to compute an image integral. This function calls the following NEON kernels:
+ *
+ * -# @ref NEIntegralImageKernel (row-wise prefix sums, split across rows)
+ * -# @ref NEIntegralImageVertKernel (column accumulation, split across column strips)
+ *
+ * Computing the summed-area table in one raster scan serializes on its carried dependency;
+ * the two separable stages are each fully parallel, so the computation scales with cores.
+ */
+class NEIntegralImage : public IFunction
 {
 public:
+    /** Default constructor */
+    NEIntegralImage();
     /** Initialise the function's source, destinations and border mode.
-        *
-        * @param[in]  input  Source tensor. Data type supported: U8.
-        * @param[out] output Destination tensor. Data type supported: U32.
-        */
+     *
+     * @param[in]  input  Source tensor. Data type supported: U8.
+     * @param[out] output Destination tensor. Data type supported: U32.
+     */
     void configure(const ITensor *input, ITensor *output);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    NEIntegralImageKernel     _hor_kernel;     /**< Kernel computing the row-wise prefix sums */
+    NEIntegralImageVertKernel _vert_kernel;    /**< Kernel accumulating the prefix sums down the columns */
+    NEFillBorderKernel        _border_handler; /**< Kernel to handle image borders */
 };
 }
 #endif /*__ARM_COMPUTE_NEINTEGRALIMAGE_H__ */
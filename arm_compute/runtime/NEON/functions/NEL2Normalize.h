@@ -27,9 +27,6 @@
 #include "arm_compute/core/NEON/kernels/NEL2NormalizeKernel.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
-#include "arm_compute/runtime/MemoryGroup.h"
-#include "arm_compute/runtime/NEON/functions/NEReductionOperation.h"
-#include "arm_compute/runtime/Tensor.h"
 
 #include <memory>
 
@@ -40,13 +37,17 @@ class ITensor;
 /** Basic function to perform a L2 normalization on a given axis.
  *
  * This function runs the following kernels:
- * -# @ref NEReductionOperation
- * -# @ref NEL2NormalizeKernel
+ * -# @ref NEL2NormalizeKernel (fused mode: the kernel sums each row's squares and rescales the
+ *    row immediately, so no separate reduction pass or intermediate sum tensor is needed)
  */
 class NEL2Normalize : public IFunction
 {
 public:
-    /** Constructor */
+    /** Constructor
+     *
+     * @note The memory manager is accepted for API compatibility but is not used: the fused
+     *       kernel has no intermediate sum tensor to manage.
+     */
     NEL2Normalize(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
     /** Set the input and output tensors.
      *
@@ -61,10 +62,7 @@ public:
     void run() override;
 
 private:
-    MemoryGroup          _memory_group;
-    NEReductionOperation _reduce_func;
-    NEL2NormalizeKernel  _normalize_kernel;
-    Tensor               _sumsq;
+    NEL2NormalizeKernel _normalize_kernel;
 };
 }
 #endif /* __ARM_COMPUTE_NEL2NORMALIZE_H__ */
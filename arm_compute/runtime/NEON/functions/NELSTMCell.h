@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NELSTMCELL_H__
+#define __ARM_COMPUTE_NELSTMCELL_H__
+
+#include "arm_compute/core/NEON/kernels/NELSTMCellUpdateKernel.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to run one time step of an LSTM cell on NEON. This function calls the following NEON kernels and functions:
+ *
+ *  -# @ref NEFullyConnectedLayer  (one packed matrix multiply producing the pre-activations of all four gates)
+ *  -# @ref NELSTMCellUpdateKernel (gate activations and element-wise state updates in one pass)
+ *
+ * The input and recurrent weights are packed side by side into a single matrix when the function is
+ * first run, so the whole time step costs one matrix multiply plus a single traversal of the state
+ * instead of the eight function dispatches of an unfused GEMM/addition/activation assembly.
+ */
+class NELSTMCell : public IFunction
+{
+public:
+    /** Constructor */
+    NELSTMCell(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Set the input and output tensors.
+     *
+     * The gates are laid out in the order: input, forget, cell, output.
+     *
+     * @param[in]     input             Input vector x at the current time step. Size: input_size. Data type supported: F32.
+     * @param[in]     input_weights     Input weights W_x. 2D tensor of dimensions [input_size, 4 * hidden_size]. Data type supported: Same as @p input.
+     * @param[in]     recurrent_weights Recurrent weights W_h. 2D tensor of dimensions [hidden_size, 4 * hidden_size]. Data type supported: Same as @p input.
+     * @param[in]     bias              Gate bias. Vector of size 4 * hidden_size. Data type supported: Same as @p input.
+     * @param[in,out] hidden_state      Hidden state h. Vector of size hidden_size, read as the previous output and overwritten with the new one. Data type supported: Same as @p input.
+     * @param[in,out] cell_state        Cell state c. Vector of size hidden_size, read and updated in place. Data type supported: Same as @p input.
+     */
+    void configure(const ITensor *input, const ITensor *input_weights, const ITensor *recurrent_weights, const ITensor *bias, ITensor *hidden_state, ITensor *cell_state);
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    MemoryGroup            _memory_group;
+    NEFullyConnectedLayer  _fc;
+    NELSTMCellUpdateKernel _update_kernel;
+    Tensor                 _packed_weights;
+    Tensor                 _packed_input;
+    Tensor                 _gates;
+    const ITensor         *_input;
+    const ITensor         *_input_weights;
+    const ITensor         *_recurrent_weights;
+    ITensor               *_hidden_state;
+    bool                   _is_first_run;
+};
+}
+#endif /* __ARM_COMPUTE_NELSTMCELL_H__ */
@@ -68,6 +68,7 @@ public:
 
     // Inherited methods overridden:
     void run() override;
+    void prepare() override;
 
 private:
     MemoryGroup                            _memory_group;
@@ -77,6 +78,7 @@ private:
     NECol2ImKernel                         _output_col2im_kernel;
     Tensor                                 _input_im2col_reshaped;
     Tensor                                 _weights_reshaped;
+    Tensor                                 _weights_packed;
     Tensor                                 _gemm_output;
     bool                                   _is_first_run;
 };
@@ -29,6 +29,7 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
 
+#include <atomic>
 #include <cstdint>
 
 namespace arm_compute
@@ -48,17 +49,32 @@ public:
      * @param[in, out] input  Input image. Data types supported: U8. (Written to only for border filling)
      * @param[out]     mean   Output average pixel value.
      * @param[out]     stddev (Optional) Output standard deviation of pixel values.
+     * @param[in]      alpha  (Optional) Weight of the current frame in an exponentially-weighted
+     *                        accumulation across calls to @ref run, in (0, 1]. The default of 1
+     *                        reports each frame's statistics unsmoothed; smaller values blend the
+     *                        frame into the running mean and variance, smoothing the outputs over
+     *                        a video stream. The first run seeds the running statistics.
      */
-    void configure(IImage *input, float *mean, float *stddev = nullptr);
+    void configure(IImage *input, float *mean, float *stddev = nullptr, float alpha = 1.f);
+    /** Discards the running statistics so the next @ref run seeds them afresh, e.g. on a scene cut */
+    void reset_history();
 
     // Inherited methods overridden:
     void run() override;
 
 private:
-    NEMeanStdDevKernel _mean_stddev_kernel; /**< Kernel that standard deviation calculation. */
-    NEFillBorderKernel _fill_border_kernel; /**< Kernel that fills tensor's borders with zeroes. */
-    uint64_t           _global_sum;         /**< Variable that holds the global sum among calls in order to ease reduction */
-    uint64_t           _global_sum_squared; /**< Variable that holds the global sum of squared values among calls in order to ease reduction */
+    NEMeanStdDevKernel    _mean_stddev_kernel; /**< Kernel that standard deviation calculation. */
+    NEFillBorderKernel    _fill_border_kernel;  /**< Kernel that fills tensor's borders with zeroes. */
+    std::atomic<uint64_t> _global_sum;          /**< Variable that holds the global sum among calls in order to ease reduction */
+    std::atomic<uint64_t> _global_sum_squared;  /**< Variable that holds the global sum of squared values among calls in order to ease reduction */
+    float                *_mean;                /**< User output for the (smoothed) mean */
+    float                *_stddev;              /**< User output for the (smoothed) standard deviation */
+    float                 _alpha;               /**< Weight of the current frame, 1 disables smoothing */
+    float                 _frame_mean;          /**< Mean of the current frame while smoothing */
+    float                 _frame_stddev;        /**< Standard deviation of the current frame while smoothing */
+    float                 _ew_mean;             /**< Exponentially-weighted running mean */
+    float                 _ew_var;              /**< Exponentially-weighted running variance */
+    bool                  _has_history;         /**< Whether the running statistics have been seeded */
 };
 }
 #endif /*__ARM_COMPUTE_NEMEANSTDDEV_H__ */
@@ -38,8 +38,9 @@ using IImage = ITensor;
 
 /** Basic function to execute min and max location. This function calls the following NEON kernels:
  *
- * -# NEMinMaxKernel
  * -# NEMinMaxLocationKernel
+ *
+ * The kernel finds the values, counts and locations in a single pass over the image.
  */
 class NEMinMaxLocation : public IFunction
 {
@@ -64,8 +65,7 @@ public:
     void run() override;
 
 private:
-    NEMinMaxKernel         _min_max;     /**< Kernel that performs min/max */
-    NEMinMaxLocationKernel _min_max_loc; /**< Kernel that extracts min/max locations */
+    NEMinMaxLocationKernel _min_max_loc; /**< Kernel that finds min/max values and their locations */
 };
 }
 #endif /*__ARM_COMPUTE_NEMINMAXLOCATION_H__ */
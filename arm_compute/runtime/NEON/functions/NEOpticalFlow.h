@@ -72,11 +72,23 @@ public:
      * @param[in]  use_initial_estimate  The flag to indicate whether the initial estimated position should be used
      * @param[in]  border_mode           The border mode applied at scharr kernel stage
      * @param[in]  constant_border_value (Optional) Constant value to use for borders if border_mode is set to CONSTANT
+     * @param[in]  pyramid_handoff       (Optional) Retain the newer pyramid between run() calls: the two pyramids
+     *                                   alternate roles every frame, so the caller only rebuilds the one returned
+     *                                   by @ref input_pyramid() instead of both. Defaults to false.
      *
      */
     void configure(const Pyramid *old_pyramid, const Pyramid *new_pyramid, const IKeyPointArray *old_points, const IKeyPointArray *new_points_estimates,
                    IKeyPointArray *new_points, Termination termination, float epsilon, unsigned int num_iterations, size_t window_dimension,
-                   bool use_initial_estimate, BorderMode border_mode, uint8_t constant_border_value = 0);
+                   bool use_initial_estimate, BorderMode border_mode, uint8_t constant_border_value = 0, bool pyramid_handoff = false);
+    /** Pyramid that has to hold the next input frame for the upcoming run()
+     *
+     * In pyramid handoff mode the pyramid returned here is the one whose previous content has
+     * already been consumed as the old frame, so it is the only one the caller needs to rebuild
+     * before the next run(). Without handoff it is always the pyramid passed as @p new_pyramid.
+     *
+     * @return Pyramid to fill with the next frame
+     */
+    const Pyramid *input_pyramid() const;
 
     // Inherited methods overridden:
     void run() override;
@@ -93,6 +105,10 @@ private:
     LKInternalKeypointArray              _new_points_internal;
     LKInternalKeypointArray              _old_points_internal;
     unsigned int                         _num_levels;
+    const Pyramid                       *_old_pyramid;
+    const Pyramid                       *_new_pyramid;
+    bool                                 _pyramid_handoff;
+    unsigned int                         _frame_parity;
 };
 }
 #endif /*__ARM_COMPUTE_NEOPTICALFLOW_H__ */
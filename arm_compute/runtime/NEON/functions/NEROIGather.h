@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEROIGATHER_H__
+#define __ARM_COMPUTE_NEROIGATHER_H__
+
+#include "arm_compute/core/IArray.h"
+#include "arm_compute/runtime/NEON/INESimpleFunction.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to run @ref NEROIGatherKernel
+ *
+ * Gathers regions of interest of a source frame directly into a batched tensor: each region is
+ * resized with bilinear interpolation into one batch slice of the output. Detection cascades
+ * that run a small network on many crops per frame can thereby feed a single batched inference
+ * instead of copying and running each crop separately, amortizing dispatch overhead and
+ * enabling the batched execution paths. The number of regions may change between frames
+ * without reconfiguring.
+ */
+class NEROIGather : public INESimpleFunction
+{
+public:
+    /** Set the input frame, the regions of interest and the output batch.
+     *
+     * @param[in]  input  Source frame. Data types supported: U8/F32.
+     * @param[in]  rois   Array of regions of interest to gather.
+     * @param[out] output Destination tensor of 3 dimensions: each region is resized to the
+     *                    first two dimensions, the third is the batch. Data types supported:
+     *                    same as @p input.
+     */
+    void configure(const ITensor *input, const IROIArray *rois, ITensor *output);
+};
+}
+#endif /* __ARM_COMPUTE_NEROIGATHER_H__ */
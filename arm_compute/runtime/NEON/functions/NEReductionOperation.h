@@ -49,10 +49,18 @@ public:
      *
      * @param[in, out] input  Source tensor. Data type supported: F32. (Written to only for border_size != 0)
      * @param[out]     output Destination tensor. Data types supported: same as @p input.
-     * @param[in]      axis   Dimension along which to reduce. Supported reduction axis : 0
+     * @param[in]      axis   Dimension along which to reduce.
      * @param[in]      op     Reduction operation to perform.
      */
     void configure(ITensor *input, ITensor *output, unsigned int axis, ReductionOperation op);
+    /** Set the input and output tensors, reducing several dimensions in a single pass.
+     *
+     * @param[in, out] input  Source tensor. Data type supported: F32. (Written to only for border_size != 0)
+     * @param[out]     output Destination tensor. Data types supported: same as @p input.
+     * @param[in]      axes   Dimensions along which to reduce. Each entry is a dimension index of @p input.
+     * @param[in]      op     Reduction operation to perform.
+     */
+    void configure(ITensor *input, ITensor *output, const Coordinates &axes, ReductionOperation op);
 
     // Inherited methods overridden:
     void run() override;
@@ -24,8 +24,10 @@
 #ifndef __ARM_COMPUTE_NEREMAP_H__
 #define __ARM_COMPUTE_NEREMAP_H__
 
+#include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
+#include "arm_compute/core/NEON/kernels/NERemapKernel.h"
 #include "arm_compute/core/Types.h"
-#include "arm_compute/runtime/NEON/INESimpleFunction.h"
+#include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/Tensor.h"
 
 #include <cstdint>
@@ -39,10 +41,20 @@ class ITensor;
  * -# @ref NEFillBorderKernel (executed if border_mode == CONSTANT or border_mode == REPLICATE)
  * -# @ref NERemapKernel
  */
-class NERemap : public INESimpleFunction
+class NERemap : public IFunction
 {
 public:
+    /** Constructor */
+    NERemap();
     /** Initialise the function's sources, destination, interpolation policy and border mode.
+     *
+     * With @p compiled_maps the map tensors are treated as fixed (e.g. a lens-undistortion
+     * map): on the first run() they are compiled once into clamped integer offsets plus
+     * 8-bit fixed-point weights, and every frame after that is a pure gather and blend loop
+     * with no per-pixel coordinate evaluation or bounds checking. The maps must be filled
+     * before the first run and must not change afterwards; out-of-image samples replicate
+     * the border, and the 8-bit weights can differ from the floating-point path by one
+     * intensity step.
      *
      * @param[in, out] input                 Source tensor. Data type supported: U8. (Written to only for @p border_mode != UNDEFINED)
      * @param[in]      map_x                 Map for X coordinates. Data type supported: F32.
@@ -51,10 +63,28 @@ public:
      * @param[in]      policy                Interpolation policy to use. Only NEAREST and BILINEAR are supported.
      * @param[in]      border_mode           Border mode to use on the input tensor.
      * @param[in]      constant_border_value (Optional) Constant value to use for borders if border_mode is set to CONSTANT.
+     * @param[in]      compiled_maps         (Optional) True to compile the (immutable) maps on the first run.
      *
      */
     void configure(ITensor *input, const ITensor *map_x, const ITensor *map_y, ITensor *output,
-                   InterpolationPolicy policy, BorderMode border_mode, uint8_t constant_border_value = 0);
+                   InterpolationPolicy policy, BorderMode border_mode, uint8_t constant_border_value = 0,
+                   bool compiled_maps = false);
+    /** Trim the execution to an actual shape smaller than the configured maximum
+     *
+     * See @ref INESimpleFunction::set_actual_shape for the contract.
+     *
+     * @param[in] shape Actual shape to execute on.
+     */
+    void set_actual_shape(const TensorShape &shape);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    NERemapKernel      _remap_kernel;   /**< Kernel that performs the remap */
+    NEFillBorderKernel _border_handler; /**< Kernel to handle image borders */
+    bool               _compiled_maps;  /**< True when the maps are compiled on the first run */
+    bool               _maps_compiled;  /**< True once the maps have been compiled */
 };
 }
 #endif /*__ARM_COMPUTE_NEREMAP_H__ */
@@ -24,23 +24,43 @@
 #ifndef __ARM_COMPUTE_NERESHAPELAYER_H__
 #define __ARM_COMPUTE_NERESHAPELAYER_H__
 
+#include "arm_compute/core/NEON/kernels/NEReshapeLayerKernel.h"
 #include "arm_compute/core/Types.h"
-#include "arm_compute/runtime/NEON/INESimpleFunction.h"
+#include "arm_compute/runtime/IFunction.h"
 
 namespace arm_compute
 {
 class ITensor;
 
-/** Basic function to run @ref NEReshapeLayerKernel */
-class NEReshapeLayer : public INESimpleFunction
+/** Basic function to run @ref NEReshapeLayerKernel
+ *
+ * When both tensors are dense (no padding) a reshape is a pure metadata change, so the copy can
+ * be elided: if the output tensor has not been allocated by the time of the first run (or of
+ * prepare()), its allocator imports the input's buffer and the kernel is never scheduled.
+ * Allocating the output as usual keeps the copying behaviour.
+ */
+class NEReshapeLayer : public IFunction
 {
 public:
+    /** Default constructor */
+    NEReshapeLayer();
     /** Initialise the kernel's inputs and outputs
      *
      * @param[in]  input  First tensor input. Data type supported: U8/S8/QS8/U16/S16/QS16/U32/S32/F16/F32
      * @param[out] output Output tensor. Data type supported: Same as @p input
      */
     void configure(const ITensor *input, ITensor *output);
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    NEReshapeLayerKernel _kernel;      /**< Kernel used when the copy cannot be elided */
+    const ITensor       *_input;       /**< Source tensor */
+    ITensor             *_output;      /**< Destination tensor */
+    bool                 _is_aliased;  /**< True if the output aliases the input's buffer */
+    bool                 _is_prepared; /**< True if the aliasing decision has been taken */
 };
 }
 #endif /*__ARM_COMPUTE_NERESHAPELAYER_H__ */
@@ -46,6 +46,8 @@ public:
      */
     NEScale();
     /** Initialize the function's source, destination, interpolation type and border_mode.
+     *
+     * @note A batch of images can be scaled in a single call by passing 3D tensors with the batch as the third dimension.
      *
      * @param[in, out] input                 Source tensor. Data type supported: U8/F32. (Written to only for @p border_mode != UNDEFINED)
      * @param[out]     output                Destination tensor. Data type supported: Same as @p input. All but the lowest two dimensions must be the same size as in the input tensor, i.e. scaling is only performed within the XY-plane.
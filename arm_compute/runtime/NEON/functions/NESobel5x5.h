@@ -29,8 +29,6 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
-#include "arm_compute/runtime/MemoryGroup.h"
-#include "arm_compute/runtime/Tensor.h"
 
 #include <cstdint>
 #include <memory>
@@ -42,14 +40,17 @@ class ITensor;
 /** Basic function to execute sobel 5x5 filter. This function calls the following NEON kernels:
  *
  * -# @ref NEFillBorderKernel (executed if border_mode == CONSTANT or border_mode == REPLICATE)
- * -# @ref NESobel5x5HorKernel
- * -# @ref NESobel5x5VertKernel
+ * -# @ref NESobel5x5FusedKernel
  *
  */
 class NESobel5x5 : public IFunction
 {
 public:
-    /** Default constructor */
+    /** Default constructor
+     *
+     * @note The memory manager is accepted for API compatibility but is not used: the fused
+     *       kernel has no frame-sized intermediates to manage.
+     */
     NESobel5x5(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
     /** Initialise the function's source, destinations and border mode.
      *
@@ -68,12 +69,8 @@ public:
     void run() override;
 
 protected:
-    MemoryGroup          _memory_group;   /**< Function memory group */
-    NESobel5x5HorKernel  _sobel_hor;      /**< Sobel Horizontal 5x5 kernel */
-    NESobel5x5VertKernel _sobel_vert;     /**< Sobel Vertical 5x5 kernel */
-    Tensor               _tmp_x;          /**< Temporary buffer for Sobel X */
-    Tensor               _tmp_y;          /**< Temporary buffer for Sobel Y */
-    NEFillBorderKernel   _border_handler; /**< Kernel to handle tensor borders */
+    NESobel5x5FusedKernel _sobel;          /**< Fused Sobel 5x5 kernel */
+    NEFillBorderKernel    _border_handler; /**< Kernel to handle tensor borders */
 };
 }
 #endif /*__ARM_COMPUTE_NESOBEL5x5_H__ */
@@ -39,7 +39,10 @@ class ITensor;
  * Softmax is calculated by :
  * @f[ out = \frac{e^{x - max(x)}}{\sum{e^{x - max(x)}}} @f]
  *
- * This function runs the following kernels:
+ * For QASYMM8/F16/F32 this function runs the fused @ref NELogits1DSoftmaxKernel, which chains the max,
+ * exponentiation and normalization phases per row so the logits are only streamed from memory once.
+ *
+ * For QS8/QS16 this function runs the following kernels:
  * -# @ref NELogits1DMaxKernel
  * -# @ref NELogits1DShiftExpSumKernel
  * -# @ref NELogits1DNormKernel
@@ -51,7 +54,7 @@ public:
     NESoftmaxLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
     /** Set the input and output tensors.
      *
-     * @param[in]  input  Source tensor. Data types supported: QS8/QS16/F16/F32.
+     * @param[in]  input  Source tensor. Data types supported: QS8/QASYMM8/QS16/F16/F32.
      * @param[out] output Destination tensor. Data types supported: same as @p input.
      */
     void configure(ITensor *input, ITensor *output);
@@ -64,10 +67,12 @@ private:
     NELogits1DMaxKernel         _max_kernel;
     NELogits1DShiftExpSumKernel _shift_exp_sum_kernel;
     NELogits1DNormKernel        _norm_kernel;
+    NELogits1DSoftmaxKernel     _softmax_kernel;
     NEFillBorderKernel          _fill_border_kernel;
     Tensor                      _max;
     Tensor                      _sum;
     Tensor                      _tmp;
+    bool                        _run_fused;
 };
 }
 #endif /* __ARM_COMPUTE_NESOFTMAXLAYER_H__ */
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NETILECACHE_H__
+#define __ARM_COMPUTE_NETILECACHE_H__
+
+#include "arm_compute/core/NEON/kernels/NETileChecksumKernel.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Run-to-run result cache for window-based kernels with a deterministic row mapping.
+ *
+ * Video pipelines re-run stages like HOG block descriptors or pooling on every frame although
+ * typically only a small part of the image changes between consecutive frames. This function
+ * wraps an already configured kernel: each run it computes a cheap per-tile checksum of the
+ * input with @ref NETileChecksumKernel, compares it against the previous frame and re-executes
+ * the kernel only over the output rows fed by changed tiles. Outputs of unchanged tiles are
+ * copied forward from an internal cache of the previous result.
+ *
+ * The wrapped kernel must be pure (output rows depend only on input rows) and its window's
+ * second dimension must iterate the output rows, so that input row bands map to output row
+ * bands by the height ratio. Kernels whose window reads beyond a band (e.g. pooling with
+ * kernel size larger than the stride) declare the overlap through @p halo_rows.
+ */
+class NETileCache : public IFunction
+{
+public:
+    /** Default constructor */
+    NETileCache();
+
+    /** Set the kernel to wrap and the tiling parameters.
+     *
+     * @param[in]      kernel    Kernel to wrap. Must already be configured on @p input and @p output.
+     * @param[in]      input     Input tensor of @p kernel. Must have at most 2 dimensions.
+     * @param[in, out] output    Output tensor of @p kernel. Must have at most 2 dimensions.
+     * @param[in]      tile_rows (Optional) Input rows per tile, 16 by default. Smaller tiles skip
+     *                           more work on localised changes at the cost of more checksums.
+     * @param[in]      halo_rows (Optional) Input rows read by the kernel beyond a tile's own rows,
+     *                           0 by default. Changes propagate to neighbouring tiles within the halo.
+     */
+    void configure(INEKernel *kernel, const ITensor *input, ITensor *output, unsigned int tile_rows = 16, unsigned int halo_rows = 0);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    /** Copy the output rows [row_start, row_end) between the output tensor and the cache */
+    void copy_output_rows(unsigned int row_start, unsigned int row_end, bool to_cache);
+
+    NETileChecksumKernel  _checksum_kernel;
+    INEKernel            *_kernel;
+    const ITensor        *_input;
+    ITensor              *_output;
+    Tensor                _checksums;
+    std::vector<uint32_t> _prev_checksums;
+    std::vector<uint8_t>  _cached_output;
+    unsigned int          _tile_rows;
+    unsigned int          _halo_rows;
+    unsigned int          _num_tiles;
+    bool                  _first_run;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NETILECACHE_H__ */
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NETOPK_H__
+#define __ARM_COMPUTE_NETOPK_H__
+
+#include "arm_compute/core/NEON/kernels/NETopKKernel.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/Tensor.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to select the k largest scores with their indices.
+ *
+ * The parallel phase runs @ref NETopKKernel split along the X dimension: each thread keeps its
+ * k best (value, index) pairs in a per-thread candidate slot, rejecting blocks of scores below
+ * its running k-th best value with NEON comparisons. The per-thread candidates (at most
+ * num_threads * k entries) are then merged on the calling thread, which is negligible next to
+ * the scan itself. This replaces sorting the scores on the host after the network has run.
+ *
+ * Ties are broken towards the lowest index.
+ */
+class NETopK : public IFunction
+{
+public:
+    /** Constructor */
+    NETopK();
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input   Source tensor holding the scores along the X dimension. Must be 1D.
+     *                     Data types supported: QASYMM8/F32.
+     * @param[out] values  Destination tensor holding the k largest scores in descending order.
+     *                     Its first dimension must be @p k. Data types supported: same as @p input.
+     * @param[out] indices Destination tensor holding the positions of the k largest scores.
+     *                     Its first dimension must be @p k. Data type supported: U32.
+     * @param[in]  k       Number of elements to select. Must be in [1, input width].
+     */
+    void configure(const ITensor *input, ITensor *values, ITensor *indices, unsigned int k);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    NETopKKernel _kernel;
+    Tensor       _candidate_values;
+    Tensor       _candidate_indices;
+    Tensor       _candidate_counts;
+    ITensor     *_values;
+    ITensor     *_indices;
+    unsigned int _k;
+};
+}
+#endif /* __ARM_COMPUTE_NETOPK_H__ */
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_OFFSETLIFETIMEMANAGER_H__
+#define __ARM_COMPUTE_OFFSETLIFETIMEMANAGER_H__
+
+#include "arm_compute/runtime/ILifetimeManager.h"
+
+#include "arm_compute/runtime/IMemoryGroup.h"
+#include "arm_compute/runtime/Types.h"
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+namespace arm_compute
+{
+class IMemoryGroup;
+
+/** Class that tracks the lifetime of registered tensors and calculates the systems memory requirements in terms of a single blob and a list of offsets
+ *
+ * Unlike @ref BlobLifetimeManager, which sizes one blob per concurrent tensor, all tensors of a group
+ * are packed back to back into one contiguous arena. Groups that run at different times share the
+ * arena, so the pool size is the largest group footprint rather than a sum of per-blob maxima, and
+ * consecutive tensors end up in adjacent memory.
+ */
+class OffsetLifetimeManager : public ILifetimeManager
+{
+public:
+    /** Constructor */
+    OffsetLifetimeManager();
+    /** Prevent instances of this class to be copy constructed */
+    OffsetLifetimeManager(const OffsetLifetimeManager &) = delete;
+    /** Prevent instances of this class to be copied */
+    OffsetLifetimeManager &operator=(const OffsetLifetimeManager &) = delete;
+    /** Allow instances of this class to be move constructed */
+    OffsetLifetimeManager(OffsetLifetimeManager &&) = default;
+    /** Allow instances of this class to be moved */
+    OffsetLifetimeManager &operator=(OffsetLifetimeManager &&) = default;
+
+    // Inherited methods overridden:
+    void register_group(IMemoryGroup *group) override;
+    void start_lifetime(void *obj) override;
+    void end_lifetime(void *obj, void **handle, size_t size) override;
+    std::unique_ptr<IMemoryPool> create_pool(IAllocator *allocator) override;
+    bool        are_all_finalized() const override;
+    MappingType mapping_type() const override;
+    size_t      total_pool_size() const override;
+    std::vector<size_t> pool_chunk_sizes() const override;
+    size_t total_registered_size() const override;
+    void   print_placement(std::ostream &os) const override;
+
+private:
+    /** Update blob size and group offset mappings */
+    void update_blob_and_mappings();
+
+private:
+    /** Element struct */
+    struct Element
+    {
+        Element(void *id_ = nullptr, void **handle_ = nullptr, size_t size_ = 0, bool status_ = false)
+            : id(id_), handle(handle_), size(size_), status(status_)
+        {
+        }
+        void *id;      /**< Element id */
+        void **handle; /**< Element's memory handle */
+        size_t size;   /**< Element's size */
+        bool   status; /**< Lifetime status */
+    };
+
+    IMemoryGroup        *_active_group;                               /**< Active group */
+    std::vector<Element> _active_elements;                            /**< A map that contains the active elements */
+    std::map<IMemoryGroup *, std::vector<Element>> _finalized_groups; /**< A map that contains the finalized groups */
+    size_t _blob;                                                     /**< Size of the contiguous arena */
+};
+} // arm_compute
+#endif /* __ARM_COMPUTE_OFFSETLIFETIMEMANAGER_H__ */
@@ -31,13 +31,23 @@
 #include "support/Mutex.h"
 #include "support/Semaphore.h"
 
+#include <atomic>
 #include <cstddef>
-#include <list>
 #include <memory>
+#include <vector>
 
 namespace arm_compute
 {
-/** Memory pool manager */
+/** Memory pool manager
+ *
+ * Holds N pre-populated pools (see @ref MemoryManagerOnDemand::set_num_pools) so that a function
+ * set configured once can be run by up to N threads concurrently, each request locking its own
+ * pool. Once a thread holds a claim, pool acquisition is a lock-free scan over the pool slots;
+ * the semaphore only blocks when more than N requests are in flight.
+ *
+ * Requests are served most-recently-freed first, so a sequential run loop keeps reacquiring the
+ * pool whose address range is still hot in the cache instead of rotating through cold ones.
+ */
 class PoolManager : public IPoolManager
 {
 public:
@@ -58,10 +68,11 @@ public:
     void register_pool(std::unique_ptr<IMemoryPool> pool) override;
 
 private:
-    std::list<std::unique_ptr<IMemoryPool>> _free_pools;     /**< List of free pools */
-    std::list<std::unique_ptr<IMemoryPool>> _occupied_pools; /**< List of occupied pools */
-    std::unique_ptr<arm_compute::Semaphore> _sem;            /**< Semaphore to control the queues */
-    arm_compute::Mutex                      _mtx;            /**< Mutex to control access to the queues */
+    std::vector<std::unique_ptr<IMemoryPool>> _pools;    /**< Registered pools */
+    std::unique_ptr<std::atomic<bool>[]>      _occupied; /**< Occupancy flag of each pool slot */
+    std::unique_ptr<arm_compute::Semaphore>   _sem;      /**< Semaphore counting the free pool slots */
+    arm_compute::Mutex                        _mtx;      /**< Mutex to control registration */
+    std::atomic<size_t> _last_freed;                     /**< Slot freed last, where the next acquisition scan starts */
 };
 } // arm_compute
 #endif /*__ARM_COMPUTE_POOLMANAGER_H__ */
@@ -67,10 +67,21 @@ public:
      * @return true if the given scheduler type is supported. False otherwise.
      */
     static bool is_available(Type t);
+    /** Binds a scheduler to the calling thread.
+     *
+     * While bound, Scheduler::get() calls made from this thread return @p scheduler instead of
+     * the process-wide scheduler. This lets independent pipelines running on separate threads
+     * (e.g. two networks served concurrently) each use their own scheduler instance and thread
+     * pool. The caller keeps ownership of the scheduler and must keep it alive while bound.
+     *
+     * @param[in] scheduler Scheduler to bind to the calling thread, or nullptr to unbind.
+     */
+    static void bind_to_thread(IScheduler *scheduler);
 
 private:
     static Type                        _scheduler_type;
     static std::shared_ptr<IScheduler> _custom_scheduler;
+    static thread_local IScheduler    *_thread_scheduler;
     Scheduler();
 };
 }
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_SHAREDTENSORHANDLE_H__
+#define __ARM_COMPUTE_SHAREDTENSORHANDLE_H__
+
+#include <cstdint>
+
+namespace arm_compute
+{
+/** Process-portable description of a tensor backed by a named shared memory region.
+ *
+ * The handle is a plain trivially-copyable struct, so it can be sent over any IPC channel
+ * (socket, pipe, ...) as raw bytes. The receiving process passes it to
+ * @ref TensorAllocator::import_shared to reconstruct a tensor over the same pages,
+ * giving zero-copy producer/consumer transport across process boundaries.
+ *
+ * Only the layout a @ref TensorInfo derives from shape and data type is described:
+ * shared tensors are created padding-less, so strides do not need to travel.
+ */
+struct SharedTensorHandle
+{
+    char     name[64];             /**< Name of the POSIX shared memory region, including the leading '/' */
+    uint64_t shape[6];             /**< Dimensions of the tensor */
+    uint32_t num_dimensions;       /**< Number of valid entries in @ref shape */
+    uint32_t num_channels;         /**< Number of channels of each tensor element */
+    int32_t  data_type;            /**< @ref DataType of the elements, as its underlying integer value */
+    int32_t  fixed_point_position; /**< Fixed point position of QS8/QS16 elements, 0 otherwise */
+    float    quantization_scale;   /**< Quantization scale of QASYMM8 elements, 0 otherwise */
+    int32_t  quantization_offset;  /**< Quantization offset of QASYMM8 elements, 0 otherwise */
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_SHAREDTENSORHANDLE_H__ */
@@ -26,6 +26,8 @@
 
 #include "arm_compute/runtime/IScheduler.h"
 
+#include <functional>
+
 namespace arm_compute
 {
 /** Pool of threads to automatically split a kernel's execution among several threads. */
@@ -53,10 +55,28 @@ public:
      * @param[in] split_dimension Dimension along which to split the kernel's execution window.
      */
     void schedule(ICPPKernel *kernel, unsigned int split_dimension) override;
+    /** Runs kernels in bounded-time slices with a cooperative yield between slices.
+     *
+     * Without a preemptive OS a full-frame kernel occupies the core for its whole duration.
+     * While a yield callback is set, schedule() splits each kernel's window into slices sized
+     * to approximately @p slice_us of work - adapted from the measured duration of previous
+     * slices - and invokes the callback between slices, so an RTOS task or interrupt-sensitive
+     * loop can interleave with inference. One window step along the split dimension is the
+     * granularity floor: a kernel whose single step exceeds the budget cannot be sliced finer.
+     * The calling thread's cancellation flag and dispatch deadline are polled between slices.
+     *
+     * @param[in] callback Function invoked between slices. nullptr disables slicing.
+     * @param[in] slice_us Target duration of one slice in microseconds.
+     */
+    void set_yield(std::function<void()> callback, unsigned int slice_us);
 
 private:
     /** Constructor. */
     SingleThreadScheduler() = default;
+
+    std::function<void()> _yield_callback{ nullptr }; /**< Called between slices while set */
+    unsigned int          _slice_us{ 0 };             /**< Target slice duration in microseconds */
+    float                 _iterations_per_us{ 0.f };  /**< Measured throughput used to size the next slice */
 };
 }
 #endif /* __ARM_COMPUTE_SINGLETHREADSCHEDULER_H__ */
@@ -25,9 +25,11 @@
 #define __ARM_COMPUTE_TENSORALLOCATOR_H__
 
 #include "arm_compute/runtime/ITensorAllocator.h"
+#include "arm_compute/runtime/SharedTensorHandle.h"
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace arm_compute
@@ -73,6 +75,83 @@ public:
     /** Returns the pointer to the allocated data. */
     uint8_t *data() const;
 
+    /** Import existing memory as the backing memory of the tensor, without copying or taking ownership.
+     *
+     * The caller keeps ownership of the memory and must keep it valid (and not resize it) for the
+     * lifetime of the tensor; typical use is wrapping tensors around an mmap'd weights file so that
+     * model load does not copy. The memory must be at least @ref TensorInfo::total_size() bytes and
+     * aligned to the tensor's element size (page-aligned mmap regions always qualify).
+     *
+     * @note The tensor must not already be allocated or associated with a memory group when calling this function.
+     *
+     * @param[in] memory Memory to import. Must remain valid for the lifetime of the tensor.
+     * @param[in] size   Size of the imported memory region in bytes.
+     */
+    void import_memory(void *memory, size_t size);
+
+    /** Allocate the backing memory in a named POSIX shared memory region.
+     *
+     * The region is created by this call (it must not already exist) and the calling process
+     * owns it: @ref free unlinks the name. Other processes reconstruct a tensor over the same
+     * pages from the handle returned by @ref export_handle, making the tensor a zero-copy
+     * producer/consumer channel across process boundaries.
+     *
+     * @note The tensor must not already be allocated, have padding, or be associated with a
+     *       memory group when calling this function.
+     *
+     * @param[in] name Name of the shared memory region, starting with '/'. At most 63 characters.
+     */
+    void allocate_shared(const std::string &name);
+    /** Map the shared memory region described by @p handle as the backing memory of the tensor.
+     *
+     * Initializes the tensor info from the handle and maps the pages the exporting process
+     * allocated, without copying. The region stays alive at least until the tensor is freed;
+     * unlinking remains the exporter's responsibility.
+     *
+     * @note The tensor must not already be allocated or associated with a memory group.
+     *
+     * @param[in] handle Handle received from the exporting process.
+     */
+    void import_shared(const SharedTensorHandle &handle);
+    /** Returns a process-portable handle describing the tensor's shared memory backing.
+     *
+     * @note Only valid after @ref allocate_shared.
+     *
+     * @return A trivially-copyable handle that can be sent to another process as raw bytes.
+     */
+    SharedTensorHandle export_handle() const;
+
+    /** Compress the tensor's backing memory and release the raw allocation.
+     *
+     * The contents are encoded with a byte-wise zero-run scheme and kept in a compact buffer,
+     * trading a cheap decode on the next @ref decompress for the working-set reduction. Sparse
+     * maps such as post-ReLU activations typically shrink several times; incompressible data
+     * costs a few bytes of framing overhead. Intended for tensors that stay live but dormant
+     * for a long stretch of the workload.
+     *
+     * @note Only valid for allocated tensors that own their memory, i.e. neither imported nor
+     *       associated with a memory group. The contents are inaccessible until decompressed.
+     */
+    void compress();
+    /** Restore the backing memory of a compressed tensor.
+     *
+     * Reallocates the raw buffer, decodes the compact representation into it and releases the
+     * compact buffer.
+     *
+     * @note The tensor must have been compressed when calling this function.
+     */
+    void decompress();
+    /** Returns whether the tensor's backing memory is currently compressed
+     *
+     * @return True if the backing memory is compressed
+     */
+    bool is_compressed() const;
+    /** Returns the size of the compact representation
+     *
+     * @return Size of the compressed contents in bytes, 0 if the tensor is not compressed
+     */
+    size_t compressed_size() const;
+
     /** Allocate size specified by TensorInfo of CPU memory.
      *
      * @note The tensor must not already be allocated when calling this function.
@@ -103,9 +182,18 @@ protected:
     void unlock() override;
 
 private:
-    MemoryGroup *_associated_memory_group; /**< Registered memory manager */
-    uint8_t     *_buffer;                  /**< CPU memory allocation. */
-    Tensor      *_owner;                   /**< Owner of the allocator */
+    /** Unmaps the shared memory backing and, when this allocator owns the region, unlinks its name */
+    void release_shared();
+
+    MemoryGroup         *_associated_memory_group; /**< Registered memory manager */
+    uint8_t             *_buffer;                  /**< CPU memory allocation. */
+    Tensor              *_owner;                   /**< Owner of the allocator */
+    bool                 _is_imported;             /**< True if the buffer is caller-owned imported memory */
+    std::vector<uint8_t> _compressed;              /**< Compact representation of the contents while compressed */
+    bool                 _is_compressed;           /**< True if the backing memory is currently compressed */
+    std::string          _shm_name;                /**< Name of the backing shared memory region, empty otherwise */
+    bool                 _shm_owner;               /**< True if this allocator created (and must unlink) the region */
+    size_t               _color_offset;            /**< Offset of the buffer inside its allocation when @ref MemoryColoring is enabled */
 };
 }
 #endif /* __ARM_COMPUTE_TENSORALLOCATOR_H__ */
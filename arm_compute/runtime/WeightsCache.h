@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_WEIGHTSCACHE_H__
+#define __ARM_COMPUTE_WEIGHTSCACHE_H__
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Process wide cache of reshaped weights.
+ *
+ * Functions that reshape constant weights (e.g. @ref NEConvolutionLayer and
+ * @ref NEFullyConnectedLayer) can memoize the reshaped form here, keyed by the original
+ * weights tensor and the applied transform. Function instances configured with the same
+ * weights then share a single reshaped tensor and the reshape kernels run only once.
+ *
+ * Weights are identified by their backing buffer, not by the tensor object: distinct tensor
+ * objects wrapping the same memory (e.g. several instances of one network sharing imported
+ * weights) resolve to the same cache entry, so N instances of a model cost one set of
+ * reshaped weights. Tensors that are not allocated yet when the function is configured fall
+ * back to object identity and are only shared with functions configured on the same tensor.
+ *
+ * The cache content can additionally be persisted to disk with @ref save and restored with
+ * @ref load, so warm starts skip the reshape kernels entirely. The on disk identifiers are
+ * derived from the transform, the tensor geometry and the registration order, so a restore
+ * is only valid when the functions are configured in the same order as when saving.
+ *
+ * The cache is disabled by default and has to be switched on with @ref set_enabled before
+ * the functions are configured.
+ */
+class WeightsCache
+{
+public:
+    /** Access the cache singleton
+     *
+     * @return The cache
+     */
+    static WeightsCache &get();
+    /** Prevent instances of this class from being copied */
+    WeightsCache(const WeightsCache &) = delete;
+    /** Prevent instances of this class from being copied */
+    WeightsCache &operator=(const WeightsCache &) = delete;
+
+    /** Enable or disable the cache. Has to be set before the functions are configured */
+    void set_enabled(bool enabled);
+    /** True if functions should use the cache */
+    bool is_enabled() const;
+
+    /** Return the tensor caching the given transform of the given weights, creating and
+     *  allocating it on first use.
+     *
+     * @param[in] weights   Original weights tensor the transform is applied to.
+     * @param[in] transform Identifier of the applied transform.
+     * @param[in] info      Tensor info of the reshaped form, used when the slot is created.
+     *
+     * @return The shared tensor holding the reshaped weights
+     */
+    ITensor *acquire(const ITensor *weights, const std::string &transform, const TensorInfo &info);
+    /** True if the reshaped form of the given weights has already been produced, either by
+     *  another function instance or by @ref load */
+    bool is_reshaped(const ITensor *weights, const std::string &transform) const;
+    /** Mark the reshaped form of the given weights as produced */
+    void mark_reshaped(const ITensor *weights, const std::string &transform);
+
+    /** Write every reshaped tensor to one file per cache entry in the given directory
+     *
+     * @return True if all entries whose reshaped form has been produced were written
+     */
+    bool save(const std::string &directory) const;
+    /** Restore previously saved reshaped tensors for the currently registered entries
+     *
+     * @return True if every pending entry was restored
+     */
+    bool load(const std::string &directory);
+
+    /** Drop all cache entries and release their memory */
+    void clear();
+
+private:
+    WeightsCache() = default;
+
+    struct Entry
+    {
+        std::unique_ptr<Tensor> tensor{};
+        std::string             uid{};
+        bool                    reshaped{ false };
+    };
+
+    using Key      = std::pair<const void *, std::string>;
+    using AliasKey = std::pair<const ITensor *, std::string>;
+
+    /** Build the entry key of the given weights, keyed by buffer identity when allocated */
+    Key make_key(const ITensor *weights, const std::string &transform) const;
+    /** Resolve the entry key recorded when the given weights were acquired */
+    Key resolve_key(const ITensor *weights, const std::string &transform) const;
+
+    std::map<Key, Entry>     _cache{};
+    std::map<AliasKey, Key>  _aliases{};
+    mutable std::mutex       _mutex{};
+    bool                     _enabled{ false };
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_WEIGHTSCACHE_H__ */
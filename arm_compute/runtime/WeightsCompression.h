@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_WEIGHTSCOMPRESSION_H__
+#define __ARM_COMPUTE_WEIGHTSCOMPRESSION_H__
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Compress F32 weights into 8-bit codebook indices with per-row scales.
+ *
+ * Each weight row is normalised by its maximum magnitude and the normalised values of the whole
+ * matrix are clustered into a shared 256-entry codebook with Lloyd's k-means. The compressed
+ * form (one byte per weight, plus the codebook and the scales) is what
+ * @ref NEGEMMTranspose1xWKernel decodes on its way into the packed GEMM layout, so the
+ * full-precision weights are only ever materialised in the reshaped buffer.
+ *
+ * This is a host-side, one-off preparation step; it is not meant to run per inference.
+ *
+ * @param[in]  weights        Weights to compress. The weights must be 2 dimensional. Data type supported: F32
+ * @param[out] codes          Codebook index of each weight. Same shape as @p weights. Data type supported: U8
+ * @param[out] codebook       Shared codebook of 256 entries. Data type supported: F32
+ * @param[out] scales         Per-row scale factors, one per weight row. Data type supported: F32
+ * @param[in]  num_iterations (Optional) Number of k-means refinement iterations, 8 by default.
+ */
+void compress_weights_codebook(const ITensor *weights, ITensor *codes, ITensor *codebook, ITensor *scales, unsigned int num_iterations = 8);
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_WEIGHTSCOMPRESSION_H__ */
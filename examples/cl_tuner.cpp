@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_CL /* Needed by Utils.cpp to handle OpenCL exceptions properly */
+#error "This example needs to be built with -DARM_COMPUTE_CL"
+#endif /* ARM_COMPUTE_CL */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/CL/CLFunctions.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+#include "arm_compute/runtime/CL/CLTuner.h"
+#include "utils/Utils.h"
+
+#include <iostream>
+#include <string>
+
+using namespace arm_compute;
+using namespace utils;
+
+/** Offline OpenCL tuner.
+ *
+ * Tuning every kernel online (CLTuner's brute-force LWS sweep) costs several hundred
+ * milliseconds per untuned kernel, which shows up as jank in the user's first inference.
+ * This tool runs the sweep offline instead: it configures an AlexNet-style stack of CL
+ * layers (the kernel shapes that dominate typical CNN deployments), executes it once with
+ * the tuner attached so every enqueued kernel gets tuned, and saves the resulting LWS
+ * table to a file. Production devices then restore the table with CLTuner::load_from_file()
+ * and never tune online.
+ */
+void main_cl_tuner(int argc, const char **argv)
+{
+    std::string output_filename = "cl_tuner.csv";
+
+    if(argc < 2)
+    {
+        // Print help
+        std::cout << "Usage: ./build/cl_tuner [output_file]\n\n";
+        std::cout << "No output file provided, using " << output_filename << "\n";
+    }
+    else
+    {
+        output_filename = argv[1];
+    }
+
+    CLTuner tuner;
+    CLScheduler::get().default_init(&tuner);
+
+    // The src tensor should contain the input image
+    CLTensor src;
+
+    // The weights and biases tensors should be initialized with the loaded parameters
+    CLTensor weights0, weights1, weights2, weights3, weights4, weights5;
+    CLTensor biases0, biases1, biases2, biases3, biases4, biases5;
+
+    CLTensor out_conv0, out_act0, out_pool0;
+    CLTensor out_conv1, out_act1, out_pool1;
+    CLTensor out_conv2, out_act2, out_pool2;
+    CLTensor out_fc0, out_act3;
+    CLTensor out_fc1, out_softmax;
+
+    // Create layers
+    CLConvolutionLayer    conv0, conv1, conv2;
+    CLActivationLayer     act0, act1, act2, act3;
+    CLPoolingLayer        pool0, pool1, pool2;
+    CLFullyConnectedLayer fc0, fc1;
+    CLSoftmaxLayer        softmax;
+
+    /* [Initialize tensors] */
+
+    // Initialize src tensor: AlexNet-sized input
+    constexpr unsigned int width_src_image  = 227;
+    constexpr unsigned int height_src_image = 227;
+    constexpr unsigned int ifm_src_img      = 3;
+
+    const TensorShape src_shape(width_src_image, height_src_image, ifm_src_img);
+    src.allocator()->init(TensorInfo(src_shape, 1, DataType::F32));
+
+    // Initialize tensors of conv0: 11x11 stride 4 convolution
+    constexpr unsigned int kernel_x_conv0 = 11;
+    constexpr unsigned int kernel_y_conv0 = 11;
+    constexpr unsigned int ofm_conv0      = 96;
+
+    const TensorShape weights_shape_conv0(kernel_x_conv0, kernel_y_conv0, src_shape.z(), ofm_conv0);
+    const TensorShape biases_shape_conv0(weights_shape_conv0[3]);
+    const TensorShape out_shape_conv0(55, 55, weights_shape_conv0[3]);
+
+    weights0.allocator()->init(TensorInfo(weights_shape_conv0, 1, DataType::F32));
+    biases0.allocator()->init(TensorInfo(biases_shape_conv0, 1, DataType::F32));
+    out_conv0.allocator()->init(TensorInfo(out_shape_conv0, 1, DataType::F32));
+
+    // Initialize tensor of act0
+    out_act0.allocator()->init(TensorInfo(out_shape_conv0, 1, DataType::F32));
+
+    // Initialize tensor of pool0
+    TensorShape out_shape_pool0 = out_shape_conv0;
+    out_shape_pool0.set(0, out_shape_pool0.x() / 2);
+    out_shape_pool0.set(1, out_shape_pool0.y() / 2);
+    out_pool0.allocator()->init(TensorInfo(out_shape_pool0, 1, DataType::F32));
+
+    // Initialize tensors of conv1: 5x5 padded convolution
+    constexpr unsigned int kernel_x_conv1 = 5;
+    constexpr unsigned int kernel_y_conv1 = 5;
+    constexpr unsigned int ofm_conv1      = 256;
+
+    const TensorShape weights_shape_conv1(kernel_x_conv1, kernel_y_conv1, out_shape_pool0.z(), ofm_conv1);
+    const TensorShape biases_shape_conv1(weights_shape_conv1[3]);
+    TensorShape       out_shape_conv1 = out_shape_pool0;
+    out_shape_conv1.set(2, weights_shape_conv1[3]);
+
+    weights1.allocator()->init(TensorInfo(weights_shape_conv1, 1, DataType::F32));
+    biases1.allocator()->init(TensorInfo(biases_shape_conv1, 1, DataType::F32));
+    out_conv1.allocator()->init(TensorInfo(out_shape_conv1, 1, DataType::F32));
+
+    // Initialize tensor of act1
+    out_act1.allocator()->init(TensorInfo(out_shape_conv1, 1, DataType::F32));
+
+    // Initialize tensor of pool1
+    TensorShape out_shape_pool1 = out_shape_conv1;
+    out_shape_pool1.set(0, out_shape_pool1.x() / 2);
+    out_shape_pool1.set(1, out_shape_pool1.y() / 2);
+    out_pool1.allocator()->init(TensorInfo(out_shape_pool1, 1, DataType::F32));
+
+    // Initialize tensors of conv2: 3x3 padded convolution
+    constexpr unsigned int kernel_x_conv2 = 3;
+    constexpr unsigned int kernel_y_conv2 = 3;
+    constexpr unsigned int ofm_conv2      = 384;
+
+    const TensorShape weights_shape_conv2(kernel_x_conv2, kernel_y_conv2, out_shape_pool1.z(), ofm_conv2);
+    const TensorShape biases_shape_conv2(weights_shape_conv2[3]);
+    TensorShape       out_shape_conv2 = out_shape_pool1;
+    out_shape_conv2.set(2, weights_shape_conv2[3]);
+
+    weights2.allocator()->init(TensorInfo(weights_shape_conv2, 1, DataType::F32));
+    biases2.allocator()->init(TensorInfo(biases_shape_conv2, 1, DataType::F32));
+    out_conv2.allocator()->init(TensorInfo(out_shape_conv2, 1, DataType::F32));
+
+    // Initialize tensor of act2
+    out_act2.allocator()->init(TensorInfo(out_shape_conv2, 1, DataType::F32));
+
+    // Initialize tensor of pool2
+    TensorShape out_shape_pool2 = out_shape_conv2;
+    out_shape_pool2.set(0, out_shape_pool2.x() / 2);
+    out_shape_pool2.set(1, out_shape_pool2.y() / 2);
+    out_pool2.allocator()->init(TensorInfo(out_shape_pool2, 1, DataType::F32));
+
+    // Initialize tensor of fc0
+    constexpr unsigned int num_labels_fc0 = 4096;
+
+    const TensorShape weights_shape_fc0(out_shape_pool2.x() * out_shape_pool2.y() * out_shape_pool2.z(), num_labels_fc0);
+    const TensorShape biases_shape_fc0(num_labels_fc0);
+    const TensorShape out_shape_fc0(num_labels_fc0);
+
+    weights3.allocator()->init(TensorInfo(weights_shape_fc0, 1, DataType::F32));
+    biases3.allocator()->init(TensorInfo(biases_shape_fc0, 1, DataType::F32));
+    out_fc0.allocator()->init(TensorInfo(out_shape_fc0, 1, DataType::F32));
+
+    // Initialize tensor of act3
+    out_act3.allocator()->init(TensorInfo(out_shape_fc0, 1, DataType::F32));
+
+    // Initialize tensor of fc1
+    constexpr unsigned int num_labels_fc1 = 1000;
+
+    const TensorShape weights_shape_fc1(out_shape_fc0.x(), num_labels_fc1);
+    const TensorShape biases_shape_fc1(num_labels_fc1);
+    const TensorShape out_shape_fc1(num_labels_fc1);
+
+    weights4.allocator()->init(TensorInfo(weights_shape_fc1, 1, DataType::F32));
+    biases4.allocator()->init(TensorInfo(biases_shape_fc1, 1, DataType::F32));
+    out_fc1.allocator()->init(TensorInfo(out_shape_fc1, 1, DataType::F32));
+
+    // Initialize tensor of softmax
+    out_softmax.allocator()->init(TensorInfo(out_shape_fc1, 1, DataType::F32));
+
+    /* -----------------------End: [Initialize tensors] */
+
+    /* [Configure functions] */
+
+    conv0.configure(&src, &weights0, &biases0, &out_conv0, PadStrideInfo(4 /* stride_x */, 4 /* stride_y */, 0 /* pad_x */, 0 /* pad_y */));
+    act0.configure(&out_conv0, &out_act0, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    pool0.configure(&out_act0, &out_pool0, PoolingLayerInfo(PoolingType::MAX, 2, PadStrideInfo(2 /* stride_x */, 2 /* stride_y */)));
+    conv1.configure(&out_pool0, &weights1, &biases1, &out_conv1, PadStrideInfo(1 /* stride_x */, 1 /* stride_y */, 2 /* pad_x */, 2 /* pad_y */));
+    act1.configure(&out_conv1, &out_act1, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    pool1.configure(&out_act1, &out_pool1, PoolingLayerInfo(PoolingType::MAX, 2, PadStrideInfo(2 /* stride_x */, 2 /* stride_y */)));
+    conv2.configure(&out_pool1, &weights2, &biases2, &out_conv2, PadStrideInfo(1 /* stride_x */, 1 /* stride_y */, 1 /* pad_x */, 1 /* pad_y */));
+    act2.configure(&out_conv2, &out_act2, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    pool2.configure(&out_act2, &out_pool2, PoolingLayerInfo(PoolingType::MAX, 2, PadStrideInfo(2 /* stride_x */, 2 /* stride_y */)));
+    fc0.configure(&out_pool2, &weights3, &biases3, &out_fc0);
+    act3.configure(&out_fc0, &out_act3, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    fc1.configure(&out_act3, &weights4, &biases4, &out_fc1);
+    softmax.configure(&out_fc1, &out_softmax);
+
+    /* -----------------------End: [Configure functions] */
+
+    /* [Allocate tensors] */
+
+    src.allocator()->allocate();
+    weights0.allocator()->allocate();
+    weights1.allocator()->allocate();
+    weights2.allocator()->allocate();
+    weights3.allocator()->allocate();
+    weights4.allocator()->allocate();
+    biases0.allocator()->allocate();
+    biases1.allocator()->allocate();
+    biases2.allocator()->allocate();
+    biases3.allocator()->allocate();
+    biases4.allocator()->allocate();
+    out_conv0.allocator()->allocate();
+    out_conv1.allocator()->allocate();
+    out_conv2.allocator()->allocate();
+    out_act0.allocator()->allocate();
+    out_act1.allocator()->allocate();
+    out_act2.allocator()->allocate();
+    out_act3.allocator()->allocate();
+    out_pool0.allocator()->allocate();
+    out_pool1.allocator()->allocate();
+    out_pool2.allocator()->allocate();
+    out_fc0.allocator()->allocate();
+    out_fc1.allocator()->allocate();
+    out_softmax.allocator()->allocate();
+
+    /* -----------------------End: [Allocate tensors] */
+
+    /* [Execute the functions] */
+
+    // The tuner sweeps the LWS of every kernel the first time it is enqueued, so running the
+    // network once is enough to populate the whole table. The tensor contents are irrelevant
+    // for tuning purposes and are left uninitialized.
+    conv0.run();
+    act0.run();
+    pool0.run();
+    conv1.run();
+    act1.run();
+    pool1.run();
+    conv2.run();
+    act2.run();
+    pool2.run();
+    fc0.run();
+    act3.run();
+    fc1.run();
+    softmax.run();
+
+    // Make sure all the OpenCL jobs are done executing:
+    CLScheduler::get().sync();
+
+    /* -----------------------End: [Execute the functions] */
+
+    /* [Save the LWS table] */
+
+    if(tuner.save_to_file(output_filename))
+    {
+        std::cout << "Saved " << tuner.export_lws_table().size() << " tuned kernel configurations to " << output_filename << "\n";
+    }
+    else
+    {
+        std::cout << "Failed to save the tuning table to " << output_filename << "\n";
+    }
+
+    /* -----------------------End: [Save the LWS table] */
+}
+
+/** Main program for the offline OpenCL tuner
+ *
+ * @param[in] argc Number of arguments
+ * @param[in] argv Arguments ( [optional] Path of the tuning file to write )
+ */
+int main(int argc, const char **argv)
+{
+    return utils::run_example(argc, argv, main_cl_tuner);
+}
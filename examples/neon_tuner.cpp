@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/CPUTuner.h"
+#include "arm_compute/runtime/NEON/NEFunctions.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "utils/Utils.h"
+
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <string>
+#include <thread>
+
+using namespace arm_compute;
+using namespace utils;
+
+namespace
+{
+/** Measures the per-kernel wall time of @p runs executions of @p run_stack using the scheduler's telemetry */
+template <typename F>
+std::map<std::string, double> time_kernels(F &&run_stack, int runs)
+{
+    Scheduler::get().set_telemetry_enabled(true);
+    Scheduler::get().drain_telemetry();
+
+    for(int i = 0; i < runs; ++i)
+    {
+        run_stack();
+    }
+
+    const auto events = Scheduler::get().drain_telemetry();
+    Scheduler::get().set_telemetry_enabled(false);
+
+    // One event per participating thread: a thread's share divided by the
+    // thread count of its dispatch approximates the kernel's wall time
+    std::map<std::string, double> time_per_kernel;
+    for(const auto &event : events)
+    {
+        if(event.kernel_name == nullptr || event.num_threads <= 0)
+        {
+            continue;
+        }
+        time_per_kernel[event.kernel_name] += static_cast<double>(event.end_ns - event.start_ns) / event.num_threads;
+    }
+    return time_per_kernel;
+}
+} // namespace
+
+/** Offline NEON/scheduler tuner, the CPU counterpart of cl_tuner.
+ *
+ * The thread count and the split dimension each function passes to the
+ * scheduler (Window::DimY for most NEON kernels) are fixed in code, yet the
+ * best choice differs per device. This tool sweeps both knobs on the target:
+ * it configures a CNN-style stack of NEON layers, sweeps the scheduler thread
+ * count on the whole stack, then sweeps the split dimension per kernel using
+ * the scheduler's telemetry to attribute time to individual kernels. The
+ * resulting profile is saved to a file; production devices restore it with
+ * CPUTuner::load_from_file() and attach it via IScheduler::set_tuner().
+ */
+void main_neon_tuner(int argc, const char **argv)
+{
+    std::string output_filename = "cpu_tuner.csv";
+
+    if(argc < 2)
+    {
+        // Print help
+        std::cout << "Usage: ./build/neon_tuner [output_file]\n\n";
+        std::cout << "No output file provided, using " << output_filename << "\n";
+    }
+    else
+    {
+        output_filename = argv[1];
+    }
+
+    Tensor src;
+    Tensor weights0, weights1, biases0, biases1;
+    Tensor out_conv0, out_act0, out_norm0, out_pool0, out_fc0;
+
+    NEConvolutionLayer    conv0;
+    NEActivationLayer     act0;
+    NENormalizationLayer  norm0;
+    NEPoolingLayer        pool0;
+    NEFullyConnectedLayer fc0;
+
+    /* [Initialize tensors] */
+
+    // Mid-network shapes representative of typical CNN deployments
+    const TensorShape src_shape(56U, 56U, 64U);
+    const TensorShape weights_shape_conv0(3U, 3U, src_shape.z(), 128U);
+    const TensorShape biases_shape_conv0(weights_shape_conv0[3]);
+    const TensorShape out_shape_conv0(56U, 56U, weights_shape_conv0[3]);
+
+    src.allocator()->init(TensorInfo(src_shape, 1, DataType::F32));
+    weights0.allocator()->init(TensorInfo(weights_shape_conv0, 1, DataType::F32));
+    biases0.allocator()->init(TensorInfo(biases_shape_conv0, 1, DataType::F32));
+    out_conv0.allocator()->init(TensorInfo(out_shape_conv0, 1, DataType::F32));
+    out_act0.allocator()->init(TensorInfo(out_shape_conv0, 1, DataType::F32));
+    out_norm0.allocator()->init(TensorInfo(out_shape_conv0, 1, DataType::F32));
+
+    TensorShape out_shape_pool0 = out_shape_conv0;
+    out_shape_pool0.set(0, out_shape_pool0.x() / 2);
+    out_shape_pool0.set(1, out_shape_pool0.y() / 2);
+    out_pool0.allocator()->init(TensorInfo(out_shape_pool0, 1, DataType::F32));
+
+    constexpr unsigned int num_labels_fc0 = 1024;
+
+    const TensorShape weights_shape_fc0(out_shape_pool0.x() * out_shape_pool0.y() * out_shape_pool0.z(), num_labels_fc0);
+    const TensorShape biases_shape_fc0(num_labels_fc0);
+    const TensorShape out_shape_fc0(num_labels_fc0);
+
+    weights1.allocator()->init(TensorInfo(weights_shape_fc0, 1, DataType::F32));
+    biases1.allocator()->init(TensorInfo(biases_shape_fc0, 1, DataType::F32));
+    out_fc0.allocator()->init(TensorInfo(out_shape_fc0, 1, DataType::F32));
+
+    /* [Configure functions] */
+
+    conv0.configure(&src, &weights0, &biases0, &out_conv0, PadStrideInfo(1 /* stride_x */, 1 /* stride_y */, 1 /* pad_x */, 1 /* pad_y */));
+    act0.configure(&out_conv0, &out_act0, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    norm0.configure(&out_act0, &out_norm0, NormalizationLayerInfo(NormType::CROSS_MAP, 5));
+    pool0.configure(&out_norm0, &out_pool0, PoolingLayerInfo(PoolingType::MAX, 2, PadStrideInfo(2 /* stride_x */, 2 /* stride_y */)));
+    fc0.configure(&out_pool0, &weights1, &biases1, &out_fc0);
+
+    /* [Allocate tensors] */
+
+    src.allocator()->allocate();
+    weights0.allocator()->allocate();
+    weights1.allocator()->allocate();
+    biases0.allocator()->allocate();
+    biases1.allocator()->allocate();
+    out_conv0.allocator()->allocate();
+    out_act0.allocator()->allocate();
+    out_norm0.allocator()->allocate();
+    out_pool0.allocator()->allocate();
+    out_fc0.allocator()->allocate();
+
+    auto run_stack = [&]()
+    {
+        conv0.run();
+        act0.run();
+        norm0.run();
+        pool0.run();
+        fc0.run();
+    };
+
+    constexpr int runs_per_config = 5;
+
+    // Warm-up: first run pays one-off costs (weight reshaping, page faults)
+    run_stack();
+
+    CPUTuner tuner;
+
+    /* [Sweep the thread count] */
+
+    const unsigned int max_threads   = std::max(1U, std::thread::hardware_concurrency());
+    unsigned int       best_threads  = 1;
+    double             best_duration = std::numeric_limits<double>::max();
+
+    for(unsigned int threads = 1; threads <= max_threads; ++threads)
+    {
+        Scheduler::get().set_num_threads(threads);
+
+        const auto start = std::chrono::high_resolution_clock::now();
+        for(int i = 0; i < runs_per_config; ++i)
+        {
+            run_stack();
+        }
+        const double duration = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+        std::cout << "threads=" << threads << ": " << duration << " s\n";
+
+        if(duration < best_duration)
+        {
+            best_duration = duration;
+            best_threads  = threads;
+        }
+    }
+
+    tuner.set_num_threads(best_threads);
+    Scheduler::get().set_num_threads(best_threads);
+    std::cout << "Best thread count: " << best_threads << "\n";
+
+    /* [Sweep the split dimension per kernel] */
+
+    // Baseline with the split dimensions hardcoded in the functions
+    std::map<std::string, double>       best_times = time_kernels(run_stack, runs_per_config);
+    std::map<std::string, unsigned int> best_dims;
+
+    Scheduler::get().set_tuner(&tuner);
+
+    for(unsigned int dim = 0; dim < 3; ++dim)
+    {
+        // Force every known kernel onto the candidate dimension in one sweep
+        for(const auto &kernel : best_times)
+        {
+            tuner.set_split_dimension(kernel.first, dim);
+        }
+
+        const std::map<std::string, double> times = time_kernels(run_stack, runs_per_config);
+
+        for(const auto &kernel : times)
+        {
+            auto best = best_times.find(kernel.first);
+            if(best != best_times.end() && kernel.second < best->second)
+            {
+                best->second           = kernel.second;
+                best_dims[kernel.first] = dim;
+            }
+        }
+    }
+
+    // Keep only the kernels where a swept dimension beat the hardcoded one
+    tuner.import_split_table({});
+    for(const auto &kernel : best_dims)
+    {
+        tuner.set_split_dimension(kernel.first, kernel.second);
+        std::cout << kernel.first << ": split dimension " << kernel.second << "\n";
+    }
+
+    Scheduler::get().set_tuner(nullptr);
+
+    /* [Save the profile] */
+
+    if(tuner.save_to_file(output_filename))
+    {
+        std::cout << "Saved the profile (" << tuner.export_split_table().size() << " tuned kernels, " << best_threads << " threads) to " << output_filename << "\n";
+    }
+    else
+    {
+        std::cout << "Failed to save the profile to " << output_filename << "\n";
+    }
+}
+
+/** Main program for the offline NEON/scheduler tuner
+ *
+ * @param[in] argc Number of arguments
+ * @param[in] argv Arguments ( [optional] Path of the profile file to write )
+ */
+int main(int argc, const char **argv)
+{
+    return utils::run_example(argc, argv, main_neon_tuner);
+}
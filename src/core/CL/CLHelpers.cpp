@@ -25,6 +25,7 @@
 #include "arm_compute/core/CL/CLTypes.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
 
 #include <map>
 #include <regex>
@@ -154,6 +155,40 @@ const std::string &string_from_target(GPUTarget target)
     return gpu_target_map[target];
 }
 
+std::set<std::string> get_build_options_from_activation(const ActivationLayerInfo &act_info, DataType data_type)
+{
+    std::set<std::string> build_opts;
+
+    if(!act_info.enabled())
+    {
+        return build_opts;
+    }
+
+    ARM_COMPUTE_ERROR_ON_MSG(is_data_type_fixed_point(data_type), "Fused activation is not supported for fixed point data types");
+    ARM_COMPUTE_UNUSED(data_type);
+
+    switch(act_info.activation())
+    {
+        case ActivationLayerInfo::ActivationFunction::RELU:
+            build_opts.emplace("-DFUSED_ACT_RELU");
+            break;
+        case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+            build_opts.emplace("-DFUSED_ACT_BRELU");
+            break;
+        case ActivationLayerInfo::ActivationFunction::LEAKY_RELU:
+            build_opts.emplace("-DFUSED_ACT_LRELU");
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Activation function not supported for fusion");
+            break;
+    }
+
+    build_opts.emplace("-DFUSED_ACT_A=" + float_to_string_with_full_precision(act_info.a()));
+    build_opts.emplace("-DFUSED_ACT_B=" + float_to_string_with_full_precision(act_info.b()));
+
+    return build_opts;
+}
+
 GPUTarget get_target_from_device(cl::Device &device)
 {
     size_t name_size = 0;
@@ -181,6 +181,8 @@ const std::map<std::string, std::string> CLKernelLibrary::_kernel_program_map =
     { "gemm_mm_interleaved_transposed_qs8", "gemm.cl" },
     { "gemm_mm_interleaved_transposed_qs16", "gemm.cl" },
     { "gemm_mm_floating_point", "gemm.cl" },
+    { "gemm_mm_floating_point_f16_bifrost", "gemm.cl" },
+    { "gemm_mm_floating_point_f32_bifrost", "gemm.cl" },
     { "gemm_mm_qs8", "gemm.cl" },
     { "gemm_mm_qs16", "gemm.cl" },
     { "gemm_lc_vm_f32", "gemm.cl" },
@@ -284,6 +286,10 @@ const std::map<std::string, std::string> CLKernelLibrary::_kernel_program_map =
     { "warp_affine_bilinear", "warp_affine.cl" },
     { "warp_perspective_nearest_neighbour", "warp_perspective.cl" },
     { "warp_perspective_bilinear", "warp_perspective.cl" },
+    { "winograd_batched_gemm_2x2_3x3", "winograd.cl" },
+    { "winograd_filter_transform_2x2_3x3", "winograd.cl" },
+    { "winograd_input_transform_2x2_3x3", "winograd.cl" },
+    { "winograd_output_transform_2x2_3x3", "winograd.cl" },
     { "YUYV422_to_IYUV_bt709", "color_convert.cl" },
     { "YUYV422_to_NV12_bt709", "color_convert.cl" },
     { "YUYV422_to_RGB888_bt709", "color_convert.cl" },
@@ -565,6 +571,10 @@ const std::map<std::string, std::string> CLKernelLibrary::_program_source_map =
         "warp_perspective.cl",
 #include "./cl_kernels/warp_perspective.clembed"
     },
+    {
+        "winograd.cl",
+#include "./cl_kernels/winograd.clembed"
+    },
 #endif /* EMBEDDED_KERNELS */
 };
 
@@ -634,6 +644,140 @@ Kernel CLKernelLibrary::create_kernel(const std::string &kernel_name, const Stri
     return Kernel(kernel_name, cl_program);
 }
 
+Kernel CLKernelLibrary::create_kernel_from_source(const std::string &kernel_name, const std::string &program_name, const std::string &source, const StringSet &build_options_set) const
+{
+    std::string concat_str;
+
+    if(non_uniform_workgroup_support(_device))
+    {
+        concat_str += " -cl-arm-non-uniform-work-group-size ";
+    }
+    else if(get_cl_version(_device) == CLVersion::CL20)
+    {
+        concat_str += " -cl-std=CL2.0 ";
+    }
+    else
+    {
+        ARM_COMPUTE_ERROR("Non uniform workgroup size is not supported!!");
+    }
+
+    // Check if the program has been built before with same build options.
+    const std::string build_options = stringify_set(build_options_set) + concat_str;
+
+    const std::string built_program_name = program_name + "_" + build_options;
+    auto              built_program_it   = _built_programs_map.find(built_program_name);
+
+    cl::Program cl_program;
+
+    if(_built_programs_map.end() != built_program_it)
+    {
+        // If program has been built, retrieve to create kernel from it
+        cl_program = built_program_it->second;
+    }
+    else
+    {
+        // Make the library's helper macros available to the generated source
+        std::string full_source;
+#ifdef EMBEDDED_KERNELS
+        const auto helpers_it = _program_source_map.find("helpers.h");
+        if(_program_source_map.end() != helpers_it)
+        {
+            full_source = helpers_it->second;
+        }
+#else  /* EMBEDDED_KERNELS */
+        full_source = "#include \"helpers.h\"\n";
+#endif /* EMBEDDED_KERNELS */
+        full_source += source;
+
+        // Build program
+        Program program(_context, program_name, full_source);
+        cl_program = program.build(build_options);
+
+        // Add built program to internal map
+        _built_programs_map.emplace(built_program_name, cl_program);
+    }
+
+    // Create and return kernel
+    return Kernel(kernel_name, cl_program);
+}
+
+void CLKernelLibrary::save_binary(const std::string &filename)
+{
+    std::ofstream fs(filename, std::ios::binary | std::ios::trunc);
+    if(!fs.is_open())
+    {
+        return;
+    }
+
+    auto write_blob = [&fs](const std::string &blob)
+    {
+        const uint64_t size = blob.size();
+        fs.write(reinterpret_cast<const char *>(&size), sizeof(size));
+        fs.write(blob.data(), blob.size());
+    };
+
+    // Tag the cache with the device it was built for
+    write_blob(_device.getInfo<CL_DEVICE_NAME>());
+
+    for(const auto &built_program : _built_programs_map)
+    {
+        const auto binaries = built_program.second.getInfo<CL_PROGRAM_BINARIES>();
+        if(binaries.empty() || binaries[0].empty())
+        {
+            continue;
+        }
+        // The key already encodes program name and build options
+        write_blob(built_program.first);
+        write_blob(std::string(binaries[0].begin(), binaries[0].end()));
+    }
+}
+
+void CLKernelLibrary::load_binary(const std::string &filename)
+{
+    std::ifstream fs(filename, std::ios::binary);
+    if(!fs.is_open())
+    {
+        return;
+    }
+
+    auto read_blob = [&fs](std::string & blob) -> bool
+    {
+        uint64_t size = 0;
+        fs.read(reinterpret_cast<char *>(&size), sizeof(size));
+        if(!fs.good())
+        {
+            return false;
+        }
+        blob.resize(size);
+        fs.read(&blob[0], size);
+        return fs.good();
+    };
+
+    // Ignore caches built for another device
+    std::string device_name;
+    if(!read_blob(device_name) || device_name != _device.getInfo<CL_DEVICE_NAME>())
+    {
+        return;
+    }
+
+    std::string key;
+    std::string binary;
+    while(read_blob(key) && read_blob(binary))
+    {
+        if(_built_programs_map.find(key) != _built_programs_map.end())
+        {
+            continue;
+        }
+
+        cl::Program::Binaries binaries{ std::vector<unsigned char>(binary.begin(), binary.end()) };
+        cl::Program           program(_context, { _device }, binaries);
+        if(program.build() == CL_SUCCESS)
+        {
+            _built_programs_map.emplace(key, std::move(program));
+        }
+    }
+}
+
 const Program &CLKernelLibrary::load_program(const std::string &program_name) const
 {
     const auto program_it = _programs_map.find(program_name);
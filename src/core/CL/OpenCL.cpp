@@ -102,6 +102,7 @@ bool CLSymbols::load(const std::string &library)
     clRetainEvent             = reinterpret_cast<clRetainEvent_func>(dlsym(handle, "clRetainEvent"));
     clGetPlatformIDs          = reinterpret_cast<clGetPlatformIDs_func>(dlsym(handle, "clGetPlatformIDs"));
     clGetKernelWorkGroupInfo  = reinterpret_cast<clGetKernelWorkGroupInfo_func>(dlsym(handle, "clGetKernelWorkGroupInfo"));
+    clImportMemoryARM         = reinterpret_cast<clImportMemoryARM_func>(dlsym(handle, "clImportMemoryARM"));
 
     dlclose(handle);
 
@@ -668,3 +669,27 @@ clGetKernelWorkGroupInfo(cl_kernel                 kernel,
         return CL_OUT_OF_RESOURCES;
     }
 }
+
+cl_mem clImportMemoryARM(
+    cl_context                      context,
+    cl_mem_flags                    flags,
+    const cl_import_properties_arm *properties,
+    void                           *memory,
+    size_t                          size,
+    cl_int                         *errcode_ret)
+{
+    arm_compute::CLSymbols::get().load_default();
+    auto func = arm_compute::CLSymbols::get().clImportMemoryARM;
+    if(func != nullptr)
+    {
+        return func(context, flags, properties, memory, size, errcode_ret);
+    }
+    else
+    {
+        if(errcode_ret != nullptr)
+        {
+            *errcode_ret = CL_OUT_OF_RESOURCES;
+        }
+        return nullptr;
+    }
+}
@@ -86,6 +86,9 @@ __kernel void convert_depth_down(
 
 #if defined(FIXED_POINT_POSITION)
     vstore16(CONVERT_DOWN(in_data, VEC_DATA_TYPE(DATA_TYPE_IN, 16), VEC_DATA_TYPE(DATA_TYPE_OUT, 16), FIXED_POINT_POSITION), 0, (__global DATA_TYPE_OUT *)out.ptr);
+#elif defined(DATA_TYPE_FLOAT) /* FIXED_POINT_POSITION */
+    // Floating point conversions: plain conversion, shifting a float vector is invalid
+    vstore16(CONVERT(in_data, VEC_DATA_TYPE(DATA_TYPE_OUT, 16)), 0, (__global DATA_TYPE_OUT *)out.ptr);
 #else  /* FIXED_POINT_POSITION */
     vstore16(CONVERT_DOWN(in_data >> shift, VEC_DATA_TYPE(DATA_TYPE_OUT, 16)), 0, (__global DATA_TYPE_OUT *)out.ptr);
 #endif /* FIXED_POINT_POSITION */
@@ -127,6 +130,9 @@ __kernel void convert_depth_up(
 
 #if defined(FIXED_POINT_POSITION)
     vstore16(CONVERT_UP(in_data, VEC_DATA_TYPE(DATA_TYPE_IN, 16), VEC_DATA_TYPE(DATA_TYPE_OUT, 16), FIXED_POINT_POSITION), 0, (__global DATA_TYPE_OUT *)out.ptr);
+#elif defined(DATA_TYPE_FLOAT) /* FIXED_POINT_POSITION */
+    // Floating point conversions: plain conversion, shifting a float vector is invalid
+    vstore16(CONVERT(in_data, VEC_DATA_TYPE(DATA_TYPE_OUT, 16)), 0, (__global DATA_TYPE_OUT *)out.ptr);
 #else  /* FIXED_POINT_POSITION */
     vstore16(CONVERT_UP(in_data, VEC_DATA_TYPE(DATA_TYPE_OUT, 16)) << shift, 0, (__global DATA_TYPE_OUT *)out.ptr);
 #endif /* FIXED_POINT_POSITION */
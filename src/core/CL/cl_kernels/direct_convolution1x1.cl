@@ -35,9 +35,11 @@ MULQ_SAT_IMPL(qs32x8, qs32x8)
 #else /* FIXED_POINT_POSITION */
 #undef CONVERT_SAT
 
+// DATA_TYPE_PROMOTED can be wider than DATA_TYPE (e.g. float for half data) for full-precision
+// accumulation; when the two types match the conversions compile away
 #define ADD_OP(a, b) ((a) + (b))
-#define MUL_OP(a, b) ((a) * (b))
-#define CONVERT_SAT(a, b) ((a))
+#define MUL_OP(a, b) (CONVERT((a), VEC_DATA_TYPE(DATA_TYPE_PROMOTED, 8)) * CONVERT((b), VEC_DATA_TYPE(DATA_TYPE_PROMOTED, 8)))
+#define CONVERT_SAT(a, b) (CONVERT((a), b))
 
 #endif /* FIXED_POINT_POSITION */
 
@@ -205,7 +207,7 @@ __kernel void direct_convolution1x1(
     pixels = ADD_OP(pixels, (VEC_DATA_TYPE(DATA_TYPE_PROMOTED, 8)) * ((__global DATA_TYPE *)(vector_offset(&biases, z_index))));
 #endif /* defined(HAS_BIAS) */
 
-    vstore8(CONVERT_SAT(pixels, VEC_DATA_TYPE(DATA_TYPE, 8)), 0, (__global DATA_TYPE *)dst.ptr);
+    vstore8(FUSED_ACTIVATION(CONVERT_SAT(pixels, VEC_DATA_TYPE(DATA_TYPE, 8)), VEC_DATA_TYPE(DATA_TYPE, 8)), 0, (__global DATA_TYPE *)dst.ptr);
 }
 #endif // defined(DATA_TYPE) && defined(DATA_SIZE) && defined(STRIDE_X) && defined(WEIGHTS_DEPTH)
 
@@ -321,9 +323,9 @@ __kernel void direct_convolution1x1_f32_bifrost(
     acc3.s3 += bias;
 #endif /* defined(HAS_BIAS) */
 
-    vstore4(acc0, 0, (__global float *)(dst.ptr + 0 * dst_stride_y));
-    vstore4(acc1, 0, (__global float *)(dst.ptr + 1 * dst_stride_y));
-    vstore4(acc2, 0, (__global float *)(dst.ptr + 2 * dst_stride_y));
-    vstore4(acc3, 0, (__global float *)(dst.ptr + 3 * dst_stride_y));
+    vstore4(FUSED_ACTIVATION(acc0, float4), 0, (__global float *)(dst.ptr + 0 * dst_stride_y));
+    vstore4(FUSED_ACTIVATION(acc1, float4), 0, (__global float *)(dst.ptr + 1 * dst_stride_y));
+    vstore4(FUSED_ACTIVATION(acc2, float4), 0, (__global float *)(dst.ptr + 2 * dst_stride_y));
+    vstore4(FUSED_ACTIVATION(acc3, float4), 0, (__global float *)(dst.ptr + 3 * dst_stride_y));
 }
 #endif // defined(WEIGHTS_DEPTH)
\ No newline at end of file
@@ -36,9 +36,11 @@ MULQ_SAT_IMPL(qs32x8, qs32x8)
 
 #undef CONVERT_SAT
 
+// DATA_TYPE_PROMOTED can be wider than DATA_TYPE (e.g. float for half data) for full-precision
+// accumulation; when the two types match the conversions compile away
 #define ADD_OP(a, b) ((a) + (b))
-#define MUL_OP(a, b) ((a) * (b))
-#define CONVERT_SAT(a, b) ((a))
+#define MUL_OP(a, b) (CONVERT((a), VEC_DATA_TYPE(DATA_TYPE_PROMOTED, 8)) * CONVERT((b), VEC_DATA_TYPE(DATA_TYPE_PROMOTED, 8)))
+#define CONVERT_SAT(a, b) (CONVERT((a), b))
 
 #endif /* FIXED_POINT_POSITION */
 
@@ -154,7 +156,7 @@ __kernel void direct_convolution3x3(
     pixels0 = ADD_OP(pixels0, (VEC_DATA_TYPE(DATA_TYPE_PROMOTED, 8)) * ((__global DATA_TYPE *)(vector_offset(&biases, kernel_index))));
 #endif /* defined(HAS_BIAS) */
 
-    vstore8(CONVERT_SAT(pixels0, VEC_DATA_TYPE(DATA_TYPE, 8)), 0, (__global DATA_TYPE *)dst.ptr);
+    vstore8(FUSED_ACTIVATION(CONVERT_SAT(pixels0, VEC_DATA_TYPE(DATA_TYPE, 8)), VEC_DATA_TYPE(DATA_TYPE, 8)), 0, (__global DATA_TYPE *)dst.ptr);
 }
 #endif //defined(DATA_TYPE) && defined(STRIDE_X) && defined(WEIGHTS_DEPTH)
 
@@ -297,8 +299,8 @@ __kernel void direct_convolution3x3_f32_bifrost(
     pixels2 += (float4)bias;
 #endif /* defined(HAS_BIAS) */
 
-    vstore4(pixels0, 0, (__global float *)(dst.ptr + 0 * dst_stride_y));
-    vstore4(pixels1, 0, (__global float *)(dst.ptr + 1 * dst_stride_y));
-    vstore4(pixels2, 0, (__global float *)(dst.ptr + 2 * dst_stride_y));
+    vstore4(FUSED_ACTIVATION(pixels0, float4), 0, (__global float *)(dst.ptr + 0 * dst_stride_y));
+    vstore4(FUSED_ACTIVATION(pixels1, float4), 0, (__global float *)(dst.ptr + 1 * dst_stride_y));
+    vstore4(FUSED_ACTIVATION(pixels2, float4), 0, (__global float *)(dst.ptr + 2 * dst_stride_y));
 }
 #endif // defined(WEIGHTS_DEPTH)
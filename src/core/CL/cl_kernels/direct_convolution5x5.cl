@@ -145,7 +145,7 @@ __kernel void direct_convolution5x5(
     pixels0 += (VEC_DATA_TYPE(DATA_TYPE, 8)) * ((__global DATA_TYPE *)(vector_offset(&biases, kernel_index)));
 #endif /* defined(HAS_BIAS) */
 
-    vstore8(pixels0, 0, (__global DATA_TYPE *)dst.ptr);
+    vstore8(FUSED_ACTIVATION(pixels0, VEC_DATA_TYPE(DATA_TYPE, 8)), 0, (__global DATA_TYPE *)dst.ptr);
 }
 #endif // defined(DATA_TYPE) && defined(STRIDE_X) && defined(WEIGHTS_DEPTH)
 
@@ -307,7 +307,7 @@ __kernel void direct_convolution5x5_f32_bifrost(
     pixels1 += bias;
 #endif /* defined(HAS_BIAS) */
 
-    vstore4(pixels0, 0, (__global float *)(dst.ptr + 0 * dst_stride_y));
-    vstore4(pixels1, 0, (__global float *)(dst.ptr + 1 * dst_stride_y));
+    vstore4(FUSED_ACTIVATION(pixels0, float4), 0, (__global float *)(dst.ptr + 0 * dst_stride_y));
+    vstore4(FUSED_ACTIVATION(pixels1, float4), 0, (__global float *)(dst.ptr + 1 * dst_stride_y));
 }
 #endif // defined(WEIGHTS_DEPTH)
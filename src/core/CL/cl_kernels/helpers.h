@@ -51,6 +51,20 @@
 #define CONVERT_SAT_ROUND_STR(x, type, round) (convert_##type##_sat_##round((x)))
 #define CONVERT_SAT_ROUND(x, type, round) CONVERT_SAT_ROUND_STR(x, type, round)
 
+/* Fused activation: when a producing kernel is built with one of the -DFUSED_ACT_* options it
+ * applies the activation to its output right before storing it, saving the full-tensor DDR
+ * round-trip of a separate activation pass. Without any of the options the macro is the identity.
+ * The A parameter (bound of the bounded RELU, slope of the leaky RELU) is passed with -DFUSED_ACT_A. */
+#if defined(FUSED_ACT_RELU)
+#define FUSED_ACTIVATION(x, type) fmax((x), (type)0)
+#elif defined(FUSED_ACT_BRELU)
+#define FUSED_ACTIVATION(x, type) clamp((x), (type)0, (type)FUSED_ACT_A)
+#elif defined(FUSED_ACT_LRELU)
+#define FUSED_ACTIVATION(x, type) select((type)((x) * (type)FUSED_ACT_A), (x), isgreater((x), (type)0))
+#else /* Fused activation disabled */
+#define FUSED_ACTIVATION(x, type) (x)
+#endif /* defined(FUSED_ACT_RELU) */
+
 #define VECTOR_DECLARATION(name)     \
     __global uchar *name##_ptr,      \
     uint        name##_stride_x, \
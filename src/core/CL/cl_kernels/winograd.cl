@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "helpers.h"
+
+/* Winograd F(2x2,3x3) convolution.
+ *
+ * The output is computed as Y = A^T [ (G g G^T) . (B^T d B) ] A per 4x4 input tile d and 3x3
+ * filter g, where . is an element-wise product. The element-wise products over all input
+ * channels are a batch of 16 independent matrix multiplications (one per transform plane),
+ * which replaces the 9 multiplies per output of the direct method with 16 per 2x2 output
+ * block, i.e. a 2.25x reduction.
+ *
+ * The transformed tensors place the 16 transform coefficients on the z dimension:
+ *  - transformed input:  [num_tiles, IFM, 16]
+ *  - transformed filter: [OFM, IFM, 16]
+ *  - multiplied planes:  [num_tiles, OFM, 16]
+ */
+
+#if defined(NUM_TILES_X) && defined(PAD_X) && defined(PAD_Y)
+/** This OpenCL kernel computes the input transform V = B^T d B of the Winograd F(2x2,3x3) convolution
+ *
+ * @note The number of tiles along the x direction must be passed at compile time using -DNUM_TILES_X
+ * @note The left and top padding of the convolution must be passed at compile time using -DPAD_X and -DPAD_Y
+ *
+ * @param[in]  src_ptr                           Pointer to the source tensor. Supported data types: F32
+ * @param[in]  src_stride_x                      Stride of the source tensor in X dimension (in bytes)
+ * @param[in]  src_step_x                        src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src_stride_y                      Stride of the source tensor in Y dimension (in bytes)
+ * @param[in]  src_step_y                        src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src_stride_z                      Stride of the source tensor in Z dimension (in bytes)
+ * @param[in]  src_step_z                        src_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  src_offset_first_element_in_bytes The offset of the first element in the source tensor
+ * @param[out] dst_ptr                           Pointer to the destination tensor. Supported data types: same as @p src_ptr
+ * @param[in]  dst_stride_x                      Stride of the destination tensor in X dimension (in bytes)
+ * @param[in]  dst_step_x                        dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  dst_stride_y                      Stride of the destination tensor in Y dimension (in bytes)
+ * @param[in]  dst_step_y                        dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  dst_stride_z                      Stride of the destination tensor in Z dimension (in bytes)
+ * @param[in]  dst_step_z                        dst_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  dst_offset_first_element_in_bytes The offset of the first element in the destination tensor
+ */
+__kernel void winograd_input_transform_2x2_3x3(TENSOR3D_DECLARATION(src),
+                                               TENSOR3D_DECLARATION(dst))
+{
+    const int tile_x = get_global_id(0);
+    const int tile_y = get_global_id(1);
+    const int c      = get_global_id(2);
+
+    // Top-left corner of the 4x4 input tile; neighbouring tiles overlap by two columns/rows
+    const int x = tile_x * 2 - PAD_X;
+    const int y = tile_y * 2 - PAD_Y;
+
+    __global const uchar *src_addr = src_ptr + src_offset_first_element_in_bytes + c * (int)src_stride_z + y * (int)src_stride_y + x * (int)src_stride_x;
+
+    // Load the 4x4 input tile
+    const float4 d0 = vload4(0, (__global const float *)(src_addr + 0 * (int)src_stride_y));
+    const float4 d1 = vload4(0, (__global const float *)(src_addr + 1 * (int)src_stride_y));
+    const float4 d2 = vload4(0, (__global const float *)(src_addr + 2 * (int)src_stride_y));
+    const float4 d3 = vload4(0, (__global const float *)(src_addr + 3 * (int)src_stride_y));
+
+    // Compute B^T . d
+    const float4 w0 = d0 - d2;
+    const float4 w1 = d1 + d2;
+    const float4 w2 = d2 - d1;
+    const float4 w3 = d1 - d3;
+
+    // Compute (B^T . d) . B
+    const float4 v0 = (float4)(w0.s0 - w0.s2, w0.s1 + w0.s2, w0.s2 - w0.s1, w0.s1 - w0.s3);
+    const float4 v1 = (float4)(w1.s0 - w1.s2, w1.s1 + w1.s2, w1.s2 - w1.s1, w1.s1 - w1.s3);
+    const float4 v2 = (float4)(w2.s0 - w2.s2, w2.s1 + w2.s2, w2.s2 - w2.s1, w2.s1 - w2.s3);
+    const float4 v3 = (float4)(w3.s0 - w3.s2, w3.s1 + w3.s2, w3.s2 - w3.s1, w3.s1 - w3.s3);
+
+    // Store the 16 transform coefficients, one per z-plane
+    const int        tile_idx = tile_y * NUM_TILES_X + tile_x;
+    __global uchar *dst_addr  = dst_ptr + dst_offset_first_element_in_bytes + tile_idx * dst_stride_x + c * dst_stride_y;
+
+    *((__global float *)(dst_addr + 0 * dst_stride_z))  = v0.s0;
+    *((__global float *)(dst_addr + 1 * dst_stride_z))  = v0.s1;
+    *((__global float *)(dst_addr + 2 * dst_stride_z))  = v0.s2;
+    *((__global float *)(dst_addr + 3 * dst_stride_z))  = v0.s3;
+    *((__global float *)(dst_addr + 4 * dst_stride_z))  = v1.s0;
+    *((__global float *)(dst_addr + 5 * dst_stride_z))  = v1.s1;
+    *((__global float *)(dst_addr + 6 * dst_stride_z))  = v1.s2;
+    *((__global float *)(dst_addr + 7 * dst_stride_z))  = v1.s3;
+    *((__global float *)(dst_addr + 8 * dst_stride_z))  = v2.s0;
+    *((__global float *)(dst_addr + 9 * dst_stride_z))  = v2.s1;
+    *((__global float *)(dst_addr + 10 * dst_stride_z)) = v2.s2;
+    *((__global float *)(dst_addr + 11 * dst_stride_z)) = v2.s3;
+    *((__global float *)(dst_addr + 12 * dst_stride_z)) = v3.s0;
+    *((__global float *)(dst_addr + 13 * dst_stride_z)) = v3.s1;
+    *((__global float *)(dst_addr + 14 * dst_stride_z)) = v3.s2;
+    *((__global float *)(dst_addr + 15 * dst_stride_z)) = v3.s3;
+}
+#endif // defined(NUM_TILES_X) && defined(PAD_X) && defined(PAD_Y)
+
+/** This OpenCL kernel computes the filter transform U = G g G^T of the Winograd F(2x2,3x3) convolution
+ *
+ * @param[in]  src_ptr                           Pointer to the source tensor (4D weights [3, 3, IFM, OFM]). Supported data types: F32
+ * @param[in]  src_stride_x                      Stride of the source tensor in X dimension (in bytes)
+ * @param[in]  src_step_x                        src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src_stride_y                      Stride of the source tensor in Y dimension (in bytes)
+ * @param[in]  src_step_y                        src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src_stride_z                      Stride of the source tensor in Z dimension (in bytes)
+ * @param[in]  src_step_z                        src_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  src_offset_first_element_in_bytes The offset of the first element in the source tensor
+ * @param[in]  src_stride_w                      Stride of the source tensor in W dimension (in bytes)
+ * @param[out] dst_ptr                           Pointer to the destination tensor. Supported data types: same as @p src_ptr
+ * @param[in]  dst_stride_x                      Stride of the destination tensor in X dimension (in bytes)
+ * @param[in]  dst_step_x                        dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  dst_stride_y                      Stride of the destination tensor in Y dimension (in bytes)
+ * @param[in]  dst_step_y                        dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  dst_stride_z                      Stride of the destination tensor in Z dimension (in bytes)
+ * @param[in]  dst_step_z                        dst_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  dst_offset_first_element_in_bytes The offset of the first element in the destination tensor
+ */
+__kernel void winograd_filter_transform_2x2_3x3(TENSOR3D_DECLARATION(src),
+                                                uint src_stride_w,
+                                                TENSOR3D_DECLARATION(dst))
+{
+    const int c = get_global_id(0);
+    const int k = get_global_id(1);
+
+    __global const uchar *src_addr = src_ptr + src_offset_first_element_in_bytes + c * src_stride_z + k * src_stride_w;
+
+    // Load the 3x3 filter
+    const float3 g0 = vload3(0, (__global const float *)(src_addr + 0 * src_stride_y));
+    const float3 g1 = vload3(0, (__global const float *)(src_addr + 1 * src_stride_y));
+    const float3 g2 = vload3(0, (__global const float *)(src_addr + 2 * src_stride_y));
+
+    // Compute G . g
+    const float3 t0 = g0;
+    const float3 t1 = 0.5f * (g0 + g1 + g2);
+    const float3 t2 = 0.5f * (g0 - g1 + g2);
+    const float3 t3 = g2;
+
+    // Compute (G . g) . G^T
+    const float4 u0 = (float4)(t0.s0, 0.5f * (t0.s0 + t0.s1 + t0.s2), 0.5f * (t0.s0 - t0.s1 + t0.s2), t0.s2);
+    const float4 u1 = (float4)(t1.s0, 0.5f * (t1.s0 + t1.s1 + t1.s2), 0.5f * (t1.s0 - t1.s1 + t1.s2), t1.s2);
+    const float4 u2 = (float4)(t2.s0, 0.5f * (t2.s0 + t2.s1 + t2.s2), 0.5f * (t2.s0 - t2.s1 + t2.s2), t2.s2);
+    const float4 u3 = (float4)(t3.s0, 0.5f * (t3.s0 + t3.s1 + t3.s2), 0.5f * (t3.s0 - t3.s1 + t3.s2), t3.s2);
+
+    // Store the 16 transform coefficients, one per z-plane
+    __global uchar *dst_addr = dst_ptr + dst_offset_first_element_in_bytes + k * dst_stride_x + c * dst_stride_y;
+
+    *((__global float *)(dst_addr + 0 * dst_stride_z))  = u0.s0;
+    *((__global float *)(dst_addr + 1 * dst_stride_z))  = u0.s1;
+    *((__global float *)(dst_addr + 2 * dst_stride_z))  = u0.s2;
+    *((__global float *)(dst_addr + 3 * dst_stride_z))  = u0.s3;
+    *((__global float *)(dst_addr + 4 * dst_stride_z))  = u1.s0;
+    *((__global float *)(dst_addr + 5 * dst_stride_z))  = u1.s1;
+    *((__global float *)(dst_addr + 6 * dst_stride_z))  = u1.s2;
+    *((__global float *)(dst_addr + 7 * dst_stride_z))  = u1.s3;
+    *((__global float *)(dst_addr + 8 * dst_stride_z))  = u2.s0;
+    *((__global float *)(dst_addr + 9 * dst_stride_z))  = u2.s1;
+    *((__global float *)(dst_addr + 10 * dst_stride_z)) = u2.s2;
+    *((__global float *)(dst_addr + 11 * dst_stride_z)) = u2.s3;
+    *((__global float *)(dst_addr + 12 * dst_stride_z)) = u3.s0;
+    *((__global float *)(dst_addr + 13 * dst_stride_z)) = u3.s1;
+    *((__global float *)(dst_addr + 14 * dst_stride_z)) = u3.s2;
+    *((__global float *)(dst_addr + 15 * dst_stride_z)) = u3.s3;
+}
+
+#if defined(NUM_CHANNELS)
+/** This OpenCL kernel computes the 16 independent matrix multiplications between the transformed input and the transformed filter of the Winograd F(2x2,3x3) convolution
+ *
+ * @note The number of input channels must be passed at compile time using -DNUM_CHANNELS
+ *
+ * @param[in]  src0_ptr                           Pointer to the transformed input tensor [num_tiles, IFM, 16]. Supported data types: F32
+ * @param[in]  src0_stride_x                      Stride of the transformed input tensor in X dimension (in bytes)
+ * @param[in]  src0_step_x                        src0_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src0_stride_y                      Stride of the transformed input tensor in Y dimension (in bytes)
+ * @param[in]  src0_step_y                        src0_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src0_stride_z                      Stride of the transformed input tensor in Z dimension (in bytes)
+ * @param[in]  src0_step_z                        src0_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  src0_offset_first_element_in_bytes The offset of the first element in the transformed input tensor
+ * @param[in]  src1_ptr                           Pointer to the transformed filter tensor [OFM, IFM, 16]. Supported data types: same as @p src0_ptr
+ * @param[in]  src1_stride_x                      Stride of the transformed filter tensor in X dimension (in bytes)
+ * @param[in]  src1_step_x                        src1_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src1_stride_y                      Stride of the transformed filter tensor in Y dimension (in bytes)
+ * @param[in]  src1_step_y                        src1_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src1_stride_z                      Stride of the transformed filter tensor in Z dimension (in bytes)
+ * @param[in]  src1_step_z                        src1_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  src1_offset_first_element_in_bytes The offset of the first element in the transformed filter tensor
+ * @param[out] dst_ptr                            Pointer to the destination tensor [num_tiles, OFM, 16]. Supported data types: same as @p src0_ptr
+ * @param[in]  dst_stride_x                       Stride of the destination tensor in X dimension (in bytes)
+ * @param[in]  dst_step_x                         dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  dst_stride_y                       Stride of the destination tensor in Y dimension (in bytes)
+ * @param[in]  dst_step_y                         dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  dst_stride_z                       Stride of the destination tensor in Z dimension (in bytes)
+ * @param[in]  dst_step_z                         dst_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  dst_offset_first_element_in_bytes  The offset of the first element in the destination tensor
+ */
+__kernel void winograd_batched_gemm_2x2_3x3(TENSOR3D_DECLARATION(src0),
+                                            TENSOR3D_DECLARATION(src1),
+                                            TENSOR3D_DECLARATION(dst))
+{
+    const int t     = get_global_id(0);
+    const int k     = get_global_id(1);
+    const int plane = get_global_id(2);
+
+    __global const uchar *src0_addr = src0_ptr + src0_offset_first_element_in_bytes + t * src0_stride_x + plane * src0_stride_z;
+    __global const uchar *src1_addr = src1_ptr + src1_offset_first_element_in_bytes + k * src1_stride_x + plane * src1_stride_z;
+
+    float acc = 0.0f;
+
+    for(int c = 0; c < NUM_CHANNELS; ++c)
+    {
+        acc = fma(*((__global const float *)(src0_addr + c * src0_stride_y)), *((__global const float *)(src1_addr + c * src1_stride_y)), acc);
+    }
+
+    *((__global float *)(dst_ptr + dst_offset_first_element_in_bytes + t * dst_stride_x + k * dst_stride_y + plane * dst_stride_z)) = acc;
+}
+#endif // defined(NUM_CHANNELS)
+
+#if defined(NUM_TILES_X)
+/** This OpenCL kernel computes the output transform Y = A^T m A of the Winograd F(2x2,3x3) convolution and writes the resulting 2x2 output block
+ *
+ * @note The number of tiles along the x direction must be passed at compile time using -DNUM_TILES_X
+ * @note If biases are used then -DHAS_BIAS has to be passed at compile time
+ *
+ * @param[in]  src_ptr                            Pointer to the source tensor [num_tiles, OFM, 16]. Supported data types: F32
+ * @param[in]  src_stride_x                       Stride of the source tensor in X dimension (in bytes)
+ * @param[in]  src_step_x                         src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src_stride_y                       Stride of the source tensor in Y dimension (in bytes)
+ * @param[in]  src_step_y                         src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src_stride_z                       Stride of the source tensor in Z dimension (in bytes)
+ * @param[in]  src_step_z                         src_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  src_offset_first_element_in_bytes  The offset of the first element in the source tensor
+ * @param[in]  bias_ptr                           (Optional) Pointer to the biases vector. Supported data types: same as @p src_ptr
+ * @param[in]  bias_stride_x                      (Optional) Stride of the biases vector in X dimension (in bytes)
+ * @param[in]  bias_step_x                        (Optional) bias_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  bias_offset_first_element_in_bytes (Optional) The offset of the first element in the biases vector
+ * @param[out] dst_ptr                            Pointer to the destination tensor. Supported data types: same as @p src_ptr
+ * @param[in]  dst_stride_x                       Stride of the destination tensor in X dimension (in bytes)
+ * @param[in]  dst_step_x                         dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  dst_stride_y                       Stride of the destination tensor in Y dimension (in bytes)
+ * @param[in]  dst_step_y                         dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  dst_stride_z                       Stride of the destination tensor in Z dimension (in bytes)
+ * @param[in]  dst_step_z                         dst_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  dst_offset_first_element_in_bytes  The offset of the first element in the destination tensor
+ */
+__kernel void winograd_output_transform_2x2_3x3(TENSOR3D_DECLARATION(src),
+#if defined(HAS_BIAS)
+                                                VECTOR_DECLARATION(bias),
+#endif // defined(HAS_BIAS)
+                                                TENSOR3D_DECLARATION(dst))
+{
+    const int t = get_global_id(0);
+    const int k = get_global_id(1);
+
+    __global const uchar *src_addr = src_ptr + src_offset_first_element_in_bytes + t * src_stride_x + k * src_stride_y;
+
+    // Gather the 16 multiplied transform coefficients of the tile
+    const float4 m0 = (float4)(*((__global const float *)(src_addr + 0 * src_stride_z)),
+                               *((__global const float *)(src_addr + 1 * src_stride_z)),
+                               *((__global const float *)(src_addr + 2 * src_stride_z)),
+                               *((__global const float *)(src_addr + 3 * src_stride_z)));
+    const float4 m1 = (float4)(*((__global const float *)(src_addr + 4 * src_stride_z)),
+                               *((__global const float *)(src_addr + 5 * src_stride_z)),
+                               *((__global const float *)(src_addr + 6 * src_stride_z)),
+                               *((__global const float *)(src_addr + 7 * src_stride_z)));
+    const float4 m2 = (float4)(*((__global const float *)(src_addr + 8 * src_stride_z)),
+                               *((__global const float *)(src_addr + 9 * src_stride_z)),
+                               *((__global const float *)(src_addr + 10 * src_stride_z)),
+                               *((__global const float *)(src_addr + 11 * src_stride_z)));
+    const float4 m3 = (float4)(*((__global const float *)(src_addr + 12 * src_stride_z)),
+                               *((__global const float *)(src_addr + 13 * src_stride_z)),
+                               *((__global const float *)(src_addr + 14 * src_stride_z)),
+                               *((__global const float *)(src_addr + 15 * src_stride_z)));
+
+    // Compute A^T . m
+    const float4 w0 = m0 + m1 + m2;
+    const float4 w1 = m1 - m2 - m3;
+
+    // Compute (A^T . m) . A
+    float2 out0 = (float2)(w0.s0 + w0.s1 + w0.s2, w0.s1 - w0.s2 - w0.s3);
+    float2 out1 = (float2)(w1.s0 + w1.s1 + w1.s2, w1.s1 - w1.s2 - w1.s3);
+
+#if defined(HAS_BIAS)
+    const float b = *((__global const float *)(bias_ptr + bias_offset_first_element_in_bytes + k * bias_stride_x));
+    out0 += (float2)b;
+    out1 += (float2)b;
+#endif // defined(HAS_BIAS)
+
+    // Store the 2x2 output block
+    const int       x0       = (t % NUM_TILES_X) * 2;
+    const int       y0       = (t / NUM_TILES_X) * 2;
+    __global uchar *dst_addr = dst_ptr + dst_offset_first_element_in_bytes + k * dst_stride_z + y0 * dst_stride_y + x0 * dst_stride_x;
+
+    vstore2(out0, 0, (__global float *)(dst_addr + 0 * dst_stride_y));
+    vstore2(out1, 0, (__global float *)(dst_addr + 1 * dst_stride_y));
+}
+#endif // defined(NUM_TILES_X)
@@ -48,7 +48,8 @@ BorderSize CLDirectConvolutionLayerKernel::border_size() const
     return _border_size;
 }
 
-void CLDirectConvolutionLayerKernel::configure(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info)
+void CLDirectConvolutionLayerKernel::configure(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info,
+                                               AccumulatePrecision acc_precision)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QS8, DataType::QS16, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
@@ -101,6 +102,10 @@ void CLDirectConvolutionLayerKernel::configure(const ICLTensor *input, const ICL
 
     std::set<std::string> options;
 
+    // Inject the optional fused activation, applied by the kernel right before storing the output
+    const std::set<std::string> act_opts = get_build_options_from_activation(act_info, input->info()->data_type());
+    options.insert(act_opts.begin(), act_opts.end());
+
     const GPUTarget gpu_target = get_arch_from_target(get_target());
 
     if(_biases != nullptr)
@@ -178,6 +183,14 @@ void CLDirectConvolutionLayerKernel::configure(const ICLTensor *input, const ICL
         kernel_name << "direct_convolution" << kernel_size << "x" << kernel_size;
         DataType promoted_type = input->info()->data_type();
 
+        // Full-precision accumulation for F16 data widens the accumulator to F32; the 5x5
+        // kernel accumulates in the data type directly and does not support the policy
+        if(acc_precision == AccumulatePrecision::FULL && input->info()->data_type() == DataType::F16)
+        {
+            ARM_COMPUTE_ERROR_ON_MSG(kernel_size == 5, "Full-precision accumulation is not supported for 5x5 F16 convolution");
+            promoted_type = DataType::F32;
+        }
+
         options.emplace("-DDATA_TYPE=" + get_cl_type_from_data_type(input->info()->data_type()));
         options.emplace("-DDATA_SIZE=" + get_data_size_from_data_type(input->info()->data_type()));
         options.emplace("-DWEIGHTS_DEPTH=" + support::cpp11::to_string(_weights->info()->dimension(2)));
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CL/kernels/CLElementWiseChainKernel.h"
+
+#include "arm_compute/core/CL/CLHelpers.h"
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/CL/OpenCL.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <set>
+#include <sstream>
+#include <string>
+
+using namespace arm_compute;
+
+namespace
+{
+constexpr unsigned int num_elems_processed_per_iteration = 16;
+
+/** Single-character tag of an operation, used to name the generated program */
+char op_tag(ElementWiseOp op)
+{
+    switch(op)
+    {
+        case ElementWiseOp::ADD:
+            return 'a';
+        case ElementWiseOp::SUB:
+            return 's';
+        case ElementWiseOp::MUL:
+            return 'm';
+        case ElementWiseOp::MIN:
+            return 'n';
+        case ElementWiseOp::MAX:
+            return 'x';
+        default:
+            ARM_COMPUTE_ERROR("Unsupported element-wise operation");
+            return '?';
+    }
+}
+
+/** Generates the source of the fused chain kernel */
+std::string build_chain_source(size_t num_inputs, const std::vector<ElementWiseOp> &ops)
+{
+    std::stringstream source;
+
+    source << "__kernel void elementwise_chain(\n";
+    for(size_t i = 0; i < num_inputs; ++i)
+    {
+        source << "    TENSOR3D_DECLARATION(in" << i << "),\n";
+    }
+    source << "    TENSOR3D_DECLARATION(out))\n";
+    source << "{\n";
+    for(size_t i = 0; i < num_inputs; ++i)
+    {
+        source << "    Tensor3D in" << i << " = CONVERT_TO_TENSOR3D_STRUCT(in" << i << ");\n";
+    }
+    source << "    Tensor3D out = CONVERT_TO_TENSOR3D_STRUCT(out);\n";
+    source << "    VEC_DATA_TYPE(DATA_TYPE, 16)\n";
+    source << "    acc = vload16(0, (__global DATA_TYPE *)in0.ptr);\n";
+
+    for(size_t i = 0; i < ops.size(); ++i)
+    {
+        std::stringstream rhs;
+        rhs << "vload16(0, (__global DATA_TYPE *)in" << (i + 1) << ".ptr)";
+        switch(ops[i])
+        {
+            case ElementWiseOp::ADD:
+                source << "    acc += " << rhs.str() << ";\n";
+                break;
+            case ElementWiseOp::SUB:
+                source << "    acc -= " << rhs.str() << ";\n";
+                break;
+            case ElementWiseOp::MUL:
+                source << "    acc *= " << rhs.str() << ";\n";
+                break;
+            case ElementWiseOp::MIN:
+                source << "    acc = fmin(acc, " << rhs.str() << ");\n";
+                break;
+            case ElementWiseOp::MAX:
+                source << "    acc = fmax(acc, " << rhs.str() << ");\n";
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Unsupported element-wise operation");
+        }
+    }
+
+    source << "    acc = FUSED_ACTIVATION(acc, VEC_DATA_TYPE(DATA_TYPE, 16));\n";
+    source << "    vstore16(acc, 0, (__global DATA_TYPE *)out.ptr);\n";
+    source << "}\n";
+
+    return source.str();
+}
+} // namespace
+
+CLElementWiseChainKernel::CLElementWiseChainKernel()
+    : _inputs(), _output(nullptr)
+{
+}
+
+void CLElementWiseChainKernel::configure(const std::vector<const ICLTensor *> &inputs, ICLTensor *output, const std::vector<ElementWiseOp> &ops, const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(inputs.size() != ops.size() + 1, "The chain needs one more input than it has operations");
+    ARM_COMPUTE_ERROR_ON(ops.empty());
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(inputs[0], 1, DataType::F16, DataType::F32);
+    for(const ICLTensor *input : inputs)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(inputs[0], input);
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(inputs[0], input);
+    }
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(inputs[0], output);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(inputs[0], output);
+
+    const DataType data_type = inputs[0]->info()->data_type();
+
+    // The activation is implemented by the FUSED_ACTIVATION variants of helpers.h
+    std::set<std::string> build_opts = get_build_options_from_activation(act_info, data_type);
+    ARM_COMPUTE_ERROR_ON_MSG(act_info.enabled() && build_opts.empty(), "Activation cannot be fused into the generated kernel");
+    build_opts.emplace("-DDATA_TYPE=" + get_cl_type_from_data_type(data_type));
+
+    _inputs = inputs;
+    _output = output;
+
+    // Generate the program; its name encodes the chain, the activation and the data type are
+    // covered by the build options so the compiled program cache stays correct
+    std::string program_name = "elementwise_chain_";
+    for(ElementWiseOp op : ops)
+    {
+        program_name += op_tag(op);
+    }
+    const std::string source = build_chain_source(inputs.size(), ops);
+
+    // Create kernel
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel_from_source("elementwise_chain", program_name, source, build_opts));
+
+    // Configure kernel window
+    Window                 win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win, output_access);
+    for(const ICLTensor *input : inputs)
+    {
+        update_window_and_padding(win, AccessWindowHorizontal(input->info(), 0, num_elems_processed_per_iteration));
+    }
+
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    ICLKernel::configure(win);
+}
+
+void CLElementWiseChainKernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICLKernel::window(), window);
+
+    Window slice = window.first_slice_window_3D();
+    do
+    {
+        unsigned int idx = 0;
+        for(const ICLTensor *input : _inputs)
+        {
+            add_3D_tensor_argument(idx, input, slice);
+        }
+        add_3D_tensor_argument(idx, _output, slice);
+
+        enqueue(queue, *this, slice);
+    }
+    while(window.slide_window_slice_3D(slice));
+}
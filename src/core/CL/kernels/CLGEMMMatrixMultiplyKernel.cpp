@@ -44,11 +44,11 @@
 using namespace arm_compute;
 
 CLGEMMMatrixMultiplyKernel::CLGEMMMatrixMultiplyKernel()
-    : _input0(nullptr), _input1(nullptr), _output(nullptr)
+    : _input0(nullptr), _input1(nullptr), _output(nullptr), _is_interleaved_transposed(false)
 {
 }
 
-void CLGEMMMatrixMultiplyKernel::configure(const ICLTensor *input0, const ICLTensor *input1, ICLTensor *output, float alpha, bool is_interleaved_transposed)
+void CLGEMMMatrixMultiplyKernel::configure(const ICLTensor *input0, const ICLTensor *input1, ICLTensor *output, float alpha, bool is_interleaved_transposed, const ActivationLayerInfo &act_info)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input0, 1, DataType::QS8, DataType::QS16, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, input1, output);
@@ -59,23 +59,28 @@ void CLGEMMMatrixMultiplyKernel::configure(const ICLTensor *input0, const ICLTen
         ARM_COMPUTE_ERROR_ON(input0->info()->dimension(0) != input1->info()->dimension(1));
     }
 
-    _input0 = input0;
-    _input1 = input1;
-    _output = output;
+    _input0                    = input0;
+    _input1                    = input1;
+    _output                    = output;
+    _is_interleaved_transposed = is_interleaved_transposed;
 
     if(output->info()->dimension(1) == 196)
     {
-        _lws_hint = cl::NDRange(1, 7);
+        _lws_hint = cl::NDRange(1, 7, 1);
     }
     else
     {
-        _lws_hint = cl::NDRange(8, 8);
+        _lws_hint = cl::NDRange(8, 8, 1);
     }
 
     std::set<std::string> build_opts;
     build_opts.emplace(("-DCOLS_A=" + support::cpp11::to_string(input0->info()->dimension(0))));
     build_opts.emplace(("-DCOLS_B=" + support::cpp11::to_string(input1->info()->dimension(0))));
 
+    // Inject the optional fused activation, applied by the kernel right before storing the output
+    const std::set<std::string> act_opts = get_build_options_from_activation(act_info, input0->info()->data_type());
+    build_opts.insert(act_opts.begin(), act_opts.end());
+
     if(is_data_type_fixed_point(input0->info()->data_type()))
     {
         build_opts.emplace(("-DALPHA=" + support::cpp11::to_string((input0->info()->data_type() == DataType::QS8 ?
@@ -123,6 +128,8 @@ void CLGEMMMatrixMultiplyKernel::configure(const ICLTensor *input0, const ICLTen
     else // The input tensors have not been reshaped
     {
         ARM_COMPUTE_ERROR_ON(input0->info()->dimension(0) != input1->info()->dimension(1));
+        ARM_COMPUTE_ERROR_ON_MSG(input0->info()->num_dimensions() > 2 && input0->info()->dimension(2) != output->info()->dimension(2),
+                                 "Matrix A and the output must have the same number of batches");
 
         // Special case for 1xN, 2xN, 3xN and 4xN input0 tensor
         const unsigned int num_elems_processed_per_iteration_x = max_cl_vector_width / data_size_from_type(input0->info()->data_type());
@@ -132,6 +139,13 @@ void CLGEMMMatrixMultiplyKernel::configure(const ICLTensor *input0, const ICLTen
         build_opts.emplace(("-DNUM_ELEMS_PROCESSED_PER_THREAD_X=" + support::cpp11::to_string(num_elems_processed_per_iteration_x)));
         build_opts.emplace(("-DNUM_ELEMS_PROCESSED_PER_THREAD_Y=" + support::cpp11::to_string(num_elems_processed_per_iteration_y)));
 
+        // If matrix B is batched as well, each batch multiplies its own slice of it. Otherwise it is shared across the batch
+        if(input1->info()->num_dimensions() > 2)
+        {
+            ARM_COMPUTE_ERROR_ON(input1->info()->dimension(2) != output->info()->dimension(2));
+            build_opts.emplace(("-DMATRIX_B_DEPTH=" + support::cpp11::to_string(input1->info()->dimension(2))));
+        }
+
         // Create kernel
         if(is_data_type_fixed_point(input0->info()->data_type()))
         {
@@ -140,8 +154,13 @@ void CLGEMMMatrixMultiplyKernel::configure(const ICLTensor *input0, const ICLTen
         }
         else
         {
+            // On Bifrost, use the variants mapping the inner products on fused multiply-accumulate instructions (double rate in half precision)
             std::string kernel_name = "gemm_mm_floating_point";
-            _kernel                 = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel((kernel_name), build_opts));
+            if(get_arch_from_target(get_target()) == GPUTarget::BIFROST)
+            {
+                kernel_name += "_" + lower_string(string_from_data_type(input0->info()->data_type())) + "_bifrost";
+            }
+            _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel((kernel_name), build_opts));
         }
 
         Window win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration_x, num_elems_processed_per_iteration_y));
@@ -176,6 +195,17 @@ void CLGEMMMatrixMultiplyKernel::run(const Window &window, cl::CommandQueue &que
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICLKernel::window(), window);
 
+    if(!_is_interleaved_transposed)
+    {
+        // The non-reshaped kernels range over the batch on the z dimension, so a single dispatch covers the whole batch
+        unsigned int idx = 0;
+        add_3D_tensor_argument(idx, _input0, window);
+        add_3D_tensor_argument(idx, _input1, window);
+        add_3D_tensor_argument(idx, _output, window);
+        enqueue(queue, *this, window, _lws_hint);
+        return;
+    }
+
     Window slice          = window.first_slice_window_2D();
     Window slice_matrix_b = slice;
 
@@ -133,6 +133,7 @@ void CLHOGBlockNormalizationKernel::configure(const ICLTensor *input, ICLTensor
                                      hog_info->block_size().height / hog_info->cell_size().height);
 
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, hog_info->num_bins() * num_cells_per_block.area(), DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MSG(hog_info->normalization_type() == HOGNormType::L1SQRT_NORM, "L1SQRT_NORM is only supported by the NEON backend");
 
     // Number of cells per block stride
     const Size2D num_cells_per_block_stride(hog_info->block_stride().width / hog_info->cell_size().width,
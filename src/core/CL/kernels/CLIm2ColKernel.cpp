@@ -44,11 +44,12 @@ CLIm2ColKernel::CLIm2ColKernel()
 {
 }
 
-void CLIm2ColKernel::configure(const ICLTensor *input, ICLTensor *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info, bool has_bias)
+void CLIm2ColKernel::configure(const ICLTensor *input, ICLTensor *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info, bool has_bias, const Size2D &dilation)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QS8, DataType::QS16, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_FIXED_POINT(input, output);
+    ARM_COMPUTE_ERROR_ON(dilation.width == 0 || dilation.height == 0);
 
     _input  = input;
     _output = output;
@@ -74,12 +75,14 @@ void CLIm2ColKernel::configure(const ICLTensor *input, ICLTensor *output, const
                                      && (std::equal(input->info()->tensor_shape().cbegin() + 3,
                                                     input->info()->tensor_shape().cend(),
                                                     output->info()->tensor_shape().cbegin() + 1))
-                                     && ((stride_x == 1) && (stride_y == 1) && (pad_x == 0) && (pad_y == 0));
+                                     && ((stride_x == 1) && (stride_y == 1) && (pad_x == 0) && (pad_y == 0))
+                                     && ((dilation.width == 1) && (dilation.height == 1));
 
     if(!run_img2col_reduced)
     {
+        // The dilated kernel covers ((size - 1) * dilation + 1) input elements in each dimension
         _convolved_dims = scaled_dimensions(input->info()->dimension(0), input->info()->dimension(1),
-                                            kernel_dims.width, kernel_dims.height,
+                                            (kernel_dims.width - 1) * dilation.width + 1, (kernel_dims.height - 1) * dilation.height + 1,
                                             conv_info);
         _num_elems_processed_per_iteration = output->info()->dimension(0);
 
@@ -94,8 +97,10 @@ void CLIm2ColKernel::configure(const ICLTensor *input, ICLTensor *output, const
         build_opts.emplace("-DPAD_Y=" + support::cpp11::to_string(conv_info.pad().second));
         build_opts.emplace("-DSRC_WIDTH=" + support::cpp11::to_string(input->info()->dimension(0)));
         build_opts.emplace("-DSRC_HEIGHT=" + support::cpp11::to_string(input->info()->dimension(1)));
+        build_opts.emplace("-DDILATION_X=" + support::cpp11::to_string(dilation.width));
+        build_opts.emplace("-DDILATION_Y=" + support::cpp11::to_string(dilation.height));
 
-        if(kernel_dims.width == 3 && kernel_dims.height == 3 && conv_info.pad().first == 0 && conv_info.pad().second == 0)
+        if(kernel_dims.width == 3 && kernel_dims.height == 3 && conv_info.pad().first == 0 && conv_info.pad().second == 0 && dilation.width == 1 && dilation.height == 1)
         {
             _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("im2col_kernel3x3_padx0_pady0", build_opts));
         }
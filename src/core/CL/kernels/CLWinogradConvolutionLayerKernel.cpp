@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CL/kernels/CLWinogradConvolutionLayerKernel.h"
+
+#include "arm_compute/core/AccessWindowStatic.h"
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <set>
+#include <string>
+
+using namespace arm_compute;
+
+CLWinogradInputTransformKernel::CLWinogradInputTransformKernel()
+    : _input(nullptr), _output(nullptr), _border_size(0)
+{
+}
+
+BorderSize CLWinogradInputTransformKernel::border_size() const
+{
+    return _border_size;
+}
+
+void CLWinogradInputTransformKernel::configure(const ICLTensor *input, ICLTensor *output, const PadStrideInfo &conv_info)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON(std::get<0>(conv_info.stride()) != 1 || std::get<1>(conv_info.stride()) != 1);
+    ARM_COMPUTE_ERROR_ON(std::get<0>(conv_info.pad()) > 1 || std::get<1>(conv_info.pad()) > 1);
+
+    const unsigned int pad_x = std::get<0>(conv_info.pad());
+    const unsigned int pad_y = std::get<1>(conv_info.pad());
+
+    // Each 2x2 output block consumes a 4x4 input tile: tiles overlap by two columns/rows
+    const unsigned int num_tiles_x = (input->info()->dimension(0) + pad_x * 2 - 2 + 1) / 2;
+    const unsigned int num_tiles_y = (input->info()->dimension(1) + pad_y * 2 - 2 + 1) / 2;
+
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(0) != num_tiles_x * num_tiles_y);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) != input->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(2) != 16);
+
+    _input  = input;
+    _output = output;
+    // The rightmost/bottom tiles read up to two elements past the input
+    _border_size = BorderSize(pad_y, 2, 2, pad_x);
+
+    std::set<std::string> build_opts;
+    build_opts.emplace("-DNUM_TILES_X=" + support::cpp11::to_string(num_tiles_x));
+    build_opts.emplace("-DPAD_X=" + support::cpp11::to_string(pad_x));
+    build_opts.emplace("-DPAD_Y=" + support::cpp11::to_string(pad_y));
+
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("winograd_input_transform_2x2_3x3", build_opts));
+
+    // Configure kernel window: one work item per tile and channel
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, num_tiles_x, 1));
+    win.set(Window::DimY, Window::Dimension(0, num_tiles_y, 1));
+    win.set(Window::DimZ, Window::Dimension(0, input->info()->dimension(2), 1));
+
+    AccessWindowStatic input_access(input->info(),
+                                    -static_cast<int>(pad_x), -static_cast<int>(pad_y),
+                                    num_tiles_x * 2 + 2 - pad_x, num_tiles_y * 2 + 2 - pad_y);
+
+    update_window_and_padding(win, input_access);
+
+    ICLKernel::configure(win);
+}
+
+void CLWinogradInputTransformKernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICLKernel::window(), window);
+
+    unsigned int idx = 0;
+    add_3D_tensor_argument(idx, _input, window);
+    add_3D_tensor_argument(idx, _output, window);
+    enqueue(queue, *this, window);
+}
+
+CLWinogradFilterTransformKernel::CLWinogradFilterTransformKernel()
+    : _weights(nullptr), _output(nullptr)
+{
+}
+
+void CLWinogradFilterTransformKernel::configure(const ICLTensor *weights, ICLTensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(weights, output);
+    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(0) != 3 || weights->info()->dimension(1) != 3);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(0) != weights->info()->dimension(3));
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) != weights->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(2) != 16);
+
+    _weights = weights;
+    _output  = output;
+
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("winograd_filter_transform_2x2_3x3"));
+
+    // Configure kernel window: one work item per input channel and filter
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, weights->info()->dimension(2), 1));
+    win.set(Window::DimY, Window::Dimension(0, weights->info()->dimension(3), 1));
+
+    ICLKernel::configure(win);
+}
+
+void CLWinogradFilterTransformKernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICLKernel::window(), window);
+
+    unsigned int idx = 0;
+    add_3D_tensor_argument(idx, _weights, window);
+    _kernel.setArg<cl_uint>(idx++, _weights->info()->strides_in_bytes()[3]);
+    add_3D_tensor_argument(idx, _output, window);
+    enqueue(queue, *this, window);
+}
+
+CLWinogradBatchedGEMMKernel::CLWinogradBatchedGEMMKernel()
+    : _input0(nullptr), _input1(nullptr), _output(nullptr)
+{
+}
+
+void CLWinogradBatchedGEMMKernel::configure(const ICLTensor *input0, const ICLTensor *input1, ICLTensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input0, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, input1, output);
+    ARM_COMPUTE_ERROR_ON(input0->info()->dimension(1) != input1->info()->dimension(1));
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(0) != input0->info()->dimension(0));
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) != input1->info()->dimension(0));
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(2) != 16);
+
+    _input0 = input0;
+    _input1 = input1;
+    _output = output;
+
+    std::set<std::string> build_opts;
+    build_opts.emplace("-DNUM_CHANNELS=" + support::cpp11::to_string(input0->info()->dimension(1)));
+
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("winograd_batched_gemm_2x2_3x3", build_opts));
+
+    // Configure kernel window: one work item per tile, filter and transform plane
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, output->info()->dimension(0), 1));
+    win.set(Window::DimY, Window::Dimension(0, output->info()->dimension(1), 1));
+    win.set(Window::DimZ, Window::Dimension(0, 16, 1));
+
+    ICLKernel::configure(win);
+}
+
+void CLWinogradBatchedGEMMKernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICLKernel::window(), window);
+
+    unsigned int idx = 0;
+    add_3D_tensor_argument(idx, _input0, window);
+    add_3D_tensor_argument(idx, _input1, window);
+    add_3D_tensor_argument(idx, _output, window);
+    enqueue(queue, *this, window);
+}
+
+CLWinogradOutputTransformKernel::CLWinogradOutputTransformKernel()
+    : _input(nullptr), _biases(nullptr), _output(nullptr)
+{
+}
+
+void CLWinogradOutputTransformKernel::configure(const ICLTensor *input, const ICLTensor *biases, ICLTensor *output, unsigned int num_tiles_x)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON(input->info()->dimension(1) != output->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON(input->info()->dimension(2) != 16);
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        ARM_COMPUTE_ERROR_ON(biases->info()->dimension(0) != input->info()->dimension(1));
+        ARM_COMPUTE_ERROR_ON(biases->info()->num_dimensions() > 1);
+    }
+
+    _input  = input;
+    _biases = biases;
+    _output = output;
+
+    std::set<std::string> build_opts;
+    build_opts.emplace("-DNUM_TILES_X=" + support::cpp11::to_string(num_tiles_x));
+
+    if(biases != nullptr)
+    {
+        build_opts.emplace("-DHAS_BIAS");
+    }
+
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("winograd_output_transform_2x2_3x3", build_opts));
+
+    // Configure kernel window: one work item per tile and filter
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, input->info()->dimension(0), 1));
+    win.set(Window::DimY, Window::Dimension(0, input->info()->dimension(1), 1));
+
+    // Edge tiles write their full 2x2 block even when the output dimensions are odd
+    AccessWindowStatic output_access(output->info(), 0, 0,
+                                     ceil_to_multiple(output->info()->dimension(0), 2), ceil_to_multiple(output->info()->dimension(1), 2));
+
+    update_window_and_padding(win, output_access);
+
+    output_access.set_valid_region(win, ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    ICLKernel::configure(win);
+}
+
+void CLWinogradOutputTransformKernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICLKernel::window(), window);
+
+    unsigned int idx = 0;
+    add_3D_tensor_argument(idx, _input, window);
+
+    if(_biases != nullptr)
+    {
+        add_1D_tensor_argument(idx, _biases, window);
+    }
+
+    add_3D_tensor_argument(idx, _output, window);
+    enqueue(queue, *this, window);
+}
@@ -37,27 +37,21 @@ using namespace arm_compute;
 
 namespace
 {
-inline void check_corner(float x, float y, float strength, InternalKeypoint *output, int32_t *num_corner_candidates, arm_compute::Mutex *corner_candidates_mutex)
+inline void check_corner(float x, float y, float strength, InternalKeypoint *output, std::atomic<int32_t> *num_corner_candidates)
 {
     if(strength != 0.0f)
     {
-        /* Set index and update num_corner_candidate */
-        std::unique_lock<arm_compute::Mutex> lock(*corner_candidates_mutex);
-
-        const int32_t idx = *num_corner_candidates;
-
-        *num_corner_candidates += 1;
-
-        lock.unlock();
+        /* Claim the next index with an atomic increment, no lock needed */
+        const int32_t idx = num_corner_candidates->fetch_add(1, std::memory_order_relaxed);
 
         /* Add keypoint */
         output[idx] = std::make_tuple(x, y, strength);
     }
 }
 
-inline void corner_candidates(const float *__restrict input, InternalKeypoint *__restrict output, int32_t x, int32_t y, int32_t *num_corner_candidates, arm_compute::Mutex *corner_candidates_mutex)
+inline void corner_candidates(const float *__restrict input, InternalKeypoint *__restrict output, int32_t x, int32_t y, std::atomic<int32_t> *num_corner_candidates)
 {
-    check_corner(x, y, *input, output, num_corner_candidates, corner_candidates_mutex);
+    check_corner(x, y, *input, output, num_corner_candidates);
 }
 } // namespace
 
@@ -67,11 +61,11 @@ bool keypoint_compare(const InternalKeypoint &lhs, const InternalKeypoint &rhs)
 }
 
 CPPCornerCandidatesKernel::CPPCornerCandidatesKernel()
-    : _num_corner_candidates(nullptr), _corner_candidates_mutex(), _input(nullptr), _output(nullptr)
+    : _num_corner_candidates(nullptr), _input(nullptr), _output(nullptr)
 {
 }
 
-void CPPCornerCandidatesKernel::configure(const IImage *input, InternalKeypoint *output, int32_t *num_corner_candidates)
+void CPPCornerCandidatesKernel::configure(const IImage *input, InternalKeypoint *output, std::atomic<int32_t> *num_corner_candidates)
 {
     ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
@@ -102,7 +96,7 @@ void CPPCornerCandidatesKernel::run(const Window &window, const ThreadInfo &info
 
     execute_window_loop(window, [&](const Coordinates & id)
     {
-        corner_candidates(reinterpret_cast<float *>(input.ptr()), &_output[0], id.x(), id.y(), _num_corner_candidates, &_corner_candidates_mutex);
+        corner_candidates(reinterpret_cast<float *>(input.ptr()), &_output[0], id.x(), id.y(), _num_corner_candidates);
     },
     input);
 }
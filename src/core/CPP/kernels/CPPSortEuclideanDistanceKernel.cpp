@@ -49,7 +49,7 @@ CPPSortEuclideanDistanceKernel::CPPSortEuclideanDistanceKernel()
 {
 }
 
-void CPPSortEuclideanDistanceKernel::configure(InternalKeypoint *in_out, IKeyPointArray *output, const int32_t *num_corner_candidates, float min_distance)
+void CPPSortEuclideanDistanceKernel::configure(InternalKeypoint *in_out, IKeyPointArray *output, const std::atomic<int32_t> *num_corner_candidates, float min_distance)
 {
     ARM_COMPUTE_ERROR_ON(nullptr == in_out);
     ARM_COMPUTE_ERROR_ON(nullptr == output);
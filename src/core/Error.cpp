@@ -28,6 +28,23 @@
 #include <iostream>
 #include <stdexcept>
 
+namespace
+{
+// Thread-affine so suspending validation on a steady-state inference thread does not
+// silence the checks of threads still configuring or debugging
+thread_local bool thread_validation_enabled = true;
+} // namespace
+
+bool arm_compute::validation_enabled()
+{
+    return thread_validation_enabled;
+}
+
+void arm_compute::set_validation_enabled(bool enabled)
+{
+    thread_validation_enabled = enabled;
+}
+
 void arm_compute::error(const char *function, const char *file, const int line, const char *msg, ...)
 {
     char    out[512];
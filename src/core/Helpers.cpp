@@ -29,6 +29,7 @@
 #include "arm_compute/core/Utils.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 
 using namespace arm_compute;
@@ -162,3 +163,44 @@ Window arm_compute::calculate_max_window_horizontal(const ITensorInfo &info, con
 
     return window;
 }
+
+Window arm_compute::collapse_window_if_contiguous(const Window &window, std::initializer_list<const ITensorInfo *> tensors)
+{
+    return collapse_window_if_contiguous(window, std::vector<const ITensorInfo *>(tensors));
+}
+
+Window arm_compute::collapse_window_if_contiguous(const Window &window, const std::vector<const ITensorInfo *> &tensors)
+{
+    for(const ITensorInfo *info : tensors)
+    {
+        if(info == nullptr || !info->padding().empty())
+        {
+            return window;
+        }
+    }
+    return window.collapse_if_possible(window, Window::DimY);
+}
+
+int arm_compute::cache_block_side(size_t cache_size, size_t element_size, int step)
+{
+    ARM_COMPUTE_ERROR_ON(element_size == 0);
+    ARM_COMPUTE_ERROR_ON(step <= 0);
+
+    // A block of side B moves 2 * B^2 * element_size bytes between source and destination;
+    // solve for the side filling half the cache
+    const auto side = static_cast<int>(std::sqrt(static_cast<float>(cache_size) / (4 * element_size)));
+
+    return std::max(side - side % step, step);
+}
+
+bool arm_compute::padding_less_execution_required(std::initializer_list<const ITensorInfo *> tensors)
+{
+    for(const ITensorInfo *info : tensors)
+    {
+        if(info != nullptr && !info->is_resizable() && info->padding().empty())
+        {
+            return true;
+        }
+    }
+    return false;
+}
@@ -23,19 +23,73 @@
  */
 #include "arm_compute/core/IKernel.h"
 
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Utils.h"
+
+#include <algorithm>
+
 using namespace arm_compute;
 
 const Window &IKernel::window() const
 {
+    resolve_deferred_collapse();
     return _window;
 }
 
 IKernel::IKernel()
-    : _window()
+    : _window(), _max_window(), _collapse_tensors()
 {
     // Create an empty window to make sure the children classes set the window values themselves
     _window.set(Window::DimX, Window::Dimension(0, 0, 1));
     _window.set(Window::DimY, Window::Dimension(0, 0, 1));
+    _max_window = _window;
+}
+
+void IKernel::collapse_window_when_contiguous(std::initializer_list<const ITensorInfo *> tensors)
+{
+    _collapse_tensors.assign(tensors.begin(), tensors.end());
+}
+
+void IKernel::resolve_deferred_collapse() const
+{
+    if(_collapse_tensors.empty())
+    {
+        return;
+    }
+
+    // By the first dispatch the tensors have been allocated and their padding is final;
+    // collapsing any earlier could bake in a layout a later-configured kernel still extends
+    _window     = collapse_window_if_contiguous(_window, _collapse_tensors);
+    _max_window = _window;
+    _collapse_tensors.clear();
+}
+
+void IKernel::trim_window(const TensorShape &shape)
+{
+    // Trimmed execution leaves part of each dimension unused, so the tensors are never
+    // contiguous along the trimmed window: a pending collapse no longer applies
+    _collapse_tensors.clear();
+    _window = _max_window;
+
+    for(size_t d = 0; d < shape.num_dimensions(); ++d)
+    {
+        const Window::Dimension &dim = _max_window[d];
+        if(dim.step() == 0)
+        {
+            continue;
+        }
+
+        // Clamp the end to the actual extent rounded up to the step, so kernels processing
+        // several elements per iteration keep their vector width and read into the padding
+        const int extent     = std::max<int>(0, static_cast<int>(shape[d]) - dim.start());
+        const int actual_end = dim.start() + static_cast<int>(ceil_to_multiple(extent, dim.step()));
+        _window.set(d, Window::Dimension(dim.start(), std::min(dim.end(), actual_end), dim.step()));
+    }
+}
+
+void IKernel::reset_window()
+{
+    _window = _max_window;
 }
 
 bool IKernel::is_parallelisable() const
@@ -50,5 +104,6 @@ BorderSize IKernel::border_size() const
 
 void IKernel::configure(const Window &window)
 {
-    _window = window;
+    _window     = window;
+    _max_window = window;
 }
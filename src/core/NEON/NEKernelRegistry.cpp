@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/NEKernelRegistry.h"
+
+#include "arm_compute/core/Error.h"
+#include "support/ToolchainSupport.h"
+
+#if defined(__arm__)
+#include "arm_compute/core/NEON/kernels/arm32/NEGEMMAArch32Kernel.h"
+#elif defined(__aarch64__)
+#include "arm_compute/core/NEON/kernels/arm64/NEGEMMAArch64Kernel.h"
+#include "arm_compute/core/NEON/kernels/arm64/NEGEMMLowpAArch64DotKernel.h"
+#include "arm_compute/core/NEON/kernels/arm64/NEGEMMLowpAArch64Kernel.h"
+#include "arm_compute/core/NEON/kernels/arm64/NEGEMVAArch64Kernel.h"
+#endif /* defined(__arm__) */
+
+#include <utility>
+
+using namespace arm_compute;
+
+namespace
+{
+constexpr unsigned int target_value(CPUTarget target)
+{
+    return static_cast<unsigned int>(target);
+}
+
+unsigned int target_arch(CPUTarget target)
+{
+    return target_value(target) & target_value(CPUTarget::ARCH_MASK);
+}
+
+unsigned int target_model(CPUTarget target)
+{
+    return target_value(target) & target_value(CPUTarget::CPU_MODEL);
+}
+
+unsigned int target_features(CPUTarget target)
+{
+    return target_value(target) & ~(target_value(CPUTarget::ARCH_MASK) | target_value(CPUTarget::CPU_MODEL));
+}
+} // namespace
+
+NEKernelRegistry &NEKernelRegistry::get()
+{
+    static NEKernelRegistry registry;
+    return registry;
+}
+
+NEKernelRegistry::NEKernelRegistry()
+    : _variants()
+{
+#if defined(__arm__)
+    register_variant("gemm_interleaved_f32", CPUTarget::ARMV7, []() -> std::unique_ptr<ICPPKernel>
+    {
+        return support::cpp14::make_unique<NEGEMMAArch32Kernel>();
+    });
+#elif defined(__aarch64__)
+    register_variant("gemm_interleaved_f32", CPUTarget::ARMV8, []() -> std::unique_ptr<ICPPKernel>
+    {
+        return support::cpp14::make_unique<NEGEMMAArch64Kernel>();
+    });
+    register_variant("gemm_interleaved_lowp", CPUTarget::ARMV8, []() -> std::unique_ptr<ICPPKernel>
+    {
+        return support::cpp14::make_unique<NEGEMMLowpAArch64Kernel>();
+    });
+    register_variant("gemv_trans_f32", CPUTarget::ARMV8, []() -> std::unique_ptr<ICPPKernel>
+    {
+        return support::cpp14::make_unique<NEGEMVAArch64Kernel>();
+    });
+#if defined(__ARM_FEATURE_DOTPROD)
+    // Only eligible on CPUs reporting the ARMv8.2 dot product extension, where it
+    // replaces the widening multiply-accumulate chains with SDOT/UDOT
+    register_variant("gemm_interleaved_lowp", CPUTarget::ARMV8_2_DOT, []() -> std::unique_ptr<ICPPKernel>
+    {
+        return support::cpp14::make_unique<NEGEMMLowpAArch64DotKernel>();
+    });
+#endif /* defined(__ARM_FEATURE_DOTPROD) */
+#endif /* defined(__arm__) */
+}
+
+void NEKernelRegistry::register_variant(std::string op, CPUTarget target, KernelFactory factory)
+{
+    ARM_COMPUTE_ERROR_ON(factory == nullptr);
+
+    _variants[std::move(op)].push_back({ target, std::move(factory) });
+}
+
+std::unique_ptr<ICPPKernel> NEKernelRegistry::create(const std::string &op, const CPUInfo &info) const
+{
+    const auto it = _variants.find(op);
+    if(it == _variants.end())
+    {
+        return nullptr;
+    }
+
+    const Variant *best = nullptr;
+    for(const Variant &variant : it->second)
+    {
+        // The architecture level gates eligibility and required features must all be present
+        if(target_arch(variant._target) > target_arch(info.CPU))
+        {
+            continue;
+        }
+        if((target_features(variant._target) & target_features(info.CPU)) != target_features(variant._target))
+        {
+            continue;
+        }
+        // Model-specific variants only run on their model
+        if(target_model(variant._target) != 0 && target_model(variant._target) != target_model(info.CPU))
+        {
+            continue;
+        }
+        // Higher target values carry more model/feature bits, so the most specific eligible
+        // variant wins; later registrations break ties, letting applications override built-ins
+        if(best == nullptr || target_value(variant._target) >= target_value(best->_target))
+        {
+            best = &variant;
+        }
+    }
+
+    return (best != nullptr) ? best->_factory() : nullptr;
+}
@@ -28,6 +28,7 @@
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/NEON/NEFixedPoint.h"
 #include "arm_compute/core/NEON/NEMath.h"
+#include "arm_compute/core/NEON/NEVectorTraits.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
@@ -41,17 +42,26 @@
 using namespace arm_compute;
 
 NEActivationLayerKernel::NEActivationLayerKernel()
-    : _input(nullptr), _output(nullptr), _func(nullptr), _act_info(ActivationFunction::LOGISTIC)
+    : _input(nullptr), _output(nullptr), _zero_mask(nullptr), _func(nullptr), _act_info(ActivationFunction::LOGISTIC), _padding_less(false), _lut()
 {
 }
 
-void NEActivationLayerKernel::configure(ITensor *input, ITensor *output, ActivationLayerInfo activation_info)
+void NEActivationLayerKernel::configure(ITensor *input, ITensor *output, ActivationLayerInfo activation_info, ITensor *zero_mask)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QS8, DataType::QS16, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QS8, DataType::QASYMM8, DataType::QS16, DataType::F16, DataType::F32);
 
-    _input    = input;
-    _act_info = activation_info;
-    _output   = input;
+    if(zero_mask != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(input->info()->data_type() != DataType::F32, "The zero mask is only supported for F32");
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(zero_mask, 1, DataType::U8);
+        ARM_COMPUTE_ERROR_ON(zero_mask->info()->dimension(0) != (input->info()->dimension(0) + zero_mask_segment_size - 1) / zero_mask_segment_size);
+        ARM_COMPUTE_ERROR_ON(zero_mask->info()->dimension(1) != input->info()->dimension(1));
+    }
+
+    _input     = input;
+    _act_info  = activation_info;
+    _output    = input;
+    _zero_mask = zero_mask;
 
     if(output != nullptr)
     {
@@ -113,6 +123,14 @@ void NEActivationLayerKernel::configure(ITensor *input, ITensor *output, Activat
         { ActivationFunction::SQUARE, &NEActivationLayerKernel::activation<ActivationFunction::SQUARE, qint8_t> },
         { ActivationFunction::TANH, &NEActivationLayerKernel::activation<ActivationFunction::TANH, qint8_t> },
     };
+    // Activation functions : QASYMM8
+    // Only the activations that are monotonic in the quantized domain are supported
+    static std::map<ActivationFunction, ActivationFunctionExecutorPtr> act_map_qasymm8 =
+    {
+        { ActivationFunction::RELU, &NEActivationLayerKernel::activation<ActivationFunction::RELU, uint8_t> },
+        { ActivationFunction::BOUNDED_RELU, &NEActivationLayerKernel::activation<ActivationFunction::BOUNDED_RELU, uint8_t> },
+        { ActivationFunction::LU_BOUNDED_RELU, &NEActivationLayerKernel::activation<ActivationFunction::LU_BOUNDED_RELU, uint8_t> },
+    };
     // Activation functions : QS16
     static std::map<ActivationFunction, ActivationFunctionExecutorPtr> act_map_qs16 =
     {
@@ -129,28 +147,136 @@ void NEActivationLayerKernel::configure(ITensor *input, ITensor *output, Activat
         { ActivationFunction::TANH, &NEActivationLayerKernel::activation<ActivationFunction::TANH, qint16_t> },
     };
 
-    switch(input->info()->data_type())
+    const DataType data_type = input->info()->data_type();
+
+    // For 8-bit data types the transcendental activations only have 256 possible inputs:
+    // precompute every output at configure time and apply the function as a table lookup
+    bool use_lut = false;
+
+    if(data_type == DataType::QS8 || data_type == DataType::QASYMM8)
     {
-        case DataType::QS8:
-            _func = act_map_qs8[activation_info.activation()];
-            break;
-        case DataType::QS16:
-            _func = act_map_qs16[activation_info.activation()];
-            break;
-        case DataType::F32:
-            _func = act_map_f32[activation_info.activation()];
-            break;
+        switch(activation_info.activation())
+        {
+            case ActivationFunction::LOGISTIC:
+            case ActivationFunction::TANH:
+            case ActivationFunction::SOFT_RELU:
+                use_lut = true;
+                break;
+            default:
+                break;
+        }
+    }
+
+    if(use_lut)
+    {
+        const int              fixed_point_position = input->info()->fixed_point_position();
+        const QuantizationInfo qinfo_in             = input->info()->quantization_info();
+        const QuantizationInfo qinfo_out            = (output != nullptr) ? output->info()->quantization_info() : qinfo_in;
+        const float            a                    = activation_info.a();
+        const float            b                    = activation_info.b();
+
+        for(unsigned int i = 0; i < _lut.size(); ++i)
+        {
+            const float in = (data_type == DataType::QS8) ? scvt_f32_qs8(static_cast<qint8_t>(i), fixed_point_position) : qinfo_in.dequantize(static_cast<uint8_t>(i));
+
+            float out = 0.f;
+
+            switch(activation_info.activation())
+            {
+                case ActivationFunction::LOGISTIC:
+                    out = 1.f / (1.f + std::exp(-in));
+                    break;
+                case ActivationFunction::TANH:
+                    out = a * std::tanh(b * in);
+                    break;
+                case ActivationFunction::SOFT_RELU:
+                    out = std::log(1.f + std::exp(in));
+                    break;
+                default:
+                    break;
+            }
+
+            _lut[i] = (data_type == DataType::QS8) ? static_cast<uint8_t>(sqcvt_qs8_f32(out, fixed_point_position)) : qinfo_out.quantize(out);
+        }
+
+        _func = &NEActivationLayerKernel::activation_lut;
+    }
+    else
+    {
+        switch(data_type)
+        {
+            case DataType::QS8:
+                _func = act_map_qs8[activation_info.activation()];
+                break;
+            case DataType::QASYMM8:
+                ARM_COMPUTE_ERROR_ON_MSG(act_map_qasymm8.find(activation_info.activation()) == act_map_qasymm8.end(), "Activation function not supported for QASYMM8");
+                _func = act_map_qasymm8[activation_info.activation()];
+                break;
+            case DataType::QS16:
+                _func = act_map_qs16[activation_info.activation()];
+                break;
+            case DataType::F32:
+                _func = act_map_f32[activation_info.activation()];
+                break;
 #ifdef ARM_COMPUTE_ENABLE_FP16
-        case DataType::F16:
-            _func = act_map_f16[activation_info.activation()];
-            break;
+            case DataType::F16:
+                _func = act_map_f16[activation_info.activation()];
+                break;
 #endif /* ARM_COMPUTE_ENABLE_FP16 */
-        default:
-            ARM_COMPUTE_ERROR("Unsupported data type.");
+            default:
+                ARM_COMPUTE_ERROR("Unsupported data type.");
+        }
     }
 
     constexpr unsigned int num_elems_processed_per_iteration = 16;
 
+    // Tensors whose layout is already fixed without a border (e.g. imported camera buffers)
+    // cannot grow the padding the vector loop needs past the last aligned column: restrict the
+    // window to the aligned part of each row and process the leftover columns with a scalar tail
+    if(padding_less_execution_required({ input->info(), (output != nullptr) ? output->info() : nullptr }))
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(input->info()->data_type() != DataType::F32, "Padding-less execution is only supported for F32");
+        _padding_less = true;
+
+        // Activations expressible with the vla primitive set run vector-length-agnostic: the
+        // window step is the runtime vector length and the predicated loop covers the whole
+        // row, so the same code path serves 128-bit NEON and SVE with no scalar tail
+        static std::map<ActivationFunction, ActivationFunctionExecutorPtr> act_map_vla_f32 =
+        {
+            { ActivationFunction::ABS, &NEActivationLayerKernel::activation_vla_f32<ActivationFunction::ABS> },
+            { ActivationFunction::LINEAR, &NEActivationLayerKernel::activation_vla_f32<ActivationFunction::LINEAR> },
+            { ActivationFunction::RELU, &NEActivationLayerKernel::activation_vla_f32<ActivationFunction::RELU> },
+            { ActivationFunction::BOUNDED_RELU, &NEActivationLayerKernel::activation_vla_f32<ActivationFunction::BOUNDED_RELU> },
+            { ActivationFunction::LU_BOUNDED_RELU, &NEActivationLayerKernel::activation_vla_f32<ActivationFunction::LU_BOUNDED_RELU> },
+            { ActivationFunction::LEAKY_RELU, &NEActivationLayerKernel::activation_vla_f32<ActivationFunction::LEAKY_RELU> },
+        };
+
+        if(act_map_vla_f32.find(activation_info.activation()) != act_map_vla_f32.end())
+        {
+            _func = act_map_vla_f32[activation_info.activation()];
+
+            const unsigned int lanes = vla::num_lanes<float>();
+
+            Window win = calculate_max_window(*input->info(), Steps(lanes));
+            win.set(Window::DimX, Window::Dimension(0, input->info()->dimension(0), lanes));
+            if(output != nullptr)
+            {
+                output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+            }
+            INEKernel::configure(win);
+            return;
+        }
+
+        Window win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration));
+        win.set(Window::DimX, Window::Dimension(0, (input->info()->dimension(0) / num_elems_processed_per_iteration) * num_elems_processed_per_iteration, num_elems_processed_per_iteration));
+        if(output != nullptr)
+        {
+            output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+        }
+        INEKernel::configure(win);
+        return;
+    }
+
     // Configure kernel window
     Window win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration));
 
@@ -172,6 +298,13 @@ void NEActivationLayerKernel::configure(ITensor *input, ITensor *output, Activat
     }
 
     ICPPKernel::configure(win);
+    // Contiguous tensors stream element by element: fold the flat dimensions into one loop at
+    // the first dispatch, once the tensors' padding is final. The zero mask summarizes each
+    // row separately, so keep the row structure when producing it
+    if(zero_mask == nullptr)
+    {
+        collapse_window_when_contiguous({ input->info(), (output != nullptr) ? output->info() : input->info() });
+    }
 }
 
 #ifdef ARM_COMPUTE_ENABLE_FP16
@@ -522,6 +655,49 @@ typename std::enable_if<std::is_same<T, int8_t>::value, void>::type NEActivation
     input, output);
 }
 
+template <ActivationLayerInfo::ActivationFunction F, typename T>
+typename std::enable_if<std::is_same<T, uint8_t>::value, void>::type NEActivationLayerKernel::activation(const Window &window)
+{
+    Iterator input(_input, window);
+    Iterator output(_output, window);
+
+    const QuantizationInfo quant_info = _input->info()->quantization_info();
+
+    // The real value 0 maps to the quantization offset, and the clipping bounds are quantized
+    // with the input's scale/offset so the activation works directly on the uint8 values
+    const uint8x16_t CONST_0 = vdupq_n_u8(static_cast<uint8_t>(quant_info.offset));
+    const uint8x16_t a       = vdupq_n_u8(quant_info.quantize(_act_info.a()));
+    const uint8x16_t b       = vdupq_n_u8(quant_info.quantize(_act_info.b()));
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto input_ptr  = reinterpret_cast<const uint8_t *>(input.ptr());
+        const auto output_ptr = reinterpret_cast<uint8_t *>(output.ptr());
+
+        const uint8x16_t in  = vld1q_u8(input_ptr);
+        uint8x16_t       tmp = {};
+
+        switch(F)
+        {
+            case ActivationFunction::RELU:
+                tmp = vmaxq_u8(CONST_0, in);
+                break;
+            case ActivationFunction::BOUNDED_RELU:
+                tmp = vminq_u8(a, vmaxq_u8(CONST_0, in));
+                break;
+            case ActivationFunction::LU_BOUNDED_RELU:
+                tmp = vminq_u8(a, vmaxq_u8(b, in));
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Activation function not supported for QASYMM8");
+                break;
+        }
+
+        vst1q_u8(output_ptr, tmp);
+    },
+    input, output);
+}
+
 template <ActivationLayerInfo::ActivationFunction F, typename T>
 typename std::enable_if<std::is_same<T, qint16_t>::value, void>::type NEActivationLayerKernel::activation(const Window &window)
 {
@@ -661,4 +837,207 @@ void NEActivationLayerKernel::run(const Window &window, const ThreadInfo &info)
     ARM_COMPUTE_ERROR_ON(_func == nullptr);
 
     (this->*_func)(window);
+
+    // Padding-less mode: the configured window stops at the last aligned column, finish the row
+    // with a scalar tail
+    if(_padding_less)
+    {
+        const unsigned int width = _input->info()->dimension(0);
+        if(window.x().end() < static_cast<int>(width))
+        {
+            Window tail(window);
+            tail.set(Window::DimX, Window::Dimension(window.x().end(), width, 1));
+            activation_scalar_f32(tail);
+        }
+    }
+
+    // Summarize the rows just written while they are still cache-hot
+    if(_zero_mask != nullptr)
+    {
+        compute_zero_mask(window);
+    }
+}
+
+void NEActivationLayerKernel::activation_lut(const Window &window)
+{
+    const unsigned int step = IKernel::window().x().step();
+
+    Iterator input(_input, window);
+    Iterator output(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        ARM_COMPUTE_UNUSED(id);
+        const uint8_t *input_ptr  = input.ptr();
+        uint8_t       *output_ptr = output.ptr();
+
+        for(unsigned int i = 0; i < step; ++i)
+        {
+            *output_ptr++ = _lut[*input_ptr++];
+        }
+    },
+    input, output);
+}
+
+void NEActivationLayerKernel::compute_zero_mask(const Window &window)
+{
+    constexpr unsigned int segment_size = zero_mask_segment_size;
+    const unsigned int     width        = _input->info()->dimension(0);
+
+    // Iterate one whole row at a time: the scheduler splits the window along Y or higher,
+    // so each mask row is written by exactly one thread
+    Window win_rows(window);
+    win_rows.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator out(_output, win_rows);
+    Iterator mask(_zero_mask, win_rows);
+
+    execute_window_loop(win_rows, [&](const Coordinates & id)
+    {
+        ARM_COMPUTE_UNUSED(id);
+        const auto *row      = reinterpret_cast<const float *>(out.ptr());
+        auto       *mask_row = mask.ptr();
+
+        unsigned int x   = 0;
+        unsigned int seg = 0;
+
+        for(; x + segment_size <= width; x += segment_size, ++seg)
+        {
+            // Any set bit means a non-zero value: -0.f is conservatively reported as non-zero
+            uint32x4_t acc = vorrq_u32(vreinterpretq_u32_f32(vld1q_f32(row + x)),
+                                       vreinterpretq_u32_f32(vld1q_f32(row + x + 4)));
+            acc = vorrq_u32(acc, vreinterpretq_u32_f32(vld1q_f32(row + x + 8)));
+            acc = vorrq_u32(acc, vreinterpretq_u32_f32(vld1q_f32(row + x + 12)));
+
+            uint32x2_t acc2 = vorr_u32(vget_low_u32(acc), vget_high_u32(acc));
+            acc2            = vpmax_u32(acc2, acc2);
+
+            mask_row[seg] = (vget_lane_u32(acc2, 0) != 0) ? 1 : 0;
+        }
+
+        if(x < width)
+        {
+            uint8_t acc = 0;
+
+            for(; x < width; ++x)
+            {
+                acc |= (row[x] != 0.f) ? 1 : 0;
+            }
+
+            mask_row[seg] = acc;
+        }
+    },
+    out, mask);
+}
+
+template <ActivationLayerInfo::ActivationFunction F>
+void NEActivationLayerKernel::activation_vla_f32(const Window &window)
+{
+    Iterator input(_input, window);
+    Iterator output(_output, window);
+
+    const unsigned int lanes   = vla::num_lanes<float>();
+    const unsigned int row_end = window.x().end();
+    const float        a       = _act_info.a();
+    const float        b       = _act_info.b();
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto input_ptr  = reinterpret_cast<const float *>(input.ptr());
+        const auto output_ptr = reinterpret_cast<float *>(output.ptr());
+
+        // The predicate masks off the lanes past the end of the row on the final iteration
+        const unsigned int x  = id.x();
+        const vla::pred    pg = vla::active_lanes_f32(0, std::min(lanes, row_end - x));
+
+        vla::vec_f32 in  = vla::vload(pg, input_ptr);
+        vla::vec_f32 tmp = in;
+
+        switch(F)
+        {
+            case ActivationFunction::ABS:
+                tmp = vla::vabs(pg, in);
+                break;
+            case ActivationFunction::LINEAR:
+                tmp = vla::vmla(pg, vla::vdup(pg, b), vla::vdup(pg, a), in);
+                break;
+            case ActivationFunction::RELU:
+                tmp = vla::vmax(pg, vla::vdup(pg, 0.f), in);
+                break;
+            case ActivationFunction::BOUNDED_RELU:
+                tmp = vla::vmin(pg, vla::vdup(pg, a), vla::vmax(pg, vla::vdup(pg, 0.f), in));
+                break;
+            case ActivationFunction::LU_BOUNDED_RELU:
+                tmp = vla::vmin(pg, vla::vdup(pg, a), vla::vmax(pg, vla::vdup(pg, b), in));
+                break;
+            case ActivationFunction::LEAKY_RELU:
+                // max(x, 0) + a * min(x, 0)
+                tmp = vla::vmla(pg, vla::vmax(pg, vla::vdup(pg, 0.f), in), vla::vdup(pg, a), vla::vmin(pg, vla::vdup(pg, 0.f), in));
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Not implemented");
+                break;
+        }
+
+        vla::vstore(pg, output_ptr, tmp);
+    },
+    input, output);
+}
+
+void NEActivationLayerKernel::activation_scalar_f32(const Window &window)
+{
+    Iterator input(_input, window);
+    Iterator output(_output, window);
+
+    const float a = _act_info.a();
+    const float b = _act_info.b();
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const float in  = *reinterpret_cast<const float *>(input.ptr());
+        float       out = 0.f;
+
+        switch(_act_info.activation())
+        {
+            case ActivationFunction::ABS:
+                out = std::abs(in);
+                break;
+            case ActivationFunction::LINEAR:
+                out = a * in + b;
+                break;
+            case ActivationFunction::LOGISTIC:
+                out = 1.f / (1.f + std::exp(-in));
+                break;
+            case ActivationFunction::RELU:
+                out = std::max(0.f, in);
+                break;
+            case ActivationFunction::BOUNDED_RELU:
+                out = std::min(a, std::max(0.f, in));
+                break;
+            case ActivationFunction::LU_BOUNDED_RELU:
+                out = std::min(a, std::max(b, in));
+                break;
+            case ActivationFunction::LEAKY_RELU:
+                out = (in > 0.f) ? in : a * in;
+                break;
+            case ActivationFunction::SOFT_RELU:
+                out = std::log(1.f + std::exp(in));
+                break;
+            case ActivationFunction::SQRT:
+                out = std::sqrt(in);
+                break;
+            case ActivationFunction::SQUARE:
+                out = in * in;
+                break;
+            case ActivationFunction::TANH:
+                out = a * std::tanh(b * in);
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Activation function not supported.");
+                break;
+        }
+
+        *reinterpret_cast<float *>(output.ptr()) = out;
+    },
+    input, output);
 }
@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEArgMaxKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEFixedPoint.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+#include <cfloat>
+#include <limits>
+
+using namespace arm_compute;
+
+namespace
+{
+void arg_max_u8(const ITensor *in, ITensor *out, const Window &window)
+{
+    const int width = in->info()->valid_region().shape.x();
+
+    Window in_slice = window.first_slice_window_1D();
+
+    Window window_out(window);
+    window_out.set(Window::DimX, Window::Dimension(0, 0, 0));
+    Window out_slice = window_out.first_slice_window_1D();
+
+    do
+    {
+        Iterator input(in, in_slice);
+        Iterator output(out, out_slice);
+
+        const auto in_ptr = reinterpret_cast<const uint8_t *>(input.ptr());
+
+        // Reduce the row to its maximum value first
+        uint8x16_t vec_max = vdupq_n_u8(0);
+
+        int x = 0;
+        for(; x <= width - 16; x += 16)
+        {
+            vec_max = vmaxq_u8(vec_max, vld1q_u8(in_ptr + x));
+        }
+
+        uint8x8_t carry_max = vpmax_u8(vget_high_u8(vec_max), vget_low_u8(vec_max));
+        carry_max           = vpmax_u8(carry_max, carry_max);
+        carry_max           = vpmax_u8(carry_max, carry_max);
+        carry_max           = vpmax_u8(carry_max, carry_max);
+
+        uint8_t max_val = vget_lane_u8(carry_max, 0);
+        for(; x < width; ++x)
+        {
+            max_val = std::max(max_val, in_ptr[x]);
+        }
+
+        // Then scan for its first occurrence
+        uint32_t index = 0;
+        while(in_ptr[index] != max_val)
+        {
+            ++index;
+        }
+
+        *(reinterpret_cast<uint32_t *>(output.ptr())) = index;
+    }
+    while(window.slide_window_slice_1D(in_slice) && window.slide_window_slice_1D(out_slice));
+}
+
+void arg_max_qs8(const ITensor *in, ITensor *out, const Window &window)
+{
+    const int width = in->info()->valid_region().shape.x();
+
+    Window in_slice = window.first_slice_window_1D();
+
+    Window window_out(window);
+    window_out.set(Window::DimX, Window::Dimension(0, 0, 0));
+    Window out_slice = window_out.first_slice_window_1D();
+
+    do
+    {
+        Iterator input(in, in_slice);
+        Iterator output(out, out_slice);
+
+        const auto in_ptr = reinterpret_cast<const qint8_t *>(input.ptr());
+
+        qint8x16_t vec_max = vdupq_n_s8(std::numeric_limits<qint8_t>::lowest());
+
+        int x = 0;
+        for(; x <= width - 16; x += 16)
+        {
+            vec_max = vmaxq_qs8(vec_max, vld1q_qs8(in_ptr + x));
+        }
+
+        qint8x8_t carry_max = vpmax_qs8(vget_high_s8(vec_max), vget_low_s8(vec_max));
+        carry_max           = vpmax_qs8(carry_max, carry_max);
+        carry_max           = vpmax_qs8(carry_max, carry_max);
+        carry_max           = vpmax_qs8(carry_max, carry_max);
+
+        qint8_t max_val = vget_lane_s8(carry_max, 0);
+        for(; x < width; ++x)
+        {
+            max_val = std::max(max_val, in_ptr[x]);
+        }
+
+        uint32_t index = 0;
+        while(in_ptr[index] != max_val)
+        {
+            ++index;
+        }
+
+        *(reinterpret_cast<uint32_t *>(output.ptr())) = index;
+    }
+    while(window.slide_window_slice_1D(in_slice) && window.slide_window_slice_1D(out_slice));
+}
+
+void arg_max_qs16(const ITensor *in, ITensor *out, const Window &window)
+{
+    const int width = in->info()->valid_region().shape.x();
+
+    Window in_slice = window.first_slice_window_1D();
+
+    Window window_out(window);
+    window_out.set(Window::DimX, Window::Dimension(0, 0, 0));
+    Window out_slice = window_out.first_slice_window_1D();
+
+    do
+    {
+        Iterator input(in, in_slice);
+        Iterator output(out, out_slice);
+
+        const auto in_ptr = reinterpret_cast<const qint16_t *>(input.ptr());
+
+        qint16x8_t vec_max = vdupq_n_qs16(std::numeric_limits<qint16_t>::lowest());
+
+        int x = 0;
+        for(; x <= width - 8; x += 8)
+        {
+            vec_max = vmaxq_qs16(vec_max, vld1q_qs16(in_ptr + x));
+        }
+
+        qint16x4_t carry_max = vpmax_qs16(vget_high_qs16(vec_max), vget_low_qs16(vec_max));
+        carry_max            = vpmax_qs16(carry_max, carry_max);
+        carry_max            = vpmax_qs16(carry_max, carry_max);
+
+        qint16_t max_val = vget_lane_s16(carry_max, 0);
+        for(; x < width; ++x)
+        {
+            max_val = std::max(max_val, in_ptr[x]);
+        }
+
+        uint32_t index = 0;
+        while(in_ptr[index] != max_val)
+        {
+            ++index;
+        }
+
+        *(reinterpret_cast<uint32_t *>(output.ptr())) = index;
+    }
+    while(window.slide_window_slice_1D(in_slice) && window.slide_window_slice_1D(out_slice));
+}
+
+void arg_max_f32(const ITensor *in, ITensor *out, const Window &window)
+{
+    const int width = in->info()->valid_region().shape.x();
+
+    Window in_slice = window.first_slice_window_1D();
+
+    Window window_out(window);
+    window_out.set(Window::DimX, Window::Dimension(0, 0, 0));
+    Window out_slice = window_out.first_slice_window_1D();
+
+    do
+    {
+        Iterator input(in, in_slice);
+        Iterator output(out, out_slice);
+
+        const auto in_ptr = reinterpret_cast<const float *>(input.ptr());
+
+        float32x4_t vec_max = vdupq_n_f32(-FLT_MAX);
+
+        int x = 0;
+        for(; x <= width - 4; x += 4)
+        {
+            vec_max = vmaxq_f32(vec_max, vld1q_f32(in_ptr + x));
+        }
+
+        float32x2_t carry_max = vpmax_f32(vget_high_f32(vec_max), vget_low_f32(vec_max));
+        carry_max             = vpmax_f32(carry_max, carry_max);
+
+        float max_val = vget_lane_f32(carry_max, 0);
+        for(; x < width; ++x)
+        {
+            max_val = std::max(max_val, in_ptr[x]);
+        }
+
+        uint32_t index = 0;
+        while(in_ptr[index] != max_val)
+        {
+            ++index;
+        }
+
+        *(reinterpret_cast<uint32_t *>(output.ptr())) = index;
+    }
+    while(window.slide_window_slice_1D(in_slice) && window.slide_window_slice_1D(out_slice));
+}
+} // namespace
+
+NEArgMaxKernel::NEArgMaxKernel()
+    : _func(nullptr), _input(nullptr), _output(nullptr)
+{
+}
+
+void NEArgMaxKernel::configure(const ITensor *input, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QS8, DataType::QASYMM8, DataType::QS16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(output);
+
+    // Output auto initialization if not yet initialized
+    TensorShape output_shape = input->info()->tensor_shape();
+    output_shape.set(0, 1);
+    auto_init_if_empty(*output->info(), output_shape, 1, DataType::U32, input->info()->fixed_point_position());
+
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DIMENSIONS(output->info()->tensor_shape(), output_shape);
+
+    switch(input->info()->data_type())
+    {
+        case DataType::QASYMM8:
+            _func = &arg_max_u8;
+            break;
+        case DataType::QS8:
+            _func = &arg_max_qs8;
+            break;
+        case DataType::QS16:
+            _func = &arg_max_qs16;
+            break;
+        case DataType::F32:
+            _func = &arg_max_f32;
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported data type.");
+            break;
+    }
+
+    _input  = input;
+    _output = output;
+
+    // Configure kernel window. Each iteration processes a full row, the leftover
+    // elements are handled with scalar loops so no input border is required
+    const unsigned int num_elems_processed_per_iteration = input->info()->valid_region().shape.x();
+
+    Window                 win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration));
+    AccessWindowHorizontal input_access(input->info(), 0, num_elems_processed_per_iteration);
+    AccessWindowHorizontal output_access(output->info(), 0, 1);
+
+    update_window_and_padding(win, input_access, output_access);
+
+    output_access.set_valid_region(win, ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEArgMaxKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (*_func)(_input, _output, window);
+}
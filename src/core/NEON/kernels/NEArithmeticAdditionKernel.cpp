@@ -457,6 +457,9 @@ void NEArithmeticAdditionKernel::configure(const ITensor *input1, const ITensor
     output_access.set_valid_region(win, valid_region);
 
     INEKernel::configure(win);
+    // Contiguous tensors stream element by element: fold the flat dimensions into one loop at
+    // the first dispatch, once the tensors' padding is final
+    collapse_window_when_contiguous({ input1->info(), input2->info(), output->info() });
 }
 
 void NEArithmeticAdditionKernel::run(const Window &window, const ThreadInfo &info)
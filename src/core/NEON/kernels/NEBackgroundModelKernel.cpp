@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEBackgroundModelKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/IAccessWindow.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+
+#include <arm_neon.h>
+#include <cstdint>
+
+using namespace arm_compute;
+
+namespace arm_compute
+{
+class Coordinates;
+} // namespace arm_compute
+
+namespace
+{
+/** Update one quarter (4 pixels) of a 16 pixel block and return the foreground lane mask */
+inline uint32x4_t update_model_f32(float32x4_t frame, float *mean_ptr, float *var_ptr, float32x4_t alpha, float32x4_t threshold2)
+{
+    const float32x4_t mean = vld1q_f32(mean_ptr);
+    const float32x4_t var  = vld1q_f32(var_ptr);
+
+    const float32x4_t diff  = vsubq_f32(frame, mean);
+    const float32x4_t diff2 = vmulq_f32(diff, diff);
+
+    /* Flag the pixel before folding it into the model, so a foreground pixel is judged
+     * against the background it deviates from */
+    const uint32x4_t foreground = vcgtq_f32(diff2, vmulq_f32(var, threshold2));
+
+    vst1q_f32(mean_ptr, vmlaq_f32(mean, diff, alpha));
+    vst1q_f32(var_ptr, vmlaq_f32(var, vsubq_f32(diff2, var), alpha));
+
+    return foreground;
+}
+} // namespace
+
+NEBackgroundModelKernel::NEBackgroundModelKernel()
+    : _frame(nullptr), _mean(nullptr), _variance(nullptr), _mask(nullptr), _alpha(0.0f), _threshold(0.0f)
+{
+}
+
+void NEBackgroundModelKernel::configure(const ITensor *frame, ITensor *mean, ITensor *variance, ITensor *mask, float alpha, float threshold)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(frame, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(mean, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(variance, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(mask, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON(alpha < 0.0f || alpha > 1.0f);
+    ARM_COMPUTE_ERROR_ON(threshold < 0.0f);
+
+    _frame     = frame;
+    _mean      = mean;
+    _variance  = variance;
+    _mask      = mask;
+    _alpha     = alpha;
+    _threshold = threshold;
+
+    constexpr unsigned int num_elems_processed_per_iteration = 16;
+
+    // Configure kernel window
+    Window                 win = calculate_max_window(*frame->info(), Steps(num_elems_processed_per_iteration));
+    AccessWindowHorizontal mean_access(mean->info(), 0, num_elems_processed_per_iteration);
+    AccessWindowHorizontal variance_access(variance->info(), 0, num_elems_processed_per_iteration);
+    AccessWindowHorizontal mask_access(mask->info(), 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win,
+                              AccessWindowHorizontal(frame->info(), 0, num_elems_processed_per_iteration),
+                              mean_access,
+                              variance_access,
+                              mask_access);
+
+    mask_access.set_valid_region(win, frame->info()->valid_region());
+
+    INEKernel::configure(win);
+}
+
+void NEBackgroundModelKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    Iterator frame(_frame, window);
+    Iterator mean(_mean, window);
+    Iterator variance(_variance, window);
+    Iterator mask(_mask, window);
+
+    const float32x4_t alpha      = vdupq_n_f32(_alpha);
+    const float32x4_t threshold2 = vdupq_n_f32(_threshold * _threshold);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const uint8x16_t in       = vld1q_u8(frame.ptr());
+        const auto       mean_ptr = reinterpret_cast<float *>(mean.ptr());
+        const auto       var_ptr  = reinterpret_cast<float *>(variance.ptr());
+
+        const uint16x8_t in_low  = vmovl_u8(vget_low_u8(in));
+        const uint16x8_t in_high = vmovl_u8(vget_high_u8(in));
+
+        const uint32x4_t fg0 = update_model_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(in_low))), mean_ptr + 0, var_ptr + 0, alpha, threshold2);
+        const uint32x4_t fg1 = update_model_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(in_low))), mean_ptr + 4, var_ptr + 4, alpha, threshold2);
+        const uint32x4_t fg2 = update_model_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(in_high))), mean_ptr + 8, var_ptr + 8, alpha, threshold2);
+        const uint32x4_t fg3 = update_model_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(in_high))), mean_ptr + 12, var_ptr + 12, alpha, threshold2);
+
+        /* Narrow the all-ones foreground lanes down to a 255/0 U8 mask */
+        const uint16x8_t fg_low  = vcombine_u16(vmovn_u32(fg0), vmovn_u32(fg1));
+        const uint16x8_t fg_high = vcombine_u16(vmovn_u32(fg2), vmovn_u32(fg3));
+
+        vst1q_u8(mask.ptr(), vcombine_u8(vmovn_u16(fg_low), vmovn_u16(fg_high)));
+    },
+    frame, mean, variance, mask);
+}
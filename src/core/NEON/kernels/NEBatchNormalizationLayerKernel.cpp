@@ -31,10 +31,12 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
 
+#include <cmath>
+
 using namespace arm_compute;
 
 NEBatchNormalizationLayerKernel::NEBatchNormalizationLayerKernel()
-    : _func(nullptr), _input(nullptr), _output(nullptr), _mean(nullptr), _var(nullptr), _gamma(nullptr), _beta(nullptr), _epsilon()
+    : _func(nullptr), _folded_func(nullptr), _input(nullptr), _output(nullptr), _mean(nullptr), _var(nullptr), _gamma(nullptr), _beta(nullptr), _scale(nullptr), _shift(nullptr), _epsilon()
 {
 }
 
@@ -169,6 +171,35 @@ void batch_normalization_fp32(ITensor *in, ITensor *out, const ITensor *mean, co
     input, output);
 }
 
+void batch_normalization_folded_fp32(ITensor *in, ITensor *out, const ITensor *scale, const ITensor *shift, const Window &window)
+{
+    Iterator input(in, window);
+    Iterator output(out, window);
+
+    // Hold information about the current feature map we are iterating.
+    // Only broadcast the folded parameters once per feature map.
+    int slice = -1;
+
+    const auto input_scale = reinterpret_cast<const float *>(scale->ptr_to_element(Coordinates(0, 0)));
+    const auto input_shift = reinterpret_cast<const float *>(shift->ptr_to_element(Coordinates(0, 0)));
+
+    float32x4_t scale_vec = vdupq_n_f32(0.0);
+    float32x4_t shift_vec = vdupq_n_f32(0.0);
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        if(slice != id.z())
+        {
+            scale_vec = vdupq_n_f32(*(input_scale + id.z()));
+            shift_vec = vdupq_n_f32(*(input_shift + id.z()));
+            slice     = id.z();
+        }
+
+        // Apply the affine transform with a single fused multiply-add
+        vst1q_f32(reinterpret_cast<float *>(output.ptr()), vmlaq_f32(shift_vec, vld1q_f32(reinterpret_cast<const float *>(input.ptr())), scale_vec));
+    },
+    input, output);
+}
+
 #ifdef ARM_COMPUTE_ENABLE_FP16
 void batch_normalization_fp16(ITensor *in, ITensor *out, const ITensor *mean, const ITensor *var, const ITensor *beta, const ITensor *gamma, float epsilon, const Window &window)
 {
@@ -283,12 +314,119 @@ void NEBatchNormalizationLayerKernel::configure(ITensor *input, ITensor *output,
     INEKernel::configure(win);
 }
 
+void NEBatchNormalizationLayerKernel::configure(ITensor *input, ITensor *output, const ITensor *scale, const ITensor *shift)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(scale, shift);
+
+    _input       = input;
+    _output      = input;
+    _scale       = scale;
+    _shift       = shift;
+    _folded_func = &batch_normalization_folded_fp32;
+
+    if(output != nullptr)
+    {
+        // Output tensor auto initialization if not yet initialized
+        auto_init_if_empty(*output->info(), input->info()->tensor_shape(), 1, input->info()->data_type(), input->info()->fixed_point_position());
+
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, output);
+
+        _output = output;
+    }
+
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output, scale, shift);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(scale, shift);
+    ARM_COMPUTE_ERROR_ON(input->info()->dimension(2) != scale->info()->dimension(0));
+
+    constexpr unsigned int num_elems_processed_per_iteration = 4;
+
+    Window                 win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration));
+    AccessWindowHorizontal input_access(input->info(), 0, num_elems_processed_per_iteration);
+    if(output != nullptr)
+    {
+        AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+        update_window_and_padding(win, input_access, output_access);
+        output_access.set_valid_region(win, input->info()->valid_region());
+    }
+    else
+    {
+        update_window_and_padding(win, input_access);
+    }
+    INEKernel::configure(win);
+}
+
 void NEBatchNormalizationLayerKernel::run(const Window &window, const ThreadInfo &info)
 {
     ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
-    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr && _folded_func == nullptr);
+
+    if(_folded_func != nullptr)
+    {
+        (*_folded_func)(_input, _output, _scale, _shift, window);
+    }
+    else
+    {
+        (*_func)(_input, _output, _mean, _var, _beta, _gamma, _epsilon, window);
+    }
+}
+
+NEBatchNormalizationFoldKernel::NEBatchNormalizationFoldKernel()
+    : _mean(nullptr), _var(nullptr), _beta(nullptr), _gamma(nullptr), _scale(nullptr), _shift(nullptr), _epsilon()
+{
+}
+
+void NEBatchNormalizationFoldKernel::configure(const ITensor *mean, const ITensor *var, const ITensor *beta, const ITensor *gamma, float epsilon, ITensor *scale, ITensor *shift)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(mean, var, beta, gamma, scale, shift);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(mean, 1, DataType::F32);
+
+    // Output tensor auto initialization if not yet initialized
+    auto_init_if_empty(*scale->info(), mean->info()->tensor_shape(), 1, mean->info()->data_type(), mean->info()->fixed_point_position());
+    auto_init_if_empty(*shift->info(), mean->info()->tensor_shape(), 1, mean->info()->data_type(), mean->info()->fixed_point_position());
+
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(mean, var, beta, gamma, scale, shift);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(mean, var, beta, gamma, scale, shift);
+
+    _mean    = mean;
+    _var     = var;
+    _beta    = beta;
+    _gamma   = gamma;
+    _scale   = scale;
+    _shift   = shift;
+    _epsilon = epsilon;
+
+    // Configure kernel window. The kernel reads and writes single elements, no padding is needed
+    Window win = calculate_max_window(*mean->info());
+
+    scale->info()->set_valid_region(ValidRegion(Coordinates(), scale->info()->tensor_shape()));
+    shift->info()->set_valid_region(ValidRegion(Coordinates(), shift->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEBatchNormalizationFoldKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
 
-    (*_func)(_input, _output, _mean, _var, _beta, _gamma, _epsilon, window);
+    Iterator mean(_mean, window);
+    Iterator var(_var, window);
+    Iterator beta(_beta, window);
+    Iterator gamma(_gamma, window);
+    Iterator scale(_scale, window);
+    Iterator shift(_shift, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        ARM_COMPUTE_UNUSED(id);
+        const float scale_val = *reinterpret_cast<const float *>(gamma.ptr()) / std::sqrt(*reinterpret_cast<const float *>(var.ptr()) + _epsilon);
+
+        *reinterpret_cast<float *>(scale.ptr()) = scale_val;
+        *reinterpret_cast<float *>(shift.ptr()) = *reinterpret_cast<const float *>(beta.ptr()) - *reinterpret_cast<const float *>(mean.ptr()) * scale_val;
+    },
+    mean, var, beta, gamma, scale, shift);
 }
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NECameraIngestKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/IMultiImage.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/MultiImageInfo.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+
+using namespace arm_compute;
+
+namespace
+{
+// BT.709 conversion coefficients, as used by NEColorConvertHelper.inl
+constexpr float red_coef_bt709    = 1.5748f;
+constexpr float green_coef_bt709  = -0.1873f;
+constexpr float green_coef2_bt709 = -0.4681f;
+constexpr float blue_coef_bt709   = 1.8556f;
+
+inline void convert_uint8x16_to_float32x4x4(const uint8x16_t &in, float32x4x4_t &out)
+{
+    const auto tmp1 = vmovl_u8(vget_low_u8(in));
+    out.val[0]      = vcvtq_f32_u32(vmovl_u16(vget_low_u16(tmp1)));
+    out.val[1]      = vcvtq_f32_u32(vmovl_u16(vget_high_u16(tmp1)));
+    const auto tmp2 = vmovl_u8(vget_high_u8(in));
+    out.val[2]      = vcvtq_f32_u32(vmovl_u16(vget_low_u16(tmp2)));
+    out.val[3]      = vcvtq_f32_u32(vmovl_u16(vget_high_u16(tmp2)));
+}
+
+/** Converts 4 even and 4 odd luma samples which share 4 chroma samples to float RGB */
+inline void yuv_to_rgb_f32(const float32x4_t &yvec, const float32x4_t &yyvec, float32x4_t uvec, float32x4_t vvec,
+                           float32x4x3_t &rgb_even, float32x4x3_t &rgb_odd)
+{
+    // Compute: cb - 128 and cr - 128;
+    const auto c128 = vdupq_n_f32(128.f);
+    uvec            = vsubq_f32(uvec, c128);
+    vvec            = vsubq_f32(vvec, c128);
+
+    const auto red   = vmulq_n_f32(vvec, red_coef_bt709);
+    const auto blue  = vmulq_n_f32(uvec, blue_coef_bt709);
+    const auto green = vaddq_f32(vmulq_n_f32(uvec, green_coef_bt709),
+                                 vmulq_n_f32(vvec, green_coef2_bt709));
+
+    rgb_even.val[0] = vaddq_f32(yvec, red);
+    rgb_even.val[1] = vaddq_f32(yvec, green);
+    rgb_even.val[2] = vaddq_f32(yvec, blue);
+
+    rgb_odd.val[0] = vaddq_f32(yyvec, red);
+    rgb_odd.val[1] = vaddq_f32(yyvec, green);
+    rgb_odd.val[2] = vaddq_f32(yyvec, blue);
+}
+
+/** Re-interleaves the even/odd pixel vectors and stores 8 normalized values of one channel plane */
+inline void store_normalized_plane(float *ptr, const float32x4_t &even, const float32x4_t &odd, float scale, float offset)
+{
+    const float32x4x2_t pixels     = vzipq_f32(even, odd);
+    const float32x4_t   offset_vec = vdupq_n_f32(offset);
+    const float32x4_t   zero       = vdupq_n_f32(0.f);
+    const float32x4_t   c255       = vdupq_n_f32(255.f);
+
+    // Clamp to the 0..255 range like the saturating narrow of the U8 conversion path
+    const float32x4_t low  = vminq_f32(vmaxq_f32(pixels.val[0], zero), c255);
+    const float32x4_t high = vminq_f32(vmaxq_f32(pixels.val[1], zero), c255);
+
+    vst1q_f32(ptr + 0, vmlaq_n_f32(offset_vec, low, scale));
+    vst1q_f32(ptr + 4, vmlaq_n_f32(offset_vec, high, scale));
+}
+} // namespace
+
+NECameraIngestKernel::NECameraIngestKernel()
+    : _input(nullptr), _output(nullptr), _func(nullptr), _uv(true), _scale(), _offset()
+{
+}
+
+void NECameraIngestKernel::configure(const IMultiImage *input, ITensor *output, const float *mean, const float *std)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_ON(input->info()->format() != Format::NV12 && input->info()->format() != Format::NV21);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(2) != 3);
+    ARM_COMPUTE_ERROR_ON((mean == nullptr) != (std == nullptr));
+
+    _input  = input;
+    _output = output;
+    _uv     = input->info()->format() == Format::NV12;
+
+    // Fold the normalization into one fused multiply-add per channel:
+    // (value / 255 - mean) / std == value * (1 / (255 * std)) - mean / std
+    for(unsigned int c = 0; c < 3; ++c)
+    {
+        _scale[c]  = (std != nullptr) ? 1.f / (255.f * std[c]) : 1.f;
+        _offset[c] = (mean != nullptr) ? -mean[c] / std[c] : 0.f;
+    }
+
+    const bool is_resized = (output->info()->dimension(0) != input->plane(0)->info()->dimension(0))
+                            || (output->info()->dimension(1) != input->plane(0)->info()->dimension(1));
+
+    if(is_resized)
+    {
+        _func = &NECameraIngestKernel::ingest_resize;
+
+        // Configure kernel window. The kernel gathers single source pixels, no padding is needed
+        Window win = calculate_max_window(*output->info());
+        win.set(Window::DimZ, Window::Dimension(0, 1, 1));
+
+        output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+        INEKernel::configure(win);
+    }
+    else
+    {
+        _func = &NECameraIngestKernel::ingest_direct;
+
+        constexpr unsigned int num_elems_processed_per_iteration = 32;
+
+        // Configure kernel window. All three channel planes are written in the same iteration
+        Window win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
+        win.set_dimension_step(Window::DimY, 2);
+        win.set(Window::DimZ, Window::Dimension(0, 1, 1));
+
+        AccessWindowHorizontal input0_access(input->plane(0)->info(), 0, num_elems_processed_per_iteration);
+        AccessWindowRectangle  input1_access(input->plane(1)->info(), 0, 0, num_elems_processed_per_iteration, 1, 0.5f, 0.5f);
+        AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+
+        update_window_and_padding(win, input0_access, input1_access, output_access);
+
+        output_access.set_valid_region(win, ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+        INEKernel::configure(win);
+    }
+}
+
+void NECameraIngestKernel::ingest_direct(const Window &window)
+{
+    // UV's width and height are subsampled
+    Window win_uv(window);
+    win_uv.set(Window::DimX, Window::Dimension(window.x().start() / 2, window.x().end() / 2, window.x().step() / 2));
+    win_uv.set(Window::DimY, Window::Dimension(window.y().start() / 2, window.y().end() / 2, 1));
+    win_uv.validate();
+
+    const size_t in_y_stride      = _input->plane(0)->info()->strides_in_bytes().y();
+    const size_t out_row_stride   = _output->info()->strides_in_bytes().y();
+    const size_t out_plane_stride = _output->info()->strides_in_bytes().z();
+    const int    shift            = _uv ? 0 : 1;
+
+    Iterator in_y(_input->plane(0), window);
+    Iterator in_uv(_input->plane(1), win_uv);
+    Iterator out(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        ARM_COMPUTE_UNUSED(id);
+        const auto ta_y_top    = vld2q_u8(in_y.ptr());
+        const auto ta_y_bottom = vld2q_u8(in_y.ptr() + in_y_stride);
+        const auto ta_uv       = vld2q_u8(in_uv.ptr());
+        //ta_y.val[0] = Y0 Y2 Y4 Y6 ...
+        //ta_y.val[1] = Y1 Y3 Y5 Y7 ...
+        //ta_uv.val[0] = U0 U2 U4 U6 ...
+        //ta_uv.val[1] = V0 V2 V4 V6 ...
+
+        float32x4x4_t yvec_top, yyvec_top, yvec_bottom, yyvec_bottom, uvec, vvec;
+        convert_uint8x16_to_float32x4x4(ta_y_top.val[0], yvec_top);
+        convert_uint8x16_to_float32x4x4(ta_y_top.val[1], yyvec_top);
+        convert_uint8x16_to_float32x4x4(ta_y_bottom.val[0], yvec_bottom);
+        convert_uint8x16_to_float32x4x4(ta_y_bottom.val[1], yyvec_bottom);
+        convert_uint8x16_to_float32x4x4(ta_uv.val[0 + shift], uvec);
+        convert_uint8x16_to_float32x4x4(ta_uv.val[1 - shift], vvec);
+
+        for(int i = 0; i < 4; ++i)
+        {
+            float32x4x3_t rgb_even_top, rgb_odd_top, rgb_even_bottom, rgb_odd_bottom;
+            yuv_to_rgb_f32(yvec_top.val[i], yyvec_top.val[i], uvec.val[i], vvec.val[i], rgb_even_top, rgb_odd_top);
+            yuv_to_rgb_f32(yvec_bottom.val[i], yyvec_bottom.val[i], uvec.val[i], vvec.val[i], rgb_even_bottom, rgb_odd_bottom);
+
+            for(int c = 0; c < 3; ++c)
+            {
+                store_normalized_plane(reinterpret_cast<float *>(out.ptr() + c * out_plane_stride) + i * 8,
+                                       rgb_even_top.val[c], rgb_odd_top.val[c], _scale[c], _offset[c]);
+                store_normalized_plane(reinterpret_cast<float *>(out.ptr() + c * out_plane_stride + out_row_stride) + i * 8,
+                                       rgb_even_bottom.val[c], rgb_odd_bottom.val[c], _scale[c], _offset[c]);
+            }
+        }
+    },
+    in_y, in_uv, out);
+}
+
+void NECameraIngestKernel::ingest_resize(const Window &window)
+{
+    const ITensor *plane_y  = _input->plane(0);
+    const ITensor *plane_uv = _input->plane(1);
+
+    const int in_w = plane_y->info()->dimension(0);
+    const int in_h = plane_y->info()->dimension(1);
+
+    const float wr = static_cast<float>(in_w) / _output->info()->dimension(0);
+    const float hr = static_cast<float>(in_h) / _output->info()->dimension(1);
+
+    const uint8_t *in_y_ptr     = plane_y->ptr_to_element(Coordinates(0, 0));
+    const uint8_t *in_uv_ptr    = plane_uv->ptr_to_element(Coordinates(0, 0));
+    const size_t   in_y_stride  = plane_y->info()->strides_in_bytes().y();
+    const size_t   in_uv_stride = plane_uv->info()->strides_in_bytes().y();
+
+    const size_t out_plane_stride = _output->info()->strides_in_bytes().z();
+    const int    shift            = _uv ? 0 : 1;
+
+    Iterator out(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        // Map the output pixel centre back into the source frame
+        const float in_x = std::min(std::max((id.x() + 0.5f) * wr - 0.5f, 0.f), in_w - 1.f);
+        const float in_y = std::min(std::max((id.y() + 0.5f) * hr - 0.5f, 0.f), in_h - 1.f);
+
+        const int x0 = static_cast<int>(in_x);
+        const int y0 = static_cast<int>(in_y);
+        const int x1 = std::min(x0 + 1, in_w - 1);
+        const int y1 = std::min(y0 + 1, in_h - 1);
+
+        const float dx = in_x - x0;
+        const float dy = in_y - y0;
+
+        // Bilinear interpolation of the luma plane
+        const float y_tl = in_y_ptr[y0 * in_y_stride + x0];
+        const float y_tr = in_y_ptr[y0 * in_y_stride + x1];
+        const float y_bl = in_y_ptr[y1 * in_y_stride + x0];
+        const float y_br = in_y_ptr[y1 * in_y_stride + x1];
+
+        const float luma = y_tl * (1.f - dx) * (1.f - dy) + y_tr * dx * (1.f - dy)
+                           + y_bl * (1.f - dx) * dy + y_br * dx * dy;
+
+        // Nearest sample of the subsampled chroma plane, matching the chroma duplication
+        // performed by the direct conversion path
+        const uint8_t *uv = in_uv_ptr + (y0 / 2) * in_uv_stride + (x0 / 2) * 2;
+
+        const float cb = uv[0 + shift] - 128.f;
+        const float cr = uv[1 - shift] - 128.f;
+
+        const float r = std::min(std::max(luma + red_coef_bt709 * cr, 0.f), 255.f);
+        const float g = std::min(std::max(luma + green_coef_bt709 * cb + green_coef2_bt709 * cr, 0.f), 255.f);
+        const float b = std::min(std::max(luma + blue_coef_bt709 * cb, 0.f), 255.f);
+
+        auto *out_ptr = reinterpret_cast<float *>(out.ptr());
+
+        *reinterpret_cast<float *>(reinterpret_cast<uint8_t *>(out_ptr) + 0 * out_plane_stride) = r * _scale[0] + _offset[0];
+        *reinterpret_cast<float *>(reinterpret_cast<uint8_t *>(out_ptr) + 1 * out_plane_stride) = g * _scale[1] + _offset[1];
+        *reinterpret_cast<float *>(reinterpret_cast<uint8_t *>(out_ptr) + 2 * out_plane_stride) = b * _scale[2] + _offset[2];
+    },
+    out);
+}
+
+void NECameraIngestKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
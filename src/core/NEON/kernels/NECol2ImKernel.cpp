@@ -30,6 +30,7 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Validate.h"
 
+#include <algorithm>
 #include <arm_neon.h>
 #include <cstddef>
 #include <cstdint>
@@ -62,12 +63,88 @@ void NECol2ImKernel::run_col2im(const Window &window)
     in, out);
 }
 
+void NECol2ImKernel::run_col2im_f32_bias(const Window &window)
+{
+    const int output_stride_x = _output->info()->strides_in_bytes().x();
+    const int output_stride_y = _output->info()->strides_in_bytes().y();
+    const int output_stride_z = _output->info()->strides_in_bytes().z();
+
+    const auto bias = reinterpret_cast<const float *>(_biases->ptr_to_element(Coordinates(0)));
+
+    Window window_out(window);
+    window_out.set(Window::DimX, Window::Dimension(0, 0, 0));
+    window_out.set(Window::DimY, Window::Dimension(0, 0, 0));
+    window_out.set(Window::DimZ, Window::Dimension(0, 0, 0));
+
+    // Create iterators
+    Iterator in(_input, window);
+    Iterator out(_output, window_out);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int hidx = id.y();
+        const int idx  = id.x() * output_stride_z + (hidx / _convolved_dims.first) * output_stride_y + (hidx % _convolved_dims.first) * output_stride_x;
+
+        *(reinterpret_cast<float *>(out.ptr() + idx)) = *(reinterpret_cast<const float *>(in.ptr())) + bias[id.x()];
+    },
+    in, out);
+}
+
+template <ActivationLayerInfo::ActivationFunction F, bool has_bias>
+void NECol2ImKernel::run_col2im_f32_act(const Window &window)
+{
+    const int output_stride_x = _output->info()->strides_in_bytes().x();
+    const int output_stride_y = _output->info()->strides_in_bytes().y();
+    const int output_stride_z = _output->info()->strides_in_bytes().z();
+
+    const float a    = _act_info.a();
+    const float b    = _act_info.b();
+    const auto  bias = has_bias ? reinterpret_cast<const float *>(_biases->ptr_to_element(Coordinates(0))) : nullptr;
+
+    Window window_out(window);
+    window_out.set(Window::DimX, Window::Dimension(0, 0, 0));
+    window_out.set(Window::DimY, Window::Dimension(0, 0, 0));
+    window_out.set(Window::DimZ, Window::Dimension(0, 0, 0));
+
+    // Create iterators
+    Iterator in(_input, window);
+    Iterator out(_output, window_out);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int hidx = id.y();
+        const int idx  = id.x() * output_stride_z + (hidx / _convolved_dims.first) * output_stride_y + (hidx % _convolved_dims.first) * output_stride_x;
+
+        float val = *(reinterpret_cast<const float *>(in.ptr()));
+        if(has_bias)
+        {
+            val += bias[id.x()];
+        }
+        switch(F)
+        {
+            case ActivationLayerInfo::ActivationFunction::RELU:
+                val = std::max(0.f, val);
+                break;
+            case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+                val = std::min(a, std::max(0.f, val));
+                break;
+            case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+                val = std::min(a, std::max(b, val));
+                break;
+            default:
+                break;
+        }
+        *(reinterpret_cast<float *>(out.ptr() + idx)) = val;
+    },
+    in, out);
+}
+
 NECol2ImKernel::NECol2ImKernel()
-    : _func(), _input(nullptr), _output(nullptr), _convolved_dims()
+    : _func(), _input(nullptr), _output(nullptr), _biases(nullptr), _act_info(), _convolved_dims()
 {
 }
 
-void NECol2ImKernel::configure(const ITensor *input, ITensor *output, std::pair<unsigned int, unsigned int> convolved_dims)
+void NECol2ImKernel::configure(const ITensor *input, ITensor *output, std::pair<unsigned int, unsigned int> convolved_dims, const ActivationLayerInfo &act_info, const ITensor *biases)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::S8, DataType::QS8, DataType::U16, DataType::S16, DataType::QS16, DataType::U32, DataType::S32, DataType::F16,
                                                   DataType::F32);
@@ -85,24 +162,61 @@ void NECol2ImKernel::configure(const ITensor *input, ITensor *output, std::pair<
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_FIXED_POINT(input, output);
 
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(input->info()->data_type() != DataType::F32, "Fused bias in col2im is only supported for F32");
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        ARM_COMPUTE_ERROR_ON(biases->info()->num_dimensions() > 1);
+        ARM_COMPUTE_ERROR_ON(biases->info()->dimension(0) != input->info()->dimension(0));
+    }
+
     _input          = input;
     _output         = output;
+    _biases         = biases;
+    _act_info       = act_info;
     _convolved_dims = convolved_dims;
 
-    switch(input->info()->element_size())
+    if(act_info.enabled())
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(input->info()->data_type() != DataType::F32, "Fused activation in col2im is only supported for F32");
+
+        switch(act_info.activation())
+        {
+            case ActivationLayerInfo::ActivationFunction::RELU:
+                _func = (biases != nullptr) ? &NECol2ImKernel::run_col2im_f32_act<ActivationLayerInfo::ActivationFunction::RELU, true> : &NECol2ImKernel::run_col2im_f32_act<ActivationLayerInfo::ActivationFunction::RELU, false>;
+                break;
+            case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+                _func = (biases != nullptr) ? &NECol2ImKernel::run_col2im_f32_act<ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, true> : &NECol2ImKernel::run_col2im_f32_act<ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, false>;
+                break;
+            case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+                _func = (biases != nullptr) ? &NECol2ImKernel::run_col2im_f32_act<ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, true> : &NECol2ImKernel::run_col2im_f32_act<ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, false>;
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Activation function not supported in col2im");
+                break;
+        }
+    }
+    else if(biases != nullptr)
+    {
+        _func = &NECol2ImKernel::run_col2im_f32_bias;
+    }
+    else
     {
-        case 1:
-            _func = &NECol2ImKernel::run_col2im<uint8_t>;
-            break;
-        case 2:
-            _func = &NECol2ImKernel::run_col2im<uint16_t>;
-            break;
-        case 4:
-            _func = &NECol2ImKernel::run_col2im<uint32_t>;
-            break;
-        default:
-            ARM_COMPUTE_ERROR("Element size not supported");
-            break;
+        switch(input->info()->element_size())
+        {
+            case 1:
+                _func = &NECol2ImKernel::run_col2im<uint8_t>;
+                break;
+            case 2:
+                _func = &NECol2ImKernel::run_col2im<uint16_t>;
+                break;
+            case 4:
+                _func = &NECol2ImKernel::run_col2im<uint32_t>;
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Element size not supported");
+                break;
+        }
     }
 
     // Configure kernel window
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEDataLayoutConvertKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <cstdint>
+
+using namespace arm_compute;
+
+namespace
+{
+template <typename T>
+void convert_layout(const ITensor *in, ITensor *out, bool nchw_to_nhwc, const Window &window)
+{
+    Iterator input(in, window);
+
+    // Map the input x/y/z coordinates onto the strides of the permuted output
+    const Strides &out_strides = out->info()->strides_in_bytes();
+    const size_t   stride_x    = nchw_to_nhwc ? out_strides[1] : out_strides[2];
+    const size_t   stride_y    = nchw_to_nhwc ? out_strides[2] : out_strides[0];
+    const size_t   stride_z    = nchw_to_nhwc ? out_strides[0] : out_strides[1];
+    const size_t   stride_w    = out_strides[3];
+
+    uint8_t *const out_base = out->buffer() + out->info()->offset_first_element_in_bytes();
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const size_t offset = id.x() * stride_x + id.y() * stride_y + id.z() * stride_z + id[3] * stride_w;
+
+        *reinterpret_cast<T *>(out_base + offset) = *reinterpret_cast<const T *>(input.ptr());
+    },
+    input);
+}
+} // namespace
+
+NEDataLayoutConvertKernel::NEDataLayoutConvertKernel()
+    : _input(nullptr), _output(nullptr), _nchw_to_nhwc(false)
+{
+}
+
+void NEDataLayoutConvertKernel::configure(const ITensor *input, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+
+    const bool nchw_to_nhwc = input->info()->data_layout() == DataLayout::NCHW;
+
+    TensorShape output_shape{ input->info()->tensor_shape() };
+    if(nchw_to_nhwc)
+    {
+        // [W, H, C] -> [C, W, H]
+        output_shape.set(0, input->info()->dimension(2));
+        output_shape.set(1, input->info()->dimension(0));
+        output_shape.set(2, input->info()->dimension(1));
+    }
+    else
+    {
+        // [C, W, H] -> [W, H, C]
+        output_shape.set(0, input->info()->dimension(1));
+        output_shape.set(1, input->info()->dimension(2));
+        output_shape.set(2, input->info()->dimension(0));
+    }
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*output->info(), output_shape, 1, input->info()->data_type(), input->info()->fixed_point_position());
+    output->info()->set_data_layout(nchw_to_nhwc ? DataLayout::NHWC : DataLayout::NCHW);
+    output->info()->set_quantization_info(input->info()->quantization_info());
+
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(0) != output_shape[0]);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) != output_shape[1]);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(2) != output_shape[2]);
+
+    _input        = input;
+    _output       = output;
+    _nchw_to_nhwc = nchw_to_nhwc;
+
+    // Configure kernel window. The kernel copies single elements, no padding is needed
+    Window win = calculate_max_window(*input->info());
+
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEDataLayoutConvertKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    switch(_input->info()->element_size())
+    {
+        case 1:
+            convert_layout<uint8_t>(_input, _output, _nchw_to_nhwc, window);
+            break;
+        case 2:
+            convert_layout<uint16_t>(_input, _output, _nchw_to_nhwc, window);
+            break;
+        case 4:
+            convert_layout<uint32_t>(_input, _output, _nchw_to_nhwc, window);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Element size not supported");
+            break;
+    }
+}
@@ -46,7 +46,7 @@ NEDepthConvertKernel::NEDepthConvertKernel()
 
 void NEDepthConvertKernel::configure(ITensor *input, ITensor *output, ConvertPolicy policy, uint32_t shift)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::QS8, DataType::S16, DataType::U16, DataType::QS16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::QS8, DataType::S16, DataType::U16, DataType::QS16, DataType::F16, DataType::F32);
 
     _input  = input;
     _output = input;
@@ -58,7 +58,7 @@ void NEDepthConvertKernel::configure(ITensor *input, ITensor *output, ConvertPol
         // Auto initialize output shape if not initialized (We can only auto-configure the shape, datatype must be given)
         set_shape_if_empty(*output->info(), input->info()->tensor_shape());
 
-        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::QS8, DataType::S16, DataType::U16, DataType::QS16, DataType::U32, DataType::S32, DataType::F32);
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::QS8, DataType::S16, DataType::U16, DataType::QS16, DataType::U32, DataType::S32, DataType::F16, DataType::F32);
         ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, output);
 
         // Set output
@@ -97,8 +97,12 @@ void NEDepthConvertKernel::configure(ITensor *input, ITensor *output, ConvertPol
     ARM_COMPUTE_ERROR_ON_MSG(input->info()->data_type() == DataType::QS16 && (output->info()->data_type() != DataType::QS16 && output->info()->data_type() != DataType::F32),
                              "Only data_types supported [in] QS16 ->  [out] QS16, F32");
 
-    ARM_COMPUTE_ERROR_ON_MSG(input->info()->data_type() == DataType::F32 && (output->info()->data_type() != DataType::QS8 && output->info()->data_type() != DataType::QS16),
-                             "Only data_types supported [in] F32 ->  [out] QS8, QS16");
+    ARM_COMPUTE_ERROR_ON_MSG(input->info()->data_type() == DataType::F16 && output->info()->data_type() != DataType::F32,
+                             "Only data_types supported [in] F16 ->  [out] F32");
+
+    ARM_COMPUTE_ERROR_ON_MSG(input->info()->data_type() == DataType::F32 && (output->info()->data_type() != DataType::QS8 && output->info()->data_type() != DataType::QS16
+                                                                             && output->info()->data_type() != DataType::F16),
+                             "Only data_types supported [in] F32 ->  [out] QS8, QS16, F16");
 
     constexpr unsigned int num_elems_processed_per_iteration = 16;
 
@@ -513,6 +517,65 @@ void NEDepthConvertKernel::run(const Window &window, const ThreadInfo &info)
                     input, output);
                     break;
                 }
+                case DataType::F16:
+                {
+#ifdef ARM_COMPUTE_ENABLE_FP16
+                    /* Down-conversion F32 -> F16 */
+                    execute_window_loop(window, [&](const Coordinates & id)
+                    {
+                        const float32x4x4_t texels_f32 =
+                        {
+                            {
+                                vld1q_f32(reinterpret_cast<const float *>(input.ptr())),
+                                vld1q_f32(reinterpret_cast<const float *>(input.ptr()) + 4),
+                                vld1q_f32(reinterpret_cast<const float *>(input.ptr()) + 8),
+                                vld1q_f32(reinterpret_cast<const float *>(input.ptr()) + 12)
+                            }
+                        };
+
+                        vst1q_f16(reinterpret_cast<float16_t *>(output.ptr()), vcombine_f16(vcvt_f16_f32(texels_f32.val[0]), vcvt_f16_f32(texels_f32.val[1])));
+                        vst1q_f16(reinterpret_cast<float16_t *>(output.ptr()) + 8, vcombine_f16(vcvt_f16_f32(texels_f32.val[2]), vcvt_f16_f32(texels_f32.val[3])));
+                    },
+                    input, output);
+#else  /* ARM_COMPUTE_ENABLE_FP16 */
+                    ARM_COMPUTE_ERROR("Not supported, recompile the library with arch=arm64-v8.2-a");
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+                    break;
+                }
+                default:
+                    ARM_COMPUTE_ERROR("Output data type not supported");
+            }
+            break;
+        }
+        case DataType::F16:
+        {
+            switch(_output->info()->data_type())
+            {
+                case DataType::F32:
+                {
+#ifdef ARM_COMPUTE_ENABLE_FP16
+                    /* Up-conversion F16 -> F32 */
+                    execute_window_loop(window, [&](const Coordinates & id)
+                    {
+                        const float16x8x2_t texels_f16 =
+                        {
+                            {
+                                vld1q_f16(reinterpret_cast<const float16_t *>(input.ptr())),
+                                vld1q_f16(reinterpret_cast<const float16_t *>(input.ptr()) + 8)
+                            }
+                        };
+
+                        vst1q_f32(reinterpret_cast<float *>(output.ptr()), vcvt_f32_f16(vget_low_f16(texels_f16.val[0])));
+                        vst1q_f32(reinterpret_cast<float *>(output.ptr()) + 4, vcvt_f32_f16(vget_high_f16(texels_f16.val[0])));
+                        vst1q_f32(reinterpret_cast<float *>(output.ptr()) + 8, vcvt_f32_f16(vget_low_f16(texels_f16.val[1])));
+                        vst1q_f32(reinterpret_cast<float *>(output.ptr()) + 12, vcvt_f32_f16(vget_high_f16(texels_f16.val[1])));
+                    },
+                    input, output);
+#else  /* ARM_COMPUTE_ENABLE_FP16 */
+                    ARM_COMPUTE_ERROR("Not supported, recompile the library with arch=arm64-v8.2-a");
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+                    break;
+                }
                 default:
                     ARM_COMPUTE_ERROR("Output data type not supported");
             }
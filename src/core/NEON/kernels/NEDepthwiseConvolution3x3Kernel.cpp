@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEDepthwiseConvolution3x3Kernel.h"
+
+#include "arm_compute/core/AccessWindowStatic.h"
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Convolve a row of four horizontally adjacent output elements with one filter row (stride 1) */
+inline float32x4_t convolve_row_stride1(const float *in, float w0, float w1, float w2, float32x4_t acc)
+{
+    acc = vmlaq_n_f32(acc, vld1q_f32(in + 0), w0);
+    acc = vmlaq_n_f32(acc, vld1q_f32(in + 1), w1);
+    acc = vmlaq_n_f32(acc, vld1q_f32(in + 2), w2);
+    return acc;
+}
+
+/** Convolve a row of four horizontally adjacent output elements with one filter row (stride 2) */
+inline float32x4_t convolve_row_stride2(const float *in, float w0, float w1, float w2, float32x4_t acc)
+{
+    const float32x4x2_t even_odd = vld2q_f32(in);
+    const float32x4x2_t shifted  = vld2q_f32(in + 2);
+
+    acc = vmlaq_n_f32(acc, even_odd.val[0], w0);
+    acc = vmlaq_n_f32(acc, even_odd.val[1], w1);
+    acc = vmlaq_n_f32(acc, shifted.val[0], w2);
+    return acc;
+}
+} // namespace
+
+NEDepthwiseConvolution3x3Kernel::NEDepthwiseConvolution3x3Kernel()
+    : _border_size(0), _input(nullptr), _output(nullptr), _weights(nullptr), _biases(nullptr), _conv_stride_x(0), _conv_stride_y(0), _conv_pad_x(0), _conv_pad_y(0)
+{
+}
+
+BorderSize NEDepthwiseConvolution3x3Kernel::border_size() const
+{
+    return _border_size;
+}
+
+void NEDepthwiseConvolution3x3Kernel::configure(const ITensor *input, ITensor *output, const ITensor *weights, const ITensor *biases, const PadStrideInfo &conv_info)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output, weights);
+    ARM_COMPUTE_ERROR_ON(input->info()->data_layout() != output->info()->data_layout());
+    ARM_COMPUTE_ERROR_ON(conv_info.stride().first < 1 || conv_info.stride().first > 2);
+
+    // In NHWC the channels are the innermost dimension and width/height move up by one
+    const bool         is_nhwc     = input->info()->data_layout() == DataLayout::NHWC;
+    const unsigned int width_idx   = is_nhwc ? 1 : 0;
+    const unsigned int height_idx  = is_nhwc ? 2 : 1;
+    const unsigned int channel_idx = is_nhwc ? 0 : 2;
+
+    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(width_idx) != 3 || weights->info()->dimension(height_idx) != 3);
+    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(channel_idx) != input->info()->dimension(channel_idx));
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        ARM_COMPUTE_ERROR_ON(biases->info()->dimension(0) != weights->info()->dimension(channel_idx));
+    }
+
+    std::pair<unsigned int, unsigned int> expected_output = scaled_dimensions(input->info()->dimension(width_idx), input->info()->dimension(height_idx),
+                                                                              weights->info()->dimension(width_idx), weights->info()->dimension(height_idx),
+                                                                              conv_info);
+
+    ARM_COMPUTE_UNUSED(expected_output);
+    ARM_COMPUTE_ERROR_ON(expected_output.first != output->info()->dimension(width_idx));
+    ARM_COMPUTE_ERROR_ON(expected_output.second != output->info()->dimension(height_idx));
+
+    _input         = input;
+    _output        = output;
+    _weights       = weights;
+    _biases        = biases;
+    _conv_stride_x = conv_info.stride().first;
+    _conv_stride_y = conv_info.stride().second;
+    _conv_pad_x    = conv_info.pad().first;
+    _conv_pad_y    = conv_info.pad().second;
+    _border_size   = BorderSize(_conv_pad_y, _conv_pad_x);
+
+    if(is_nhwc)
+    {
+        // The kernel clamps the 3x3 region inside the input, no border is needed
+        _border_size = BorderSize(0);
+
+        // Each iteration processes 4 channels of one output element
+        constexpr unsigned int num_channels_per_iteration = 4;
+
+        Window win = calculate_max_window(*output->info(), Steps(num_channels_per_iteration));
+
+        AccessWindowHorizontal input_access(input->info(), 0, num_channels_per_iteration);
+        AccessWindowHorizontal output_access(output->info(), 0, num_channels_per_iteration);
+        AccessWindowHorizontal weights_access(weights->info(), 0, num_channels_per_iteration);
+
+        update_window_and_padding(win, input_access, weights_access, output_access);
+
+        if(biases != nullptr)
+        {
+            AccessWindowHorizontal biases_access(biases->info(), 0, num_channels_per_iteration);
+            update_window_and_padding(win, biases_access);
+        }
+
+        output_access.set_valid_region(win, ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+        INEKernel::configure(win);
+        return;
+    }
+
+    // Configure kernel window
+    constexpr unsigned int num_elems_written_per_iteration = 4;
+    // The stride-2 path deinterleaves with full 8-element loads, so round the read up accordingly
+    const unsigned int     num_elems_read_per_iteration = 3 + num_elems_written_per_iteration * _conv_stride_x;
+    constexpr unsigned int num_rows_read_per_iteration  = 3;
+
+    Window win = calculate_max_window(*output->info(), Steps(num_elems_written_per_iteration));
+
+    AccessWindowRectangle  input_access(input->info(), -_conv_pad_x, -_conv_pad_y, num_elems_read_per_iteration, num_rows_read_per_iteration, _conv_stride_x, _conv_stride_y);
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_written_per_iteration);
+    AccessWindowStatic     weights_access(weights->info(), 0, 0, weights->info()->dimension(0), weights->info()->dimension(1));
+
+    update_window_and_padding(win, input_access, weights_access, output_access);
+
+    output_access.set_valid_region(win, ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEDepthwiseConvolution3x3Kernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    if(_input->info()->data_layout() == DataLayout::NHWC)
+    {
+        run_nhwc(window);
+        return;
+    }
+
+    const int in_stride_x = _input->info()->strides_in_bytes()[0];
+    const int in_stride_y = _input->info()->strides_in_bytes()[1];
+    const int w_stride_y  = _weights->info()->strides_in_bytes()[1];
+
+    Iterator out(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        // Per-channel filter and fused bias
+        const uint8_t *w_base = _weights->buffer() + _weights->info()->offset_element_in_bytes(Coordinates(0, 0, id.z()));
+        const float    bias   = (_biases != nullptr) ? *reinterpret_cast<const float *>(_biases->ptr_to_element(Coordinates(id.z()))) : 0.f;
+
+        const uint8_t *in_base = _input->buffer() + _input->info()->offset_element_in_bytes(Coordinates(0, 0, id.z()))
+                                 + (id.x() * _conv_stride_x - _conv_pad_x) * in_stride_x + (id.y() * _conv_stride_y - _conv_pad_y) * in_stride_y;
+
+        float32x4_t acc = vdupq_n_f32(bias);
+
+        for(int r = 0; r < 3; ++r)
+        {
+            const float *in_row = reinterpret_cast<const float *>(in_base + r * in_stride_y);
+            const float *w_row  = reinterpret_cast<const float *>(w_base + r * w_stride_y);
+
+            if(_conv_stride_x == 1)
+            {
+                acc = convolve_row_stride1(in_row, w_row[0], w_row[1], w_row[2], acc);
+            }
+            else
+            {
+                acc = convolve_row_stride2(in_row, w_row[0], w_row[1], w_row[2], acc);
+            }
+        }
+
+        vst1q_f32(reinterpret_cast<float *>(out.ptr()), acc);
+    },
+    out);
+}
+
+void NEDepthwiseConvolution3x3Kernel::run_nhwc(const Window &window)
+{
+    const int input_width  = _input->info()->dimension(1);
+    const int input_height = _input->info()->dimension(2);
+
+    const size_t in_stride_w = _input->info()->strides_in_bytes()[1];
+    const size_t in_stride_h = _input->info()->strides_in_bytes()[2];
+    const size_t w_stride_x  = _weights->info()->strides_in_bytes()[1];
+    const size_t w_stride_y  = _weights->info()->strides_in_bytes()[2];
+
+    Iterator out(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int start_x = id.y() * _conv_stride_x - _conv_pad_x;
+        const int start_y = id.z() * _conv_stride_y - _conv_pad_y;
+
+        // Point to the current group of channels of the input, filter and fused bias
+        Coordinates in_coords(id);
+        in_coords.set(1, 0);
+        in_coords.set(2, 0);
+        const uint8_t *const in_base = _input->buffer() + _input->info()->offset_element_in_bytes(in_coords);
+        const uint8_t *const w_base  = _weights->buffer() + _weights->info()->offset_element_in_bytes(Coordinates(id.x(), 0, 0));
+
+        float32x4_t acc = (_biases != nullptr) ? vld1q_f32(reinterpret_cast<const float *>(_biases->ptr_to_element(Coordinates(id.x())))) : vdupq_n_f32(0.f);
+
+        for(int r = 0; r < 3; ++r)
+        {
+            const int in_y = start_y + r;
+            if(in_y < 0 || in_y >= input_height)
+            {
+                continue;
+            }
+
+            for(int c = 0; c < 3; ++c)
+            {
+                const int in_x = start_x + c;
+                if(in_x < 0 || in_x >= input_width)
+                {
+                    continue;
+                }
+
+                const float32x4_t in = vld1q_f32(reinterpret_cast<const float *>(in_base + in_y * in_stride_h + in_x * in_stride_w));
+                const float32x4_t w  = vld1q_f32(reinterpret_cast<const float *>(w_base + r * w_stride_y + c * w_stride_x));
+                acc                  = vmlaq_f32(acc, in, w);
+            }
+        }
+
+        vst1q_f32(reinterpret_cast<float *>(out.ptr()), acc);
+    },
+    out);
+}
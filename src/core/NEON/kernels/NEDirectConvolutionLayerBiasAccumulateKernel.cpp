@@ -180,7 +180,7 @@ void accumulate_bias(ITensor *input, const ITensor *bias, const Window window, I
 } // namespace
 
 NEDirectConvolutionLayerBiasAccumulateKernel::NEDirectConvolutionLayerBiasAccumulateKernel()
-    : _func(nullptr), _input(nullptr), _bias(nullptr), _output(nullptr)
+    : _func(nullptr), _input(nullptr), _bias(nullptr), _output(nullptr), _padding_less(false)
 {
 }
 
@@ -204,6 +204,29 @@ void NEDirectConvolutionLayerBiasAccumulateKernel::configure(ITensor *input, con
 
     const unsigned int num_elems_processed_per_iteration = 16 / element_size_from_data_type(input->info()->data_type());
 
+    // Tensors whose layout is already fixed without a border cannot grow the padding the vector
+    // loop needs past the last aligned column: stop the window there and accumulate the leftover
+    // columns with a scalar tail in run()
+    if(padding_less_execution_required({ input->info(), (output != nullptr) ? output->info() : nullptr }))
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(input->info()->data_type() != DataType::F32, "Padding-less execution is only supported for F32");
+        _padding_less = true;
+
+        Window win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration));
+        win.set(Window::DimX, Window::Dimension(0, (input->info()->dimension(0) / num_elems_processed_per_iteration) * num_elems_processed_per_iteration, num_elems_processed_per_iteration));
+        if(output != nullptr)
+        {
+            output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+        }
+        else
+        {
+            input->info()->set_valid_region(ValidRegion(Coordinates(), input->info()->tensor_shape()));
+        }
+        _func = (output == nullptr) ? &accumulate_bias<float, float, true> : &accumulate_bias<float, float, false>;
+        INEKernel::configure(win);
+        return;
+    }
+
     // Configure kernel window
     Window                 win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration));
     AccessWindowHorizontal input_access(input->info(), 0, num_elems_processed_per_iteration);
@@ -274,4 +297,37 @@ void NEDirectConvolutionLayerBiasAccumulateKernel::run(const Window &window, con
     ARM_COMPUTE_ERROR_ON(_func == nullptr);
 
     (*_func)(_input, _bias, window, _output);
+
+    // Padding-less mode: the configured window stops at the last aligned column, finish the row
+    // with a scalar tail
+    if(_padding_less)
+    {
+        const unsigned int width = _input->info()->dimension(0);
+        if(window.x().end() < static_cast<int>(width))
+        {
+            Window tail(window);
+            tail.set(Window::DimX, Window::Dimension(window.x().end(), width, 1));
+
+            Iterator in(_input, tail);
+            if(_output != nullptr)
+            {
+                Iterator out(_output, tail);
+                execute_window_loop(tail, [&](const Coordinates & id)
+                {
+                    const float b                         = *reinterpret_cast<const float *>(_bias->ptr_to_element(Coordinates(id.z())));
+                    *reinterpret_cast<float *>(out.ptr()) = *reinterpret_cast<const float *>(in.ptr()) + b;
+                },
+                in, out);
+            }
+            else
+            {
+                execute_window_loop(tail, [&](const Coordinates & id)
+                {
+                    const float b                         = *reinterpret_cast<const float *>(_bias->ptr_to_element(Coordinates(id.z())));
+                    *reinterpret_cast<float *>(in.ptr()) += b;
+                },
+                in);
+            }
+        }
+    }
 }
@@ -138,6 +138,13 @@ float32x4_t internal_vld1q<3>(const float *in)
     return tmp.val[0];
 }
 
+template <>
+float32x4_t internal_vld1q<4>(const float *in)
+{
+    const float32x4x4_t tmp = vld4q_f32(in);
+    return tmp.val[0];
+}
+
 inline float32x4_t internal_vdupq_n(float v)
 {
     return vdupq_n_f32(v);
@@ -427,6 +434,94 @@ public:
     }
 };
 
+/** 1x1 convolver for F32 specialized on the kernel depth being a multiple of @p channels_per_block.
+ *
+ * The channel accumulation becomes a compile-time inner loop the compiler fully unrolls, and each
+ * output plane is traversed once per block of channels instead of once per channel, dividing the
+ * intermediate output loads and stores by the block size. Selected at configure time when the
+ * input channel count is a multiple of 4, 8 or 16.
+ */
+template <unsigned int stridex, unsigned int channels_per_block>
+class convolver_1x1_unrolled
+{
+public:
+    static void convolve(const Window &window, unsigned int num_elems_read_per_iteration, unsigned int num_elems_written_per_iteration,
+                         const ITensor *input, const ITensor *weights, ITensor *output, const PadStrideInfo &conv_info)
+    {
+        const int          input_stride_y  = input->info()->strides_in_bytes().y();
+        const int          input_stride_z  = input->info()->strides_in_bytes().z();
+        const int          output_stride_y = output->info()->strides_in_bytes().y();
+        const int          output_stride_z = output->info()->strides_in_bytes().z();
+        const int          kernel_stride_z = weights->info()->strides_in_bytes().z();
+        const int          kernel_stride_w = weights->info()->strides_in_bytes()[3];
+        const int          output_w        = output->info()->dimension(0);
+        const int          output_h        = output->info()->dimension(1);
+        const int          range_z         = window.z().end() - window.z().start();
+        const int          kernel_depth    = weights->info()->dimension(Window::DimZ);
+        const unsigned int conv_stride_y   = std::get<1>(conv_info.stride());
+
+        ARM_COMPUTE_ERROR_ON(kernel_depth % channels_per_block != 0);
+
+        // setup output window for the iterator
+        Window window_out = window;
+        window_out.set(Window::DimX, Window::Dimension(0, output->info()->dimension(Window::DimX), output->info()->dimension(Window::DimX)));
+        window_out.set(Window::DimY, Window::Dimension(0, output->info()->dimension(Window::DimY), output->info()->dimension(Window::DimY)));
+        window_out.set(Window::DimZ, Window::Dimension(window.z().start(), window.z().end(), range_z));
+
+        // setup input window for the iterator
+        Window window_in = window;
+        // we just want execute_window_loop to iterate over the higher dimensions (>3), so we set the first 3 dimensions to 0
+        window_in.set(Window::DimX, Window::Dimension(0, 0, 0));
+        window_in.set(Window::DimY, Window::Dimension(0, 0, 0));
+        window_in.set(Window::DimZ, Window::Dimension(0, 0, 0));
+
+        Window   window_k = calculate_max_window(*weights->info(), Steps(1u));
+        Iterator out(output, window_out);
+        Iterator in(input, window_in);
+        Iterator k(weights, window_k);
+
+        const uint8_t *k_ptr = k.ptr();
+
+        execute_window_loop(window_out, [&](const Coordinates & id)
+        {
+            const uint8_t *input_ptr = in.ptr();
+            uint8_t       *out_ptr   = out.ptr();
+            int            ih        = 0;
+            int            oh        = 0;
+            for(int oz = 0; oz < range_z; ++oz)
+            {
+                auto p_out_base = out_ptr + oz * output_stride_z;
+                for(int p = 0; p < kernel_depth; p += channels_per_block)
+                {
+                    float32x4_t vk[channels_per_block];
+                    for(unsigned int c = 0; c < channels_per_block; ++c)
+                    {
+                        vk[c] = vdupq_n_f32(*reinterpret_cast<const float *>(k_ptr + (p + c) * kernel_stride_z + (id.z() + oz) * kernel_stride_w));
+                    }
+
+                    for(ih = 0, oh = 0; oh < output_h; ++oh, ih += conv_stride_y)
+                    {
+                        const uint8_t *in_base = input_ptr + p * input_stride_z + ih * input_stride_y;
+                        auto           p_out   = reinterpret_cast<float *>(p_out_base + oh * output_stride_y);
+                        for(int ow = 0, in_off = 0; ow < output_w; ow += num_elems_written_per_iteration, in_off += num_elems_read_per_iteration, p_out += num_elems_written_per_iteration)
+                        {
+                            // The first block initializes the output plane, the following ones accumulate into it
+                            float32x4_t vres = (p == 0) ? vdupq_n_f32(0.f) : vld1q_f32(p_out);
+                            for(unsigned int c = 0; c < channels_per_block; ++c)
+                            {
+                                const auto in_val = reinterpret_cast<const float *>(in_base + c * input_stride_z) + in_off;
+                                vres              = vmlaq_f32(vres, vk[c], internal_vld1q<stridex>(in_val));
+                            }
+                            vst1q_f32(p_out, vres);
+                        }
+                    }
+                }
+            }
+        },
+        in, out);
+    }
+};
+
 #ifdef ARM_COMPUTE_ENABLE_FP16
 inline float16x8x3_t load_matrix_row(const float16_t *ptr)
 {
@@ -595,6 +690,20 @@ inline qint8x8x3_t load_matrix_row(const qint8_t *ptr)
     };
     return r;
 }
+inline qint16x8x3_t load_matrix_row(const qint16_t *ptr)
+{
+    /* ptr is a pointer to a row in a 3x3 matrix, the function returns 3 vectors holding exactly the same value in all lanes:
+       r.val[0] contains the first element, r.val[1] the second element and r.val[2] the third element (in all lanes) */
+    const qint16x8x3_t r =
+    {
+        {
+            vld1q_dup_qs16(ptr),
+            vld1q_dup_qs16(1 + ptr),
+            vld1q_dup_qs16(2 + ptr)
+        }
+    };
+    return r;
+}
 
 template <unsigned int stridex>
 float32x4x2_t convolve_5x5(const float *in_0, const float *in_1, const float *in_2, const float *in_3, const float *in_4,
@@ -749,6 +858,102 @@ inline float32x4x2_t convolve_5x5<3>(const float *in_0, const float *in_1, const
     return out;
 }
 
+template <>
+inline float32x4x2_t convolve_5x5<4>(const float *in_0, const float *in_1, const float *in_2, const float *in_3, const float *in_4,
+                                     const float *m0, const float *m1, const float *m2, const float *m3, const float *m4, int fixed_point_position)
+{
+    float32x4x2_t out = convolve_5x5<1>(in_0, in_1, in_2, in_3, in_4, m0, m1, m2, m3, m4, fixed_point_position);
+    out.val[0]        = vsetq_lane_f32(vgetq_lane_f32(out.val[1], 0), out.val[0], 1);
+    return out;
+}
+
+template <unsigned int stridex>
+float32x4x2_t convolve_7x7(const float *in_0, const float *in_1, const float *in_2, const float *in_3, const float *in_4, const float *in_5, const float *in_6,
+                           const float *m0, const float *m1, const float *m2, const float *m3, const float *m4, const float *m5, const float *m6, int fixed_point_position);
+
+inline void accumulate_row_7x7(float32x4x2_t &out, const float *in, const float *m)
+{
+    const float32x4x4_t vin =
+    {
+        {
+            vld1q_f32(in),
+            vld1q_f32(in + 4),
+            vld1q_f32(in + 8),
+            vld1q_f32(in + 12)
+        }
+    };
+    const float32x4x3_t m_hi  = load_matrix_hi(m, 1 + m, 2 + m);
+    const float32x4x3_t m_mid = load_matrix_hi(3 + m, 4 + m, 5 + m);
+    const float32x4_t   m_lo  = vld1q_dup_f32(6 + m);
+
+    out.val[0] = vmlaq_f32(out.val[0], vin.val[0], m_hi.val[0]);
+    out.val[0] = vmlaq_f32(out.val[0], vextq_f32(vin.val[0], vin.val[1], 1), m_hi.val[1]);
+    out.val[0] = vmlaq_f32(out.val[0], vextq_f32(vin.val[0], vin.val[1], 2), m_hi.val[2]);
+    out.val[0] = vmlaq_f32(out.val[0], vextq_f32(vin.val[0], vin.val[1], 3), m_mid.val[0]);
+    out.val[0] = vmlaq_f32(out.val[0], vin.val[1], m_mid.val[1]);
+    out.val[0] = vmlaq_f32(out.val[0], vextq_f32(vin.val[1], vin.val[2], 1), m_mid.val[2]);
+    out.val[0] = vmlaq_f32(out.val[0], vextq_f32(vin.val[1], vin.val[2], 2), m_lo);
+
+    out.val[1] = vmlaq_f32(out.val[1], vin.val[1], m_hi.val[0]);
+    out.val[1] = vmlaq_f32(out.val[1], vextq_f32(vin.val[1], vin.val[2], 1), m_hi.val[1]);
+    out.val[1] = vmlaq_f32(out.val[1], vextq_f32(vin.val[1], vin.val[2], 2), m_hi.val[2]);
+    out.val[1] = vmlaq_f32(out.val[1], vextq_f32(vin.val[1], vin.val[2], 3), m_mid.val[0]);
+    out.val[1] = vmlaq_f32(out.val[1], vin.val[2], m_mid.val[1]);
+    out.val[1] = vmlaq_f32(out.val[1], vextq_f32(vin.val[2], vin.val[3], 1), m_mid.val[2]);
+    out.val[1] = vmlaq_f32(out.val[1], vextq_f32(vin.val[2], vin.val[3], 2), m_lo);
+}
+
+template <>
+inline float32x4x2_t convolve_7x7<1>(const float *in_0, const float *in_1, const float *in_2, const float *in_3, const float *in_4, const float *in_5, const float *in_6,
+                                     const float *m0, const float *m1, const float *m2, const float *m3, const float *m4, const float *m5, const float *m6, int fixed_point_position)
+{
+    ARM_COMPUTE_UNUSED(fixed_point_position);
+    float32x4x2_t out =
+    {
+        {
+            vdupq_n_f32(0.f),
+            vdupq_n_f32(0.f)
+        }
+    };
+    accumulate_row_7x7(out, in_0, m0);
+    accumulate_row_7x7(out, in_1, m1);
+    accumulate_row_7x7(out, in_2, m2);
+    accumulate_row_7x7(out, in_3, m3);
+    accumulate_row_7x7(out, in_4, m4);
+    accumulate_row_7x7(out, in_5, m5);
+    accumulate_row_7x7(out, in_6, m6);
+    return out;
+}
+
+template <>
+inline float32x4x2_t convolve_7x7<2>(const float *in_0, const float *in_1, const float *in_2, const float *in_3, const float *in_4, const float *in_5, const float *in_6,
+                                     const float *m0, const float *m1, const float *m2, const float *m3, const float *m4, const float *m5, const float *m6, int fixed_point_position)
+{
+    float32x4x2_t out = convolve_7x7<1>(in_0, in_1, in_2, in_3, in_4, in_5, in_6, m0, m1, m2, m3, m4, m5, m6, fixed_point_position);
+    out.val[0]        = vsetq_lane_f32(vgetq_lane_f32(out.val[0], 2), out.val[0], 1);
+    out.val[0]        = vsetq_lane_f32(vgetq_lane_f32(out.val[1], 0), out.val[0], 2);
+    out.val[0]        = vsetq_lane_f32(vgetq_lane_f32(out.val[1], 2), out.val[0], 3);
+    return out;
+}
+
+template <>
+inline float32x4x2_t convolve_7x7<3>(const float *in_0, const float *in_1, const float *in_2, const float *in_3, const float *in_4, const float *in_5, const float *in_6,
+                                     const float *m0, const float *m1, const float *m2, const float *m3, const float *m4, const float *m5, const float *m6, int fixed_point_position)
+{
+    float32x4x2_t out = convolve_7x7<1>(in_0, in_1, in_2, in_3, in_4, in_5, in_6, m0, m1, m2, m3, m4, m5, m6, fixed_point_position);
+    out.val[0]        = vsetq_lane_f32(vgetq_lane_f32(out.val[0], 3), out.val[0], 1);
+    return out;
+}
+
+template <>
+inline float32x4x2_t convolve_7x7<4>(const float *in_0, const float *in_1, const float *in_2, const float *in_3, const float *in_4, const float *in_5, const float *in_6,
+                                     const float *m0, const float *m1, const float *m2, const float *m3, const float *m4, const float *m5, const float *m6, int fixed_point_position)
+{
+    float32x4x2_t out = convolve_7x7<1>(in_0, in_1, in_2, in_3, in_4, in_5, in_6, m0, m1, m2, m3, m4, m5, m6, fixed_point_position);
+    out.val[0]        = vsetq_lane_f32(vgetq_lane_f32(out.val[1], 0), out.val[0], 1);
+    return out;
+}
+
 template <unsigned int stridex>
 float32x4x2_t convolve_3x3(const float *in_top, const float *in_mid, const float *in_low, const float32x4x3_t &m0, const float32x4x3_t &m1, const float32x4x3_t &m2, int fixed_point_position);
 
@@ -830,6 +1035,14 @@ inline float32x4x2_t convolve_3x3<3>(const float *in_top, const float *in_mid, c
     return out;
 }
 
+template <>
+inline float32x4x2_t convolve_3x3<4>(const float *in_top, const float *in_mid, const float *in_low, const float32x4x3_t &m0, const float32x4x3_t &m1, const float32x4x3_t &m2, int fixed_point_position)
+{
+    float32x4x2_t out = convolve_3x3<1>(in_top, in_mid, in_low, m0, m1, m2, fixed_point_position);
+    out.val[0]        = vsetq_lane_f32(vgetq_lane_f32(out.val[1], 0), out.val[0], 1);
+    return out;
+}
+
 template <unsigned int stridex>
 qint16x8x2_t convolve_3x3(const qint8_t *in_top, const qint8_t *in_mid, const qint8_t *in_low, const qint8x8x3_t &m0, const qint8x8x3_t &m1, const qint8x8x3_t &m2, int fixed_point_position);
 
@@ -912,6 +1125,86 @@ inline qint16x8x2_t convolve_3x3<3>(const qint8_t *in_top, const qint8_t *in_mid
     return out;
 }
 
+template <unsigned int stridex>
+qint32x4x2_t convolve_3x3(const qint16_t *in_top, const qint16_t *in_mid, const qint16_t *in_low, const qint16x8x3_t &m0, const qint16x8x3_t &m1, const qint16x8x3_t &m2, int fixed_point_position);
+
+template <>
+inline qint32x4x2_t convolve_3x3<1>(const qint16_t *in_top, const qint16_t *in_mid, const qint16_t *in_low, const qint16x8x3_t &m0, const qint16x8x3_t &m1, const qint16x8x3_t &m2,
+                                    int fixed_point_position)
+{
+    const qint16x8x2_t vtop =
+    {
+        {
+            vld1q_qs16(in_top),
+            vld1q_qs16(in_top + 8)
+        }
+    };
+    const qint16x8x2_t vmid =
+    {
+        {
+            vld1q_qs16(in_mid),
+            vld1q_qs16(in_mid + 8)
+        }
+    };
+    const qint16x8x2_t vlow =
+    {
+        {
+            vld1q_qs16(in_low),
+            vld1q_qs16(in_low + 8)
+        }
+    };
+    const qint16x8_t vtop1 = vextq_s16(vtop.val[0], vtop.val[1], 1);
+    const qint16x8_t vtop2 = vextq_s16(vtop.val[0], vtop.val[1], 2);
+    const qint16x8_t vmid1 = vextq_s16(vmid.val[0], vmid.val[1], 1);
+    const qint16x8_t vmid2 = vextq_s16(vmid.val[0], vmid.val[1], 2);
+    const qint16x8_t vlow1 = vextq_s16(vlow.val[0], vlow.val[1], 1);
+    const qint16x8_t vlow2 = vextq_s16(vlow.val[0], vlow.val[1], 2);
+    qint32x4x2_t     out   =
+    {
+        {
+            vmull_qs16(vget_low_s16(vtop.val[0]), vget_low_s16(m0.val[0]), fixed_point_position),
+            vmull_qs16(vget_high_s16(vtop.val[0]), vget_high_s16(m0.val[0]), fixed_point_position)
+        }
+    };
+    out.val[0] = vqmlal_qs16(out.val[0], vget_low_s16(vtop1), vget_low_s16(m0.val[1]), fixed_point_position);
+    out.val[0] = vqmlal_qs16(out.val[0], vget_low_s16(vtop2), vget_low_s16(m0.val[2]), fixed_point_position);
+    out.val[0] = vqmlal_qs16(out.val[0], vget_low_s16(vmid.val[0]), vget_low_s16(m1.val[0]), fixed_point_position);
+    out.val[0] = vqmlal_qs16(out.val[0], vget_low_s16(vmid1), vget_low_s16(m1.val[1]), fixed_point_position);
+    out.val[0] = vqmlal_qs16(out.val[0], vget_low_s16(vmid2), vget_low_s16(m1.val[2]), fixed_point_position);
+    out.val[0] = vqmlal_qs16(out.val[0], vget_low_s16(vlow.val[0]), vget_low_s16(m2.val[0]), fixed_point_position);
+    out.val[0] = vqmlal_qs16(out.val[0], vget_low_s16(vlow1), vget_low_s16(m2.val[1]), fixed_point_position);
+    out.val[0] = vqmlal_qs16(out.val[0], vget_low_s16(vlow2), vget_low_s16(m2.val[2]), fixed_point_position);
+    out.val[1] = vqmlal_qs16(out.val[1], vget_high_s16(vtop1), vget_high_s16(m0.val[1]), fixed_point_position);
+    out.val[1] = vqmlal_qs16(out.val[1], vget_high_s16(vtop2), vget_high_s16(m0.val[2]), fixed_point_position);
+    out.val[1] = vqmlal_qs16(out.val[1], vget_high_s16(vmid.val[0]), vget_high_s16(m1.val[0]), fixed_point_position);
+    out.val[1] = vqmlal_qs16(out.val[1], vget_high_s16(vmid1), vget_high_s16(m1.val[1]), fixed_point_position);
+    out.val[1] = vqmlal_qs16(out.val[1], vget_high_s16(vmid2), vget_high_s16(m1.val[2]), fixed_point_position);
+    out.val[1] = vqmlal_qs16(out.val[1], vget_high_s16(vlow.val[0]), vget_high_s16(m2.val[0]), fixed_point_position);
+    out.val[1] = vqmlal_qs16(out.val[1], vget_high_s16(vlow1), vget_high_s16(m2.val[1]), fixed_point_position);
+    out.val[1] = vqmlal_qs16(out.val[1], vget_high_s16(vlow2), vget_high_s16(m2.val[2]), fixed_point_position);
+    return out;
+}
+
+template <>
+inline qint32x4x2_t convolve_3x3<2>(const qint16_t *in_top, const qint16_t *in_mid, const qint16_t *in_low, const qint16x8x3_t &m0, const qint16x8x3_t &m1, const qint16x8x3_t &m2,
+                                    int fixed_point_position)
+{
+    qint32x4x2_t out = convolve_3x3<1>(in_top, in_mid, in_low, m0, m1, m2, fixed_point_position);
+    out.val[0]       = vsetq_lane_s32(vgetq_lane_s32(out.val[0], 2), out.val[0], 1);
+    out.val[0]       = vsetq_lane_s32(vgetq_lane_s32(out.val[1], 0), out.val[0], 2);
+    out.val[0]       = vsetq_lane_s32(vgetq_lane_s32(out.val[1], 2), out.val[0], 3);
+    return out;
+}
+
+template <>
+inline qint32x4x2_t convolve_3x3<3>(const qint16_t *in_top, const qint16_t *in_mid, const qint16_t *in_low, const qint16x8x3_t &m0, const qint16x8x3_t &m1, const qint16x8x3_t &m2,
+                                    int fixed_point_position)
+{
+    qint32x4x2_t out = convolve_3x3<1>(in_top, in_mid, in_low, m0, m1, m2, fixed_point_position);
+    out.val[0]       = vsetq_lane_s32(vgetq_lane_s32(out.val[0], 3), out.val[0], 1);
+    return out;
+}
+
 template <unsigned int stridex>
 void store_results(float *buffer, const float32x4x2_t &values);
 
@@ -934,6 +1227,12 @@ void store_results<3>(float *buffer, const float32x4x2_t &values)
     vst1_f32(buffer, vget_low_f32(values.val[0]));
 }
 
+template <>
+void store_results<4>(float *buffer, const float32x4x2_t &values)
+{
+    vst1_f32(buffer, vget_low_f32(values.val[0]));
+}
+
 template <unsigned int stridex>
 void store_results(qint16_t *buffer, const qint16x8x2_t &values);
 
@@ -978,6 +1277,12 @@ void accumulate_results<3>(float *buffer, const float32x4x2_t &values)
     vst1_f32(buffer, vadd_f32(vld1_f32(buffer), vget_low_f32(values.val[0])));
 }
 
+template <>
+void accumulate_results<4>(float *buffer, const float32x4x2_t &values)
+{
+    vst1_f32(buffer, vadd_f32(vld1_f32(buffer), vget_low_f32(values.val[0])));
+}
+
 template <unsigned int stridex>
 void accumulate_results(qint16_t *buffer, const qint16x8x2_t &values);
 
@@ -1000,6 +1305,50 @@ void accumulate_results<3>(qint16_t *buffer, const qint16x8x2_t &values)
     vst1_qs16(buffer, vqadd_qs16(vld1_qs16(buffer), vget_low_s16(values.val[0])));
 }
 
+template <unsigned int stridex>
+void store_results(qint32_t *buffer, const qint32x4x2_t &values);
+
+template <>
+void store_results<1>(qint32_t *buffer, const qint32x4x2_t &values)
+{
+    vst1q_s32(buffer, values.val[0]);
+    vst1q_s32(buffer + 4, values.val[1]);
+}
+
+template <>
+void store_results<2>(qint32_t *buffer, const qint32x4x2_t &values)
+{
+    vst1q_s32(buffer, values.val[0]);
+}
+
+template <>
+void store_results<3>(qint32_t *buffer, const qint32x4x2_t &values)
+{
+    vst1_s32(buffer, vget_low_s32(values.val[0]));
+}
+
+template <unsigned int stridex>
+void accumulate_results(qint32_t *buffer, const qint32x4x2_t &values);
+
+template <>
+void accumulate_results<1>(qint32_t *buffer, const qint32x4x2_t &values)
+{
+    vst1q_s32(buffer, vqaddq_qs32(vld1q_s32(buffer), values.val[0]));
+    vst1q_s32(buffer + 4, vqaddq_qs32(vld1q_s32(buffer + 4), values.val[1]));
+}
+
+template <>
+void accumulate_results<2>(qint32_t *buffer, const qint32x4x2_t &values)
+{
+    vst1q_s32(buffer, vqaddq_qs32(vld1q_s32(buffer), values.val[0]));
+}
+
+template <>
+void accumulate_results<3>(qint32_t *buffer, const qint32x4x2_t &values)
+{
+    vst1_s32(buffer, vqadd_s32(vld1_s32(buffer), vget_low_s32(values.val[0])));
+}
+
 template <unsigned int stridex>
 int get_input_num_elems_processed(unsigned int num_elems_written_per_iteration);
 
@@ -1021,6 +1370,12 @@ int get_input_num_elems_processed<3>(unsigned int num_elems_written_per_iteratio
     return num_elems_written_per_iteration * 3;
 }
 
+template <>
+int get_input_num_elems_processed<4>(unsigned int num_elems_written_per_iteration)
+{
+    return num_elems_written_per_iteration << 2;
+}
+
 template <typename T1, typename T2, unsigned int stridex>
 class convolver_3x3
 {
@@ -1257,6 +1612,128 @@ public:
     }
 };
 
+template <typename T1, typename T2, unsigned int stridex>
+class convolver_7x7
+{
+public:
+    static void convolve(const Window &window, unsigned int num_elems_read_per_iteration, unsigned int num_elems_written_per_iteration,
+                         const ITensor *input, const ITensor *weights, ITensor *output, const PadStrideInfo &conv_info)
+    {
+        ARM_COMPUTE_UNUSED(num_elems_read_per_iteration);
+        const int          input_stride_x       = input->info()->strides_in_bytes().x();
+        const int          input_stride_y       = input->info()->strides_in_bytes().y();
+        const int          input_stride_z       = input->info()->strides_in_bytes().z();
+        const int          output_stride_y      = output->info()->strides_in_bytes().y();
+        const int          output_stride_z      = output->info()->strides_in_bytes().z();
+        const int          kernel_stride_x      = weights->info()->strides_in_bytes().x();
+        const int          kernel_stride_y      = weights->info()->strides_in_bytes().y();
+        const int          kernel_stride_z      = weights->info()->strides_in_bytes().z();
+        const int          kernel_stride_w      = weights->info()->strides_in_bytes()[3];
+        const int          output_w             = output->info()->dimension(0);
+        const int          output_h             = output->info()->dimension(1);
+        const int          num_planes_z         = window.z().end() - window.z().start();
+        const int          delta_input          = get_input_num_elems_processed<stridex>(num_elems_written_per_iteration);
+        const int          kernel_depth         = weights->info()->dimension(Window::DimZ);
+        const unsigned int conv_stride_y        = std::get<1>(conv_info.stride());
+        const unsigned int conv_pad_x           = std::get<0>(conv_info.pad());
+        const unsigned int conv_pad_y           = std::get<1>(conv_info.pad());
+        const int          fixed_point_position = input->info()->fixed_point_position();
+
+        // setup output window for the iterator
+        Window window_out = window;
+        window_out.set(Window::DimX, Window::Dimension(0, output->info()->dimension(Window::DimX), output->info()->dimension(Window::DimX)));
+        window_out.set(Window::DimY, Window::Dimension(0, output->info()->dimension(Window::DimY), output->info()->dimension(Window::DimY)));
+        window_out.set(Window::DimZ, Window::Dimension(window.z().start(), window.z().end(), num_planes_z));
+
+        // setup input window for the iterator
+        Window window_in = window;
+        // we just want execute_window_loop to iterate over the higher dimensions (>3), so we set the first 3 dimensions to 0
+        window_in.set(Window::DimX, Window::Dimension(0, 0, 0));
+        window_in.set(Window::DimY, Window::Dimension(0, 0, 0));
+        window_in.set(Window::DimZ, Window::Dimension(0, 0, 0));
+
+        Window window_k = calculate_max_window(*weights->info(), Steps(1u));
+
+        Iterator out(output, window_out);
+        Iterator in(input, window_in);
+        Iterator k(weights, window_k);
+
+        const uint8_t *k_ptr = k.ptr();
+
+        execute_window_loop(window_out, [&](const Coordinates & id)
+        {
+            const uint8_t *input_ptr = in.ptr() - conv_pad_x * input_stride_x - conv_pad_y * input_stride_y;
+            uint8_t       *out_ptr   = out.ptr();
+            int            ih        = 0;
+            int            oh        = 0;
+            for(int oz = 0; oz < num_planes_z; ++oz)
+            {
+                const int zoffset    = id.z() + oz;
+                uint8_t *p_out_base = out_ptr + oz * output_stride_z;
+                // Step 1
+                {
+                    const auto ptr_k_r0 = reinterpret_cast<const T1 *>(k_ptr + 0 * kernel_stride_z + zoffset * kernel_stride_w + 0 * kernel_stride_y + 0 * kernel_stride_x);
+                    const auto ptr_k_r1 = reinterpret_cast<const T1 *>(k_ptr + 0 * kernel_stride_z + zoffset * kernel_stride_w + 1 * kernel_stride_y + 0 * kernel_stride_x);
+                    const auto ptr_k_r2 = reinterpret_cast<const T1 *>(k_ptr + 0 * kernel_stride_z + zoffset * kernel_stride_w + 2 * kernel_stride_y + 0 * kernel_stride_x);
+                    const auto ptr_k_r3 = reinterpret_cast<const T1 *>(k_ptr + 0 * kernel_stride_z + zoffset * kernel_stride_w + 3 * kernel_stride_y + 0 * kernel_stride_x);
+                    const auto ptr_k_r4 = reinterpret_cast<const T1 *>(k_ptr + 0 * kernel_stride_z + zoffset * kernel_stride_w + 4 * kernel_stride_y + 0 * kernel_stride_x);
+                    const auto ptr_k_r5 = reinterpret_cast<const T1 *>(k_ptr + 0 * kernel_stride_z + zoffset * kernel_stride_w + 5 * kernel_stride_y + 0 * kernel_stride_x);
+                    const auto ptr_k_r6 = reinterpret_cast<const T1 *>(k_ptr + 0 * kernel_stride_z + zoffset * kernel_stride_w + 6 * kernel_stride_y + 0 * kernel_stride_x);
+                    for(ih = 0, oh = 0; oh < output_h; ++oh, ih += conv_stride_y)
+                    {
+                        auto in_0  = reinterpret_cast<const T1 *>(input_ptr + 0 * input_stride_z + (ih + 0) * input_stride_y);
+                        auto in_1  = reinterpret_cast<const T1 *>(input_ptr + 0 * input_stride_z + (ih + 1) * input_stride_y);
+                        auto in_2  = reinterpret_cast<const T1 *>(input_ptr + 0 * input_stride_z + (ih + 2) * input_stride_y);
+                        auto in_3  = reinterpret_cast<const T1 *>(input_ptr + 0 * input_stride_z + (ih + 3) * input_stride_y);
+                        auto in_4  = reinterpret_cast<const T1 *>(input_ptr + 0 * input_stride_z + (ih + 4) * input_stride_y);
+                        auto in_5  = reinterpret_cast<const T1 *>(input_ptr + 0 * input_stride_z + (ih + 5) * input_stride_y);
+                        auto in_6  = reinterpret_cast<const T1 *>(input_ptr + 0 * input_stride_z + (ih + 6) * input_stride_y);
+                        auto p_out = reinterpret_cast<T2 *>(p_out_base + oh * output_stride_y);
+                        for(int ow = 0; ow < output_w; ow += num_elems_written_per_iteration,
+                            in_0 += delta_input, in_1 += delta_input, in_2 += delta_input, in_3 += delta_input, in_4 += delta_input, in_5 += delta_input, in_6 += delta_input,
+                            p_out += num_elems_written_per_iteration)
+                        {
+                            auto vres = convolve_7x7<stridex>(in_0, in_1, in_2, in_3, in_4, in_5, in_6, ptr_k_r0, ptr_k_r1, ptr_k_r2, ptr_k_r3, ptr_k_r4, ptr_k_r5, ptr_k_r6, fixed_point_position);
+                            store_results<stridex>(p_out, vres);
+                        }
+                    }
+                }
+                // Step 2
+                for(int p = 1; p < kernel_depth; ++p)
+                {
+                    const auto ptr_k_r0 = reinterpret_cast<const T1 *>(k_ptr + p * kernel_stride_z + zoffset * kernel_stride_w + 0 * kernel_stride_y + 0 * kernel_stride_x);
+                    const auto ptr_k_r1 = reinterpret_cast<const T1 *>(k_ptr + p * kernel_stride_z + zoffset * kernel_stride_w + 1 * kernel_stride_y + 0 * kernel_stride_x);
+                    const auto ptr_k_r2 = reinterpret_cast<const T1 *>(k_ptr + p * kernel_stride_z + zoffset * kernel_stride_w + 2 * kernel_stride_y + 0 * kernel_stride_x);
+                    const auto ptr_k_r3 = reinterpret_cast<const T1 *>(k_ptr + p * kernel_stride_z + zoffset * kernel_stride_w + 3 * kernel_stride_y + 0 * kernel_stride_x);
+                    const auto ptr_k_r4 = reinterpret_cast<const T1 *>(k_ptr + p * kernel_stride_z + zoffset * kernel_stride_w + 4 * kernel_stride_y + 0 * kernel_stride_x);
+                    const auto ptr_k_r5 = reinterpret_cast<const T1 *>(k_ptr + p * kernel_stride_z + zoffset * kernel_stride_w + 5 * kernel_stride_y + 0 * kernel_stride_x);
+                    const auto ptr_k_r6 = reinterpret_cast<const T1 *>(k_ptr + p * kernel_stride_z + zoffset * kernel_stride_w + 6 * kernel_stride_y + 0 * kernel_stride_x);
+
+                    for(ih = 0, oh = 0; oh < output_h; ++oh, ih += conv_stride_y)
+                    {
+                        auto in_0  = reinterpret_cast<const T1 *>(input_ptr + p * input_stride_z + (ih + 0) * input_stride_y);
+                        auto in_1  = reinterpret_cast<const T1 *>(input_ptr + p * input_stride_z + (ih + 1) * input_stride_y);
+                        auto in_2  = reinterpret_cast<const T1 *>(input_ptr + p * input_stride_z + (ih + 2) * input_stride_y);
+                        auto in_3  = reinterpret_cast<const T1 *>(input_ptr + p * input_stride_z + (ih + 3) * input_stride_y);
+                        auto in_4  = reinterpret_cast<const T1 *>(input_ptr + p * input_stride_z + (ih + 4) * input_stride_y);
+                        auto in_5  = reinterpret_cast<const T1 *>(input_ptr + p * input_stride_z + (ih + 5) * input_stride_y);
+                        auto in_6  = reinterpret_cast<const T1 *>(input_ptr + p * input_stride_z + (ih + 6) * input_stride_y);
+                        auto p_out = reinterpret_cast<T2 *>(p_out_base + oh * output_stride_y);
+                        for(int ow = 0; ow < output_w; ow += num_elems_written_per_iteration,
+                            in_0 += delta_input, in_1 += delta_input, in_2 += delta_input, in_3 += delta_input, in_4 += delta_input, in_5 += delta_input, in_6 += delta_input,
+                            p_out += num_elems_written_per_iteration)
+                        {
+                            auto vres = convolve_7x7<stridex>(in_0, in_1, in_2, in_3, in_4, in_5, in_6, ptr_k_r0, ptr_k_r1, ptr_k_r2, ptr_k_r3, ptr_k_r4, ptr_k_r5, ptr_k_r6, fixed_point_position);
+                            accumulate_results<stridex>(p_out, vres);
+                        }
+                    }
+                }
+            }
+        },
+        in, out);
+    }
+};
+
 template <typename T1, typename T2>
 inline void convolve_1x1(const Window &window, unsigned int num_elems_read_per_iteration, unsigned int num_elems_written_per_iteration,
                          const ITensor *input, const ITensor *weights, ITensor *output, const PadStrideInfo &conv_info)
@@ -1278,11 +1755,54 @@ inline void convolve_1x1(const Window &window, unsigned int num_elems_read_per_i
     }
 }
 
+template <unsigned int channels_per_block>
+inline void convolve_1x1_unrolled_f32(const Window &window, unsigned int num_elems_read_per_iteration, unsigned int num_elems_written_per_iteration,
+                                      const ITensor *input, const ITensor *weights, ITensor *output, const PadStrideInfo &conv_info)
+{
+    const unsigned int conv_stride_x = std::get<0>(conv_info.stride());
+    switch(conv_stride_x)
+    {
+        case 1:
+            convolver_1x1_unrolled<1, channels_per_block>::convolve(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
+            break;
+        case 2:
+            convolver_1x1_unrolled<2, channels_per_block>::convolve(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
+            break;
+        case 3:
+            convolver_1x1_unrolled<3, channels_per_block>::convolve(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
+            break;
+        case 4:
+            convolver_1x1_unrolled<4, channels_per_block>::convolve(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Not implemented");
+    }
+}
+
 template <>
 inline void convolve_1x1<float, float>(const Window &window, unsigned int num_elems_read_per_iteration, unsigned int num_elems_written_per_iteration,
                                        const ITensor *input, const ITensor *weights, ITensor *output, const PadStrideInfo &conv_info)
 {
     const unsigned int conv_stride_x = std::get<0>(conv_info.stride());
+    const unsigned int kernel_depth  = weights->info()->dimension(Window::DimZ);
+    // Channel counts that are a multiple of a power of two take the shape-specialized convolver,
+    // whose channel accumulation is unrolled at compile time
+    if(!run_optim_small_tensor(input) && (kernel_depth % 4 == 0))
+    {
+        if(kernel_depth % 16 == 0)
+        {
+            convolve_1x1_unrolled_f32<16>(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
+        }
+        else if(kernel_depth % 8 == 0)
+        {
+            convolve_1x1_unrolled_f32<8>(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
+        }
+        else
+        {
+            convolve_1x1_unrolled_f32<4>(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
+        }
+        return;
+    }
     if(run_optim_small_tensor(input))
     {
         switch(conv_stride_x)
@@ -1296,6 +1816,9 @@ inline void convolve_1x1<float, float>(const Window &window, unsigned int num_el
             case 3:
                 convolver_w1x1_i8x8_f32<3>::convolve(window, input, weights, output, conv_info);
                 break;
+            case 4:
+                convolver_w1x1_i8x8_f32<4>::convolve(window, input, weights, output, conv_info);
+                break;
             default:
                 ARM_COMPUTE_ERROR("Not implemented");
         }
@@ -1313,6 +1836,9 @@ inline void convolve_1x1<float, float>(const Window &window, unsigned int num_el
             case 3:
                 convolver_1x1<float, float, 3>::convolve(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
                 break;
+            case 4:
+                convolver_1x1<float, float, 4>::convolve(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
+                break;
             default:
                 ARM_COMPUTE_ERROR("Not implemented");
         }
@@ -1340,6 +1866,30 @@ inline void convolve_3x3(const Window &window, unsigned int num_elems_read_per_i
     }
 }
 
+template <>
+inline void convolve_3x3<float, float>(const Window &window, unsigned int num_elems_read_per_iteration, unsigned int num_elems_written_per_iteration,
+                                       const ITensor *input, const ITensor *weights, ITensor *output, const PadStrideInfo &conv_info)
+{
+    const unsigned int conv_stride_x = std::get<0>(conv_info.stride());
+    switch(conv_stride_x)
+    {
+        case 1:
+            convolver_3x3<float, float, 1>::convolve(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
+            break;
+        case 2:
+            convolver_3x3<float, float, 2>::convolve(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
+            break;
+        case 3:
+            convolver_3x3<float, float, 3>::convolve(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
+            break;
+        case 4:
+            convolver_3x3<float, float, 4>::convolve(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Not implemented");
+    }
+}
+
 template <typename T1, typename T2>
 inline void convolve_5x5(const Window &window, unsigned int num_elems_read_per_iteration, unsigned int num_elems_written_per_iteration,
                          const ITensor *input, const ITensor *weights, ITensor *output, const PadStrideInfo &conv_info)
@@ -1356,16 +1906,103 @@ inline void convolve_5x5(const Window &window, unsigned int num_elems_read_per_i
         case 3:
             convolver_5x5<T1, T2, 3>::convolve(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
             break;
+        case 4:
+            convolver_5x5<T1, T2, 4>::convolve(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Not implemented");
+    }
+}
+
+template <typename T1, typename T2>
+inline void convolve_7x7(const Window &window, unsigned int num_elems_read_per_iteration, unsigned int num_elems_written_per_iteration,
+                         const ITensor *input, const ITensor *weights, ITensor *output, const PadStrideInfo &conv_info)
+{
+    const unsigned int conv_stride_x = std::get<0>(conv_info.stride());
+    switch(conv_stride_x)
+    {
+        case 1:
+            convolver_7x7<T1, T2, 1>::convolve(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
+            break;
+        case 2:
+            convolver_7x7<T1, T2, 2>::convolve(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
+            break;
+        case 3:
+            convolver_7x7<T1, T2, 3>::convolve(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
+            break;
+        case 4:
+            convolver_7x7<T1, T2, 4>::convolve(window, num_elems_read_per_iteration, num_elems_written_per_iteration, input, weights, output, conv_info);
+            break;
         default:
             ARM_COMPUTE_ERROR("Not implemented");
     }
 }
 
+inline void convolve_f32_padding_less(const Window &window, const ITensor *input, const ITensor *weights, ITensor *output, const PadStrideInfo &conv_info)
+{
+    const int stride_x    = std::get<0>(conv_info.stride());
+    const int stride_y    = std::get<1>(conv_info.stride());
+    const int pad_x       = std::get<0>(conv_info.pad());
+    const int pad_y       = std::get<1>(conv_info.pad());
+    const int kernel_size = weights->info()->dimension(0);
+
+    const int input_width  = input->info()->dimension(0);
+    const int input_height = input->info()->dimension(1);
+    const int input_depth  = input->info()->dimension(2);
+
+    const size_t input_stride_x = input->info()->strides_in_bytes()[0];
+    const size_t input_stride_y = input->info()->strides_in_bytes()[1];
+    const size_t input_stride_z = input->info()->strides_in_bytes()[2];
+    const size_t input_stride_w = input->info()->strides_in_bytes()[3];
+
+    const size_t weights_stride_x = weights->info()->strides_in_bytes()[0];
+    const size_t weights_stride_y = weights->info()->strides_in_bytes()[1];
+    const size_t weights_stride_z = weights->info()->strides_in_bytes()[2];
+    const size_t weights_stride_w = weights->info()->strides_in_bytes()[3];
+
+    const uint8_t *const input_base   = input->buffer() + input->info()->offset_first_element_in_bytes();
+    const uint8_t *const weights_base = weights->buffer() + weights->info()->offset_first_element_in_bytes();
+
+    Iterator out(output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const uint8_t *const in_plane = input_base + id[3] * input_stride_w;
+        const uint8_t *const w_plane  = weights_base + id.z() * weights_stride_w;
+
+        float acc = 0.f;
+        for(int ifm = 0; ifm < input_depth; ++ifm)
+        {
+            for(int ky = 0; ky < kernel_size; ++ky)
+            {
+                const int in_y = id.y() * stride_y - pad_y + ky;
+                if(in_y < 0 || in_y >= input_height)
+                {
+                    continue;
+                }
+                for(int kx = 0; kx < kernel_size; ++kx)
+                {
+                    const int in_x = id.x() * stride_x - pad_x + kx;
+                    if(in_x < 0 || in_x >= input_width)
+                    {
+                        continue;
+                    }
+                    const float in_val = *reinterpret_cast<const float *>(in_plane + ifm * input_stride_z + in_y * input_stride_y + in_x * input_stride_x);
+                    const float w_val  = *reinterpret_cast<const float *>(w_plane + ifm * weights_stride_z + ky * weights_stride_y + kx * weights_stride_x);
+                    acc += in_val * w_val;
+                }
+            }
+        }
+        *reinterpret_cast<float *>(out.ptr()) = acc;
+    },
+    out);
+}
+
 } // namespace
 
 NEDirectConvolutionLayerKernel::NEDirectConvolutionLayerKernel()
     : _input(nullptr), _weights(nullptr), _output(nullptr), _conv_info(), _border_size(0), _kernel_size(0), _num_weight_elems_read_per_row(0), _num_elems_read_per_iteration(0),
-      _num_elems_written_per_iteration(0)
+      _num_elems_written_per_iteration(0), _padding_less(false)
 {
 }
 
@@ -1384,8 +2021,11 @@ void NEDirectConvolutionLayerKernel::configure(const ITensor *input, const ITens
                              "Pad > 1 not supported for 3x3 weights");
     ARM_COMPUTE_ERROR_ON_MSG(weights->info()->dimension(0) == 5 && (std::get<0>(conv_info.pad()) > 2 || std::get<1>(conv_info.pad()) > 2),
                              "Pad > 2 not supported for 5x5 weights");
+    ARM_COMPUTE_ERROR_ON_MSG(weights->info()->dimension(0) == 7 && (std::get<0>(conv_info.pad()) > 3 || std::get<1>(conv_info.pad()) > 3),
+                             "Pad > 3 not supported for 7x7 weights");
 
-    ARM_COMPUTE_ERROR_ON_MSG(std::get<0>(conv_info.stride()) > 3, "Strides larger than 3 not supported.");
+    ARM_COMPUTE_ERROR_ON_MSG(std::get<0>(conv_info.stride()) > 4, "Strides larger than 4 not supported.");
+    ARM_COMPUTE_ERROR_ON_MSG(std::get<0>(conv_info.stride()) == 4 && input->info()->data_type() != DataType::F32, "Stride 4 only supported for F32");
     ARM_COMPUTE_ERROR_ON(weights->info()->dimension(2) != input->info()->dimension(2));
     ARM_COMPUTE_ERROR_ON(weights->info()->dimension(0) != weights->info()->dimension(1));
     ARM_COMPUTE_ERROR_ON(weights->info()->num_dimensions() > 4);
@@ -1427,6 +2067,21 @@ void NEDirectConvolutionLayerKernel::configure(const ITensor *input, const ITens
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DIMENSIONS(output->info()->tensor_shape(), output_shape);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, output->info()->data_type());
 
+    // Tensors whose layout is already fixed without a border (e.g. imported camera buffers)
+    // cannot carry the zero-filled region the vector kernels rely on: fall back to a scalar
+    // kernel that skips the out-of-bounds contributions itself
+    if(padding_less_execution_required({ input->info(), weights->info(), output->info() }))
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(input->info()->data_type() != DataType::F32, "Padding-less execution is only supported for F32");
+        _padding_less = true;
+        _border_size  = BorderSize(0);
+
+        Window win = calculate_max_window(*output->info(), Steps());
+        output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+        INEKernel::configure(win);
+        return;
+    }
+
     switch(_kernel_size)
     {
         case 1:
@@ -1460,23 +2115,32 @@ void NEDirectConvolutionLayerKernel::configure(const ITensor *input, const ITens
         }
         case 3:
         case 5:
+        case 7:
         {
             switch(input->info()->data_type())
             {
                 case DataType::F32:
-                    _num_weight_elems_read_per_row   = 4 + _kernel_size - 1;
-                    _num_elems_read_per_iteration    = 12;
-                    _num_elems_written_per_iteration = 16 >> conv_stride_x;
+                    _num_weight_elems_read_per_row = 4 + _kernel_size - 1;
+                    // 8 outputs are computed per iteration; for strides 3 and 4 only 2 of them are kept
+                    _num_elems_read_per_iteration    = (_kernel_size == 7) ? 16 : 12;
+                    _num_elems_written_per_iteration = std::max(16 >> conv_stride_x, 2);
                     break;
 #ifdef ARM_COMPUTE_ENABLE_FP16
                 case DataType::F16:
 #endif /* ARM_COMPUTE_ENABLE_FP16 */
                 case DataType::QS8:
-                case DataType::QS16:
+                    ARM_COMPUTE_ERROR_ON_MSG(_kernel_size == 7, "7x7 convolution is only supported for F32");
                     _num_weight_elems_read_per_row   = 8 + _kernel_size - 1;
                     _num_elems_read_per_iteration    = 24;
                     _num_elems_written_per_iteration = 32 >> conv_stride_x;
                     break;
+                case DataType::QS16:
+                    ARM_COMPUTE_ERROR_ON_MSG(_kernel_size != 3, "QS16 direct convolution is only supported for 3x3 weights");
+                    // 8 outputs are computed per iteration from two 8-element loads
+                    _num_weight_elems_read_per_row   = 4 + _kernel_size - 1;
+                    _num_elems_read_per_iteration    = 16;
+                    _num_elems_written_per_iteration = 16 >> conv_stride_x;
+                    break;
                 default:
                     ARM_COMPUTE_ERROR("Data type not supported.");
                     break;
@@ -1515,6 +2179,13 @@ void NEDirectConvolutionLayerKernel::run(const Window &window, const ThreadInfo
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
     ARM_COMPUTE_ERROR_ON(_input->buffer() == nullptr);
 
+    // Padding-less mode: the scalar kernel handles the borders itself
+    if(_padding_less)
+    {
+        convolve_f32_padding_less(window, _input, _weights, _output, _conv_info);
+        return;
+    }
+
     const int kernel_size = _weights->info()->dimension(0);
 
     switch(kernel_size)
@@ -1550,6 +2221,9 @@ void NEDirectConvolutionLayerKernel::run(const Window &window, const ThreadInfo
                 case DataType::QS8:
                     convolve_3x3<qint8_t, qint16_t>(window, _num_elems_read_per_iteration, _num_elems_written_per_iteration, _input, _weights, _output, _conv_info);
                     break;
+                case DataType::QS16:
+                    convolve_3x3<qint16_t, qint32_t>(window, _num_elems_read_per_iteration, _num_elems_written_per_iteration, _input, _weights, _output, _conv_info);
+                    break;
                 case DataType::F32:
                     convolve_3x3<float, float>(window, _num_elems_read_per_iteration, _num_elems_written_per_iteration, _input, _weights, _output, _conv_info);
                     break;
@@ -1577,10 +2251,23 @@ void NEDirectConvolutionLayerKernel::run(const Window &window, const ThreadInfo
             }
             break;
         }
+        case 7:
+        {
+            switch(_input->info()->data_type())
+            {
+                case DataType::F32:
+                    convolve_7x7<float, float>(window, _num_elems_read_per_iteration, _num_elems_written_per_iteration, _input, _weights, _output, _conv_info);
+                    break;
+                default:
+                    ARM_COMPUTE_ERROR("Data type not supported");
+                    break;
+            }
+            break;
+        }
 
         default:
         {
-            ARM_COMPUTE_ERROR("Only kernel sizes 1x1, 3x3 and 5x5 are supported.");
+            ARM_COMPUTE_ERROR("Only kernel sizes 1x1, 3x3, 5x5 and 7x7 are supported.");
             break;
         }
     }
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEElementwiseOpGraphKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+
+#include <arm_neon.h>
+#include <array>
+#include <cstdint>
+
+using namespace arm_compute;
+
+constexpr unsigned int NEElementwiseOpGraphKernel::max_nodes;
+
+NEElementwiseOpGraphKernel::NEElementwiseOpGraphKernel()
+    : _nodes(), _outputs()
+{
+}
+
+NEElementwiseOpGraphKernel::NodeId NEElementwiseOpGraphKernel::add_node(const Node &node)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_nodes.size() >= max_nodes, "Too many nodes in the element-wise op graph");
+
+    _nodes.push_back(node);
+
+    return _nodes.size() - 1;
+}
+
+NEElementwiseOpGraphKernel::NodeId NEElementwiseOpGraphKernel::add_input(const ITensor *input)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+
+    if(!_nodes.empty())
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(_nodes.front().tensor, input);
+    }
+
+    return add_node(Node{ NodeOp::INPUT, 0, 0, input, 0, 0, 0, 0 });
+}
+
+NEElementwiseOpGraphKernel::NodeId NEElementwiseOpGraphKernel::add_threshold(NodeId src, uint8_t threshold, uint8_t false_value, uint8_t true_value, ThresholdType type, uint8_t upper)
+{
+    ARM_COMPUTE_ERROR_ON(src >= _nodes.size());
+    ARM_COMPUTE_ERROR_ON(type != ThresholdType::BINARY && type != ThresholdType::RANGE);
+
+    const NodeOp op = (type == ThresholdType::BINARY) ? NodeOp::THRESHOLD_BINARY : NodeOp::THRESHOLD_RANGE;
+
+    return add_node(Node{ op, src, 0, nullptr, threshold, false_value, true_value, upper });
+}
+
+NEElementwiseOpGraphKernel::NodeId NEElementwiseOpGraphKernel::add_and(NodeId src0, NodeId src1)
+{
+    ARM_COMPUTE_ERROR_ON(src0 >= _nodes.size() || src1 >= _nodes.size());
+
+    return add_node(Node{ NodeOp::AND, src0, src1, nullptr, 0, 0, 0, 0 });
+}
+
+NEElementwiseOpGraphKernel::NodeId NEElementwiseOpGraphKernel::add_or(NodeId src0, NodeId src1)
+{
+    ARM_COMPUTE_ERROR_ON(src0 >= _nodes.size() || src1 >= _nodes.size());
+
+    return add_node(Node{ NodeOp::OR, src0, src1, nullptr, 0, 0, 0, 0 });
+}
+
+NEElementwiseOpGraphKernel::NodeId NEElementwiseOpGraphKernel::add_xor(NodeId src0, NodeId src1)
+{
+    ARM_COMPUTE_ERROR_ON(src0 >= _nodes.size() || src1 >= _nodes.size());
+
+    return add_node(Node{ NodeOp::XOR, src0, src1, nullptr, 0, 0, 0, 0 });
+}
+
+NEElementwiseOpGraphKernel::NodeId NEElementwiseOpGraphKernel::add_not(NodeId src)
+{
+    ARM_COMPUTE_ERROR_ON(src >= _nodes.size());
+
+    return add_node(Node{ NodeOp::NOT, src, 0, nullptr, 0, 0, 0, 0 });
+}
+
+void NEElementwiseOpGraphKernel::add_output(NodeId node, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON(node >= _nodes.size());
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(_nodes.front().tensor, output);
+
+    _outputs.push_back(OutputBinding{ node, output });
+}
+
+void NEElementwiseOpGraphKernel::configure()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_nodes.empty() || _nodes.front().op != NodeOp::INPUT, "The element-wise op graph needs at least one input");
+    ARM_COMPUTE_ERROR_ON_MSG(_outputs.empty(), "The element-wise op graph needs at least one output");
+
+    constexpr unsigned int num_elems_processed_per_iteration = 16;
+
+    Window win = calculate_max_window(*_nodes.front().tensor->info(), Steps(num_elems_processed_per_iteration));
+
+    // The sets of inputs and outputs are only known at runtime, so the variadic
+    // update_window_and_padding() is unrolled by hand: first adjust the window against every
+    // access, then grow the paddings against the final window
+    std::vector<AccessWindowHorizontal> accesses;
+    ValidRegion                         valid_region;
+
+    for(auto &node : _nodes)
+    {
+        if(node.op == NodeOp::INPUT)
+        {
+            accesses.emplace_back(node.tensor->info(), 0, num_elems_processed_per_iteration);
+            valid_region = (accesses.size() == 1) ? node.tensor->info()->valid_region() : intersect_valid_regions(valid_region, node.tensor->info()->valid_region());
+        }
+    }
+
+    const size_t num_input_accesses = accesses.size();
+
+    for(auto &output : _outputs)
+    {
+        accesses.emplace_back(output.tensor->info(), 0, num_elems_processed_per_iteration);
+    }
+
+    for(auto &access : accesses)
+    {
+        access.update_window_if_needed(win);
+    }
+
+    for(auto &access : accesses)
+    {
+        access.update_padding_if_needed(win);
+    }
+
+    for(size_t i = num_input_accesses; i < accesses.size(); ++i)
+    {
+        accesses[i].set_valid_region(win, valid_region);
+    }
+
+    INEKernel::configure(win);
+}
+
+void NEElementwiseOpGraphKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int window_start_x = window.x().start();
+    const int window_end_x   = window.x().end();
+
+    // The numbers of inputs and outputs are only known at runtime, so instead of one Iterator
+    // per tensor the row base pointers are resolved per row and the x offset applied by hand
+    Window win_1d(window);
+    win_1d.set(Window::DimX, Window::Dimension(0, 0, 0));
+
+    std::array<const uint8_t *, max_nodes> in_rows{ {} };
+    std::vector<uint8_t *> out_rows(_outputs.size());
+
+    execute_window_loop(win_1d, [&](const Coordinates & id)
+    {
+        for(size_t i = 0; i < _nodes.size(); ++i)
+        {
+            if(_nodes[i].op == NodeOp::INPUT)
+            {
+                in_rows[i] = _nodes[i].tensor->ptr_to_element(id);
+            }
+        }
+
+        for(size_t i = 0; i < _outputs.size(); ++i)
+        {
+            out_rows[i] = _outputs[i].tensor->ptr_to_element(id);
+        }
+
+        for(int x = window_start_x; x < window_end_x; x += 16)
+        {
+            std::array<uint8x16_t, max_nodes> vals;
+
+            for(size_t i = 0; i < _nodes.size(); ++i)
+            {
+                const Node &node = _nodes[i];
+
+                switch(node.op)
+                {
+                    case NodeOp::INPUT:
+                        vals[i] = vld1q_u8(in_rows[i] + x);
+                        break;
+                    case NodeOp::THRESHOLD_BINARY:
+                    {
+                        const uint8x16_t mask = vcgtq_u8(vals[node.src0], vdupq_n_u8(node.threshold));
+                        vals[i]               = vbslq_u8(mask, vdupq_n_u8(node.true_value), vdupq_n_u8(node.false_value));
+                        break;
+                    }
+                    case NodeOp::THRESHOLD_RANGE:
+                    {
+                        uint8x16_t mask = vcleq_u8(vals[node.src0], vdupq_n_u8(node.upper));
+                        mask            = vandq_u8(vcgeq_u8(vals[node.src0], vdupq_n_u8(node.threshold)), mask);
+                        vals[i]         = vbslq_u8(mask, vdupq_n_u8(node.true_value), vdupq_n_u8(node.false_value));
+                        break;
+                    }
+                    case NodeOp::AND:
+                        vals[i] = vandq_u8(vals[node.src0], vals[node.src1]);
+                        break;
+                    case NodeOp::OR:
+                        vals[i] = vorrq_u8(vals[node.src0], vals[node.src1]);
+                        break;
+                    case NodeOp::XOR:
+                        vals[i] = veorq_u8(vals[node.src0], vals[node.src1]);
+                        break;
+                    case NodeOp::NOT:
+                        vals[i] = vmvnq_u8(vals[node.src0]);
+                        break;
+                    default:
+                        ARM_COMPUTE_ERROR("Operation not supported in the element-wise op graph");
+                        break;
+                }
+            }
+
+            for(size_t i = 0; i < _outputs.size(); ++i)
+            {
+                vst1q_u8(out_rows[i] + x, vals[_outputs[i].node]);
+            }
+        }
+    });
+}
@@ -57,11 +57,6 @@ void NEFillArrayKernel::configure(const IImage *input, uint8_t threshold, IKeyPo
     INEKernel::configure(win);
 }
 
-bool NEFillArrayKernel::is_parallelisable() const
-{
-    return false;
-}
-
 void NEFillArrayKernel::run(const Window &window, const ThreadInfo &info)
 {
     ARM_COMPUTE_UNUSED(info);
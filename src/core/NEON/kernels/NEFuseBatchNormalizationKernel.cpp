@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEFuseBatchNormalizationKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <cmath>
+
+using namespace arm_compute;
+
+NEFuseBatchNormalizationKernel::NEFuseBatchNormalizationKernel()
+    : _weights(nullptr), _bias(nullptr), _fused_weights(nullptr), _fused_bias(nullptr), _mean(nullptr), _var(nullptr), _beta(nullptr), _gamma(nullptr), _scale(nullptr), _shift(nullptr), _epsilon(0.f)
+{
+}
+
+void NEFuseBatchNormalizationKernel::configure(const ITensor *weights, const ITensor *bias, ITensor *fused_weights, ITensor *fused_bias,
+                                               const ITensor *mean, const ITensor *var, const ITensor *beta, const ITensor *gamma, float epsilon)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(weights, fused_weights, fused_bias, mean, var);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(weights, mean, var);
+    ARM_COMPUTE_ERROR_ON(weights->info()->num_dimensions() > 4);
+    ARM_COMPUTE_ERROR_ON(mean->info()->dimension(0) != weights->info()->dimension(3));
+    ARM_COMPUTE_ERROR_ON(var->info()->dimension(0) != weights->info()->dimension(3));
+    if(bias != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(weights, bias);
+        ARM_COMPUTE_ERROR_ON(bias->info()->dimension(0) != weights->info()->dimension(3));
+    }
+    if(beta != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(weights, beta);
+        ARM_COMPUTE_ERROR_ON(beta->info()->dimension(0) != weights->info()->dimension(3));
+    }
+    if(gamma != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(weights, gamma);
+        ARM_COMPUTE_ERROR_ON(gamma->info()->dimension(0) != weights->info()->dimension(3));
+    }
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*fused_weights->info(), weights->info()->tensor_shape(), 1, weights->info()->data_type(), weights->info()->fixed_point_position());
+    auto_init_if_empty(*fused_bias->info(), mean->info()->tensor_shape(), 1, mean->info()->data_type(), mean->info()->fixed_point_position());
+
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(weights, fused_weights, fused_bias);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(weights, fused_weights);
+    ARM_COMPUTE_ERROR_ON(fused_bias->info()->dimension(0) != weights->info()->dimension(3));
+
+    _weights       = weights;
+    _bias          = bias;
+    _fused_weights = fused_weights;
+    _fused_bias    = fused_bias;
+    _mean          = mean;
+    _var           = var;
+    _beta          = beta;
+    _gamma         = gamma;
+    _epsilon       = epsilon;
+
+    // Configure kernel window. The kernel copies single elements, no padding is needed
+    Window win = calculate_max_window(*weights->info());
+
+    fused_weights->info()->set_valid_region(ValidRegion(Coordinates(), fused_weights->info()->tensor_shape()));
+    fused_bias->info()->set_valid_region(ValidRegion(Coordinates(), fused_bias->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEFuseBatchNormalizationKernel::configure(const ITensor *weights, const ITensor *bias, ITensor *fused_weights, ITensor *fused_bias,
+                                               const ITensor *scale, const ITensor *shift)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(weights, fused_weights, fused_bias, scale, shift);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(weights, scale, shift);
+    ARM_COMPUTE_ERROR_ON(weights->info()->num_dimensions() > 4);
+    ARM_COMPUTE_ERROR_ON(scale->info()->dimension(0) != weights->info()->dimension(3));
+    ARM_COMPUTE_ERROR_ON(shift->info()->dimension(0) != weights->info()->dimension(3));
+    if(bias != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(weights, bias);
+        ARM_COMPUTE_ERROR_ON(bias->info()->dimension(0) != weights->info()->dimension(3));
+    }
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*fused_weights->info(), weights->info()->tensor_shape(), 1, weights->info()->data_type(), weights->info()->fixed_point_position());
+    auto_init_if_empty(*fused_bias->info(), scale->info()->tensor_shape(), 1, scale->info()->data_type(), scale->info()->fixed_point_position());
+
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(weights, fused_weights, fused_bias);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(weights, fused_weights);
+    ARM_COMPUTE_ERROR_ON(fused_bias->info()->dimension(0) != weights->info()->dimension(3));
+
+    _weights       = weights;
+    _bias          = bias;
+    _fused_weights = fused_weights;
+    _fused_bias    = fused_bias;
+    _scale         = scale;
+    _shift         = shift;
+
+    // Configure kernel window. The kernel copies single elements, no padding is needed
+    Window win = calculate_max_window(*weights->info());
+
+    fused_weights->info()->set_valid_region(ValidRegion(Coordinates(), fused_weights->info()->tensor_shape()));
+    fused_bias->info()->set_valid_region(ValidRegion(Coordinates(), fused_bias->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEFuseBatchNormalizationKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const bool is_folded = (_scale != nullptr);
+
+    Iterator weights(_weights, window);
+    Iterator fused_weights(_fused_weights, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int ofm   = id[3];
+        float     scale = 0.f;
+
+        if(is_folded)
+        {
+            scale = *reinterpret_cast<const float *>(_scale->ptr_to_element(Coordinates(ofm)));
+        }
+        else
+        {
+            const float var_val   = *reinterpret_cast<const float *>(_var->ptr_to_element(Coordinates(ofm)));
+            const float gamma_val = (_gamma != nullptr) ? *reinterpret_cast<const float *>(_gamma->ptr_to_element(Coordinates(ofm))) : 1.f;
+            scale                 = gamma_val / std::sqrt(var_val + _epsilon);
+        }
+
+        *reinterpret_cast<float *>(fused_weights.ptr()) = *reinterpret_cast<const float *>(weights.ptr()) * scale;
+
+        // The fused bias only has to be computed once per output feature map
+        if(id.x() == 0 && id.y() == 0 && id.z() == 0)
+        {
+            const float bias_val = (_bias != nullptr) ? *reinterpret_cast<const float *>(_bias->ptr_to_element(Coordinates(ofm))) : 0.f;
+
+            if(is_folded)
+            {
+                const float shift_val = *reinterpret_cast<const float *>(_shift->ptr_to_element(Coordinates(ofm)));
+
+                *reinterpret_cast<float *>(_fused_bias->ptr_to_element(Coordinates(ofm))) = bias_val * scale + shift_val;
+            }
+            else
+            {
+                const float mean_val = *reinterpret_cast<const float *>(_mean->ptr_to_element(Coordinates(ofm)));
+                const float beta_val = (_beta != nullptr) ? *reinterpret_cast<const float *>(_beta->ptr_to_element(Coordinates(ofm))) : 0.f;
+
+                *reinterpret_cast<float *>(_fused_bias->ptr_to_element(Coordinates(ofm))) = (bias_val - mean_val) * scale + beta_val;
+            }
+        }
+    },
+    weights, fused_weights);
+}
@@ -45,16 +45,16 @@ class Coordinates;
 } // namespace arm_compute
 
 NEGEMMLowpMatrixMultiplyKernel::NEGEMMLowpMatrixMultiplyKernel()
-    : _input0(nullptr), _input1(nullptr), _output(nullptr), _a_offset(0), _b_offset(0), _output_offset(0), _output_mult_int(0), _shift(0)
+    : _input0(nullptr), _input1(nullptr), _output(nullptr), _a_offset(0), _b_offset(0), _output_offset(0), _output_mult_int(0), _shift(0), _output_multipliers(), _output_shifts()
 {
 }
 
 void NEGEMMLowpMatrixMultiplyKernel::configure(const ITensor *input0, const ITensor *input1, ITensor *output,
                                                int32_t a_offset, int32_t b_offset, int32_t output_offset, int32_t output_mult_int, int32_t shift)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input0, 1, DataType::U8);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input1, 1, DataType::U8);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input0, 1, DataType::U8, DataType::QASYMM8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input1, 1, DataType::U8, DataType::QASYMM8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::QASYMM8);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, input1, output);
 
     _input0          = input0;
@@ -81,6 +81,25 @@ void NEGEMMLowpMatrixMultiplyKernel::configure(const ITensor *input0, const ITen
     INEKernel::configure(win);
 }
 
+void NEGEMMLowpMatrixMultiplyKernel::configure(const ITensor *input0, const ITensor *input1, ITensor *output, int32_t a_offset, int32_t b_offset, int32_t output_offset,
+                                               const std::vector<int32_t> &output_multipliers, const std::vector<int32_t> &output_shifts)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(output);
+    ARM_COMPUTE_ERROR_ON(output_multipliers.size() != output->info()->dimension(0));
+    ARM_COMPUTE_ERROR_ON(output_shifts.size() != output->info()->dimension(0));
+
+    configure(input0, input1, output, a_offset, b_offset, output_offset, 0, 0);
+
+    // Pad the per-column parameters to the padded window width so the epilogue can load whole
+    // vectors; the replicated tail lanes only feed padded output elements
+    const size_t padded_width = ceil_to_multiple(output->info()->dimension(0), 16);
+
+    _output_multipliers = output_multipliers;
+    _output_multipliers.resize(padded_width, output_multipliers.back());
+    _output_shifts = output_shifts;
+    _output_shifts.resize(padded_width, output_shifts.back());
+}
+
 void NEGEMMLowpMatrixMultiplyKernel::run(const Window &window, const ThreadInfo &info)
 {
     ARM_COMPUTE_UNUSED(info);
@@ -109,12 +128,17 @@ void NEGEMMLowpMatrixMultiplyKernel::run(const Window &window, const ThreadInfo
     const int32x4_t voffset_b = vdupq_n_s32(_b_offset);
     const int32x4_t vshiftr   = vdupq_n_s32(-_shift);
 
+    // In per-channel mode the accumulators start at zero and the output offset is added after
+    // scaling, as it is expressed in output units rather than accumulator units
+    const bool      per_channel = !_output_multipliers.empty();
+    const int32x4_t vacc_init   = vdupq_n_s32(per_channel ? 0 : _output_offset);
+
     const int width_b = _input1->info()->dimension(0);
 
     // The implementation assumes that the matrix A and Matrix B have been reshaped respectively with NEGEMMInterleave4x4 and NEGEMMTranspose1xW
     // The reshaping of the matrices helps to have a cache friendly implementation and helps to avoid the data re-arrangements needed for computing 16x4 elements per iteration
     // All the values needed for computing a single 4x4 block will be read from consecutive memory positions
-    execute_window_loop(window, [&](const Coordinates &)
+    execute_window_loop(window, [&](const Coordinates & id)
     {
         const uint8_t *mtx_a0 = ina.ptr();
         const uint8_t *mtx_b0 = inb.ptr();
@@ -123,10 +147,10 @@ void NEGEMMLowpMatrixMultiplyKernel::run(const Window &window, const ThreadInfo
         int32x4x4_t c0 =
         {
             {
-                vdupq_n_s32(_output_offset),
-                vdupq_n_s32(_output_offset),
-                vdupq_n_s32(_output_offset),
-                vdupq_n_s32(_output_offset)
+                vacc_init,
+                vacc_init,
+                vacc_init,
+                vacc_init
             }
         };
 
@@ -134,10 +158,10 @@ void NEGEMMLowpMatrixMultiplyKernel::run(const Window &window, const ThreadInfo
         int32x4x4_t c1 =
         {
             {
-                vdupq_n_s32(_output_offset),
-                vdupq_n_s32(_output_offset),
-                vdupq_n_s32(_output_offset),
-                vdupq_n_s32(_output_offset)
+                vacc_init,
+                vacc_init,
+                vacc_init,
+                vacc_init
             }
         };
 
@@ -145,10 +169,10 @@ void NEGEMMLowpMatrixMultiplyKernel::run(const Window &window, const ThreadInfo
         int32x4x4_t c2 =
         {
             {
-                vdupq_n_s32(_output_offset),
-                vdupq_n_s32(_output_offset),
-                vdupq_n_s32(_output_offset),
-                vdupq_n_s32(_output_offset)
+                vacc_init,
+                vacc_init,
+                vacc_init,
+                vacc_init
             }
         };
 
@@ -156,10 +180,10 @@ void NEGEMMLowpMatrixMultiplyKernel::run(const Window &window, const ThreadInfo
         int32x4x4_t c3 =
         {
             {
-                vdupq_n_s32(_output_offset),
-                vdupq_n_s32(_output_offset),
-                vdupq_n_s32(_output_offset),
-                vdupq_n_s32(_output_offset)
+                vacc_init,
+                vacc_init,
+                vacc_init,
+                vacc_init
             }
         };
 
@@ -380,25 +404,73 @@ void NEGEMMLowpMatrixMultiplyKernel::run(const Window &window, const ThreadInfo
             c3.val[3] = vmlaq_lane_s32(c3.val[3], ib0.val[3], ia.val[1], 1);
         }
 
-        c0.val[0] = vshlq_s32(vmulq_n_s32(c0.val[0], _output_mult_int), vshiftr);
-        c0.val[1] = vshlq_s32(vmulq_n_s32(c0.val[1], _output_mult_int), vshiftr);
-        c0.val[2] = vshlq_s32(vmulq_n_s32(c0.val[2], _output_mult_int), vshiftr);
-        c0.val[3] = vshlq_s32(vmulq_n_s32(c0.val[3], _output_mult_int), vshiftr);
-
-        c1.val[0] = vshlq_s32(vmulq_n_s32(c1.val[0], _output_mult_int), vshiftr);
-        c1.val[1] = vshlq_s32(vmulq_n_s32(c1.val[1], _output_mult_int), vshiftr);
-        c1.val[2] = vshlq_s32(vmulq_n_s32(c1.val[2], _output_mult_int), vshiftr);
-        c1.val[3] = vshlq_s32(vmulq_n_s32(c1.val[3], _output_mult_int), vshiftr);
-
-        c2.val[0] = vshlq_s32(vmulq_n_s32(c2.val[0], _output_mult_int), vshiftr);
-        c2.val[1] = vshlq_s32(vmulq_n_s32(c2.val[1], _output_mult_int), vshiftr);
-        c2.val[2] = vshlq_s32(vmulq_n_s32(c2.val[2], _output_mult_int), vshiftr);
-        c2.val[3] = vshlq_s32(vmulq_n_s32(c2.val[3], _output_mult_int), vshiftr);
-
-        c3.val[0] = vshlq_s32(vmulq_n_s32(c3.val[0], _output_mult_int), vshiftr);
-        c3.val[1] = vshlq_s32(vmulq_n_s32(c3.val[1], _output_mult_int), vshiftr);
-        c3.val[2] = vshlq_s32(vmulq_n_s32(c3.val[2], _output_mult_int), vshiftr);
-        c3.val[3] = vshlq_s32(vmulq_n_s32(c3.val[3], _output_mult_int), vshiftr);
+        if(!per_channel)
+        {
+            c0.val[0] = vshlq_s32(vmulq_n_s32(c0.val[0], _output_mult_int), vshiftr);
+            c0.val[1] = vshlq_s32(vmulq_n_s32(c0.val[1], _output_mult_int), vshiftr);
+            c0.val[2] = vshlq_s32(vmulq_n_s32(c0.val[2], _output_mult_int), vshiftr);
+            c0.val[3] = vshlq_s32(vmulq_n_s32(c0.val[3], _output_mult_int), vshiftr);
+
+            c1.val[0] = vshlq_s32(vmulq_n_s32(c1.val[0], _output_mult_int), vshiftr);
+            c1.val[1] = vshlq_s32(vmulq_n_s32(c1.val[1], _output_mult_int), vshiftr);
+            c1.val[2] = vshlq_s32(vmulq_n_s32(c1.val[2], _output_mult_int), vshiftr);
+            c1.val[3] = vshlq_s32(vmulq_n_s32(c1.val[3], _output_mult_int), vshiftr);
+
+            c2.val[0] = vshlq_s32(vmulq_n_s32(c2.val[0], _output_mult_int), vshiftr);
+            c2.val[1] = vshlq_s32(vmulq_n_s32(c2.val[1], _output_mult_int), vshiftr);
+            c2.val[2] = vshlq_s32(vmulq_n_s32(c2.val[2], _output_mult_int), vshiftr);
+            c2.val[3] = vshlq_s32(vmulq_n_s32(c2.val[3], _output_mult_int), vshiftr);
+
+            c3.val[0] = vshlq_s32(vmulq_n_s32(c3.val[0], _output_mult_int), vshiftr);
+            c3.val[1] = vshlq_s32(vmulq_n_s32(c3.val[1], _output_mult_int), vshiftr);
+            c3.val[2] = vshlq_s32(vmulq_n_s32(c3.val[2], _output_mult_int), vshiftr);
+            c3.val[3] = vshlq_s32(vmulq_n_s32(c3.val[3], _output_mult_int), vshiftr);
+        }
+        else
+        {
+            // Per-channel requantization: every block of 4 columns is scaled by its own Q31
+            // multiplier with a saturating rounding-doubling high multiply, rounding-shifted by
+            // its own exponent, then shifted into the output quantization space
+            const int32x4x4_t vmult =
+            {
+                {
+                    vld1q_s32(_output_multipliers.data() + id.x() + 0),
+                    vld1q_s32(_output_multipliers.data() + id.x() + 4),
+                    vld1q_s32(_output_multipliers.data() + id.x() + 8),
+                    vld1q_s32(_output_multipliers.data() + id.x() + 12)
+                }
+            };
+            const int32x4x4_t vshift =
+            {
+                {
+                    vld1q_s32(_output_shifts.data() + id.x() + 0),
+                    vld1q_s32(_output_shifts.data() + id.x() + 4),
+                    vld1q_s32(_output_shifts.data() + id.x() + 8),
+                    vld1q_s32(_output_shifts.data() + id.x() + 12)
+                }
+            };
+            const int32x4_t voffset_out = vdupq_n_s32(_output_offset);
+
+            c0.val[0] = vaddq_s32(vrshlq_s32(vqrdmulhq_s32(c0.val[0], vmult.val[0]), vshift.val[0]), voffset_out);
+            c0.val[1] = vaddq_s32(vrshlq_s32(vqrdmulhq_s32(c0.val[1], vmult.val[0]), vshift.val[0]), voffset_out);
+            c0.val[2] = vaddq_s32(vrshlq_s32(vqrdmulhq_s32(c0.val[2], vmult.val[0]), vshift.val[0]), voffset_out);
+            c0.val[3] = vaddq_s32(vrshlq_s32(vqrdmulhq_s32(c0.val[3], vmult.val[0]), vshift.val[0]), voffset_out);
+
+            c1.val[0] = vaddq_s32(vrshlq_s32(vqrdmulhq_s32(c1.val[0], vmult.val[1]), vshift.val[1]), voffset_out);
+            c1.val[1] = vaddq_s32(vrshlq_s32(vqrdmulhq_s32(c1.val[1], vmult.val[1]), vshift.val[1]), voffset_out);
+            c1.val[2] = vaddq_s32(vrshlq_s32(vqrdmulhq_s32(c1.val[2], vmult.val[1]), vshift.val[1]), voffset_out);
+            c1.val[3] = vaddq_s32(vrshlq_s32(vqrdmulhq_s32(c1.val[3], vmult.val[1]), vshift.val[1]), voffset_out);
+
+            c2.val[0] = vaddq_s32(vrshlq_s32(vqrdmulhq_s32(c2.val[0], vmult.val[2]), vshift.val[2]), voffset_out);
+            c2.val[1] = vaddq_s32(vrshlq_s32(vqrdmulhq_s32(c2.val[1], vmult.val[2]), vshift.val[2]), voffset_out);
+            c2.val[2] = vaddq_s32(vrshlq_s32(vqrdmulhq_s32(c2.val[2], vmult.val[2]), vshift.val[2]), voffset_out);
+            c2.val[3] = vaddq_s32(vrshlq_s32(vqrdmulhq_s32(c2.val[3], vmult.val[2]), vshift.val[2]), voffset_out);
+
+            c3.val[0] = vaddq_s32(vrshlq_s32(vqrdmulhq_s32(c3.val[0], vmult.val[3]), vshift.val[3]), voffset_out);
+            c3.val[1] = vaddq_s32(vrshlq_s32(vqrdmulhq_s32(c3.val[1], vmult.val[3]), vshift.val[3]), voffset_out);
+            c3.val[2] = vaddq_s32(vrshlq_s32(vqrdmulhq_s32(c3.val[2], vmult.val[3]), vshift.val[3]), voffset_out);
+            c3.val[3] = vaddq_s32(vrshlq_s32(vqrdmulhq_s32(c3.val[3], vmult.val[3]), vshift.val[3]), voffset_out);
+        }
 
         const uint8x16x4_t r =
         {
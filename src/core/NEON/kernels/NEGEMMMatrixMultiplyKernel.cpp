@@ -35,6 +35,7 @@
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
+#include "support/ToolchainSupport.h"
 
 #include <arm_neon.h>
 #include <cstddef>
@@ -50,6 +51,39 @@ class Coordinates;
 
 namespace
 {
+// Alignment of the per-thread panel buffers carved out of the packing workspace
+constexpr size_t workspace_alignment = 4096;
+
+// Epilogue fused into the output store of the F32 paths
+struct EpilogueF32
+{
+    const ITensor      *biases;
+    const ITensor      *matrix_c;
+    float               beta;
+    ActivationLayerInfo act_info;
+};
+
+// Clamp the four accumulators of a 16-wide strip according to the fused activation
+inline void apply_activation_f32(float32x4_t &acc0, float32x4_t &acc1, float32x4_t &acc2, float32x4_t &acc3, const ActivationLayerInfo &act_info)
+{
+    const float32x4_t lower = vdupq_n_f32(act_info.activation() == ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU ? act_info.b() : 0.f);
+
+    acc0 = vmaxq_f32(acc0, lower);
+    acc1 = vmaxq_f32(acc1, lower);
+    acc2 = vmaxq_f32(acc2, lower);
+    acc3 = vmaxq_f32(acc3, lower);
+
+    if(act_info.activation() != ActivationLayerInfo::ActivationFunction::RELU)
+    {
+        const float32x4_t upper = vdupq_n_f32(act_info.a());
+
+        acc0 = vminq_f32(acc0, upper);
+        acc1 = vminq_f32(acc1, upper);
+        acc2 = vminq_f32(acc2, upper);
+        acc3 = vminq_f32(acc3, upper);
+    }
+}
+
 template <bool multiply_alpha>
 void vector_matrix_multiply_f16(const ITensor *input0, const ITensor *input1, ITensor *output, const Window &window, const ThreadInfo &info, float alpha)
 {
@@ -198,7 +232,7 @@ void vector_matrix_multiply_f16(const ITensor *input0, const ITensor *input1, IT
 }
 
 template <bool multiply_alpha>
-void vector_matrix_multiply_f32(const ITensor *input0, const ITensor *input1, ITensor *output, const Window &window, const ThreadInfo &info, float alpha)
+void vector_matrix_multiply_f32(const ITensor *input0, const ITensor *input1, ITensor *output, const Window &window, const ThreadInfo &info, float alpha, const EpilogueF32 *epilogue = nullptr)
 {
     const auto width_matrix_b  = static_cast<int>(output->info()->dimension(0));
     const auto in_b_stride     = static_cast<int>(input1->info()->strides_in_bytes()[1] / data_size_from_type(input1->info()->data_type()));
@@ -343,6 +377,35 @@ void vector_matrix_multiply_f32(const ITensor *input0, const ITensor *input1, IT
             acc3                        = vmulq_f32(acc3, alpha_f32);
         }
 
+        if(epilogue != nullptr)
+        {
+            if(epilogue->biases != nullptr)
+            {
+                const auto bias = reinterpret_cast<const float *>(epilogue->biases->ptr_to_element(Coordinates(id.x())));
+
+                acc0 = vaddq_f32(acc0, vld1q_f32(bias + 0));
+                acc1 = vaddq_f32(acc1, vld1q_f32(bias + 4));
+                acc2 = vaddq_f32(acc2, vld1q_f32(bias + 8));
+                acc3 = vaddq_f32(acc3, vld1q_f32(bias + 12));
+            }
+
+            if(epilogue->matrix_c != nullptr)
+            {
+                const auto        vec_c    = reinterpret_cast<const float *>(epilogue->matrix_c->ptr_to_element(Coordinates(id.x())));
+                const float32x4_t beta_f32 = vdupq_n_f32(epilogue->beta);
+
+                acc0 = vmlaq_f32(acc0, vld1q_f32(vec_c + 0), beta_f32);
+                acc1 = vmlaq_f32(acc1, vld1q_f32(vec_c + 4), beta_f32);
+                acc2 = vmlaq_f32(acc2, vld1q_f32(vec_c + 8), beta_f32);
+                acc3 = vmlaq_f32(acc3, vld1q_f32(vec_c + 12), beta_f32);
+            }
+
+            if(epilogue->act_info.enabled())
+            {
+                apply_activation_f32(acc0, acc1, acc2, acc3, epilogue->act_info);
+            }
+        }
+
         const auto vec_out = reinterpret_cast<float *>(out.ptr());
 
         vst1q_f32(vec_out + 0, acc0);
@@ -610,15 +673,323 @@ void vector_matrix_multiply_qs16(const ITensor *input0, const ITensor *input1, I
     ina, inb, out);
 }
 
+/* Compute a 4x8 output block from one interleaved A panel and two transposed B blocks */
+template <bool multiply_alpha>
+void matrix_matrix_multiply_block_f32(const float *mtx_a0, const float *mtx_b0, float *mtx_out0, size_t in_b_stride, size_t out_stride1, int num_elems_matrix_b_x, float alpha,
+                                      const float *bias = nullptr, const float *mtx_c = nullptr, size_t c_stride = 0, float beta = 0.f, const ActivationLayerInfo *act_info = nullptr)
+{
+    const size_t out_stride2 = out_stride1 * 2;
+    const size_t out_stride3 = out_stride1 * 3;
+    auto         mtx_b1      = mtx_b0 + in_b_stride;
+
+    float32x4_t acc00 = vdupq_n_f32(0.f);
+    float32x4_t acc10 = vdupq_n_f32(0.f);
+    float32x4_t acc20 = vdupq_n_f32(0.f);
+    float32x4_t acc30 = vdupq_n_f32(0.f);
+
+    float32x4_t acc01 = vdupq_n_f32(0.f);
+    float32x4_t acc11 = vdupq_n_f32(0.f);
+    float32x4_t acc21 = vdupq_n_f32(0.f);
+    float32x4_t acc31 = vdupq_n_f32(0.f);
+
+#if __arm__
+    asm volatile("PLD [%0, #128*1]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_a0)));
+    asm volatile("PLD [%0, #128*1]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_b0)));
+    asm volatile("PLD [%0, #128*1]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_b1)));
+#endif /* __arm__ */
+
+    auto mtx_b0_end_addr = mtx_b0 + num_elems_matrix_b_x;
+    for(; mtx_b0 <= (mtx_b0_end_addr - 32);)
+    {
+        float32x4_t a0 = vld1q_dup_f32(mtx_a0 + 0);
+        float32x4_t a1 = vld1q_dup_f32(mtx_a0 + 1);
+        float32x4_t a2 = vld1q_dup_f32(mtx_a0 + 2);
+        float32x4_t a3 = vld1q_dup_f32(mtx_a0 + 3);
+
+        float32x4_t b00 = vld1q_f32(mtx_b0);
+        float32x4_t b10 = vld1q_f32(mtx_b1);
+        float32x4_t b01 = vld1q_f32(mtx_b0 + 4);
+        float32x4_t b11 = vld1q_f32(mtx_b1 + 4);
+
+#if __arm__
+        asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_a0)));
+        asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_b0)));
+        asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_b1)));
+#endif /* __arm__ */
+
+        // 4x4 block 0
+        acc00 = vmlaq_f32(acc00, b00, a0);
+        acc10 = vmlaq_f32(acc10, b00, a1);
+        acc20 = vmlaq_f32(acc20, b00, a2);
+        acc30 = vmlaq_f32(acc30, b00, a3);
+
+        float32x4_t a4 = vld1q_dup_f32(mtx_a0 + 4);
+        float32x4_t a5 = vld1q_dup_f32(mtx_a0 + 5);
+        float32x4_t a6 = vld1q_dup_f32(mtx_a0 + 6);
+        float32x4_t a7 = vld1q_dup_f32(mtx_a0 + 7);
+
+        // 4x4 block 1
+        acc01 = vmlaq_f32(acc01, b10, a0);
+        acc11 = vmlaq_f32(acc11, b10, a1);
+        acc21 = vmlaq_f32(acc21, b10, a2);
+        acc31 = vmlaq_f32(acc31, b10, a3);
+
+        // 4x4 block 0
+        acc00 = vmlaq_f32(acc00, b01, a4);
+        acc10 = vmlaq_f32(acc10, b01, a5);
+        acc20 = vmlaq_f32(acc20, b01, a6);
+        acc30 = vmlaq_f32(acc30, b01, a7);
+
+        // 4x4 block 1
+        acc01 = vmlaq_f32(acc01, b11, a4);
+        acc11 = vmlaq_f32(acc11, b11, a5);
+        acc21 = vmlaq_f32(acc21, b11, a6);
+        acc31 = vmlaq_f32(acc31, b11, a7);
+
+        mtx_a0 += 8;
+        mtx_b0 += 8;
+        mtx_b1 += 8;
+
+        a0 = vld1q_dup_f32(mtx_a0 + 0);
+        a1 = vld1q_dup_f32(mtx_a0 + 1);
+        a2 = vld1q_dup_f32(mtx_a0 + 2);
+        a3 = vld1q_dup_f32(mtx_a0 + 3);
+
+        b00 = vld1q_f32(mtx_b0);
+        b10 = vld1q_f32(mtx_b1);
+        b01 = vld1q_f32(mtx_b0 + 4);
+        b11 = vld1q_f32(mtx_b1 + 4);
+
+        // 4x4 block 0
+        acc00 = vmlaq_f32(acc00, b00, a0);
+        acc10 = vmlaq_f32(acc10, b00, a1);
+        acc20 = vmlaq_f32(acc20, b00, a2);
+        acc30 = vmlaq_f32(acc30, b00, a3);
+
+        a4 = vld1q_dup_f32(mtx_a0 + 4);
+        a5 = vld1q_dup_f32(mtx_a0 + 5);
+        a6 = vld1q_dup_f32(mtx_a0 + 6);
+        a7 = vld1q_dup_f32(mtx_a0 + 7);
+
+        // 4x4 block 1
+        acc01 = vmlaq_f32(acc01, b10, a0);
+        acc11 = vmlaq_f32(acc11, b10, a1);
+        acc21 = vmlaq_f32(acc21, b10, a2);
+        acc31 = vmlaq_f32(acc31, b10, a3);
+
+        // 4x4 block 0
+        acc00 = vmlaq_f32(acc00, b01, a4);
+        acc10 = vmlaq_f32(acc10, b01, a5);
+        acc20 = vmlaq_f32(acc20, b01, a6);
+        acc30 = vmlaq_f32(acc30, b01, a7);
+
+        // 4x4 block 1
+        acc01 = vmlaq_f32(acc01, b11, a4);
+        acc11 = vmlaq_f32(acc11, b11, a5);
+        acc21 = vmlaq_f32(acc21, b11, a6);
+        acc31 = vmlaq_f32(acc31, b11, a7);
+
+        mtx_a0 += 8;
+        mtx_b0 += 8;
+        mtx_b1 += 8;
+
+        a0  = vld1q_dup_f32(mtx_a0 + 0);
+        a1  = vld1q_dup_f32(mtx_a0 + 1);
+        a2  = vld1q_dup_f32(mtx_a0 + 2);
+        a3  = vld1q_dup_f32(mtx_a0 + 3);
+        b00 = vld1q_f32(mtx_b0);
+        b10 = vld1q_f32(mtx_b1);
+        b01 = vld1q_f32(mtx_b0 + 4);
+        b11 = vld1q_f32(mtx_b1 + 4);
+
+#if __arm__
+        asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_a0)));
+        asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_b0)));
+        asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_b1)));
+#endif /* __arm__ */
+
+        // 4x4 block 0
+        acc00 = vmlaq_f32(acc00, b00, a0);
+        acc10 = vmlaq_f32(acc10, b00, a1);
+        acc20 = vmlaq_f32(acc20, b00, a2);
+        acc30 = vmlaq_f32(acc30, b00, a3);
+
+        a4 = vld1q_dup_f32(mtx_a0 + 4);
+        a5 = vld1q_dup_f32(mtx_a0 + 5);
+        a6 = vld1q_dup_f32(mtx_a0 + 6);
+        a7 = vld1q_dup_f32(mtx_a0 + 7);
+
+        // 4x4 block 1
+        acc01 = vmlaq_f32(acc01, b10, a0);
+        acc11 = vmlaq_f32(acc11, b10, a1);
+        acc21 = vmlaq_f32(acc21, b10, a2);
+        acc31 = vmlaq_f32(acc31, b10, a3);
+
+        // 4x4 block 0
+        acc00 = vmlaq_f32(acc00, b01, a4);
+        acc10 = vmlaq_f32(acc10, b01, a5);
+        acc20 = vmlaq_f32(acc20, b01, a6);
+        acc30 = vmlaq_f32(acc30, b01, a7);
+
+        // 4x4 block 1
+        acc01 = vmlaq_f32(acc01, b11, a4);
+        acc11 = vmlaq_f32(acc11, b11, a5);
+        acc21 = vmlaq_f32(acc21, b11, a6);
+        acc31 = vmlaq_f32(acc31, b11, a7);
+
+        mtx_a0 += 8;
+        mtx_b0 += 8;
+        mtx_b1 += 8;
+
+        a0  = vld1q_dup_f32(mtx_a0 + 0);
+        a1  = vld1q_dup_f32(mtx_a0 + 1);
+        a2  = vld1q_dup_f32(mtx_a0 + 2);
+        a3  = vld1q_dup_f32(mtx_a0 + 3);
+        b00 = vld1q_f32(mtx_b0);
+        b10 = vld1q_f32(mtx_b1);
+        b01 = vld1q_f32(mtx_b0 + 4);
+        b11 = vld1q_f32(mtx_b1 + 4);
+
+        // 4x4 block 0
+        acc00 = vmlaq_f32(acc00, b00, a0);
+        acc10 = vmlaq_f32(acc10, b00, a1);
+        acc20 = vmlaq_f32(acc20, b00, a2);
+        acc30 = vmlaq_f32(acc30, b00, a3);
+
+        a4 = vld1q_dup_f32(mtx_a0 + 4);
+        a5 = vld1q_dup_f32(mtx_a0 + 5);
+        a6 = vld1q_dup_f32(mtx_a0 + 6);
+        a7 = vld1q_dup_f32(mtx_a0 + 7);
+
+        // 4x4 block 1
+        acc01 = vmlaq_f32(acc01, b10, a0);
+        acc11 = vmlaq_f32(acc11, b10, a1);
+        acc21 = vmlaq_f32(acc21, b10, a2);
+        acc31 = vmlaq_f32(acc31, b10, a3);
+
+        // 4x4 block 0
+        acc00 = vmlaq_f32(acc00, b01, a4);
+        acc10 = vmlaq_f32(acc10, b01, a5);
+        acc20 = vmlaq_f32(acc20, b01, a6);
+        acc30 = vmlaq_f32(acc30, b01, a7);
+
+        // 4x4 block 1
+        acc01 = vmlaq_f32(acc01, b11, a4);
+        acc11 = vmlaq_f32(acc11, b11, a5);
+        acc21 = vmlaq_f32(acc21, b11, a6);
+        acc31 = vmlaq_f32(acc31, b11, a7);
+
+        mtx_a0 += 8;
+        mtx_b0 += 8;
+        mtx_b1 += 8;
+    }
+
+    for(; mtx_b0 < mtx_b0_end_addr;)
+    {
+        float32x4_t a0  = vld1q_dup_f32(mtx_a0 + 0);
+        float32x4_t a1  = vld1q_dup_f32(mtx_a0 + 1);
+        float32x4_t a2  = vld1q_dup_f32(mtx_a0 + 2);
+        float32x4_t a3  = vld1q_dup_f32(mtx_a0 + 3);
+        float32x4_t b00 = vld1q_f32(mtx_b0);
+        float32x4_t b10 = vld1q_f32(mtx_b1);
+
+#if __arm__
+        asm volatile("PLD [%0, #128*2]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_a0)));
+        asm volatile("PLD [%0, #128*2]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_b0)));
+        asm volatile("PLD [%0, #128*2]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_b1)));
+#endif /* __arm__ */
+        // 4x4 block 0
+        acc00 = vmlaq_f32(acc00, b00, a0);
+        acc10 = vmlaq_f32(acc10, b00, a1);
+        acc20 = vmlaq_f32(acc20, b00, a2);
+        acc30 = vmlaq_f32(acc30, b00, a3);
+
+        // 4x4 block 1
+        acc01 = vmlaq_f32(acc01, b10, a0);
+        acc11 = vmlaq_f32(acc11, b10, a1);
+        acc21 = vmlaq_f32(acc21, b10, a2);
+        acc31 = vmlaq_f32(acc31, b10, a3);
+
+        mtx_a0 += 4;
+        mtx_b0 += 4;
+        mtx_b1 += 4;
+    }
+
+    // Multiply by the weight of matrix product (alpha)
+    if(multiply_alpha)
+    {
+        const float32x4_t alpha_f32 = vdupq_n_f32(alpha);
+        acc00                       = vmulq_f32(acc00, alpha_f32);
+        acc10                       = vmulq_f32(acc10, alpha_f32);
+        acc20                       = vmulq_f32(acc20, alpha_f32);
+        acc30                       = vmulq_f32(acc30, alpha_f32);
+        acc01                       = vmulq_f32(acc01, alpha_f32);
+        acc11                       = vmulq_f32(acc11, alpha_f32);
+        acc21                       = vmulq_f32(acc21, alpha_f32);
+        acc31                       = vmulq_f32(acc31, alpha_f32);
+    }
+
+    // Apply the fused epilogue while the accumulators are still in registers
+    if(bias != nullptr)
+    {
+        const float32x4_t bias0 = vld1q_f32(bias);
+        const float32x4_t bias1 = vld1q_f32(bias + 4);
+
+        acc00 = vaddq_f32(acc00, bias0);
+        acc10 = vaddq_f32(acc10, bias0);
+        acc20 = vaddq_f32(acc20, bias0);
+        acc30 = vaddq_f32(acc30, bias0);
+        acc01 = vaddq_f32(acc01, bias1);
+        acc11 = vaddq_f32(acc11, bias1);
+        acc21 = vaddq_f32(acc21, bias1);
+        acc31 = vaddq_f32(acc31, bias1);
+    }
+
+    if(mtx_c != nullptr)
+    {
+        const float32x4_t beta_f32 = vdupq_n_f32(beta);
+
+        acc00 = vmlaq_f32(acc00, vld1q_f32(mtx_c), beta_f32);
+        acc01 = vmlaq_f32(acc01, vld1q_f32(mtx_c + 4), beta_f32);
+        acc10 = vmlaq_f32(acc10, vld1q_f32(mtx_c + c_stride), beta_f32);
+        acc11 = vmlaq_f32(acc11, vld1q_f32(mtx_c + c_stride + 4), beta_f32);
+        acc20 = vmlaq_f32(acc20, vld1q_f32(mtx_c + 2 * c_stride), beta_f32);
+        acc21 = vmlaq_f32(acc21, vld1q_f32(mtx_c + 2 * c_stride + 4), beta_f32);
+        acc30 = vmlaq_f32(acc30, vld1q_f32(mtx_c + 3 * c_stride), beta_f32);
+        acc31 = vmlaq_f32(acc31, vld1q_f32(mtx_c + 3 * c_stride + 4), beta_f32);
+    }
+
+    if(act_info != nullptr && act_info->enabled())
+    {
+        apply_activation_f32(acc00, acc10, acc20, acc30, *act_info);
+        apply_activation_f32(acc01, acc11, acc21, acc31, *act_info);
+    }
+
+    const auto mtx_out1 = mtx_out0 + 4;
+
+    // Store the 4 blocks
+    vst1q_f32(mtx_out0, acc00);
+    vst1q_f32(mtx_out1, acc01);
+    vst1q_f32(mtx_out0 + out_stride1, acc10);
+    vst1q_f32(mtx_out1 + out_stride1, acc11);
+    vst1q_f32(mtx_out0 + out_stride2, acc20);
+    vst1q_f32(mtx_out1 + out_stride2, acc21);
+    vst1q_f32(mtx_out0 + out_stride3, acc30);
+    vst1q_f32(mtx_out1 + out_stride3, acc31);
+}
+
 template <bool multiply_alpha>
-void matrix_matrix_multiply_f32(const ITensor *input0, const ITensor *input1, ITensor *output, const Window &window, float alpha)
+void matrix_matrix_multiply_f32(const ITensor *input0, const ITensor *input1, ITensor *output, const Window &window, float alpha, const EpilogueF32 *epilogue = nullptr)
 {
     const size_t in_b_stride          = input1->info()->strides_in_bytes()[1] / data_size_from_type(input1->info()->data_type());
     const size_t out_stride1          = output->info()->strides_in_bytes()[1] / data_size_from_type(output->info()->data_type());
-    const size_t out_stride2          = out_stride1 * 2;
-    const size_t out_stride3          = out_stride1 * 3;
     const int    num_elems_matrix_b_x = input1->info()->dimension(0);
 
+    const ITensor             *biases   = (epilogue != nullptr) ? epilogue->biases : nullptr;
+    const ITensor             *matrix_c = (epilogue != nullptr) ? epilogue->matrix_c : nullptr;
+    const size_t               c_stride = (matrix_c != nullptr) ? matrix_c->info()->strides_in_bytes()[1] / sizeof(float) : 0;
+    const ActivationLayerInfo *act_info = (epilogue != nullptr) ? &epilogue->act_info : nullptr;
+
     // Set step_x and step_y for matrix A. Scale by a factor of 4 the Y range as the input interleaved matrix A has 4 times less the rows of the output matrix
     Window win_a(window);
     win_a.set(Window::DimX, Window::Dimension(0, 0, 0));
@@ -645,269 +1016,95 @@ void matrix_matrix_multiply_f32(const ITensor *input0, const ITensor *input1, IT
     // All the values needed for computing a single 4x4 block will be read from consecutive memory positions
     execute_window_loop(window, [&](const Coordinates & id)
     {
-        auto mtx_a0 = reinterpret_cast<const float *>(ina.ptr());
-        auto mtx_b0 = reinterpret_cast<const float *>(inb.ptr());
-        auto mtx_b1 = mtx_b0 + in_b_stride;
-
-        float32x4_t acc00 = vdupq_n_f32(0.f);
-        float32x4_t acc10 = vdupq_n_f32(0.f);
-        float32x4_t acc20 = vdupq_n_f32(0.f);
-        float32x4_t acc30 = vdupq_n_f32(0.f);
-
-        float32x4_t acc01 = vdupq_n_f32(0.f);
-        float32x4_t acc11 = vdupq_n_f32(0.f);
-        float32x4_t acc21 = vdupq_n_f32(0.f);
-        float32x4_t acc31 = vdupq_n_f32(0.f);
-
-#if __arm__
-        asm volatile("PLD [%0, #128*1]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_a0)));
-        asm volatile("PLD [%0, #128*1]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_b0)));
-        asm volatile("PLD [%0, #128*1]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_b1)));
-#endif /* __arm__ */
-
-        auto mtx_b0_end_addr = mtx_b0 + num_elems_matrix_b_x;
-        for(; mtx_b0 <= (mtx_b0_end_addr - 32);)
-        {
-            float32x4_t a0 = vld1q_dup_f32(mtx_a0 + 0);
-            float32x4_t a1 = vld1q_dup_f32(mtx_a0 + 1);
-            float32x4_t a2 = vld1q_dup_f32(mtx_a0 + 2);
-            float32x4_t a3 = vld1q_dup_f32(mtx_a0 + 3);
-
-            float32x4_t b00 = vld1q_f32(mtx_b0);
-            float32x4_t b10 = vld1q_f32(mtx_b1);
-            float32x4_t b01 = vld1q_f32(mtx_b0 + 4);
-            float32x4_t b11 = vld1q_f32(mtx_b1 + 4);
-
-#if __arm__
-            asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_a0)));
-            asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_b0)));
-            asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_b1)));
-#endif /* __arm__ */
+        const auto bias  = (biases != nullptr) ? reinterpret_cast<const float *>(biases->ptr_to_element(Coordinates(id.x()))) : nullptr;
+        const auto mtx_c = (matrix_c != nullptr) ? reinterpret_cast<const float *>(matrix_c->ptr_to_element(Coordinates(id.x(), id.y()))) : nullptr;
+        const float beta = (epilogue != nullptr) ? epilogue->beta : 0.f;
 
-            // 4x4 block 0
-            acc00 = vmlaq_f32(acc00, b00, a0);
-            acc10 = vmlaq_f32(acc10, b00, a1);
-            acc20 = vmlaq_f32(acc20, b00, a2);
-            acc30 = vmlaq_f32(acc30, b00, a3);
-
-            float32x4_t a4 = vld1q_dup_f32(mtx_a0 + 4);
-            float32x4_t a5 = vld1q_dup_f32(mtx_a0 + 5);
-            float32x4_t a6 = vld1q_dup_f32(mtx_a0 + 6);
-            float32x4_t a7 = vld1q_dup_f32(mtx_a0 + 7);
-
-            // 4x4 block 1
-            acc01 = vmlaq_f32(acc01, b10, a0);
-            acc11 = vmlaq_f32(acc11, b10, a1);
-            acc21 = vmlaq_f32(acc21, b10, a2);
-            acc31 = vmlaq_f32(acc31, b10, a3);
-
-            // 4x4 block 0
-            acc00 = vmlaq_f32(acc00, b01, a4);
-            acc10 = vmlaq_f32(acc10, b01, a5);
-            acc20 = vmlaq_f32(acc20, b01, a6);
-            acc30 = vmlaq_f32(acc30, b01, a7);
-
-            // 4x4 block 1
-            acc01 = vmlaq_f32(acc01, b11, a4);
-            acc11 = vmlaq_f32(acc11, b11, a5);
-            acc21 = vmlaq_f32(acc21, b11, a6);
-            acc31 = vmlaq_f32(acc31, b11, a7);
-
-            mtx_a0 += 8;
-            mtx_b0 += 8;
-            mtx_b1 += 8;
+        matrix_matrix_multiply_block_f32<multiply_alpha>(reinterpret_cast<const float *>(ina.ptr()), reinterpret_cast<const float *>(inb.ptr()), reinterpret_cast<float *>(out.ptr()),
+                                                         in_b_stride, out_stride1, num_elems_matrix_b_x, alpha, bias, mtx_c, c_stride, beta, act_info);
+    },
+    ina, inb, out);
+}
 
-            a0 = vld1q_dup_f32(mtx_a0 + 0);
-            a1 = vld1q_dup_f32(mtx_a0 + 1);
-            a2 = vld1q_dup_f32(mtx_a0 + 2);
-            a3 = vld1q_dup_f32(mtx_a0 + 3);
-
-            b00 = vld1q_f32(mtx_b0);
-            b10 = vld1q_f32(mtx_b1);
-            b01 = vld1q_f32(mtx_b0 + 4);
-            b11 = vld1q_f32(mtx_b1 + 4);
-
-            // 4x4 block 0
-            acc00 = vmlaq_f32(acc00, b00, a0);
-            acc10 = vmlaq_f32(acc10, b00, a1);
-            acc20 = vmlaq_f32(acc20, b00, a2);
-            acc30 = vmlaq_f32(acc30, b00, a3);
-
-            a4 = vld1q_dup_f32(mtx_a0 + 4);
-            a5 = vld1q_dup_f32(mtx_a0 + 5);
-            a6 = vld1q_dup_f32(mtx_a0 + 6);
-            a7 = vld1q_dup_f32(mtx_a0 + 7);
-
-            // 4x4 block 1
-            acc01 = vmlaq_f32(acc01, b10, a0);
-            acc11 = vmlaq_f32(acc11, b10, a1);
-            acc21 = vmlaq_f32(acc21, b10, a2);
-            acc31 = vmlaq_f32(acc31, b10, a3);
-
-            // 4x4 block 0
-            acc00 = vmlaq_f32(acc00, b01, a4);
-            acc10 = vmlaq_f32(acc10, b01, a5);
-            acc20 = vmlaq_f32(acc20, b01, a6);
-            acc30 = vmlaq_f32(acc30, b01, a7);
-
-            // 4x4 block 1
-            acc01 = vmlaq_f32(acc01, b11, a4);
-            acc11 = vmlaq_f32(acc11, b11, a5);
-            acc21 = vmlaq_f32(acc21, b11, a6);
-            acc31 = vmlaq_f32(acc31, b11, a7);
+template <bool multiply_alpha>
+void matrix_matrix_multiply_pack_f32(const ITensor *input0, const ITensor *input1, ITensor *output, ITensor *workspace, const Window &window, const ThreadInfo &info, float alpha,
+                                     const EpilogueF32 *epilogue = nullptr)
+{
+    const size_t in_a_stride          = input0->info()->strides_in_bytes()[1] / data_size_from_type(input0->info()->data_type());
+    const size_t in_b_stride          = input1->info()->strides_in_bytes()[1] / data_size_from_type(input1->info()->data_type());
+    const size_t out_stride1          = output->info()->strides_in_bytes()[1] / data_size_from_type(output->info()->data_type());
+    const int    num_elems_matrix_b_x = input1->info()->dimension(0);
+    const int    num_cols_a           = input0->info()->dimension(0);
 
-            mtx_a0 += 8;
-            mtx_b0 += 8;
-            mtx_b1 += 8;
+    const ITensor             *biases   = (epilogue != nullptr) ? epilogue->biases : nullptr;
+    const ITensor             *matrix_c = (epilogue != nullptr) ? epilogue->matrix_c : nullptr;
+    const size_t               c_stride = (matrix_c != nullptr) ? matrix_c->info()->strides_in_bytes()[1] / sizeof(float) : 0;
+    const ActivationLayerInfo *act_info = (epilogue != nullptr) ? &epilogue->act_info : nullptr;
 
-            a0  = vld1q_dup_f32(mtx_a0 + 0);
-            a1  = vld1q_dup_f32(mtx_a0 + 1);
-            a2  = vld1q_dup_f32(mtx_a0 + 2);
-            a3  = vld1q_dup_f32(mtx_a0 + 3);
-            b00 = vld1q_f32(mtx_b0);
-            b10 = vld1q_f32(mtx_b1);
-            b01 = vld1q_f32(mtx_b0 + 4);
-            b11 = vld1q_f32(mtx_b1 + 4);
+    // Matrix A is not reshaped: each window row addresses the top row of the 4-row panel directly
+    Window win_a(window);
+    win_a.set(Window::DimX, Window::Dimension(0, 0, 0));
 
-#if __arm__
-            asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_a0)));
-            asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_b0)));
-            asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_b1)));
-#endif /* __arm__ */
+    Window win_b;
+    // Don't slice matrix B along the z dimension if matrix B has just 2 dimensions and matrix A more than 2
+    // This scenario can happen when the the matrix multiplication is used to perform a convolution operation
+    if(input1->info()->num_dimensions() >= 3)
+    {
+        win_b = window;
+    }
+    win_b.set(Window::DimX, Window::Dimension(window.x().start() / 4, window.x().end() / 4, 2 * in_b_stride));
+    win_b.set(Window::DimY, Window::Dimension(0, 0, 0));
 
-            // 4x4 block 0
-            acc00 = vmlaq_f32(acc00, b00, a0);
-            acc10 = vmlaq_f32(acc10, b00, a1);
-            acc20 = vmlaq_f32(acc20, b00, a2);
-            acc30 = vmlaq_f32(acc30, b00, a3);
-
-            a4 = vld1q_dup_f32(mtx_a0 + 4);
-            a5 = vld1q_dup_f32(mtx_a0 + 5);
-            a6 = vld1q_dup_f32(mtx_a0 + 6);
-            a7 = vld1q_dup_f32(mtx_a0 + 7);
-
-            // 4x4 block 1
-            acc01 = vmlaq_f32(acc01, b10, a0);
-            acc11 = vmlaq_f32(acc11, b10, a1);
-            acc21 = vmlaq_f32(acc21, b10, a2);
-            acc31 = vmlaq_f32(acc31, b10, a3);
-
-            // 4x4 block 0
-            acc00 = vmlaq_f32(acc00, b01, a4);
-            acc10 = vmlaq_f32(acc10, b01, a5);
-            acc20 = vmlaq_f32(acc20, b01, a6);
-            acc30 = vmlaq_f32(acc30, b01, a7);
-
-            // 4x4 block 1
-            acc01 = vmlaq_f32(acc01, b11, a4);
-            acc11 = vmlaq_f32(acc11, b11, a5);
-            acc21 = vmlaq_f32(acc21, b11, a6);
-            acc31 = vmlaq_f32(acc31, b11, a7);
+    Iterator ina(input0, win_a);
+    Iterator inb(input1, win_b);
+    Iterator out(output, window);
 
-            mtx_a0 += 8;
-            mtx_b0 += 8;
-            mtx_b1 += 8;
+    // Carve this thread's panel buffer out of the shared workspace, mirroring the assembly kernels' usage
+    const size_t panel_size = 4 * ceil_to_multiple(num_cols_a, 4) * sizeof(float);
+    const size_t offset     = (panel_size + workspace_alignment - 1) * info.thread_id;
+    void        *panel_ptr  = workspace->buffer() + offset;
+    size_t       space      = workspace->info()->total_size() - offset;
 
-            a0  = vld1q_dup_f32(mtx_a0 + 0);
-            a1  = vld1q_dup_f32(mtx_a0 + 1);
-            a2  = vld1q_dup_f32(mtx_a0 + 2);
-            a3  = vld1q_dup_f32(mtx_a0 + 3);
-            b00 = vld1q_f32(mtx_b0);
-            b10 = vld1q_f32(mtx_b1);
-            b01 = vld1q_f32(mtx_b0 + 4);
-            b11 = vld1q_f32(mtx_b1 + 4);
-
-            // 4x4 block 0
-            acc00 = vmlaq_f32(acc00, b00, a0);
-            acc10 = vmlaq_f32(acc10, b00, a1);
-            acc20 = vmlaq_f32(acc20, b00, a2);
-            acc30 = vmlaq_f32(acc30, b00, a3);
-
-            a4 = vld1q_dup_f32(mtx_a0 + 4);
-            a5 = vld1q_dup_f32(mtx_a0 + 5);
-            a6 = vld1q_dup_f32(mtx_a0 + 6);
-            a7 = vld1q_dup_f32(mtx_a0 + 7);
-
-            // 4x4 block 1
-            acc01 = vmlaq_f32(acc01, b10, a0);
-            acc11 = vmlaq_f32(acc11, b10, a1);
-            acc21 = vmlaq_f32(acc21, b10, a2);
-            acc31 = vmlaq_f32(acc31, b10, a3);
-
-            // 4x4 block 0
-            acc00 = vmlaq_f32(acc00, b01, a4);
-            acc10 = vmlaq_f32(acc10, b01, a5);
-            acc20 = vmlaq_f32(acc20, b01, a6);
-            acc30 = vmlaq_f32(acc30, b01, a7);
-
-            // 4x4 block 1
-            acc01 = vmlaq_f32(acc01, b11, a4);
-            acc11 = vmlaq_f32(acc11, b11, a5);
-            acc21 = vmlaq_f32(acc21, b11, a6);
-            acc31 = vmlaq_f32(acc31, b11, a7);
+    if(support::cpp11::align(workspace_alignment, panel_size, panel_ptr, space) == nullptr)
+    {
+        ARM_COMPUTE_ERROR("Not enough space to align buffer!");
+    }
 
-            mtx_a0 += 8;
-            mtx_b0 += 8;
-            mtx_b1 += 8;
-        }
+    auto panel = static_cast<float *>(panel_ptr);
 
-        for(; mtx_b0 < mtx_b0_end_addr;)
+    // The A panel of the current output row-block is packed into the interleaved layout expected by
+    // the multiply loop the first time the block row is visited, and stays resident for all the
+    // column blocks computed from it. Compared with running NEGEMMInterleave4x4 up front this avoids
+    // writing and re-reading a full interleaved copy of the A operand every run
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        if(id.x() == window.x().start())
         {
-            float32x4_t a0  = vld1q_dup_f32(mtx_a0 + 0);
-            float32x4_t a1  = vld1q_dup_f32(mtx_a0 + 1);
-            float32x4_t a2  = vld1q_dup_f32(mtx_a0 + 2);
-            float32x4_t a3  = vld1q_dup_f32(mtx_a0 + 3);
-            float32x4_t b00 = vld1q_f32(mtx_b0);
-            float32x4_t b10 = vld1q_f32(mtx_b1);
-
-#if __arm__
-            asm volatile("PLD [%0, #128*2]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_a0)));
-            asm volatile("PLD [%0, #128*2]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_b0)));
-            asm volatile("PLD [%0, #128*2]" ::"r"(reinterpret_cast<const uint8_t *>(mtx_b1)));
-#endif /* __arm__ */
-            // 4x4 block 0
-            acc00 = vmlaq_f32(acc00, b00, a0);
-            acc10 = vmlaq_f32(acc10, b00, a1);
-            acc20 = vmlaq_f32(acc20, b00, a2);
-            acc30 = vmlaq_f32(acc30, b00, a3);
-
-            // 4x4 block 1
-            acc01 = vmlaq_f32(acc01, b10, a0);
-            acc11 = vmlaq_f32(acc11, b10, a1);
-            acc21 = vmlaq_f32(acc21, b10, a2);
-            acc31 = vmlaq_f32(acc31, b10, a3);
+            const auto mtx_a      = reinterpret_cast<const float *>(ina.ptr());
+            float     *panel_out  = panel;
 
-            mtx_a0 += 4;
-            mtx_b0 += 4;
-            mtx_b1 += 4;
+            for(int k = 0; k < num_cols_a; k += 4)
+            {
+                const float32x4x4_t rows =
+                {
+                    {
+                        vld1q_f32(mtx_a + k),
+                        vld1q_f32(mtx_a + k + in_a_stride),
+                        vld1q_f32(mtx_a + k + 2 * in_a_stride),
+                        vld1q_f32(mtx_a + k + 3 * in_a_stride)
+                    }
+                };
+                vst4q_f32(panel_out, rows);
+                panel_out += 16;
+            }
         }
 
-        // Multiply by the weight of matrix product (alpha)
-        if(multiply_alpha)
-        {
-            const float32x4_t alpha_f32 = vdupq_n_f32(alpha);
-            acc00                       = vmulq_f32(acc00, alpha_f32);
-            acc10                       = vmulq_f32(acc10, alpha_f32);
-            acc20                       = vmulq_f32(acc20, alpha_f32);
-            acc30                       = vmulq_f32(acc30, alpha_f32);
-            acc01                       = vmulq_f32(acc01, alpha_f32);
-            acc11                       = vmulq_f32(acc11, alpha_f32);
-            acc21                       = vmulq_f32(acc21, alpha_f32);
-            acc31                       = vmulq_f32(acc31, alpha_f32);
-        }
+        const auto bias  = (biases != nullptr) ? reinterpret_cast<const float *>(biases->ptr_to_element(Coordinates(id.x()))) : nullptr;
+        const auto mtx_c = (matrix_c != nullptr) ? reinterpret_cast<const float *>(matrix_c->ptr_to_element(Coordinates(id.x(), id.y()))) : nullptr;
+        const float beta = (epilogue != nullptr) ? epilogue->beta : 0.f;
 
-        const auto mtx_out0 = reinterpret_cast<float *>(out.ptr());
-        const auto mtx_out1 = mtx_out0 + 4;
-
-        // Store the 4 blocks
-        vst1q_f32(mtx_out0, acc00);
-        vst1q_f32(mtx_out1, acc01);
-        vst1q_f32(mtx_out0 + out_stride1, acc10);
-        vst1q_f32(mtx_out1 + out_stride1, acc11);
-        vst1q_f32(mtx_out0 + out_stride2, acc20);
-        vst1q_f32(mtx_out1 + out_stride2, acc21);
-        vst1q_f32(mtx_out0 + out_stride3, acc30);
-        vst1q_f32(mtx_out1 + out_stride3, acc31);
+        matrix_matrix_multiply_block_f32<multiply_alpha>(panel, reinterpret_cast<const float *>(inb.ptr()), reinterpret_cast<float *>(out.ptr()),
+                                                         in_b_stride, out_stride1, num_elems_matrix_b_x, alpha, bias, mtx_c, c_stride, beta, act_info);
     },
     ina, inb, out);
 }
@@ -1411,10 +1608,92 @@ void matrix_matrix_multiply_qs16(const ITensor *input0, const ITensor *input1, I
 } // namespace
 
 NEGEMMMatrixMultiplyKernel::NEGEMMMatrixMultiplyKernel()
-    : _input0(nullptr), _input1(nullptr), _output(nullptr), _alpha(1.0f)
+    : _input0(nullptr), _input1(nullptr), _output(nullptr), _workspace(nullptr), _alpha(1.0f), _biases(nullptr), _matrix_c(nullptr), _beta(0.f), _act_info(), _has_epilogue(false)
 {
 }
 
+void NEGEMMMatrixMultiplyKernel::set_fused_epilogue(const ITensor *biases, const ITensor *matrix_c, float beta, const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(_output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON(biases == nullptr && matrix_c == nullptr && !act_info.enabled());
+    ARM_COMPUTE_ERROR_ON_MSG(act_info.enabled() && act_info.activation() != ActivationLayerInfo::ActivationFunction::RELU
+                             && act_info.activation() != ActivationLayerInfo::ActivationFunction::BOUNDED_RELU
+                             && act_info.activation() != ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU,
+                             "Only the RELU family can be fused into the output store");
+
+    // The vector path reads 16-wide strips, the matrix paths 8-wide blocks of 4 rows
+    const bool         is_vector   = _output->info()->dimension(1) == 1;
+    const unsigned int num_elems_x = is_vector ? 16 : 8;
+
+    Window win(INEKernel::window());
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(_output, biases);
+        ARM_COMPUTE_ERROR_ON(biases->info()->num_dimensions() > 1);
+        ARM_COMPUTE_ERROR_ON(biases->info()->dimension(0) != _output->info()->dimension(0));
+
+        update_window_and_padding(win, AccessWindowStatic(biases->info(), 0, 0, ceil_to_multiple(biases->info()->dimension(0), num_elems_x), 1));
+    }
+
+    if(matrix_c != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(_output, matrix_c);
+        ARM_COMPUTE_ERROR_ON(matrix_c->info()->dimension(0) != _output->info()->dimension(0));
+        ARM_COMPUTE_ERROR_ON(matrix_c->info()->dimension(1) != _output->info()->dimension(1));
+
+        update_window_and_padding(win, AccessWindowStatic(matrix_c->info(), 0, 0, ceil_to_multiple(matrix_c->info()->dimension(0), num_elems_x),
+                                                          is_vector ? 1 : ceil_to_multiple(matrix_c->info()->dimension(1), 4)));
+    }
+
+    _biases       = biases;
+    _matrix_c     = matrix_c;
+    _beta         = beta;
+    _act_info     = act_info;
+    _has_epilogue = true;
+}
+
+size_t NEGEMMMatrixMultiplyKernel::packing_workspace_size(unsigned int k, unsigned int num_threads)
+{
+    const size_t panel_size = 4 * ceil_to_multiple(k, 4U) * sizeof(float);
+    return (panel_size + workspace_alignment - 1) * num_threads;
+}
+
+void NEGEMMMatrixMultiplyKernel::configure(const ITensor *input0, const ITensor *input1, ITensor *output, ITensor *workspace, float alpha)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input0, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, input1, output);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(workspace);
+    ARM_COMPUTE_ERROR_ON_MSG(output->info()->dimension(1) == 1, "The fused-packing path is only defined for matrix outputs");
+    ARM_COMPUTE_ERROR_ON(input0->info()->dimension(1) != output->info()->dimension(1));
+
+    _input0       = input0;
+    _input1       = input1;
+    _output       = output;
+    _workspace    = workspace;
+    _alpha        = alpha;
+    _has_epilogue = false;
+
+    constexpr unsigned int num_elems_processed_per_iteration_x = 8;
+    constexpr unsigned int num_elems_processed_per_iteration_y = 4;
+
+    // Configure kernel window
+    Window win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration_x, num_elems_processed_per_iteration_y));
+
+    AccessWindowRectangle output_access(output->info(), 0, 0, num_elems_processed_per_iteration_x, num_elems_processed_per_iteration_y);
+
+    // The panel packing reads the un-reshaped matrix A four rows and four columns at a time
+    update_window_and_padding(win,
+                              AccessWindowStatic(input0->info(), 0, 0, ceil_to_multiple(input0->info()->tensor_shape().x(), 4), ceil_to_multiple(input0->info()->tensor_shape().y(), 4)),
+                              AccessWindowStatic(input1->info(), 0, 0, input1->info()->tensor_shape().x(), ceil_to_multiple(input1->info()->tensor_shape().y(), 4)),
+                              output_access);
+
+    output_access.set_valid_region(win, ValidRegion(Coordinates(0, 0), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
 void NEGEMMMatrixMultiplyKernel::configure(const ITensor *input0, const ITensor *input1, ITensor *output, float alpha)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input0, 1, DataType::F16, DataType::F32, DataType::QS8, DataType::QS16);
@@ -1426,10 +1705,12 @@ void NEGEMMMatrixMultiplyKernel::configure(const ITensor *input0, const ITensor
         ARM_COMPUTE_ERROR_ON(input0->info()->dimension(0) != input1->info()->dimension(1));
     }
 
-    _input0 = input0;
-    _input1 = input1;
-    _output = output;
-    _alpha  = alpha;
+    _input0       = input0;
+    _input1       = input1;
+    _output       = output;
+    _workspace    = nullptr;
+    _alpha        = alpha;
+    _has_epilogue = false;
 
     unsigned int       num_elems_processed_per_iteration_x = 0;
     const unsigned int num_elems_processed_per_iteration_y = 4;
@@ -1540,6 +1821,9 @@ void NEGEMMMatrixMultiplyKernel::run(const Window &window, const ThreadInfo &inf
 
     bool multiply_alpha = std::abs(1.0f - _alpha) > 0.00001f;
 
+    const EpilogueF32  epilogue_args{ _biases, _matrix_c, _beta, _act_info };
+    const EpilogueF32 *epilogue = _has_epilogue ? &epilogue_args : nullptr;
+
     // Check if the output tensor is a vector. If so,the kernel runs the vector-matrix multiplication
     if((_output->info()->dimension(1) == 1))
     {
@@ -1547,8 +1831,8 @@ void NEGEMMMatrixMultiplyKernel::run(const Window &window, const ThreadInfo &inf
         {
             case DataType::F32:
             {
-                multiply_alpha ? vector_matrix_multiply_f32<true>(_input0, _input1, _output, window, info, _alpha) :
-                vector_matrix_multiply_f32<false>(_input0, _input1, _output, window, info, _alpha);
+                multiply_alpha ? vector_matrix_multiply_f32<true>(_input0, _input1, _output, window, info, _alpha, epilogue) :
+                vector_matrix_multiply_f32<false>(_input0, _input1, _output, window, info, _alpha, epilogue);
                 break;
             }
             case DataType::QS8:
@@ -1584,8 +1868,16 @@ void NEGEMMMatrixMultiplyKernel::run(const Window &window, const ThreadInfo &inf
         {
             case DataType::F32:
             {
-                multiply_alpha ? matrix_matrix_multiply_f32<true>(_input0, _input1, _output, window, _alpha) :
-                matrix_matrix_multiply_f32<false>(_input0, _input1, _output, window, _alpha);
+                if(_workspace != nullptr)
+                {
+                    multiply_alpha ? matrix_matrix_multiply_pack_f32<true>(_input0, _input1, _output, _workspace, window, info, _alpha, epilogue) :
+                    matrix_matrix_multiply_pack_f32<false>(_input0, _input1, _output, _workspace, window, info, _alpha, epilogue);
+                }
+                else
+                {
+                    multiply_alpha ? matrix_matrix_multiply_f32<true>(_input0, _input1, _output, window, _alpha, epilogue) :
+                    matrix_matrix_multiply_f32<false>(_input0, _input1, _output, window, _alpha, epilogue);
+                }
                 break;
             }
             case DataType::QS8:
@@ -35,15 +35,43 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
 
+#include <algorithm>
 #include <arm_neon.h>
 #include <cstddef>
 #include <cstring>
 
 using namespace arm_compute;
 
+namespace
+{
+/** Runs a stage of the 1xW packing on one cache block of the window */
+template <typename F>
+void run_block(const ITensor *input, ITensor *output, const Window &block, F &&pack_element)
+{
+    // Set window for output tensor. Set to 0 the X and Y dimensions in order to allow multi-threading implementation and future batched matrix multiplications
+    Window win_out(block);
+    win_out.set(Window::DimX, Window::Dimension(0, 0, 0));
+    win_out.set(Window::DimY, Window::Dimension(0, 0, 0));
+
+    Iterator in(input, block);
+    Iterator out(output, win_out);
+
+    execute_window_loop(block, [&](const Coordinates & id)
+    {
+        pack_element(in, out, id);
+    },
+    in, out);
+}
+} // namespace
+
+NEGEMMTranspose1xWKernel::NEGEMMTranspose1xWKernel()
+    : _codebook(nullptr), _scales(nullptr)
+{
+}
+
 void NEGEMMTranspose1xWKernel::configure(const ITensor *input, ITensor *output)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QS8, DataType::QS16, DataType::U8, DataType::S8, DataType::U16, DataType::S16, DataType::U32, DataType::S32, DataType::F16,
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QS8, DataType::QS16, DataType::U8, DataType::QASYMM8, DataType::S8, DataType::U16, DataType::S16, DataType::U32, DataType::S32, DataType::F16,
                                                   DataType::F32);
     ARM_COMPUTE_ERROR_ON_NULLPTR(output);
 
@@ -62,8 +90,55 @@ void NEGEMMTranspose1xWKernel::configure(const ITensor *input, ITensor *output)
     const unsigned int num_elems_processed_per_iteration = 16 / input->info()->element_size();
     const int          scale_x                           = num_elems_processed_per_iteration;
 
-    _input  = input;
-    _output = output;
+    _input    = input;
+    _output   = output;
+    _codebook = nullptr;
+    _scales   = nullptr;
+
+    // Configure kernel window
+    Window win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration));
+
+    ARM_COMPUTE_ERROR_ON_MSG((win.x().end() / scale_x) == 0, "Transposed shape would be 0 in the second dimension");
+
+    AccessWindowTranspose output_access(output->info(), 0, 0, num_elems_processed_per_iteration, 1, scale_x, 1.f / scale_x);
+
+    update_window_and_padding(win,
+                              AccessWindowHorizontal(input->info(), 0, num_elems_processed_per_iteration),
+                              output_access);
+
+    output_access.set_valid_region(win, ValidRegion(Coordinates(0, 0), input->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEGEMMTranspose1xWKernel::configure(const ITensor *input, ITensor *output, const ITensor *codebook, const ITensor *scales)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(codebook, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(scales, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(output);
+    ARM_COMPUTE_ERROR_ON_MSG(codebook->info()->dimension(0) != 256, "The codebook must hold 256 entries");
+    ARM_COMPUTE_ERROR_ON(scales->info()->num_dimensions() > 1);
+    ARM_COMPUTE_ERROR_ON(scales->info()->dimension(0) != input->info()->dimension(1));
+
+    // The decoded elements are F32, hence the packing width of the F32 path
+    constexpr unsigned int num_elems_processed_per_iteration = 16 / sizeof(float);
+    constexpr int          scale_x                           = num_elems_processed_per_iteration;
+
+    TensorShape output_shape{ input->info()->tensor_shape() };
+    output_shape.set(0, input->info()->dimension(1) * num_elems_processed_per_iteration);
+    output_shape.set(1, static_cast<size_t>(std::ceil((input->info()->dimension(0) / static_cast<float>(num_elems_processed_per_iteration)))));
+
+    // Output tensor auto inizialitation if not yet initialized
+    auto_init_if_empty(*output->info(), output_shape, 1, DataType::F32, 0);
+
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DIMENSIONS(output->info()->tensor_shape(), output_shape);
+
+    _input    = input;
+    _output   = output;
+    _codebook = codebook;
+    _scales   = scales;
 
     // Configure kernel window
     Window win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration));
@@ -83,7 +158,6 @@ void NEGEMMTranspose1xWKernel::configure(const ITensor *input, ITensor *output)
 
 void NEGEMMTranspose1xWKernel::run(const Window &window, const ThreadInfo &info)
 {
-    ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INESimpleKernel::window(), window);
 
@@ -98,53 +172,80 @@ void NEGEMMTranspose1xWKernel::run(const Window &window, const ThreadInfo &info)
      * The output matrix will have the following shape: [ height * W, ceil(width / W) ], where W = (16 / element size of the tensor)
      */
 
-    // Set window for output tensor. Set to 0 the X and Y dimensions in order to allow multi-threading implementation and future batched matrix multiplications
-    Window win_out(window);
-    win_out.set(Window::DimX, Window::Dimension(0, 0, 0));
-    win_out.set(Window::DimY, Window::Dimension(0, 0, 0));
+    // The packed writes land one output row apart for consecutive x steps, so blocks sized
+    // by cache_block_side() keep the active output rows resident while the input is streamed
+    const size_t element_size = (_codebook != nullptr) ? _output->info()->element_size() : _input->info()->element_size();
+    const size_t l1_size      = (info.cpu_info.L1_size != 0) ? info.cpu_info.L1_size : 32 * 1024;
+    const size_t l2_size      = (info.cpu_info.L2_size != 0) ? info.cpu_info.L2_size : 512 * 1024;
 
-    Iterator in(_input, window);
-    Iterator out(_output, win_out);
+    const int l1_block = cache_block_side(l1_size, element_size, window.x().step());
+    const int l2_block = std::max(cache_block_side(l2_size, element_size, window.x().step()), l1_block);
+
+    if(_codebook != nullptr)
+    {
+        const size_t out_stride = _output->info()->strides_in_bytes()[1] / sizeof(float);
+        const auto   codebook   = reinterpret_cast<const float *>(_codebook->ptr_to_element(Coordinates(0)));
+        const auto   scales     = reinterpret_cast<const float *>(_scales->ptr_to_element(Coordinates(0)));
+
+        execute_window_blocked(window, l1_block, l2_block, [&](const Window & block)
+        {
+            run_block(_input, _output, block, [&](const Iterator & in, const Iterator & out, const Coordinates & id)
+            {
+                // Decode four 8-bit codes and apply the row scale on the way into the packed output
+                const uint8_t *codes   = in.ptr();
+                const float    vals[4] = { codebook[codes[0]], codebook[codes[1]], codebook[codes[2]], codebook[codes[3]] };
+                const auto     out_ptr = reinterpret_cast<float *>(out.ptr()) + (id.y() << 2) + (id.x() >> 2) * out_stride;
+                vst1q_f32(out_ptr, vmulq_n_f32(vld1q_f32(vals), scales[id.y()]));
+            });
+        });
+        return;
+    }
 
-    switch(_input->info()->element_size())
+    switch(element_size)
     {
         case 1:
         {
             const size_t out_stride = _output->info()->strides_in_bytes()[1];
-            execute_window_loop(window, [&](const Coordinates & id)
+            execute_window_blocked(window, l1_block, l2_block, [&](const Window & block)
             {
-                // Output address = base addr + (y * 16) + (x / 16 ) * stride
-                const uint8_t *in_ptr  = in.ptr();
-                uint8_t *const out_ptr = out.ptr() + (id.y() << 4) + (id.x() >> 4) * out_stride;
-                vst1q_u8(out_ptr, vld1q_u8(in_ptr));
-            },
-            in, out);
+                run_block(_input, _output, block, [&](const Iterator & in, const Iterator & out, const Coordinates & id)
+                {
+                    // Output address = base addr + (y * 16) + (x / 16 ) * stride
+                    const uint8_t *in_ptr  = in.ptr();
+                    uint8_t *const out_ptr = out.ptr() + (id.y() << 4) + (id.x() >> 4) * out_stride;
+                    vst1q_u8(out_ptr, vld1q_u8(in_ptr));
+                });
+            });
             break;
         }
         case 2:
         {
             const size_t out_stride = _output->info()->strides_in_bytes()[1] / sizeof(int16_t);
-            execute_window_loop(window, [&](const Coordinates & id)
+            execute_window_blocked(window, l1_block, l2_block, [&](const Window & block)
             {
-                // Output address = base addr + (y * 8) + (x / 8 ) * stride
-                const auto in_ptr  = reinterpret_cast<const uint16_t *>(in.ptr());
-                const auto out_ptr = reinterpret_cast<uint16_t *>(out.ptr()) + (id.y() << 3) + (id.x() >> 3) * out_stride;
-                vst1q_u16(out_ptr, vld1q_u16(in_ptr));
-            },
-            in, out);
+                run_block(_input, _output, block, [&](const Iterator & in, const Iterator & out, const Coordinates & id)
+                {
+                    // Output address = base addr + (y * 8) + (x / 8 ) * stride
+                    const auto in_ptr  = reinterpret_cast<const uint16_t *>(in.ptr());
+                    const auto out_ptr = reinterpret_cast<uint16_t *>(out.ptr()) + (id.y() << 3) + (id.x() >> 3) * out_stride;
+                    vst1q_u16(out_ptr, vld1q_u16(in_ptr));
+                });
+            });
             break;
         }
         case 4:
         {
             const size_t out_stride = _output->info()->strides_in_bytes()[1] / sizeof(float);
-            execute_window_loop(window, [&](const Coordinates & id)
+            execute_window_blocked(window, l1_block, l2_block, [&](const Window & block)
             {
-                // Output address = base addr + (y * 4) + (x / 4 ) * stride
-                const auto in_ptr  = reinterpret_cast<const uint32_t *>(in.ptr());
-                const auto out_ptr = reinterpret_cast<uint32_t *>(out.ptr()) + (id.y() << 2) + (id.x() >> 2) * out_stride;
-                vst1q_u32(out_ptr, vld1q_u32(in_ptr));
-            },
-            in, out);
+                run_block(_input, _output, block, [&](const Iterator & in, const Iterator & out, const Coordinates & id)
+                {
+                    // Output address = base addr + (y * 4) + (x / 4 ) * stride
+                    const auto in_ptr  = reinterpret_cast<const uint32_t *>(in.ptr());
+                    const auto out_ptr = reinterpret_cast<uint32_t *>(out.ptr()) + (id.y() << 2) + (id.x() >> 2) * out_stride;
+                    vst1q_u32(out_ptr, vld1q_u32(in_ptr));
+                });
+            });
             break;
         }
         default:
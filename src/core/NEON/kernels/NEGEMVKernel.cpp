@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEGEMVKernel.h"
+
+#include "arm_compute/core/AccessWindowStatic.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/IAccessWindow.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+#include <cmath>
+#include <cstdint>
+
+using namespace arm_compute;
+
+namespace
+{
+void vector_matrix_multiply_t1xw_f32(const ITensor *input0, const ITensor *input1, ITensor *output, const Window &window)
+{
+    const auto   width_matrix_b  = static_cast<int>(output->info()->dimension(0));
+    const size_t in_b_stride     = input1->info()->strides_in_bytes()[1];
+    const auto   num_elems_vec_a = static_cast<int>(input0->info()->dimension(0));
+
+    Window win_out(window);
+    win_out.set(Window::DimY, Window::Dimension(0, 1, 1));
+
+    Window win_a(window);
+    win_a.set(Window::DimX, Window::Dimension(0, 0, 0));
+    win_a.set(Window::DimY, Window::Dimension(0, 0, 0));
+
+    Iterator ina(input0, win_a);
+    Iterator out(output, win_out);
+
+    const uint8_t *matrix_b_base = input1->buffer() + input1->info()->offset_first_element_in_bytes();
+
+    execute_window_loop(win_out, [&](const Coordinates & id)
+    {
+        // Each row of the reshaped matrix holds a panel of four interleaved columns of B: one panel
+        // produces four outputs from a single contiguous stream. Walk two panels at a time so two
+        // independent streams are in flight.
+        auto       vec_a     = reinterpret_cast<const float *>(ina.ptr());
+        const auto vec_a_end = vec_a + num_elems_vec_a;
+        auto       matrix_b0 = reinterpret_cast<const float *>(matrix_b_base + (id.x() / 4) * in_b_stride);
+        auto       matrix_b1 = reinterpret_cast<const float *>(matrix_b_base + (id.x() / 4 + 1) * in_b_stride);
+
+        float32x4_t acc00 = vdupq_n_f32(0.f);
+        float32x4_t acc01 = vdupq_n_f32(0.f);
+        float32x4_t acc10 = vdupq_n_f32(0.f);
+        float32x4_t acc11 = vdupq_n_f32(0.f);
+
+        if(id.x() + 4 < width_matrix_b)
+        {
+#if __arm__
+            asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(vec_a)));
+            asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(matrix_b0)));
+            asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(matrix_b1)));
+#endif /* __arm__ */
+
+            for(; vec_a <= (vec_a_end - 4); vec_a += 4, matrix_b0 += 16, matrix_b1 += 16)
+            {
+                const float32x2_t a0l = vld1_f32(vec_a);
+                const float32x2_t a0h = vld1_f32(vec_a + 2);
+
+#if __arm__
+                asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(matrix_b0)));
+                asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(matrix_b1)));
+#endif /* __arm__ */
+
+                acc00 = vmlaq_lane_f32(acc00, vld1q_f32(matrix_b0 + 0), a0l, 0);
+                acc10 = vmlaq_lane_f32(acc10, vld1q_f32(matrix_b1 + 0), a0l, 0);
+                acc01 = vmlaq_lane_f32(acc01, vld1q_f32(matrix_b0 + 4), a0l, 1);
+                acc11 = vmlaq_lane_f32(acc11, vld1q_f32(matrix_b1 + 4), a0l, 1);
+                acc00 = vmlaq_lane_f32(acc00, vld1q_f32(matrix_b0 + 8), a0h, 0);
+                acc10 = vmlaq_lane_f32(acc10, vld1q_f32(matrix_b1 + 8), a0h, 0);
+                acc01 = vmlaq_lane_f32(acc01, vld1q_f32(matrix_b0 + 12), a0h, 1);
+                acc11 = vmlaq_lane_f32(acc11, vld1q_f32(matrix_b1 + 12), a0h, 1);
+            }
+
+            for(; vec_a < vec_a_end; ++vec_a, matrix_b0 += 4, matrix_b1 += 4)
+            {
+                acc00 = vmlaq_n_f32(acc00, vld1q_f32(matrix_b0), *vec_a);
+                acc10 = vmlaq_n_f32(acc10, vld1q_f32(matrix_b1), *vec_a);
+            }
+
+            const auto vec_out = reinterpret_cast<float *>(out.ptr());
+            vst1q_f32(vec_out + 0, vaddq_f32(acc00, acc01));
+            vst1q_f32(vec_out + 4, vaddq_f32(acc10, acc11));
+        }
+        else if(id.x() < width_matrix_b)
+        {
+            // Last panel of a matrix whose width is not a multiple of eight
+#if __arm__
+            asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(vec_a)));
+            asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(matrix_b0)));
+#endif /* __arm__ */
+
+            for(; vec_a <= (vec_a_end - 4); vec_a += 4, matrix_b0 += 16)
+            {
+                const float32x2_t a0l = vld1_f32(vec_a);
+                const float32x2_t a0h = vld1_f32(vec_a + 2);
+
+#if __arm__
+                asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(matrix_b0)));
+#endif /* __arm__ */
+
+                acc00 = vmlaq_lane_f32(acc00, vld1q_f32(matrix_b0 + 0), a0l, 0);
+                acc01 = vmlaq_lane_f32(acc01, vld1q_f32(matrix_b0 + 4), a0l, 1);
+                acc00 = vmlaq_lane_f32(acc00, vld1q_f32(matrix_b0 + 8), a0h, 0);
+                acc01 = vmlaq_lane_f32(acc01, vld1q_f32(matrix_b0 + 12), a0h, 1);
+            }
+
+            for(; vec_a < vec_a_end; ++vec_a, matrix_b0 += 4)
+            {
+                acc00 = vmlaq_n_f32(acc00, vld1q_f32(matrix_b0), *vec_a);
+            }
+
+            const auto vec_out = reinterpret_cast<float *>(out.ptr());
+            vst1q_f32(vec_out, vaddq_f32(acc00, acc01));
+        }
+    },
+    ina, out);
+}
+} // namespace
+
+NEGEMVKernel::NEGEMVKernel()
+    : _input0(nullptr), _input1(nullptr), _output(nullptr)
+{
+}
+
+void NEGEMVKernel::configure(const ITensor *input0, const ITensor *input1, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input0, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, input1, output);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) != 1);
+    ARM_COMPUTE_ERROR_ON(input1->info()->dimension(0) != input0->info()->dimension(0) * 4);
+    ARM_COMPUTE_ERROR_ON(input1->info()->dimension(1) != static_cast<unsigned int>(std::ceil(output->info()->dimension(0) / 4.f)));
+
+    _input0 = input0;
+    _input1 = input1;
+    _output = output;
+
+    // Two panels of four outputs each per iteration
+    constexpr unsigned int num_elems_processed_per_iteration = 8;
+
+    Window win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
+
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win,
+                              AccessWindowStatic(input0->info(), 0, 0, input0->info()->tensor_shape().x(), 1),
+                              AccessWindowStatic(input1->info(), 0, 0, input1->info()->tensor_shape().x(), input1->info()->tensor_shape().y()),
+                              output_access);
+
+    Coordinates coord;
+    coord.set_num_dimensions(output->info()->num_dimensions());
+    output_access.set_valid_region(win, ValidRegion(coord, output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEGEMVKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_UNUSED(info);
+
+    vector_matrix_multiply_t1xw_f32(_input0, _input1, _output, window);
+}
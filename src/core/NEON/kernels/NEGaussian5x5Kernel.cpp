@@ -34,6 +34,7 @@
 #include <arm_neon.h>
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 using namespace arm_compute;
 
@@ -203,3 +204,133 @@ void NEGaussian5x5VertKernel::run(const Window &window, const ThreadInfo &info)
     },
     input, output);
 }
+
+BorderSize NEGaussian5x5FusedKernel::border_size() const
+{
+    return BorderSize(2);
+}
+
+void NEGaussian5x5FusedKernel::configure(const ITensor *input, ITensor *output, bool border_undefined)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
+
+    _input  = input;
+    _output = output;
+
+    // Configure kernel window
+    constexpr unsigned int num_elems_processed_per_iteration = 8;
+    constexpr unsigned int num_elems_read_per_iteration      = 16;
+    constexpr unsigned int num_elems_written_per_iteration   = 8;
+    constexpr unsigned int num_rows_read_per_iteration       = 5;
+
+    Window                 win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration), border_undefined, border_size());
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_written_per_iteration);
+
+    update_window_and_padding(win,
+                              AccessWindowRectangle(input->info(), -border_size().left, -border_size().top, num_elems_read_per_iteration, num_rows_read_per_iteration),
+                              output_access);
+
+    output_access.set_valid_region(win, input->info()->valid_region(), border_undefined, border_size());
+
+    INEKernel::configure(win);
+}
+
+void NEGaussian5x5FusedKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int x_start = window.x().start();
+    const int width   = window.x().end() - x_start;
+    const int y_start = window.y().start();
+    const int y_end   = window.y().end();
+
+    const int in_stride_y  = _input->info()->strides_in_bytes()[1];
+    const int out_stride_y = _output->info()->strides_in_bytes()[1];
+
+    // Ring buffer holding the five horizontally filtered rows the vertical pass consumes.
+    // Sized to the strip width so the intermediate stays cache resident
+    std::vector<int16_t> ring(5 * width);
+
+    static const int16x8_t six      = vdupq_n_s16(6);
+    static const int16x8_t four     = vdupq_n_s16(4);
+    const uint16x8_t       six_u16  = vdupq_n_u16(6);
+    const uint16x8_t       four_u16 = vdupq_n_u16(4);
+
+    // Process one plane at a time; the ring buffer carries state across the rows of a plane
+    Window win_plane(window);
+    win_plane.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win_plane.set(Window::DimY, Window::Dimension(0, 1, 1));
+
+    execute_window_loop(win_plane, [&](const Coordinates & id)
+    {
+        const uint8_t *in_base  = _input->ptr_to_element(id);
+        uint8_t *const out_base = _output->ptr_to_element(id);
+
+        // Slot of an absolute input row in the ring buffer
+        auto ring_row = [&](int y)
+        {
+            return ring.data() + ((y - y_start + 2) % 5) * width;
+        };
+
+        // Horizontal pass for a single row
+        auto filter_row = [&](int y)
+        {
+            const uint8_t *src = in_base + y * in_stride_y + x_start - 2;
+            int16_t       *dst = ring_row(y);
+
+            for(int x = 0; x < width; x += 8, src += 8)
+            {
+                const uint8x16_t data = vld1q_u8(src);
+
+                const int16x8x2_t data_s16 =
+                {
+                    {
+                        vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(data))),
+                        vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(data)))
+                    }
+                };
+
+                int16x8_t res = vaddq_s16(data_s16.val[0], vextq_s16(data_s16.val[0], data_s16.val[1], 4));
+                res           = vmlaq_s16(res, vextq_s16(data_s16.val[0], data_s16.val[1], 1), four);
+                res           = vmlaq_s16(res, vextq_s16(data_s16.val[0], data_s16.val[1], 2), six);
+                res           = vmlaq_s16(res, vextq_s16(data_s16.val[0], data_s16.val[1], 3), four);
+
+                vst1q_s16(dst + x, res);
+            }
+        };
+
+        // Prime the ring with the rows above the first output row
+        for(int y = y_start - 2; y < y_start + 2; ++y)
+        {
+            filter_row(y);
+        }
+
+        for(int y = y_start; y < y_end; ++y)
+        {
+            // Produce the one newly needed row, then consume the five resident ones
+            filter_row(y + 2);
+
+            const auto top2 = reinterpret_cast<const uint16_t *>(ring_row(y - 2));
+            const auto top  = reinterpret_cast<const uint16_t *>(ring_row(y - 1));
+            const auto mid  = reinterpret_cast<const uint16_t *>(ring_row(y));
+            const auto low  = reinterpret_cast<const uint16_t *>(ring_row(y + 1));
+            const auto low2 = reinterpret_cast<const uint16_t *>(ring_row(y + 2));
+
+            uint8_t *dst = out_base + y * out_stride_y + x_start;
+
+            for(int x = 0; x < width; x += 8)
+            {
+                uint16x8_t res = vld1q_u16(top2 + x);
+                res            = vmlaq_u16(res, vld1q_u16(top + x), four_u16);
+                res            = vmlaq_u16(res, vld1q_u16(mid + x), six_u16);
+                res            = vmlaq_u16(res, vld1q_u16(low + x), four_u16);
+                res            = vaddq_u16(res, vld1q_u16(low2 + x));
+
+                vst1_u8(dst + x, vqshrn_n_u16(res, 8));
+            }
+        }
+    });
+}
@@ -279,3 +279,157 @@ void NEGaussianPyramidVertKernel::run(const Window &window, const ThreadInfo &in
     },
     in, out);
 }
+
+namespace
+{
+/** Convolve 16 pixels of one input row horizontally and decimate to 8 results.
+ *
+ * The result is the horizontal pass of the two-pass pyramid kernels, kept in
+ * registers instead of being stored to the intermediate S16 image.
+ */
+inline uint16x8_t convolve_row_u8(const uint8_t *in_ptr)
+{
+    static const int16x8_t six  = vdupq_n_s16(6);
+    static const int16x8_t four = vdupq_n_s16(4);
+
+    const uint8x16x2_t data_2q   = vld2q_u8(in_ptr);
+    const uint8x16_t &data_even = data_2q.val[0];
+    const uint8x16_t &data_odd  = data_2q.val[1];
+
+    const int16x8_t data_l2 = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(data_even)));
+    const int16x8_t data_l1 = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(data_odd)));
+    const int16x8_t data_m  = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(vextq_u8(data_even, data_even, 1))));
+    const int16x8_t data_r1 = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(vextq_u8(data_odd, data_odd, 1))));
+    const int16x8_t data_r2 = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(vextq_u8(data_even, data_even, 2))));
+
+    int16x8_t out_val = vaddq_s16(data_l2, data_r2);
+    out_val           = vmlaq_s16(out_val, data_l1, four);
+    out_val           = vmlaq_s16(out_val, data_m, six);
+    out_val           = vmlaq_s16(out_val, data_r1, four);
+
+    return vreinterpretq_u16_s16(out_val);
+}
+} // namespace
+
+NEGaussianPyramidFusedKernel::NEGaussianPyramidFusedKernel()
+    : _l2_load_offset(0), _t2_load_offset(0)
+{
+}
+
+BorderSize NEGaussianPyramidFusedKernel::border_size() const
+{
+    return BorderSize(2);
+}
+
+void NEGaussianPyramidFusedKernel::configure(const ITensor *input, ITensor *output, bool border_undefined)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON(input->info()->dimension(0) != 2 * output->info()->dimension(0));
+    ARM_COMPUTE_ERROR_ON(input->info()->dimension(1) != 2 * output->info()->dimension(1));
+
+    for(size_t i = 2; i < Coordinates::num_max_dimensions; ++i)
+    {
+        ARM_COMPUTE_ERROR_ON(input->info()->dimension(i) != output->info()->dimension(i));
+    }
+
+    _input  = input;
+    _output = output;
+
+    // Configure kernel window
+    constexpr unsigned int num_elems_processed_per_iteration = 16;
+    constexpr unsigned int num_rows_processed_per_iteration  = 2;
+
+    constexpr unsigned int num_elems_written_per_iteration = 8;
+    constexpr unsigned int num_rows_written_per_iteration  = 1;
+
+    constexpr unsigned int num_elems_read_per_iteration = 32;
+    constexpr unsigned int num_rows_read_per_iteration  = 5;
+
+    constexpr float scale_x = 0.5f;
+    constexpr float scale_y = 0.5f;
+
+    Window                win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration, num_rows_processed_per_iteration), border_undefined, border_size());
+    AccessWindowRectangle output_access(output->info(), 0, 0, num_elems_written_per_iteration, num_rows_written_per_iteration, scale_x, scale_y);
+
+    // Determine whether even or odd pixels and rows have to be loaded. See the
+    // horizontal kernel above for a detailed explanation.
+    _l2_load_offset = -border_size().left;
+
+    if((_input->info()->valid_region().anchor[0] + _input->info()->valid_region().shape[0]) % 2 == 0)
+    {
+        _l2_load_offset += 1;
+    }
+
+    _t2_load_offset = -border_size().top;
+
+    if((_input->info()->valid_region().anchor[1] + _input->info()->valid_region().shape[1]) % 2 == 0)
+    {
+        _t2_load_offset += 1;
+    }
+
+    update_window_and_padding(win,
+                              AccessWindowRectangle(input->info(), _l2_load_offset, _t2_load_offset, num_elems_read_per_iteration, num_rows_read_per_iteration),
+                              output_access);
+
+    ValidRegion valid_region = input->info()->valid_region();
+    valid_region.anchor.set(0, std::ceil((valid_region.anchor[0] + (border_undefined ? border_size().left : 0)) / 2.f));
+    valid_region.shape.set(0, (valid_region.shape[0] - (border_undefined ? border_size().right : 0)) / 2 - valid_region.anchor[0]);
+    valid_region.anchor.set(1, std::ceil((valid_region.anchor[1] + (border_undefined ? border_size().top : 0)) / 2.f));
+    valid_region.shape.set(1, (valid_region.shape[1] - (border_undefined ? border_size().bottom : 0)) / 2 - valid_region.anchor[1]);
+
+    output_access.set_valid_region(win, valid_region);
+
+    INEKernel::configure(win);
+}
+
+void NEGaussianPyramidFusedKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(window.x().step() % 2);
+    ARM_COMPUTE_ERROR_ON(window.y().step() % 2);
+    ARM_COMPUTE_ERROR_ON(_input->buffer() == nullptr);
+
+    static const uint16x8_t six  = vdupq_n_u16(6);
+    static const uint16x8_t four = vdupq_n_u16(4);
+
+    Window win_in(window);
+    win_in.shift(Window::DimX, _l2_load_offset);
+    win_in.shift(Window::DimY, _t2_load_offset);
+
+    Iterator in(_input, win_in);
+
+    // The output is half the width and height of the input
+    Window win_out(window);
+    win_out.scale(Window::DimX, 0.5f);
+    win_out.scale(Window::DimY, 0.5f);
+
+    Iterator out(_output, win_out);
+
+    const uint8_t *input_top2_ptr = _input->buffer() + _input->info()->offset_element_in_bytes(Coordinates(0, 0));
+    const uint8_t *input_top_ptr  = _input->buffer() + _input->info()->offset_element_in_bytes(Coordinates(0, 1));
+    const uint8_t *input_mid_ptr  = _input->buffer() + _input->info()->offset_element_in_bytes(Coordinates(0, 2));
+    const uint8_t *input_low_ptr  = _input->buffer() + _input->info()->offset_element_in_bytes(Coordinates(0, 3));
+    const uint8_t *input_low2_ptr = _input->buffer() + _input->info()->offset_element_in_bytes(Coordinates(0, 4));
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        // Convolve the five rows horizontally, keeping the results in registers
+        const uint16x8_t row_t2 = convolve_row_u8(input_top2_ptr + in.offset());
+        const uint16x8_t row_t1 = convolve_row_u8(input_top_ptr + in.offset());
+        const uint16x8_t row_m  = convolve_row_u8(input_mid_ptr + in.offset());
+        const uint16x8_t row_b1 = convolve_row_u8(input_low_ptr + in.offset());
+        const uint16x8_t row_b2 = convolve_row_u8(input_low2_ptr + in.offset());
+
+        // Vertical pass over the in-register rows
+        uint16x8_t out_val = vaddq_u16(row_t2, row_b2);
+        out_val            = vmlaq_u16(out_val, row_t1, four);
+        out_val            = vmlaq_u16(out_val, row_m, six);
+        out_val            = vmlaq_u16(out_val, row_b1, four);
+
+        vst1_u8(out.ptr(), vqshrn_n_u16(out_val, 8));
+    },
+    in, out);
+}
@@ -27,6 +27,7 @@
 #include "arm_compute/core/HOGInfo.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/IAccessWindow.h"
+#include "arm_compute/core/NEON/NEMath.h"
 #include "arm_compute/core/Validate.h"
 
 #include <algorithm>
@@ -290,6 +291,18 @@ void cell_width_ge8(const int16_t *__restrict mag_row_ptr, const uint8_t *__rest
     }
 }
 
+/** Compute 1 / (sqrt(sum) + bias) through reciprocal estimates with Newton-Raphson
+ *  refinement instead of a scalar square root followed by a division.
+ *
+ * @note rsqrt(0) is infinite, so a zero sum (empty block) short-circuits to sqrt(sum) = 0.
+ */
+inline float inv_sqrt_denominator(float sum, float bias)
+{
+    const float sqrt_sum = (sum > 0.0f) ? sum * vget_lane_f32(vinvsqrt_f32(vdup_n_f32(sum)), 0) : 0.0f;
+
+    return vget_lane_f32(vinv_f32(vdup_n_f32(sqrt_sum + bias)), 0);
+}
+
 void l2_norm(const float *__restrict input_row_ptr, float *__restrict output_ptr, size_t input_stride,
              size_t num_cells_per_block_height, size_t num_bins_block_x, size_t num_bins_block, float l2_hyst_threshold)
 {
@@ -345,7 +358,7 @@ void l2_norm(const float *__restrict input_row_ptr, float *__restrict output_ptr
     sum += vgetq_lane_f32(sum_f32, 2);
     sum += vgetq_lane_f32(sum_f32, 3);
 
-    const float       scale     = 1.0f / (std::sqrt(sum) + num_bins_block * 0.1f);
+    const float       scale     = inv_sqrt_denominator(sum, num_bins_block * 0.1f);
     const float32x4_t scale_f32 = vdupq_n_f32(scale);
 
     int32_t i = 0;
@@ -433,7 +446,7 @@ void l2hys_norm(const float *__restrict input_row_ptr, float *__restrict output_
     sum += vgetq_lane_f32(sum_f32, 2);
     sum += vgetq_lane_f32(sum_f32, 3);
 
-    float             scale                 = 1.0f / (std::sqrt(sum) + num_bins_block * 0.1f);
+    float             scale                 = inv_sqrt_denominator(sum, num_bins_block * 0.1f);
     float32x4_t       scale_f32             = vdupq_n_f32(scale);
     const float32x4_t l2_hyst_threshold_f32 = vdupq_n_f32(l2_hyst_threshold);
 
@@ -497,7 +510,7 @@ void l2hys_norm(const float *__restrict input_row_ptr, float *__restrict output_
     }
 
     // We use the same constants of OpenCV
-    scale     = 1.0f / (std::sqrt(sum) + 1e-3f);
+    scale     = inv_sqrt_denominator(sum, 1e-3f);
     scale_f32 = vdupq_n_f32(scale);
 
     // Rescale
@@ -588,7 +601,7 @@ void l1_norm(const float *__restrict input_row_ptr, float *__restrict output_ptr
     sum += vgetq_lane_f32(sum_f32, 2);
     sum += vgetq_lane_f32(sum_f32, 3);
 
-    const float       scale     = 1.0f / (std::sqrt(sum) + num_bins_block * 0.1f);
+    const float       scale     = inv_sqrt_denominator(sum, num_bins_block * 0.1f);
     const float32x4_t scale_f32 = vdupq_n_f32(scale);
 
     int32_t i = 0;
@@ -622,6 +635,103 @@ void l1_norm(const float *__restrict input_row_ptr, float *__restrict output_ptr
         output_ptr[i] *= scale;
     }
 }
+
+void l1sqrt_norm(const float *__restrict input_row_ptr, float *__restrict output_ptr, size_t input_stride, size_t num_cells_per_block_height, size_t num_bins_block_x, size_t num_bins_block,
+                 float l2_hyst_threshold)
+{
+    ARM_COMPUTE_UNUSED(l2_hyst_threshold);
+
+    float       sum     = 0.0f;
+    float32x4_t sum_f32 = vdupq_n_f32(0.0f);
+
+    // Compute L1-Sqrt
+    for(size_t yc = 0; yc < num_cells_per_block_height; ++yc)
+    {
+        const float *const hist_ptr = input_row_ptr + yc * input_stride;
+
+        int32_t xc = 0;
+
+        for(; xc <= static_cast<int32_t>(num_bins_block_x) - 16; xc += 16)
+        {
+            const float32x4x4_t input_value =
+            {
+                {
+                    vld1q_f32(hist_ptr + xc + 0),
+                    vld1q_f32(hist_ptr + xc + 4),
+                    vld1q_f32(hist_ptr + xc + 8),
+                    vld1q_f32(hist_ptr + xc + 12)
+                }
+            };
+
+            // Compute |input_value|
+            sum_f32 += vabsq_f32(input_value.val[0]);
+            sum_f32 += vabsq_f32(input_value.val[1]);
+            sum_f32 += vabsq_f32(input_value.val[2]);
+            sum_f32 += vabsq_f32(input_value.val[3]);
+
+            vst1q_f32(&output_ptr[xc + 0 + yc * num_bins_block_x], input_value.val[0]);
+            vst1q_f32(&output_ptr[xc + 4 + yc * num_bins_block_x], input_value.val[1]);
+            vst1q_f32(&output_ptr[xc + 8 + yc * num_bins_block_x], input_value.val[2]);
+            vst1q_f32(&output_ptr[xc + 12 + yc * num_bins_block_x], input_value.val[3]);
+        }
+
+        for(; xc < static_cast<int32_t>(num_bins_block_x); xc++)
+        {
+            const float input_value = hist_ptr[xc];
+
+            sum += std::abs(input_value);
+
+            output_ptr[xc + yc * num_bins_block_x] = input_value;
+        }
+    }
+
+    sum += vgetq_lane_f32(sum_f32, 0);
+    sum += vgetq_lane_f32(sum_f32, 1);
+    sum += vgetq_lane_f32(sum_f32, 2);
+    sum += vgetq_lane_f32(sum_f32, 3);
+
+    // Normalize by the L1 norm and take the element-wise square root
+    const float       scale     = vget_lane_f32(vinv_f32(vdup_n_f32(sum + num_bins_block * 0.1f)), 0);
+    const float32x4_t scale_f32 = vdupq_n_f32(scale);
+    const float32x4_t zero_f32  = vdupq_n_f32(0.0f);
+
+    int32_t i = 0;
+
+    for(; i <= static_cast<int32_t>(num_bins_block) - 16; i += 16)
+    {
+        float32x4x4_t input_value =
+        {
+            {
+                vld1q_f32(&output_ptr[i + 0]),
+                vld1q_f32(&output_ptr[i + 4]),
+                vld1q_f32(&output_ptr[i + 8]),
+                vld1q_f32(&output_ptr[i + 12])
+            }
+        };
+
+        // Scale input_value
+        input_value.val[0] = vmulq_f32(input_value.val[0], scale_f32);
+        input_value.val[1] = vmulq_f32(input_value.val[1], scale_f32);
+        input_value.val[2] = vmulq_f32(input_value.val[2], scale_f32);
+        input_value.val[3] = vmulq_f32(input_value.val[3], scale_f32);
+
+        // sqrt(x) = x * rsqrt(x); rsqrt(0) is infinite, so force those lanes back to zero
+        input_value.val[0] = vbslq_f32(vceqq_f32(input_value.val[0], zero_f32), zero_f32, vmulq_f32(input_value.val[0], vinvsqrtq_f32(input_value.val[0])));
+        input_value.val[1] = vbslq_f32(vceqq_f32(input_value.val[1], zero_f32), zero_f32, vmulq_f32(input_value.val[1], vinvsqrtq_f32(input_value.val[1])));
+        input_value.val[2] = vbslq_f32(vceqq_f32(input_value.val[2], zero_f32), zero_f32, vmulq_f32(input_value.val[2], vinvsqrtq_f32(input_value.val[2])));
+        input_value.val[3] = vbslq_f32(vceqq_f32(input_value.val[3], zero_f32), zero_f32, vmulq_f32(input_value.val[3], vinvsqrtq_f32(input_value.val[3])));
+
+        vst1q_f32(&output_ptr[i + 0], input_value.val[0]);
+        vst1q_f32(&output_ptr[i + 4], input_value.val[1]);
+        vst1q_f32(&output_ptr[i + 8], input_value.val[2]);
+        vst1q_f32(&output_ptr[i + 12], input_value.val[3]);
+    }
+
+    for(; i < static_cast<int32_t>(num_bins_block); ++i)
+    {
+        output_ptr[i] = std::sqrt(output_ptr[i] * scale);
+    }
+}
 } // namespace
 
 NEHOGOrientationBinningKernel::NEHOGOrientationBinningKernel()
@@ -745,6 +855,9 @@ void NEHOGBlockNormalizationKernel::configure(const ITensor *input, ITensor *out
         case HOGNormType::L1_NORM:
             _func = &l1_norm;
             break;
+        case HOGNormType::L1SQRT_NORM:
+            _func = &l1sqrt_norm;
+            break;
         default:
             ARM_COMPUTE_ERROR_ON("Normalisation type not supported");
             break;
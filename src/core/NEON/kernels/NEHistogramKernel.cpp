@@ -33,7 +33,7 @@
 
 #include <algorithm>
 #include <arm_neon.h>
-#include <array>
+#include <atomic>
 
 using namespace arm_compute;
 
@@ -42,27 +42,69 @@ namespace arm_compute
 class Coordinates;
 } // namespace arm_compute
 
-inline void NEHistogramKernel::merge_histogram(uint32_t *global_hist, const uint32_t *local_hist, size_t bins)
+inline void NEHistogramKernel::merge_histogram(uint32_t *local_hist, size_t bins, unsigned int num_threads)
 {
-    std::lock_guard<arm_compute::Mutex> lock(_hist_mtx);
-
     const unsigned int v_end = (bins / 4) * 4;
 
-    for(unsigned int b = 0; b < v_end; b += 4)
+    for(;;)
     {
-        const uint32x4_t tmp_global = vld1q_u32(global_hist + b);
-        const uint32x4_t tmp_local  = vld1q_u32(local_hist + b);
-        vst1q_u32(global_hist + b, vaddq_u32(tmp_global, tmp_local));
-    }
+        // Grab a parked partial, if any, and fold it into ours
+        uint32_t *other = _pending.exchange(nullptr, std::memory_order_acq_rel);
 
-    for(unsigned int b = v_end; b < bins; ++b)
-    {
-        global_hist[b] += local_hist[b];
+        if(other != nullptr)
+        {
+            for(unsigned int b = 0; b < v_end; b += 4)
+            {
+                const uint32x4_t tmp_local = vld1q_u32(local_hist + b);
+                const uint32x4_t tmp_other = vld1q_u32(other + b);
+                vst1q_u32(local_hist + b, vaddq_u32(tmp_local, tmp_other));
+            }
+
+            for(unsigned int b = v_end; b < bins; ++b)
+            {
+                local_hist[b] += other[b];
+            }
+
+            local_hist[bins] += other[bins];
+            continue;
+        }
+
+        if(local_hist[bins] == num_threads)
+        {
+            // Every partial has been folded into ours: join the result into the
+            // output distribution. No other thread can still be merging.
+            uint32_t *const    global_hist = _output->buffer();
+            const size_t       out_bins    = _output->num_bins();
+            const unsigned int g_end       = (out_bins / 4) * 4;
+
+            for(unsigned int b = 0; b < g_end; b += 4)
+            {
+                const uint32x4_t tmp_global = vld1q_u32(global_hist + b);
+                const uint32x4_t tmp_local  = vld1q_u32(local_hist + b);
+                vst1q_u32(global_hist + b, vaddq_u32(tmp_global, tmp_local));
+            }
+
+            for(unsigned int b = g_end; b < out_bins; ++b)
+            {
+                global_hist[b] += local_hist[b];
+            }
+
+            return;
+        }
+
+        // Park our partial for another thread to fold. If somebody parked
+        // theirs in the meantime, go grab it instead.
+        uint32_t *expected = nullptr;
+
+        if(_pending.compare_exchange_strong(expected, local_hist, std::memory_order_acq_rel))
+        {
+            return;
+        }
     }
 }
 
 NEHistogramKernel::NEHistogramKernel()
-    : _func(nullptr), _input(nullptr), _output(nullptr), _local_hist(nullptr), _window_lut(nullptr), _hist_mtx()
+    : _func(nullptr), _input(nullptr), _output(nullptr), _window_lut(nullptr), _pending(nullptr)
 {
 }
 
@@ -71,20 +113,21 @@ void NEHistogramKernel::histogram_U8(Window win, const ThreadInfo &info)
     ARM_COMPUTE_ERROR_ON(_output->buffer() == nullptr);
 
     const size_t          bins       = _output->num_bins();
-    const int32_t         offset     = _output->offset();
-    const uint32_t        offrange   = offset + _output->range();
     const uint32_t *const w_lut      = _window_lut;
-    uint32_t *const       local_hist = _local_hist + info.thread_id * bins;
+    uint32_t *const       local_hist = static_cast<uint32_t *>(info.workspace);
+
+    ARM_COMPUTE_ERROR_ON(local_hist == nullptr);
+    ARM_COMPUTE_ERROR_ON(info.workspace_size < (bins + 2) * sizeof(uint32_t));
 
-    // Clear local_histogram
-    std::fill_n(local_hist, bins, 0);
+    // Clear local histogram, including the overflow bin the LUT routes
+    // out-of-range pixels to
+    std::fill_n(local_hist, bins + 1, 0);
 
     auto update_local_hist = [&](uint8_t p)
     {
-        if(offset <= p && p < offrange)
-        {
-            ++local_hist[w_lut[p]];
-        }
+        // The LUT maps out-of-range pixels to the overflow bin, so no range
+        // check is needed here
+        ++local_hist[w_lut[p]];
     };
 
     const unsigned int x_start = win.x().start();
@@ -126,15 +169,21 @@ void NEHistogramKernel::histogram_U8(Window win, const ThreadInfo &info)
     input);
 
     // Merge histograms
-    merge_histogram(_output->buffer(), local_hist, bins);
+    local_hist[bins + 1] = 1;
+    merge_histogram(local_hist, bins + 1, info.num_threads);
 }
 
 void NEHistogramKernel::histogram_fixed_U8(Window win, const ThreadInfo &info)
 {
-    ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_ERROR_ON(_output->buffer() == nullptr);
 
-    std::array<uint32_t, _max_range_size> local_hist{ { 0 } };
+    uint32_t *const local_hist = static_cast<uint32_t *>(info.workspace);
+
+    ARM_COMPUTE_ERROR_ON(local_hist == nullptr);
+    ARM_COMPUTE_ERROR_ON(info.workspace_size < (_max_range_size + 1) * sizeof(uint32_t));
+
+    // Clear local histogram
+    std::fill_n(local_hist, _max_range_size, 0);
 
     const unsigned int x_start = win.x().start();
     const unsigned int x_end   = win.x().end();
@@ -175,34 +224,36 @@ void NEHistogramKernel::histogram_fixed_U8(Window win, const ThreadInfo &info)
     input);
 
     // Merge histograms
-    merge_histogram(_output->buffer(), local_hist.data(), _max_range_size);
+    local_hist[_max_range_size] = 1;
+    merge_histogram(local_hist, _max_range_size, info.num_threads);
 }
 
 void NEHistogramKernel::calculate_window_lut() const
 {
-    const int32_t  offset = _output->offset();
-    const size_t   bins   = _output->num_bins();
-    const uint32_t range  = _output->range();
+    const int32_t  offset   = _output->offset();
+    const size_t   bins     = _output->num_bins();
+    const uint32_t range    = _output->range();
+    const uint32_t offrange = offset + range;
 
-    std::fill_n(_window_lut, offset, 0);
+    // Out-of-range pixels are routed to a spare overflow bin behind the real
+    // ones, which keeps the run loops branchless
+    std::fill_n(_window_lut, offset, bins);
 
     for(unsigned int p = offset; p < _max_range_size; ++p)
     {
-        _window_lut[p] = ((p - offset) * bins) / range;
+        _window_lut[p] = (p < offrange) ? ((p - offset) * bins) / range : bins;
     }
 }
 
-void NEHistogramKernel::configure(const IImage *input, IDistribution1D *output, uint32_t *local_hist, uint32_t *window_lut)
+void NEHistogramKernel::configure(const IImage *input, IDistribution1D *output, uint32_t *window_lut)
 {
     ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON(nullptr == output);
-    ARM_COMPUTE_ERROR_ON(nullptr == local_hist);
     ARM_COMPUTE_ERROR_ON(nullptr == window_lut);
 
     _input      = input;
     _output     = output;
-    _local_hist = local_hist;
     _window_lut = window_lut;
 
     //Check offset
@@ -56,11 +56,13 @@ inline void linearize_volume(const uint8_t *const in_ptr,
                              int                  input_stride_x,
                              int                  input_stride_y,
                              int                  input_stride_z,
-                             int                  fixed_point_position)
+                             int                  fixed_point_position,
+                             int                  dilation_x,
+                             int                  dilation_y)
 {
     const int kernel_size2 = kernel_width * kernel_height;
-    const int x_e          = top_left_x + kernel_width;
-    const int y_e          = top_left_y + kernel_height;
+    const int x_e          = top_left_x + kernel_width * dilation_x;
+    const int y_e          = top_left_y + kernel_height * dilation_y;
 
     // Linearize volume
     int d = 0;
@@ -69,12 +71,12 @@ inline void linearize_volume(const uint8_t *const in_ptr,
     // 2) to have an optimized im2col for the first convolution layer where usually we have 3 IFMs
     for(; d <= (kernel_depth - 3); d += 3)
     {
-        for(int y = top_left_y; y < y_e; ++y)
+        for(int y = top_left_y; y < y_e; y += dilation_y)
         {
             if((y < 0 || y >= input_h) && has_pads)
             {
                 // All the values will be zeros
-                for(int x = top_left_x; x < x_e; ++x, ++out_ptr)
+                for(int x = top_left_x; x < x_e; x += dilation_x, ++out_ptr)
                 {
                     *(out_ptr + 0 * kernel_size2) = 0;
                     *(out_ptr + 1 * kernel_size2) = 0;
@@ -83,7 +85,7 @@ inline void linearize_volume(const uint8_t *const in_ptr,
             }
             else
             {
-                for(int x = top_left_x; x < x_e; ++x, ++out_ptr)
+                for(int x = top_left_x; x < x_e; x += dilation_x, ++out_ptr)
                 {
                     if((x < 0 || x >= input_w) && has_pads)
                     {
@@ -106,7 +108,7 @@ inline void linearize_volume(const uint8_t *const in_ptr,
     // Left over
     for(; d < kernel_depth; d++)
     {
-        for(int y = top_left_y; y < y_e; ++y)
+        for(int y = top_left_y; y < y_e; y += dilation_y)
         {
             if((y < 0 || y >= input_h) && has_pads)
             {
@@ -114,9 +116,15 @@ inline void linearize_volume(const uint8_t *const in_ptr,
                 memset(out_ptr, 0, kernel_width * sizeof(T));
                 out_ptr += kernel_width;
             }
+            else if((dilation_x == 1) && (!has_pads || (top_left_x >= 0 && x_e <= input_w)))
+            {
+                // Dense kernel row which is fully inside the input: copy it in one go
+                memcpy(out_ptr, in_ptr + (d * input_stride_z + y * input_stride_y + top_left_x * input_stride_x), kernel_width * sizeof(T));
+                out_ptr += kernel_width;
+            }
             else
             {
-                for(int x = top_left_x; x < x_e; ++x, ++out_ptr)
+                for(int x = top_left_x; x < x_e; x += dilation_x, ++out_ptr)
                 {
                     if((x < 0 || x >= input_w) && has_pads)
                     {
@@ -213,7 +221,9 @@ void NEIm2ColKernel::run_generic(const Window &window)
                                       input_stride_x,
                                       input_stride_y,
                                       input_stride_z,
-                                      _input->info()->fixed_point_position());
+                                      _input->info()->fixed_point_position(),
+                                      static_cast<int>(_dilation.width),
+                                      static_cast<int>(_dilation.height));
     },
     in, out);
 }
@@ -271,23 +281,28 @@ void NEIm2ColKernel::run_reduced(const Window &window)
 }
 
 NEIm2ColKernel::NEIm2ColKernel()
-    : _func(), _input(nullptr), _output(nullptr), _convolved_dims(), _conv_info(), _kernel_width(0), _kernel_height(0), _has_bias(false)
+    : _func(), _input(nullptr), _output(nullptr), _convolved_dims(), _conv_info(), _kernel_width(0), _kernel_height(0), _dilation(1U, 1U), _has_bias(false)
 {
 }
 
-void NEIm2ColKernel::configure(const ITensor *input, ITensor *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info, bool has_bias)
+void NEIm2ColKernel::configure(const ITensor *input, ITensor *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info, bool has_bias, const Size2D &dilation)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32, DataType::QS8, DataType::QS16);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_FIXED_POINT_POSITION(input, output);
 
-    _input          = input;
-    _output         = output;
-    _conv_info      = conv_info;
-    _kernel_width   = kernel_dims.width;
-    _kernel_height  = kernel_dims.height,
+    ARM_COMPUTE_ERROR_ON(dilation.width == 0 || dilation.height == 0);
+
+    _input         = input;
+    _output        = output;
+    _conv_info     = conv_info;
+    _kernel_width  = kernel_dims.width;
+    _kernel_height = kernel_dims.height;
+    _dilation      = dilation;
+
+    // The dilated kernel covers ((size - 1) * dilation + 1) input elements in each dimension
     _convolved_dims = scaled_dimensions(input->info()->dimension(0), input->info()->dimension(1),
-                                        _kernel_width, _kernel_height,
+                                        (_kernel_width - 1) * _dilation.width + 1, (_kernel_height - 1) * _dilation.height + 1,
                                         _conv_info);
     _has_bias = has_bias;
 
@@ -302,7 +317,8 @@ void NEIm2ColKernel::configure(const ITensor *input, ITensor *output, const Size
                                && (std::equal(input->info()->tensor_shape().cbegin() + 3,
                                               input->info()->tensor_shape().cend(),
                                               output->info()->tensor_shape().cbegin() + 1))
-                               && ((stride_x == 1) && (stride_y == 1) && (pad_x == 0) && (pad_y == 0));
+                               && ((stride_x == 1) && (stride_y == 1) && (pad_x == 0) && (pad_y == 0))
+                               && ((dilation.width == 1) && (dilation.height == 1));
 
     Window window = calculate_max_window(*input->info(), Steps());
 
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEImplicitGEMMConvolutionKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <tuple>
+
+using namespace arm_compute;
+
+NEImplicitGEMMConvolutionKernel::NEImplicitGEMMConvolutionKernel()
+    : _input(nullptr), _weights(nullptr), _output(nullptr), _kernel_dims(), _conv_info(), _has_bias(false), _convolved_dims()
+{
+}
+
+void NEImplicitGEMMConvolutionKernel::configure(const ITensor *input, const ITensor *weights, ITensor *output,
+                                                const Size2D &kernel_dims, const PadStrideInfo &conv_info, bool has_bias)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(weights, output);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights, output);
+    ARM_COMPUTE_ERROR_ON_MSG(input->info()->num_dimensions() > 3, "Batched inputs are not supported");
+
+    _convolved_dims = scaled_dimensions(input->info()->dimension(0), input->info()->dimension(1), kernel_dims.width, kernel_dims.height, conv_info);
+
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(0) != _convolved_dims.first);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) != _convolved_dims.second);
+
+    _input       = input;
+    _weights     = weights;
+    _output      = output;
+    _kernel_dims = kernel_dims;
+    _conv_info   = conv_info;
+    _has_bias    = has_bias;
+
+    // Configure kernel window. Each iteration gathers the A operand tile of four output
+    // positions along a row and reuses it for every column block of the weights, so the
+    // OFM dimension is traversed inside the kernel and does not appear in the window
+    constexpr unsigned int num_elems_processed_per_iteration = 4;
+
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, ceil_to_multiple(_convolved_dims.first, num_elems_processed_per_iteration), num_elems_processed_per_iteration));
+    win.set(Window::DimY, Window::Dimension(0, _convolved_dims.second, 1));
+
+    // The kernel computes the input and output offsets itself, no padding is required
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEImplicitGEMMConvolutionKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int kernel_width  = _kernel_dims.width;
+    const int kernel_height = _kernel_dims.height;
+    const int input_width   = _input->info()->dimension(0);
+    const int input_height  = _input->info()->dimension(1);
+    const int input_depth   = _input->info()->dimension(2);
+    const int conv_w        = _convolved_dims.first;
+    const int num_ofms      = _output->info()->dimension(2);
+
+    int stride_x = 0;
+    int stride_y = 0;
+    int pad_x    = 0;
+    int pad_y    = 0;
+    std::tie(stride_x, stride_y) = _conv_info.stride();
+    std::tie(pad_x, pad_y)       = _conv_info.pad();
+
+    const size_t input_stride_x   = _input->info()->strides_in_bytes().x();
+    const size_t input_stride_y   = _input->info()->strides_in_bytes().y();
+    const size_t input_stride_z   = _input->info()->strides_in_bytes().z();
+    const size_t weights_stride_y = _weights->info()->strides_in_bytes().y();
+
+    const uint8_t *input_ptr   = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    const uint8_t *weights_ptr = _weights->buffer() + _weights->info()->offset_first_element_in_bytes();
+
+    // Number of rows of the A operand, matches the rows of the reshaped weights
+    const int tile_k = kernel_width * kernel_height * input_depth + (_has_bias ? 1 : 0);
+
+    // Per-thread scratch arena holding the gathered tile, laid out position innermost
+    auto tile = static_cast<float *>(info.workspace);
+    ARM_COMPUTE_ERROR_ON(tile == nullptr);
+    ARM_COMPUTE_ERROR_ON(info.workspace_size < static_cast<size_t>(4 * tile_k) * sizeof(float));
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int out_x   = id.x();
+        const int out_y   = id.y();
+        const int num_pos = std::min(4, conv_w - out_x);
+
+        // Gather the A operand tile directly from the input with computed offsets. The
+        // element order matches the im2col/weights reshape order (kernel_x innermost,
+        // then kernel_y, then IFM); out of bound accesses are zero filled like im2col
+        int k = 0;
+        for(int ifm = 0; ifm < input_depth; ++ifm)
+        {
+            for(int ky = 0; ky < kernel_height; ++ky)
+            {
+                const int in_y = out_y * stride_y - pad_y + ky;
+                for(int kx = 0; kx < kernel_width; ++kx, ++k)
+                {
+                    for(int p = 0; p < num_pos; ++p)
+                    {
+                        const int  in_x  = (out_x + p) * stride_x - pad_x + kx;
+                        const bool valid = (in_x >= 0) && (in_x < input_width) && (in_y >= 0) && (in_y < input_height);
+                        tile[k * 4 + p]  = valid ? *reinterpret_cast<const float *>(input_ptr + ifm * input_stride_z + in_y * input_stride_y + in_x * input_stride_x) : 0.f;
+                    }
+                    for(int p = num_pos; p < 4; ++p)
+                    {
+                        tile[k * 4 + p] = 0.f;
+                    }
+                }
+            }
+        }
+        if(_has_bias)
+        {
+            for(int p = 0; p < 4; ++p)
+            {
+                tile[k * 4 + p] = 1.f;
+            }
+        }
+
+        // Multiply the tile against every column block of the 1xW transposed weights. Each
+        // row of the transposed weights holds four consecutive OFM values per A operand row
+        for(int ofm = 0; ofm < num_ofms; ofm += 4)
+        {
+            const auto b_ptr = reinterpret_cast<const float *>(weights_ptr + (ofm / 4) * weights_stride_y);
+
+            float32x4_t acc0 = vdupq_n_f32(0.f);
+            float32x4_t acc1 = vdupq_n_f32(0.f);
+            float32x4_t acc2 = vdupq_n_f32(0.f);
+            float32x4_t acc3 = vdupq_n_f32(0.f);
+
+            for(int i = 0; i < tile_k; ++i)
+            {
+                const float32x4_t b_vec = vld1q_f32(b_ptr + i * 4);
+                const float32x4_t a_vec = vld1q_f32(tile + i * 4);
+
+                acc0 = vmlaq_lane_f32(acc0, b_vec, vget_low_f32(a_vec), 0);
+                acc1 = vmlaq_lane_f32(acc1, b_vec, vget_low_f32(a_vec), 1);
+                acc2 = vmlaq_lane_f32(acc2, b_vec, vget_high_f32(a_vec), 0);
+                acc3 = vmlaq_lane_f32(acc3, b_vec, vget_high_f32(a_vec), 1);
+            }
+
+            float res[4][4];
+            vst1q_f32(res[0], acc0);
+            vst1q_f32(res[1], acc1);
+            vst1q_f32(res[2], acc2);
+            vst1q_f32(res[3], acc3);
+
+            const int num_ofms_block = std::min(4, num_ofms - ofm);
+            for(int p = 0; p < num_pos; ++p)
+            {
+                for(int o = 0; o < num_ofms_block; ++o)
+                {
+                    *reinterpret_cast<float *>(_output->ptr_to_element(Coordinates(out_x + p, out_y, ofm + o))) = res[p][o];
+                }
+            }
+        }
+    });
+}
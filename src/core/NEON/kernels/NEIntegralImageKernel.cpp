@@ -49,7 +49,7 @@ void NEIntegralImageKernel::configure(const ITensor *input, ITensor *output)
     Window win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration));
     // The kernel is effectively reading 17 values from -1 as it loads 16
     // starting at -1 and also 16 starting at 0
-    AccessWindowRectangle  output_read_access(output->info(), -1, -1, num_elems_processed_per_iteration + 1, 1);
+    AccessWindowRectangle  output_read_access(output->info(), -1, 0, num_elems_processed_per_iteration + 1, 1);
     AccessWindowHorizontal output_write_access(output->info(), 0, num_elems_processed_per_iteration);
 
     update_window_and_padding(win,
@@ -66,11 +66,6 @@ BorderSize NEIntegralImageKernel::border_size() const
     return BorderSize(1, 0, 0, 1);
 }
 
-bool NEIntegralImageKernel::is_parallelisable() const
-{
-    return false;
-}
-
 void NEIntegralImageKernel::run(const Window &window, const ThreadInfo &info)
 {
     ARM_COMPUTE_UNUSED(info);
@@ -80,10 +75,7 @@ void NEIntegralImageKernel::run(const Window &window, const ThreadInfo &info)
     Iterator input(_input, window);
     Iterator output(_output, window);
 
-    const auto output_top_left = reinterpret_cast<const uint32_t *>(_output->ptr_to_element(Coordinates(-1, -1)));
-    const auto output_top_mid  = reinterpret_cast<const uint32_t *>(_output->ptr_to_element(Coordinates(0, -1)));
-
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_window_loop(window, [&](const Coordinates &)
     {
         const uint8x16_t input_pixels = vld1q_u8(input.ptr());
 
@@ -95,7 +87,7 @@ void NEIntegralImageKernel::run(const Window &window, const ThreadInfo &info)
             }
         };
 
-        uint32x4x4_t pixels =
+        const uint32x4x4_t pixels =
         {
             {
                 vmovl_u16(vget_low_u16(tmp.val[0])),
@@ -105,34 +97,15 @@ void NEIntegralImageKernel::run(const Window &window, const ThreadInfo &info)
             }
         };
 
-        // Divide by four as pointer is now uint32 instead of uint8!
-        const size_t off = output.offset() / 4;
-
-        // Add top mid pixel values
-        const uint32_t *const top_mid_ptr = output_top_mid + off;
-
-        pixels.val[0] = vaddq_u32(vld1q_u32(top_mid_ptr), pixels.val[0]);
-        pixels.val[1] = vaddq_u32(vld1q_u32(top_mid_ptr + 4), pixels.val[1]);
-        pixels.val[2] = vaddq_u32(vld1q_u32(top_mid_ptr + 8), pixels.val[2]);
-        pixels.val[3] = vaddq_u32(vld1q_u32(top_mid_ptr + 12), pixels.val[3]);
+        const auto outptr = reinterpret_cast<uint32_t *>(output.ptr());
 
-        // Subtract top left diagonal values
-        const auto            outptr       = reinterpret_cast<uint32_t *>(output.ptr());
-        const uint32_t *const top_left_ptr = output_top_left + off;
-
-        pixels.val[0] = vsubq_u32(pixels.val[0], vld1q_u32(top_left_ptr));
         vst1q_u32(outptr, pixels.val[0]);
-
-        pixels.val[1] = vsubq_u32(pixels.val[1], vld1q_u32(top_left_ptr + 4));
         vst1q_u32(outptr + 4, pixels.val[1]);
-
-        pixels.val[2] = vsubq_u32(pixels.val[2], vld1q_u32(top_left_ptr + 8));
         vst1q_u32(outptr + 8, pixels.val[2]);
-
-        pixels.val[3] = vsubq_u32(pixels.val[3], vld1q_u32(top_left_ptr + 12));
         vst1q_u32(outptr + 12, pixels.val[3]);
 
-        // Perform prefix summation
+        // Perform prefix summation, pulling in the previous block's carry (the left border
+        // for the first block of each row)
         for(auto i = 0; i < 16; ++i)
         {
             outptr[i] += outptr[i - 1];
@@ -140,3 +113,65 @@ void NEIntegralImageKernel::run(const Window &window, const ThreadInfo &info)
     },
     input, output);
 }
+
+NEIntegralImageVertKernel::NEIntegralImageVertKernel()
+    : _output(nullptr)
+{
+}
+
+void NEIntegralImageVertKernel::configure(ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U32);
+
+    _output = output;
+
+    constexpr unsigned int num_elems_processed_per_iteration = 16;
+
+    Window win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
+
+    update_window_and_padding(win, AccessWindowHorizontal(output->info(), 0, num_elems_processed_per_iteration));
+
+    // The kernel walks the rows of each column strip itself, keeping the running sums in
+    // registers, so the Y dimension is collapsed and dispatches split across column strips
+    win.set(Window::DimY, Window::Dimension(0, 1, 1));
+
+    INEKernel::configure(win);
+}
+
+void NEIntegralImageVertKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const size_t height   = _output->info()->dimension(1);
+    const size_t stride_y = _output->info()->strides_in_bytes()[1];
+
+    Iterator output(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        uint8_t *strip = output.ptr();
+
+        uint32x4_t sum0 = vdupq_n_u32(0);
+        uint32x4_t sum1 = vdupq_n_u32(0);
+        uint32x4_t sum2 = vdupq_n_u32(0);
+        uint32x4_t sum3 = vdupq_n_u32(0);
+
+        for(size_t y = 0; y < height; ++y, strip += stride_y)
+        {
+            const auto row = reinterpret_cast<uint32_t *>(strip);
+
+            sum0 = vaddq_u32(sum0, vld1q_u32(row));
+            sum1 = vaddq_u32(sum1, vld1q_u32(row + 4));
+            sum2 = vaddq_u32(sum2, vld1q_u32(row + 8));
+            sum3 = vaddq_u32(sum3, vld1q_u32(row + 12));
+
+            vst1q_u32(row, sum0);
+            vst1q_u32(row + 4, sum1);
+            vst1q_u32(row + 8, sum2);
+            vst1q_u32(row + 12, sum3);
+        }
+    },
+    output);
+}
@@ -67,6 +67,58 @@ void l2_normalize_X(const ITensor *in, const ITensor *sum, ITensor *out, float e
     }
     while(window.slide_window_slice_1D(in_slice) && window.slide_window_slice_1D(sum_slice));
 }
+
+void l2_normalize_X_fused(const ITensor *in, ITensor *out, float epsilon, const Window &window)
+{
+    const int width = in->info()->dimension(0);
+
+    // Each iteration owns a whole row: X is collapsed so the row is summed and rescaled
+    // back-to-back while still resident in cache
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input_it(in, win);
+    Iterator output_it(out, win);
+
+    execute_window_loop(win, [&](const Coordinates &)
+    {
+        const auto in_ptr  = reinterpret_cast<const float *>(input_it.ptr());
+        const auto out_ptr = reinterpret_cast<float *>(output_it.ptr());
+
+        // First traversal: vectorized sum of squares with a scalar leftover loop, so no
+        // neutral-value border is needed
+        float32x4_t vsum = vdupq_n_f32(0.f);
+        int         x    = 0;
+        for(; x <= width - 4; x += 4)
+        {
+            const float32x4_t data = vld1q_f32(in_ptr + x);
+            vsum                   = vmlaq_f32(vsum, data, data);
+        }
+
+        float32x2_t lanes = vpadd_f32(vget_high_f32(vsum), vget_low_f32(vsum));
+        lanes             = vpadd_f32(lanes, lanes);
+        float sum_value   = vget_lane_f32(lanes, 0);
+
+        for(; x < width; ++x)
+        {
+            sum_value += in_ptr[x] * in_ptr[x];
+        }
+
+        const float       normalize_value     = 1.f / std::sqrt(std::max(sum_value, epsilon));
+        const float32x4_t vec_normalize_value = vdupq_n_f32(normalize_value);
+
+        // Second traversal rescales immediately, while the row is still hot
+        for(x = 0; x <= width - 4; x += 4)
+        {
+            vst1q_f32(out_ptr + x, vmulq_f32(vld1q_f32(in_ptr + x), vec_normalize_value));
+        }
+        for(; x < width; ++x)
+        {
+            out_ptr[x] = in_ptr[x] * normalize_value;
+        }
+    },
+    input_it, output_it);
+}
 } // namespace
 
 NEL2NormalizeKernel::NEL2NormalizeKernel()
@@ -76,7 +128,7 @@ NEL2NormalizeKernel::NEL2NormalizeKernel()
 
 void NEL2NormalizeKernel::configure(const ITensor *input, const ITensor *sum, ITensor *output, unsigned int axis, float epsilon)
 {
-    ARM_COMPUTE_ERROR_ON_NULLPTR(input, sum, output);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
     ARM_COMPUTE_ERROR_ON_MSG(axis >= TensorShape::num_max_dimensions, "Normalization axis greater than max number of dimensions");
     ARM_COMPUTE_ERROR_ON_MSG(axis > 0, "Unsupported normalization axis, Supported axis is 0");
 
@@ -84,18 +136,31 @@ void NEL2NormalizeKernel::configure(const ITensor *input, const ITensor *sum, IT
     auto_init_if_empty(*output->info(), input->info()->tensor_shape(), 1, input->info()->data_type(), input->info()->fixed_point_position());
 
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
-    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output, sum);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, output);
 
-    unsigned int num_elems_processed_per_iteration     = 16 / data_size_from_type(input->info()->data_type());
-    unsigned int num_elems_processed_per_iteration_sum = (axis == 0) ? 1 : num_elems_processed_per_iteration;
-
     _input   = input;
     _sum     = sum;
     _output  = output;
     _axis    = axis;
     _epsilon = epsilon;
 
+    if(sum == nullptr)
+    {
+        // Fused mode: each window iteration covers a whole row, whose sum of squares is
+        // computed and applied in one go. The exact vector loops with a scalar leftover
+        // read no padding, so rows of any length work without a border
+        Window win = calculate_max_window(*input->info(), Steps(static_cast<unsigned int>(input->info()->dimension(0))));
+        output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+        INEKernel::configure(win);
+        return;
+    }
+
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, sum);
+
+    unsigned int num_elems_processed_per_iteration     = 16 / data_size_from_type(input->info()->data_type());
+    unsigned int num_elems_processed_per_iteration_sum = (axis == 0) ? 1 : num_elems_processed_per_iteration;
+
     // Configure kernel window
     Window                 win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration));
     AccessWindowHorizontal input_access(input->info(), 0, num_elems_processed_per_iteration);
@@ -118,7 +183,14 @@ void NEL2NormalizeKernel::run(const Window &window, const ThreadInfo &info)
     switch(_axis)
     {
         case 0:
-            l2_normalize_X(_input, _sum, _output, _epsilon, window);
+            if(_sum != nullptr)
+            {
+                l2_normalize_X(_input, _sum, _output, _epsilon, window);
+            }
+            else
+            {
+                l2_normalize_X_fused(_input, _output, _epsilon, window);
+            }
             break;
         default:
             ARM_COMPUTE_ERROR("Unsupported normalization axis");
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NELSTMCellUpdateKernel.h"
+
+#include "arm_compute/core/AccessWindowStatic.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/IAccessWindow.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEMath.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+
+using namespace arm_compute;
+
+namespace
+{
+inline float32x4_t vsigmoidq_f32(float32x4_t val)
+{
+    return vinvq_f32(vaddq_f32(vdupq_n_f32(1.f), vexpq_f32(vnegq_f32(val))));
+}
+} // namespace
+
+NELSTMCellUpdateKernel::NELSTMCellUpdateKernel()
+    : _gates(nullptr), _cell_state(nullptr), _output(nullptr)
+{
+}
+
+void NELSTMCellUpdateKernel::configure(const ITensor *gates, ITensor *cell_state, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(gates, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(gates, cell_state, output);
+    ARM_COMPUTE_ERROR_ON(gates->info()->num_dimensions() > 1);
+    ARM_COMPUTE_ERROR_ON(cell_state->info()->num_dimensions() > 1);
+    ARM_COMPUTE_ERROR_ON(gates->info()->dimension(0) != 4 * cell_state->info()->dimension(0));
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(0) != cell_state->info()->dimension(0));
+
+    _gates      = gates;
+    _cell_state = cell_state;
+    _output     = output;
+
+    constexpr unsigned int num_elems_processed_per_iteration = 4;
+
+    Window win = calculate_max_window(*cell_state->info(), Steps(num_elems_processed_per_iteration));
+
+    AccessWindowHorizontal cell_state_access(cell_state->info(), 0, num_elems_processed_per_iteration);
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+
+    // The output gate of the last iteration is read at 3 * hidden_size plus the (rounded up) state offset
+    const unsigned int hidden_size = cell_state->info()->dimension(0);
+
+    update_window_and_padding(win,
+                              AccessWindowStatic(gates->info(), 0, 0, 3 * hidden_size + ceil_to_multiple(hidden_size, num_elems_processed_per_iteration), 1),
+                              cell_state_access,
+                              output_access);
+
+    output_access.set_valid_region(win, ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NELSTMCellUpdateKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_UNUSED(info);
+
+    const int hidden_size = _cell_state->info()->dimension(0);
+
+    Iterator gates(_gates, window);
+    Iterator cell(_cell_state, window);
+    Iterator out(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        const auto gates_ptr = reinterpret_cast<const float *>(gates.ptr());
+        const auto cell_ptr  = reinterpret_cast<float *>(cell.ptr());
+        const auto out_ptr   = reinterpret_cast<float *>(out.ptr());
+
+        const float32x4_t in_gate     = vsigmoidq_f32(vld1q_f32(gates_ptr));
+        const float32x4_t forget_gate = vsigmoidq_f32(vld1q_f32(gates_ptr + hidden_size));
+        const float32x4_t cell_gate   = vtanhq_f32(vld1q_f32(gates_ptr + 2 * hidden_size));
+        const float32x4_t out_gate    = vsigmoidq_f32(vld1q_f32(gates_ptr + 3 * hidden_size));
+
+        const float32x4_t cell_state = vmlaq_f32(vmulq_f32(forget_gate, vld1q_f32(cell_ptr)), in_gate, cell_gate);
+
+        vst1q_f32(cell_ptr, cell_state);
+        vst1q_f32(out_ptr, vmulq_f32(out_gate, vtanhq_f32(cell_state)));
+    },
+    gates, cell, out);
+}
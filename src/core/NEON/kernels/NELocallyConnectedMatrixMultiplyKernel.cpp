@@ -23,6 +23,7 @@
  */
 #include "arm_compute/core/NEON/kernels/NELocallyConnectedMatrixMultiplyKernel.h"
 
+#include "arm_compute/core/AccessWindowStatic.h"
 #include "arm_compute/core/AccessWindowTranspose.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
@@ -36,6 +37,7 @@
 #include "arm_compute/core/Window.h"
 
 #include <arm_neon.h>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <tuple>
@@ -302,24 +304,163 @@ void vector_matrix_multiply_f32(const ITensor *input0, const ITensor *input1, IT
     },
     ina, out);
 }
+
+void vector_matrix_multiply_packed_f32(const ITensor *input0, const ITensor *input1, ITensor *output, const Window &window, const ThreadInfo &info)
+{
+    const auto   width_matrix_b    = static_cast<int>(output->info()->dimension(0));
+    const size_t in_b_panel_stride = input1->info()->strides_in_bytes()[1];
+    const auto   num_elems_vec_a   = static_cast<int>(input0->info()->dimension(0));
+
+    // The implementation computes two panels of four outputs per iteration
+    const int window_start_x = 8 * info.thread_id;
+    const int window_step_x  = 8 * info.num_threads;
+    // Make sure (window_end_x - window_start_x) is a multiple of window_step_x
+    const int window_end_x = ceil_to_multiple(width_matrix_b - window_start_x, window_step_x) + window_start_x;
+
+    Window win_out(window);
+    win_out.set(Window::DimX, Window::Dimension(window_start_x, window_end_x, window_step_x));
+
+    Window win_a(window);
+    win_a.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator ina(input0, win_a);
+    Iterator out(output, win_out);
+
+    execute_window_loop(win_out, [&](const Coordinates & id)
+    {
+        if(id.x() >= width_matrix_b)
+        {
+            return;
+        }
+
+        // Both panels of the current output position are walked together so two independent
+        // contiguous streams are in flight, sharing the loads of the input vector
+        auto       vec_a     = reinterpret_cast<const float *>(ina.ptr());
+        const auto vec_a_end = vec_a + num_elems_vec_a;
+        auto       matrix_b0 = reinterpret_cast<const float *>(input1->ptr_to_element(Coordinates(0, id.x() / 4, id[1])));
+        auto       matrix_b1 = reinterpret_cast<const float *>(reinterpret_cast<const uint8_t *>(matrix_b0) + in_b_panel_stride);
+
+        float32x4_t acc00 = vdupq_n_f32(0.f);
+        float32x4_t acc01 = vdupq_n_f32(0.f);
+        float32x4_t acc10 = vdupq_n_f32(0.f);
+        float32x4_t acc11 = vdupq_n_f32(0.f);
+
+        if(id.x() + 4 < width_matrix_b)
+        {
+#if __arm__
+            asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(vec_a)));
+            asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(matrix_b0)));
+            asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(matrix_b1)));
+#endif /* __arm__ */
+
+            for(; vec_a <= (vec_a_end - 4); vec_a += 4, matrix_b0 += 16, matrix_b1 += 16)
+            {
+                const float32x2_t a0l = vld1_f32(vec_a);
+                const float32x2_t a0h = vld1_f32(vec_a + 2);
+
+#if __arm__
+                asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(matrix_b0)));
+                asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(matrix_b1)));
+#endif /* __arm__ */
+
+                acc00 = vmlaq_lane_f32(acc00, vld1q_f32(matrix_b0 + 0), a0l, 0);
+                acc10 = vmlaq_lane_f32(acc10, vld1q_f32(matrix_b1 + 0), a0l, 0);
+                acc01 = vmlaq_lane_f32(acc01, vld1q_f32(matrix_b0 + 4), a0l, 1);
+                acc11 = vmlaq_lane_f32(acc11, vld1q_f32(matrix_b1 + 4), a0l, 1);
+                acc00 = vmlaq_lane_f32(acc00, vld1q_f32(matrix_b0 + 8), a0h, 0);
+                acc10 = vmlaq_lane_f32(acc10, vld1q_f32(matrix_b1 + 8), a0h, 0);
+                acc01 = vmlaq_lane_f32(acc01, vld1q_f32(matrix_b0 + 12), a0h, 1);
+                acc11 = vmlaq_lane_f32(acc11, vld1q_f32(matrix_b1 + 12), a0h, 1);
+            }
+
+            for(; vec_a < vec_a_end; ++vec_a, matrix_b0 += 4, matrix_b1 += 4)
+            {
+                acc00 = vmlaq_n_f32(acc00, vld1q_f32(matrix_b0), *vec_a);
+                acc10 = vmlaq_n_f32(acc10, vld1q_f32(matrix_b1), *vec_a);
+            }
+
+            const auto vec_out = reinterpret_cast<float *>(out.ptr());
+            vst1q_f32(vec_out + 0, vaddq_f32(acc00, acc01));
+            vst1q_f32(vec_out + 4, vaddq_f32(acc10, acc11));
+        }
+        else
+        {
+            // Last panel of an output width which is not a multiple of eight
+#if __arm__
+            asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(vec_a)));
+            asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(matrix_b0)));
+#endif /* __arm__ */
+
+            for(; vec_a <= (vec_a_end - 4); vec_a += 4, matrix_b0 += 16)
+            {
+                const float32x2_t a0l = vld1_f32(vec_a);
+                const float32x2_t a0h = vld1_f32(vec_a + 2);
+
+#if __arm__
+                asm volatile("PLD [%0, #128*4]" ::"r"(reinterpret_cast<const uint8_t *>(matrix_b0)));
+#endif /* __arm__ */
+
+                acc00 = vmlaq_lane_f32(acc00, vld1q_f32(matrix_b0 + 0), a0l, 0);
+                acc01 = vmlaq_lane_f32(acc01, vld1q_f32(matrix_b0 + 4), a0l, 1);
+                acc00 = vmlaq_lane_f32(acc00, vld1q_f32(matrix_b0 + 8), a0h, 0);
+                acc01 = vmlaq_lane_f32(acc01, vld1q_f32(matrix_b0 + 12), a0h, 1);
+            }
+
+            for(; vec_a < vec_a_end; ++vec_a, matrix_b0 += 4)
+            {
+                acc00 = vmlaq_n_f32(acc00, vld1q_f32(matrix_b0), *vec_a);
+            }
+
+            const auto vec_out = reinterpret_cast<float *>(out.ptr());
+            vst1q_f32(vec_out, vaddq_f32(acc00, acc01));
+        }
+    },
+    ina, out);
+}
 } // namespace
 
 NELocallyConnectedMatrixMultiplyKernel::NELocallyConnectedMatrixMultiplyKernel()
-    : _input0(nullptr), _input1(nullptr), _output(nullptr)
+    : _input0(nullptr), _input1(nullptr), _output(nullptr), _is_packed(false)
 {
 }
 
-void NELocallyConnectedMatrixMultiplyKernel::configure(const ITensor *input0, const ITensor *input1, ITensor *output)
+void NELocallyConnectedMatrixMultiplyKernel::configure(const ITensor *input0, const ITensor *input1, ITensor *output, bool packed_weights)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input0, 1, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input1, 1, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F16, DataType::F32);
-    ARM_COMPUTE_ERROR_ON(input0->info()->dimension(0) != input1->info()->dimension(1));
 
-    _input0 = input0;
-    _input1 = input1;
-    _output = output;
+    _input0    = input0;
+    _input1    = input1;
+    _output    = output;
+    _is_packed = packed_weights;
+
+    if(packed_weights)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input0, 1, DataType::F32);
+        ARM_COMPUTE_ERROR_ON(input1->info()->dimension(0) != input0->info()->dimension(0) * 4);
+        ARM_COMPUTE_ERROR_ON(input1->info()->dimension(1) != static_cast<unsigned int>(std::ceil(output->info()->dimension(0) / 4.f)));
+
+        // Two panels of four outputs each per iteration
+        constexpr unsigned int num_elems_processed_per_iteration = 8;
+
+        Window win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
+
+        AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+
+        update_window_and_padding(win,
+                                  AccessWindowStatic(input0->info(), 0, 0, input0->info()->tensor_shape().x(), input0->info()->tensor_shape().y()),
+                                  AccessWindowStatic(input1->info(), 0, 0, input1->info()->tensor_shape().x(), input1->info()->tensor_shape().y()),
+                                  output_access);
+
+        output_access.set_valid_region(win, ValidRegion(Coordinates(0, 0), output->info()->tensor_shape()));
+
+        INEKernel::configure(win);
+        return;
+    }
+
+    ARM_COMPUTE_ERROR_ON(input0->info()->dimension(0) != input1->info()->dimension(1));
 
     const unsigned int num_elems_processed_per_iteration_x = 16;
 
@@ -343,6 +484,12 @@ void NELocallyConnectedMatrixMultiplyKernel::run(const Window &window, const Thr
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
 
+    if(_is_packed)
+    {
+        vector_matrix_multiply_packed_f32(_input0, _input1, _output, window, info);
+        return;
+    }
+
     switch(_input0->info()->data_type())
     {
         case DataType::F16:
@@ -28,8 +28,10 @@
 #include "arm_compute/core/IAccessWindow.h"
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/Validate.h"
+#include "support/ToolchainSupport.h"
 
 #include <arm_neon.h>
+#include <cmath>
 #include <cstdint>
 
 using namespace arm_compute;
@@ -621,6 +623,44 @@ inline uint8x8_t phase_unsigned(int16x8_t input1, int16x8_t input2)
     return vmovn_u16(vcombine_u16(vqmovun_s32(vcvtq_s32_f32(angle_low)),
                                   vqmovun_s32(vcvtq_s32_f32(angle_high))));
 }
+
+inline uint8x8_t phase_quantized(int16x8_t gx, int16x8_t gy, const int16_t *thresholds, size_t num_thresholds, int16_t half_bins)
+{
+    const int16x8_t zero_s16 = vdupq_n_s16(0);
+    const int32x4_t zero_s32 = vdupq_n_s32(0);
+
+    /* Reflect gradients pointing into the lower half circle onto the upper one, so the
+     * angle is in [0, 180] degrees and gy/gx is monotonic across the bin boundaries */
+    const uint16x8_t lower_half = vcltq_s16(gy, zero_s16);
+    const int16x8_t  rgx        = vbslq_s16(lower_half, vqnegq_s16(gx), gx);
+    const int16x8_t  rgy        = vbslq_s16(lower_half, vqnegq_s16(gy), gy);
+
+    /* Count the boundaries below the gradient: the angle is above the boundary at alpha_k
+     * iff sin(angle - alpha_k) = (gy * cos(alpha_k) - gx * sin(alpha_k)) / r >= 0.
+     * Each true compare is an all-ones lane, so subtracting the masks accumulates the bin */
+    int16x8_t bin = zero_s16;
+
+    for(size_t k = 0; k < num_thresholds; ++k)
+    {
+        const int16x4_t cos_k = vdup_n_s16(thresholds[2 * k + 0]);
+        const int16x4_t sin_k = vdup_n_s16(thresholds[2 * k + 1]);
+
+        int32x4_t delta_low  = vmull_s16(vget_low_s16(rgy), cos_k);
+        int32x4_t delta_high = vmull_s16(vget_high_s16(rgy), cos_k);
+        delta_low            = vmlsl_s16(delta_low, vget_low_s16(rgx), sin_k);
+        delta_high           = vmlsl_s16(delta_high, vget_high_s16(rgx), sin_k);
+
+        const uint16x8_t above = vcombine_u16(vmovn_u32(vcgeq_s32(delta_low, zero_s32)),
+                                              vmovn_u32(vcgeq_s32(delta_high, zero_s32)));
+
+        bin = vsubq_s16(bin, vreinterpretq_s16_u16(above));
+    }
+
+    /* Signed phase: reflected gradients land in the upper half of the bin range */
+    bin = vaddq_s16(bin, vreinterpretq_s16_u16(vandq_u16(lower_half, vdupq_n_u16(half_bins))));
+
+    return vqmovun_s16(bin);
+}
 } // namespace
 
 template <MagnitudeType mag_type, PhaseType phase_type>
@@ -869,3 +909,186 @@ template class arm_compute::NEMagnitudePhaseKernel<MagnitudeType::L1NORM, PhaseT
 template class arm_compute::NEMagnitudePhaseKernel<MagnitudeType::L2NORM, PhaseType::SIGNED>;
 template class arm_compute::NEMagnitudePhaseKernel<MagnitudeType::L1NORM, PhaseType::UNSIGNED>;
 template class arm_compute::NEMagnitudePhaseKernel<MagnitudeType::L2NORM, PhaseType::UNSIGNED>;
+
+template <MagnitudeType mag_type, PhaseType phase_type>
+NEMagnitudeQuantizedPhaseKernel<mag_type, phase_type>::NEMagnitudeQuantizedPhaseKernel()
+    : _func(nullptr), _gx(nullptr), _gy(nullptr), _magnitude(nullptr), _phase(nullptr), _thresholds(), _half_bins(0)
+{
+}
+
+template <MagnitudeType mag_type, PhaseType phase_type>
+void NEMagnitudeQuantizedPhaseKernel<mag_type, phase_type>::configure(const ITensor *gx, const ITensor *gy, ITensor *magnitude, ITensor *phase, unsigned int num_bins)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(gx, 1, DataType::S16);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(gy, 1, DataType::S16);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(phase);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(phase, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON(num_bins < 2 || num_bins > 255);
+    ARM_COMPUTE_ERROR_ON_MSG((PhaseType::SIGNED == phase_type) && (num_bins % 2 != 0), "Signed quantized phase requires an even number of bins");
+
+    const bool run_mag = magnitude != nullptr;
+
+    if(run_mag)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(magnitude, 1, DataType::S16);
+    }
+
+    _gx        = gx;
+    _gy        = gy;
+    _magnitude = magnitude;
+    _phase     = phase;
+
+    // Number of bins covering the upper half circle: the lower half is folded onto it by
+    // reflecting the gradient, which is the identity on unsigned orientations
+    const unsigned int half_bins = (PhaseType::SIGNED == phase_type) ? num_bins / 2 : num_bins;
+
+    _half_bins = (PhaseType::SIGNED == phase_type) ? static_cast<int16_t>(half_bins) : 0;
+
+    // Precompute one Q15 (cos, sin) pair per internal bin boundary
+    _thresholds.clear();
+    _thresholds.reserve(2 * (half_bins - 1));
+
+    for(unsigned int k = 1; k < half_bins; ++k)
+    {
+        const float alpha = k * PI / half_bins;
+        _thresholds.push_back(static_cast<int16_t>(support::cpp11::round(std::cos(alpha) * 32767.f)));
+        _thresholds.push_back(static_cast<int16_t>(support::cpp11::round(std::sin(alpha) * 32767.f)));
+    }
+
+    if(run_mag)
+    {
+        _func = &NEMagnitudeQuantizedPhaseKernel<mag_type, phase_type>::magnitude_phase_bin;
+    }
+    else
+    {
+        _func = &NEMagnitudeQuantizedPhaseKernel<mag_type, phase_type>::phase_bin;
+    }
+
+    constexpr unsigned int num_elems_processed_per_iteration = 16;
+
+    // Configure kernel window
+    Window                 win = calculate_max_window(*gx->info(), Steps(num_elems_processed_per_iteration));
+    AccessWindowHorizontal magnitude_access(magnitude == nullptr ? nullptr : magnitude->info(), 0, num_elems_processed_per_iteration);
+    AccessWindowHorizontal phase_access(phase->info(), 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win,
+                              AccessWindowHorizontal(gx->info(), 0, num_elems_processed_per_iteration),
+                              AccessWindowHorizontal(gy->info(), 0, num_elems_processed_per_iteration),
+                              magnitude_access,
+                              phase_access);
+
+    ValidRegion valid_region = intersect_valid_regions(gx->info()->valid_region(),
+                                                       gy->info()->valid_region());
+
+    magnitude_access.set_valid_region(win, valid_region);
+    phase_access.set_valid_region(win, valid_region);
+
+    INEKernel::configure(win);
+}
+
+template <MagnitudeType mag_type, PhaseType phase_type>
+void NEMagnitudeQuantizedPhaseKernel<mag_type, phase_type>::phase_bin(const Window &window)
+{
+    Iterator gx(_gx, window);
+    Iterator gy(_gy, window);
+    Iterator phase(_phase, window);
+
+    const int16_t *thresholds     = _thresholds.data();
+    const size_t   num_thresholds = _thresholds.size() / 2;
+    const int16_t  half_bins      = _half_bins;
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int16x8x2_t input1 =
+        {
+            {
+                vld1q_s16(reinterpret_cast<int16_t *>(gx.ptr())),
+                vld1q_s16(reinterpret_cast<int16_t *>(gx.ptr()) + 8)
+            }
+        };
+
+        const int16x8x2_t input2 =
+        {
+            {
+                vld1q_s16(reinterpret_cast<int16_t *>(gy.ptr())),
+                vld1q_s16(reinterpret_cast<int16_t *>(gy.ptr()) + 8)
+            }
+        };
+
+        /* Compute and store the orientation bins */
+        vst1q_u8(phase.ptr(), vcombine_u8(phase_quantized(input1.val[0], input2.val[0], thresholds, num_thresholds, half_bins),
+                                          phase_quantized(input1.val[1], input2.val[1], thresholds, num_thresholds, half_bins)));
+    },
+    gx, gy, phase);
+}
+
+template <MagnitudeType mag_type, PhaseType phase_type>
+void NEMagnitudeQuantizedPhaseKernel<mag_type, phase_type>::magnitude_phase_bin(const Window &window)
+{
+    Iterator gx(_gx, window);
+    Iterator gy(_gy, window);
+    Iterator magnitude(_magnitude, window);
+    Iterator phase(_phase, window);
+
+    const int16_t *thresholds     = _thresholds.data();
+    const size_t   num_thresholds = _thresholds.size() / 2;
+    const int16_t  half_bins      = _half_bins;
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int16x8x2_t input1 =
+        {
+            {
+                vld1q_s16(reinterpret_cast<int16_t *>(gx.ptr())),
+                vld1q_s16(reinterpret_cast<int16_t *>(gx.ptr()) + 8)
+            }
+        };
+
+        const int16x8x2_t input2 =
+        {
+            {
+                vld1q_s16(reinterpret_cast<int16_t *>(gy.ptr())),
+                vld1q_s16(reinterpret_cast<int16_t *>(gy.ptr()) + 8)
+            }
+        };
+
+        /* Compute magnitude */
+        int16x8x2_t mag{ {} };
+
+        if(MagnitudeType::L2NORM == mag_type)
+        {
+            mag.val[0] = magnitude_l2(input1.val[0], input2.val[0]);
+            mag.val[1] = magnitude_l2(input1.val[1], input2.val[1]);
+        }
+        else
+        {
+            mag.val[0] = magnitude_l1(input1.val[0], input2.val[0]);
+            mag.val[1] = magnitude_l1(input1.val[1], input2.val[1]);
+        }
+
+        /* Store magnitude */
+        vst1q_s16(reinterpret_cast<int16_t *>(magnitude.ptr()), mag.val[0]);
+        vst1q_s16(reinterpret_cast<int16_t *>(magnitude.ptr()) + 8, mag.val[1]);
+
+        /* Compute and store the orientation bins */
+        vst1q_u8(phase.ptr(), vcombine_u8(phase_quantized(input1.val[0], input2.val[0], thresholds, num_thresholds, half_bins),
+                                          phase_quantized(input1.val[1], input2.val[1], thresholds, num_thresholds, half_bins)));
+    },
+    gx, gy, magnitude, phase);
+}
+
+template <MagnitudeType mag_type, PhaseType phase_type>
+void NEMagnitudeQuantizedPhaseKernel<mag_type, phase_type>::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
+
+template class arm_compute::NEMagnitudeQuantizedPhaseKernel<MagnitudeType::L1NORM, PhaseType::SIGNED>;
+template class arm_compute::NEMagnitudeQuantizedPhaseKernel<MagnitudeType::L2NORM, PhaseType::SIGNED>;
+template class arm_compute::NEMagnitudeQuantizedPhaseKernel<MagnitudeType::L1NORM, PhaseType::UNSIGNED>;
+template class arm_compute::NEMagnitudeQuantizedPhaseKernel<MagnitudeType::L2NORM, PhaseType::UNSIGNED>;
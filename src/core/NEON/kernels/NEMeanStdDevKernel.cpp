@@ -31,6 +31,7 @@
 #include "arm_compute/core/Validate.h"
 
 #include <arm_neon.h>
+#include <atomic>
 #include <cmath>
 #include <tuple>
 #include <utility>
@@ -85,7 +86,7 @@ std::pair<uint64x1_t, uint64x1_t> accumulate(const Window &window, Iterator &ite
 } // namespace
 
 NEMeanStdDevKernel::NEMeanStdDevKernel()
-    : _input(nullptr), _mean(nullptr), _stddev(nullptr), _global_sum(nullptr), _global_sum_squared(nullptr), _mtx(), _border_size(0)
+    : _input(nullptr), _mean(nullptr), _stddev(nullptr), _global_sum(nullptr), _global_sum_squared(nullptr), _num_merged(0), _border_size(0)
 {
 }
 
@@ -94,7 +95,7 @@ BorderSize NEMeanStdDevKernel::border_size() const
     return _border_size;
 }
 
-void NEMeanStdDevKernel::configure(const IImage *input, float *mean, uint64_t *global_sum, float *stddev, uint64_t *global_sum_squared)
+void NEMeanStdDevKernel::configure(const IImage *input, float *mean, std::atomic<uint64_t> *global_sum, float *stddev, std::atomic<uint64_t> *global_sum_squared)
 {
     ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input);
     ARM_COMPUTE_ERROR_ON(nullptr == mean);
@@ -122,7 +123,6 @@ void NEMeanStdDevKernel::configure(const IImage *input, float *mean, uint64_t *g
 
 void NEMeanStdDevKernel::run(const Window &window, const ThreadInfo &info)
 {
-    ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
     Iterator input(_input, window);
@@ -139,22 +139,28 @@ void NEMeanStdDevKernel::run(const Window &window, const ThreadInfo &info)
         std::tie(local_sum, local_sum_squared) = accumulate<false>(window, input);
     }
 
-    const float num_pixels = _input->info()->dimension(0) * _input->info()->dimension(1);
-
-    // Merge sum and calculate mean and stddev
-    std::unique_lock<arm_compute::Mutex> lock(_mtx);
-
-    *_global_sum += vget_lane_u64(local_sum, 0);
-
-    const float mean = *_global_sum / num_pixels;
-    *_mean           = mean;
+    // Merge the partial sums with a single atomic addition each; the releases pair with the
+    // acquire on the merge counter below
+    _global_sum->fetch_add(vget_lane_u64(local_sum, 0), std::memory_order_release);
 
     if(_stddev != nullptr)
     {
-        const uint64_t tmp_sum_squared = vget_lane_u64(local_sum_squared, 0);
-        *_global_sum_squared += tmp_sum_squared;
-        *_stddev = std::sqrt((*_global_sum_squared / num_pixels) - (mean * mean));
+        _global_sum_squared->fetch_add(vget_lane_u64(local_sum_squared, 0), std::memory_order_release);
     }
 
-    lock.unlock();
+    // The last thread to merge observes every contribution and computes the final statistics,
+    // then rearms the counter for the next run
+    if(_num_merged.fetch_add(1, std::memory_order_acq_rel) + 1 == info.num_threads)
+    {
+        const double num_pixels = _input->info()->dimension(0) * _input->info()->dimension(1);
+        const double mean       = _global_sum->load(std::memory_order_relaxed) / num_pixels;
+        *_mean                  = mean;
+
+        if(_stddev != nullptr)
+        {
+            *_stddev = std::sqrt((_global_sum_squared->load(std::memory_order_relaxed) / num_pixels) - (mean * mean));
+        }
+
+        _num_merged.store(0, std::memory_order_relaxed);
+    }
 }
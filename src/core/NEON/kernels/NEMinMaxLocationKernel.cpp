@@ -35,8 +35,10 @@
 
 #include <algorithm>
 #include <arm_neon.h>
+#include <atomic>
 #include <climits>
 #include <cstddef>
+#include <limits>
 
 namespace arm_compute
 {
@@ -309,14 +311,129 @@ void NEMinMaxKernel::minmax_F32(Window win)
     update_min_max(min_i, max_i);
 }
 
-NEMinMaxLocationKernel::NEMinMaxLocationKernel()
-    : _func(nullptr), _input(nullptr), _min(nullptr), _max(nullptr), _min_count(nullptr), _max_count(nullptr), _min_loc(nullptr), _max_loc(nullptr)
+namespace
+{
+/** Per-thread partial result of the single-pass min/max location search.
+ *
+ * Laid out at the start of each thread's scratch arena, followed by the candidate location
+ * storage: up to the min array's capacity entries for the minimum, then up to the max
+ * array's capacity entries for the maximum.
+ */
+template <typename T>
+struct MinMaxLocPartial
+{
+    T        min_val;    /**< Minimum value of the strips folded into this partial */
+    T        max_val;    /**< Maximum value of the strips folded into this partial */
+    uint32_t min_count;  /**< Occurrences of min_val in the folded strips */
+    uint32_t max_count;  /**< Occurrences of max_val in the folded strips */
+    uint32_t min_stored; /**< Minimum locations kept in the trailing storage */
+    uint32_t max_stored; /**< Maximum locations kept in the trailing storage */
+    uint32_t folded;     /**< Number of partials folded into this one (merge tree) */
+};
+// workspace_size() sizes the arena with the S32 layout for every data type
+static_assert(sizeof(MinMaxLocPartial<int32_t>) == sizeof(MinMaxLocPartial<float>), "Partial layout must not depend on the accumulation type");
+
+template <typename T>
+inline Coordinates2D *partial_min_locs(MinMaxLocPartial<T> *partial)
+{
+    return reinterpret_cast<Coordinates2D *>(partial + 1);
+}
+
+template <typename T>
+inline Coordinates2D *partial_max_locs(MinMaxLocPartial<T> *partial, size_t min_capacity)
+{
+    return partial_min_locs(partial) + min_capacity;
+}
+
+inline bool mask_any(uint8x16_t mask)
+{
+    const uint8x8_t folded = vorr_u8(vget_low_u8(mask), vget_high_u8(mask));
+    return vget_lane_u64(vreinterpret_u64_u8(folded), 0) != 0;
+}
+
+/** Checks whether a vector-sized block contains a pixel below (for include_eq, at) the running minimum. */
+template <bool include_eq>
+inline bool min_candidate(const uint8_t *in, int32_t cur)
+{
+    const uint8x16_t pixels = vld1q_u8(in);
+    const uint8x16_t ref    = vdupq_n_u8(static_cast<uint8_t>(cur));
+    uint8x16_t       mask   = vcltq_u8(pixels, ref);
+    if(include_eq)
+    {
+        mask = vorrq_u8(mask, vceqq_u8(pixels, ref));
+    }
+    return mask_any(mask);
+}
+
+template <bool include_eq>
+inline bool max_candidate(const uint8_t *in, int32_t cur)
 {
+    const uint8x16_t pixels = vld1q_u8(in);
+    const uint8x16_t ref    = vdupq_n_u8(static_cast<uint8_t>(cur));
+    uint8x16_t       mask   = vcgtq_u8(pixels, ref);
+    if(include_eq)
+    {
+        mask = vorrq_u8(mask, vceqq_u8(pixels, ref));
+    }
+    return mask_any(mask);
 }
 
-bool NEMinMaxLocationKernel::is_parallelisable() const
+template <bool include_eq>
+inline bool min_candidate(const int16_t *in, int32_t cur)
+{
+    const int16x8_t pixels = vld1q_s16(in);
+    const int16x8_t ref    = vdupq_n_s16(static_cast<int16_t>(cur));
+    uint16x8_t      mask   = vcltq_s16(pixels, ref);
+    if(include_eq)
+    {
+        mask = vorrq_u16(mask, vceqq_s16(pixels, ref));
+    }
+    return mask_any(vreinterpretq_u8_u16(mask));
+}
+
+template <bool include_eq>
+inline bool max_candidate(const int16_t *in, int32_t cur)
+{
+    const int16x8_t pixels = vld1q_s16(in);
+    const int16x8_t ref    = vdupq_n_s16(static_cast<int16_t>(cur));
+    uint16x8_t      mask   = vcgtq_s16(pixels, ref);
+    if(include_eq)
+    {
+        mask = vorrq_u16(mask, vceqq_s16(pixels, ref));
+    }
+    return mask_any(vreinterpretq_u8_u16(mask));
+}
+
+template <bool include_eq>
+inline bool min_candidate(const float *in, float cur)
+{
+    const float32x4_t pixels = vld1q_f32(in);
+    const float32x4_t ref    = vdupq_n_f32(cur);
+    uint32x4_t        mask   = vcltq_f32(pixels, ref);
+    if(include_eq)
+    {
+        mask = vorrq_u32(mask, vceqq_f32(pixels, ref));
+    }
+    return mask_any(vreinterpretq_u8_u32(mask));
+}
+
+template <bool include_eq>
+inline bool max_candidate(const float *in, float cur)
+{
+    const float32x4_t pixels = vld1q_f32(in);
+    const float32x4_t ref    = vdupq_n_f32(cur);
+    uint32x4_t        mask   = vcgtq_f32(pixels, ref);
+    if(include_eq)
+    {
+        mask = vorrq_u32(mask, vceqq_f32(pixels, ref));
+    }
+    return mask_any(vreinterpretq_u8_u32(mask));
+}
+} // namespace
+
+NEMinMaxLocationKernel::NEMinMaxLocationKernel()
+    : _func(nullptr), _input(nullptr), _min(nullptr), _max(nullptr), _min_count(nullptr), _max_count(nullptr), _min_loc(nullptr), _max_loc(nullptr), _pending(nullptr)
 {
-    return false;
 }
 
 template <unsigned int...>
@@ -401,94 +518,297 @@ void NEMinMaxLocationKernel::configure(const IImage *input, void *min, void *max
     INEKernel::configure(win);
 }
 
+size_t NEMinMaxLocationKernel::workspace_size() const
+{
+    const size_t min_capacity = (_min_loc != nullptr) ? _min_loc->max_num_values() : 0;
+    const size_t max_capacity = (_max_loc != nullptr) ? _max_loc->max_num_values() : 0;
+
+    return sizeof(MinMaxLocPartial<int32_t>) + (min_capacity + max_capacity) * sizeof(Coordinates2D);
+}
+
 void NEMinMaxLocationKernel::run(const Window &window, const ThreadInfo &info)
 {
-    ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
     ARM_COMPUTE_ERROR_ON(_func == nullptr);
 
-    (this->*_func)(window);
+    (this->*_func)(window, info);
 }
 
 template <class T, bool count_min, bool count_max, bool loc_min, bool loc_max>
-void NEMinMaxLocationKernel::minmax_loc(const Window &win)
+void NEMinMaxLocationKernel::minmax_loc(Window win, const ThreadInfo &info)
 {
-    if(count_min || count_max || loc_min || loc_max)
+    using type = typename std::conditional<std::is_same<T, float>::value, float, int32_t>::type;
+
+    const size_t min_capacity = loc_min ? _min_loc->max_num_values() : 0;
+    const size_t max_capacity = loc_max ? _max_loc->max_num_values() : 0;
+
+    ARM_COMPUTE_ERROR_ON(info.workspace == nullptr);
+    ARM_COMPUTE_ERROR_ON(info.workspace_size < workspace_size());
+
+    auto *const          partial  = static_cast<MinMaxLocPartial<type> *>(info.workspace);
+    Coordinates2D *const min_locs = partial_min_locs(partial);
+    Coordinates2D *const max_locs = partial_max_locs(partial, min_capacity);
+
+    // Track the strip state in locals; initialise the extremes to the edges of the data
+    // type's domain so the vector candidate checks can splat them into a lane
+    type     cur_min    = static_cast<type>(std::numeric_limits<T>::max());
+    type     cur_max    = static_cast<type>(std::numeric_limits<T>::lowest());
+    uint32_t min_count  = 0;
+    uint32_t max_count  = 0;
+    uint32_t min_stored = 0;
+    uint32_t max_stored = 0;
+
+    auto update_min = [&](T pixel, int32_t x, int32_t y)
     {
-        Iterator input(_input, win);
+        const type val = pixel;
+
+        if(val < cur_min)
+        {
+            cur_min = val;
 
-        size_t min_count = 0;
-        size_t max_count = 0;
+            if(count_min || loc_min)
+            {
+                min_count  = 1;
+                min_stored = 0;
 
-        // Clear min location array
-        if(loc_min)
+                if(loc_min && min_capacity != 0)
+                {
+                    min_locs[min_stored++] = Coordinates2D{ x, y };
+                }
+            }
+        }
+        else if((count_min || loc_min) && val == cur_min)
         {
-            _min_loc->clear();
+            ++min_count;
+
+            if(loc_min && min_stored < min_capacity)
+            {
+                min_locs[min_stored++] = Coordinates2D{ x, y };
+            }
         }
+    };
 
-        // Clear max location array
-        if(loc_max)
+    auto update_max = [&](T pixel, int32_t x, int32_t y)
+    {
+        const type val = pixel;
+
+        if(val > cur_max)
         {
-            _max_loc->clear();
+            cur_max = val;
+
+            if(count_max || loc_max)
+            {
+                max_count  = 1;
+                max_stored = 0;
+
+                if(loc_max && max_capacity != 0)
+                {
+                    max_locs[max_stored++] = Coordinates2D{ x, y };
+                }
+            }
         }
+        else if((count_max || loc_max) && val == cur_max)
+        {
+            ++max_count;
 
-        using type = typename std::conditional<std::is_same<T, float>::value, float, int32_t>::type;
+            if(loc_max && max_stored < max_capacity)
+            {
+                max_locs[max_stored++] = Coordinates2D{ x, y };
+            }
+        }
+    };
 
-        auto min_ptr = static_cast<type *>(_min);
-        auto max_ptr = static_cast<type *>(_max);
+    constexpr int window_step = 16 / sizeof(T);
 
-        execute_window_loop(win, [&](const Coordinates & id)
+    const int x_start = win.x().start();
+    const int x_end   = win.x().end();
+
+    // Handle X dimension manually to split into two loops
+    // First one will use vector operations, second one processes the left over pixels
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(_input, win);
+
+    execute_window_loop(win, [&](const Coordinates & id)
+    {
+        const auto    in_row = reinterpret_cast<const T *>(input.ptr());
+        const int32_t y      = id.y();
+
+        int x = x_start;
+
+        // Vector loop: a block only needs scalar attention when it contains a pixel
+        // beyond a running extreme or, when counting/locating, equal to one
+        for(; x <= x_end - window_step; x += window_step)
         {
-            auto    in_ptr = reinterpret_cast<const T *>(input.ptr());
-            int32_t idx    = id.x();
-            int32_t idy    = id.y();
+            const bool min_hit = min_candidate < count_min || loc_min > (in_row + x, cur_min);
+            const bool max_hit = max_candidate < count_max || loc_max > (in_row + x, cur_max);
 
-            const T       pixel = *in_ptr;
-            Coordinates2D p{ idx, idy };
+            if(min_hit || max_hit)
+            {
+                for(int i = x; i < x + window_step; ++i)
+                {
+                    update_min(in_row[i], i, y);
+                    update_max(in_row[i], i, y);
+                }
+            }
+        }
 
-            if(count_min || loc_min)
+        // Process leftover pixels
+        for(; x < x_end; ++x)
+        {
+            update_min(in_row[x], x, y);
+            update_max(in_row[x], x, y);
+        }
+    },
+    input);
+
+    partial->min_val    = cur_min;
+    partial->max_val    = cur_max;
+    partial->min_count  = min_count;
+    partial->max_count  = max_count;
+    partial->min_stored = min_stored;
+    partial->max_stored = max_stored;
+    partial->folded     = 1;
+
+    merge_min_max_loc<type, count_min, count_max, loc_min, loc_max>(partial, info.num_threads);
+}
+
+template <typename T, bool count_min, bool count_max, bool loc_min, bool loc_max>
+void NEMinMaxLocationKernel::merge_min_max_loc(void *local_partial, unsigned int num_threads)
+{
+    auto *const  local        = static_cast<MinMaxLocPartial<T> *>(local_partial);
+    const size_t min_capacity = loc_min ? _min_loc->max_num_values() : 0;
+    const size_t max_capacity = loc_max ? _max_loc->max_num_values() : 0;
+
+    Coordinates2D *const local_min_locs = partial_min_locs(local);
+    Coordinates2D *const local_max_locs = partial_max_locs(local, min_capacity);
+
+    for(;;)
+    {
+        // Grab a parked partial, if any, and fold it into ours
+        void *const other_raw = _pending.exchange(nullptr, std::memory_order_acq_rel);
+
+        if(other_raw != nullptr)
+        {
+            auto *const other = static_cast<MinMaxLocPartial<T> *>(other_raw);
+
+            if(other->min_val < local->min_val)
             {
-                if(*min_ptr == pixel)
+                local->min_val = other->min_val;
+
+                if(count_min || loc_min)
                 {
-                    if(count_min)
-                    {
-                        ++min_count;
-                    }
+                    local->min_count  = other->min_count;
+                    local->min_stored = other->min_stored;
 
                     if(loc_min)
                     {
-                        _min_loc->push_back(p);
+                        std::copy_n(partial_min_locs(other), other->min_stored, local_min_locs);
                     }
                 }
             }
+            else if((count_min || loc_min) && other->min_val == local->min_val)
+            {
+                local->min_count += other->min_count;
+
+                if(loc_min)
+                {
+                    const uint32_t take = std::min<uint32_t>(other->min_stored, min_capacity - local->min_stored);
+                    std::copy_n(partial_min_locs(other), take, local_min_locs + local->min_stored);
+                    local->min_stored += take;
+                }
+            }
 
-            if(count_max || loc_max)
+            if(other->max_val > local->max_val)
             {
-                if(*max_ptr == pixel)
+                local->max_val = other->max_val;
+
+                if(count_max || loc_max)
                 {
-                    if(count_max)
-                    {
-                        ++max_count;
-                    }
+                    local->max_count  = other->max_count;
+                    local->max_stored = other->max_stored;
 
                     if(loc_max)
                     {
-                        _max_loc->push_back(p);
+                        std::copy_n(partial_max_locs(other, min_capacity), other->max_stored, local_max_locs);
                     }
                 }
             }
-        },
-        input);
+            else if((count_max || loc_max) && other->max_val == local->max_val)
+            {
+                local->max_count += other->max_count;
 
-        if(count_min)
+                if(loc_max)
+                {
+                    const uint32_t take = std::min<uint32_t>(other->max_stored, max_capacity - local->max_stored);
+                    std::copy_n(partial_max_locs(other, min_capacity), take, local_max_locs + local->max_stored);
+                    local->max_stored += take;
+                }
+            }
+
+            local->folded += other->folded;
+            continue;
+        }
+
+        if(local->folded == num_threads)
         {
-            *_min_count = min_count;
+            // Every partial has been folded into ours: join the result into the user
+            // outputs. No other thread can still be merging.
+            *static_cast<T *>(_min) = local->min_val;
+            *static_cast<T *>(_max) = local->max_val;
+
+            if(count_min)
+            {
+                *_min_count = local->min_count;
+            }
+
+            if(count_max)
+            {
+                *_max_count = local->max_count;
+            }
+
+            if(loc_min)
+            {
+                _min_loc->clear();
+
+                for(uint32_t i = 0; i < local->min_stored; ++i)
+                {
+                    _min_loc->push_back(local_min_locs[i]);
+                }
+
+                // At least one location was dropped for lack of room: flag the overflow
+                if(local->min_count > local->min_stored && local->min_stored > 0)
+                {
+                    _min_loc->push_back(local_min_locs[0]);
+                }
+            }
+
+            if(loc_max)
+            {
+                _max_loc->clear();
+
+                for(uint32_t i = 0; i < local->max_stored; ++i)
+                {
+                    _max_loc->push_back(local_max_locs[i]);
+                }
+
+                if(local->max_count > local->max_stored && local->max_stored > 0)
+                {
+                    _max_loc->push_back(local_max_locs[0]);
+                }
+            }
+
+            return;
         }
 
-        if(count_max)
+        // Park our partial for another thread to fold. If somebody parked theirs in the
+        // meantime, go grab it instead.
+        void *expected = nullptr;
+
+        if(_pending.compare_exchange_strong(expected, local_partial, std::memory_order_acq_rel))
         {
-            *_max_count = max_count;
+            return;
         }
     }
 }
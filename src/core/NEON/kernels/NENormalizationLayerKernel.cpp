@@ -35,7 +35,7 @@
 using namespace arm_compute;
 
 NENormalizationLayerKernel::NENormalizationLayerKernel()
-    : _func(nullptr), _input(nullptr), _input_squared(nullptr), _output(nullptr), _norm_info(NormType::IN_MAP_1D), _border_size()
+    : _func(nullptr), _input(nullptr), _input_squared(nullptr), _output(nullptr), _norm_info(NormType::IN_MAP_1D), _border_size(), _channel_major(false)
 {
 }
 
@@ -44,6 +44,13 @@ BorderSize NENormalizationLayerKernel::border_size() const
     return _border_size;
 }
 
+ICPPKernel::ResourceProfile NENormalizationLayerKernel::resource_profile() const
+{
+    // The kernel streams the input and its square with little arithmetic per element: it
+    // saturates memory bandwidth on a few cores and does not scale with the full pool
+    return ResourceProfile::BANDWIDTH_BOUND;
+}
+
 void NENormalizationLayerKernel::configure(const ITensor *input, const ITensor *input_squared, ITensor *output, NormalizationLayerInfo norm_info)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QS8, DataType::QS16, DataType::F16, DataType::F32);
@@ -61,7 +68,12 @@ void NENormalizationLayerKernel::configure(const ITensor *input, const ITensor *
         ARM_COMPUTE_ERROR_ON_VALUE_NOT_REPRESENTABLE_IN_FIXED_POINT(norm_info.scale_coeff(), input);
     }
 
-    const unsigned int border_width = (norm_info.type() == NormType::CROSS_MAP) ? 0 : std::min<unsigned int>(norm_info.norm_size() / 2, 3U);
+    const bool is_nhwc = input->info()->data_layout() == DataLayout::NHWC;
+    ARM_COMPUTE_ERROR_ON_MSG(is_nhwc && is_data_type_fixed_point(input->info()->data_type()), "NHWC layout is not supported for fixed point data types");
+
+    // In NHWC the normalization window of CROSS_MAP slides along X (channels), in NCHW the one of the IN_MAP types does
+    const bool         norm_along_x = is_nhwc == (norm_info.type() == NormType::CROSS_MAP);
+    const unsigned int border_width = norm_along_x ? std::min<unsigned int>(norm_info.norm_size() / 2, 3U) : 0;
 
     _input         = input;
     _input_squared = input_squared;
@@ -69,6 +81,14 @@ void NENormalizationLayerKernel::configure(const ITensor *input, const ITensor *
     _norm_info     = norm_info;
     _border_size   = BorderSize(0, border_width);
 
+    // Cross-map normalization on NCHW reads a neighbourhood of norm_size planes per element, a
+    // stride pattern the hardware prefetcher gives up on once the planes are far apart. When
+    // that neighbourhood outgrows the L1 cache, traverse the window channel-major so the plane
+    // rows it revisits are still resident instead of being re-fetched once per plane
+    constexpr size_t cross_map_l1_budget = 32 * 1024;
+    _channel_major = !is_nhwc && (norm_info.type() == NormType::CROSS_MAP)
+                     && (norm_info.norm_size() * input->info()->strides_in_bytes()[2] > cross_map_l1_budget);
+
     unsigned int num_elems_processed_per_iteration = 16 / input->info()->element_size();
     ARM_COMPUTE_UNUSED(num_elems_processed_per_iteration);
 
@@ -80,14 +100,14 @@ void NENormalizationLayerKernel::configure(const ITensor *input, const ITensor *
             switch(norm_info.type())
             {
                 case NormType::IN_MAP_1D:
-                    _func = &NENormalizationLayerKernel::normalize_float<DataType::F32, 0, false>;
+                    _func = is_nhwc ? &NENormalizationLayerKernel::normalize_float<DataType::F32, 1, false> : &NENormalizationLayerKernel::normalize_float<DataType::F32, 0, false>;
                     break;
                 case NormType::IN_MAP_2D:
-                    // Normalize over X and Y
-                    _func = &NENormalizationLayerKernel::normalize_float<DataType::F32, 0, true>;
+                    // Normalize over width and height
+                    _func = is_nhwc ? &NENormalizationLayerKernel::normalize_float<DataType::F32, 1, true> : &NENormalizationLayerKernel::normalize_float<DataType::F32, 0, true>;
                     break;
                 case NormType::CROSS_MAP:
-                    _func = &NENormalizationLayerKernel::normalize_float<DataType::F32, 2, false>;
+                    _func = is_nhwc ? &NENormalizationLayerKernel::normalize_float<DataType::F32, 0, false> : &NENormalizationLayerKernel::normalize_float<DataType::F32, 2, false>;
                     break;
                 default:
                     ARM_COMPUTE_ERROR("Not supported");
@@ -101,14 +121,14 @@ void NENormalizationLayerKernel::configure(const ITensor *input, const ITensor *
             switch(norm_info.type())
             {
                 case NormType::IN_MAP_1D:
-                    _func = &NENormalizationLayerKernel::normalize_float<DataType::F16, 0, false>;
+                    _func = is_nhwc ? &NENormalizationLayerKernel::normalize_float<DataType::F16, 1, false> : &NENormalizationLayerKernel::normalize_float<DataType::F16, 0, false>;
                     break;
                 case NormType::IN_MAP_2D:
-                    // Normalize over X and Y
-                    _func = &NENormalizationLayerKernel::normalize_float<DataType::F16, 0, true>;
+                    // Normalize over width and height
+                    _func = is_nhwc ? &NENormalizationLayerKernel::normalize_float<DataType::F16, 1, true> : &NENormalizationLayerKernel::normalize_float<DataType::F16, 0, true>;
                     break;
                 case NormType::CROSS_MAP:
-                    _func = &NENormalizationLayerKernel::normalize_float<DataType::F16, 2, false>;
+                    _func = is_nhwc ? &NENormalizationLayerKernel::normalize_float<DataType::F16, 0, false> : &NENormalizationLayerKernel::normalize_float<DataType::F16, 2, false>;
                     break;
                 default:
                     ARM_COMPUTE_ERROR("Not supported");
@@ -162,8 +182,8 @@ void NENormalizationLayerKernel::configure(const ITensor *input, const ITensor *
             ARM_COMPUTE_ERROR("NOT SUPPORTED!");
     }
 
-    const unsigned int num_elems_read_per_iteration = num_elems_processed_per_iteration + 2 * (norm_info.norm_size() / 2);
-    const unsigned int num_rows                     = (norm_info.type() == NormType::IN_MAP_2D) ? norm_info.norm_size() : 1;
+    const unsigned int num_elems_read_per_iteration = num_elems_processed_per_iteration + 2 * (norm_along_x ? norm_info.norm_size() / 2 : 0);
+    const unsigned int num_rows                     = (!is_nhwc && norm_info.type() == NormType::IN_MAP_2D) ? norm_info.norm_size() : 1;
 
     // Configure window
     Window win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration));
@@ -186,13 +206,13 @@ void NENormalizationLayerKernel::normalize_float(const Window &window)
     Iterator input_squared(_input_squared, window);
     Iterator output(_output, window);
 
-    const int dim_y                = 1;
+    const int dim_y                = dim + 1;
     const int radius               = _norm_info.norm_size() / 2;
     const int total_size           = _input->info()->dimension(dim) - 1;
     const int input_squared_stride = _input_squared->info()->strides_in_bytes()[dim];
-    // We account padding across X only and we iterate over rows
-    const int min_left   = (dim == 2) ? 0 : -static_cast<int>(border_size().left);
-    const int max_right  = (dim == 2) ? total_size : total_size + border_size().left;
+    // We account padding across X only, border_size is zero whenever the normalized dimension carries no padding
+    const int min_left   = -static_cast<int>(border_size().left);
+    const int max_right  = total_size + border_size().left;
     const int min_top    = 0;
     const int max_bottom = _input->info()->dimension(dim_y) - 1;
 
@@ -282,13 +302,13 @@ void NENormalizationLayerKernel::normalize_fixed_point(const Window &window)
     Iterator input_squared(_input_squared, window);
     Iterator output(_output, window);
 
-    const int dim_y                = 1;
+    const int dim_y                = dim + 1;
     const int radius               = _norm_info.norm_size() / 2;
     const int total_size           = _input->info()->dimension(dim) - 1;
     const int input_squared_stride = _input_squared->info()->strides_in_bytes()[dim];
-    // We account padding across X only and we iterate over rows
-    const int min_left   = (dim == 2) ? 0 : -static_cast<int>(border_size().left);
-    const int max_right  = (dim == 2) ? total_size : total_size + border_size().left;
+    // We account padding across X only, border_size is zero whenever the normalized dimension carries no padding
+    const int min_left   = -static_cast<int>(border_size().left);
+    const int max_right  = total_size + border_size().left;
     const int min_top    = 0;
     const int max_bottom = _input->info()->dimension(dim_y) - 1;
 
@@ -382,5 +402,15 @@ void NENormalizationLayerKernel::run(const Window &window, const ThreadInfo &inf
     ARM_COMPUTE_ERROR_ON(_func == nullptr);
 
     // Run function
-    (this->*_func)(window);
+    if(_channel_major)
+    {
+        execute_window_channel_major(window, [&](const Window & row)
+        {
+            (this->*_func)(row);
+        });
+    }
+    else
+    {
+        (this->*_func)(window);
+    }
 }
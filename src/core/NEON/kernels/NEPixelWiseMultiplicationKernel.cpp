@@ -435,6 +435,53 @@ void mul_U8_S16_S16_n(const void *__restrict input1_ptr, const void *__restrict
     // Simply swap the two input buffers
     mul_S16_U8_S16_n<is_scale255, is_sat>(input2_ptr, input1_ptr, output_ptr, n);
 }
+
+// The loops below take the per-element multiplication as a non-type template argument, so each
+// instantiation calls it directly (and inlines it) instead of going through a function pointer
+// once per window iteration: the inner loop is straight-line NEON with no indirect branch, which
+// matters for small tensors on in-order cores.
+
+template <void (*mul_func)(const void *, const void *, void *, int)>
+void mul_loop_int(const ITensor *input1_t, const ITensor *input2_t, ITensor *output_t, const Window &window, int scale_exponent)
+{
+    Iterator input1(input1_t, window);
+    Iterator input2(input2_t, window);
+    Iterator output(output_t, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        mul_func(input1.ptr(), input2.ptr(), output.ptr(), scale_exponent);
+    },
+    input1, input2, output);
+}
+
+template <void (*mul_func)(const void *, const void *, void *, int, int)>
+void mul_loop_q_int(const ITensor *input1_t, const ITensor *input2_t, ITensor *output_t, const Window &window, int scale_exponent, int fixed_point_position)
+{
+    Iterator input1(input1_t, window);
+    Iterator input2(input2_t, window);
+    Iterator output(output_t, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        mul_func(input1.ptr(), input2.ptr(), output.ptr(), scale_exponent, fixed_point_position);
+    },
+    input1, input2, output);
+}
+
+template <void (*mul_func)(const void *, const void *, void *, float)>
+void mul_loop_float(const ITensor *input1_t, const ITensor *input2_t, ITensor *output_t, const Window &window, float scale)
+{
+    Iterator input1(input1_t, window);
+    Iterator input2(input2_t, window);
+    Iterator output(output_t, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        mul_func(input1.ptr(), input2.ptr(), output.ptr(), scale);
+    },
+    input1, input2, output);
+}
 } // namespace
 
 NEPixelWiseMultiplicationKernel::NEPixelWiseMultiplicationKernel()
@@ -533,87 +580,87 @@ void NEPixelWiseMultiplicationKernel::configure(const ITensor *input1, const ITe
     {
         if(is_scale_255)
         {
-            _func_int = is_sat ? &mul_U8_U8_U8_n<true, true> : &mul_U8_U8_U8_n<true, false>;
+            _func_int = is_sat ? &mul_loop_int<&mul_U8_U8_U8_n<true, true>> : &mul_loop_int<&mul_U8_U8_U8_n<true, false>>;
         }
         else
         {
-            _func_int = is_sat ? &mul_U8_U8_U8_n<false, true> : &mul_U8_U8_U8_n<false, false>;
+            _func_int = is_sat ? &mul_loop_int<&mul_U8_U8_U8_n<false, true>> : &mul_loop_int<&mul_U8_U8_U8_n<false, false>>;
         }
     }
     else if(DataType::S16 == dt_input1 && DataType::S16 == dt_input2 && DataType::S16 == dt_output)
     {
         if(is_scale_255)
         {
-            _func_int = is_sat ? &mul_S16_S16_S16_n<true, true> : &mul_S16_S16_S16_n<true, false>;
+            _func_int = is_sat ? &mul_loop_int<&mul_S16_S16_S16_n<true, true>> : &mul_loop_int<&mul_S16_S16_S16_n<true, false>>;
         }
         else
         {
-            _func_int = is_sat ? &mul_S16_S16_S16_n<false, true> : &mul_S16_S16_S16_n<false, false>;
+            _func_int = is_sat ? &mul_loop_int<&mul_S16_S16_S16_n<false, true>> : &mul_loop_int<&mul_S16_S16_S16_n<false, false>>;
         }
     }
     else if(DataType::S16 == dt_input1 && DataType::U8 == dt_input2 && DataType::S16 == dt_output)
     {
         if(is_scale_255)
         {
-            _func_int = is_sat ? &mul_S16_U8_S16_n<true, true> : &mul_S16_U8_S16_n<true, false>;
+            _func_int = is_sat ? &mul_loop_int<&mul_S16_U8_S16_n<true, true>> : &mul_loop_int<&mul_S16_U8_S16_n<true, false>>;
         }
         else
         {
-            _func_int = is_sat ? &mul_S16_U8_S16_n<false, true> : &mul_S16_U8_S16_n<false, false>;
+            _func_int = is_sat ? &mul_loop_int<&mul_S16_U8_S16_n<false, true>> : &mul_loop_int<&mul_S16_U8_S16_n<false, false>>;
         }
     }
     else if(DataType::U8 == dt_input1 && DataType::S16 == dt_input2 && DataType::S16 == dt_output)
     {
         if(is_scale_255)
         {
-            _func_int = is_sat ? &mul_U8_S16_S16_n<true, true> : &mul_U8_S16_S16_n<true, false>;
+            _func_int = is_sat ? &mul_loop_int<&mul_U8_S16_S16_n<true, true>> : &mul_loop_int<&mul_U8_S16_S16_n<true, false>>;
         }
         else
         {
-            _func_int = is_sat ? &mul_U8_S16_S16_n<false, true> : &mul_U8_S16_S16_n<false, false>;
+            _func_int = is_sat ? &mul_loop_int<&mul_U8_S16_S16_n<false, true>> : &mul_loop_int<&mul_U8_S16_S16_n<false, false>>;
         }
     }
     else if(DataType::U8 == dt_input1 && DataType::U8 == dt_input2 && DataType::S16 == dt_output)
     {
         if(is_scale_255)
         {
-            _func_int = is_sat ? &mul_U8_U8_S16_n<true, true> : &mul_U8_U8_S16_n<true, false>;
+            _func_int = is_sat ? &mul_loop_int<&mul_U8_U8_S16_n<true, true>> : &mul_loop_int<&mul_U8_U8_S16_n<true, false>>;
         }
         else
         {
-            _func_int = is_sat ? &mul_U8_U8_S16_n<false, true> : &mul_U8_U8_S16_n<false, false>;
+            _func_int = is_sat ? &mul_loop_int<&mul_U8_U8_S16_n<false, true>> : &mul_loop_int<&mul_U8_U8_S16_n<false, false>>;
         }
     }
     else if(DataType::QS8 == dt_input1 && DataType::QS8 == dt_input2 && DataType::QS8 == dt_output)
     {
         if(is_scale_255)
         {
-            _func_q_int = is_sat ? &mul_QS8_QS8_QS8_n<true, true> : &mul_QS8_QS8_QS8_n<true, false>;
+            _func_q_int = is_sat ? &mul_loop_q_int<&mul_QS8_QS8_QS8_n<true, true>> : &mul_loop_q_int<&mul_QS8_QS8_QS8_n<true, false>>;
         }
         else
         {
-            _func_q_int = is_sat ? &mul_QS8_QS8_QS8_n<false, true> : &mul_QS8_QS8_QS8_n<false, false>;
+            _func_q_int = is_sat ? &mul_loop_q_int<&mul_QS8_QS8_QS8_n<false, true>> : &mul_loop_q_int<&mul_QS8_QS8_QS8_n<false, false>>;
         }
     }
     else if(DataType::QS16 == dt_input1 && DataType::QS16 == dt_input2 && DataType::QS16 == dt_output)
     {
         if(is_scale_255)
         {
-            _func_q_int = is_sat ? &mul_QS16_QS16_QS16_n<true, true> : &mul_QS16_QS16_QS16_n<true, false>;
+            _func_q_int = is_sat ? &mul_loop_q_int<&mul_QS16_QS16_QS16_n<true, true>> : &mul_loop_q_int<&mul_QS16_QS16_QS16_n<true, false>>;
         }
         else
         {
-            _func_q_int = is_sat ? &mul_QS16_QS16_QS16_n<false, true> : &mul_QS16_QS16_QS16_n<false, false>;
+            _func_q_int = is_sat ? &mul_loop_q_int<&mul_QS16_QS16_QS16_n<false, true>> : &mul_loop_q_int<&mul_QS16_QS16_QS16_n<false, false>>;
         }
     }
     else if(DataType::F16 == dt_input1 && DataType::F16 == dt_input2 && DataType::F16 == dt_output)
     {
-        _func_float = &mul_F16_F16_F16_n<false, false>;
+        _func_float = &mul_loop_float<&mul_F16_F16_F16_n<false, false>>;
         _func_int   = nullptr;
     }
     else if(DataType::F32 == dt_input1 && DataType::F32 == dt_input2 && DataType::F32 == dt_output)
     {
-        _func_float = &mul_F32_F32_F32_n<false, false>;
+        _func_float = &mul_loop_float<&mul_F32_F32_F32_n<false, false>>;
         _func_int   = nullptr;
     }
     else
@@ -638,6 +685,9 @@ void NEPixelWiseMultiplicationKernel::configure(const ITensor *input1, const ITe
     output_access.set_valid_region(win, valid_region);
 
     INEKernel::configure(win);
+    // Contiguous tensors stream element by element: fold the flat dimensions into one loop at
+    // the first dispatch, once the tensors' padding is final
+    collapse_window_when_contiguous({ input1->info(), input2->info(), output->info() });
 }
 
 void NEPixelWiseMultiplicationKernel::run(const Window &window, const ThreadInfo &info)
@@ -646,34 +696,19 @@ void NEPixelWiseMultiplicationKernel::run(const Window &window, const ThreadInfo
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
 
-    Iterator input1(_input1, window);
-    Iterator input2(_input2, window);
-    Iterator output(_output, window);
-
+    // Each pointer targets a fully specialised loop, so this selection runs once per dispatch
+    // and the window loop itself contains no indirect call
     if(_func_int != nullptr)
     {
-        execute_window_loop(window, [&](const Coordinates & id)
-        {
-            (*_func_int)(input1.ptr(), input2.ptr(), output.ptr(), _scale_exponent);
-        },
-        input1, input2, output);
+        (*_func_int)(_input1, _input2, _output, window, _scale_exponent);
     }
     else if(_func_q_int != nullptr)
     {
-        int fixed_point_position = _input1->info()->fixed_point_position();
-        execute_window_loop(window, [&](const Coordinates & id)
-        {
-            (*_func_q_int)(input1.ptr(), input2.ptr(), output.ptr(), _scale_exponent, fixed_point_position);
-        },
-        input1, input2, output);
+        (*_func_q_int)(_input1, _input2, _output, window, _scale_exponent, _input1->info()->fixed_point_position());
     }
     else
     {
         ARM_COMPUTE_ERROR_ON(_func_float == nullptr);
-        execute_window_loop(window, [&](const Coordinates & id)
-        {
-            (*_func_float)(input1.ptr(), input2.ptr(), output.ptr(), _scale);
-        },
-        input1, input2, output);
+        (*_func_float)(_input1, _input2, _output, window, _scale);
     }
 }
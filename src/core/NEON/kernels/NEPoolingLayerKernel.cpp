@@ -23,6 +23,8 @@
  */
 #include "arm_compute/core/NEON/kernels/NEPoolingLayerKernel.h"
 
+#include "arm_compute/core/NEON/kernels/NEActivationLayerKernel.h"
+
 #include "arm_compute/core/AccessWindowStatic.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/FixedPoint.h"
@@ -70,6 +72,25 @@ inline qint8_t calculate_avg_scale_q8(const Coordinates &id, int pool_size, int
     return sshr_qs8(scale_values_q8[val], (7 - fixed_point_position));
 }
 
+inline int16_t calculate_avg_scale_qasymm8(const Coordinates &id, int pool_size, int upper_bound_w, int upper_bound_h,
+                                           int pad_x, int pad_y, int stride_x, int stride_y)
+{
+    static const std::array<int16_t, 10> scale_values_q15 =
+    { { 0x0, 0x7FFF, 0x4000, 0x2AAB, 0x2000, 0x199A, 0x1555, 0x1249, 0x1000, 0xE39 } };
+    const int start_x = id.x() * stride_x - pad_x;
+    const int start_y = id.y() * stride_y - pad_y;
+    const int end_x   = std::min(start_x + pool_size, upper_bound_w);
+    const int end_y   = std::min(start_y + pool_size, upper_bound_h);
+    const int val     = ((end_y - start_y) * (end_x - start_x));
+    return scale_values_q15[val];
+}
+
+/** Scale a vector of 16-bit pooled sums by a Q15 multiplier with rounding */
+inline uint16x8_t scale_sums_qasymm8(uint16x8_t sums, int16_t scale)
+{
+    return vreinterpretq_u16_s16(vqrdmulhq_n_s16(vreinterpretq_s16_u16(sums), scale));
+}
+
 inline qint16_t calculate_avg_scale_q16(const Coordinates &id, int pool_size, int upper_bound_w, int upper_bound_h,
                                         int pad_x, int pad_y, int stride_x, int stride_y, int fixed_point_position)
 {
@@ -82,10 +103,44 @@ inline qint16_t calculate_avg_scale_q16(const Coordinates &id, int pool_size, in
     const int val     = ((end_y - start_y) * (end_x - start_x));
     return sshr_qs16(scale_values_q16[val], (15 - fixed_point_position));
 }
+/** Check whether the zero mask guarantees that the given pooling region contains only zeros
+ *
+ * @param[in] mask      Zero mask produced by NEActivationLayerKernel.
+ * @param[in] id        Coordinates of the output element being computed.
+ * @param[in] in_x      Left column of the pooling region. Must be inside the input.
+ * @param[in] in_y      Top row of the pooling region. Must be inside the input.
+ * @param[in] pool_size Size of the pooling region.
+ *
+ * @return True if every element of the pooling region is zero.
+ */
+inline bool is_zero_region(const ITensor *mask, const Coordinates &id, int in_x, int in_y, int pool_size)
+{
+    constexpr int segment_size = NEActivationLayerKernel::zero_mask_segment_size;
+    const int     seg_first    = in_x / segment_size;
+    const int     seg_last     = (in_x + pool_size - 1) / segment_size;
+
+    Coordinates coords(id);
+    coords.set(0, seg_first);
+
+    uint8_t acc = 0;
+
+    for(int r = 0; r < pool_size; ++r)
+    {
+        coords.set(1, in_y + r);
+        const uint8_t *bytes = mask->ptr_to_element(coords);
+
+        for(int seg = seg_first; seg <= seg_last; ++seg)
+        {
+            acc |= bytes[seg - seg_first];
+        }
+    }
+
+    return acc == 0;
+}
 } // namespace
 
 NEPoolingLayerKernel::NEPoolingLayerKernel()
-    : _func(nullptr), _input(nullptr), _output(nullptr), _pool_info(), _num_elems_processed_per_iteration(0), _border_size(0)
+    : _func(nullptr), _input(nullptr), _output(nullptr), _pool_info(), _zero_mask(nullptr), _num_elems_processed_per_iteration(0), _border_size(0), _padding_less(false)
 {
 }
 
@@ -94,7 +149,7 @@ BorderSize NEPoolingLayerKernel::border_size() const
     return _border_size;
 }
 
-void NEPoolingLayerKernel::configure(const ITensor *input, ITensor *output, const PoolingLayerInfo &pool_info)
+void NEPoolingLayerKernel::configure(const ITensor *input, ITensor *output, const PoolingLayerInfo &pool_info, const ITensor *zero_mask)
 {
     int                 pool_pad_x      = 0;
     int                 pool_pad_y      = 0;
@@ -112,28 +167,123 @@ void NEPoolingLayerKernel::configure(const ITensor *input, ITensor *output, cons
     ARM_COMPUTE_UNUSED(supported_pool_sizes);
 
     ARM_COMPUTE_ERROR_ON_NULLPTR(output);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QS8, DataType::QS16, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QS8, DataType::QASYMM8, DataType::QS16, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON(pool_type == PoolingType::L2 && is_data_type_fixed_point(input->info()->data_type()));
-    ARM_COMPUTE_ERROR_ON((supported_pool_sizes.find(pool_size) == supported_pool_sizes.end()) && (input->info()->data_type() != DataType::F32));
+    ARM_COMPUTE_ERROR_ON(pool_type == PoolingType::L2 && is_data_type_quantized_asymmetric(input->info()->data_type()));
+    const bool is_global_pooling = (pool_pad_x == 0) && (pool_pad_y == 0) && (pool_size == static_cast<int>(input->info()->dimension(Window::DimX)))
+                                   && (pool_size == static_cast<int>(input->info()->dimension(Window::DimY)));
+
+    ARM_COMPUTE_ERROR_ON((supported_pool_sizes.find(pool_size) == supported_pool_sizes.end()) && (input->info()->data_type() != DataType::F32)
+                         && !is_data_type_fixed_point(input->info()->data_type())
+                         && !(is_global_pooling && input->info()->data_type() == DataType::QASYMM8));
     ARM_COMPUTE_ERROR_ON(pool_pad_x >= pool_size || pool_pad_y >= pool_size);
-    ARM_COMPUTE_ERROR_ON(is_data_type_fixed_point(input->info()->data_type()) && pool_stride_x > 2);
+    ARM_COMPUTE_ERROR_ON((is_data_type_fixed_point(input->info()->data_type()) || is_data_type_quantized_asymmetric(input->info()->data_type())) && pool_stride_x > 2);
+
+    // In NHWC the channels are the innermost dimension and width/height move up by one
+    const bool         is_nhwc    = input->info()->data_layout() == DataLayout::NHWC;
+    const unsigned int width_idx  = is_nhwc ? 1 : 0;
+    const unsigned int height_idx = is_nhwc ? 2 : 1;
 
     // Check output dimensions
-    std::tie(pooled_w, pooled_h) = scaled_dimensions(input->info()->dimension(0), input->info()->dimension(1),
+    std::tie(pooled_w, pooled_h) = scaled_dimensions(input->info()->dimension(width_idx), input->info()->dimension(height_idx),
                                                      pool_size, pool_size, pool_info.pad_stride_info());
 
     // Output auto initialization if not yet initialized
     {
         TensorShape output_shape{ input->info()->tensor_shape() };
-        output_shape.set(0, pooled_w);
-        output_shape.set(1, pooled_h);
+        output_shape.set(width_idx, pooled_w);
+        output_shape.set(height_idx, pooled_h);
 
         auto_init_if_empty(*output->info(), output_shape, 1, input->info()->data_type(), input->info()->fixed_point_position());
     }
 
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_FIXED_POINT(input, output);
-    ARM_COMPUTE_ERROR_ON((output->info()->dimension(0) != pooled_w) || (output->info()->dimension(1) != pooled_h));
+    ARM_COMPUTE_ERROR_ON((output->info()->dimension(width_idx) != pooled_w) || (output->info()->dimension(height_idx) != pooled_h));
+
+    if(is_nhwc)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(input->info()->data_type() != DataType::F32, "NHWC layout is only supported for F32");
+
+        // Each iteration processes 4 channels of one output element, the pooling region is clamped inside the kernel
+        constexpr unsigned int num_elems_per_iteration_nhwc = 4;
+
+        _input                             = input;
+        _output                            = output;
+        _pool_info                         = pool_info;
+        _zero_mask                         = nullptr;
+        _num_elems_processed_per_iteration = num_elems_per_iteration_nhwc;
+        _border_size                       = BorderSize(0);
+
+        switch(pool_type)
+        {
+            case PoolingType::AVG:
+                _func = &NEPoolingLayerKernel::pooling_f32_nhwc<PoolingType::AVG>;
+                break;
+            case PoolingType::L2:
+                _func = &NEPoolingLayerKernel::pooling_f32_nhwc<PoolingType::L2>;
+                break;
+            case PoolingType::MAX:
+                _func = &NEPoolingLayerKernel::pooling_f32_nhwc<PoolingType::MAX>;
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Unsupported pooling type!");
+        }
+
+        // Configure kernel window
+        Window                 win = calculate_max_window(*output->info(), Steps(num_elems_per_iteration_nhwc));
+        AccessWindowHorizontal input_access(input->info(), 0, num_elems_per_iteration_nhwc);
+        AccessWindowHorizontal output_access(output->info(), 0, num_elems_per_iteration_nhwc);
+        update_window_and_padding(win, input_access, output_access);
+        output_access.set_valid_region(win, ValidRegion(Coordinates(), output->info()->tensor_shape()));
+        INEKernel::configure(win);
+        return;
+    }
+
+    // The vector kernels express pooling geometry through a border-filled, padded input, which
+    // covers symmetric padding only and turns a ceil-mode overhang (a last window extending past
+    // the padded region) into an over-padded allocation. Asymmetric padding and F32 ceil
+    // overhangs are instead handled natively by the scalar kernel that clamps the pooling region
+    // itself, so no border fill pass or padded allocation is needed. The same kernel covers
+    // tensors whose layout is already fixed without a border (e.g. imported camera buffers).
+    const int  in_w            = input->info()->dimension(0);
+    const int  in_h            = input->info()->dimension(1);
+    const bool pads_asymmetric = !pad_stride_info.padding_is_symmetric();
+    const bool ceil_overhang   = ((static_cast<int>(pooled_w) - 1) * pool_stride_x - pool_pad_x + pool_size > in_w + static_cast<int>(pad_stride_info.pad_right()))
+                                 || ((static_cast<int>(pooled_h) - 1) * pool_stride_y - pool_pad_y + pool_size > in_h + static_cast<int>(pad_stride_info.pad_bottom()));
+
+    if(padding_less_execution_required({ input->info(), output->info() }) || pads_asymmetric || (ceil_overhang && input->info()->data_type() == DataType::F32))
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(input->info()->data_type() != DataType::F32, "Padding-less execution is only supported for F32");
+
+        _input                             = input;
+        _output                            = output;
+        _pool_info                         = pool_info;
+        _zero_mask                         = nullptr;
+        _num_elems_processed_per_iteration = 1;
+        _border_size                       = BorderSize(0);
+        _padding_less                      = true;
+
+        switch(pool_type)
+        {
+            case PoolingType::AVG:
+                _func = &NEPoolingLayerKernel::pooling_f32_padding_less<PoolingType::AVG>;
+                break;
+            case PoolingType::L2:
+                _func = &NEPoolingLayerKernel::pooling_f32_padding_less<PoolingType::L2>;
+                break;
+            case PoolingType::MAX:
+                _func = &NEPoolingLayerKernel::pooling_f32_padding_less<PoolingType::MAX>;
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Unsupported pooling type!");
+        }
+
+        Window win = calculate_max_window(*output->info(), Steps());
+        output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+        INEKernel::configure(win);
+        return;
+    }
 
     unsigned int num_elems_read_per_iteration      = 0;
     unsigned int num_elems_processed_per_iteration = 0;
@@ -153,10 +303,32 @@ void NEPoolingLayerKernel::configure(const ITensor *input, ITensor *output, cons
                     num_elems_processed_per_iteration = (pool_stride_x == 2) ? 7 : 14;
                     break;
                 default:
-                    ARM_COMPUTE_ERROR("Pooling size not supported");
+                    // Generic pooling sizes use a scalar per-output loop with a vector inner loop
+                    num_elems_read_per_iteration      = 1;
+                    num_elems_processed_per_iteration = 1;
+                    break;
+            }
+            num_elems_horizontal_window = (pool_size == 2 || pool_size == 3) ? ((pool_stride_x == 2) ? 8 : 16) : 1;
+            break;
+        case DataType::QASYMM8:
+            num_elems_read_per_iteration = 16;
+            switch(pool_size)
+            {
+                case 2:
+                    num_elems_processed_per_iteration = (pool_stride_x == 2) ? 8 : 15;
+                    break;
+                case 3:
+                    num_elems_processed_per_iteration = (pool_stride_x == 2) ? 7 : 14;
+                    break;
+                default:
+                    // The global reduction path reads exact rows with a scalar leftover loop,
+                    // so no horizontal padding is required
+                    ARM_COMPUTE_ERROR_ON_MSG(!is_global_pooling, "Pooling size not supported");
+                    num_elems_read_per_iteration      = 1;
+                    num_elems_processed_per_iteration = 1;
                     break;
             }
-            num_elems_horizontal_window = (pool_stride_x == 2) ? 8 : 16;
+            num_elems_horizontal_window = (pool_size == 2 || pool_size == 3) ? ((pool_stride_x == 2) ? 8 : 16) : 1;
             break;
         case DataType::QS16:
             num_elems_read_per_iteration = 8;
@@ -169,9 +341,12 @@ void NEPoolingLayerKernel::configure(const ITensor *input, ITensor *output, cons
                     num_elems_processed_per_iteration = (pool_stride_x == 2) ? 3 : 6;
                     break;
                 default:
-                    ARM_COMPUTE_ERROR("Pooling size not supported");
+                    // Generic pooling sizes use a scalar per-output loop with a vector inner loop
+                    num_elems_read_per_iteration      = 1;
+                    num_elems_processed_per_iteration = 1;
+                    break;
             }
-            num_elems_horizontal_window = (pool_stride_x == 2) ? 4 : 8;
+            num_elems_horizontal_window = (pool_size == 2 || pool_size == 3) ? ((pool_stride_x == 2) ? 4 : 8) : 1;
             break;
 #ifdef ARM_COMPUTE_ENABLE_FP16
         case DataType::F16:
@@ -224,14 +399,70 @@ void NEPoolingLayerKernel::configure(const ITensor *input, ITensor *output, cons
     const int upper_bound_h            = ((pooled_h - 1) * pool_stride_y - pool_pad_y + pool_size) - input_height;
 
     // Set instance variables
+    if(zero_mask != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(input->info()->data_type() != DataType::F32, "The zero mask is only supported for F32");
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(zero_mask, 1, DataType::U8);
+        ARM_COMPUTE_ERROR_ON(zero_mask->info()->dimension(0) != (input->info()->dimension(0) + NEActivationLayerKernel::zero_mask_segment_size - 1) / NEActivationLayerKernel::zero_mask_segment_size);
+        ARM_COMPUTE_ERROR_ON(zero_mask->info()->dimension(1) != input->info()->dimension(1));
+    }
+
     _input              = input;
     _output             = output;
     _pool_info          = pool_info;
+    _zero_mask          = ((zero_mask != nullptr) && (input->info()->data_type() == DataType::F32) && (pool_size == 2 || pool_size == 3)) ? zero_mask : nullptr;
     _border_size        = BorderSize(pool_pad_y, pool_pad_x);
     _border_size.right  = std::max(upper_bound_w, pool_pad_x);
     _border_size.bottom = std::max(upper_bound_h, pool_pad_y);
 
     // Select appropriate function
+    // Global pooling reduces every input map to a single value: use the dedicated single-pass
+    // accumulation which is dispatched in parallel over the channel dimension by the function
+    if(is_global_pooling && (input->info()->data_type() == DataType::F32 || input->info()->data_type() == DataType::QASYMM8))
+    {
+        if(input->info()->data_type() == DataType::F32)
+        {
+            switch(pool_type)
+            {
+                case PoolingType::AVG:
+                    _func = &NEPoolingLayerKernel::pooling_global_f32<PoolingType::AVG>;
+                    break;
+                case PoolingType::L2:
+                    _func = &NEPoolingLayerKernel::pooling_global_f32<PoolingType::L2>;
+                    break;
+                case PoolingType::MAX:
+                    _func = &NEPoolingLayerKernel::pooling_global_f32<PoolingType::MAX>;
+                    break;
+                default:
+                    ARM_COMPUTE_ERROR("Unsupported pooling type!");
+            }
+        }
+        else
+        {
+            switch(pool_type)
+            {
+                case PoolingType::AVG:
+                    _func = &NEPoolingLayerKernel::pooling_global_qasymm8<PoolingType::AVG>;
+                    break;
+                case PoolingType::MAX:
+                    _func = &NEPoolingLayerKernel::pooling_global_qasymm8<PoolingType::MAX>;
+                    break;
+                default:
+                    ARM_COMPUTE_ERROR("Unsupported pooling type!");
+            }
+        }
+
+        // Configure kernel window: one output element per map, no padding required as the
+        // reduction reads exact rows with a scalar leftover loop
+        Window                 win = calculate_max_window(*output->info(), Steps());
+        AccessWindowStatic     input_access(input->info(), 0, 0, input_width, input_height);
+        AccessWindowHorizontal output_access(output->info(), 0, 1);
+        update_window_and_padding(win, input_access, output_access);
+        output_access.set_valid_region(win, ValidRegion(Coordinates(), output->info()->tensor_shape()));
+        INEKernel::configure(win);
+        return;
+    }
+
     switch(pool_size)
     {
         case 2:
@@ -249,6 +480,20 @@ void NEPoolingLayerKernel::configure(const ITensor *input, ITensor *output, cons
                         ARM_COMPUTE_ERROR("Unsupported pooling type!");
                 }
             }
+            else if(input->info()->data_type() == DataType::QASYMM8)
+            {
+                switch(pool_type)
+                {
+                    case PoolingType::AVG:
+                        _func = &NEPoolingLayerKernel::pooling2_qasymm8<PoolingType::AVG>;
+                        break;
+                    case PoolingType::MAX:
+                        _func = &NEPoolingLayerKernel::pooling2_qasymm8<PoolingType::MAX>;
+                        break;
+                    default:
+                        ARM_COMPUTE_ERROR("Unsupported pooling type!");
+                }
+            }
             else if(input->info()->data_type() == DataType::QS16)
             {
                 switch(pool_type)
@@ -313,6 +558,20 @@ void NEPoolingLayerKernel::configure(const ITensor *input, ITensor *output, cons
                         ARM_COMPUTE_ERROR("Unsupported pooling type!");
                 }
             }
+            else if(input->info()->data_type() == DataType::QASYMM8)
+            {
+                switch(pool_type)
+                {
+                    case PoolingType::AVG:
+                        _func = &NEPoolingLayerKernel::pooling3_qasymm8<PoolingType::AVG>;
+                        break;
+                    case PoolingType::MAX:
+                        _func = &NEPoolingLayerKernel::pooling3_qasymm8<PoolingType::MAX>;
+                        break;
+                    default:
+                        ARM_COMPUTE_ERROR("Unsupported pooling type!");
+                }
+            }
             else if(input->info()->data_type() == DataType::QS16)
             {
                 switch(pool_type)
@@ -363,35 +622,70 @@ void NEPoolingLayerKernel::configure(const ITensor *input, ITensor *output, cons
             }
             break;
         case 7:
-            switch(pool_type)
+            if(input->info()->data_type() == DataType::F32)
             {
-                case PoolingType::AVG:
-                    _func = &NEPoolingLayerKernel::pooling7_f32<PoolingType::AVG>;
-                    break;
-                case PoolingType::L2:
-                    _func = &NEPoolingLayerKernel::pooling7_f32<PoolingType::L2>;
-                    break;
-                case PoolingType::MAX:
-                    _func = &NEPoolingLayerKernel::pooling7_f32<PoolingType::MAX>;
-                    break;
-                default:
-                    ARM_COMPUTE_ERROR("Unsupported pooling type!");
+                switch(pool_type)
+                {
+                    case PoolingType::AVG:
+                        _func = &NEPoolingLayerKernel::pooling7_f32<PoolingType::AVG>;
+                        break;
+                    case PoolingType::L2:
+                        _func = &NEPoolingLayerKernel::pooling7_f32<PoolingType::L2>;
+                        break;
+                    case PoolingType::MAX:
+                        _func = &NEPoolingLayerKernel::pooling7_f32<PoolingType::MAX>;
+                        break;
+                    default:
+                        ARM_COMPUTE_ERROR("Unsupported pooling type!");
+                }
+                break;
             }
-            break;
+            // Fixed point types fall through to the generic pooling
         default:
-            switch(pool_type)
+            if(input->info()->data_type() == DataType::QS8)
             {
-                case PoolingType::AVG:
-                    _func = &NEPoolingLayerKernel::poolingN_f32<PoolingType::AVG>;
-                    break;
-                case PoolingType::L2:
-                    _func = &NEPoolingLayerKernel::poolingN_f32<PoolingType::L2>;
-                    break;
-                case PoolingType::MAX:
-                    _func = &NEPoolingLayerKernel::poolingN_f32<PoolingType::MAX>;
-                    break;
-                default:
-                    ARM_COMPUTE_ERROR("Unsupported pooling type!");
+                switch(pool_type)
+                {
+                    case PoolingType::AVG:
+                        _func = &NEPoolingLayerKernel::poolingN_q8<PoolingType::AVG>;
+                        break;
+                    case PoolingType::MAX:
+                        _func = &NEPoolingLayerKernel::poolingN_q8<PoolingType::MAX>;
+                        break;
+                    default:
+                        ARM_COMPUTE_ERROR("Unsupported pooling type!");
+                }
+            }
+            else if(input->info()->data_type() == DataType::QS16)
+            {
+                switch(pool_type)
+                {
+                    case PoolingType::AVG:
+                        _func = &NEPoolingLayerKernel::poolingN_q16<PoolingType::AVG>;
+                        break;
+                    case PoolingType::MAX:
+                        _func = &NEPoolingLayerKernel::poolingN_q16<PoolingType::MAX>;
+                        break;
+                    default:
+                        ARM_COMPUTE_ERROR("Unsupported pooling type!");
+                }
+            }
+            else
+            {
+                switch(pool_type)
+                {
+                    case PoolingType::AVG:
+                        _func = &NEPoolingLayerKernel::poolingN_f32<PoolingType::AVG>;
+                        break;
+                    case PoolingType::L2:
+                        _func = &NEPoolingLayerKernel::poolingN_f32<PoolingType::L2>;
+                        break;
+                    case PoolingType::MAX:
+                        _func = &NEPoolingLayerKernel::poolingN_f32<PoolingType::MAX>;
+                        break;
+                    default:
+                        ARM_COMPUTE_ERROR("Unsupported pooling type!");
+                }
             }
             break;
     }
@@ -469,6 +763,71 @@ void NEPoolingLayerKernel::pooling2_q8(const Window &window_input, const Window
     input, output);
 }
 
+template <PoolingType pooling_type>
+void NEPoolingLayerKernel::pooling2_qasymm8(const Window &window_input, const Window &window)
+{
+    Iterator input(_input, window_input);
+    Iterator output(_output, window);
+
+    constexpr int pool_size     = 2;
+    int           pool_pad_x    = 0;
+    int           pool_pad_y    = 0;
+    int           pool_stride_x = 0;
+    int           pool_stride_y = 0;
+    std::tie(pool_pad_x, pool_pad_y)       = _pool_info.pad_stride_info().pad();
+    std::tie(pool_stride_x, pool_stride_y) = _pool_info.pad_stride_info().stride();
+    const int upper_bound_w = _input->info()->dimension(0) + pool_pad_x;
+    const int upper_bound_h = _input->info()->dimension(1) + pool_pad_y;
+
+    const uint8_t *const input_top_ptr    = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y)));
+    const uint8_t *const input_bottom_ptr = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y) + 1));
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto top_data    = vld1q_u8(input_top_ptr + input.offset());
+        const auto bottom_data = vld1q_u8(input_bottom_ptr + input.offset());
+        if(pooling_type == PoolingType::AVG)
+        {
+            // Quantized values share the same scale and offset before and after averaging, so the average
+            // is computed directly on the uint8 values using 16-bit widening sums and a Q15 rounding multiplier
+            const int16_t scale = calculate_avg_scale_qasymm8(id, pool_size, upper_bound_w, upper_bound_h, pool_pad_x, pool_pad_y, pool_stride_x, pool_stride_y);
+
+            const uint16x8_t sum_lower = vaddl_u8(vget_low_u8(top_data), vget_low_u8(bottom_data));
+            const uint16x8_t sum_upper = vaddl_u8(vget_high_u8(top_data), vget_high_u8(bottom_data));
+
+            if(pool_stride_x == 1)
+            {
+                const uint16x8_t res_lower = scale_sums_qasymm8(vaddq_u16(sum_lower, vextq_u16(sum_lower, sum_upper, 1)), scale);
+                const uint16x8_t res_upper = scale_sums_qasymm8(vaddq_u16(sum_upper, vextq_u16(sum_upper, sum_upper, 1)), scale);
+                vst1q_u8(output.ptr(), vcombine_u8(vmovn_u16(res_lower), vmovn_u16(res_upper)));
+            }
+            else
+            {
+                const uint16x8_t sums = vcombine_u16(vpadd_u16(vget_low_u16(sum_lower), vget_high_u16(sum_lower)),
+                                                     vpadd_u16(vget_low_u16(sum_upper), vget_high_u16(sum_upper)));
+                vst1_u8(output.ptr(), vmovn_u16(scale_sums_qasymm8(sums, scale)));
+            }
+        }
+        else
+        {
+            const uint8x16_t max_data  = vmaxq_u8(top_data, bottom_data);
+            const uint8x8_t  lower_res = vpmax_u8(vget_low_u8(max_data), vget_high_u8(max_data));
+            if(pool_stride_x == 1)
+            {
+                const uint8x16_t  max_data_shifted = vextq_u8(max_data, max_data, 1);
+                const uint8x8_t   upper_res        = vpmax_u8(vget_low_u8(max_data_shifted), vget_high_u8(max_data_shifted));
+                const uint8x8x2_t res              = { { lower_res, upper_res } };
+                vst2_u8(output.ptr(), res);
+            }
+            else
+            {
+                vst1_u8(output.ptr(), lower_res);
+            }
+        }
+    },
+    input, output);
+}
+
 template <PoolingType pooling_type>
 void NEPoolingLayerKernel::pooling2_q16(const Window &window_input, const Window &window)
 {
@@ -677,11 +1036,32 @@ void NEPoolingLayerKernel::pooling2_f32(const Window &window_input, const Window
     const int upper_bound_w = _input->info()->dimension(0) + pool_pad_x;
     const int upper_bound_h = _input->info()->dimension(1) + pool_pad_y;
 
+    const int input_width  = _input->info()->dimension(0);
+    const int input_height = _input->info()->dimension(1);
+
     const uint8_t *const input_top_ptr    = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y)));
     const uint8_t *const input_bottom_ptr = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y) + 1));
 
+    // The first row the next output row will newly touch, a stride the hardware prefetcher does not follow
+    const int prefetch_offset = _input->info()->strides_in_bytes()[1] * std::max(pool_size, pool_stride_y);
+
     execute_window_loop(window, [&](const Coordinates & id)
     {
+        input.prefetch(prefetch_offset);
+
+        // Skip pooling regions the zero mask guarantees to contain only zeros
+        if(_zero_mask != nullptr)
+        {
+            const int in_x = id.x() * pool_stride_x - pool_pad_x;
+            const int in_y = id.y() * pool_stride_y - pool_pad_y;
+
+            if(in_x >= 0 && in_y >= 0 && (in_x + pool_size) <= input_width && (in_y + pool_size) <= input_height && is_zero_region(_zero_mask, id, in_x, in_y, pool_size))
+            {
+                *(reinterpret_cast<float *>(output.ptr())) = 0.f;
+                return;
+            }
+        }
+
         float32x2_t top_data    = vld1_f32(reinterpret_cast<const float *>(input_top_ptr + input.offset()));
         float32x2_t bottom_data = vld1_f32(reinterpret_cast<const float *>(input_bottom_ptr + input.offset()));
         float32x2_t res         = {};
@@ -799,30 +1179,100 @@ void NEPoolingLayerKernel::pooling3_q8(const Window &window_input, const Window
 }
 
 template <PoolingType pooling_type>
-void NEPoolingLayerKernel::pooling3_q16(const Window &window_input, const Window &window)
+void NEPoolingLayerKernel::pooling3_qasymm8(const Window &window_input, const Window &window)
 {
     Iterator input(_input, window_input);
     Iterator output(_output, window);
 
-    const int     fixed_point_position = _input->info()->fixed_point_position();
-    constexpr int pool_size            = 3;
-    int           pool_pad_x           = 0;
-    int           pool_pad_y           = 0;
-    int           pool_stride_x        = 0;
-    int           pool_stride_y        = 0;
+    constexpr int pool_size     = 3;
+    int           pool_pad_x    = 0;
+    int           pool_pad_y    = 0;
+    int           pool_stride_x = 0;
+    int           pool_stride_y = 0;
     std::tie(pool_pad_x, pool_pad_y)       = _pool_info.pad_stride_info().pad();
     std::tie(pool_stride_x, pool_stride_y) = _pool_info.pad_stride_info().stride();
     const int upper_bound_w = _input->info()->dimension(0) + pool_pad_x;
     const int upper_bound_h = _input->info()->dimension(1) + pool_pad_y;
 
-    const unsigned char *const input_top_ptr    = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y)));
-    const unsigned char *const input_middle_ptr = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y) + 1));
-    const unsigned char *const input_bottom_ptr = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y) + 2));
+    const uint8_t *const input_top_ptr    = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y)));
+    const uint8_t *const input_middle_ptr = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y) + 1));
+    const uint8_t *const input_bottom_ptr = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y) + 2));
 
     execute_window_loop(window, [&](const Coordinates & id)
     {
-        const auto top_data    = vld1q_qs16(reinterpret_cast<const qint16_t *>(input_top_ptr + input.offset()));
-        const auto middle_data = vld1q_qs16(reinterpret_cast<const qint16_t *>(input_middle_ptr + input.offset()));
+        const auto top_data    = vld1q_u8(input_top_ptr + input.offset());
+        const auto middle_data = vld1q_u8(input_middle_ptr + input.offset());
+        const auto bottom_data = vld1q_u8(input_bottom_ptr + input.offset());
+        if(pooling_type == PoolingType::AVG)
+        {
+            const int16_t scale = calculate_avg_scale_qasymm8(id, pool_size, upper_bound_w, upper_bound_h, pool_pad_x, pool_pad_y, pool_stride_x, pool_stride_y);
+
+            // Vertical sums of the three rows, kept in 16 bits to avoid overflow
+            const uint16x8_t sum_lower = vaddw_u8(vaddl_u8(vget_low_u8(top_data), vget_low_u8(middle_data)), vget_low_u8(bottom_data));
+            const uint16x8_t sum_upper = vaddw_u8(vaddl_u8(vget_high_u8(top_data), vget_high_u8(middle_data)), vget_high_u8(bottom_data));
+
+            // Horizontal sums over the three adjacent columns
+            const uint16x8_t final_lower = vaddq_u16(vaddq_u16(sum_lower, vextq_u16(sum_lower, sum_upper, 1)), vextq_u16(sum_lower, sum_upper, 2));
+            const uint16x8_t final_upper = vaddq_u16(vaddq_u16(sum_upper, vextq_u16(sum_upper, sum_upper, 1)), vextq_u16(sum_upper, sum_upper, 2));
+
+            if(pool_stride_x == 2)
+            {
+                const uint16x8_t even_sums = vuzpq_u16(final_lower, final_upper).val[0];
+                vst1_u8(output.ptr(), vmovn_u16(scale_sums_qasymm8(even_sums, scale)));
+            }
+            else
+            {
+                vst1q_u8(output.ptr(), vcombine_u8(vmovn_u16(scale_sums_qasymm8(final_lower, scale)),
+                                                   vmovn_u16(scale_sums_qasymm8(final_upper, scale))));
+            }
+        }
+        else
+        {
+            const uint8x16_t max_data  = vmaxq_u8(vmaxq_u8(top_data, bottom_data), middle_data);
+            const uint8x16_t max_data2 = vextq_u8(max_data, max_data, 1);
+            const uint8x16_t max_data3 = vextq_u8(max_data, max_data, 2);
+            const uint8x16_t final_max = vmaxq_u8(vmaxq_u8(max_data, max_data2), max_data3);
+
+            if(pool_stride_x == 2)
+            {
+                const uint8x8x2_t      table      = { { vget_low_u8(final_max), vget_high_u8(final_max) } };
+                static const uint8x8_t lookup_val = { 0, 2, 4, 6, 8, 10, 12, 14 };
+                vst1_u8(output.ptr(), vtbl2_u8(table, lookup_val));
+            }
+            else
+            {
+                vst1q_u8(output.ptr(), final_max);
+            }
+        }
+    },
+    input, output);
+}
+
+template <PoolingType pooling_type>
+void NEPoolingLayerKernel::pooling3_q16(const Window &window_input, const Window &window)
+{
+    Iterator input(_input, window_input);
+    Iterator output(_output, window);
+
+    const int     fixed_point_position = _input->info()->fixed_point_position();
+    constexpr int pool_size            = 3;
+    int           pool_pad_x           = 0;
+    int           pool_pad_y           = 0;
+    int           pool_stride_x        = 0;
+    int           pool_stride_y        = 0;
+    std::tie(pool_pad_x, pool_pad_y)       = _pool_info.pad_stride_info().pad();
+    std::tie(pool_stride_x, pool_stride_y) = _pool_info.pad_stride_info().stride();
+    const int upper_bound_w = _input->info()->dimension(0) + pool_pad_x;
+    const int upper_bound_h = _input->info()->dimension(1) + pool_pad_y;
+
+    const unsigned char *const input_top_ptr    = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y)));
+    const unsigned char *const input_middle_ptr = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y) + 1));
+    const unsigned char *const input_bottom_ptr = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y) + 2));
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto top_data    = vld1q_qs16(reinterpret_cast<const qint16_t *>(input_top_ptr + input.offset()));
+        const auto middle_data = vld1q_qs16(reinterpret_cast<const qint16_t *>(input_middle_ptr + input.offset()));
         const auto bottom_data = vld1q_qs16(reinterpret_cast<const qint16_t *>(input_bottom_ptr + input.offset()));
 
         if(pooling_type == PoolingType::AVG)
@@ -884,12 +1334,33 @@ void NEPoolingLayerKernel::pooling3_f32(const Window &window_input, const Window
     const int upper_bound_w = _input->info()->dimension(0) + pool_pad_x;
     const int upper_bound_h = _input->info()->dimension(1) + pool_pad_y;
 
+    const int input_width  = _input->info()->dimension(0);
+    const int input_height = _input->info()->dimension(1);
+
     const uint8_t *const input_top_ptr    = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y)));
     const uint8_t *const input_middle_ptr = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y) + 1));
     const uint8_t *const input_bottom_ptr = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y) + 2));
 
+    // The first row the next output row will newly touch, a stride the hardware prefetcher does not follow
+    const int prefetch_offset = _input->info()->strides_in_bytes()[1] * std::max(pool_size, pool_stride_y);
+
     execute_window_loop(window, [&](const Coordinates & id)
     {
+        input.prefetch(prefetch_offset);
+
+        // Skip pooling regions the zero mask guarantees to contain only zeros
+        if(_zero_mask != nullptr)
+        {
+            const int in_x = id.x() * pool_stride_x - pool_pad_x;
+            const int in_y = id.y() * pool_stride_y - pool_pad_y;
+
+            if(in_x >= 0 && in_y >= 0 && (in_x + pool_size) <= input_width && (in_y + pool_size) <= input_height && is_zero_region(_zero_mask, id, in_x, in_y, pool_size))
+            {
+                *(reinterpret_cast<float *>(output.ptr())) = 0.f;
+                return;
+            }
+        }
+
         float32x4_t top_data    = vld1q_f32(reinterpret_cast<const float *>(input_top_ptr + input.offset()));
         float32x4_t middle_data = vld1q_f32(reinterpret_cast<const float *>(input_middle_ptr + input.offset()));
         float32x4_t bottom_data = vld1q_f32(reinterpret_cast<const float *>(input_bottom_ptr + input.offset()));
@@ -957,8 +1428,13 @@ void NEPoolingLayerKernel::pooling7_f32(const Window &window_input, const Window
         input_ptrs[i] = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y) + i));
     }
 
+    // The first row the next output row will newly touch, a stride the hardware prefetcher does not follow
+    const int prefetch_offset = _input->info()->strides_in_bytes()[1] * std::max(pool_size, pool_stride_y);
+
     execute_window_loop(window, [&](const Coordinates & id)
     {
+        input.prefetch(prefetch_offset);
+
         float32x2_t res       = {};
         float       final_res = 0.f;
         if(pooling_type != PoolingType::MAX)
@@ -1017,6 +1493,178 @@ void NEPoolingLayerKernel::pooling7_f32(const Window &window_input, const Window
     input, output);
 }
 
+template <PoolingType pooling_type>
+void NEPoolingLayerKernel::pooling_global_f32(const Window &window_input, const Window &window)
+{
+    Iterator input(_input, window_input);
+    Iterator output(_output, window);
+
+    const int    width    = _input->info()->dimension(0);
+    const int    height   = _input->info()->dimension(1);
+    const size_t stride_y = _input->info()->strides_in_bytes().y();
+    const float  scale    = 1.0f / (width * height);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        ARM_COMPUTE_UNUSED(id);
+        const float init  = (pooling_type == PoolingType::MAX) ? -std::numeric_limits<float>::max() : 0.0f;
+        float32x4_t vres0 = vdupq_n_f32(init);
+        float32x4_t vres1 = vdupq_n_f32(init);
+        float       res   = init;
+
+        for(int y = 0; y < height; ++y)
+        {
+            const auto *row = reinterpret_cast<const float *>(input.ptr() + y * stride_y);
+
+            int x = 0;
+            for(; x <= (width - 8); x += 8)
+            {
+                const float32x4_t data0 = vld1q_f32(row + x);
+                const float32x4_t data1 = vld1q_f32(row + x + 4);
+
+                if(pooling_type == PoolingType::L2)
+                {
+                    vres0 = vmlaq_f32(vres0, data0, data0);
+                    vres1 = vmlaq_f32(vres1, data1, data1);
+                }
+                else if(pooling_type == PoolingType::AVG)
+                {
+                    vres0 = vaddq_f32(vres0, data0);
+                    vres1 = vaddq_f32(vres1, data1);
+                }
+                else
+                {
+                    vres0 = vmaxq_f32(vres0, data0);
+                    vres1 = vmaxq_f32(vres1, data1);
+                }
+            }
+
+            // Leftover for loop
+            for(; x < width; ++x)
+            {
+                float data = row[x];
+
+                if(pooling_type == PoolingType::L2)
+                {
+                    data *= data;
+                }
+
+                if(pooling_type == PoolingType::MAX)
+                {
+                    res = std::max(res, data);
+                }
+                else
+                {
+                    res += data;
+                }
+            }
+        }
+
+        // Reduction
+        if(pooling_type == PoolingType::MAX)
+        {
+            const float32x4_t vres = vmaxq_f32(vres0, vres1);
+            float32x2_t       tmp  = vpmax_f32(vget_high_f32(vres), vget_low_f32(vres));
+            tmp                    = vpmax_f32(tmp, tmp);
+            res                    = std::max(res, vget_lane_f32(tmp, 0));
+        }
+        else
+        {
+            const float32x4_t vres = vaddq_f32(vres0, vres1);
+            float32x2_t       tmp  = vpadd_f32(vget_high_f32(vres), vget_low_f32(vres));
+            tmp                    = vpadd_f32(tmp, tmp);
+            res += vget_lane_f32(tmp, 0);
+
+            // Divide by scale
+            res *= scale;
+        }
+
+        // Calculate square-root in case of l2 pooling
+        if(pooling_type == PoolingType::L2)
+        {
+            res = std::sqrt(res);
+        }
+
+        *(reinterpret_cast<float *>(output.ptr())) = res;
+    },
+    input, output);
+}
+
+template <PoolingType pooling_type>
+void NEPoolingLayerKernel::pooling_global_qasymm8(const Window &window_input, const Window &window)
+{
+    Iterator input(_input, window_input);
+    Iterator output(_output, window);
+
+    const int    width    = _input->info()->dimension(0);
+    const int    height   = _input->info()->dimension(1);
+    const size_t stride_y = _input->info()->strides_in_bytes().y();
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        ARM_COMPUTE_UNUSED(id);
+        uint32x4_t vsum  = vdupq_n_u32(0);
+        uint8x16_t vmax  = vdupq_n_u8(0);
+        uint32_t   sum   = 0;
+        uint8_t    max   = 0;
+
+        for(int y = 0; y < height; ++y)
+        {
+            const uint8_t *row = input.ptr() + y * stride_y;
+
+            int x = 0;
+            for(; x <= (width - 16); x += 16)
+            {
+                const uint8x16_t data = vld1q_u8(row + x);
+
+                if(pooling_type == PoolingType::MAX)
+                {
+                    vmax = vmaxq_u8(vmax, data);
+                }
+                else
+                {
+                    const uint16x8_t sum16 = vaddl_u8(vget_low_u8(data), vget_high_u8(data));
+                    vsum                   = vpadalq_u16(vsum, sum16);
+                }
+            }
+
+            // Leftover for loop
+            for(; x < width; ++x)
+            {
+                if(pooling_type == PoolingType::MAX)
+                {
+                    max = std::max(max, row[x]);
+                }
+                else
+                {
+                    sum += row[x];
+                }
+            }
+        }
+
+        if(pooling_type == PoolingType::MAX)
+        {
+            uint8x8_t tmp = vpmax_u8(vget_high_u8(vmax), vget_low_u8(vmax));
+            tmp           = vpmax_u8(tmp, tmp);
+            tmp           = vpmax_u8(tmp, tmp);
+            tmp           = vpmax_u8(tmp, tmp);
+            max           = std::max(max, vget_lane_u8(tmp, 0));
+
+            *output.ptr() = max;
+        }
+        else
+        {
+            const uint32x2_t tmp = vpadd_u32(vget_high_u32(vsum), vget_low_u32(vsum));
+            sum += vget_lane_u32(vpadd_u32(tmp, tmp), 0);
+
+            // Round to nearest while dividing by the pooling region size
+            const uint32_t count = width * height;
+            *output.ptr()        = static_cast<uint8_t>((sum + (count / 2)) / count);
+        }
+    },
+    input, output);
+}
+
 template <PoolingType pooling_type>
 void NEPoolingLayerKernel::poolingN_f32(const Window &window_input, const Window &window)
 {
@@ -1138,6 +1786,370 @@ void NEPoolingLayerKernel::poolingN_f32(const Window &window_input, const Window
     input, output);
 }
 
+template <PoolingType pooling_type>
+void NEPoolingLayerKernel::poolingN_q8(const Window &window_input, const Window &window)
+{
+    Iterator input(_input, window_input);
+    Iterator output(_output, window);
+
+    const int pool_size     = _pool_info.pool_size();
+    int       pool_pad_x    = 0;
+    int       pool_pad_y    = 0;
+    int       pool_stride_x = 0;
+    int       pool_stride_y = 0;
+    std::tie(pool_pad_x, pool_pad_y)       = _pool_info.pad_stride_info().pad();
+    std::tie(pool_stride_x, pool_stride_y) = _pool_info.pad_stride_info().stride();
+    const int upper_bound_w = _input->info()->dimension(0) + pool_pad_x;
+    const int upper_bound_h = _input->info()->dimension(1) + pool_pad_y;
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        qint8_t res = 0;
+
+        if(pooling_type == PoolingType::AVG)
+        {
+            // Perform pooling in a widened accumulator: averaging the raw values keeps the fixed point format
+            int32_t   sum  = 0;
+            int32x4_t vsum = vdupq_n_s32(0);
+
+            for(int y = 0; y < pool_size; ++y)
+            {
+                int x = 0;
+                for(; x <= (pool_size - 8); x += 8)
+                {
+                    const qint8x8_t data = vld1_qs8(reinterpret_cast<const qint8_t *>(input.ptr() + (x - pool_pad_x) * _input->info()->strides_in_bytes().x() +
+                                                                                      (y - pool_pad_y) * _input->info()->strides_in_bytes().y()));
+                    vsum                 = vpadalq_s16(vsum, vmovl_s8(data));
+                }
+
+                // Leftover for loop
+                for(; x < pool_size; ++x)
+                {
+                    sum += *(reinterpret_cast<const qint8_t *>(input.ptr() + (x - pool_pad_x) * _input->info()->strides_in_bytes().x() + (y - pool_pad_y) * _input->info()->strides_in_bytes().y()));
+                }
+            }
+
+            // Reduction
+            int32x2_t tmp = vpadd_s32(vget_high_s32(vsum), vget_low_s32(vsum));
+            tmp           = vpadd_s32(tmp, tmp);
+            sum += vget_lane_s32(tmp, 0);
+
+            // Divide by the number of elements in the pooling region, rounding to nearest
+            const int start_x = id.x() * pool_stride_x - pool_pad_x;
+            const int start_y = id.y() * pool_stride_y - pool_pad_y;
+            const int count   = (std::min(start_x + pool_size, upper_bound_w) - start_x) * (std::min(start_y + pool_size, upper_bound_h) - start_y);
+
+            res = static_cast<qint8_t>((sum + ((sum >= 0) ? count : -count) / 2) / count);
+        }
+        else
+        {
+            qint8x8_t vres = vdup_n_s8(std::numeric_limits<int8_t>::lowest());
+            res            = std::numeric_limits<int8_t>::lowest();
+
+            for(int y = 0; y < pool_size; ++y)
+            {
+                int x = 0;
+                for(; x <= (pool_size - 8); x += 8)
+                {
+                    const qint8x8_t data = vld1_qs8(reinterpret_cast<const qint8_t *>(input.ptr() + (x - pool_pad_x) * _input->info()->strides_in_bytes().x() +
+                                                                                      (y - pool_pad_y) * _input->info()->strides_in_bytes().y()));
+                    vres                 = vmax_s8(vres, data);
+                }
+
+                // Leftover for loop
+                for(; x < pool_size; ++x)
+                {
+                    const qint8_t data = *(reinterpret_cast<const qint8_t *>(input.ptr() + (x - pool_pad_x) * _input->info()->strides_in_bytes().x() + (y - pool_pad_y) * _input->info()->strides_in_bytes().y()));
+                    res                = std::max(res, data);
+                }
+            }
+
+            // Reduction
+            vres = vpmax_s8(vres, vres);
+            vres = vpmax_s8(vres, vres);
+            vres = vpmax_s8(vres, vres);
+
+            res = std::max(res, vget_lane_s8(vres, 0));
+        }
+
+        // Store result
+        *(reinterpret_cast<qint8_t *>(output.ptr())) = res;
+    },
+    input, output);
+}
+
+template <PoolingType pooling_type>
+void NEPoolingLayerKernel::poolingN_q16(const Window &window_input, const Window &window)
+{
+    Iterator input(_input, window_input);
+    Iterator output(_output, window);
+
+    const int pool_size     = _pool_info.pool_size();
+    int       pool_pad_x    = 0;
+    int       pool_pad_y    = 0;
+    int       pool_stride_x = 0;
+    int       pool_stride_y = 0;
+    std::tie(pool_pad_x, pool_pad_y)       = _pool_info.pad_stride_info().pad();
+    std::tie(pool_stride_x, pool_stride_y) = _pool_info.pad_stride_info().stride();
+    const int upper_bound_w = _input->info()->dimension(0) + pool_pad_x;
+    const int upper_bound_h = _input->info()->dimension(1) + pool_pad_y;
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        qint16_t res = 0;
+
+        if(pooling_type == PoolingType::AVG)
+        {
+            // Perform pooling in a widened accumulator: averaging the raw values keeps the fixed point format
+            int32_t   sum  = 0;
+            int32x4_t vsum = vdupq_n_s32(0);
+
+            for(int y = 0; y < pool_size; ++y)
+            {
+                int x = 0;
+                for(; x <= (pool_size - 8); x += 8)
+                {
+                    const qint16x8_t data = vld1q_qs16(reinterpret_cast<const qint16_t *>(input.ptr() + (x - pool_pad_x) * _input->info()->strides_in_bytes().x() +
+                                                                                          (y - pool_pad_y) * _input->info()->strides_in_bytes().y()));
+                    vsum                  = vpadalq_s16(vsum, data);
+                }
+
+                // Leftover for loop
+                for(; x < pool_size; ++x)
+                {
+                    sum += *(reinterpret_cast<const qint16_t *>(input.ptr() + (x - pool_pad_x) * _input->info()->strides_in_bytes().x() + (y - pool_pad_y) * _input->info()->strides_in_bytes().y()));
+                }
+            }
+
+            // Reduction
+            int32x2_t tmp = vpadd_s32(vget_high_s32(vsum), vget_low_s32(vsum));
+            tmp           = vpadd_s32(tmp, tmp);
+            sum += vget_lane_s32(tmp, 0);
+
+            // Divide by the number of elements in the pooling region, rounding to nearest
+            const int start_x = id.x() * pool_stride_x - pool_pad_x;
+            const int start_y = id.y() * pool_stride_y - pool_pad_y;
+            const int count   = (std::min(start_x + pool_size, upper_bound_w) - start_x) * (std::min(start_y + pool_size, upper_bound_h) - start_y);
+
+            res = static_cast<qint16_t>((sum + ((sum >= 0) ? count : -count) / 2) / count);
+        }
+        else
+        {
+            qint16x8_t vres = vdupq_n_s16(std::numeric_limits<int16_t>::lowest());
+            res             = std::numeric_limits<int16_t>::lowest();
+
+            for(int y = 0; y < pool_size; ++y)
+            {
+                int x = 0;
+                for(; x <= (pool_size - 8); x += 8)
+                {
+                    const qint16x8_t data = vld1q_qs16(reinterpret_cast<const qint16_t *>(input.ptr() + (x - pool_pad_x) * _input->info()->strides_in_bytes().x() +
+                                                                                          (y - pool_pad_y) * _input->info()->strides_in_bytes().y()));
+                    vres                  = vmaxq_s16(vres, data);
+                }
+
+                // Leftover for loop
+                for(; x < pool_size; ++x)
+                {
+                    const qint16_t data = *(reinterpret_cast<const qint16_t *>(input.ptr() + (x - pool_pad_x) * _input->info()->strides_in_bytes().x() + (y - pool_pad_y) * _input->info()->strides_in_bytes().y()));
+                    res                 = std::max(res, data);
+                }
+            }
+
+            // Reduction
+            qint16x4_t tmp = vpmax_s16(vget_high_s16(vres), vget_low_s16(vres));
+            tmp            = vpmax_s16(tmp, tmp);
+            tmp            = vpmax_s16(tmp, tmp);
+
+            res = std::max(res, vget_lane_s16(tmp, 0));
+        }
+
+        // Store result
+        *(reinterpret_cast<qint16_t *>(output.ptr())) = res;
+    },
+    input, output);
+}
+
+template <PoolingType pooling_type>
+void NEPoolingLayerKernel::pooling_f32_nhwc(const Window &window_input, const Window &window)
+{
+    ARM_COMPUTE_UNUSED(window_input);
+
+    Iterator output(_output, window);
+
+    const int pool_size     = _pool_info.pool_size();
+    int       pool_pad_x    = 0;
+    int       pool_pad_y    = 0;
+    int       pool_stride_x = 0;
+    int       pool_stride_y = 0;
+    std::tie(pool_pad_x, pool_pad_y)       = _pool_info.pad_stride_info().pad();
+    std::tie(pool_stride_x, pool_stride_y) = _pool_info.pad_stride_info().stride();
+
+    const int input_width   = _input->info()->dimension(1);
+    const int input_height  = _input->info()->dimension(2);
+    const int upper_bound_w = input_width + pool_pad_x;
+    const int upper_bound_h = input_height + pool_pad_y;
+
+    const size_t input_stride_w = _input->info()->strides_in_bytes()[1];
+    const size_t input_stride_h = _input->info()->strides_in_bytes()[2];
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int start_x = id.y() * pool_stride_x - pool_pad_x;
+        const int start_y = id.z() * pool_stride_y - pool_pad_y;
+        const int end_x   = std::min(start_x + pool_size, input_width);
+        const int end_y   = std::min(start_y + pool_size, input_height);
+
+        // Point to the first channel of the pooling region
+        Coordinates in_coords(id);
+        in_coords.set(1, 0);
+        in_coords.set(2, 0);
+        const uint8_t *const input_base = _input->buffer() + _input->info()->offset_element_in_bytes(in_coords);
+
+        float32x4_t vres;
+        if(pooling_type != PoolingType::MAX)
+        {
+            // Calculate scale, padded elements count towards the denominator as in the NCHW kernels
+            const float scale = 1.f / ((std::min(start_y + pool_size, upper_bound_h) - start_y) * (std::min(start_x + pool_size, upper_bound_w) - start_x));
+
+            vres = vdupq_n_f32(0.f);
+            for(int y = std::max(start_y, 0); y < end_y; ++y)
+            {
+                for(int x = std::max(start_x, 0); x < end_x; ++x)
+                {
+                    const float32x4_t data = vld1q_f32(reinterpret_cast<const float *>(input_base + y * input_stride_h + x * input_stride_w));
+                    if(pooling_type == PoolingType::L2)
+                    {
+                        vres = vmlaq_f32(vres, data, data);
+                    }
+                    else
+                    {
+                        vres = vaddq_f32(vres, data);
+                    }
+                }
+            }
+
+            // Divide by scale
+            vres = vmulq_n_f32(vres, scale);
+        }
+        else
+        {
+            vres = vdupq_n_f32(-std::numeric_limits<float>::max());
+            for(int y = std::max(start_y, 0); y < end_y; ++y)
+            {
+                for(int x = std::max(start_x, 0); x < end_x; ++x)
+                {
+                    const float32x4_t data = vld1q_f32(reinterpret_cast<const float *>(input_base + y * input_stride_h + x * input_stride_w));
+                    vres                   = vmaxq_f32(vres, data);
+                }
+            }
+        }
+
+        // Calculate square-root in case of l2 pooling
+        if(pooling_type == PoolingType::L2)
+        {
+            float res[4];
+            vst1q_f32(res, vres);
+            for(auto &r : res)
+            {
+                r = std::sqrt(r);
+            }
+            vres = vld1q_f32(res);
+        }
+
+        // Store result
+        vst1q_f32(reinterpret_cast<float *>(output.ptr()), vres);
+    },
+    output);
+}
+
+template <PoolingType pooling_type>
+void NEPoolingLayerKernel::pooling_f32_padding_less(const Window &window_input, const Window &window)
+{
+    ARM_COMPUTE_UNUSED(window_input);
+
+    Iterator output(_output, window);
+
+    const int pool_size     = _pool_info.pool_size();
+    int       pool_pad_x    = 0;
+    int       pool_pad_y    = 0;
+    int       pool_stride_x = 0;
+    int       pool_stride_y = 0;
+    std::tie(pool_pad_x, pool_pad_y)       = _pool_info.pad_stride_info().pad();
+    std::tie(pool_stride_x, pool_stride_y) = _pool_info.pad_stride_info().stride();
+
+    const int input_width   = _input->info()->dimension(0);
+    const int input_height  = _input->info()->dimension(1);
+    const int upper_bound_w = input_width + static_cast<int>(_pool_info.pad_stride_info().pad_right());
+    const int upper_bound_h = input_height + static_cast<int>(_pool_info.pad_stride_info().pad_bottom());
+
+    const size_t input_stride_x = _input->info()->strides_in_bytes()[0];
+    const size_t input_stride_y = _input->info()->strides_in_bytes()[1];
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int start_x = id.x() * pool_stride_x - pool_pad_x;
+        const int start_y = id.y() * pool_stride_y - pool_pad_y;
+        const int end_x   = std::min(start_x + pool_size, input_width);
+        const int end_y   = std::min(start_y + pool_size, input_height);
+
+        // Point to the first element of the pooling region's plane
+        Coordinates in_coords(id);
+        in_coords.set(0, 0);
+        in_coords.set(1, 0);
+        const uint8_t *const input_base = _input->buffer() + _input->info()->offset_element_in_bytes(in_coords);
+
+        float res;
+        if(pooling_type != PoolingType::MAX)
+        {
+            // Calculate scale, padded elements count towards the denominator as in the vector kernels
+            const float scale = 1.f / ((std::min(start_y + pool_size, upper_bound_h) - start_y) * (std::min(start_x + pool_size, upper_bound_w) - start_x));
+
+            res = 0.f;
+            for(int y = std::max(start_y, 0); y < end_y; ++y)
+            {
+                for(int x = std::max(start_x, 0); x < end_x; ++x)
+                {
+                    const float data = *reinterpret_cast<const float *>(input_base + y * input_stride_y + x * input_stride_x);
+                    if(pooling_type == PoolingType::L2)
+                    {
+                        res += data * data;
+                    }
+                    else
+                    {
+                        res += data;
+                    }
+                }
+            }
+
+            // Divide by scale
+            res *= scale;
+        }
+        else
+        {
+            res = -std::numeric_limits<float>::max();
+            for(int y = std::max(start_y, 0); y < end_y; ++y)
+            {
+                for(int x = std::max(start_x, 0); x < end_x; ++x)
+                {
+                    const float data = *reinterpret_cast<const float *>(input_base + y * input_stride_y + x * input_stride_x);
+                    res              = std::max(res, data);
+                }
+            }
+        }
+
+        // Calculate square-root in case of l2 pooling
+        if(pooling_type == PoolingType::L2)
+        {
+            res = std::sqrt(res);
+        }
+
+        // Store result
+        *reinterpret_cast<float *>(output.ptr()) = res;
+    },
+    output);
+}
+
 void NEPoolingLayerKernel::run(const Window &window, const ThreadInfo &info)
 {
     ARM_COMPUTE_UNUSED(info);
@@ -1145,6 +2157,21 @@ void NEPoolingLayerKernel::run(const Window &window, const ThreadInfo &info)
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
     ARM_COMPUTE_ERROR_ON(_func == nullptr);
 
+    // Padding-less mode: the window is expressed in output coordinates and the kernel clamps the
+    // pooling region itself
+    if(_padding_less)
+    {
+        (this->*_func)(window, window);
+        return;
+    }
+
+    // In NHWC the window is expressed in output coordinates and the kernel computes the input offsets itself
+    if(_input->info()->data_layout() == DataLayout::NHWC)
+    {
+        (this->*_func)(window, window);
+        return;
+    }
+
     const unsigned int pool_stride_x = _pool_info.pad_stride_info().stride().first;
     const unsigned int pool_stride_y = _pool_info.pad_stride_info().stride().second;
 
@@ -1154,6 +2181,7 @@ void NEPoolingLayerKernel::run(const Window &window, const ThreadInfo &info)
     switch(_input->info()->data_type())
     {
         case DataType::QS8:
+        case DataType::QASYMM8:
         case DataType::QS16:
         case DataType::F16:
         {
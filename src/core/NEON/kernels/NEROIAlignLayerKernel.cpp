@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEROIAlignLayerKernel.h"
+
+#include "arm_compute/core/AccessWindowStatic.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <cmath>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Sample the input plane at the given (non integer) location using bilinear interpolation.
+ *
+ * Coordinates are expected to be inside the plane; samples falling on the last row or column
+ * degenerate to linear/nearest interpolation through the clamped high indices.
+ */
+inline float bilinear_sample(const ITensor *input, int fm, int batch, float x, float y, int width, int height)
+{
+    const int x_low  = static_cast<int>(x);
+    const int y_low  = static_cast<int>(y);
+    const int x_high = std::min(x_low + 1, width - 1);
+    const int y_high = std::min(y_low + 1, height - 1);
+
+    const float lx = x - x_low;
+    const float ly = y - y_low;
+    const float hx = 1.f - lx;
+    const float hy = 1.f - ly;
+
+    const float data00 = *reinterpret_cast<const float *>(input->ptr_to_element(Coordinates(x_low, y_low, fm, batch)));
+    const float data01 = *reinterpret_cast<const float *>(input->ptr_to_element(Coordinates(x_high, y_low, fm, batch)));
+    const float data10 = *reinterpret_cast<const float *>(input->ptr_to_element(Coordinates(x_low, y_high, fm, batch)));
+    const float data11 = *reinterpret_cast<const float *>(input->ptr_to_element(Coordinates(x_high, y_high, fm, batch)));
+
+    return hy * (hx * data00 + lx * data01) + ly * (hx * data10 + lx * data11);
+}
+} // namespace
+
+NEROIAlignLayerKernel::NEROIAlignLayerKernel()
+    : _input(nullptr), _rois(nullptr), _output(nullptr), _pool_info(0, 0, 0.f)
+{
+}
+
+void NEROIAlignLayerKernel::configure(const ITensor *input, const IROIArray *rois, ITensor *output, const ROIPoolingLayerInfo &pool_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, rois, output);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON((pool_info.pooled_width() == 0) || (pool_info.pooled_height() == 0));
+    ARM_COMPUTE_ERROR_ON(rois->num_values() == 0);
+
+    // Output auto inizialitation if not yet initialized
+    TensorShape output_shape(pool_info.pooled_width(), pool_info.pooled_height(), input->info()->dimension(2), rois->num_values());
+    auto_init_if_empty(*output->info(), output_shape, 1, input->info()->data_type(), input->info()->fixed_point_position());
+
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON((output->info()->dimension(0) != pool_info.pooled_width()) || (output->info()->dimension(1) != pool_info.pooled_height()));
+
+    // Set instance variables
+    _input     = input;
+    _rois      = rois;
+    _output    = output;
+    _pool_info = pool_info;
+
+    // Configure kernel window
+    Window window;
+    window.set(Window::DimX, Window::Dimension(0, rois->num_values()));
+    window.set(Window::DimY, Window::Dimension(0, 1));
+
+    AccessWindowStatic input_access(input->info(),
+                                    input->info()->valid_region().start(0),
+                                    input->info()->valid_region().start(1),
+                                    input->info()->valid_region().end(0),
+                                    input->info()->valid_region().end(1));
+    AccessWindowStatic output_access(output->info(), 0, 0, pool_info.pooled_width(), pool_info.pooled_height());
+
+    update_window_and_padding(window, input_access, output_access);
+    output_access.set_valid_region(window, ValidRegion(Coordinates(), output->info()->tensor_shape()));
+    INEKernel::configure(window);
+}
+
+void NEROIAlignLayerKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int   roi_list_start = window.x().start();
+    const int   roi_list_end   = window.x().end();
+    const int   width          = _input->info()->dimension(Window::DimX);
+    const int   height         = _input->info()->dimension(Window::DimY);
+    const int   fms            = _input->info()->dimension(Window::DimZ);
+    const int   pooled_w       = _pool_info.pooled_width();
+    const int   pooled_h       = _pool_info.pooled_height();
+    const float spatial_scale  = _pool_info.spatial_scale();
+
+    for(int roi_indx = roi_list_start; roi_indx < roi_list_end; ++roi_indx)
+    {
+        const ROI &curr_roi = _rois->at(roi_indx);
+
+        // Scale ROI without quantizing the coordinates to the feature map grid
+        const int   roi_batch  = curr_roi.batch_idx;
+        const float roi_x      = curr_roi.rect.x * spatial_scale;
+        const float roi_y      = curr_roi.rect.y * spatial_scale;
+        const float roi_width  = std::max(curr_roi.rect.width * spatial_scale, 1.f);
+        const float roi_height = std::max(curr_roi.rect.height * spatial_scale, 1.f);
+
+        const float bin_size_x = roi_width / pooled_w;
+        const float bin_size_y = roi_height / pooled_h;
+
+        // Adaptive sampling: one sample per input cell covered by the bin
+        const int samples_x = std::max(static_cast<int>(std::ceil(bin_size_x)), 1);
+        const int samples_y = std::max(static_cast<int>(std::ceil(bin_size_y)), 1);
+
+        // Iterate through all feature maps
+        for(int fm = 0; fm < fms; ++fm)
+        {
+            // Iterate through all output pixels
+            for(int py = 0; py < pooled_h; ++py)
+            {
+                for(int px = 0; px < pooled_w; ++px)
+                {
+                    float sum = 0.f;
+
+                    for(int sy = 0; sy < samples_y; ++sy)
+                    {
+                        float y = roi_y + (py + (sy + 0.5f) / samples_y) * bin_size_y;
+                        y       = std::min(std::max(y, 0.f), static_cast<float>(height - 1));
+
+                        for(int sx = 0; sx < samples_x; ++sx)
+                        {
+                            float x = roi_x + (px + (sx + 0.5f) / samples_x) * bin_size_x;
+                            x       = std::min(std::max(x, 0.f), static_cast<float>(width - 1));
+
+                            sum += bilinear_sample(_input, fm, roi_batch, x, y, width, height);
+                        }
+                    }
+
+                    *reinterpret_cast<float *>(_output->ptr_to_element(Coordinates(px, py, fm, roi_indx))) = sum / (samples_x * samples_y);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEROIGatherKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <cmath>
+#include <cstring>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Sample a single-channel plane at (x, y) with bilinear interpolation, clamping to the borders */
+template <typename T>
+inline T sample_bilinear_clamp(const T *ptr, size_t stride, int width, int height, float x, float y)
+{
+    int   xi = static_cast<int>(std::floor(x));
+    int   yi = static_cast<int>(std::floor(y));
+    float dx = x - xi;
+    float dy = y - yi;
+
+    if(xi < 0)
+    {
+        xi = 0;
+        dx = 0.f;
+    }
+    else if(xi > width - 2)
+    {
+        xi = width - 2;
+        dx = 1.f;
+    }
+    if(yi < 0)
+    {
+        yi = 0;
+        dy = 0.f;
+    }
+    else if(yi > height - 2)
+    {
+        yi = height - 2;
+        dy = 1.f;
+    }
+
+    return delta_bilinear_c1(ptr + xi + yi * stride, stride, dx, dy);
+}
+
+template <typename T>
+void roi_gather(const ITensor *in, const IROIArray *rois, ITensor *out, const Window &window)
+{
+    const auto   in_ptr    = reinterpret_cast<const T *>(in->buffer() + in->info()->offset_first_element_in_bytes());
+    const size_t in_stride = in->info()->strides_in_bytes().y() / sizeof(T);
+    const int    in_width  = in->info()->dimension(0);
+    const int    in_height = in->info()->dimension(1);
+
+    const int out_width  = out->info()->dimension(0);
+    const int out_height = out->info()->dimension(1);
+
+    const size_t num_rois = rois->num_values();
+
+    Iterator output(out, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto out_row = reinterpret_cast<T *>(output.ptr());
+
+        // Zero the slices beyond the gathered regions so a partially filled batch stays valid
+        if(static_cast<size_t>(id.z()) >= num_rois)
+        {
+            std::memset(out_row, 0, out_width * sizeof(T));
+            return;
+        }
+
+        const ROI &roi = rois->at(id.z());
+
+        // Map output pixel centers onto the region
+        const float scale_x = static_cast<float>(roi.rect.width) / out_width;
+        const float scale_y = static_cast<float>(roi.rect.height) / out_height;
+        const float src_y   = roi.rect.y + (id.y() + 0.5f) * scale_y - 0.5f;
+
+        for(int x = 0; x < out_width; ++x)
+        {
+            const float src_x = roi.rect.x + (x + 0.5f) * scale_x - 0.5f;
+            out_row[x]        = sample_bilinear_clamp(in_ptr, in_stride, in_width, in_height, src_x, src_y);
+        }
+    },
+    output);
+}
+} // namespace
+
+NEROIGatherKernel::NEROIGatherKernel()
+    : _func(nullptr), _input(nullptr), _rois(nullptr), _output(nullptr)
+{
+}
+
+void NEROIGatherKernel::configure(const ITensor *input, const IROIArray *rois, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::F32);
+    ARM_COMPUTE_ERROR_ON(rois == nullptr);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(output);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON(input->info()->num_dimensions() > 2);
+    ARM_COMPUTE_ERROR_ON(output->info()->num_dimensions() != 3);
+    ARM_COMPUTE_ERROR_ON_MSG(rois->max_num_values() > output->info()->dimension(2), "The batch dimension of the output must hold the whole ROI array");
+    ARM_COMPUTE_ERROR_ON(input->info()->dimension(0) < 2 || input->info()->dimension(1) < 2);
+
+    switch(input->info()->data_type())
+    {
+        case DataType::U8:
+            _func = &roi_gather<uint8_t>;
+            break;
+        case DataType::F32:
+            _func = &roi_gather<float>;
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported data type.");
+            break;
+    }
+
+    _input  = input;
+    _rois   = rois;
+    _output = output;
+
+    // Each iteration fills a full output row: the samples are clamped to the frame borders,
+    // so neither tensor needs padding
+    const unsigned int num_elems_processed_per_iteration = output->info()->dimension(0);
+
+    Window                 win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win, output_access);
+
+    output_access.set_valid_region(win, ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEROIGatherKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (*_func)(_input, _rois, _output, window);
+}
@@ -32,6 +32,7 @@
 #include "arm_compute/core/Window.h"
 #include "support/ToolchainSupport.h"
 
+#include <arm_neon.h>
 #include <cfloat>
 #include <cmath>
 
@@ -130,15 +131,32 @@ void NEROIPoolingLayerKernel::run(const Window &window, const ThreadInfo &info)
                     }
                     else
                     {
-                        float curr_max = -FLT_MAX;
+                        const int   region_w = region_end_x - region_start_x;
+                        float       curr_max = -FLT_MAX;
+                        float32x4_t vmax     = vdupq_n_f32(-FLT_MAX);
+
                         for(int j = region_start_y; j < region_end_y; ++j)
                         {
-                            for(int i = region_start_x; i < region_end_x; ++i)
+                            const auto row_ptr = reinterpret_cast<const float *>(_input->ptr_to_element(Coordinates(region_start_x, j, fm, roi_batch)));
+
+                            int i = 0;
+                            for(; i <= (region_w - 4); i += 4)
                             {
-                                const auto val = *reinterpret_cast<const float *>(_input->ptr_to_element(Coordinates(i, j, fm, roi_batch)));
-                                curr_max       = std::max(val, curr_max);
+                                vmax = vmaxq_f32(vmax, vld1q_f32(row_ptr + i));
+                            }
+
+                            // Leftover for loop
+                            for(; i < region_w; ++i)
+                            {
+                                curr_max = std::max(row_ptr[i], curr_max);
                             }
                         }
+
+                        // Reduction
+                        float32x2_t tmp = vpmax_f32(vget_high_f32(vmax), vget_low_f32(vmax));
+                        tmp             = vpmax_f32(tmp, tmp);
+                        curr_max        = std::max(curr_max, vget_lane_f32(tmp, 0));
+
                         *reinterpret_cast<float *>(_output->ptr_to_element(Coordinates(px, py, fm, roi_indx))) = curr_max;
                     }
                 }
@@ -28,76 +28,217 @@
 #include "arm_compute/core/IAccessWindow.h"
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/NEON/INEKernel.h"
-#include "arm_compute/core/NEON/NEMath.h"
+#include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
 
 #include <arm_neon.h>
+#include <limits>
 
 using namespace arm_compute;
 
 namespace
 {
-template <class F>
-class Reducer
+/** Visits every combination of coordinates along the reduced higher dimensions
+ *
+ * @param[in] base     Pointer to the element at coordinate 0 of every reduced dimension
+ * @param[in] strides  Stride in bytes of each reduced dimension
+ * @param[in] extents  Number of elements of each reduced dimension
+ * @param[in] num_axes Number of reduced dimensions described by @p strides and @p extents
+ * @param[in] visit    Callback receiving the pointer for each combination
+ */
+template <typename V>
+void for_each_reduced_point(const uint8_t *base, const size_t *strides, const int *extents, int num_axes, V &&visit)
 {
-public:
-    static void reduceX(const Window &window, const ITensor *input, ITensor *output, F f)
+    int            idx[Coordinates::num_max_dimensions] = { 0 };
+    const uint8_t *ptr                                  = base;
+    for(;;)
     {
-        // Set out window
-        Window out_window(window);
-        out_window.set(Window::DimX, Window::Dimension(0, 0, 0));
-
-        // Get first input and output slices
-        Window in_slice  = window.first_slice_window_1D();
-        Window out_slice = out_window.first_slice_window_1D();
+        visit(ptr);
 
-        do
+        // Advance the multi-dimensional index like an odometer
+        int k = 0;
+        while(k < num_axes)
         {
-            Iterator in(input, in_slice);
-            Iterator out(output, out_slice);
-
-            f(in, out, in_slice, out_slice);
+            ++idx[k];
+            ptr += strides[k];
+            if(idx[k] < extents[k])
+            {
+                break;
+            }
+            ptr -= idx[k] * strides[k];
+            idx[k] = 0;
+            ++k;
         }
-        while(window.slide_window_slice_1D(in_slice) && window.slide_window_slice_1D(out_slice));
+        if(k == num_axes)
+        {
+            break;
+        }
+    }
+}
+
+struct SumOp
+{
+    static float32x4_t init()
+    {
+        return vdupq_n_f32(0.f);
+    }
+    static float32x4_t accumulate(float32x4_t acc, float32x4_t elements)
+    {
+        return vaddq_f32(acc, elements);
+    }
+    static float32x2_t pairwise(float32x2_t a, float32x2_t b)
+    {
+        return vpadd_f32(a, b);
+    }
+    static float32x4_t finalize(float32x4_t acc, float inv_num)
+    {
+        ARM_COMPUTE_UNUSED(inv_num);
+        return acc;
+    }
+    static float finalize(float value, float inv_num)
+    {
+        ARM_COMPUTE_UNUSED(inv_num);
+        return value;
     }
 };
 
-struct SumsqOpX
+struct SumsqOp : public SumOp
 {
-    inline void operator()(Iterator &input, Iterator &output, Window &in_slice, Window &out_slice)
+    static float32x4_t accumulate(float32x4_t acc, float32x4_t elements)
     {
-        ARM_COMPUTE_UNUSED(out_slice);
-        float32x4_t vec_sum_value = vdupq_n_f32(0.f);
+        return vaddq_f32(acc, vmulq_f32(elements, elements));
+    }
+};
 
-        execute_window_loop(in_slice, [&](const Coordinates & id)
-        {
-            const auto        in_ptr       = reinterpret_cast<const float *>(input.ptr());
-            const float32x4_t vec_elements = vld1q_f32(in_ptr);
-            vec_sum_value                  = vaddq_f32(vmulq_f32(vec_elements, vec_elements), vec_sum_value);
-        },
-        input);
+struct MeanOp : public SumOp
+{
+    static float32x4_t finalize(float32x4_t acc, float inv_num)
+    {
+        return vmulq_n_f32(acc, inv_num);
+    }
+    static float finalize(float value, float inv_num)
+    {
+        return value * inv_num;
+    }
+};
 
-        float32x2_t carry_addition = vpadd_f32(vget_high_f32(vec_sum_value), vget_low_f32(vec_sum_value));
-        carry_addition             = vpadd_f32(carry_addition, carry_addition);
+struct MaxOp
+{
+    static float32x4_t init()
+    {
+        return vdupq_n_f32(-std::numeric_limits<float>::max());
+    }
+    static float32x4_t accumulate(float32x4_t acc, float32x4_t elements)
+    {
+        return vmaxq_f32(acc, elements);
+    }
+    static float32x2_t pairwise(float32x2_t a, float32x2_t b)
+    {
+        return vpmax_f32(a, b);
+    }
+    static float32x4_t finalize(float32x4_t acc, float inv_num)
+    {
+        ARM_COMPUTE_UNUSED(inv_num);
+        return acc;
+    }
+    static float finalize(float value, float inv_num)
+    {
+        ARM_COMPUTE_UNUSED(inv_num);
+        return value;
+    }
+};
 
-        *(reinterpret_cast<float *>(output.ptr())) = vget_lane_f32(carry_addition, 0);
+struct MinOp : public MaxOp
+{
+    static float32x4_t init()
+    {
+        return vdupq_n_f32(std::numeric_limits<float>::max());
+    }
+    static float32x4_t accumulate(float32x4_t acc, float32x4_t elements)
+    {
+        return vminq_f32(acc, elements);
+    }
+    static float32x2_t pairwise(float32x2_t a, float32x2_t b)
+    {
+        return vpmin_f32(a, b);
     }
 };
 
-void reduce_sumsq(const Window &window, const ITensor *input, ITensor *output, unsigned int axis)
+template <class F>
+class Reducer
 {
-    switch(axis)
+public:
+    static void reduce(const Window &window, const ITensor *input, ITensor *output,
+                       const std::array<bool, Coordinates::num_max_dimensions> &reduced_axes, size_t num_reduced_elements)
     {
-        case 0:
-            return Reducer<SumsqOpX>::reduceX(window, input, output, SumsqOpX());
-        default:
-            ARM_COMPUTE_ERROR("Unsupported reduction axis");
+        const float inv_num = 1.f / static_cast<float>(num_reduced_elements);
+
+        // Collect the strides and extents of the reduced dimensions above X; the window has
+        // them collapsed to a single step, so every output element is owned by exactly one
+        // thread and no cross-thread combination is needed
+        size_t strides[Coordinates::num_max_dimensions] = { 0 };
+        int    extents[Coordinates::num_max_dimensions] = { 0 };
+        int    num_axes                                 = 0;
+        for(size_t d = 1; d < input->info()->num_dimensions(); ++d)
+        {
+            if(reduced_axes[d])
+            {
+                strides[num_axes] = input->info()->strides_in_bytes()[d];
+                extents[num_axes] = input->info()->dimension(d);
+                ++num_axes;
+            }
+        }
+
+        Iterator in(input, window);
+        Iterator out(output, window);
+
+        if(reduced_axes[0])
+        {
+            // The whole row collapses into one lane-reduced scalar; the border is filled with
+            // the operation's neutral value so the padded tail of the row can be consumed whole
+            const size_t row_vectors = ceil_to_multiple(input->info()->dimension(0), 4) / 4;
+
+            execute_window_loop(window, [&](const Coordinates &)
+            {
+                float32x4_t acc = F::init();
+                for_each_reduced_point(in.ptr(), strides, extents, num_axes, [&](const uint8_t *row)
+                {
+                    const auto row_ptr = reinterpret_cast<const float *>(row);
+                    for(size_t i = 0; i < row_vectors; ++i)
+                    {
+                        acc = F::accumulate(acc, vld1q_f32(row_ptr + 4 * i));
+                    }
+                });
+
+                float32x2_t lanes = F::pairwise(vget_high_f32(acc), vget_low_f32(acc));
+                lanes             = F::pairwise(lanes, lanes);
+
+                *reinterpret_cast<float *>(out.ptr()) = F::finalize(vget_lane_f32(lanes, 0), inv_num);
+            },
+            in, out);
+        }
+        else
+        {
+            // X survives the reduction, so four output elements are produced per iteration
+            // and no lane reduction is required
+            execute_window_loop(window, [&](const Coordinates &)
+            {
+                float32x4_t acc = F::init();
+                for_each_reduced_point(in.ptr(), strides, extents, num_axes, [&](const uint8_t *element)
+                {
+                    acc = F::accumulate(acc, vld1q_f32(reinterpret_cast<const float *>(element)));
+                });
+
+                vst1q_f32(reinterpret_cast<float *>(out.ptr()), F::finalize(acc, inv_num));
+            },
+            in, out);
+        }
     }
-}
+};
 } // namespace
 
 NEReductionOperationKernel::NEReductionOperationKernel()
-    : _input(nullptr), _output(nullptr), _reduction_axis(0), _op(ReductionOperation::SUM_SQUARE), _border_size()
+    : _input(nullptr), _output(nullptr), _reduced_axes(), _num_reduced_elements(0), _op(ReductionOperation::SUM_SQUARE), _border_size()
 {
 }
 
@@ -107,14 +248,29 @@ BorderSize NEReductionOperationKernel::border_size() const
 }
 
 void NEReductionOperationKernel::configure(const ITensor *input, ITensor *output, unsigned int axis, ReductionOperation op)
+{
+    configure(input, output, Coordinates(static_cast<int>(axis)), op);
+}
+
+void NEReductionOperationKernel::configure(const ITensor *input, ITensor *output, const Coordinates &axes, ReductionOperation op)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
-    ARM_COMPUTE_ERROR_ON_MSG(axis >= TensorShape::num_max_dimensions, "Reduction axis greater than max number of dimensions");
-    ARM_COMPUTE_ERROR_ON_MSG(axis > 0, "Unsupported reduction axis, Supported axis is 0");
+    ARM_COMPUTE_ERROR_ON_MSG(axes.num_dimensions() == 0, "No reduction axis specified");
+
+    _reduced_axes.fill(false);
+    _num_reduced_elements = 1;
 
     // Calculate output shape and set if empty
     TensorShape output_shape{ input->info()->tensor_shape() };
-    output_shape.set(axis, 1);
+    for(size_t i = 0; i < axes.num_dimensions(); ++i)
+    {
+        const auto axis = static_cast<unsigned int>(axes[i]);
+        ARM_COMPUTE_ERROR_ON_MSG(axis >= TensorShape::num_max_dimensions, "Reduction axis greater than max number of dimensions");
+        ARM_COMPUTE_ERROR_ON_MSG(_reduced_axes[axis], "Reduction axis specified twice");
+        _reduced_axes[axis] = true;
+        _num_reduced_elements *= input->info()->dimension(axis);
+        output_shape.set(axis, 1);
+    }
 
     // Output auto initialization if not yet initialized
     auto_init_if_empty(*output->info(), output_shape, 1, input->info()->data_type(), input->info()->fixed_point_position());
@@ -127,7 +283,7 @@ void NEReductionOperationKernel::configure(const ITensor *input, ITensor *output
 
     _input       = input;
     _output      = output;
-    _border_size = (axis == 0) ? BorderSize(0, num_elems_processed_per_iteration - (input->info()->dimension(0) % num_elems_processed_per_iteration), 0, 0) : BorderSize();
+    _border_size = _reduced_axes[0] ? BorderSize(0, num_elems_processed_per_iteration - (input->info()->dimension(0) % num_elems_processed_per_iteration), 0, 0) : BorderSize();
     _op          = op;
 
     // Configure kernel window
@@ -138,6 +294,17 @@ void NEReductionOperationKernel::configure(const ITensor *input, ITensor *output
     update_window_and_padding(win, input_access, output_access);
     output_access.set_valid_region(win, ValidRegion(Coordinates(), output->info()->tensor_shape()));
 
+    // Collapse the reduced dimensions after the padding requirements have been recorded, so
+    // the run loop visits each output element exactly once and accumulates the reduced
+    // dimensions internally
+    for(size_t d = 0; d < Coordinates::num_max_dimensions; ++d)
+    {
+        if(_reduced_axes[d])
+        {
+            win.set(d, Window::Dimension(0, 1, 1));
+        }
+    }
+
     INEKernel::configure(win);
 }
 
@@ -150,7 +317,19 @@ void NEReductionOperationKernel::run(const Window &window, const ThreadInfo &inf
     switch(_op)
     {
         case ReductionOperation::SUM_SQUARE:
-            reduce_sumsq(window, _input, _output, _reduction_axis);
+            Reducer<SumsqOp>::reduce(window, _input, _output, _reduced_axes, _num_reduced_elements);
+            break;
+        case ReductionOperation::SUM:
+            Reducer<SumOp>::reduce(window, _input, _output, _reduced_axes, _num_reduced_elements);
+            break;
+        case ReductionOperation::MEAN:
+            Reducer<MeanOp>::reduce(window, _input, _output, _reduced_axes, _num_reduced_elements);
+            break;
+        case ReductionOperation::MAX:
+            Reducer<MaxOp>::reduce(window, _input, _output, _reduced_axes, _num_reduced_elements);
+            break;
+        case ReductionOperation::MIN:
+            Reducer<MinOp>::reduce(window, _input, _output, _reduced_axes, _num_reduced_elements);
             break;
         default:
             ARM_COMPUTE_ERROR("Unsupported reduction operation.");
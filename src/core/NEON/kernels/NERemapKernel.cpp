@@ -28,10 +28,13 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
 
+#include <algorithm>
 #include <arm_neon.h>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 
@@ -64,11 +67,11 @@ inline int32x4_t offset_nearest_interpolation(const float *mapx_ptr, const float
 } // namespace
 
 NERemapKernel::NERemapKernel()
-    : _func(nullptr), _input(nullptr), _output(nullptr), _map_x(nullptr), _map_y(nullptr)
+    : _func(nullptr), _input(nullptr), _output(nullptr), _map_x(nullptr), _map_y(nullptr), _compiled_map(), _compiled_offsets(), _compiled_stride(0)
 {
 }
 
-void NERemapKernel::configure(const ITensor *input, const ITensor *map_x, const ITensor *map_y, ITensor *output, InterpolationPolicy policy)
+void NERemapKernel::configure(const ITensor *input, const ITensor *map_x, const ITensor *map_y, ITensor *output, InterpolationPolicy policy, bool compiled_maps)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
@@ -84,12 +87,12 @@ void NERemapKernel::configure(const ITensor *input, const ITensor *map_x, const
     {
         case InterpolationPolicy::NEAREST_NEIGHBOR:
         {
-            _func = &NERemapKernel::remap_nearest;
+            _func = compiled_maps ? &NERemapKernel::remap_nearest_compiled : &NERemapKernel::remap_nearest;
             break;
         }
         case InterpolationPolicy::BILINEAR:
         {
-            _func = &NERemapKernel::remap_bilinear;
+            _func = compiled_maps ? &NERemapKernel::remap_bilinear_compiled : &NERemapKernel::remap_bilinear;
             break;
         }
         default:
@@ -99,6 +102,10 @@ void NERemapKernel::configure(const ITensor *input, const ITensor *map_x, const
 
     constexpr unsigned int num_elems_processed_per_iteration = 16;
 
+    // The compiled tables carry one entry per window lane, including the lanes
+    // of the last partial block
+    _compiled_stride = compiled_maps ? ceil_to_multiple(output->info()->dimension(0), num_elems_processed_per_iteration) : 0;
+
     // Configure kernel window
     Window win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
 
@@ -115,6 +122,70 @@ void NERemapKernel::configure(const ITensor *input, const ITensor *map_x, const
     INEKernel::configure(win);
 }
 
+void NERemapKernel::compile_maps()
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_MSG(_compiled_stride == 0, "Kernel was not configured for compiled maps");
+    ARM_COMPUTE_ERROR_ON(_map_x->buffer() == nullptr);
+    ARM_COMPUTE_ERROR_ON(_map_y->buffer() == nullptr);
+
+    const int width     = _input->info()->dimension(0);
+    const int height    = _input->info()->dimension(1);
+    const int in_stride = _input->info()->strides_in_bytes()[1];
+    const int out_w     = _output->info()->dimension(0);
+    const int out_h     = _output->info()->dimension(1);
+
+    const bool bilinear = (_func == &NERemapKernel::remap_bilinear_compiled);
+
+    if(bilinear)
+    {
+        _compiled_map.resize(static_cast<size_t>(_compiled_stride) * out_h);
+    }
+    else
+    {
+        _compiled_offsets.resize(static_cast<size_t>(_compiled_stride) * out_h);
+    }
+
+    for(int y = 0; y < out_h; ++y)
+    {
+        const auto mapx_row = reinterpret_cast<const float *>(_map_x->ptr_to_element(Coordinates(0, y)));
+        const auto mapy_row = reinterpret_cast<const float *>(_map_y->ptr_to_element(Coordinates(0, y)));
+
+        for(int x = 0; x < static_cast<int>(_compiled_stride); ++x)
+        {
+            // The lanes padding the last block repeat the row's last map entry, so the
+            // vector loop can run full blocks without going out of bounds
+            const int sx = std::min(x, out_w - 1);
+
+            const float mx = mapx_row[sx];
+            const float my = mapy_row[sx];
+
+            if(bilinear)
+            {
+                // Clamp the sample box to the image interior: the borders replicate and
+                // every entry stays a valid gather
+                const float cx = std::max(0.f, std::min(mx, static_cast<float>(width - 1)));
+                const float cy = std::max(0.f, std::min(my, static_cast<float>(height - 1)));
+
+                const int xi = std::max(0, std::min(static_cast<int>(std::floor(cx)), width - 2));
+                const int yi = std::max(0, std::min(static_cast<int>(std::floor(cy)), height - 2));
+
+                const int dx = std::min(255, static_cast<int>((cx - xi) * 256.f + 0.5f));
+                const int dy = std::min(255, static_cast<int>((cy - yi) * 256.f + 0.5f));
+
+                _compiled_map[y * _compiled_stride + x] = CompiledMapEntry{ yi * in_stride + xi, static_cast<uint8_t>(dx), static_cast<uint8_t>(dy), 0, 0 };
+            }
+            else
+            {
+                const int xi = std::max(0, std::min(static_cast<int>(mx), width - 1));
+                const int yi = std::max(0, std::min(static_cast<int>(my), height - 1));
+
+                _compiled_offsets[y * _compiled_stride + x] = yi * in_stride + xi;
+            }
+        }
+    }
+}
+
 void NERemapKernel::remap_nearest(const Window &window)
 {
     // Don't increment in X and Y direction for the input tensor
@@ -216,6 +287,76 @@ void NERemapKernel::remap_bilinear(const Window &window)
     in, out, mapx, mapy);
 }
 
+void NERemapKernel::remap_nearest_compiled(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_compiled_offsets.empty(), "compile_maps() has not been called");
+
+    // Don't increment in X and Y direction for the input tensor
+    // A pointer to the start of this plane is needed as base for the compiled offsets
+    Window win_in(window);
+    win_in.set(Window::DimX, Window::Dimension(0, 0, 0));
+    win_in.set(Window::DimY, Window::Dimension(0, 0, 0));
+
+    Iterator in(_input, win_in);
+    Iterator out(_output, window);
+
+    const int32_t *const offsets = _compiled_offsets.data();
+    const unsigned int   stride  = _compiled_stride;
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const uint8_t *const      in_ptr  = in.ptr();
+        uint8_t *const            out_ptr = out.ptr();
+        const int32_t *const      offset  = offsets + id.y() * stride + id.x();
+
+        for(unsigned int i = 0; i < 16; ++i)
+        {
+            out_ptr[i] = in_ptr[offset[i]];
+        }
+    },
+    in, out);
+}
+
+void NERemapKernel::remap_bilinear_compiled(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_compiled_map.empty(), "compile_maps() has not been called");
+
+    // Don't increment in X and Y direction for the input tensor
+    // A pointer to the start of this plane is needed as base for the compiled offsets
+    Window win_in(window);
+    win_in.set(Window::DimX, Window::Dimension(0, 0, 0));
+    win_in.set(Window::DimY, Window::Dimension(0, 0, 0));
+
+    Iterator in(_input, win_in);
+    Iterator out(_output, window);
+
+    const size_t                  in_stride = _input->info()->strides_in_bytes()[1];
+    const CompiledMapEntry *const entries   = _compiled_map.data();
+    const unsigned int            stride    = _compiled_stride;
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const uint8_t *const          in_ptr  = in.ptr();
+        uint8_t *const                out_ptr = out.ptr();
+        const CompiledMapEntry *const entry   = entries + id.y() * stride + id.x();
+
+        for(unsigned int i = 0; i < 16; ++i)
+        {
+            const CompiledMapEntry &e = entry[i];
+            const uint8_t *const    s = in_ptr + e.offset;
+
+            // Two Q8 lerps: horizontal on each sample row, then vertical between them
+            const int32_t dx  = e.dx;
+            const int32_t dy  = e.dy;
+            const int32_t top = (s[0] << 8) + dx * (s[1] - s[0]);
+            const int32_t bot = (s[in_stride] << 8) + dx * (s[in_stride + 1] - s[in_stride]);
+
+            out_ptr[i] = static_cast<uint8_t>(((top << 8) + dy * (bot - top) + 32768) >> 16);
+        }
+    },
+    in, out);
+}
+
 void NERemapKernel::run(const Window &window, const ThreadInfo &info)
 {
     ARM_COMPUTE_UNUSED(info);
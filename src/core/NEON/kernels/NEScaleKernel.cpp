@@ -33,13 +33,55 @@
 #include "arm_compute/core/Window.h"
 
 #include <arm_neon.h>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <numeric>
 
 using namespace arm_compute;
 
+namespace
+{
+/** Area-average one output pixel whose sampling box is known to lie fully inside the input.
+ *
+ * Same arithmetic as @ref pixel_area_c1u8_clamp with the per-pixel border clamps removed: only
+ * output pixels inside the precomputed interior region may take this path.
+ */
+inline uint8_t pixel_area_c1u8(const uint8_t *first_pixel_ptr, size_t stride, float wr, float hr, int x, int y)
+{
+    // Calculate sampling position
+    const float in_x = (x + 0.5f) * wr - 0.5f;
+    const float in_y = (y + 0.5f) * hr - 0.5f;
+
+    // Get bounding box offsets
+    const int x_from = std::floor(x * wr - 0.5f - in_x);
+    const int y_from = std::floor(y * hr - 0.5f - in_y);
+    const int x_to   = std::ceil((x + 1) * wr - 0.5f - in_x);
+    const int y_to   = std::ceil((y + 1) * hr - 0.5f - in_y);
+
+    // Get pixel index
+    const int xi = std::floor(in_x);
+    const int yi = std::floor(in_y);
+
+    // Bounding box elements in each dimension
+    const int x_elements = (x_to - x_from + 1);
+    const int y_elements = (y_to - y_from + 1);
+
+    // Sum pixels in area
+    int sum = 0;
+    for(int j = yi + y_from, je = yi + y_to; j <= je; ++j)
+    {
+        const uint8_t *ptr = first_pixel_ptr + j * stride + xi + x_from;
+        sum                = std::accumulate(ptr, ptr + x_elements, sum);
+    }
+
+    // Return average
+    return sum / (x_elements * y_elements);
+}
+} // namespace
+
 NEScaleKernel::NEScaleKernel()
-    : _func(nullptr), _offsets(nullptr), _dx(nullptr), _dy(nullptr), _input(nullptr), _output(nullptr)
+    : _func(nullptr), _offsets(nullptr), _dx(nullptr), _dy(nullptr), _input(nullptr), _output(nullptr), _input_row_offsets()
 {
 }
 
@@ -115,6 +157,20 @@ void NEScaleKernel::configure(const ITensor *input, const ITensor *dx, const ITe
             ARM_COMPUTE_ERROR("Unsupported interpolation mode");
     }
 
+    // The input row sampled for a given output row never changes between runs:
+    // precompute its byte offset once so the per-run loops are left with pure
+    // interpolation arithmetic
+    if(policy != InterpolationPolicy::AREA)
+    {
+        const size_t input_stride = input->info()->strides_in_bytes()[1];
+        _input_row_offsets.resize(output->info()->dimension(1));
+        for(size_t y = 0; y < _input_row_offsets.size(); ++y)
+        {
+            const float in_y      = (policy == InterpolationPolicy::BILINEAR) ? (y + 0.5f) * hr - 0.5f : (y + 0.5f) * hr;
+            _input_row_offsets[y] = static_cast<int>(std::floor(in_y)) * static_cast<int>(input_stride);
+        }
+    }
+
     constexpr unsigned int num_elems_processed_per_iteration = 16;
 
     // Configure kernel window
@@ -145,11 +201,6 @@ void NEScaleKernel::configure(const ITensor *input, const ITensor *dx, const ITe
 
 void NEScaleKernel::scale_nearest(const Window &window)
 {
-    const size_t input_stride = _input->info()->strides_in_bytes()[1];
-
-    // Compute the ratio between source height and destination height
-    const auto hr = static_cast<float>(_input->info()->dimension(1)) / static_cast<float>(_output->info()->dimension(1));
-
     // Don't increment in X and Y direction for the input tensor
     // A pointer to the start of this plane is needed as base for the precomputed offsets
     Window win_in(window);
@@ -180,8 +231,7 @@ void NEScaleKernel::scale_nearest(const Window &window)
                 const auto           offsets_ptr = reinterpret_cast<const int32_t *>(offsets.ptr());
                 const uint8_t *const in_ptr      = in.ptr();
 
-                const int in_yi      = std::floor((id.y() + 0.5f) * hr);
-                const int offset_row = in_yi * input_stride;
+                const int offset_row = _input_row_offsets[id.y()];
 
                 tmp = vsetq_lane_u8(in_ptr[offsets_ptr[0] + offset_row], tmp, 0);
                 tmp = vsetq_lane_u8(in_ptr[offsets_ptr[1] + offset_row], tmp, 1);
@@ -219,8 +269,7 @@ void NEScaleKernel::scale_nearest(const Window &window)
             {
                 const auto offsets_ptr = reinterpret_cast<const int32_t *>(offsets.ptr());
 
-                const int in_yi      = (id.y() + 0.5f) * hr;
-                const int offset_row = in_yi * input_stride;
+                const int offset_row = _input_row_offsets[id.y()];
 
                 tmp.val[0] = vsetq_lane_s16(*reinterpret_cast<const int16_t *>(in.ptr() + offsets_ptr[0] + offset_row), tmp.val[0], 0);
                 tmp.val[0] = vsetq_lane_s16(*reinterpret_cast<const int16_t *>(in.ptr() + offsets_ptr[2] + offset_row), tmp.val[0], 1);
@@ -261,8 +310,7 @@ void NEScaleKernel::scale_nearest(const Window &window)
             {
                 const auto offsets_ptr = reinterpret_cast<const int32_t *>(offsets.ptr());
 
-                const int in_yi      = (id.y() + 0.5f) * hr;
-                const int offset_row = in_yi * input_stride;
+                const int offset_row = _input_row_offsets[id.y()];
 
                 tmp.val[0] = vsetq_lane_f32(*reinterpret_cast<const float *>(in.ptr() + offsets_ptr[0] + offset_row), tmp.val[0], 0);
                 tmp.val[0] = vsetq_lane_f32(*reinterpret_cast<const float *>(in.ptr() + offsets_ptr[4] + offset_row), tmp.val[0], 1);
@@ -299,9 +347,6 @@ void NEScaleKernel::scale_bilinear(const Window &window)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(_input, 1, DataType::U8, DataType::S16, DataType::F32);
 
-    // Compute the ratio between source height and destination height
-    const auto hr = static_cast<float>(_input->info()->dimension(1)) / static_cast<float>(_output->info()->dimension(1));
-
     // Don't increment in X and Y direction for the input tensor
     // A pointer to the start of this plane is needed as base for the precomputed offsets
     Window win_in(window);
@@ -323,9 +368,8 @@ void NEScaleKernel::scale_bilinear(const Window &window)
     Iterator dx(_dx, win_off);
     Iterator dy(_dy, win_off);
 
-    /* Input image stride */
-    const size_t in_stide_in_bytes = _input->info()->strides_in_bytes()[1];
-    const size_t in_stride         = in_stide_in_bytes / _input->info()->element_size();
+    /* Input image stride in elements */
+    const size_t in_stride = _input->info()->strides_in_bytes()[1] / _input->info()->element_size();
 
     switch(_input->info()->data_type())
     {
@@ -338,8 +382,7 @@ void NEScaleKernel::scale_bilinear(const Window &window)
                 const auto dy_ptr      = reinterpret_cast<const float *>(dy.ptr());
                 const auto in_ptr      = reinterpret_cast<const uint8_t *>(in.ptr());
 
-                const int in_yi      = std::floor((id.y() + 0.5f) * hr - 0.5f);
-                const int offset_row = in_yi * in_stide_in_bytes;
+                const int offset_row = _input_row_offsets[id.y()];
 
                 uint8x8_t tmp0 = vdup_n_u8(0);
                 tmp0           = vset_lane_u8(delta_bilinear_c1(&in_ptr[offsets_ptr[0] + offset_row], in_stride, dx_ptr[0], dy_ptr[0]), tmp0, 0);
@@ -374,8 +417,7 @@ void NEScaleKernel::scale_bilinear(const Window &window)
                 const auto dx_ptr      = reinterpret_cast<const float *>(dx.ptr());
                 const auto dy_ptr      = reinterpret_cast<const float *>(dy.ptr());
 
-                const int in_yi      = std::floor((id.y() + 0.5f) * hr - 0.5f);
-                const int offset_row = in_yi * in_stide_in_bytes;
+                const int offset_row = _input_row_offsets[id.y()];
 
                 int16x8x2_t tmp =
                 {
@@ -416,40 +458,35 @@ void NEScaleKernel::scale_bilinear(const Window &window)
                 const auto dx_ptr      = reinterpret_cast<const float *>(dx.ptr());
                 const auto dy_ptr      = reinterpret_cast<const float *>(dy.ptr());
 
-                const int in_yi      = std::floor((id.y() + 0.5f) * hr - 0.5f);
-                const int offset_row = in_yi * in_stide_in_bytes;
-
-                float32x4x4_t tmp =
-                {
-                    {
-                        vdupq_n_f32(0),
-                        vdupq_n_f32(0),
-                        vdupq_n_f32(0),
-                        vdupq_n_f32(0)
-                    }
-                };
-
-                tmp.val[0] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[0] + offset_row), in_stride, dx_ptr[0], dy_ptr[0]), tmp.val[0], 0);
-                tmp.val[0] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[4] + offset_row), in_stride, dx_ptr[4], dy_ptr[4]), tmp.val[0], 1);
-                tmp.val[0] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[8] + offset_row), in_stride, dx_ptr[8], dy_ptr[8]), tmp.val[0], 2);
-                tmp.val[0] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[12] + offset_row), in_stride, dx_ptr[12], dy_ptr[12]), tmp.val[0], 3);
-
-                tmp.val[1] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[1] + offset_row), in_stride, dx_ptr[1], dy_ptr[1]), tmp.val[1], 0);
-                tmp.val[1] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[5] + offset_row), in_stride, dx_ptr[5], dy_ptr[5]), tmp.val[1], 1);
-                tmp.val[1] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[9] + offset_row), in_stride, dx_ptr[9], dy_ptr[9]), tmp.val[1], 2);
-                tmp.val[1] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[13] + offset_row), in_stride, dx_ptr[13], dy_ptr[13]), tmp.val[1], 3);
+                const int offset_row = _input_row_offsets[id.y()];
 
-                tmp.val[2] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[2] + offset_row), in_stride, dx_ptr[2], dy_ptr[2]), tmp.val[2], 0);
-                tmp.val[2] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[6] + offset_row), in_stride, dx_ptr[6], dy_ptr[6]), tmp.val[2], 1);
-                tmp.val[2] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[10] + offset_row), in_stride, dx_ptr[10], dy_ptr[10]), tmp.val[2], 2);
-                tmp.val[2] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[14] + offset_row), in_stride, dx_ptr[14], dy_ptr[14]), tmp.val[2], 3);
+                const float32x4_t one = vdupq_n_f32(1.f);
 
-                tmp.val[3] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[3] + offset_row), in_stride, dx_ptr[3], dy_ptr[3]), tmp.val[3], 0);
-                tmp.val[3] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[7] + offset_row), in_stride, dx_ptr[7], dy_ptr[7]), tmp.val[3], 1);
-                tmp.val[3] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[11] + offset_row), in_stride, dx_ptr[11], dy_ptr[11]), tmp.val[3], 2);
-                tmp.val[3] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[15] + offset_row), in_stride, dx_ptr[15], dy_ptr[15]), tmp.val[3], 3);
-
-                vst4q_f32(reinterpret_cast<float *>(out.ptr()), tmp);
+                for(int x = 0; x < 16; x += 4)
+                {
+                    const auto in_0 = reinterpret_cast<const float *>(in.ptr() + offsets_ptr[x + 0] + offset_row);
+                    const auto in_1 = reinterpret_cast<const float *>(in.ptr() + offsets_ptr[x + 1] + offset_row);
+                    const auto in_2 = reinterpret_cast<const float *>(in.ptr() + offsets_ptr[x + 2] + offset_row);
+                    const auto in_3 = reinterpret_cast<const float *>(in.ptr() + offsets_ptr[x + 3] + offset_row);
+
+                    // Gather the left/right neighbour pairs of the four pixels and deinterleave them into one vector per neighbour
+                    const float32x4x2_t top = vuzpq_f32(vcombine_f32(vld1_f32(in_0), vld1_f32(in_1)),
+                                                        vcombine_f32(vld1_f32(in_2), vld1_f32(in_3)));
+                    const float32x4x2_t low = vuzpq_f32(vcombine_f32(vld1_f32(in_0 + in_stride), vld1_f32(in_1 + in_stride)),
+                                                        vcombine_f32(vld1_f32(in_2 + in_stride), vld1_f32(in_3 + in_stride)));
+
+                    const float32x4_t dx_val  = vld1q_f32(dx_ptr + x);
+                    const float32x4_t dy_val  = vld1q_f32(dy_ptr + x);
+                    const float32x4_t dx1_val = vsubq_f32(one, dx_val);
+                    const float32x4_t dy1_val = vsubq_f32(one, dy_val);
+
+                    float32x4_t res = vmulq_f32(top.val[0], vmulq_f32(dx1_val, dy1_val));
+                    res             = vmlaq_f32(res, top.val[1], vmulq_f32(dx_val, dy1_val));
+                    res             = vmlaq_f32(res, low.val[0], vmulq_f32(dx1_val, dy_val));
+                    res             = vmlaq_f32(res, low.val[1], vmulq_f32(dx_val, dy_val));
+
+                    vst1q_f32(reinterpret_cast<float *>(out.ptr()) + x, res);
+                }
             },
             in, offsets, dx, dy, out);
             break;
@@ -479,10 +516,44 @@ void NEScaleKernel::scale_area(const Window &window)
     const auto   h         = _input->info()->dimension(1);
     const size_t in_stride = _input->info()->strides_in_bytes()[1];
 
+    // Output region whose sampling boxes are guaranteed to lie inside the input. Iterations fully
+    // covered by it take the branch-free interior path; only the remaining edge iterations pay for
+    // the per-pixel clamps. The bounds are one output pixel conservative on each side
+    const int x_interior_start = static_cast<int>(std::ceil(1.5f / wr));
+    const int x_interior_end   = static_cast<int>((w - 1.5f) / wr);
+    const int y_interior_start = static_cast<int>(std::ceil(1.5f / hr));
+    const int y_interior_end   = static_cast<int>((h - 1.5f) / hr);
+
     execute_window_loop(window, [&](const Coordinates & id)
     {
         const auto in_ptr = reinterpret_cast<const uint8_t *>(in.ptr());
 
+        if(id.y() >= y_interior_start && id.y() < y_interior_end && id.x() >= x_interior_start && id.x() + 16 <= x_interior_end)
+        {
+            uint8x8_t tmp0 = vdup_n_u8(0);
+            tmp0           = vset_lane_u8(pixel_area_c1u8(in_ptr, in_stride, wr, hr, id.x(), id.y()), tmp0, 0);
+            tmp0           = vset_lane_u8(pixel_area_c1u8(in_ptr, in_stride, wr, hr, id.x() + 1, id.y()), tmp0, 1);
+            tmp0           = vset_lane_u8(pixel_area_c1u8(in_ptr, in_stride, wr, hr, id.x() + 2, id.y()), tmp0, 2);
+            tmp0           = vset_lane_u8(pixel_area_c1u8(in_ptr, in_stride, wr, hr, id.x() + 3, id.y()), tmp0, 3);
+            tmp0           = vset_lane_u8(pixel_area_c1u8(in_ptr, in_stride, wr, hr, id.x() + 4, id.y()), tmp0, 4);
+            tmp0           = vset_lane_u8(pixel_area_c1u8(in_ptr, in_stride, wr, hr, id.x() + 5, id.y()), tmp0, 5);
+            tmp0           = vset_lane_u8(pixel_area_c1u8(in_ptr, in_stride, wr, hr, id.x() + 6, id.y()), tmp0, 6);
+            tmp0           = vset_lane_u8(pixel_area_c1u8(in_ptr, in_stride, wr, hr, id.x() + 7, id.y()), tmp0, 7);
+
+            uint8x8_t tmp1 = vdup_n_u8(0);
+            tmp1           = vset_lane_u8(pixel_area_c1u8(in_ptr, in_stride, wr, hr, id.x() + 8, id.y()), tmp1, 0);
+            tmp1           = vset_lane_u8(pixel_area_c1u8(in_ptr, in_stride, wr, hr, id.x() + 9, id.y()), tmp1, 1);
+            tmp1           = vset_lane_u8(pixel_area_c1u8(in_ptr, in_stride, wr, hr, id.x() + 10, id.y()), tmp1, 2);
+            tmp1           = vset_lane_u8(pixel_area_c1u8(in_ptr, in_stride, wr, hr, id.x() + 11, id.y()), tmp1, 3);
+            tmp1           = vset_lane_u8(pixel_area_c1u8(in_ptr, in_stride, wr, hr, id.x() + 12, id.y()), tmp1, 4);
+            tmp1           = vset_lane_u8(pixel_area_c1u8(in_ptr, in_stride, wr, hr, id.x() + 13, id.y()), tmp1, 5);
+            tmp1           = vset_lane_u8(pixel_area_c1u8(in_ptr, in_stride, wr, hr, id.x() + 14, id.y()), tmp1, 6);
+            tmp1           = vset_lane_u8(pixel_area_c1u8(in_ptr, in_stride, wr, hr, id.x() + 15, id.y()), tmp1, 7);
+
+            vst1q_u8(out.ptr(), vcombine_u8(tmp0, tmp1));
+            return;
+        }
+
         uint8x8_t tmp0 = vdup_n_u8(0);
         tmp0           = vset_lane_u8(pixel_area_c1u8_clamp(in_ptr, in_stride, w, h, wr, hr, id.x(), id.y()), tmp0, 0);
         tmp0           = vset_lane_u8(pixel_area_c1u8_clamp(in_ptr, in_stride, w, h, wr, hr, id.x() + 1, id.y()), tmp0, 1);
@@ -34,6 +34,7 @@
 #include <arm_neon.h>
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 using namespace arm_compute;
 
@@ -402,3 +403,194 @@ void NESobel5x5VertKernel::run(const Window &window, const ThreadInfo &info)
         input_y, output_y);
     }
 }
+
+NESobel5x5FusedKernel::NESobel5x5FusedKernel()
+    : _input(nullptr), _output_x(nullptr), _output_y(nullptr), _run_sobel_x(false), _run_sobel_y(false)
+{
+}
+
+BorderSize NESobel5x5FusedKernel::border_size() const
+{
+    return BorderSize(2);
+}
+
+void NESobel5x5FusedKernel::configure(const ITensor *input, ITensor *output_x, ITensor *output_y, bool border_undefined)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON((output_x == nullptr) && (output_y == nullptr));
+
+    _run_sobel_x = output_x != nullptr;
+    _run_sobel_y = output_y != nullptr;
+
+    if(_run_sobel_x)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output_x, 1, DataType::S16);
+    }
+
+    if(_run_sobel_y)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output_y, 1, DataType::S16);
+    }
+
+    _input    = input;
+    _output_x = output_x;
+    _output_y = output_y;
+
+    // Configure kernel window
+    constexpr unsigned int num_elems_processed_per_iteration = 8;
+    constexpr unsigned int num_elems_read_per_iteration      = 16;
+    constexpr unsigned int num_elems_written_per_iteration   = 8;
+    constexpr unsigned int num_rows_read_per_iteration       = 5;
+
+    Window                 win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration), border_undefined, border_size());
+    AccessWindowHorizontal output_x_access(output_x == nullptr ? nullptr : output_x->info(), 0, num_elems_written_per_iteration);
+    AccessWindowHorizontal output_y_access(output_y == nullptr ? nullptr : output_y->info(), 0, num_elems_written_per_iteration);
+
+    update_window_and_padding(win,
+                              AccessWindowRectangle(input->info(), -border_size().left, -border_size().top, num_elems_read_per_iteration, num_rows_read_per_iteration),
+                              output_x_access,
+                              output_y_access);
+
+    output_x_access.set_valid_region(win, input->info()->valid_region(), border_undefined, border_size());
+    output_y_access.set_valid_region(win, input->info()->valid_region(), border_undefined, border_size());
+
+    INEKernel::configure(win);
+}
+
+void NESobel5x5FusedKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int x_start = window.x().start();
+    const int width   = window.x().end() - x_start;
+    const int y_start = window.y().start();
+    const int y_end   = window.y().end();
+
+    const int in_stride_y = _input->info()->strides_in_bytes()[1];
+
+    // Ring buffers holding the five horizontally filtered rows the vertical pass consumes.
+    // Sized to the strip width so the intermediates stay cache resident
+    std::vector<int16_t> ring_x(_run_sobel_x ? 5 * width : 0);
+    std::vector<int16_t> ring_y(_run_sobel_y ? 5 * width : 0);
+
+    static const int16x8_t six      = vdupq_n_s16(6);
+    static const int16x8_t four     = vdupq_n_s16(4);
+    static const int16x8_t two      = vdupq_n_s16(2);
+    static const int16x8_t minustwo = vdupq_n_s16(-2);
+
+    // Process one plane at a time; the ring buffers carry state across the rows of a plane
+    Window win_plane(window);
+    win_plane.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win_plane.set(Window::DimY, Window::Dimension(0, 1, 1));
+
+    execute_window_loop(win_plane, [&](const Coordinates & id)
+    {
+        const uint8_t *const in_base   = _input->ptr_to_element(id);
+        uint8_t *const       outx_base = _run_sobel_x ? _output_x->ptr_to_element(id) : nullptr;
+        uint8_t *const       outy_base = _run_sobel_y ? _output_y->ptr_to_element(id) : nullptr;
+
+        // Slot of an absolute input row in a ring buffer
+        auto ring_slot = [&](int y)
+        {
+            return ((y - y_start + 2) % 5) * width;
+        };
+
+        // Horizontal pass for a single row
+        auto filter_row = [&](int y)
+        {
+            const uint8_t *src   = in_base + y * in_stride_y + x_start - 2;
+            int16_t *const dst_x = _run_sobel_x ? ring_x.data() + ring_slot(y) : nullptr;
+            int16_t *const dst_y = _run_sobel_y ? ring_y.data() + ring_slot(y) : nullptr;
+
+            for(int x = 0; x < width; x += 8, src += 8)
+            {
+                const uint8x16_t data = vld1q_u8(src);
+
+                const int16x8x2_t data_s16 =
+                {
+                    {
+                        vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(data))),
+                        vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(data)))
+                    }
+                };
+
+                if(dst_x != nullptr)
+                {
+                    int16x8_t res = vnegq_s16(data_s16.val[0]);
+                    res           = vmlaq_s16(res, vextq_s16(data_s16.val[0], data_s16.val[1], 1), minustwo);
+                    res           = vmlaq_s16(res, vextq_s16(data_s16.val[0], data_s16.val[1], 3), two);
+                    res           = vaddq_s16(res, vextq_s16(data_s16.val[0], data_s16.val[1], 4));
+
+                    vst1q_s16(dst_x + x, res);
+                }
+
+                if(dst_y != nullptr)
+                {
+                    int16x8_t res = data_s16.val[0];
+                    res           = vmlaq_s16(res, vextq_s16(data_s16.val[0], data_s16.val[1], 1), four);
+                    res           = vmlaq_s16(res, vextq_s16(data_s16.val[0], data_s16.val[1], 2), six);
+                    res           = vmlaq_s16(res, vextq_s16(data_s16.val[0], data_s16.val[1], 3), four);
+                    res           = vaddq_s16(res, vextq_s16(data_s16.val[0], data_s16.val[1], 4));
+
+                    vst1q_s16(dst_y + x, res);
+                }
+            }
+        };
+
+        // Prime the rings with the rows above the first output row
+        for(int y = y_start - 2; y < y_start + 2; ++y)
+        {
+            filter_row(y);
+        }
+
+        for(int y = y_start; y < y_end; ++y)
+        {
+            // Produce the one newly needed row, then consume the five resident ones
+            filter_row(y + 2);
+
+            if(_run_sobel_x)
+            {
+                const int16_t *const top2 = ring_x.data() + ring_slot(y - 2);
+                const int16_t *const top  = ring_x.data() + ring_slot(y - 1);
+                const int16_t *const mid  = ring_x.data() + ring_slot(y);
+                const int16_t *const low  = ring_x.data() + ring_slot(y + 1);
+                const int16_t *const low2 = ring_x.data() + ring_slot(y + 2);
+
+                int16_t *dst = reinterpret_cast<int16_t *>(outx_base + y * _output_x->info()->strides_in_bytes()[1]) + x_start;
+
+                for(int x = 0; x < width; x += 8)
+                {
+                    int16x8_t res = vld1q_s16(top2 + x);
+                    res           = vmlaq_s16(res, vld1q_s16(top + x), four);
+                    res           = vmlaq_s16(res, vld1q_s16(mid + x), six);
+                    res           = vmlaq_s16(res, vld1q_s16(low + x), four);
+                    res           = vaddq_s16(res, vld1q_s16(low2 + x));
+
+                    vst1q_s16(dst + x, res);
+                }
+            }
+
+            if(_run_sobel_y)
+            {
+                const int16_t *const top2 = ring_y.data() + ring_slot(y - 2);
+                const int16_t *const top  = ring_y.data() + ring_slot(y - 1);
+                const int16_t *const low  = ring_y.data() + ring_slot(y + 1);
+                const int16_t *const low2 = ring_y.data() + ring_slot(y + 2);
+
+                int16_t *dst = reinterpret_cast<int16_t *>(outy_base + y * _output_y->info()->strides_in_bytes()[1]) + x_start;
+
+                for(int x = 0; x < width; x += 8)
+                {
+                    int16x8_t res = vnegq_s16(vld1q_s16(top2 + x));
+                    res           = vmlaq_s16(res, vld1q_s16(top + x), minustwo);
+                    res           = vmlaq_s16(res, vld1q_s16(low + x), two);
+                    res           = vaddq_s16(res, vld1q_s16(low2 + x));
+
+                    vst1q_s16(dst + x, res);
+                }
+            }
+        }
+    });
+}
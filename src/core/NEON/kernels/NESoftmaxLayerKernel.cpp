@@ -33,10 +33,13 @@
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
+#include "support/ToolchainSupport.h"
 
 #include <algorithm>
 #include <arm_neon.h>
+#include <array>
 #include <cfloat>
+#include <cmath>
 
 using namespace arm_compute;
 
@@ -769,3 +772,278 @@ void NELogits1DNormKernel::run(const Window &window, const ThreadInfo &info)
 
     (*_func)(_input, _sum, _output, window);
 }
+
+namespace
+{
+#ifdef ARM_COMPUTE_ENABLE_FP16
+void logits_1d_softmax_f16(const ITensor *in, ITensor *out, const Window &window)
+{
+    Window in_slice = window.first_slice_window_1D();
+
+    constexpr int step        = 8;
+    const int     long_steps  = in->info()->valid_region().shape.x() / step;
+    const int     small_steps = in->info()->valid_region().shape.x() % step;
+
+    do
+    {
+        Iterator input(in, in_slice);
+        Iterator output(out, in_slice);
+
+        const auto in_ptr  = reinterpret_cast<const float16_t *>(input.ptr());
+        const auto out_ptr = reinterpret_cast<float16_t *>(output.ptr());
+
+        // Compute the maximum of the row
+        float16x8_t vec_max = vdupq_n_f16(std::numeric_limits<float16_t>::lowest());
+        for(int i = 0; i < long_steps; ++i)
+        {
+            vec_max = vmaxq_f16(vec_max, vld1q_f16(in_ptr + i * step));
+        }
+        float16x4_t carry_max = vpmax_f16(vget_high_f16(vec_max), vget_low_f16(vec_max));
+        carry_max             = vpmax_f16(carry_max, carry_max);
+        carry_max             = vpmax_f16(carry_max, carry_max);
+        float16_t max         = vget_lane_f16(carry_max, 0);
+        for(int i = long_steps * step; i < long_steps * step + small_steps; ++i)
+        {
+            max = std::max(max, in_ptr[i]);
+        }
+
+        // Shift, exponentiate and accumulate the sum while the row is still in the cache
+        const float16x8_t vec_max_val   = vdupq_n_f16(max);
+        float16x8_t       vec_sum_value = vdupq_n_f16(0);
+        for(int i = 0; i < long_steps; ++i)
+        {
+            float16x8_t vec_elements = vld1q_f16(in_ptr + i * step);
+            vec_elements             = vsubq_f16(vec_elements, vec_max_val);
+            vec_elements             = vexpq_f16(vec_elements);
+
+            vst1q_f16(out_ptr + i * step, vec_elements);
+            vec_sum_value = vaddq_f16(vec_sum_value, vec_elements);
+        }
+        const float16x4_t sum_red        = vadd_f16(vget_low_f16(vec_sum_value), vget_high_f16(vec_sum_value));
+        const float16x4_t carry_addition = vpadd_f16(sum_red, sum_red);
+        float16_t         sum            = vget_lane_f16(carry_addition, 0) + vget_lane_f16(carry_addition, 1);
+        for(int i = long_steps * step; i < long_steps * step + small_steps; ++i)
+        {
+            const float16_t element = std::exp(static_cast<float>(in_ptr[i] - max));
+            out_ptr[i]              = element;
+            sum += element;
+        }
+
+        // Normalize the row in place
+        const float16x8_t vec_sum_inversed = vdupq_n_f16(1.0f / sum);
+        for(int i = 0; i < long_steps; ++i)
+        {
+            vst1q_f16(out_ptr + i * step, vmulq_f16(vld1q_f16(out_ptr + i * step), vec_sum_inversed));
+        }
+        for(int i = long_steps * step; i < long_steps * step + small_steps; ++i)
+        {
+            out_ptr[i] /= sum;
+        }
+    }
+    while(window.slide_window_slice_1D(in_slice));
+}
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+
+void logits_1d_softmax_qasymm8(const ITensor *in, ITensor *out, const Window &window)
+{
+    Window in_slice = window.first_slice_window_1D();
+
+    constexpr int step        = 16;
+    const int     long_steps  = in->info()->valid_region().shape.x() / step;
+    const int     small_steps = in->info()->valid_region().shape.x() % step;
+    const int     row_width   = long_steps * step + small_steps;
+
+    // The shifted input (max - x) only takes 256 values: precompute their exponentials once
+    // per dispatch so the row loops are plain table lookups with no transcendental math
+    const float            in_scale = in->info()->quantization_info().scale;
+    std::array<float, 256> exp_lut;
+    for(unsigned int i = 0; i < exp_lut.size(); ++i)
+    {
+        exp_lut[i] = std::exp(-in_scale * static_cast<float>(i));
+    }
+
+    const float   inv_out_scale = 1.f / out->info()->quantization_info().scale;
+    const int32_t out_offset    = out->info()->quantization_info().offset;
+
+    do
+    {
+        Iterator input(in, in_slice);
+        Iterator output(out, in_slice);
+
+        const auto in_ptr  = reinterpret_cast<const uint8_t *>(input.ptr());
+        const auto out_ptr = reinterpret_cast<uint8_t *>(output.ptr());
+
+        // Compute the maximum of the row
+        uint8x16_t vec_max = vdupq_n_u8(0);
+        for(int i = 0; i < long_steps; ++i)
+        {
+            vec_max = vmaxq_u8(vec_max, vld1q_u8(in_ptr + i * step));
+        }
+        uint8x8_t carry_max = vpmax_u8(vget_high_u8(vec_max), vget_low_u8(vec_max));
+        carry_max           = vpmax_u8(carry_max, carry_max);
+        carry_max           = vpmax_u8(carry_max, carry_max);
+        carry_max           = vpmax_u8(carry_max, carry_max);
+        uint8_t max         = vget_lane_u8(carry_max, 0);
+        for(int i = long_steps * step; i < row_width; ++i)
+        {
+            max = std::max(max, in_ptr[i]);
+        }
+
+        // Accumulate the sum of exponentials through the table
+        float sum = 0.f;
+        for(int i = 0; i < row_width; ++i)
+        {
+            sum += exp_lut[max - in_ptr[i]];
+        }
+
+        // Requantize exp/sum straight into the output space; the exponentials are cheaper to
+        // look up again than to stage in an intermediate float row
+        const float renorm = inv_out_scale / sum;
+        for(int i = 0; i < row_width; ++i)
+        {
+            const int32_t quantized = static_cast<int32_t>(support::cpp11::round(exp_lut[max - in_ptr[i]] * renorm)) + out_offset;
+            out_ptr[i]              = static_cast<uint8_t>(std::min(255, std::max(0, quantized)));
+        }
+    }
+    while(window.slide_window_slice_1D(in_slice));
+}
+
+void logits_1d_softmax_f32(const ITensor *in, ITensor *out, const Window &window)
+{
+    Window in_slice = window.first_slice_window_1D();
+
+    constexpr int step        = 4;
+    const int     long_steps  = in->info()->valid_region().shape.x() / step;
+    const int     small_steps = in->info()->valid_region().shape.x() % step;
+
+    do
+    {
+        Iterator input(in, in_slice);
+        Iterator output(out, in_slice);
+
+        const auto in_ptr  = reinterpret_cast<const float *>(input.ptr());
+        const auto out_ptr = reinterpret_cast<float *>(output.ptr());
+
+        // Compute the maximum of the row
+        float32x4_t vec_max = vdupq_n_f32(-FLT_MAX);
+        for(int i = 0; i < long_steps; ++i)
+        {
+            vec_max = vmaxq_f32(vec_max, vld1q_f32(in_ptr + i * step));
+        }
+        float32x2_t carry_max = vpmax_f32(vget_high_f32(vec_max), vget_low_f32(vec_max));
+        carry_max             = vpmax_f32(carry_max, carry_max);
+        float max             = vget_lane_f32(carry_max, 0);
+        for(int i = long_steps * step; i < long_steps * step + small_steps; ++i)
+        {
+            max = std::max(max, in_ptr[i]);
+        }
+
+        // Shift, exponentiate and accumulate the sum while the row is still in the cache
+        const float32x4_t vec_max_val   = vdupq_n_f32(max);
+        float32x4_t       vec_sum_value = vdupq_n_f32(0.0f);
+        for(int i = 0; i < long_steps; ++i)
+        {
+            float32x4_t vec_elements = vld1q_f32(in_ptr + i * step);
+            vec_elements             = vsubq_f32(vec_elements, vec_max_val);
+            vec_elements             = vexpq_f32(vec_elements);
+
+            vst1q_f32(out_ptr + i * step, vec_elements);
+            vec_sum_value = vaddq_f32(vec_sum_value, vec_elements);
+        }
+        float32x2_t carry_addition = vpadd_f32(vget_high_f32(vec_sum_value), vget_low_f32(vec_sum_value));
+        carry_addition             = vpadd_f32(carry_addition, carry_addition);
+        float sum                  = vget_lane_f32(carry_addition, 0);
+        for(int i = long_steps * step; i < long_steps * step + small_steps; ++i)
+        {
+            const float element = std::exp(in_ptr[i] - max);
+            out_ptr[i]          = element;
+            sum += element;
+        }
+
+        // Normalize the row in place
+        const float32x4_t vec_sum_inversed = vdupq_n_f32(1.0f / sum);
+        for(int i = 0; i < long_steps; ++i)
+        {
+            vst1q_f32(out_ptr + i * step, vmulq_f32(vld1q_f32(out_ptr + i * step), vec_sum_inversed));
+        }
+        for(int i = long_steps * step; i < long_steps * step + small_steps; ++i)
+        {
+            out_ptr[i] /= sum;
+        }
+    }
+    while(window.slide_window_slice_1D(in_slice));
+}
+} // namespace
+
+NELogits1DSoftmaxKernel::NELogits1DSoftmaxKernel()
+    : _func(nullptr), _input(nullptr), _output(nullptr)
+{
+}
+
+void NELogits1DSoftmaxKernel::configure(const ITensor *input, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(output);
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*output->info(), input->info()->tensor_shape(), 1, input->info()->data_type(), input->info()->fixed_point_position());
+
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, output);
+
+    if(input->info()->data_type() == DataType::QASYMM8)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(input->info()->quantization_info().empty(), "QASYMM8 input must carry quantization information");
+        // A 1/256 scale with zero offset maps the [0, 1) output range onto the full u8
+        // range; only used when the caller did not ask for a specific quantization
+        if(output->info()->quantization_info().empty())
+        {
+            output->info()->set_quantization_info(QuantizationInfo(1.f / 256, 0));
+        }
+    }
+
+    switch(input->info()->data_type())
+    {
+        case DataType::QASYMM8:
+            _func = &logits_1d_softmax_qasymm8;
+            break;
+        case DataType::F32:
+            _func = &logits_1d_softmax_f32;
+            break;
+        case DataType::F16:
+#ifdef ARM_COMPUTE_ENABLE_FP16
+            _func = &logits_1d_softmax_f16;
+            break;
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+        default:
+            ARM_COMPUTE_ERROR("Unsupported data type.");
+            break;
+    }
+
+    _input  = input;
+    _output = output;
+
+    // Configure kernel window. Each iteration processes a full row, the leftover
+    // elements are handled with scalar loops so no input border is required
+    const unsigned int num_elems_processed_per_iteration = input->info()->valid_region().shape.x();
+
+    Window                 win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration));
+    AccessWindowHorizontal input_access(input->info(), 0, num_elems_processed_per_iteration);
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win, input_access, output_access);
+
+    output_access.set_valid_region(win, input->info()->valid_region());
+
+    INEKernel::configure(win);
+}
+
+void NELogits1DSoftmaxKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (*_func)(_input, _output, window);
+}
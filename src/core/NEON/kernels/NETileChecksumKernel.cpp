@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NETileChecksumKernel.h"
+
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cstdint>
+
+using namespace arm_compute;
+
+namespace
+{
+constexpr uint32_t fnv_offset_basis = 2166136261u;
+constexpr uint32_t fnv_prime        = 16777619u;
+
+/** FNV-style hash of one row of raw bytes: four interleaved lane streams in NEON plus a
+ *  scalar tail, folded into the running checksum. Order-sensitive within each lane stream */
+inline uint32_t hash_row(const uint8_t *row, size_t size, uint32_t checksum)
+{
+    const uint32x4_t prime = vdupq_n_u32(fnv_prime);
+    uint32x4_t       acc   = vdupq_n_u32(checksum);
+
+    size_t i = 0;
+
+    for(; i + 16 <= size; i += 16)
+    {
+        acc = vmulq_u32(veorq_u32(acc, vreinterpretq_u32_u8(vld1q_u8(row + i))), prime);
+    }
+
+    checksum = vgetq_lane_u32(acc, 0);
+    checksum = (checksum ^ vgetq_lane_u32(acc, 1)) * fnv_prime;
+    checksum = (checksum ^ vgetq_lane_u32(acc, 2)) * fnv_prime;
+    checksum = (checksum ^ vgetq_lane_u32(acc, 3)) * fnv_prime;
+
+    for(; i < size; ++i)
+    {
+        checksum = (checksum ^ row[i]) * fnv_prime;
+    }
+
+    return checksum;
+}
+} // namespace
+
+NETileChecksumKernel::NETileChecksumKernel()
+    : _input(nullptr), _output(nullptr), _tile_rows(0)
+{
+}
+
+void NETileChecksumKernel::configure(const ITensor *input, ITensor *output, unsigned int tile_rows)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_ON(tile_rows == 0);
+    ARM_COMPUTE_ERROR_ON(input->info()->num_dimensions() > 2);
+
+    const unsigned int num_tiles = DIV_CEIL(std::max<size_t>(input->info()->dimension(1), 1), tile_rows);
+
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U32);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(0) != num_tiles);
+
+    _input     = input;
+    _output    = output;
+    _tile_rows = tile_rows;
+
+    // One window iteration per tile; the scheduler spreads tiles across threads
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, num_tiles, 1));
+
+    INEKernel::configure(win);
+}
+
+void NETileChecksumKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const unsigned int height   = std::max<size_t>(_input->info()->dimension(1), 1);
+    const size_t       row_size = _input->info()->dimension(0) * _input->info()->element_size();
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const unsigned int row_start = id.x() * _tile_rows;
+        const unsigned int row_end   = std::min(row_start + _tile_rows, height);
+
+        uint32_t checksum = fnv_offset_basis;
+
+        for(unsigned int y = row_start; y < row_end; ++y)
+        {
+            checksum = hash_row(_input->ptr_to_element(Coordinates(0, static_cast<int>(y))), row_size, checksum);
+        }
+
+        *reinterpret_cast<uint32_t *>(_output->ptr_to_element(Coordinates(id.x()))) = checksum;
+    });
+}
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NETopKKernel.h"
+
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+#include <cfloat>
+#include <limits>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Insert a score into a descending (value, index) selection of at most @p k entries.
+ *
+ * Insertion is strict, so among equal values the earliest index is kept.
+ */
+template <typename T>
+inline void insert_candidate(T *values, uint32_t *indices, unsigned int &count, unsigned int k, T value, uint32_t index)
+{
+    unsigned int pos = count;
+    if(count == k)
+    {
+        if(value <= values[k - 1])
+        {
+            return;
+        }
+        pos = k - 1;
+    }
+    else
+    {
+        ++count;
+    }
+
+    while(pos > 0 && value > values[pos - 1])
+    {
+        values[pos]  = values[pos - 1];
+        indices[pos] = indices[pos - 1];
+        --pos;
+    }
+    values[pos]  = value;
+    indices[pos] = index;
+}
+
+void top_k_f32(const ITensor *in, ITensor *values, ITensor *indices, ITensor *counts, unsigned int k, const Window &window, const ThreadInfo &info)
+{
+    const auto in_ptr = reinterpret_cast<const float *>(in->buffer() + in->info()->offset_first_element_in_bytes());
+
+    const auto slot_values  = reinterpret_cast<float *>(values->ptr_to_element(Coordinates(0, info.thread_id)));
+    const auto slot_indices = reinterpret_cast<uint32_t *>(indices->ptr_to_element(Coordinates(0, info.thread_id)));
+    const auto slot_count   = reinterpret_cast<uint32_t *>(counts->ptr_to_element(Coordinates(info.thread_id)));
+
+    unsigned int count     = *slot_count;
+    float        threshold = (count == k) ? slot_values[k - 1] : -FLT_MAX;
+
+    const int start = window.x().start();
+    const int end   = window.x().end();
+
+    int x = start;
+    for(; x <= end - 4; x += 4)
+    {
+        // Reject whole blocks below the running k-th best value; only blocks containing a
+        // candidate fall through to the scalar insertion
+        const float32x4_t block     = vld1q_f32(in_ptr + x);
+        float32x2_t       block_max = vpmax_f32(vget_high_f32(block), vget_low_f32(block));
+        block_max                   = vpmax_f32(block_max, block_max);
+
+        if(vget_lane_f32(block_max, 0) <= threshold && count == k)
+        {
+            continue;
+        }
+
+        for(int lane = 0; lane < 4; ++lane)
+        {
+            insert_candidate(slot_values, slot_indices, count, k, in_ptr[x + lane], static_cast<uint32_t>(x + lane));
+        }
+        threshold = (count == k) ? slot_values[k - 1] : -FLT_MAX;
+    }
+
+    for(; x < end; ++x)
+    {
+        insert_candidate(slot_values, slot_indices, count, k, in_ptr[x], static_cast<uint32_t>(x));
+    }
+
+    *slot_count = count;
+}
+
+void top_k_u8(const ITensor *in, ITensor *values, ITensor *indices, ITensor *counts, unsigned int k, const Window &window, const ThreadInfo &info)
+{
+    const auto in_ptr = reinterpret_cast<const uint8_t *>(in->buffer() + in->info()->offset_first_element_in_bytes());
+
+    const auto slot_values  = reinterpret_cast<uint8_t *>(values->ptr_to_element(Coordinates(0, info.thread_id)));
+    const auto slot_indices = reinterpret_cast<uint32_t *>(indices->ptr_to_element(Coordinates(0, info.thread_id)));
+    const auto slot_count   = reinterpret_cast<uint32_t *>(counts->ptr_to_element(Coordinates(info.thread_id)));
+
+    unsigned int count     = *slot_count;
+    int          threshold = (count == k) ? slot_values[k - 1] : -1;
+
+    const int start = window.x().start();
+    const int end   = window.x().end();
+
+    int x = start;
+    for(; x <= end - 16; x += 16)
+    {
+        const uint8x16_t block     = vld1q_u8(in_ptr + x);
+        uint8x8_t        block_max = vpmax_u8(vget_high_u8(block), vget_low_u8(block));
+        block_max                  = vpmax_u8(block_max, block_max);
+        block_max                  = vpmax_u8(block_max, block_max);
+        block_max                  = vpmax_u8(block_max, block_max);
+
+        if(static_cast<int>(vget_lane_u8(block_max, 0)) <= threshold && count == k)
+        {
+            continue;
+        }
+
+        for(int lane = 0; lane < 16; ++lane)
+        {
+            insert_candidate(slot_values, slot_indices, count, k, in_ptr[x + lane], static_cast<uint32_t>(x + lane));
+        }
+        threshold = (count == k) ? slot_values[k - 1] : -1;
+    }
+
+    for(; x < end; ++x)
+    {
+        insert_candidate(slot_values, slot_indices, count, k, in_ptr[x], static_cast<uint32_t>(x));
+    }
+
+    *slot_count = count;
+}
+} // namespace
+
+NETopKKernel::NETopKKernel()
+    : _func(nullptr), _input(nullptr), _candidate_values(nullptr), _candidate_indices(nullptr), _candidate_counts(nullptr), _k(0)
+{
+}
+
+void NETopKKernel::configure(const ITensor *input, ITensor *candidate_values, ITensor *candidate_indices, ITensor *candidate_counts, unsigned int k)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(candidate_values);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(candidate_indices);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(candidate_counts);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, candidate_values);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(candidate_indices, 1, DataType::U32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(candidate_counts, 1, DataType::U32);
+    ARM_COMPUTE_ERROR_ON_MSG(input->info()->num_dimensions() > 1, "Top-k selection only supports 1D score tensors");
+    ARM_COMPUTE_ERROR_ON(k == 0);
+    ARM_COMPUTE_ERROR_ON(k > input->info()->dimension(0));
+    ARM_COMPUTE_ERROR_ON(candidate_values->info()->dimension(0) < k);
+    ARM_COMPUTE_ERROR_ON(candidate_indices->info()->dimension(0) < k);
+
+    switch(input->info()->data_type())
+    {
+        case DataType::QASYMM8:
+            _func = &top_k_u8;
+            break;
+        case DataType::F32:
+            _func = &top_k_f32;
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported data type.");
+            break;
+    }
+
+    _input             = input;
+    _candidate_values  = candidate_values;
+    _candidate_indices = candidate_indices;
+    _candidate_counts  = candidate_counts;
+    _k                 = k;
+
+    // Single-element steps: the scheduler splits the X dimension across threads and each
+    // invocation walks its range with raw loads, so no padding is required
+    Window win = calculate_max_window(*input->info(), Steps());
+    INEKernel::configure(win);
+}
+
+void NETopKKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+    ARM_COMPUTE_ERROR_ON(static_cast<size_t>(info.thread_id) >= _candidate_counts->info()->dimension(0));
+
+    (*_func)(_input, _candidate_values, _candidate_indices, _candidate_counts, _k, window, info);
+}
@@ -29,6 +29,7 @@
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/Validate.h"
 
+#include <algorithm>
 #include <arm_neon.h>
 
 using namespace arm_compute;
@@ -235,10 +236,22 @@ void NETransposeKernel::configure(const ITensor *input, ITensor *output)
 
 void NETransposeKernel::run(const Window &window, const ThreadInfo &info)
 {
-    ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
     ARM_COMPUTE_ERROR_ON(_func == nullptr);
 
-    (*_func)(_input, _output, window);
+    // Walk the window in square blocks so a block's input rows and its transposed output
+    // columns stay cache resident: register tiles inside an L1 block inside an L2 block.
+    // On large matrices the raster walk misses on every strided output write instead.
+    const size_t element_size = _input->info()->element_size();
+    const size_t l1_size      = (info.cpu_info.L1_size != 0) ? info.cpu_info.L1_size : 32 * 1024;
+    const size_t l2_size      = (info.cpu_info.L2_size != 0) ? info.cpu_info.L2_size : 512 * 1024;
+
+    const int l1_block = cache_block_side(l1_size, element_size, window.x().step());
+    const int l2_block = std::max(cache_block_side(l2_size, element_size, window.x().step()), l1_block);
+
+    execute_window_blocked(window, l1_block, l2_block, [&](const Window & block)
+    {
+        (*_func)(_input, _output, block);
+    });
 }
@@ -32,12 +32,21 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 
 using namespace arm_compute;
 
 namespace
 {
+/** Source working-set budget per destination tile, in bytes. Half a typical 32KB L1 data
+ * cache, leaving room for the destination lines and the stack. */
+constexpr unsigned int warp_tile_l1_budget = 16 * 1024;
+
+/** Smallest destination tile side worth the per-tile loop overhead */
+constexpr int warp_min_tile_side = 16;
+
 inline uint8_t nearest_interpolation(const uint8_t *in_ptr, int x, int y, size_t stride)
 {
     return in_ptr[x + y * stride];
@@ -61,7 +70,35 @@ void INEWarpKernel::run(const Window &window, const ThreadInfo &info)
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
     ARM_COMPUTE_ERROR_ON(_func == nullptr);
 
-    (this->*_func)(window);
+    // A rotation near 90 degrees maps consecutive destination pixels to source pixels a whole
+    // row stride apart, so walking full destination rows touches one source cache line per
+    // pixel and thrashes every cache level. Split the destination into square tiles whose
+    // source bounding box fits in L1: the source lines a tile row pulls in are then reused by
+    // the following tile rows, making the cost independent of the warp angle.
+    const float scale = std::max(source_area_scale(), 1e-6f);
+    const int   side  = std::max(warp_min_tile_side, static_cast<int>(std::sqrt(static_cast<float>(warp_tile_l1_budget) / scale)));
+
+    const int start_x = window.x().start();
+    const int start_y = window.y().start();
+    const int end_x   = window.x().end();
+    const int end_y   = window.y().end();
+
+    if((end_x - start_x <= side && end_y - start_y <= side) || window.x().step() != 1 || window.y().step() != 1)
+    {
+        (this->*_func)(window);
+        return;
+    }
+
+    Window tile(window);
+    for(int y = start_y; y < end_y; y += side)
+    {
+        tile.set(Window::DimY, Window::Dimension(y, std::min(y + side, end_y), 1));
+        for(int x = start_x; x < end_x; x += side)
+        {
+            tile.set(Window::DimX, Window::Dimension(x, std::min(x + side, end_x), 1));
+            (this->*_func)(tile);
+        }
+    }
 }
 
 void INEWarpKernel::configure(const ITensor *input, ITensor *output, const float *matrix, BorderMode border_mode, uint8_t constant_border_value)
@@ -111,6 +148,16 @@ void INEWarpKernel::configure(const ITensor *input, ITensor *output, const float
     INEKernel::configure(win);
 }
 
+template <InterpolationPolicy interpolation>
+float NEWarpAffineKernel<interpolation>::source_area_scale() const
+{
+    // A destination tile of side T reads a source bounding box of
+    // (|M00| + |M01|) * T pixels by (|M10| + |M11|) * T rows
+    const float span_x = std::fabs(_matrix[0]) + std::fabs(_matrix[0 + 1 * 2]);
+    const float span_y = std::fabs(_matrix[1]) + std::fabs(_matrix[1 + 1 * 2]);
+    return span_x * span_y;
+}
+
 template <InterpolationPolicy interpolation>
 void NEWarpAffineKernel<interpolation>::warp_undefined(const Window &window)
 {
@@ -432,6 +479,17 @@ void NEWarpAffineKernel<interpolation>::warp_replicate(const Window &window)
     in, out);
 }
 
+template <InterpolationPolicy interpolation>
+float NEWarpPerspectiveKernel<interpolation>::source_area_scale() const
+{
+    // The linear part normalized by M22 approximates the local footprint; the perspective
+    // terms (M20, M21) only modulate it slowly across the image
+    const float w      = (std::fabs(_matrix[2 + 2 * 3]) > 1e-6f) ? std::fabs(_matrix[2 + 2 * 3]) : 1.f;
+    const float span_x = (std::fabs(_matrix[0]) + std::fabs(_matrix[0 + 1 * 3])) / w;
+    const float span_y = (std::fabs(_matrix[1]) + std::fabs(_matrix[1 + 1 * 3])) / w;
+    return span_x * span_y;
+}
+
 template <InterpolationPolicy interpolation>
 void NEWarpPerspectiveKernel<interpolation>::warp_undefined(const Window &window)
 {
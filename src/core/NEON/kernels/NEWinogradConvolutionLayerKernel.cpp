@@ -0,0 +1,376 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEWinogradConvolutionLayerKernel.h"
+
+#include "arm_compute/core/AccessWindowStatic.h"
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Transpose a 4x4 block held in four float32x4_t rows */
+inline void transpose_4x4(float32x4_t &r0, float32x4_t &r1, float32x4_t &r2, float32x4_t &r3)
+{
+    const float32x4x2_t t01 = vtrnq_f32(r0, r1);
+    const float32x4x2_t t23 = vtrnq_f32(r2, r3);
+
+    r0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+    r1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+    r2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+    r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+}
+
+/** Apply the B^T combination to four rows: (r0 - r2, r1 + r2, r2 - r1, r1 - r3) */
+inline void apply_input_transform(float32x4_t &r0, float32x4_t &r1, float32x4_t &r2, float32x4_t &r3)
+{
+    const float32x4_t w0 = vsubq_f32(r0, r2);
+    const float32x4_t w1 = vaddq_f32(r1, r2);
+    const float32x4_t w2 = vsubq_f32(r2, r1);
+    const float32x4_t w3 = vsubq_f32(r1, r3);
+
+    r0 = w0;
+    r1 = w1;
+    r2 = w2;
+    r3 = w3;
+}
+} // namespace
+
+NEWinogradInputTransformKernel::NEWinogradInputTransformKernel()
+    : _input(nullptr), _output(nullptr), _border_size(0), _num_tiles_x(0), _pad_x(0), _pad_y(0)
+{
+}
+
+BorderSize NEWinogradInputTransformKernel::border_size() const
+{
+    return _border_size;
+}
+
+void NEWinogradInputTransformKernel::configure(const ITensor *input, ITensor *output, const PadStrideInfo &conv_info)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(output);
+    ARM_COMPUTE_ERROR_ON(std::get<0>(conv_info.stride()) != 1 || std::get<1>(conv_info.stride()) != 1);
+    ARM_COMPUTE_ERROR_ON(std::get<0>(conv_info.pad()) > 1 || std::get<1>(conv_info.pad()) > 1);
+
+    _input  = input;
+    _output = output;
+    _pad_x  = std::get<0>(conv_info.pad());
+    _pad_y  = std::get<1>(conv_info.pad());
+
+    const int num_tiles_x = (input->info()->dimension(0) + 2 * _pad_x - 2 + 1) / 2;
+    const int num_tiles_y = (input->info()->dimension(1) + 2 * _pad_y - 2 + 1) / 2;
+
+    _num_tiles_x = num_tiles_x;
+
+    // Each 4x4 tile read can run over the borders of the input
+    _border_size = BorderSize(_pad_y, 2, 2, _pad_x);
+
+    // The window ranges over the tiles (x) and the input channels (y) of the output tensor
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, _output->info()->dimension(0), 1));
+    win.set(Window::DimY, Window::Dimension(0, _output->info()->dimension(1), 1));
+
+    AccessWindowStatic input_access(input->info(), -_pad_x, -_pad_y, num_tiles_x * 2 + 2 - _pad_x, num_tiles_y * 2 + 2 - _pad_y);
+    update_window_and_padding(win, input_access);
+
+    INEKernel::configure(win);
+}
+
+void NEWinogradInputTransformKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int in_stride_x  = _input->info()->strides_in_bytes()[0];
+    const int in_stride_y  = _input->info()->strides_in_bytes()[1];
+    const int out_stride_z = _output->info()->strides_in_bytes()[2];
+
+    for(int c = window.y().start(); c < window.y().end(); ++c)
+    {
+        for(int t = window.x().start(); t < window.x().end(); ++t)
+        {
+            // Top-left element of the 4x4 tile, can be negative on the padded borders
+            const int tile_x = (t % _num_tiles_x) * 2 - _pad_x;
+            const int tile_y = (t / _num_tiles_x) * 2 - _pad_y;
+
+            const uint8_t *in_base = _input->buffer() + _input->info()->offset_element_in_bytes(Coordinates(0, 0, c)) + tile_y * in_stride_y + tile_x * in_stride_x;
+
+            float32x4_t d0 = vld1q_f32(reinterpret_cast<const float *>(in_base + 0 * in_stride_y));
+            float32x4_t d1 = vld1q_f32(reinterpret_cast<const float *>(in_base + 1 * in_stride_y));
+            float32x4_t d2 = vld1q_f32(reinterpret_cast<const float *>(in_base + 2 * in_stride_y));
+            float32x4_t d3 = vld1q_f32(reinterpret_cast<const float *>(in_base + 3 * in_stride_y));
+
+            // V = B^T d B: apply the row combination, transpose and apply it again on the columns
+            apply_input_transform(d0, d1, d2, d3);
+            transpose_4x4(d0, d1, d2, d3);
+            apply_input_transform(d0, d1, d2, d3);
+
+            // After the second pass row j holds column j of V, i.e. tmp[j][i] = V(i, j)
+            float tmp[4][4];
+            vst1q_f32(tmp[0], d0);
+            vst1q_f32(tmp[1], d1);
+            vst1q_f32(tmp[2], d2);
+            vst1q_f32(tmp[3], d3);
+
+            uint8_t *out_base = _output->buffer() + _output->info()->offset_element_in_bytes(Coordinates(t, c, 0));
+            for(int i = 0; i < 4; ++i)
+            {
+                for(int j = 0; j < 4; ++j)
+                {
+                    *reinterpret_cast<float *>(out_base + (i * 4 + j) * out_stride_z) = tmp[j][i];
+                }
+            }
+        }
+    }
+}
+
+NEWinogradFilterTransformKernel::NEWinogradFilterTransformKernel()
+    : _weights(nullptr), _output(nullptr)
+{
+}
+
+void NEWinogradFilterTransformKernel::configure(const ITensor *weights, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(output);
+    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(0) != 3 || weights->info()->dimension(1) != 3);
+
+    _weights = weights;
+    _output  = output;
+
+    // The window ranges over the output filters (x) and the input channels (y) of the output tensor
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, output->info()->dimension(0), 1));
+    win.set(Window::DimY, Window::Dimension(0, output->info()->dimension(1), 1));
+
+    INEKernel::configure(win);
+}
+
+void NEWinogradFilterTransformKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int w_stride_y   = _weights->info()->strides_in_bytes()[1];
+    const int out_stride_z = _output->info()->strides_in_bytes()[2];
+
+    for(int c = window.y().start(); c < window.y().end(); ++c)
+    {
+        for(int k = window.x().start(); k < window.x().end(); ++k)
+        {
+            const uint8_t *w_base = _weights->buffer() + _weights->info()->offset_element_in_bytes(Coordinates(0, 0, c, k));
+
+            float g[3][3];
+            for(int i = 0; i < 3; ++i)
+            {
+                const float *row = reinterpret_cast<const float *>(w_base + i * w_stride_y);
+                g[i][0]          = row[0];
+                g[i][1]          = row[1];
+                g[i][2]          = row[2];
+            }
+
+            // T = G g (4x3)
+            float t[4][3];
+            for(int j = 0; j < 3; ++j)
+            {
+                t[0][j] = g[0][j];
+                t[1][j] = 0.5f * (g[0][j] + g[1][j] + g[2][j]);
+                t[2][j] = 0.5f * (g[0][j] - g[1][j] + g[2][j]);
+                t[3][j] = g[2][j];
+            }
+
+            // U = T G^T (4x4)
+            uint8_t *out_base = _output->buffer() + _output->info()->offset_element_in_bytes(Coordinates(k, c, 0));
+            for(int i = 0; i < 4; ++i)
+            {
+                float u[4];
+                u[0] = t[i][0];
+                u[1] = 0.5f * (t[i][0] + t[i][1] + t[i][2]);
+                u[2] = 0.5f * (t[i][0] - t[i][1] + t[i][2]);
+                u[3] = t[i][2];
+
+                for(int j = 0; j < 4; ++j)
+                {
+                    *reinterpret_cast<float *>(out_base + (i * 4 + j) * out_stride_z) = u[j];
+                }
+            }
+        }
+    }
+}
+
+NEWinogradBatchedGEMMKernel::NEWinogradBatchedGEMMKernel()
+    : _input0(nullptr), _input1(nullptr), _output(nullptr)
+{
+}
+
+void NEWinogradBatchedGEMMKernel::configure(const ITensor *input0, const ITensor *input1, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input0, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, input1, output);
+    ARM_COMPUTE_ERROR_ON(input0->info()->dimension(1) != input1->info()->dimension(1));
+    ARM_COMPUTE_ERROR_ON(input0->info()->dimension(0) != output->info()->dimension(0));
+    ARM_COMPUTE_ERROR_ON(input1->info()->dimension(0) != output->info()->dimension(1));
+
+    _input0 = input0;
+    _input1 = input1;
+    _output = output;
+
+    constexpr unsigned int num_elems_processed_per_iteration = 4;
+
+    // The window ranges over the tiles (x), the output filters (y) and the 16 transform planes (z)
+    Window win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
+
+    AccessWindowStatic     input0_access(input0->info(), 0, 0, ceil_to_multiple(input0->info()->dimension(0), num_elems_processed_per_iteration), input0->info()->dimension(1));
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+    update_window_and_padding(win, input0_access, output_access);
+
+    output_access.set_valid_region(win, ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEWinogradBatchedGEMMKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int num_channels  = _input0->info()->dimension(1);
+    const int in0_stride_y  = _input0->info()->strides_in_bytes()[1];
+    const int in1_stride_y  = _input1->info()->strides_in_bytes()[1];
+
+    Iterator out(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const uint8_t *src0_base = _input0->buffer() + _input0->info()->offset_element_in_bytes(Coordinates(id.x(), 0, id.z()));
+        const uint8_t *src1_base = _input1->buffer() + _input1->info()->offset_element_in_bytes(Coordinates(id.y(), 0, id.z()));
+
+        // Accumulate four tiles at once over the input channels
+        float32x4_t acc = vdupq_n_f32(0.f);
+        for(int c = 0; c < num_channels; ++c)
+        {
+            const float32x4_t a = vld1q_f32(reinterpret_cast<const float *>(src0_base + c * in0_stride_y));
+            acc                 = vmlaq_n_f32(acc, a, *reinterpret_cast<const float *>(src1_base + c * in1_stride_y));
+        }
+
+        vst1q_f32(reinterpret_cast<float *>(out.ptr()), acc);
+    },
+    out);
+}
+
+NEWinogradOutputTransformKernel::NEWinogradOutputTransformKernel()
+    : _input(nullptr), _biases(nullptr), _output(nullptr), _num_tiles_x(0)
+{
+}
+
+void NEWinogradOutputTransformKernel::configure(const ITensor *input, const ITensor *biases, ITensor *output, unsigned int num_tiles_x)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(output);
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        ARM_COMPUTE_ERROR_ON(biases->info()->dimension(0) != input->info()->dimension(1));
+    }
+
+    _input       = input;
+    _biases      = biases;
+    _output      = output;
+    _num_tiles_x = num_tiles_x;
+
+    // The window ranges over the tiles (x) and the output filters (y) of the input tensor
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, input->info()->dimension(0), 1));
+    win.set(Window::DimY, Window::Dimension(0, input->info()->dimension(1), 1));
+
+    // Each tile writes a 2x2 block, so the output must be padded up to even extents
+    AccessWindowStatic output_access(output->info(), 0, 0, ceil_to_multiple(output->info()->dimension(0), 2), ceil_to_multiple(output->info()->dimension(1), 2));
+    update_window_and_padding(win, output_access);
+
+    output_access.set_valid_region(win, ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEWinogradOutputTransformKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int in_stride_z   = _input->info()->strides_in_bytes()[2];
+    const int out_stride_x  = _output->info()->strides_in_bytes()[0];
+    const int out_stride_y  = _output->info()->strides_in_bytes()[1];
+
+    for(int k = window.y().start(); k < window.y().end(); ++k)
+    {
+        const float bias = (_biases != nullptr) ? *reinterpret_cast<const float *>(_biases->ptr_to_element(Coordinates(k))) : 0.f;
+
+        for(int t = window.x().start(); t < window.x().end(); ++t)
+        {
+            const uint8_t *in_base = _input->buffer() + _input->info()->offset_element_in_bytes(Coordinates(t, k, 0));
+
+            // Gather the 16 coefficients of the multiplied tile m from the z planes
+            float m[16];
+            for(int p = 0; p < 16; ++p)
+            {
+                m[p] = *reinterpret_cast<const float *>(in_base + p * in_stride_z);
+            }
+
+            // Y = A^T m A: first combine the rows, then the columns
+            float w0[4];
+            float w1[4];
+            for(int j = 0; j < 4; ++j)
+            {
+                w0[j] = m[0 + j] + m[4 + j] + m[8 + j];
+                w1[j] = m[4 + j] - m[8 + j] - m[12 + j];
+            }
+
+            const float y00 = w0[0] + w0[1] + w0[2] + bias;
+            const float y01 = w0[1] - w0[2] - w0[3] + bias;
+            const float y10 = w1[0] + w1[1] + w1[2] + bias;
+            const float y11 = w1[1] - w1[2] - w1[3] + bias;
+
+            uint8_t *out_base = _output->buffer() + _output->info()->offset_element_in_bytes(Coordinates((t % _num_tiles_x) * 2, (t / _num_tiles_x) * 2, k));
+
+            *reinterpret_cast<float *>(out_base)                               = y00;
+            *reinterpret_cast<float *>(out_base + out_stride_x)                = y01;
+            *reinterpret_cast<float *>(out_base + out_stride_y)                = y10;
+            *reinterpret_cast<float *>(out_base + out_stride_y + out_stride_x) = y11;
+        }
+    }
+}
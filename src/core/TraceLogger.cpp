@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "arm_compute/core/TraceLogger.h"
+
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+#include <chrono>
+
+using namespace arm_compute;
+
+constexpr unsigned int TraceLogger::ring_capacity;
+
+TraceLogger::TraceLogger()
+    : _enabled(false), _rings_mutex(), _rings(), _event_names()
+{
+}
+
+TraceLogger &TraceLogger::get()
+{
+    static TraceLogger _instance;
+    return _instance;
+}
+
+void TraceLogger::set_enabled(bool enabled)
+{
+    _enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool TraceLogger::enabled() const
+{
+    return _enabled.load(std::memory_order_relaxed);
+}
+
+TraceLogger::Ring &TraceLogger::thread_ring()
+{
+    // Each thread registers its ring once and then records without any synchronization;
+    // the logger keeps the ring alive after the thread exits so its records can be drained
+    static thread_local Ring *ring = nullptr;
+    if(ring == nullptr)
+    {
+        auto new_ring = support::cpp14::make_unique<Ring>();
+        ring          = new_ring.get();
+
+        std::lock_guard<std::mutex> lock(_rings_mutex);
+        new_ring->thread_id = static_cast<uint32_t>(_rings.size());
+        _rings.push_back(std::move(new_ring));
+    }
+    return *ring;
+}
+
+void TraceLogger::record(uint32_t event_id, uint64_t arg0, uint64_t arg1)
+{
+    if(!enabled())
+    {
+        return;
+    }
+
+    Ring          &ring = thread_ring();
+    const uint64_t slot = ring.head.load(std::memory_order_relaxed);
+
+    TraceEvent &event = ring.events[slot % ring_capacity];
+    event.event_id    = event_id;
+    event.thread_id   = ring.thread_id;
+    event.timestamp   = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    event.args[0]     = arg0;
+    event.args[1]     = arg1;
+
+    // The release store publishes the record to a subsequent drain
+    ring.head.store(slot + 1, std::memory_order_release);
+}
+
+std::vector<TraceEvent> TraceLogger::drain()
+{
+    std::vector<TraceEvent> events;
+
+    std::lock_guard<std::mutex> lock(_rings_mutex);
+    for(auto &ring : _rings)
+    {
+        const uint64_t head      = ring->head.load(std::memory_order_acquire);
+        const uint64_t retained  = std::min<uint64_t>(head, ring_capacity);
+        const uint64_t oldest    = head - retained;
+
+        for(uint64_t slot = oldest; slot < head; ++slot)
+        {
+            events.push_back(ring->events[slot % ring_capacity]);
+        }
+        ring->head.store(0, std::memory_order_relaxed);
+    }
+
+    std::sort(events.begin(), events.end(), [](const TraceEvent & a, const TraceEvent & b)
+    {
+        return a.timestamp < b.timestamp;
+    });
+    return events;
+}
+
+void TraceLogger::format(std::ostream &stream)
+{
+    std::map<uint32_t, std::string> event_names;
+    {
+        std::lock_guard<std::mutex> lock(_rings_mutex);
+        event_names = _event_names;
+    }
+
+    for(const TraceEvent &event : drain())
+    {
+        const auto name_it = event_names.find(event.event_id);
+
+        stream << event.timestamp << " thread " << event.thread_id << " ";
+        if(name_it != event_names.end())
+        {
+            stream << name_it->second;
+        }
+        else
+        {
+            stream << "event " << event.event_id;
+        }
+        stream << " args[" << event.args[0] << ", " << event.args[1] << "]\n";
+    }
+}
+
+void TraceLogger::set_event_name(uint32_t event_id, std::string name)
+{
+    std::lock_guard<std::mutex> lock(_rings_mutex);
+    _event_names[event_id] = std::move(name);
+}
@@ -131,6 +131,7 @@ const std::string &arm_compute::string_from_data_type(DataType dt)
         { DataType::S8, "S8" },
         { DataType::U8, "U8" },
         { DataType::QS8, "QS8" },
+        { DataType::QASYMM8, "QASYMM8" },
         { DataType::S16, "S16" },
         { DataType::U16, "U16" },
         { DataType::QS16, "QS16" },
@@ -251,8 +252,10 @@ const std::pair<unsigned int, unsigned int> arm_compute::scaled_dimensions(unsig
                                                                            unsigned int kernel_width, unsigned int kernel_height,
                                                                            const PadStrideInfo &pad_stride_info)
 {
-    const unsigned int pad_x    = pad_stride_info.pad().first;
-    const unsigned int pad_y    = pad_stride_info.pad().second;
+    const unsigned int pad_x    = pad_stride_info.pad_left();
+    const unsigned int pad_y    = pad_stride_info.pad_top();
+    const unsigned int pads_x   = pad_stride_info.pad_left() + pad_stride_info.pad_right();
+    const unsigned int pads_y   = pad_stride_info.pad_top() + pad_stride_info.pad_bottom();
     const unsigned int stride_x = pad_stride_info.stride().first;
     const unsigned int stride_y = pad_stride_info.stride().second;
     unsigned int       w        = 0;
@@ -260,12 +263,12 @@ const std::pair<unsigned int, unsigned int> arm_compute::scaled_dimensions(unsig
     switch(pad_stride_info.round())
     {
         case DimensionRoundingType::FLOOR:
-            w = static_cast<unsigned int>(std::floor((static_cast<float>(width + 2 * pad_x - kernel_width) / stride_x) + 1));
-            h = static_cast<unsigned int>(std::floor((static_cast<float>(height + 2 * pad_y - kernel_height) / stride_y) + 1));
+            w = static_cast<unsigned int>(std::floor((static_cast<float>(width + pads_x - kernel_width) / stride_x) + 1));
+            h = static_cast<unsigned int>(std::floor((static_cast<float>(height + pads_y - kernel_height) / stride_y) + 1));
             break;
         case DimensionRoundingType::CEIL:
-            w = static_cast<unsigned int>(std::ceil((static_cast<float>(width + 2 * pad_x - kernel_width) / stride_x) + 1));
-            h = static_cast<unsigned int>(std::ceil((static_cast<float>(height + 2 * pad_y - kernel_height) / stride_y) + 1));
+            w = static_cast<unsigned int>(std::ceil((static_cast<float>(width + pads_x - kernel_width) / stride_x) + 1));
+            h = static_cast<unsigned int>(std::ceil((static_cast<float>(height + pads_y - kernel_height) / stride_y) + 1));
             break;
         default:
             ARM_COMPUTE_ERROR("Unsupported rounding type");
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/ConvolutionMethodTable.h"
+
+#include <fstream>
+
+using namespace arm_compute::graph;
+
+namespace
+{
+const char *method_to_string(ConvolutionMethodHint method)
+{
+    return (method == ConvolutionMethodHint::DIRECT) ? "DIRECT" : "GEMM";
+}
+
+bool method_from_string(const std::string &str, ConvolutionMethodHint &method)
+{
+    if(str == "GEMM")
+    {
+        method = ConvolutionMethodHint::GEMM;
+        return true;
+    }
+    if(str == "DIRECT")
+    {
+        method = ConvolutionMethodHint::DIRECT;
+        return true;
+    }
+    return false;
+}
+} // namespace
+
+ConvolutionMethodTable &ConvolutionMethodTable::get()
+{
+    static ConvolutionMethodTable table;
+    return table;
+}
+
+void ConvolutionMethodTable::bind_file(const std::string &filename)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _filename = filename;
+
+    // Load the decisions already recorded; a missing file is an empty table
+    std::ifstream file(filename);
+    std::string   key;
+    std::string   method_str;
+
+    while(file >> key >> method_str)
+    {
+        ConvolutionMethodHint method = ConvolutionMethodHint::GEMM;
+        if(method_from_string(method_str, method))
+        {
+            _table[key] = method;
+        }
+    }
+}
+
+bool ConvolutionMethodTable::lookup(const std::string &key, ConvolutionMethodHint &method) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    const auto it = _table.find(key);
+    if(it == _table.end())
+    {
+        return false;
+    }
+
+    method = it->second;
+    return true;
+}
+
+void ConvolutionMethodTable::store(const std::string &key, ConvolutionMethodHint method)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _table[key] = method;
+
+    // The table is tiny (one entry per shape class), so the bound file is simply rewritten
+    if(!_filename.empty())
+    {
+        std::ofstream file(_filename, std::ios::trunc);
+        for(const auto &entry : _table)
+        {
+            file << entry.first << " " << method_to_string(entry.second) << "\n";
+        }
+    }
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/FusedActivation.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/runtime/CL/CLTensor.h"
+#include "arm_compute/runtime/CL/functions/CLActivationLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "support/ToolchainSupport.h"
+
+using namespace arm_compute::graph;
+
+FusedActivationFunction::FusedActivationFunction(std::unique_ptr<arm_compute::IFunction> func, std::unique_ptr<arm_compute::IFunction> activation)
+    : _func(std::move(func)), _activation(std::move(activation))
+{
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+    ARM_COMPUTE_ERROR_ON(_activation == nullptr);
+}
+
+void FusedActivationFunction::run()
+{
+    _func->run();
+    _activation->run();
+}
+
+void FusedActivationFunction::prepare()
+{
+    _func->prepare();
+    _activation->prepare();
+}
+
+std::unique_ptr<arm_compute::IFunction> arm_compute::graph::instantiate_in_place_activation(TargetHint target_hint, ITensor *tensor, const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON(tensor == nullptr);
+
+    // Both backends run the activation in-place when no output tensor is provided
+    if(target_hint == TargetHint::OPENCL)
+    {
+        auto activation = arm_compute::support::cpp14::make_unique<arm_compute::CLActivationLayer>();
+        activation->configure(dynamic_cast<arm_compute::ICLTensor *>(tensor), nullptr, act_info);
+        return std::move(activation);
+    }
+    auto activation = arm_compute::support::cpp14::make_unique<arm_compute::NEActivationLayer>();
+    activation->configure(tensor, nullptr, act_info);
+    return std::move(activation);
+}
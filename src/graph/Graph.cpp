@@ -23,20 +23,226 @@
  */
 #include "arm_compute/graph/Graph.h"
 
+#include "arm_compute/core/CL/OpenCL.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Logger.h"
 #include "arm_compute/graph/CL/CLMap.h"
 #include "arm_compute/graph/CL/CLUnmap.h"
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/Tensor.h"
+#include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/BlobLifetimeManager.h"
+#include "arm_compute/runtime/CL/CLBufferAllocator.h"
+#include "arm_compute/runtime/CL/CLMemoryGroup.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
 #include "arm_compute/runtime/CL/CLTensor.h"
+#include "arm_compute/runtime/CL/functions/CLDepthConvert.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/MemoryManagerOnDemand.h"
+#include "arm_compute/runtime/NEON/functions/NEDepthConvert.h"
+#include "arm_compute/runtime/OffsetLifetimeManager.h"
+#include "arm_compute/runtime/PoolManager.h"
+#include "arm_compute/runtime/Scheduler.h"
 #include "arm_compute/runtime/Tensor.h"
+#include "utils/TypePrinter.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <sys/mman.h>
+#include <unistd.h>
 
 using namespace arm_compute::graph;
 
+namespace
+{
+// Rough throughput figures for the automatic placement cost model. They are deliberately
+// coarse: the model only needs to separate clearly CPU-bound layers (small tensors, little
+// arithmetic) from clearly GPU-bound ones (large convolutions), where a wrong manual
+// placement is most costly.
+constexpr float neon_ops_per_us         = 20000.f; /* ~20 Gop/s on a mid-range CPU */
+constexpr float cl_ops_per_us           = 80000.f; /* ~80 Gop/s on a mid-range mobile GPU */
+constexpr float cl_dispatch_overhead_us = 60.f;    /* kernel submission and host synchronization */
+constexpr float transfer_bytes_per_us   = 8000.f;  /* ~8 GB/s effective map/copy bandwidth */
+} // namespace
+
 struct Stage
 {
     Tensor                                 *_input;
     Tensor                                 *_output;
     std::unique_ptr<arm_compute::IFunction> _function;
+    const char                             *_name;     /**< Layer type name, used by profiling */
+    bool                                    _cl_stage; /**< True if the stage enqueues OpenCL work that outlives run() */
+};
+
+/** One recorded stage execution of a profiled graph */
+struct TraceEvent
+{
+    size_t _stage;    /**< Index of the stage in the pipeline */
+    int    _tid;      /**< Thread lane the stage ran on (1 for the back half of a pipelined graph) */
+    double _start_us; /**< Start time relative to the trace epoch in microseconds */
+    double _dur_us;   /**< Duration in microseconds */
+};
+
+/** Stage function copying the boundary tensor of a pipelined graph into its staging double buffer */
+class TensorCopyFunction final : public arm_compute::IFunction
+{
+public:
+    /** Constructor
+     *
+     * @param[in] src Tensor to copy from
+     * @param[in] dst Tensor to copy to
+     */
+    TensorCopyFunction(Tensor *src, Tensor *dst)
+        : _src(src), _dst(dst)
+    {
+    }
+
+    // Inherited methods overriden:
+    void run() override
+    {
+        arm_compute::ITensor *src    = _src->tensor();
+        arm_compute::ITensor *dst    = _dst->tensor();
+        auto                 *src_cl = dynamic_cast<arm_compute::CLTensor *>(src);
+        auto                 *dst_cl = dynamic_cast<arm_compute::CLTensor *>(dst);
+        if(src_cl != nullptr)
+        {
+            src_cl->map(true);
+        }
+        if(dst_cl != nullptr)
+        {
+            dst_cl->map(true);
+        }
+        dst->copy_from(*src);
+        if(src_cl != nullptr)
+        {
+            src_cl->unmap();
+        }
+        if(dst_cl != nullptr)
+        {
+            dst_cl->unmap();
+        }
+    }
+
+private:
+    Tensor *_src; /**< Boundary tensor written by the first segment */
+    Tensor *_dst; /**< Staging tensor read by the second segment */
+};
+
+/** Stage function copying one batch slice between the full-batch boundary tensor of a
+ * sub-batched graph and the sub-batch sized tensor the pipeline is configured with.
+ *
+ * The slice index advances on every run, so executing the function once per sub-batch
+ * walks through the full batch in order.
+ */
+class BatchSliceCopyFunction final : public arm_compute::IFunction
+{
+public:
+    /** Constructor
+     *
+     * @param[in] full   Full-batch tensor
+     * @param[in] sub    Sub-batch sized tensor
+     * @param[in] gather True to copy from the full tensor into the sub tensor, false for the reverse
+     */
+    BatchSliceCopyFunction(Tensor *full, Tensor *sub, bool gather)
+        : _full(full), _sub(sub), _gather(gather), _slice(0)
+    {
+    }
+
+    // Inherited methods overriden:
+    void run() override
+    {
+        arm_compute::ITensor *full    = _full->tensor();
+        arm_compute::ITensor *sub     = _sub->tensor();
+        auto                 *full_cl = dynamic_cast<arm_compute::CLTensor *>(full);
+        auto                 *sub_cl  = dynamic_cast<arm_compute::CLTensor *>(sub);
+        if(full_cl != nullptr)
+        {
+            full_cl->map(true);
+        }
+        if(sub_cl != nullptr)
+        {
+            sub_cl->map(true);
+        }
+
+        // Batches are the outermost dimension of both tensors
+        const size_t       batch_dim   = sub->info()->num_dimensions() - 1;
+        const size_t       sub_batches = sub->info()->dimension(batch_dim);
+        const size_t       num_slices  = full->info()->dimension(batch_dim) / sub_batches;
+        const size_t       element_size = sub->info()->element_size();
+        arm_compute::Window window;
+        window.use_tensor_dimensions(sub->info()->tensor_shape());
+        arm_compute::execute_window_loop(window, [&](const arm_compute::Coordinates & id)
+        {
+            arm_compute::Coordinates full_id = id;
+            full_id.set(batch_dim, id[batch_dim] + _slice * sub_batches);
+            if(_gather)
+            {
+                std::memcpy(sub->ptr_to_element(id), full->ptr_to_element(full_id), element_size);
+            }
+            else
+            {
+                std::memcpy(full->ptr_to_element(full_id), sub->ptr_to_element(id), element_size);
+            }
+        });
+        _slice = (_slice + 1) % num_slices;
+
+        if(full_cl != nullptr)
+        {
+            full_cl->unmap();
+        }
+        if(sub_cl != nullptr)
+        {
+            sub_cl->unmap();
+        }
+    }
+
+private:
+    Tensor *_full;   /**< Full-batch tensor at the graph boundary */
+    Tensor *_sub;    /**< Sub-batch sized tensor of the pipeline */
+    bool    _gather; /**< Copy direction */
+    size_t  _slice;  /**< Next batch slice to copy */
+};
+
+/** Creates the depth-convert function for an F16 island boundary on the given tensors' target */
+std::unique_ptr<arm_compute::IFunction> instantiate_depth_convert(Tensor *input, Tensor *output)
+{
+    if(output->target() == TargetHint::OPENCL)
+    {
+        auto *in_cl  = dynamic_cast<arm_compute::ICLTensor *>(input->tensor());
+        auto *out_cl = dynamic_cast<arm_compute::ICLTensor *>(output->tensor());
+        ARM_COMPUTE_ERROR_ON(in_cl == nullptr || out_cl == nullptr);
+        auto convert = arm_compute::support::cpp14::make_unique<arm_compute::CLDepthConvert>();
+        convert->configure(in_cl, out_cl, arm_compute::ConvertPolicy::SATURATE, 0);
+        return std::move(convert);
+    }
+    auto convert = arm_compute::support::cpp14::make_unique<arm_compute::NEDepthConvert>();
+    convert->configure(input->tensor(), output->tensor(), arm_compute::ConvertPolicy::SATURATE, 0);
+    return std::move(convert);
+}
+
+/** A named split of the pipeline for partial execution */
+struct CutPoint
+{
+    size_t  _stage;    /**< First stage of the second part of the pipeline */
+    Tensor *_boundary; /**< Tensor exposed while a frame waits at the cut */
+};
+
+/** An intermediate tensor whose backing memory is owned by a memory manager */
+struct ManagedTensor
+{
+    std::shared_ptr<arm_compute::IMemoryGroup> _group;          /**< Memory group holding the tensor */
+    arm_compute::MemoryManagerOnDemand        *_memory_manager; /**< Manager the group was created from */
 };
 
 struct Graph::Private
@@ -44,9 +250,45 @@ struct Graph::Private
 public:
     /** Finalizes the current node's configuration
      *
+     * @param next_node  The node that follows, if any (used to resolve its automatic placement)
      * @param _next_hint Device execution hint
      */
-    void configure(GraphHints _next_hints);
+    void configure(INode *next_node, GraphHints _next_hints);
+    /** Picks the cheaper target for a node whose hint is DONT_CARE
+     *
+     * @param[in] node            Node to place
+     * @param[in] input           Input tensor info the cost estimate is based on
+     * @param[in] previous_target Target of the node's input tensor (DONT_CARE if none)
+     *
+     * @return The selected target
+     */
+    TargetHint auto_place(INode *node, const TensorInfo &input, TargetHint previous_target) const;
+    /** Decides the data type a node runs in when automatic F16 islands are enabled
+     *
+     * @param[in] node  Node to decide for
+     * @param[in] input Input tensor info of the node
+     * @param[in] hints Resolved hints of the node (target and precision)
+     *
+     * @return The data type the node should run in
+     */
+    DataType decide_node_precision(INode *node, const TensorInfo &input, const GraphHints &hints) const;
+    /** Hands an auto-configured intermediate tensor's allocation over to the target's memory manager */
+    void manage_tensor(Tensor *tensor);
+    /** Derives intermediate tensor lifetimes from the stage execution order and finalizes the memory managers */
+    void plan_memory();
+    /** Runs the pipeline as a two-stage pipeline, overlapping consecutive frames across the split */
+    void run_pipelined();
+    /** Runs the stages in [first, last), acquiring and releasing managed tensor memory around each
+     *
+     * @return False when the frame was abandoned (cancelled or over its deadline) before the last stage
+     */
+    bool execute_stages(size_t first, size_t last);
+    /** True when the in-flight frame has been cancelled or has exceeded its deadline */
+    bool frame_abandoned() const;
+    /** Issues readahead advice for the given constant tensors' pages */
+    void prefetch_constants(const std::vector<arm_compute::ITensor *> &constants) const;
+    /** Records one profiled stage execution into the report and the trace */
+    void record_stage_time(size_t stage, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end);
 
     GraphContext                         _ctx{};
     std::vector<Stage>                   _pipeline{};
@@ -59,6 +301,37 @@ public:
     std::unique_ptr<INode>               _current_node{ nullptr };
     Tensor                              *_current_output{ nullptr };
 
+    std::shared_ptr<arm_compute::MemoryManagerOnDemand>   _mm_neon{ nullptr };
+    std::shared_ptr<arm_compute::MemoryManagerOnDemand>   _mm_cl{ nullptr };
+    arm_compute::Allocator                                _neon_allocator{};
+    std::unique_ptr<arm_compute::CLBufferAllocator>       _cl_allocator{ nullptr };
+    std::map<ITensor *, ManagedTensor>                    _managed_tensors{};
+    std::vector<std::vector<arm_compute::IMemoryGroup *>> _stage_acquires{};
+    std::vector<std::vector<arm_compute::IMemoryGroup *>> _stage_releases{};
+    std::map<size_t, std::vector<arm_compute::ITensor *>> _stage_constants{};
+    bool                                                  _memory_planned{ false };
+    bool                                                  _finalized{ false };
+    bool                                                  _uses_opencl{ false };
+    bool                                                  _pipelining{ false };
+    bool                                                  _auto_fp16{ false };
+    bool                                                  _weights_prefetch{ false };
+    int                                                   _split_stage{ -1 };
+    std::map<std::string, CutPoint>                       _cut_points{};
+    std::string                                           _pending_cut_name{};
+    int                                                   _resume_stage{ -1 };
+    unsigned int                                          _num_sub_batches{ 1 };
+    Tensor                                               *_sub_input{ nullptr };
+    std::atomic<bool>                                     _cancelled{ false };
+    unsigned int                                          _frame_deadline_us{ 0 };
+    std::chrono::steady_clock::time_point                 _frame_deadline{};
+    arm_compute::IScheduler::Priority                     _priority{ arm_compute::IScheduler::Priority::Normal };
+
+    bool                                  _profiling{ false };
+    std::vector<GraphStageProfile>        _profiles{};
+    std::vector<TraceEvent>               _trace{};
+    mutable std::mutex                    _profile_mutex{};
+    std::chrono::steady_clock::time_point _trace_epoch{};
+
 private:
     Tensor    *_current_input{ nullptr };
     GraphHints _previous_hints{};
@@ -74,79 +347,518 @@ Graph::Graph()
 {
 }
 
+void Graph::set_scheduler(arm_compute::IScheduler *scheduler)
+{
+    _pimpl->_ctx.set_scheduler(scheduler);
+}
+
+void Graph::set_priority(arm_compute::IScheduler::Priority priority)
+{
+    _pimpl->_priority = priority;
+}
+
+void Graph::set_frame_deadline(unsigned int deadline_us)
+{
+    _pimpl->_frame_deadline_us = deadline_us;
+}
+
+void Graph::cancel()
+{
+    _pimpl->_cancelled.store(true, std::memory_order_relaxed);
+}
+
+void Graph::set_pipelining_enabled(bool enabled)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_pimpl->_graph_input != nullptr, "Pipelining must be enabled before the graph is built");
+    ARM_COMPUTE_ERROR_ON_MSG(enabled && _pimpl->_num_sub_batches > 1, "Pipelined execution cannot be combined with sub-batch splitting");
+    _pimpl->_pipelining = enabled;
+}
+
+void Graph::set_num_sub_batches(unsigned int num_sub_batches)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_pimpl->_graph_input != nullptr, "The number of sub-batches must be set before the graph is built");
+    ARM_COMPUTE_ERROR_ON_MSG(num_sub_batches == 0, "At least one sub-batch is required");
+    ARM_COMPUTE_ERROR_ON_MSG(_pimpl->_pipelining && num_sub_batches > 1, "Sub-batch splitting cannot be combined with pipelined execution");
+    _pimpl->_num_sub_batches = num_sub_batches;
+}
+
+void Graph::set_weights_prefetch_enabled(bool enabled)
+{
+    _pimpl->_weights_prefetch = enabled;
+}
+
+void Graph::set_auto_fp16_enabled(bool enabled)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_pimpl->_graph_input != nullptr, "Automatic F16 islands must be enabled before the graph is built");
+    _pimpl->_auto_fp16 = enabled;
+}
+
+void Graph::set_profiling_enabled(bool enabled)
+{
+    if(enabled && _pimpl->_trace.empty())
+    {
+        _pimpl->_trace_epoch = std::chrono::steady_clock::now();
+    }
+    _pimpl->_profiling = enabled;
+}
+
+std::vector<GraphStageProfile> Graph::profiling_report() const
+{
+    std::lock_guard<std::mutex> lock(_pimpl->_profile_mutex);
+    return _pimpl->_profiles;
+}
+
+void Graph::dump_trace(const std::string &filename) const
+{
+    std::lock_guard<std::mutex> lock(_pimpl->_profile_mutex);
+    std::ofstream stream(filename, std::ios::trunc);
+    ARM_COMPUTE_ERROR_ON_MSG(!stream.good(), "Could not open trace file for writing");
+
+    stream << "{\"traceEvents\":[";
+    for(size_t i = 0; i < _pimpl->_trace.size(); ++i)
+    {
+        const TraceEvent        &event   = _pimpl->_trace[i];
+        const GraphStageProfile &profile = _pimpl->_profiles[event._stage];
+        stream << ((i == 0) ? "\n" : ",\n")
+               << "{\"name\":\"" << profile.name << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event._tid
+               << ",\"ts\":" << event._start_us << ",\"dur\":" << event._dur_us
+               << ",\"args\":{\"shape\":\"" << profile.shape << "\"}}";
+    }
+    stream << "\n]}\n";
+}
+
+void Graph::finalize()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_pimpl->_graph_output == nullptr, "The graph must be complete before it can be finalized");
+    if(_pimpl->_finalized)
+    {
+        return;
+    }
+    arm_compute::Scheduler::bind_to_thread(_pimpl->_ctx.scheduler());
+
+    if(!_pimpl->_memory_planned)
+    {
+        _pimpl->plan_memory();
+        _pimpl->_memory_planned = true;
+    }
+
+    // Run one shot work (e.g. weights reshaping) up front
+    for(auto &stage : _pimpl->_pipeline)
+    {
+        stage._function->prepare();
+    }
+
+    // Dry pass over whatever the input buffer holds: forces OpenCL kernel compilation, tuner
+    // sweeps and any remaining lazy first-run work without consuming a real frame. Accessors
+    // are not called, so neither the input stream nor the consumer sees this pass.
+    for(unsigned int sub_batch = 0; sub_batch < _pimpl->_num_sub_batches; ++sub_batch)
+    {
+        _pimpl->execute_stages(0, _pimpl->_pipeline.size());
+    }
+    if(_pimpl->_uses_opencl)
+    {
+        arm_compute::CLScheduler::get().sync();
+    }
+
+    // Constant subexpressions (weight reshapes, folded parameters) have now all executed and
+    // their results are baked into the functions' own tensors: drop the original constants
+    for(auto &node : _pimpl->_nodes)
+    {
+        node->release_constant_data();
+    }
+    if(_pimpl->_current_node != nullptr)
+    {
+        _pimpl->_current_node->release_constant_data();
+    }
+
+    _pimpl->_finalized = true;
+    arm_compute::Scheduler::bind_to_thread(nullptr);
+}
+
 void Graph::run()
 {
-    while(true)
+    // While the graph runs, route this thread's kernel dispatches to the bound scheduler (if any)
+    arm_compute::Scheduler::bind_to_thread(_pimpl->_ctx.scheduler());
+    // Carry the graph's dispatch priority and cancellation flag on this thread, so the CPU
+    // scheduler can favour an interactive graph's kernels and cut a cancelled one short
+    arm_compute::IScheduler::set_caller_priority(_pimpl->_priority);
+    arm_compute::IScheduler::set_cancellation_flag(&_pimpl->_cancelled);
+
+    // Commit the intermediate tensors' memory plan once the pipeline is complete
+    if(!_pimpl->_memory_planned)
     {
-        if(!_pimpl->_graph_input->call_accessor())
-        {
-            return;
-        }
+        _pimpl->plan_memory();
+        _pimpl->_memory_planned = true;
+    }
 
-        for(auto &stage : _pimpl->_pipeline)
+    // Run one shot work (e.g. weights reshaping) before entering the processing loop
+    for(auto &stage : _pimpl->_pipeline)
+    {
+        stage._function->prepare();
+    }
+
+    if(_pimpl->_pipelining && _pimpl->_split_stage >= 0)
+    {
+        _pimpl->run_pipelined();
+    }
+    else
+    {
+        while(true)
         {
-            stage._function->run();
+            if(!_pimpl->_graph_input->call_accessor())
+            {
+                break;
+            }
+
+            // Arm the frame budget: the stages poll it between stages, and the scheduler's
+            // copy makes an in-flight kernel stop at its next window-chunk boundary
+            if(_pimpl->_frame_deadline_us != 0)
+            {
+                _pimpl->_frame_deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(_pimpl->_frame_deadline_us);
+                arm_compute::IScheduler::set_dispatch_deadline(std::chrono::duration_cast<std::chrono::nanoseconds>(_pimpl->_frame_deadline.time_since_epoch()).count());
+            }
+            else
+            {
+                _pimpl->_frame_deadline = std::chrono::steady_clock::time_point();
+                arm_compute::IScheduler::set_dispatch_deadline(0);
+            }
+
+            bool completed = true;
+            for(unsigned int sub_batch = 0; completed && sub_batch < _pimpl->_num_sub_batches; ++sub_batch)
+            {
+                completed = _pimpl->execute_stages(0, _pimpl->_pipeline.size());
+            }
+
+            // An abandoned frame delivers no output; the run loop moves on to the next frame
+            if(completed && !_pimpl->_graph_output->call_accessor())
+            {
+                break;
+            }
+            if(_pimpl->_cancelled.load(std::memory_order_relaxed))
+            {
+                break;
+            }
         }
+    }
+
+    _pimpl->_frame_deadline = std::chrono::steady_clock::time_point();
+    _pimpl->_cancelled.store(false, std::memory_order_relaxed);
+    arm_compute::IScheduler::set_dispatch_deadline(0);
+    arm_compute::IScheduler::set_cancellation_flag(nullptr);
+    arm_compute::IScheduler::set_caller_priority(arm_compute::IScheduler::Priority::Normal);
+    arm_compute::Scheduler::bind_to_thread(nullptr);
+}
+
+void Graph::mark_cut_point(const std::string &name)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_pimpl->_current_node == nullptr, "A cut point must be placed after a node");
+    ARM_COMPUTE_ERROR_ON_MSG(_pimpl->_graph_output != nullptr, "Cut points must be placed before the output tensor");
+    ARM_COMPUTE_ERROR_ON_MSG(!_pimpl->_pending_cut_name.empty(), "Only one cut point can be placed per node");
+    ARM_COMPUTE_ERROR_ON_MSG(_pimpl->_cut_points.find(name) != _pimpl->_cut_points.end(), "Cut point names must be unique");
+
+    _pimpl->_pending_cut_name = name;
+}
+
+const arm_compute::ITensor *Graph::run_to(const std::string &name)
+{
+    const auto cut = _pimpl->_cut_points.find(name);
+    ARM_COMPUTE_ERROR_ON_MSG(cut == _pimpl->_cut_points.end(), "Unknown cut point");
+    ARM_COMPUTE_ERROR_ON_MSG(_pimpl->_pipelining || _pimpl->_num_sub_batches > 1, "Partial execution cannot be combined with pipelined or sub-batched execution");
+    ARM_COMPUTE_ERROR_ON_MSG(_pimpl->_resume_stage >= 0, "The previous frame has not been completed with run_from()");
 
-        if(!_pimpl->_graph_output->call_accessor())
+    arm_compute::Scheduler::bind_to_thread(_pimpl->_ctx.scheduler());
+    arm_compute::IScheduler::set_caller_priority(_pimpl->_priority);
+    arm_compute::IScheduler::set_cancellation_flag(&_pimpl->_cancelled);
+
+    if(!_pimpl->_memory_planned)
+    {
+        _pimpl->plan_memory();
+        _pimpl->_memory_planned = true;
+    }
+    for(auto &stage : _pimpl->_pipeline)
+    {
+        stage._function->prepare();
+    }
+
+    const arm_compute::ITensor *boundary = nullptr;
+    if(_pimpl->_graph_input->call_accessor() && _pimpl->execute_stages(0, cut->second._stage))
+    {
+        // Make the cut point's result observable before handing it to the caller
+        if(_pimpl->_uses_opencl)
         {
-            return;
+            arm_compute::CLScheduler::get().sync();
         }
+        _pimpl->_resume_stage = static_cast<int>(cut->second._stage);
+        boundary              = cut->second._boundary->tensor();
     }
+
+    arm_compute::IScheduler::set_cancellation_flag(nullptr);
+    arm_compute::IScheduler::set_caller_priority(arm_compute::IScheduler::Priority::Normal);
+    arm_compute::Scheduler::bind_to_thread(nullptr);
+    return boundary;
+}
+
+bool Graph::run_from(const std::string &name)
+{
+    const auto cut = _pimpl->_cut_points.find(name);
+    ARM_COMPUTE_ERROR_ON_MSG(cut == _pimpl->_cut_points.end(), "Unknown cut point");
+    ARM_COMPUTE_ERROR_ON_MSG(_pimpl->_resume_stage != static_cast<int>(cut->second._stage), "No frame is waiting at this cut point");
+
+    arm_compute::Scheduler::bind_to_thread(_pimpl->_ctx.scheduler());
+    arm_compute::IScheduler::set_caller_priority(_pimpl->_priority);
+    arm_compute::IScheduler::set_cancellation_flag(&_pimpl->_cancelled);
+
+    const bool completed  = _pimpl->execute_stages(cut->second._stage, _pimpl->_pipeline.size());
+    _pimpl->_resume_stage = -1;
+    const bool delivered  = completed && _pimpl->_graph_output->call_accessor();
+
+    arm_compute::IScheduler::set_cancellation_flag(nullptr);
+    arm_compute::IScheduler::set_caller_priority(arm_compute::IScheduler::Priority::Normal);
+    arm_compute::Scheduler::bind_to_thread(nullptr);
+    return delivered;
+}
+
+TargetHint Graph::Private::auto_place(INode *node, const TensorInfo &input, TargetHint previous_target) const
+{
+    if(!arm_compute::opencl_is_available())
+    {
+        return TargetHint::NEON;
+    }
+
+    const float ops       = node->estimated_ops(input);
+    float       neon_time = ops / neon_ops_per_us;
+    float       cl_time   = ops / cl_ops_per_us + cl_dispatch_overhead_us;
+
+    // Crossing the device boundary adds a map/unmap and copy of the input tensor. A node that
+    // deviates from the surrounding target also forces its output back over the boundary unless
+    // the following layers deviate with it, so both transfers are charged (the output size is
+    // estimated at the input's): islands too small to amortize their boundaries then merge into
+    // the surrounding target instead of bleeding their gains into transfers.
+    const float transfer_time = static_cast<float>(input.total_size()) / transfer_bytes_per_us;
+    if(previous_target == TargetHint::NEON)
+    {
+        cl_time += 2.f * transfer_time;
+    }
+    else if(previous_target == TargetHint::OPENCL)
+    {
+        neon_time += 2.f * transfer_time;
+    }
+
+    // On a near tie stay on the current device: a switch that barely wins on paper rarely
+    // survives its boundary costs, and the estimates here are coarse
+    if(previous_target == TargetHint::NEON && cl_time >= 0.9f * neon_time)
+    {
+        return TargetHint::NEON;
+    }
+    if(previous_target == TargetHint::OPENCL && neon_time >= 0.9f * cl_time)
+    {
+        return TargetHint::OPENCL;
+    }
+    return (cl_time < neon_time) ? TargetHint::OPENCL : TargetHint::NEON;
+}
+
+DataType Graph::Private::decide_node_precision(INode *node, const TensorInfo &input, const GraphHints &hints) const
+{
+    const bool critical = (hints.precision_hint() == PrecisionHint::FULL);
+    bool       supported = node->supports_fp16();
+#ifndef ARM_COMPUTE_ENABLE_FP16
+    // NEON F16 arithmetic is only compiled in with ARM_COMPUTE_ENABLE_FP16
+    supported = supported && (hints.target_hint() == TargetHint::OPENCL);
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+
+    // Inside an island stay in F16 while possible: the conversion back at the far edge was
+    // already charged when the island was entered
+    if(input.data_type() == DataType::F16)
+    {
+        return (critical || !supported) ? DataType::F32 : DataType::F16;
+    }
+    if(input.data_type() != DataType::F32 || critical || !supported)
+    {
+        return input.data_type();
+    }
+
+    // Entering an island converts the input now and back to F32 at the far edge. Both
+    // conversions are charged against the halved time of the reduced-precision node, so
+    // islands too small to amortize their edges stay in F32. The conversions stream the
+    // tensor through memory once, like a device boundary transfer.
+    const float rate         = (hints.target_hint() == TargetHint::OPENCL) ? cl_ops_per_us : neon_ops_per_us;
+    const float ops          = node->estimated_ops(input);
+    const float convert_time = static_cast<float>(input.total_size()) / transfer_bytes_per_us;
+    return ((ops / (2.f * rate)) + 2.f * convert_time < ops / rate) ? DataType::F16 : DataType::F32;
 }
 
 //Finalize current node's configuration
-void Graph::Private::configure(GraphHints _next_hints)
+void Graph::Private::configure(INode *next_node, GraphHints _next_hints)
 {
     ARM_COMPUTE_ERROR_ON(_current_node == nullptr);
     ARM_COMPUTE_ERROR_ON(_graph_input == nullptr);
 
+    // Resolve this node's automatic placement (only still pending for the first node: later
+    // ones are resolved by the look-ahead below when their predecessor is configured)
+    if(_current_hints.target_hint() == TargetHint::DONT_CARE)
+    {
+        _current_hints.set_target_hint(auto_place(_current_node.get(), _graph_input->info(), TargetHint::DONT_CARE));
+        ARM_COMPUTE_LOG("Auto-placed node on " << ((_current_hints.target_hint() == TargetHint::OPENCL) ? "OpenCL" : "NEON"));
+    }
+
     // Is it the first node of the graph ?
     if(_current_input == nullptr)
     {
         _graph_input->set_target(_current_hints.target_hint());
-        _current_input  = _graph_input.get();
+        _current_input = _graph_input.get();
+        // Sub-batched execution: configure the pipeline for batch / num_sub_batches samples
+        // and gather each sub-batch from the full-batch input the accessor fills
+        if(_num_sub_batches > 1)
+        {
+            const TensorInfo &full_info = _graph_input->info();
+            const size_t      batch_dim = full_info.num_dimensions() - 1;
+            ARM_COMPUTE_ERROR_ON_MSG(full_info.dimension(batch_dim) % _num_sub_batches != 0, "The batch dimension must be a multiple of the number of sub-batches");
+            TensorShape sub_shape = full_info.tensor_shape();
+            sub_shape.set(batch_dim, full_info.dimension(batch_dim) / _num_sub_batches);
+            _tensors.push_back(arm_compute::support::cpp14::make_unique<Tensor>(TensorInfo(sub_shape, full_info.num_channels(), full_info.data_type(), full_info.fixed_point_position())));
+            _sub_input = _tensors.back().get();
+            _sub_input->set_target(_current_hints.target_hint());
+            _graph_input->allocate();
+            _pipeline.push_back({ _graph_input.get(), _sub_input, arm_compute::support::cpp14::make_unique<BatchSliceCopyFunction>(_graph_input.get(), _sub_input, true), "BatchGather", false });
+            _current_input = _sub_input;
+        }
         _previous_hints = _current_hints; // For the first node just assume the previous node was of the same type as this one
     }
 
+    // Allocate the input before the output's lifetime starts, so that the lifetime manager
+    // sees intermediate tensors one at a time and can re-use their backing memory
+    _current_input->allocate();
+
+    // Look ahead: resolve the next node's placement now, so that the boundary tensor is
+    // created on the right target. Its exact input shape is not known yet; this node's
+    // input is the closest estimate available.
+    if(_next_hints.target_hint() == TargetHint::DONT_CARE)
+    {
+        if(next_node != nullptr)
+        {
+            _next_hints.set_target_hint(auto_place(next_node, _current_input->info(), _current_hints.target_hint()));
+            ARM_COMPUTE_LOG("Auto-placed next node on " << ((_next_hints.target_hint() == TargetHint::OPENCL) ? "OpenCL" : "NEON"));
+        }
+        else
+        {
+            _next_hints.set_target_hint(_current_hints.target_hint());
+        }
+    }
+
+    // Hybrid precision: decide the data type this node runs in. A user-typed output pins the
+    // node to the output's precision, which also restores F32 at the graph's output tensor.
+    DataType node_data_type = _current_input->info().data_type();
+    if(_auto_fp16)
+    {
+        node_data_type = decide_node_precision(_current_node.get(), _current_input->info(), _current_hints);
+        if(_current_output != nullptr && _current_output->info().data_type() != DataType::UNKNOWN)
+        {
+            node_data_type = _current_output->info().data_type();
+        }
+    }
+    const bool needs_convert = (node_data_type != _current_input->info().data_type());
+
     //Automatic output configuration ?
+    bool is_auto_output = false;
     if(_current_output == nullptr)
     {
         _tensors.push_back(arm_compute::support::cpp14::make_unique<Tensor>(TensorInfo()));
         _current_output = _tensors.back().get();
+        is_auto_output  = true;
     }
 
-    // If either the writer or reader node needs OpenCL then use OpenCL memory:
-    if((_next_hints.target_hint() == TargetHint::OPENCL || _current_hints.target_hint() == TargetHint::OPENCL))
+    // If either the writer or reader node needs OpenCL then use OpenCL memory: CL buffers are
+    // allocated CL_MEM_ALLOC_HOST_PTR, so on shared-memory devices mapping the boundary tensor
+    // for the NEON side is a pointer handoff rather than a copy
+    const TargetHint output_target = (_next_hints.target_hint() == TargetHint::OPENCL || _current_hints.target_hint() == TargetHint::OPENCL) ? TargetHint::OPENCL : TargetHint::NEON;
+    if(output_target == TargetHint::OPENCL || _current_hints.target_hint() == TargetHint::OPENCL)
     {
-        _current_output->set_target(TargetHint::OPENCL);
+        _uses_opencl = true;
+    }
+
+    // Run in-place capable nodes on their input buffer when the output is an auto-configured
+    // temporary on the same target, halving the live footprint of element-wise layers
+    if(is_auto_output && _current_node->supports_in_place() && _current_input->target() == output_target && !needs_convert)
+    {
+        _current_output->share_tensor_of(*_current_input);
     }
     else
     {
-        _current_output->set_target(TargetHint::NEON);
+        _current_output->set_target(output_target);
+        // Auto-configured intermediates are invisible to the user, so their backing memory
+        // can be pooled and re-used once their last reader has run
+        if(is_auto_output)
+        {
+            manage_tensor(_current_output);
+        }
     }
 
-    // Update ctx and instantiate node
-    _ctx.hints()                                 = _current_hints;
-    std::unique_ptr<arm_compute::IFunction> func = _current_node->instantiate_node(_ctx, _current_input->tensor(), _current_output->tensor());
-    _current_input->allocate();
+    // Pipelined mode: at the first target transition, route the consumer through a staging
+    // copy of the boundary tensor so that both segments can process different frames at once
+    bool staged_transition = false;
+    if(_pipelining && _split_stage < 0 && _current_input != _graph_input.get() && _previous_hints.target_hint() != _current_hints.target_hint())
+    {
+        _tensors.push_back(arm_compute::support::cpp14::make_unique<Tensor>(TensorInfo(_current_input->info())));
+        Tensor *staging = _tensors.back().get();
+        staging->set_target(_current_hints.target_hint());
+        staging->allocate();
+        _pipeline.push_back({ _current_input, staging, arm_compute::support::cpp14::make_unique<TensorCopyFunction>(_current_input, staging), "TensorCopy", false });
+        _split_stage      = static_cast<int>(_pipeline.size());
+        _current_input    = staging;
+        staged_transition = true;
+    }
 
-    // Map input if needed
-    if(_current_input->target() == TargetHint::OPENCL)
+    // Map input if needed (the staging copy of a pipelined transition maps internally)
+    if(!staged_transition && _current_input->target() == TargetHint::OPENCL)
     {
         if(_previous_hints.target_hint() == TargetHint::NEON)
         {
             ARM_COMPUTE_ERROR_ON(_current_hints.target_hint() == TargetHint::NEON);
-            _pipeline.push_back({ _current_input, _current_input, arm_compute::support::cpp14::make_unique<CLUnmap>(_current_input) });
+            _pipeline.push_back({ _current_input, _current_input, arm_compute::support::cpp14::make_unique<CLUnmap>(_current_input), "CLUnmap", true });
         }
         if(_current_hints.target_hint() == TargetHint::NEON)
         {
             ARM_COMPUTE_ERROR_ON(_previous_hints.target_hint() == TargetHint::NEON);
-            _pipeline.push_back({ _current_input, _current_input, arm_compute::support::cpp14::make_unique<CLMap>(_current_input, true) });
+            _pipeline.push_back({ _current_input, _current_input, arm_compute::support::cpp14::make_unique<CLMap>(_current_input, true), "CLMap", false });
         }
     }
 
-    _pipeline.push_back({ _current_input, _current_output, std::move(func) });
+    // Hybrid precision: at an F16 island boundary, route the node through a converted copy of
+    // its input. The conversion runs on this node's target; the map handling above has already
+    // brought the boundary tensor into that target's address space.
+    if(needs_convert)
+    {
+        const TensorInfo &in_info = _current_input->info();
+        _tensors.push_back(arm_compute::support::cpp14::make_unique<Tensor>(TensorInfo(in_info.tensor_shape(), in_info.num_channels(), node_data_type, in_info.fixed_point_position())));
+        Tensor *converted = _tensors.back().get();
+        converted->set_target(_current_hints.target_hint());
+        converted->allocate();
+        _pipeline.push_back({ _current_input, converted, instantiate_depth_convert(_current_input, converted), "DepthConvert", _current_hints.target_hint() == TargetHint::OPENCL });
+        _current_input = converted;
+        ARM_COMPUTE_LOG("Inserted " << ((node_data_type == DataType::F16) ? "F32 -> F16" : "F16 -> F32") << " conversion at an island boundary");
+    }
+
+    // Update ctx and instantiate node
+    _ctx.hints()                                 = _current_hints;
+    std::unique_ptr<arm_compute::IFunction> func = _current_node->instantiate_node(_ctx, _current_input->tensor(), _current_output->tensor());
+
+    _pipeline.push_back({ _current_input, _current_output, std::move(func), _current_node->name(), _current_hints.target_hint() == TargetHint::OPENCL });
+
+    // Resolve a cut point placed after this node: the split lies between this stage and
+    // its consumers' stages, including any map or convert stage the consumers need
+    if(!_pending_cut_name.empty())
+    {
+        _cut_points[_pending_cut_name] = { _pipeline.size(), _current_output };
+        _pending_cut_name.clear();
+    }
+
+    // Remember which constant tensors the stage reads, so that the weights prefetch can
+    // issue readahead for them one stage ahead of their use
+    auto constants = _current_node->retained_constants();
+    if(!constants.empty())
+    {
+        _stage_constants[_pipeline.size() - 1] = std::move(constants);
+    }
 
     _current_input  = _current_output;
     _current_output = nullptr;
@@ -154,6 +866,292 @@ void Graph::Private::configure(GraphHints _next_hints)
     std::swap(_current_hints, _next_hints);
 }
 
+void Graph::Private::manage_tensor(Tensor *tensor)
+{
+    if(tensor->target() == TargetHint::OPENCL)
+    {
+        auto *cl_tensor = dynamic_cast<arm_compute::CLTensor *>(tensor->tensor());
+        ARM_COMPUTE_ERROR_ON(cl_tensor == nullptr);
+        if(_mm_cl == nullptr)
+        {
+            _cl_allocator = arm_compute::support::cpp14::make_unique<arm_compute::CLBufferAllocator>();
+            _mm_cl        = std::make_shared<arm_compute::MemoryManagerOnDemand>(std::make_shared<arm_compute::BlobLifetimeManager>(), std::make_shared<arm_compute::PoolManager>());
+        }
+        auto group = std::make_shared<arm_compute::CLMemoryGroup>(_mm_cl);
+        group->manage(cl_tensor);
+        _managed_tensors[tensor->tensor()] = { std::move(group), _mm_cl.get() };
+    }
+    else
+    {
+        auto *ne_tensor = dynamic_cast<arm_compute::Tensor *>(tensor->tensor());
+        ARM_COMPUTE_ERROR_ON(ne_tensor == nullptr);
+        if(_mm_neon == nullptr)
+        {
+            // Offset-based placement: every group's tensors are carved from one contiguous
+            // arena, and consecutive layers keep reacquiring the same hot arenas (see
+            // @ref PoolManager), instead of scattering activations over per-size blobs.
+            // OpenCL stays on the blob manager as cl_mem handles cannot be offset
+            _mm_neon = std::make_shared<arm_compute::MemoryManagerOnDemand>(std::make_shared<arm_compute::OffsetLifetimeManager>(), std::make_shared<arm_compute::PoolManager>());
+        }
+        auto group = std::make_shared<arm_compute::MemoryGroup>(_mm_neon);
+        group->manage(ne_tensor);
+        _managed_tensors[tensor->tensor()] = { std::move(group), _mm_neon.get() };
+    }
+}
+
+void Graph::Private::plan_memory()
+{
+    _stage_acquires.assign(_pipeline.size(), std::vector<arm_compute::IMemoryGroup *>());
+    _stage_releases.assign(_pipeline.size(), std::vector<arm_compute::IMemoryGroup *>());
+
+    // Derive each managed tensor's lifetime from the stage execution order: its memory is
+    // needed from the stage that produces it until the last stage that reads it (in-place
+    // aliases resolve to the same backing tensor and extend the lifetime accordingly)
+    std::map<arm_compute::IMemoryGroup *, std::pair<size_t, size_t>> spans;
+    for(size_t i = 0; i < _pipeline.size(); ++i)
+    {
+        for(auto *tensor : { _pipeline[i]._input, _pipeline[i]._output })
+        {
+            const auto it = _managed_tensors.find(tensor->tensor());
+            if(it == _managed_tensors.end())
+            {
+                continue;
+            }
+            auto *group        = it->second._group.get();
+            const auto span_it = spans.find(group);
+            if(span_it == spans.end())
+            {
+                spans[group] = std::make_pair(i, i);
+            }
+            else
+            {
+                span_it->second.second = i;
+            }
+        }
+    }
+    for(const auto &span : spans)
+    {
+        _stage_acquires[span.second.first].push_back(span.first);
+        _stage_releases[span.second.second].push_back(span.first);
+    }
+
+    // Size each manager's pool count to the maximum number of simultaneously live groups,
+    // so that acquiring a pool at run time never blocks
+    std::map<arm_compute::MemoryManagerOnDemand *, unsigned int> live;
+    std::map<arm_compute::MemoryManagerOnDemand *, unsigned int> peak_live;
+    for(const auto &managed : _managed_tensors)
+    {
+        live[managed.second._memory_manager]      = 0;
+        peak_live[managed.second._memory_manager] = 1;
+    }
+    auto manager_of = [&](arm_compute::IMemoryGroup * group) -> arm_compute::MemoryManagerOnDemand *
+    {
+        for(const auto &managed : _managed_tensors)
+        {
+            if(managed.second._group.get() == group)
+            {
+                return managed.second._memory_manager;
+            }
+        }
+        ARM_COMPUTE_ERROR("Memory group is not tracked");
+        return nullptr;
+    };
+    for(size_t i = 0; i < _pipeline.size(); ++i)
+    {
+        for(auto *group : _stage_acquires[i])
+        {
+            auto *mm = manager_of(group);
+            peak_live[mm] = std::max(peak_live[mm], ++live[mm]);
+        }
+        for(auto *group : _stage_releases[i])
+        {
+            --live[manager_of(group)];
+        }
+    }
+
+    // When both segments of a pipelined graph run concurrently, each can hold its own peak
+    const unsigned int concurrency = (_pipelining && _split_stage >= 0) ? 2 : 1;
+    if(_mm_neon != nullptr)
+    {
+        _mm_neon->set_allocator(&_neon_allocator);
+        _mm_neon->set_num_pools(peak_live[_mm_neon.get()] * concurrency);
+        _mm_neon->finalize();
+    }
+    if(_mm_cl != nullptr)
+    {
+        _mm_cl->set_allocator(_cl_allocator.get());
+        _mm_cl->set_num_pools(peak_live[_mm_cl.get()] * concurrency);
+        _mm_cl->finalize();
+    }
+}
+
+void Graph::Private::prefetch_constants(const std::vector<arm_compute::ITensor *> &constants) const
+{
+    const uintptr_t page_mask = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE)) - 1;
+    for(arm_compute::ITensor *constant : constants)
+    {
+        // Only host-backed tensors can be advised; released or OpenCL-backed ones are skipped
+        if(dynamic_cast<arm_compute::Tensor *>(constant) == nullptr || constant->buffer() == nullptr)
+        {
+            continue;
+        }
+        const uintptr_t addr  = reinterpret_cast<uintptr_t>(constant->buffer());
+        const uintptr_t start = addr & ~page_mask;
+        madvise(reinterpret_cast<void *>(start), addr + constant->info()->total_size() - start, MADV_WILLNEED);
+    }
+}
+
+bool Graph::Private::frame_abandoned() const
+{
+    if(_cancelled.load(std::memory_order_relaxed))
+    {
+        return true;
+    }
+    return _frame_deadline != std::chrono::steady_clock::time_point() && std::chrono::steady_clock::now() >= _frame_deadline;
+}
+
+bool Graph::Private::execute_stages(size_t first, size_t last)
+{
+    // Start paging in the first weight-bearing stage's constants up front: madvise returns
+    // once the readahead is queued, so all its page faults are batched into one request
+    if(_weights_prefetch)
+    {
+        const auto head = _stage_constants.lower_bound(first);
+        if(head != _stage_constants.end() && head->first < last)
+        {
+            prefetch_constants(head->second);
+        }
+    }
+
+    for(size_t i = first; i < last; ++i)
+    {
+        // A cancelled or over-deadline frame is dropped between stages, where no memory
+        // group is held; its remaining stages never run
+        if(frame_abandoned())
+        {
+            return false;
+        }
+        for(auto *group : _stage_acquires[i])
+        {
+            group->acquire();
+        }
+        // Overlap flash latency with compute: while this stage runs, the kernel reads ahead
+        // the weight pages of the next stage that has any
+        if(_weights_prefetch)
+        {
+            const auto next = _stage_constants.upper_bound(i);
+            if(next != _stage_constants.end() && next->first < last)
+            {
+                prefetch_constants(next->second);
+            }
+        }
+        if(_profiling)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            _pipeline[i]._function->run();
+            // OpenCL kernels are enqueued asynchronously: wait for them so the measured
+            // wall time includes the device execution time of this stage
+            if(_pipeline[i]._cl_stage)
+            {
+                arm_compute::CLScheduler::get().sync();
+            }
+            record_stage_time(i, start, std::chrono::steady_clock::now());
+        }
+        else
+        {
+            _pipeline[i]._function->run();
+        }
+        for(auto *group : _stage_releases[i])
+        {
+            group->release();
+        }
+    }
+    return true;
+}
+
+void Graph::Private::record_stage_time(size_t stage, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+    const double start_us = std::chrono::duration<double, std::micro>(start - _trace_epoch).count();
+    const double dur_us   = std::chrono::duration<double, std::micro>(end - start).count();
+
+    // The two segments of a pipelined graph record concurrently
+    std::lock_guard<std::mutex> lock(_profile_mutex);
+    if(_profiles.size() != _pipeline.size())
+    {
+        _profiles.resize(_pipeline.size());
+        for(size_t i = 0; i < _pipeline.size(); ++i)
+        {
+            std::stringstream shape;
+            shape << _pipeline[i]._output->info().tensor_shape();
+            _profiles[i] = { _pipeline[i]._name, shape.str(), 0, 0.0, 0.0 };
+        }
+    }
+    GraphStageProfile &profile = _profiles[stage];
+    ++profile.runs;
+    profile.total_time_us += dur_us;
+    profile.last_time_us = dur_us;
+
+    const int tid = (_pipelining && _split_stage >= 0 && stage >= static_cast<size_t>(_split_stage)) ? 1 : 0;
+    _trace.push_back({ stage, tid, start_us, dur_us });
+}
+
+void Graph::Private::run_pipelined()
+{
+    const size_t split = static_cast<size_t>(_split_stage);
+
+    // Whether the staging tensor holds a frame the second segment has not processed yet
+    bool frame_staged = false;
+    while(true)
+    {
+        // A cancelled graph drops the staged frame and stops feeding new ones
+        if(_cancelled.load(std::memory_order_relaxed))
+        {
+            break;
+        }
+
+        const bool have_input = _graph_input->call_accessor();
+
+        // Process the staged frame N through the second segment while this thread pushes
+        // frame N+1 through the first one
+        std::thread back_half;
+        if(frame_staged)
+        {
+            auto *graph_scheduler = _ctx.scheduler();
+            back_half             = std::thread([this, graph_scheduler]()
+            {
+                arm_compute::Scheduler::bind_to_thread(graph_scheduler);
+                arm_compute::IScheduler::set_caller_priority(_priority);
+                arm_compute::IScheduler::set_cancellation_flag(&_cancelled);
+                execute_stages(static_cast<size_t>(_split_stage), _pipeline.size());
+                arm_compute::IScheduler::set_cancellation_flag(nullptr);
+                arm_compute::IScheduler::set_caller_priority(arm_compute::IScheduler::Priority::Normal);
+                arm_compute::Scheduler::bind_to_thread(nullptr);
+            });
+        }
+        if(have_input)
+        {
+            // All stages up to, but excluding, the staging copy
+            execute_stages(0, split - 1);
+        }
+
+        bool output_ok = true;
+        if(frame_staged)
+        {
+            back_half.join();
+            // An abandoned frame holds partial results: do not deliver it
+            output_ok = !_cancelled.load(std::memory_order_relaxed) && _graph_output->call_accessor();
+        }
+        if(!have_input || !output_ok)
+        {
+            break;
+        }
+
+        // Stage the just-produced frame across the boundary for the next iteration
+        execute_stages(split - 1, split);
+        frame_staged = true;
+    }
+}
+
 void Graph::add_node(std::unique_ptr<INode> node)
 {
     ARM_COMPUTE_ERROR_ON_MSG(_pimpl->_graph_input == nullptr, "The graph's input must be set before the first node is added");
@@ -162,11 +1160,18 @@ void Graph::add_node(std::unique_ptr<INode> node)
 
     GraphHints _next_hints = _pimpl->_next_hints;
     _next_hints.set_target_hint(node->override_target_hint(_pimpl->_next_hints.target_hint()));
-    ARM_COMPUTE_ERROR_ON(_next_hints.target_hint() == TargetHint::DONT_CARE);
+    // Give the pending node a chance to absorb the new one (e.g. convolution + activation),
+    // so that both operations run as a single pipeline stage. A pending cut point blocks
+    // fusion, so the marked node's own result is what run_to() exposes.
+    if(_pimpl->_current_node != nullptr && _pimpl->_pending_cut_name.empty() && _next_hints.target_hint() == _pimpl->_current_hints.target_hint() && _pimpl->_current_node->try_fuse(node.get()))
+    {
+        ARM_COMPUTE_LOG("Fused node into the preceding one");
+        return;
+    }
     if(_pimpl->_current_node)
     {
         //Finalize the previous Node:
-        _pimpl->configure(_pimpl->_next_hints);
+        _pimpl->configure(node.get(), _pimpl->_next_hints);
     }
     else
     {
@@ -195,12 +1200,34 @@ void Graph::add_tensor(std::unique_ptr<Tensor> tensor)
         // Else it will be the output of the Graph
         ARM_COMPUTE_ERROR_ON(_pimpl->_graph_output != nullptr);
         ARM_COMPUTE_ERROR_ON(_pimpl->_current_node == nullptr);
-        _pimpl->_graph_output   = std::move(tensor);
-        _pimpl->_current_output = _pimpl->_graph_output.get();
+        _pimpl->_graph_output = std::move(tensor);
+        if(_pimpl->_num_sub_batches > 1)
+        {
+            // The last node writes a sub-batch sized tensor; its slices are scattered into the
+            // full-batch output the accessor reads
+            _pimpl->_tensors.push_back(arm_compute::support::cpp14::make_unique<Tensor>(TensorInfo()));
+            Tensor *sub_output      = _pimpl->_tensors.back().get();
+            _pimpl->_current_output = sub_output;
+            _pimpl->configure(nullptr, _pimpl->_current_hints);
+            sub_output->allocate();
+
+            const TensorInfo &sub_info  = sub_output->info();
+            const size_t      batch_dim = sub_info.num_dimensions() - 1;
+            TensorShape       full_shape = sub_info.tensor_shape();
+            full_shape.set(batch_dim, sub_info.dimension(batch_dim) * _pimpl->_num_sub_batches);
+            _pimpl->_graph_output->set_info(TensorInfo(full_shape, sub_info.num_channels(), sub_info.data_type(), sub_info.fixed_point_position()));
+            _pimpl->_graph_output->set_target(sub_output->target());
+            _pimpl->_graph_output->allocate();
+            _pimpl->_pipeline.push_back({ sub_output, _pimpl->_graph_output.get(), arm_compute::support::cpp14::make_unique<BatchSliceCopyFunction>(_pimpl->_graph_output.get(), sub_output, false), "BatchScatter", false });
+        }
+        else
+        {
+            _pimpl->_current_output = _pimpl->_graph_output.get();
 
-        // Finalize the graph by configuring the last Node of the graph:
-        _pimpl->configure(_pimpl->_current_hints); // Ignore _next_hint as this is the last node, and just use the same hint as before this node.
-        _pimpl->_graph_output->allocate();
+            // Finalize the graph by configuring the last Node of the graph:
+            _pimpl->configure(nullptr, _pimpl->_current_hints); // Ignore _next_hint as this is the last node, and just use the same hint as before this node.
+            _pimpl->_graph_output->allocate();
+        }
     }
 }
 
@@ -242,3 +1269,9 @@ Graph &arm_compute::graph::operator<<(Graph &graph, ConvolutionMethodHint conv_m
     graph.hints().set_convolution_method_hint(conv_method_hint);
     return graph;
 }
+
+Graph &arm_compute::graph::operator<<(Graph &graph, PrecisionHint precision_hint)
+{
+    graph.hints().set_precision_hint(precision_hint);
+    return graph;
+}
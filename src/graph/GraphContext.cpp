@@ -25,8 +25,8 @@
 
 using namespace arm_compute::graph;
 
-GraphHints::GraphHints(TargetHint target_hint, ConvolutionMethodHint conv_method_hint)
-    : _target_hint(target_hint), _convolution_method_hint(conv_method_hint)
+GraphHints::GraphHints(TargetHint target_hint, ConvolutionMethodHint conv_method_hint, float cooperative_ratio)
+    : _target_hint(target_hint), _convolution_method_hint(conv_method_hint), _cooperative_ratio(cooperative_ratio), _accumulate_precision(AccumulatePrecision::REDUCED), _precision_hint(PrecisionHint::DONT_CARE)
 {
 }
 
@@ -50,6 +50,36 @@ ConvolutionMethodHint GraphHints::convolution_method_hint() const
     return _convolution_method_hint;
 }
 
+void GraphHints::set_cooperative_ratio(float cooperative_ratio)
+{
+    _cooperative_ratio = cooperative_ratio;
+}
+
+float GraphHints::cooperative_ratio() const
+{
+    return _cooperative_ratio;
+}
+
+void GraphHints::set_accumulate_precision(AccumulatePrecision accumulate_precision)
+{
+    _accumulate_precision = accumulate_precision;
+}
+
+AccumulatePrecision GraphHints::accumulate_precision() const
+{
+    return _accumulate_precision;
+}
+
+void GraphHints::set_precision_hint(PrecisionHint precision_hint)
+{
+    _precision_hint = precision_hint;
+}
+
+PrecisionHint GraphHints::precision_hint() const
+{
+    return _precision_hint;
+}
+
 GraphContext::GraphContext()
     : _hints()
 {
@@ -63,4 +93,14 @@ GraphHints &GraphContext::hints()
 const GraphHints &GraphContext::hints() const
 {
     return _hints;
+}
+
+void GraphContext::set_scheduler(arm_compute::IScheduler *scheduler)
+{
+    _scheduler = scheduler;
+}
+
+arm_compute::IScheduler *GraphContext::scheduler() const
+{
+    return _scheduler;
 }
\ No newline at end of file
@@ -30,6 +30,38 @@
 
 using namespace arm_compute::graph;
 
+bool INode::supports_in_place() const
+{
+    return false;
+}
+
+bool INode::supports_fp16() const
+{
+    return false;
+}
+
+void INode::release_constant_data()
+{
+    // By default nothing can be released
+}
+
+std::vector<ITensor *> INode::retained_constants()
+{
+    // By default there is nothing to prefetch
+    return {};
+}
+
+bool INode::try_fuse(INode *next)
+{
+    ARM_COMPUTE_UNUSED(next);
+    return false;
+}
+
+float INode::estimated_ops(const TensorInfo &input) const
+{
+    return static_cast<float>(input.tensor_shape().total_size());
+}
+
 TargetHint INode::override_target_hint(TargetHint target_hint) const
 {
     if(target_hint == TargetHint::OPENCL && !opencl_is_available())
@@ -43,7 +75,6 @@ TargetHint INode::override_target_hint(TargetHint target_hint) const
 }
 GraphHints INode::node_override_hints(GraphHints hints) const
 {
-    TargetHint target_hint = hints.target_hint();
-    hints.set_target_hint((target_hint == TargetHint::DONT_CARE) ? TargetHint::NEON : target_hint);
+    // DONT_CARE is kept: the graph resolves it through its placement cost model
     return hints;
 }
@@ -60,7 +60,8 @@ Tensor::Tensor(Tensor &&src) noexcept
     : _target(src._target),
       _info(std::move(src._info)),
       _accessor(std::move(src._accessor)),
-      _tensor(std::move(src._tensor))
+      _tensor(std::move(src._tensor)),
+      _alias(src._alias)
 {
 }
 
@@ -87,7 +88,7 @@ bool Tensor::call_accessor()
 
 ITensor *Tensor::tensor()
 {
-    return _tensor.get();
+    return (_alias != nullptr) ? _alias : _tensor.get();
 }
 
 const TensorInfo &Tensor::info() const
@@ -97,6 +98,11 @@ const TensorInfo &Tensor::info() const
 
 ITensor *Tensor::set_target(TargetHint target)
 {
+    if(_alias != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON(target != _target);
+        return _alias;
+    }
     if(_tensor != nullptr)
     {
         ARM_COMPUTE_ERROR_ON(target != _target);
@@ -121,6 +127,11 @@ ITensor *Tensor::set_target(TargetHint target)
 
 void Tensor::allocate()
 {
+    // Aliases borrow the backing memory of another tensor
+    if(_alias != nullptr)
+    {
+        return;
+    }
     ARM_COMPUTE_ERROR_ON_NULLPTR(_tensor.get());
     switch(_target)
     {
@@ -148,3 +159,13 @@ TargetHint Tensor::target() const
 {
     return _target;
 }
+
+void Tensor::share_tensor_of(Tensor &other)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(other.tensor() == nullptr, "Tensor to be shared has not been initialized");
+    ARM_COMPUTE_ERROR_ON(_tensor != nullptr);
+
+    _alias  = other.tensor();
+    _target = other.target();
+    _info   = other._info;
+}
@@ -68,6 +68,26 @@ ActivationLayer::ActivationLayer(const ActivationLayerInfo activation_info)
 {
 }
 
+bool ActivationLayer::supports_in_place() const
+{
+    return true;
+}
+
+const ActivationLayerInfo &ActivationLayer::activation_info() const
+{
+    return _activation_info;
+}
+
+const char *ActivationLayer::name() const
+{
+    return "ActivationLayer";
+}
+
+bool ActivationLayer::supports_fp16() const
+{
+    return true;
+}
+
 std::unique_ptr<arm_compute::IFunction> ActivationLayer::instantiate_node(GraphContext &ctx, ITensor *input, ITensor *output)
 {
     std::unique_ptr<arm_compute::IFunction> func;
@@ -24,6 +24,8 @@
 #include "arm_compute/graph/nodes/BatchNormalizationLayer.h"
 
 #include "arm_compute/core/Logger.h"
+#include "arm_compute/graph/FusedActivation.h"
+#include "arm_compute/graph/nodes/ActivationLayer.h"
 #include "arm_compute/runtime/CL/CLTensor.h"
 #include "arm_compute/runtime/CL/functions/CLBatchNormalizationLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEBatchNormalizationLayer.h"
@@ -67,6 +69,27 @@ std::unique_ptr<arm_compute::IFunction> instantiate<TargetHint::NEON>(ITensor *i
 }
 } // namespace
 
+bool BatchNormalizationLayer::try_fuse(INode *next)
+{
+    const auto *act_node = dynamic_cast<const ActivationLayer *>(next);
+    if(act_node == nullptr || _fused_act.enabled())
+    {
+        return false;
+    }
+    _fused_act = act_node->activation_info();
+    return true;
+}
+
+const char *BatchNormalizationLayer::name() const
+{
+    return "BatchNormalizationLayer";
+}
+
+bool BatchNormalizationLayer::supports_fp16() const
+{
+    return true;
+}
+
 std::unique_ptr<arm_compute::IFunction> BatchNormalizationLayer::instantiate_node(GraphContext &ctx, ITensor *input, ITensor *output)
 {
     std::unique_ptr<arm_compute::IFunction> func;
@@ -101,6 +124,14 @@ std::unique_ptr<arm_compute::IFunction> BatchNormalizationLayer::instantiate_nod
         ARM_COMPUTE_LOG("Instantiating NEBatchNormalizationLayer");
     }
 
+    // The batch normalization functions have no fused output stage, so an absorbed
+    // activation runs as an extra in-place pass over the output within the same stage
+    if(_fused_act.enabled())
+    {
+        func = arm_compute::support::cpp14::make_unique<FusedActivationFunction>(std::move(func), instantiate_in_place_activation(_target_hint, output, _fused_act));
+        ARM_COMPUTE_LOG("Appending in-place activation stage to the batch normalization");
+    }
+
     ARM_COMPUTE_LOG(" Data Type: " << input->info()->data_type()
                     << " Input shape: " << input->info()->tensor_shape()
                     << " Output shape: " << output->info()->tensor_shape()
@@ -23,16 +23,29 @@
  */
 #include "arm_compute/graph/nodes/ConvolutionLayer.h"
 
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Logger.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/graph/ConvolutionMethodTable.h"
+#include "arm_compute/graph/FusedActivation.h"
+#include "arm_compute/graph/nodes/ActivationLayer.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
 #include "arm_compute/runtime/CL/functions/CLConvolutionLayer.h"
 #include "arm_compute/runtime/CL/functions/CLDirectConvolutionLayer.h"
+#include "arm_compute/runtime/CL/functions/CLWinogradConvolutionLayer.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEDirectConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEWinogradConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
 #include "support/ToolchainSupport.h"
 #include "utils/GraphTypePrinter.h"
 #include "utils/TypePrinter.h"
 
+#include <chrono>
+#include <cstring>
+#include <string>
 #include <tuple>
 #include <vector>
 
@@ -67,7 +80,8 @@ TensorShape calculate_convolution_layer_output_shape(const TensorShape &input_sh
 
 // Instantiate GEMM based convolution layer
 template <typename ConvolutionType, typename TensorType, TargetHint target_hint>
-std::unique_ptr<arm_compute::IFunction> instantiate_function(ITensor *input, ITensor *weights, ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info)
+std::unique_ptr<arm_compute::IFunction> instantiate_function(ITensor *input, ITensor *weights, ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info,
+                                                             const ActivationLayerInfo &act_info)
 {
     auto conv = arm_compute::support::cpp14::make_unique<ConvolutionType>();
     conv->configure(
@@ -75,7 +89,7 @@ std::unique_ptr<arm_compute::IFunction> instantiate_function(ITensor *input, ITe
         dynamic_cast<TensorType *>(weights),
         dynamic_cast<TensorType *>(biases),
         dynamic_cast<TensorType *>(output),
-        conv_info, weights_info);
+        conv_info, weights_info, act_info);
     return std::move(conv);
 }
 
@@ -95,37 +109,148 @@ std::unique_ptr<arm_compute::IFunction> instantiate_direct_function(ITensor *inp
 
 template <TargetHint                    target_hint>
 std::unique_ptr<arm_compute::IFunction> instantiate(ITensor *input, ITensor *weights, ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info,
-                                                    ConvolutionMethodHint conv_method);
+                                                    ConvolutionMethodHint conv_method, const ActivationLayerInfo &act_info, AccumulatePrecision acc_precision = AccumulatePrecision::REDUCED);
 
 template <>
 std::unique_ptr<arm_compute::IFunction> instantiate<TargetHint::OPENCL>(ITensor *input, ITensor *weights, ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
                                                                         const WeightsInfo    &weights_info,
-                                                                        ConvolutionMethodHint conv_method)
+                                                                        ConvolutionMethodHint conv_method, const ActivationLayerInfo &act_info, AccumulatePrecision acc_precision)
 {
+    if(conv_method == ConvolutionMethodHint::WINOGRAD)
+    {
+        // The Winograd engine only covers 3x3 stride-1 F32 layers; anything else falls back to GEMM
+        const bool is_winograd_supported = weights->info()->dimension(0) == 3 && weights->info()->dimension(1) == 3
+                                           && conv_info.stride() == std::make_pair(1U, 1U)
+                                           && input->info()->data_type() == DataType::F32
+                                           && input->info()->num_dimensions() <= 3;
+        if(is_winograd_supported)
+        {
+            return instantiate_direct_function<arm_compute::CLWinogradConvolutionLayer, arm_compute::ICLTensor, TargetHint::OPENCL>(input, weights, biases, output, conv_info);
+        }
+        conv_method = ConvolutionMethodHint::GEMM;
+    }
     if(conv_method == ConvolutionMethodHint::GEMM)
     {
-        return instantiate_function<arm_compute::CLConvolutionLayer, arm_compute::ICLTensor, TargetHint::OPENCL>(input, weights, biases, output, conv_info, weights_info);
+        return instantiate_function<arm_compute::CLConvolutionLayer, arm_compute::ICLTensor, TargetHint::OPENCL>(input, weights, biases, output, conv_info, weights_info, act_info);
     }
     else
     {
-        return instantiate_direct_function<arm_compute::CLDirectConvolutionLayer, arm_compute::ICLTensor, TargetHint::OPENCL>(input, weights, biases, output, conv_info);
+        // The direct convolution is the only backend honouring the accumulation precision policy
+        auto conv = arm_compute::support::cpp14::make_unique<arm_compute::CLDirectConvolutionLayer>();
+        conv->configure(
+            dynamic_cast<arm_compute::ICLTensor *>(input),
+            dynamic_cast<arm_compute::ICLTensor *>(weights),
+            dynamic_cast<arm_compute::ICLTensor *>(biases),
+            dynamic_cast<arm_compute::ICLTensor *>(output),
+            conv_info, ActivationLayerInfo(), acc_precision);
+        return std::move(conv);
     }
 }
 
 template <>
 std::unique_ptr<arm_compute::IFunction> instantiate<TargetHint::NEON>(ITensor *input, ITensor *weights, ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
                                                                       const WeightsInfo    &weights_info,
-                                                                      ConvolutionMethodHint conv_method)
+                                                                      ConvolutionMethodHint conv_method, const ActivationLayerInfo &act_info, AccumulatePrecision acc_precision)
 {
+    // The NEON backends accumulate in the data type; a FULL request has nothing to select here
+    ARM_COMPUTE_UNUSED(acc_precision);
+    if(conv_method == ConvolutionMethodHint::WINOGRAD)
+    {
+        // The Winograd engine only covers 3x3 stride-1 F32 layers; anything else falls back to GEMM
+        const bool is_winograd_supported = weights->info()->dimension(0) == 3 && weights->info()->dimension(1) == 3
+                                           && conv_info.stride() == std::make_pair(1U, 1U)
+                                           && input->info()->data_type() == DataType::F32
+                                           && input->info()->num_dimensions() <= 3;
+        if(is_winograd_supported)
+        {
+            return instantiate_direct_function<arm_compute::NEWinogradConvolutionLayer, arm_compute::ITensor, TargetHint::NEON>(input, weights, biases, output, conv_info);
+        }
+        conv_method = ConvolutionMethodHint::GEMM;
+    }
     if(conv_method == ConvolutionMethodHint::GEMM)
     {
-        return instantiate_function<arm_compute::NEConvolutionLayer, arm_compute::ITensor, TargetHint::NEON>(input, weights, biases, output, conv_info, weights_info);
+        return instantiate_function<arm_compute::NEConvolutionLayer, arm_compute::ITensor, TargetHint::NEON>(input, weights, biases, output, conv_info, weights_info, act_info);
     }
     else
     {
         return instantiate_direct_function<arm_compute::NEDirectConvolutionLayer, arm_compute::ITensor, TargetHint::NEON>(input, weights, biases, output, conv_info);
     }
 }
+
+/** Checks if the backend GEMM convolution can apply @p act_info in its own output stage
+ *
+ * The NEON col2im stage fuses the RELU family for F32, the CL matrix multiply kernel
+ * fuses RELU/BOUNDED_RELU/LEAKY_RELU for non-fixed-point types.
+ */
+bool supports_fused_activation(TargetHint target_hint, const arm_compute::ITensorInfo *input, const ActivationLayerInfo &act_info)
+{
+    if(!act_info.enabled())
+    {
+        return false;
+    }
+    if(target_hint == TargetHint::OPENCL)
+    {
+        return !arm_compute::is_data_type_fixed_point(input->data_type())
+               && (act_info.activation() == ActivationLayerInfo::ActivationFunction::RELU
+                   || act_info.activation() == ActivationLayerInfo::ActivationFunction::BOUNDED_RELU
+                   || act_info.activation() == ActivationLayerInfo::ActivationFunction::LEAKY_RELU);
+    }
+    return input->data_type() == DataType::F32
+           && (act_info.activation() == ActivationLayerInfo::ActivationFunction::RELU
+               || act_info.activation() == ActivationLayerInfo::ActivationFunction::BOUNDED_RELU
+               || act_info.activation() == ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU);
+}
+
+/** Checks if the target's direct convolution covers the layer, i.e. whether AUTO has two
+ * candidates to measure at all. Mirrors the configure-time asserts of the direct backends.
+ */
+bool supports_direct_method(TargetHint target_hint, unsigned int conv_width, unsigned int conv_height, const PadStrideInfo &conv_info)
+{
+    if(conv_width != conv_height || (conv_width != 1 && conv_width != 3 && conv_width != 5))
+    {
+        return false;
+    }
+    if(std::get<0>(conv_info.stride()) != std::get<1>(conv_info.stride()))
+    {
+        return false;
+    }
+    const unsigned int stride = std::get<0>(conv_info.stride());
+    if(std::get<0>(conv_info.pad()) > (conv_width - 1) / 2 || std::get<1>(conv_info.pad()) > (conv_height - 1) / 2)
+    {
+        return false;
+    }
+    if(target_hint == TargetHint::OPENCL)
+    {
+        return (conv_width == 1) ? (stride <= 3) : (stride <= 2);
+    }
+    return stride <= 2;
+}
+
+/** Builds the shape class key of a layer for the measured decision table
+ *
+ * Channel counts are bucketed to the next power of two, so layers whose shapes only differ
+ * within a bucket share one measurement.
+ */
+std::string shape_class_key(TargetHint target_hint, unsigned int conv_width, unsigned int conv_height, const PadStrideInfo &conv_info, unsigned int ifm, unsigned int ofm)
+{
+    const auto bucket = [](unsigned int value)
+    {
+        unsigned int b = 1;
+        while(b < value)
+        {
+            b <<= 1;
+        }
+        return b;
+    };
+
+    using arm_compute::support::cpp11::to_string;
+
+    return std::string(target_hint == TargetHint::OPENCL ? "cl" : "neon")
+           + ",k" + to_string(conv_width) + "x" + to_string(conv_height)
+           + ",s" + to_string(std::get<0>(conv_info.stride()))
+           + ",c" + to_string(bucket(ifm))
+           + ",f" + to_string(bucket(ofm));
+}
 } // namespace
 
 /** Grouped Convolution function */
@@ -169,6 +294,294 @@ private:
     std::vector<std::unique_ptr<IFunction>> _convolutions;
 };
 
+/** Convolution function measuring the GEMM and the direct method on its first run
+ *
+ * Both candidates are configured against the same tensors. The first run warms each one up
+ * (performing its one-time weight reshapes), times it, records the winner in the measured
+ * decision table and releases the loser together with its intermediates; every later run
+ * executes the winner only. Both candidates compute the full output, so the first frame is
+ * valid regardless of which one wins.
+ */
+class AutoTuningConvolutionFunction final : public arm_compute::IFunction
+{
+public:
+    /** Constructor
+     *
+     * @param[in] gemm_function   GEMM candidate
+     * @param[in] direct_function Direct candidate
+     * @param[in] key             Shape class key the decision is recorded under
+     * @param[in] sync_queue      True when the candidates run on OpenCL and timing must sync the queue
+     */
+    AutoTuningConvolutionFunction(std::unique_ptr<IFunction> gemm_function, std::unique_ptr<IFunction> direct_function, std::string key, bool sync_queue)
+        : _gemm_function(std::move(gemm_function)), _direct_function(std::move(direct_function)), _chosen_function(nullptr), _key(std::move(key)), _sync_queue(sync_queue)
+    {
+    }
+    /** Prevent instances from being copy constructed */
+    AutoTuningConvolutionFunction(const AutoTuningConvolutionFunction &) = delete;
+    /** Prevent instances from being copy assigned */
+    AutoTuningConvolutionFunction &operator=(const AutoTuningConvolutionFunction &) = delete;
+
+    // Inherited methods overriden:
+    void run() override
+    {
+        if(_chosen_function == nullptr)
+        {
+            const double gemm_time   = time_function(_gemm_function.get());
+            const double direct_time = time_function(_direct_function.get());
+
+            const bool direct_wins = direct_time < gemm_time;
+            ConvolutionMethodTable::get().store(_key, direct_wins ? ConvolutionMethodHint::DIRECT : ConvolutionMethodHint::GEMM);
+
+            if(direct_wins)
+            {
+                _chosen_function = _direct_function.get();
+                _gemm_function   = nullptr;
+            }
+            else
+            {
+                _chosen_function = _gemm_function.get();
+                _direct_function = nullptr;
+            }
+
+            ARM_COMPUTE_LOG("Measured convolution methods for " << _key
+                            << ": GEMM " << gemm_time << "ms, direct " << direct_time << "ms"
+                            << std::endl);
+
+            // The last timed run already produced the output of this frame
+            return;
+        }
+
+        _chosen_function->run();
+    }
+
+private:
+    /** Times one run of @p function, excluding its one-time setup via a warm-up run */
+    double time_function(IFunction *function)
+    {
+        function->run();
+        if(_sync_queue)
+        {
+            arm_compute::CLScheduler::get().sync();
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        function->run();
+        if(_sync_queue)
+        {
+            arm_compute::CLScheduler::get().sync();
+        }
+
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    std::unique_ptr<IFunction> _gemm_function;   /**< GEMM candidate, released if it loses */
+    std::unique_ptr<IFunction> _direct_function; /**< Direct candidate, released if it loses */
+    IFunction                 *_chosen_function; /**< Winner, nullptr until the first run has measured */
+    std::string                _key;             /**< Shape class key of the layer */
+    bool                       _sync_queue;      /**< Whether timing must sync the OpenCL queue */
+};
+
+/** Convolution function splitting the output feature maps between the GPU and the CPU
+ *
+ * The GPU computes the first feature maps in place while NEON computes the remaining ones into a
+ * host tensor that is stitched into the output once both halves have finished. The CPU half reads
+ * input, weights and biases through mapped views of the OpenCL tensors: @ref CLTensorAllocator
+ * allocates with CL_MEM_ALLOC_HOST_PTR, so on a shared-memory SoC the mapping aliases the very
+ * pages the GPU reads and no copy of the inputs is made. Weights and biases are constant and stay
+ * mapped after the first run; the input is remapped every run, which also waits for its producer
+ * before the CPU half starts reading.
+ */
+class CooperativeConvolutionFunction final : public arm_compute::IFunction
+{
+public:
+    /** Default Constructor */
+    CooperativeConvolutionFunction()
+        : _gpu_function(nullptr), _cpu_function(nullptr), _gpu_weights(), _gpu_biases(), _gpu_output(), _cpu_input(), _cpu_weights(), _cpu_biases(), _cpu_output_view(), _cpu_output(),
+          _cl_input(nullptr), _cl_weights(nullptr), _cl_biases(nullptr), _cl_output(nullptr), _constants_mapped(false)
+    {
+    }
+    /** Default Destructor */
+    ~CooperativeConvolutionFunction() final = default;
+    /** Prevent instances from being copy constructed */
+    CooperativeConvolutionFunction(const CooperativeConvolutionFunction &) = delete;
+    /** Prevent instances from being copy assigned */
+    CooperativeConvolutionFunction &operator=(const CooperativeConvolutionFunction &) = delete;
+    /** Configures both halves of the convolution
+     *
+     * @param[in]  input            Input tensor, backed by OpenCL memory
+     * @param[in]  weights          Weights tensor, backed by OpenCL memory
+     * @param[in]  biases           Biases tensor, backed by OpenCL memory
+     * @param[out] output           Output tensor, backed by OpenCL memory
+     * @param[in]  gpu_ofm          Number of output feature maps computed on the GPU, in (0, ofm)
+     * @param[in]  conv_info        Convolution information (padding, stride, etc.)
+     * @param[in]  weights_info     Weights information
+     * @param[in]  conv_method_hint Hint that specifies which convolution layer method to use
+     * @param[in]  act_info         Activation to fuse in both halves' output stages
+     */
+    void configure(ITensor *input, ITensor *weights, ITensor *biases, ITensor *output, unsigned int gpu_ofm, const PadStrideInfo &conv_info, const WeightsInfo &weights_info,
+                   ConvolutionMethodHint conv_method_hint, const ActivationLayerInfo &act_info)
+    {
+        _cl_input   = dynamic_cast<arm_compute::ICLTensor *>(input);
+        _cl_weights = dynamic_cast<arm_compute::ICLTensor *>(weights);
+        _cl_biases  = dynamic_cast<arm_compute::ICLTensor *>(biases);
+        _cl_output  = dynamic_cast<arm_compute::ICLTensor *>(output);
+        ARM_COMPUTE_ERROR_ON_MSG(_cl_input == nullptr || _cl_weights == nullptr || _cl_biases == nullptr || _cl_output == nullptr,
+                                 "Cooperative convolution requires OpenCL backed tensors");
+
+        const TensorShape  output_shape = output->info()->tensor_shape();
+        const unsigned int ofm          = output_shape.z();
+        ARM_COMPUTE_ERROR_ON(gpu_ofm == 0 || gpu_ofm >= ofm);
+        const unsigned int cpu_ofm = ofm - gpu_ofm;
+
+        // Calculate the shapes of the two output feature map ranges
+        TensorShape gpu_output_shape = output_shape;
+        TensorShape cpu_output_shape = output_shape;
+        gpu_output_shape.set(2, gpu_ofm);
+        cpu_output_shape.set(2, cpu_ofm);
+        TensorShape gpu_weights_shape = weights->info()->tensor_shape();
+        TensorShape cpu_weights_shape = weights->info()->tensor_shape();
+        gpu_weights_shape.set(3, gpu_ofm);
+        cpu_weights_shape.set(3, cpu_ofm);
+
+        // GPU half: views of the first gpu_ofm feature maps, computed in place
+        _gpu_weights  = SubTensor(weights, gpu_weights_shape, Coordinates(), TargetHint::OPENCL);
+        _gpu_biases   = SubTensor(biases, TensorShape(gpu_ofm), Coordinates(), TargetHint::OPENCL);
+        _gpu_output   = SubTensor(output, gpu_output_shape, Coordinates(), TargetHint::OPENCL);
+        _gpu_function = instantiate<TargetHint::OPENCL>(input, _gpu_weights.tensor(), _gpu_biases.tensor(), _gpu_output.tensor(), conv_info, weights_info, conv_method_hint, act_info);
+
+        // CPU half: host views of the mapped OpenCL tensors, computed into an own host tensor
+        _cpu_input   = SubTensor(input, input->info()->tensor_shape(), Coordinates(), TargetHint::NEON);
+        _cpu_weights = SubTensor(weights, cpu_weights_shape, Coordinates(0, 0, 0, static_cast<int>(gpu_ofm)), TargetHint::NEON);
+        _cpu_biases  = SubTensor(biases, TensorShape(cpu_ofm), Coordinates(static_cast<int>(gpu_ofm)), TargetHint::NEON);
+        _cpu_output.allocator()->init(TensorInfo(cpu_output_shape, 1, output->info()->data_type(), output->info()->fixed_point_position()));
+        _cpu_function = instantiate<TargetHint::NEON>(_cpu_input.tensor(), _cpu_weights.tensor(), _cpu_biases.tensor(), &_cpu_output, conv_info, weights_info, conv_method_hint, act_info);
+        _cpu_output.allocator()->allocate();
+
+        // Host view of the feature maps the CPU half owns, used to stitch the output together
+        _cpu_output_view = SubTensor(output, cpu_output_shape, Coordinates(0, 0, static_cast<int>(gpu_ofm)), TargetHint::NEON);
+    }
+
+    // Inherited methods overriden:
+    void run() override
+    {
+        cl::CommandQueue &queue = arm_compute::CLScheduler::get().queue();
+
+        // The constants never change: map them once and keep them mapped
+        if(!_constants_mapped)
+        {
+            _cl_weights->map(queue, true);
+            _cl_biases->map(queue, true);
+            _constants_mapped = true;
+        }
+
+        // A blocking map waits for the input's producer before the CPU half starts reading
+        _cl_input->map(queue, true);
+
+        // Enqueue and flush the GPU half so it progresses while the CPU half runs
+        _gpu_function->run();
+        queue.flush();
+
+        _cpu_function->run();
+        arm_compute::CLScheduler::get().sync();
+
+        _cl_input->unmap(queue);
+
+        // Stitch the CPU half's feature maps into the output, one row at a time
+        _cl_output->map(queue, true);
+        arm_compute::Window win;
+        win.use_tensor_dimensions(_cpu_output.info()->tensor_shape());
+        win.set(arm_compute::Window::DimX, arm_compute::Window::Dimension(0, 1, 1));
+        const size_t row_size = _cpu_output.info()->dimension(0) * _cpu_output.info()->element_size();
+
+        arm_compute::Iterator src(&_cpu_output, win);
+        arm_compute::Iterator dst(_cpu_output_view.tensor(), win);
+        arm_compute::execute_window_loop(win, [&](const Coordinates & id)
+        {
+            ARM_COMPUTE_UNUSED(id);
+            std::memcpy(dst.ptr(), src.ptr(), row_size);
+        },
+        src, dst);
+        _cl_output->unmap(queue);
+    }
+
+private:
+    std::unique_ptr<arm_compute::IFunction> _gpu_function;     /**< Convolution computing the GPU's feature maps */
+    std::unique_ptr<arm_compute::IFunction> _cpu_function;     /**< Convolution computing the CPU's feature maps */
+    SubTensor                               _gpu_weights;      /**< OpenCL view of the GPU half's weights */
+    SubTensor                               _gpu_biases;       /**< OpenCL view of the GPU half's biases */
+    SubTensor                               _gpu_output;       /**< OpenCL view of the GPU half's output range */
+    SubTensor                               _cpu_input;        /**< Host view of the mapped input */
+    SubTensor                               _cpu_weights;      /**< Host view of the CPU half's weights */
+    SubTensor                               _cpu_biases;       /**< Host view of the CPU half's biases */
+    SubTensor                               _cpu_output_view;  /**< Host view of the CPU half's output range */
+    arm_compute::Tensor                     _cpu_output;       /**< Host tensor holding the CPU half's result */
+    arm_compute::ICLTensor                 *_cl_input;         /**< Input tensor, mapped while the CPU half reads it */
+    arm_compute::ICLTensor                 *_cl_weights;       /**< Weights tensor, kept mapped after the first run */
+    arm_compute::ICLTensor                 *_cl_biases;        /**< Biases tensor, kept mapped after the first run */
+    arm_compute::ICLTensor                 *_cl_output;        /**< Output tensor, mapped while stitching */
+    bool                                    _constants_mapped; /**< Whether weights and biases are currently mapped */
+};
+
+void ConvolutionLayer::release_constant_data()
+{
+    // Grouped convolutions hand sub-tensors of the weights to several functions; keep them
+    auto *ne_conv = dynamic_cast<arm_compute::NEConvolutionLayer *>(_conv_function);
+    auto *cl_conv = dynamic_cast<arm_compute::CLConvolutionLayer *>(_conv_function);
+    bool retained = true;
+    if(ne_conv != nullptr)
+    {
+        retained = ne_conv->original_weights_retained();
+    }
+    else if(cl_conv != nullptr)
+    {
+        retained = cl_conv->original_weights_retained();
+    }
+    if(retained)
+    {
+        return;
+    }
+
+    // The GEMM path folds the biases into the reshaped weight matrix, so both originals are dead
+    for(Tensor *tensor : { &_weights, &_biases })
+    {
+        auto *ne_tensor = dynamic_cast<arm_compute::Tensor *>(tensor->tensor());
+        auto *cl_tensor = dynamic_cast<arm_compute::CLTensor *>(tensor->tensor());
+        if(ne_tensor != nullptr)
+        {
+            ne_tensor->allocator()->free();
+        }
+        else if(cl_tensor != nullptr)
+        {
+            cl_tensor->allocator()->free();
+        }
+    }
+    ARM_COMPUTE_LOG("Released original convolution weights after baking");
+}
+
+std::vector<arm_compute::ITensor *> ConvolutionLayer::retained_constants()
+{
+    // Grouped convolutions read the weights through sub-tensors, which alias the same pages
+    std::vector<arm_compute::ITensor *> constants;
+    for(Tensor *tensor : { &_weights, &_biases })
+    {
+        if(tensor->tensor() != nullptr)
+        {
+            constants.push_back(tensor->tensor());
+        }
+    }
+    return constants;
+}
+
+const char *ConvolutionLayer::name() const
+{
+    return "ConvolutionLayer";
+}
+
+bool ConvolutionLayer::supports_fp16() const
+{
+    return true;
+}
+
 std::unique_ptr<arm_compute::IFunction> ConvolutionLayer::instantiate_node(GraphContext &ctx, ITensor *input, ITensor *output)
 {
     // Set weights and biases info
@@ -184,8 +597,33 @@ std::unique_ptr<arm_compute::IFunction> ConvolutionLayer::instantiate_node(Graph
     }
 
     std::unique_ptr<arm_compute::IFunction> func;
-    _target_hint                                 = ctx.hints().target_hint();
-    const ConvolutionMethodHint conv_method_hint = ctx.hints().convolution_method_hint();
+    _target_hint                           = ctx.hints().target_hint();
+    ConvolutionMethodHint conv_method_hint = ctx.hints().convolution_method_hint();
+    const AccumulatePrecision acc_precision = ctx.hints().accumulate_precision();
+
+    // Resolve the AUTO hint: use the recorded decision of the layer's shape class when there is
+    // one, otherwise measure both methods on the first run. Grouped and cooperative layers, and
+    // layers the direct backend does not cover, fall back to GEMM without measuring.
+    bool        measure_methods = false;
+    std::string method_key;
+    if(conv_method_hint == ConvolutionMethodHint::AUTO)
+    {
+        method_key = shape_class_key(_target_hint, _conv_width, _conv_height, _conv_info, input->info()->dimension(2), _ofm);
+
+        const float coop_ratio       = ctx.hints().cooperative_ratio();
+        const bool  coop_possible    = _target_hint == TargetHint::OPENCL && coop_ratio > 0.f && coop_ratio < 1.f;
+        ConvolutionMethodHint stored = ConvolutionMethodHint::GEMM;
+
+        if(ConvolutionMethodTable::get().lookup(method_key, stored))
+        {
+            conv_method_hint = stored;
+        }
+        else
+        {
+            measure_methods  = _num_groups == 1 && !coop_possible && supports_direct_method(_target_hint, _conv_width, _conv_height, _conv_info);
+            conv_method_hint = ConvolutionMethodHint::GEMM;
+        }
+    }
 
     // Check if the weights and biases are loaded
     bool weights_are_loaded = _weights.tensor() != nullptr;
@@ -201,18 +639,52 @@ std::unique_ptr<arm_compute::IFunction> ConvolutionLayer::instantiate_node(Graph
     // Output auto inizialitation if not yet initialized
     arm_compute::auto_init_if_empty(*output->info(), output_shape, 1, input->info()->data_type(), input->info()->fixed_point_position());
 
+    // Decide where an absorbed activation runs: in the GEMM output stage when the backend
+    // supports it, otherwise as an extra in-place pass over the convolution output. While
+    // measuring methods the activation stays out of the backends so both candidates match
+    const bool fuse_act_in_backend = conv_method_hint == ConvolutionMethodHint::GEMM && !measure_methods && supports_fused_activation(_target_hint, input->info(), _fused_act);
+    const ActivationLayerInfo backend_act = fuse_act_in_backend ? _fused_act : ActivationLayerInfo();
+
     // Create appropriate convolution function
     if(_num_groups == 1)
     {
-        func = instantiate_convolution(input, output, conv_method_hint);
-        ARM_COMPUTE_LOG("Instantiating CLConvolutionLayer");
+        // Split the output feature maps between the GPU and the CPU when a calibrated ratio was
+        // given; a fused activation must be expressible on both backends for the halves to match
+        const float gpu_ratio = ctx.hints().cooperative_ratio();
+        const auto  gpu_ofm   = static_cast<unsigned int>(gpu_ratio * _ofm + 0.5f);
+        if(_target_hint == TargetHint::OPENCL && gpu_ratio > 0.f && gpu_ratio < 1.f && gpu_ofm > 0 && gpu_ofm < _ofm
+           && (!backend_act.enabled() || supports_fused_activation(TargetHint::NEON, input->info(), backend_act)))
+        {
+            func = instantiate_cooperative_convolution(input, output, conv_method_hint, backend_act, gpu_ofm);
+            ARM_COMPUTE_LOG("Instantiating cooperative CL+NEON convolution");
+        }
+        else if(measure_methods)
+        {
+            auto gemm_func   = instantiate_convolution(input, output, ConvolutionMethodHint::GEMM, backend_act, acc_precision);
+            auto direct_func = instantiate_convolution(input, output, ConvolutionMethodHint::DIRECT, backend_act, acc_precision);
+            func             = arm_compute::support::cpp14::make_unique<AutoTuningConvolutionFunction>(std::move(gemm_func), std::move(direct_func), method_key,
+                                                                                                       _target_hint == TargetHint::OPENCL);
+            ARM_COMPUTE_LOG("Instantiating auto-tuning convolution for shape class " << method_key);
+        }
+        else
+        {
+            func           = instantiate_convolution(input, output, conv_method_hint, backend_act, acc_precision);
+            _conv_function = func.get();
+            ARM_COMPUTE_LOG("Instantiating CLConvolutionLayer");
+        }
     }
     else
     {
-        func = instantiate_grouped_convolution(input, output, conv_method_hint);
+        func = instantiate_grouped_convolution(input, output, conv_method_hint, backend_act, acc_precision);
         ARM_COMPUTE_LOG("Instantiating NEConvolutionLayer");
     }
 
+    if(_fused_act.enabled() && !fuse_act_in_backend)
+    {
+        func = arm_compute::support::cpp14::make_unique<FusedActivationFunction>(std::move(func), instantiate_in_place_activation(_target_hint, output, _fused_act));
+        ARM_COMPUTE_LOG("Appending in-place activation stage to the convolution");
+    }
+
     // Fill weights
     if(!weights_are_loaded)
     {
@@ -232,26 +704,49 @@ std::unique_ptr<arm_compute::IFunction> ConvolutionLayer::instantiate_node(Graph
                     << " PadStrideInfo: " << _conv_info
                     << " Groups: " << _num_groups
                     << " WeightsInfo: " << _weights_info
+                    << " Fused activation: " << (_fused_act.enabled() ? "true" : "false")
                     << std::endl);
 
     return func;
 }
 
-std::unique_ptr<arm_compute::IFunction> ConvolutionLayer::instantiate_convolution(ITensor *input, ITensor *output, ConvolutionMethodHint conv_method_hint)
+float ConvolutionLayer::estimated_ops(const TensorInfo &input) const
+{
+    unsigned int output_width  = 0;
+    unsigned int output_height = 0;
+    std::tie(output_width, output_height) = arm_compute::scaled_dimensions(input.dimension(0), input.dimension(1), _conv_width, _conv_height, _conv_info);
+    // Two operations (multiply and accumulate) per weight application
+    return 2.f * output_width * output_height * _ofm * _conv_width * _conv_height * (input.dimension(2) / _num_groups);
+}
+
+bool ConvolutionLayer::try_fuse(INode *next)
+{
+    const auto *act_node = dynamic_cast<const ActivationLayer *>(next);
+    if(act_node == nullptr || _fused_act.enabled())
+    {
+        return false;
+    }
+    _fused_act = act_node->activation_info();
+    return true;
+}
+
+std::unique_ptr<arm_compute::IFunction> ConvolutionLayer::instantiate_convolution(ITensor *input, ITensor *output, ConvolutionMethodHint conv_method_hint, const ActivationLayerInfo &act_info,
+                                                                                  AccumulatePrecision acc_precision)
 {
     std::unique_ptr<arm_compute::IFunction> func;
     if(_target_hint == TargetHint::OPENCL)
     {
-        func = instantiate<TargetHint::OPENCL>(input, _weights.tensor(), _biases.tensor(), output, _conv_info, _weights_info, conv_method_hint);
+        func = instantiate<TargetHint::OPENCL>(input, _weights.tensor(), _biases.tensor(), output, _conv_info, _weights_info, conv_method_hint, act_info, acc_precision);
     }
     else
     {
-        func = instantiate<TargetHint::NEON>(input, _weights.tensor(), _biases.tensor(), output, _conv_info, _weights_info, conv_method_hint);
+        func = instantiate<TargetHint::NEON>(input, _weights.tensor(), _biases.tensor(), output, _conv_info, _weights_info, conv_method_hint, act_info, acc_precision);
     }
     return func;
 }
 
-std::unique_ptr<arm_compute::IFunction> ConvolutionLayer::instantiate_grouped_convolution(ITensor *input, ITensor *output, ConvolutionMethodHint conv_method_hint)
+std::unique_ptr<arm_compute::IFunction> ConvolutionLayer::instantiate_grouped_convolution(ITensor *input, ITensor *output, ConvolutionMethodHint conv_method_hint, const ActivationLayerInfo &act_info,
+                                                                                          AccumulatePrecision acc_precision)
 {
     // Get tensor shapes
     TensorShape input_shape   = input->info()->tensor_shape();
@@ -307,11 +802,11 @@ std::unique_ptr<arm_compute::IFunction> ConvolutionLayer::instantiate_grouped_co
         // Instantiate convolution function
         if(_target_hint == TargetHint::OPENCL)
         {
-            func = instantiate<TargetHint::OPENCL>(_is[i].tensor(), _ws[i].tensor(), _bs[i].tensor(), _os[i].tensor(), _conv_info, _weights_info, conv_method_hint);
+            func = instantiate<TargetHint::OPENCL>(_is[i].tensor(), _ws[i].tensor(), _bs[i].tensor(), _os[i].tensor(), _conv_info, _weights_info, conv_method_hint, act_info, acc_precision);
         }
         else
         {
-            func = instantiate<TargetHint::NEON>(_is[i].tensor(), _ws[i].tensor(), _bs[i].tensor(), _os[i].tensor(), _conv_info, _weights_info, conv_method_hint);
+            func = instantiate<TargetHint::NEON>(_is[i].tensor(), _ws[i].tensor(), _bs[i].tensor(), _os[i].tensor(), _conv_info, _weights_info, conv_method_hint, act_info, acc_precision);
         }
 
         // Add convolution function to the list of convolutions for the grouped convolution
@@ -320,3 +815,11 @@ std::unique_ptr<arm_compute::IFunction> ConvolutionLayer::instantiate_grouped_co
 
     return std::move(grouped_conv);
 }
+
+std::unique_ptr<arm_compute::IFunction> ConvolutionLayer::instantiate_cooperative_convolution(ITensor *input, ITensor *output, ConvolutionMethodHint conv_method_hint,
+                                                                                              const ActivationLayerInfo &act_info, unsigned int gpu_ofm)
+{
+    auto coop_conv = arm_compute::support::cpp14::make_unique<CooperativeConvolutionFunction>();
+    coop_conv->configure(input, _weights.tensor(), _biases.tensor(), output, gpu_ofm, _conv_info, _weights_info, conv_method_hint, act_info);
+    return std::move(coop_conv);
+}
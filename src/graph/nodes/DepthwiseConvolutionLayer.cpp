@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/nodes/DepthwiseConvolutionLayer.h"
+
+#include "arm_compute/core/Logger.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/runtime/CL/CLTensor.h"
+#include "arm_compute/runtime/CL/functions/CLDepthwiseConvolution.h"
+#include "arm_compute/runtime/NEON/functions/NEDepthwiseConvolution.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "support/ToolchainSupport.h"
+#include "utils/TypePrinter.h"
+
+#include <tuple>
+
+using namespace arm_compute::graph;
+
+namespace
+{
+template <typename DepthwiseConvolutionType, typename TensorType, TargetHint target_hint>
+std::unique_ptr<arm_compute::IFunction> instantiate_function(ITensor *input, ITensor *weights, ITensor *biases, ITensor *output, const PadStrideInfo &conv_info)
+{
+    auto depthwise_conv = arm_compute::support::cpp14::make_unique<DepthwiseConvolutionType>();
+    depthwise_conv->configure(
+        dynamic_cast<TensorType *>(input),
+        dynamic_cast<TensorType *>(output),
+        dynamic_cast<TensorType *>(weights),
+        dynamic_cast<TensorType *>(biases),
+        conv_info);
+
+    return std::move(depthwise_conv);
+}
+
+template <TargetHint                    target_hint>
+std::unique_ptr<arm_compute::IFunction> instantiate(ITensor *input, ITensor *weights, ITensor *biases, ITensor *output, const PadStrideInfo &conv_info);
+
+template <>
+std::unique_ptr<arm_compute::IFunction> instantiate<TargetHint::OPENCL>(ITensor *input, ITensor *weights, ITensor *biases, ITensor *output, const PadStrideInfo &conv_info)
+{
+    // The 3x3 path convolves directly from the source tensor, anything else goes through im2col + GEMV
+    if(weights->info()->dimension(0) == 3 && weights->info()->dimension(1) == 3)
+    {
+        return instantiate_function<arm_compute::CLDepthwiseConvolution3x3, arm_compute::ICLTensor, TargetHint::OPENCL>(input, weights, biases, output, conv_info);
+    }
+    else
+    {
+        return instantiate_function<arm_compute::CLDepthwiseConvolution, arm_compute::ICLTensor, TargetHint::OPENCL>(input, weights, biases, output, conv_info);
+    }
+}
+
+template <>
+std::unique_ptr<arm_compute::IFunction> instantiate<TargetHint::NEON>(ITensor *input, ITensor *weights, ITensor *biases, ITensor *output, const PadStrideInfo &conv_info)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(weights->info()->dimension(0) != 3 || weights->info()->dimension(1) != 3, "Only 3x3 depthwise convolution is supported on NEON");
+    return instantiate_function<arm_compute::NEDepthwiseConvolution3x3, arm_compute::ITensor, TargetHint::NEON>(input, weights, biases, output, conv_info);
+}
+} // namespace
+
+const char *DepthwiseConvolutionLayer::name() const
+{
+    return "DepthwiseConvolutionLayer";
+}
+
+float DepthwiseConvolutionLayer::estimated_ops(const TensorInfo &input) const
+{
+    unsigned int output_width  = 0;
+    unsigned int output_height = 0;
+    std::tie(output_width, output_height) = arm_compute::scaled_dimensions(input.dimension(0), input.dimension(1), _conv_width, _conv_height, _conv_info);
+    // Two operations (multiply and accumulate) per weight application, one filter per input channel
+    return 2.f * output_width * output_height * input.dimension(2) * _conv_width * _conv_height;
+}
+
+std::vector<arm_compute::ITensor *> DepthwiseConvolutionLayer::retained_constants()
+{
+    std::vector<arm_compute::ITensor *> constants;
+    for(Tensor *tensor : { &_weights, &_biases })
+    {
+        if(tensor->tensor() != nullptr)
+        {
+            constants.push_back(tensor->tensor());
+        }
+    }
+    return constants;
+}
+
+std::unique_ptr<arm_compute::IFunction> DepthwiseConvolutionLayer::instantiate_node(GraphContext &ctx, ITensor *input, ITensor *output)
+{
+    // Set weights and biases info
+    if(_weights.tensor() == nullptr)
+    {
+        _weights.set_info(TensorInfo(TensorShape(_conv_width, _conv_height, input->info()->dimension(2)),
+                                     input->info()->num_channels(), input->info()->data_type(),
+                                     input->info()->fixed_point_position()));
+    }
+    if(_biases.tensor() == nullptr)
+    {
+        _biases.set_info(TensorInfo(TensorShape(input->info()->dimension(2)), input->info()->num_channels(), input->info()->data_type(), input->info()->fixed_point_position()));
+    }
+
+    std::unique_ptr<arm_compute::IFunction> func;
+    _target_hint = ctx.hints().target_hint();
+
+    // Check if the weights and biases are loaded
+    bool weights_are_loaded = _weights.tensor() != nullptr;
+    bool biases_are_loaded  = _biases.tensor() != nullptr;
+
+    // Set bias and weights target
+    _weights.set_target(_target_hint);
+    _biases.set_target(_target_hint);
+
+    // Calculate output shape
+    unsigned int output_width  = 0;
+    unsigned int output_height = 0;
+    std::tie(output_width, output_height) = arm_compute::scaled_dimensions(input->info()->dimension(0), input->info()->dimension(1), _conv_width, _conv_height, _conv_info);
+
+    TensorShape output_shape = input->info()->tensor_shape();
+    output_shape.set(0, output_width);
+    output_shape.set(1, output_height);
+
+    // Output auto inizialitation if not yet initialized
+    arm_compute::auto_init_if_empty(*output->info(), output_shape, 1, input->info()->data_type(), input->info()->fixed_point_position());
+
+    if(_target_hint == TargetHint::OPENCL)
+    {
+        func = instantiate<TargetHint::OPENCL>(input, _weights.tensor(), _biases.tensor(), output, _conv_info);
+        ARM_COMPUTE_LOG("Instantiating CLDepthwiseConvolution");
+    }
+    else
+    {
+        func = instantiate<TargetHint::NEON>(input, _weights.tensor(), _biases.tensor(), output, _conv_info);
+        ARM_COMPUTE_LOG("Instantiating NEDepthwiseConvolution");
+    }
+
+    // Fill weights
+    if(!weights_are_loaded)
+    {
+        _weights.allocate_and_fill_if_needed();
+    }
+    // Fill biases
+    if(!biases_are_loaded)
+    {
+        _biases.allocate_and_fill_if_needed();
+    }
+
+    ARM_COMPUTE_LOG(" Data Type: " << input->info()->data_type()
+                    << " Input Shape: " << input->info()->tensor_shape()
+                    << " Weights shape: " << _weights.info().tensor_shape()
+                    << " Biases Shape: " << _biases.info().tensor_shape()
+                    << " Output Shape: " << output->info()->tensor_shape()
+                    << " PadStrideInfo: " << _conv_info
+                    << std::endl);
+
+    return func;
+}
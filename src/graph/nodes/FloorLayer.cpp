@@ -62,6 +62,11 @@ std::unique_ptr<arm_compute::IFunction> instantiate<TargetHint::NEON>(ITensor *i
 }
 } // namespace
 
+const char *FloorLayer::name() const
+{
+    return "FloorLayer";
+}
+
 std::unique_ptr<arm_compute::IFunction> FloorLayer::instantiate_node(GraphContext &ctx, ITensor *input, ITensor *output)
 {
     std::unique_ptr<arm_compute::IFunction> func;
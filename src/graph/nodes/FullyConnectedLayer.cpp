@@ -84,6 +84,67 @@ std::unique_ptr<arm_compute::IFunction> instantiate<TargetHint::NEON>(ITensor *i
 }
 } // namespace
 
+float FullyConnectedLayer::estimated_ops(const TensorInfo &input) const
+{
+    // Two operations (multiply and accumulate) per weight of the layer
+    return 2.f * input.tensor_shape().total_size() * _num_neurons;
+}
+
+void FullyConnectedLayer::release_constant_data()
+{
+    auto *ne_fc   = dynamic_cast<arm_compute::NEFullyConnectedLayer *>(_fc_function);
+    auto *cl_fc   = dynamic_cast<arm_compute::CLFullyConnectedLayer *>(_fc_function);
+    bool retained = true;
+    if(ne_fc != nullptr)
+    {
+        retained = ne_fc->original_weights_retained();
+    }
+    else if(cl_fc != nullptr)
+    {
+        retained = cl_fc->original_weights_retained();
+    }
+    if(retained)
+    {
+        return;
+    }
+
+    // The biases are still accumulated from their original tensor; only the weights are baked
+    auto *ne_tensor = dynamic_cast<arm_compute::Tensor *>(_weights.tensor());
+    auto *cl_tensor = dynamic_cast<arm_compute::CLTensor *>(_weights.tensor());
+    if(ne_tensor != nullptr)
+    {
+        ne_tensor->allocator()->free();
+    }
+    else if(cl_tensor != nullptr)
+    {
+        cl_tensor->allocator()->free();
+    }
+    ARM_COMPUTE_LOG("Released original fully connected weights after baking");
+}
+
+std::vector<arm_compute::ITensor *> FullyConnectedLayer::retained_constants()
+{
+    std::vector<arm_compute::ITensor *> constants;
+    for(Tensor *tensor : { &_weights, &_biases })
+    {
+        if(tensor->tensor() != nullptr)
+        {
+            constants.push_back(tensor->tensor());
+        }
+    }
+    return constants;
+}
+
+const char *FullyConnectedLayer::name() const
+{
+    return "FullyConnectedLayer";
+}
+
+bool FullyConnectedLayer::supports_fp16() const
+{
+    return true;
+}
+
 std::unique_ptr<arm_compute::IFunction> FullyConnectedLayer::instantiate_node(GraphContext &ctx, ITensor *input, ITensor *output)
 {
     if(_weights.tensor() == nullptr)
@@ -125,6 +186,8 @@ std::unique_ptr<arm_compute::IFunction> FullyConnectedLayer::instantiate_node(Gr
         ARM_COMPUTE_LOG("Instantiating NEFullyConnectedLayer");
     }
 
+    _fc_function = func.get();
+
     ARM_COMPUTE_LOG(" Type: " << input->info()->data_type()
                     << " Input Shape: " << input->info()->tensor_shape()
                     << " Weights shape: " << _weights.info().tensor_shape()
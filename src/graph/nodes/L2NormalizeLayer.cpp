@@ -64,6 +64,11 @@ std::unique_ptr<arm_compute::IFunction> instantiate<TargetHint::NEON>(ITensor *i
 }
 } // namespace
 
+const char *L2NormalizeLayer::name() const
+{
+    return "L2NormalizeLayer";
+}
+
 std::unique_ptr<arm_compute::IFunction> L2NormalizeLayer::instantiate_node(GraphContext &ctx, ITensor *input, ITensor *output)
 {
     std::unique_ptr<arm_compute::IFunction> func;
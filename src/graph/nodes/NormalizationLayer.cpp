@@ -68,6 +68,16 @@ NormalizationLayer::NormalizationLayer(const NormalizationLayerInfo norm_info)
 {
 }
 
+const char *NormalizationLayer::name() const
+{
+    return "NormalizationLayer";
+}
+
+bool NormalizationLayer::supports_fp16() const
+{
+    return true;
+}
+
 std::unique_ptr<arm_compute::IFunction> NormalizationLayer::instantiate_node(GraphContext &ctx, ITensor *input, ITensor *output)
 {
     std::unique_ptr<arm_compute::IFunction> func;
@@ -68,6 +68,25 @@ PoolingLayer::PoolingLayer(const PoolingLayerInfo pool_info)
 {
 }
 
+float PoolingLayer::estimated_ops(const TensorInfo &input) const
+{
+    // Each input element is visited once per overlapping pooling window
+    const unsigned int    pool_size = _pool_info.pool_size();
+    const PadStrideInfo &stride_info = _pool_info.pad_stride_info();
+    const float overlap = static_cast<float>(pool_size * pool_size) / (stride_info.stride().first * stride_info.stride().second);
+    return input.tensor_shape().total_size() * overlap;
+}
+
+const char *PoolingLayer::name() const
+{
+    return "PoolingLayer";
+}
+
+bool PoolingLayer::supports_fp16() const
+{
+    return true;
+}
+
 std::unique_ptr<arm_compute::IFunction> PoolingLayer::instantiate_node(GraphContext &ctx, ITensor *input, ITensor *output)
 {
     std::unique_ptr<arm_compute::IFunction> func;
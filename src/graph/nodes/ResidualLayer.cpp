@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/nodes/ResidualLayer.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Logger.h"
+#include "arm_compute/runtime/CL/CLTensor.h"
+#include "arm_compute/runtime/CL/functions/CLArithmeticAddition.h"
+#include "arm_compute/runtime/NEON/functions/NEArithmeticAddition.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "support/ToolchainSupport.h"
+#include "utils/TypePrinter.h"
+
+using namespace arm_compute::graph;
+
+namespace
+{
+/** Function running the branch sub-functions followed by the merging addition */
+class ResidualFunction final : public arm_compute::IFunction
+{
+public:
+    /** Default Constructor */
+    ResidualFunction()
+        : _branch_functions(), _merge_function(nullptr)
+    {
+    }
+
+    /** Appends a branch stage
+     *
+     * @param[in] function Function to append
+     */
+    void add_branch_function(std::unique_ptr<arm_compute::IFunction> function)
+    {
+        _branch_functions.emplace_back(std::move(function));
+    }
+    /** Sets the function adding the branch output to the identity path
+     *
+     * @param[in] function Merge function to use
+     */
+    void set_merge_function(std::unique_ptr<arm_compute::IFunction> function)
+    {
+        _merge_function = std::move(function);
+    }
+
+    // Inherited methods overriden:
+    void run() override
+    {
+        for(auto &function : _branch_functions)
+        {
+            function->run();
+        }
+        _merge_function->run();
+    }
+    void prepare() override
+    {
+        for(auto &function : _branch_functions)
+        {
+            function->prepare();
+        }
+        _merge_function->prepare();
+    }
+
+private:
+    std::vector<std::unique_ptr<arm_compute::IFunction>> _branch_functions; /**< Branch stages in execution order */
+    std::unique_ptr<arm_compute::IFunction>              _merge_function;   /**< Element-wise addition merging the paths */
+};
+} // namespace
+
+bool ResidualLayer::supports_in_place() const
+{
+    // The merging addition reads and writes each element exactly once
+    return true;
+}
+
+float ResidualLayer::estimated_ops(const TensorInfo &input) const
+{
+    // Branch cost (estimated with the node input, shapes inside the branch are not known yet)
+    // plus one addition per element for the merge
+    float ops = static_cast<float>(input.tensor_shape().total_size());
+    for(const auto &node : _branch)
+    {
+        ops += node->estimated_ops(input);
+    }
+    return ops;
+}
+
+const char *ResidualLayer::name() const
+{
+    return "ResidualLayer";
+}
+
+bool ResidualLayer::supports_fp16() const
+{
+    return true;
+}
+
+std::unique_ptr<arm_compute::IFunction> ResidualLayer::instantiate_node(GraphContext &ctx, ITensor *input, ITensor *output)
+{
+    _target_hint = ctx.hints().target_hint();
+
+    auto func = arm_compute::support::cpp14::make_unique<ResidualFunction>();
+
+    // Instantiate the branch on this node's target, chaining intermediate tensors
+    ITensor *branch_output = input;
+    for(auto &node : _branch)
+    {
+        _branch_tensors.push_back(arm_compute::support::cpp14::make_unique<Tensor>(TensorInfo()));
+        Tensor *tensor = _branch_tensors.back().get();
+        tensor->set_target(_target_hint);
+        func->add_branch_function(node->instantiate_node(ctx, branch_output, tensor->tensor()));
+        tensor->allocate();
+        branch_output = tensor->tensor();
+    }
+
+    // Output auto inizialitation if not yet initialized
+    arm_compute::auto_init_if_empty(*output->info(), input->info()->tensor_shape(), 1, input->info()->data_type(), input->info()->fixed_point_position());
+
+    ARM_COMPUTE_ERROR_ON_MSG(branch_output->info()->tensor_shape() != input->info()->tensor_shape(), "The residual branch must preserve the input shape");
+
+    // Merge the identity path and the branch output
+    if(_target_hint == TargetHint::OPENCL)
+    {
+        auto add = arm_compute::support::cpp14::make_unique<arm_compute::CLArithmeticAddition>();
+        add->configure(dynamic_cast<arm_compute::ICLTensor *>(input), dynamic_cast<arm_compute::ICLTensor *>(branch_output), dynamic_cast<arm_compute::ICLTensor *>(output), ConvertPolicy::SATURATE);
+        func->set_merge_function(std::move(add));
+        ARM_COMPUTE_LOG("Instantiating CLArithmeticAddition");
+    }
+    else
+    {
+        auto add = arm_compute::support::cpp14::make_unique<arm_compute::NEArithmeticAddition>();
+        add->configure(input, branch_output, output, ConvertPolicy::SATURATE);
+        func->set_merge_function(std::move(add));
+        ARM_COMPUTE_LOG("Instantiating NEArithmeticAddition");
+    }
+
+    ARM_COMPUTE_LOG(" Data Type: " << input->info()->data_type()
+                    << " Input shape: " << input->info()->tensor_shape()
+                    << " Branch nodes: " << _branch.size()
+                    << " Output shape: " << output->info()->tensor_shape()
+                    << std::endl);
+
+    return std::move(func);
+}
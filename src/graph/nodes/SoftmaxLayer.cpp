@@ -62,6 +62,16 @@ std::unique_ptr<arm_compute::IFunction> instantiate<TargetHint::NEON>(ITensor *i
 }
 } // namespace
 
+const char *SoftmaxLayer::name() const
+{
+    return "SoftmaxLayer";
+}
+
+bool SoftmaxLayer::supports_fp16() const
+{
+    return true;
+}
+
 std::unique_ptr<arm_compute::IFunction> SoftmaxLayer::instantiate_node(GraphContext &ctx, ITensor *input, ITensor *output)
 {
     std::unique_ptr<arm_compute::IFunction> func;
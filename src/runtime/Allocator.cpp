@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017 ARM Limited.
+ * Copyright (c) 2016, 2017 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,18 +24,60 @@
 #include "arm_compute/runtime/Allocator.h"
 
 #include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/MemoryTracker.h"
 
 #include <cstddef>
 
+#if !defined(BARE_METAL) && defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* !defined(BARE_METAL) && defined(__linux__) */
+
 using namespace arm_compute;
 
+namespace
+{
+/** Bind the pages of [ptr, ptr + size) to the given NUMA node. No-op when the kernel has no NUMA support.
+ *
+ * @param[in] ptr       Start of the range to bind.
+ * @param[in] size      Size of the range in bytes.
+ * @param[in] numa_node Node to bind the pages to.
+ */
+void bind_to_node(void *ptr, size_t size, int numa_node)
+{
+#if !defined(BARE_METAL) && defined(__linux__) && defined(SYS_mbind)
+    // MPOL_BIND, defined here to avoid a libnuma dependency
+    constexpr int mpol_bind = 2;
+
+    unsigned long nodemask = 1UL << numa_node;
+    syscall(SYS_mbind, ptr, size, mpol_bind, &nodemask, sizeof(nodemask) * 8, 0);
+#else  /* !defined(BARE_METAL) && defined(__linux__) && defined(SYS_mbind) */
+    ARM_COMPUTE_UNUSED(ptr);
+    ARM_COMPUTE_UNUSED(size);
+    ARM_COMPUTE_UNUSED(numa_node);
+#endif /* !defined(BARE_METAL) && defined(__linux__) && defined(SYS_mbind) */
+}
+} // namespace
+
+Allocator::Allocator(int numa_node)
+    : _numa_node(numa_node)
+{
+}
+
 void *Allocator::allocate(size_t size, size_t alignment)
 {
     ARM_COMPUTE_UNUSED(alignment);
-    return ::operator new(size);
+    void *ptr = ::operator new(size);
+    if(_numa_node >= 0)
+    {
+        bind_to_node(ptr, size, _numa_node);
+    }
+    MemoryTracker::get().record_allocation(ptr, size);
+    return ptr;
 }
 
 void Allocator::free(void *ptr)
 {
+    MemoryTracker::get().record_free(ptr);
     ::operator delete(ptr);
 }
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/BatchParallelExecutor.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "support/ToolchainSupport.h"
+
+#include <thread>
+
+using namespace arm_compute;
+
+BatchParallelExecutor::BatchParallelExecutor()
+    : _slice_inputs(), _slice_outputs(), _slice_functions(), _slice_schedulers()
+{
+}
+
+void BatchParallelExecutor::configure(ITensor *input, ITensor *output, unsigned int num_slices, const SliceFunctionBuilder &build_slice_function)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_ON(num_slices == 0);
+    ARM_COMPUTE_ERROR_ON(!build_slice_function);
+    ARM_COMPUTE_ERROR_ON_MSG(!_slice_functions.empty(), "The executor has already been configured");
+
+    const TensorShape &in_shape      = input->info()->tensor_shape();
+    const TensorShape &out_shape     = output->info()->tensor_shape();
+    const size_t       batch_dim_in  = in_shape.num_dimensions() - 1;
+    const size_t       batch_dim_out = out_shape.num_dimensions() - 1;
+    const size_t       batch         = in_shape[batch_dim_in];
+    ARM_COMPUTE_ERROR_ON_MSG(out_shape[batch_dim_out] != batch, "Input and output must have the same batch size");
+    ARM_COMPUTE_ERROR_ON_MSG(batch % num_slices != 0, "The batch size must be a multiple of the number of slices");
+
+    const size_t samples_per_slice = batch / num_slices;
+    TensorShape  in_slice_shape    = in_shape;
+    TensorShape  out_slice_shape   = out_shape;
+    in_slice_shape.set(batch_dim_in, samples_per_slice);
+    out_slice_shape.set(batch_dim_out, samples_per_slice);
+
+    for(unsigned int s = 0; s < num_slices; ++s)
+    {
+        Coordinates in_coords;
+        Coordinates out_coords;
+        in_coords.set(batch_dim_in, static_cast<int>(s * samples_per_slice));
+        out_coords.set(batch_dim_out, static_cast<int>(s * samples_per_slice));
+
+        _slice_inputs.push_back(support::cpp14::make_unique<SubTensor>(input, in_slice_shape, in_coords));
+        _slice_outputs.push_back(support::cpp14::make_unique<SubTensor>(output, out_slice_shape, out_coords));
+        _slice_functions.push_back(build_slice_function(_slice_inputs.back().get(), _slice_outputs.back().get()));
+        ARM_COMPUTE_ERROR_ON_MSG(_slice_functions.back() == nullptr, "The slice function builder returned no function");
+    }
+    _slice_schedulers.resize(num_slices, nullptr);
+}
+
+void BatchParallelExecutor::set_slice_scheduler(unsigned int slice, IScheduler *scheduler)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(slice >= _slice_schedulers.size(), "Slice index out of range: configure the executor first");
+    _slice_schedulers[slice] = scheduler;
+}
+
+void BatchParallelExecutor::run()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_slice_functions.empty(), "The executor has not been configured");
+
+    std::vector<std::thread>        threads;
+    std::vector<std::exception_ptr> exceptions(_slice_functions.size(), nullptr);
+
+    // Slices beyond the first each get a thread bound to their own scheduler instance, so the
+    // slices' kernels dispatch onto disjoint pools instead of serializing on a shared one
+    for(size_t s = 1; s < _slice_functions.size(); ++s)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(_slice_schedulers[s] == nullptr, "Every slice beyond the first needs its own scheduler instance");
+        threads.emplace_back([this, s, &exceptions]
+        {
+            Scheduler::bind_to_thread(_slice_schedulers[s]);
+            try
+            {
+                _slice_functions[s]->run();
+            }
+            catch(...)
+            {
+                exceptions[s] = std::current_exception();
+            }
+            Scheduler::bind_to_thread(nullptr);
+        });
+    }
+
+    // The first slice runs on the calling thread, on the caller's scheduler unless one was assigned
+    if(_slice_schedulers[0] != nullptr)
+    {
+        Scheduler::bind_to_thread(_slice_schedulers[0]);
+    }
+    try
+    {
+        _slice_functions[0]->run();
+    }
+    catch(...)
+    {
+        exceptions[0] = std::current_exception();
+    }
+    if(_slice_schedulers[0] != nullptr)
+    {
+        Scheduler::bind_to_thread(nullptr);
+    }
+
+    for(std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    for(const std::exception_ptr &exception : exceptions)
+    {
+        if(exception != nullptr)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+}
@@ -32,6 +32,7 @@
 #include <algorithm>
 #include <cmath>
 #include <map>
+#include <numeric>
 #include <vector>
 
 using namespace arm_compute;
@@ -113,6 +114,47 @@ MappingType BlobLifetimeManager::mapping_type() const
     return MappingType::BLOBS;
 }
 
+size_t BlobLifetimeManager::total_pool_size() const
+{
+    return std::accumulate(std::begin(_blobs), std::end(_blobs), static_cast<size_t>(0));
+}
+
+std::vector<size_t> BlobLifetimeManager::pool_chunk_sizes() const
+{
+    return _blobs;
+}
+
+size_t BlobLifetimeManager::total_registered_size() const
+{
+    size_t total = 0;
+    for(const auto &group : _finalized_groups)
+    {
+        for(const auto &e : group.second)
+        {
+            total += e.size;
+        }
+    }
+    return total;
+}
+
+void BlobLifetimeManager::print_placement(std::ostream &os) const
+{
+    os << "Pool size: " << total_pool_size() << " bytes in " << _blobs.size() << " blobs (peak concurrent tensors)\n";
+    os << "Registered size: " << total_registered_size() << " bytes\n";
+
+    int group_idx = 0;
+    for(const auto &group : _finalized_groups)
+    {
+        auto &group_mappings = group.first->mappings();
+        os << "Group " << group_idx++ << ":\n";
+        for(const auto &e : group.second)
+        {
+            const auto it = group_mappings.find(e.handle);
+            os << "  tensor " << e.id << " size " << e.size << " -> blob " << ((it != group_mappings.end()) ? static_cast<int>(it->second) : -1) << "\n";
+        }
+    }
+}
+
 void BlobLifetimeManager::update_blobs_and_mappings()
 {
     ARM_COMPUTE_ERROR_ON(!are_all_finalized());
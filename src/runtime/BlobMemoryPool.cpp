@@ -26,15 +26,17 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/runtime/IAllocator.h"
 #include "arm_compute/runtime/IMemoryPool.h"
+#include "arm_compute/runtime/MemoryColoring.h"
 #include "arm_compute/runtime/Types.h"
 #include "support/ToolchainSupport.h"
 
+#include <cstdint>
 #include <vector>
 
 using namespace arm_compute;
 
 BlobMemoryPool::BlobMemoryPool(IAllocator *allocator, std::vector<size_t> blob_sizes)
-    : _allocator(allocator), _blobs(), _blob_sizes(std::move(blob_sizes))
+    : _allocator(allocator), _blobs(), _blob_allocations(), _blob_sizes(std::move(blob_sizes))
 {
     ARM_COMPUTE_ERROR_ON(!allocator);
     allocate_blobs(_blob_sizes);
@@ -82,7 +84,13 @@ void BlobMemoryPool::allocate_blobs(const std::vector<size_t> &sizes)
 
     for(const auto &size : sizes)
     {
-        _blobs.push_back(_allocator->allocate(size, 0));
+        // Stagger the blob starts across cache sets so concurrently-accessed blobs do not
+        // evict each other's lines; a zero offset when coloring is disabled
+        const size_t offset     = MemoryColoring::get().next_offset();
+        void        *allocation = _allocator->allocate(size + offset, 0);
+
+        _blob_allocations.push_back(allocation);
+        _blobs.push_back(static_cast<uint8_t *>(allocation) + offset);
     }
 }
 
@@ -90,9 +98,10 @@ void BlobMemoryPool::free_blobs()
 {
     ARM_COMPUTE_ERROR_ON(!_allocator);
 
-    for(auto &blob : _blobs)
+    for(auto &allocation : _blob_allocations)
     {
-        _allocator->free(blob);
+        _allocator->free(allocation);
     }
+    _blob_allocations.clear();
     _blobs.clear();
 }
\ No newline at end of file
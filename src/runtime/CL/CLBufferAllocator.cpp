@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/CL/OpenCL.h"
 #include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/MemoryTracker.h"
 
 #include <cstddef>
 
@@ -39,11 +40,13 @@ void *CLBufferAllocator::allocate(size_t size, size_t alignment)
 {
     ARM_COMPUTE_UNUSED(alignment);
     cl_mem buf = clCreateBuffer(_context.get(), CL_MEM_ALLOC_HOST_PTR | CL_MEM_READ_WRITE, size, nullptr, nullptr);
+    MemoryTracker::get().record_allocation(buf, size);
     return static_cast<void *>(buf);
 }
 
 void CLBufferAllocator::free(void *ptr)
 {
     ARM_COMPUTE_ERROR_ON(ptr == nullptr);
+    MemoryTracker::get().record_free(ptr);
     clReleaseMemObject(static_cast<cl_mem>(ptr));
 }
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/CLInputStage.h"
+
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace arm_compute;
+
+CLInputStage::CLInputStage()
+    : _target(nullptr), _staging(), _copies(), _last_copy(), _mapping(nullptr), _size(0), _queue_id(0), _index(0)
+{
+}
+
+void CLInputStage::configure(ICLTensor *target, unsigned int transfer_queue_id)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(target);
+    ARM_COMPUTE_ERROR_ON_MSG(target->cl_buffer()() == nullptr, "The target tensor must be allocated");
+    ARM_COMPUTE_ERROR_ON_MSG(transfer_queue_id == 0, "The transfer queue must not be the compute queue");
+
+    _target   = target;
+    _size     = target->info()->total_size();
+    _queue_id = transfer_queue_id;
+    _index    = 0;
+    _mapping  = nullptr;
+
+    // Make sure the dedicated transfer queue exists
+    CLScheduler::get().set_num_queues(std::max(CLScheduler::get().num_queues(), transfer_queue_id + 1));
+
+    for(auto &slot : _staging)
+    {
+        slot = cl::Buffer(CLScheduler::get().context(), CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR, _size);
+    }
+}
+
+void *CLInputStage::begin_write()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_target == nullptr, "CLInputStage has not been configured");
+    ARM_COMPUTE_ERROR_ON_MSG(_mapping != nullptr, "A staging slot is already mapped");
+
+    cl::CommandQueue &queue = CLScheduler::get().queue(_queue_id);
+
+    // Only the previous copy out of this slot has to finish; the compute queue is not drained
+    std::vector<cl::Event> wait_list;
+    if(_copies[_index]() != nullptr)
+    {
+        wait_list.push_back(_copies[_index]);
+    }
+
+    cl_int err = CL_SUCCESS;
+    _mapping   = queue.enqueueMapBuffer(_staging[_index], CL_TRUE, CL_MAP_WRITE, 0, _size, wait_list.empty() ? nullptr : &wait_list, nullptr, &err);
+    ARM_COMPUTE_ERROR_ON_MSG(err != CL_SUCCESS || _mapping == nullptr, "Failed to map the staging buffer");
+    ARM_COMPUTE_UNUSED(err);
+
+    return _mapping;
+}
+
+void CLInputStage::end_write()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_mapping == nullptr, "No staging slot is mapped");
+
+    cl::CommandQueue &queue = CLScheduler::get().queue(_queue_id);
+
+    queue.enqueueUnmapMemObject(_staging[_index], _mapping);
+    queue.enqueueCopyBuffer(_staging[_index], _target->cl_buffer(), 0, 0, _size, nullptr, &_copies[_index]);
+    queue.flush();
+
+    _last_copy = _copies[_index];
+    _mapping   = nullptr;
+    _index     = 1 - _index;
+}
+
+cl::Event CLInputStage::transfer_event() const
+{
+    return _last_copy;
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/CLOutputStage.h"
+
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace arm_compute;
+
+CLOutputStage::CLOutputStage()
+    : _source(nullptr), _staging(), _copies(), _mapping(nullptr), _size(0), _queue_id(0), _write_index(0), _read_index(0), _num_staged(0)
+{
+}
+
+void CLOutputStage::configure(const ICLTensor *source, unsigned int transfer_queue_id)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(source);
+    ARM_COMPUTE_ERROR_ON_MSG(source->cl_buffer()() == nullptr, "The source tensor must be allocated");
+    ARM_COMPUTE_ERROR_ON_MSG(transfer_queue_id == 0, "The transfer queue must not be the compute queue");
+
+    _source      = source;
+    _size        = source->info()->total_size();
+    _queue_id    = transfer_queue_id;
+    _write_index = 0;
+    _read_index  = 0;
+    _num_staged  = 0;
+    _mapping     = nullptr;
+
+    // Make sure the dedicated transfer queue exists
+    CLScheduler::get().set_num_queues(std::max(CLScheduler::get().num_queues(), transfer_queue_id + 1));
+
+    for(auto &slot : _staging)
+    {
+        slot = cl::Buffer(CLScheduler::get().context(), CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR, _size);
+    }
+}
+
+void CLOutputStage::stage()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_source == nullptr, "CLOutputStage has not been configured");
+    ARM_COMPUTE_ERROR_ON_MSG(_num_staged == 2, "Both staging slots hold pending snapshots: read one first");
+
+    cl::CommandQueue &queue = CLScheduler::get().queue(_queue_id);
+
+    // Order the snapshot after the compute already enqueued, without draining the queue
+    std::vector<cl::Event> wait_list{ CLScheduler::get().enqueue_sync_event() };
+    CLScheduler::get().queue().flush();
+
+    queue.enqueueCopyBuffer(_source->cl_buffer(), _staging[_write_index], 0, 0, _size, &wait_list, &_copies[_write_index]);
+    queue.flush();
+
+    _write_index = 1 - _write_index;
+    ++_num_staged;
+}
+
+const void *CLOutputStage::begin_read()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_num_staged == 0, "No snapshot is pending: call stage() first");
+    ARM_COMPUTE_ERROR_ON_MSG(_mapping != nullptr, "A staging slot is already mapped");
+
+    cl::CommandQueue &queue = CLScheduler::get().queue(_queue_id);
+
+    // Only this snapshot's copy has to finish; the compute queue keeps running
+    std::vector<cl::Event> wait_list{ _copies[_read_index] };
+
+    cl_int err = CL_SUCCESS;
+    _mapping   = queue.enqueueMapBuffer(_staging[_read_index], CL_TRUE, CL_MAP_READ, 0, _size, &wait_list, nullptr, &err);
+    ARM_COMPUTE_ERROR_ON_MSG(err != CL_SUCCESS || _mapping == nullptr, "Failed to map the staging buffer");
+    ARM_COMPUTE_UNUSED(err);
+
+    return _mapping;
+}
+
+void CLOutputStage::end_read()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_mapping == nullptr, "No staging slot is mapped");
+
+    cl::CommandQueue &queue = CLScheduler::get().queue(_queue_id);
+
+    queue.enqueueUnmapMemObject(_staging[_read_index], _mapping);
+    queue.flush();
+
+    _mapping    = nullptr;
+    _read_index = 1 - _read_index;
+    --_num_staged;
+}
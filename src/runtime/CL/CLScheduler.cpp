@@ -24,12 +24,15 @@
 #include "arm_compute/runtime/CL/CLScheduler.h"
 
 #include "arm_compute/core/CL/ICLKernel.h"
+#include "arm_compute/core/Window.h"
 #include "arm_compute/runtime/CL/CLTuner.h"
 
+#include <algorithm>
+
 using namespace arm_compute;
 
 CLScheduler::CLScheduler()
-    : _context(), _queue(), _target(GPUTarget::MIDGARD), _is_initialised(false), _cl_tuner()
+    : _context(), _queue(), _extra_queues(), _target(GPUTarget::MIDGARD), _is_initialised(false), _cl_tuner()
 {
 }
 
@@ -39,6 +42,114 @@ CLScheduler &CLScheduler::get()
     return scheduler;
 }
 
+cl::Event CLScheduler::enqueue_with_events(ICLKernel &kernel, const std::vector<cl::Event> &wait_list, bool flush)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_is_initialised,
+                             "The CLScheduler is not initialised yet! Please call the CLScheduler::get().default_init(), \
+                             or CLScheduler::get()::init() and CLKernelLibrary::get()::init() function before running functions!");
+
+    // Tune the kernel if the CLTuner has been provided
+    if(_cl_tuner != nullptr)
+    {
+        // Tune the OpenCL kernel
+        _cl_tuner->tune_kernel(kernel);
+    }
+
+    // Order the kernel after the given events. The wait only constrains this queue,
+    // the kernels themselves need no knowledge of the wait list.
+    if(!wait_list.empty())
+    {
+        _queue.enqueueWaitForEvents(wait_list);
+    }
+
+    // Run kernel
+    kernel.run(kernel.window(), _queue);
+
+    // Completion event for the commands enqueued above
+    cl::Event event;
+    _queue.enqueueMarker(&event);
+
+    if(flush)
+    {
+        _queue.flush();
+    }
+
+    return event;
+}
+
+void CLScheduler::enqueue_on(ICLKernel &kernel, unsigned int queue_id, bool flush)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_is_initialised,
+                             "The CLScheduler is not initialised yet! Please call the CLScheduler::get().default_init(), \
+                             or CLScheduler::get()::init() and CLKernelLibrary::get()::init() function before running functions!");
+
+    // Tune the kernel if the CLTuner has been provided
+    if(_cl_tuner != nullptr)
+    {
+        // Tune the OpenCL kernel
+        _cl_tuner->tune_kernel(kernel);
+    }
+
+    cl::CommandQueue &q = queue(queue_id);
+
+    // Run kernel
+    kernel.run(kernel.window(), q);
+
+    if(flush)
+    {
+        q.flush();
+    }
+}
+
+void CLScheduler::enqueue_chunked(ICLKernel &kernel, unsigned int num_chunks, bool flush)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_is_initialised,
+                             "The CLScheduler is not initialised yet! Please call the CLScheduler::get().default_init(), \
+                             or CLScheduler::get()::init() and CLKernelLibrary::get()::init() function before running functions!");
+    ARM_COMPUTE_ERROR_ON(num_chunks == 0);
+
+    // Tune the kernel if the CLTuner has been provided
+    if(_cl_tuner != nullptr)
+    {
+        // Tune the OpenCL kernel
+        _cl_tuner->tune_kernel(kernel);
+    }
+
+    const Window &win = kernel.window();
+
+    // Split along the outermost dimension the window actually iterates over
+    size_t split_dim = 0;
+    for(size_t d = Coordinates::num_max_dimensions; d > 0; --d)
+    {
+        if(win.num_iterations(d - 1) > 1)
+        {
+            split_dim = d - 1;
+            break;
+        }
+    }
+
+    // A chunk needs at least one iteration of the split dimension
+    num_chunks = std::min<unsigned int>(num_chunks, win.num_iterations(split_dim));
+
+    if(num_chunks <= 1)
+    {
+        enqueue(kernel, flush);
+        return;
+    }
+
+    for(unsigned int i = 0; i < num_chunks; ++i)
+    {
+        kernel.run(win.split_window(split_dim, i, num_chunks), _queue);
+
+        // Flushing each chunk submits it as an independent batch: the yield point
+        // where the driver can interleave other work sharing the GPU
+        if(flush || (i + 1 < num_chunks))
+        {
+            _queue.flush();
+        }
+    }
+}
+
 void CLScheduler::enqueue(ICLKernel &kernel, bool flush)
 {
     ARM_COMPUTE_ERROR_ON_MSG(!_is_initialised,
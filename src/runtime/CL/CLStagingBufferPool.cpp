@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/CLStagingBufferPool.h"
+
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+
+#include <cstring>
+#include <mutex>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Wrap an allocator-owned cl_mem for the C++ API: the extra reference taken here balances the
+ * release performed by the wrapper's destructor, leaving the pool's reference untouched.
+ */
+cl::Buffer wrap_buffer(cl_mem buffer)
+{
+    clRetainMemObject(buffer);
+    return cl::Buffer(buffer);
+}
+} // namespace
+
+CLStagingBufferPool::CLStagingBufferPool()
+    : _allocator(CLScheduler::get().context()), _free_buffers(), _pending(), _mutex()
+{
+}
+
+CLStagingBufferPool::~CLStagingBufferPool()
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mutex);
+
+    for(const PendingCopy &pending : _pending)
+    {
+        _allocator.free(pending.buffer);
+    }
+
+    for(auto &free_list : _free_buffers)
+    {
+        for(cl_mem buffer : free_list.second)
+        {
+            _allocator.free(buffer);
+        }
+    }
+}
+
+cl::Event CLStagingBufferPool::enqueue_write(ICLTensor &tensor, const void *src, size_t size)
+{
+    ARM_COMPUTE_ERROR_ON(tensor.cl_buffer().get() == nullptr);
+    ARM_COMPUTE_ERROR_ON(src == nullptr);
+    ARM_COMPUTE_ERROR_ON(size == 0);
+
+    const size_t size_class = size_class_for(size);
+    cl_mem       staging    = nullptr;
+
+    {
+        std::lock_guard<arm_compute::Mutex> lock(_mutex);
+        recycle_completed();
+        staging = acquire(size_class);
+    }
+
+    const cl::Buffer  staging_buffer = wrap_buffer(staging);
+    cl::CommandQueue &queue          = CLScheduler::get().queue();
+
+    // Fill the pinned buffer through a map: for CL_MEM_ALLOC_HOST_PTR memory this is a pointer
+    // exchange rather than a copy, and the following device copy runs out of pinned pages
+    void *mapping = queue.enqueueMapBuffer(staging_buffer, CL_TRUE, CL_MAP_WRITE, 0, size);
+    std::memcpy(mapping, src, size);
+    queue.enqueueUnmapMemObject(staging_buffer, mapping);
+
+    cl::Event copy_done;
+    queue.enqueueCopyBuffer(staging_buffer, tensor.cl_buffer(), 0, 0, size, nullptr, &copy_done);
+
+    {
+        std::lock_guard<arm_compute::Mutex> lock(_mutex);
+        _pending.push_back({ staging, size_class, copy_done });
+    }
+
+    return copy_done;
+}
+
+void CLStagingBufferPool::read(ICLTensor &tensor, void *dst, size_t size)
+{
+    ARM_COMPUTE_ERROR_ON(tensor.cl_buffer().get() == nullptr);
+    ARM_COMPUTE_ERROR_ON(dst == nullptr);
+    ARM_COMPUTE_ERROR_ON(size == 0);
+
+    const size_t size_class = size_class_for(size);
+    cl_mem       staging    = nullptr;
+
+    {
+        std::lock_guard<arm_compute::Mutex> lock(_mutex);
+        recycle_completed();
+        staging = acquire(size_class);
+    }
+
+    const cl::Buffer  staging_buffer = wrap_buffer(staging);
+    cl::CommandQueue &queue          = CLScheduler::get().queue();
+
+    queue.enqueueCopyBuffer(tensor.cl_buffer(), staging_buffer, 0, 0, size);
+
+    // The blocking map orders after the copy on the in-order queue and waits for the data
+    void *mapping = queue.enqueueMapBuffer(staging_buffer, CL_TRUE, CL_MAP_READ, 0, size);
+    std::memcpy(dst, mapping, size);
+    queue.enqueueUnmapMemObject(staging_buffer, mapping);
+
+    std::lock_guard<arm_compute::Mutex> lock(_mutex);
+    _free_buffers[size_class].push_back(staging);
+}
+
+void CLStagingBufferPool::clear()
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mutex);
+
+    recycle_completed();
+
+    for(auto &free_list : _free_buffers)
+    {
+        for(cl_mem buffer : free_list.second)
+        {
+            _allocator.free(buffer);
+        }
+    }
+    _free_buffers.clear();
+}
+
+cl_mem CLStagingBufferPool::acquire(size_t size_class)
+{
+    std::vector<cl_mem> &free_list = _free_buffers[size_class];
+
+    if(!free_list.empty())
+    {
+        cl_mem buffer = free_list.back();
+        free_list.pop_back();
+        return buffer;
+    }
+
+    return static_cast<cl_mem>(_allocator.allocate(size_class, 0));
+}
+
+size_t CLStagingBufferPool::size_class_for(size_t size)
+{
+    // Sub-page buffers share the smallest class to keep the number of lists low
+    size_t size_class = 4096;
+    while(size_class < size)
+    {
+        size_class *= 2;
+    }
+    return size_class;
+}
+
+void CLStagingBufferPool::recycle_completed()
+{
+    auto it = _pending.begin();
+    while(it != _pending.end())
+    {
+        if(it->copy_done.getInfo<CL_EVENT_COMMAND_EXECUTION_STATUS>() == CL_COMPLETE)
+        {
+            _free_buffers[it->size_class].push_back(it->buffer);
+            it = _pending.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
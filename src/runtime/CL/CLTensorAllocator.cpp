@@ -27,6 +27,7 @@
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/runtime/CL/CLMemoryGroup.h"
 #include "arm_compute/runtime/CL/CLScheduler.h"
+#include "arm_compute/runtime/MemoryTracker.h"
 
 using namespace arm_compute;
 
@@ -50,12 +51,49 @@ const cl::Buffer &CLTensorAllocator::cl_data() const
     return _buffer;
 }
 
+void CLTensorAllocator::import_memory(void *ptr)
+{
+    ARM_COMPUTE_ERROR_ON(_buffer.get() != nullptr);
+    ARM_COMPUTE_ERROR_ON(_associated_memory_group != nullptr);
+    ARM_COMPUTE_ERROR_ON(ptr == nullptr);
+
+    _buffer = cl::Buffer(CLScheduler::get().context(), CL_MEM_USE_HOST_PTR | CL_MEM_READ_WRITE, info().total_size(), ptr);
+    info().set_is_resizable(false);
+}
+
+void CLTensorAllocator::import_dma_buf(int fd)
+{
+    ARM_COMPUTE_ERROR_ON(_buffer.get() != nullptr);
+    ARM_COMPUTE_ERROR_ON(_associated_memory_group != nullptr);
+    ARM_COMPUTE_ERROR_ON(fd < 0);
+
+    const cl_import_properties_arm properties[] = { CL_IMPORT_TYPE_ARM, CL_IMPORT_TYPE_DMA_BUF_ARM, 0 };
+
+    cl_int err    = CL_SUCCESS;
+    cl_mem buffer = clImportMemoryARM(CLScheduler::get().context()(), CL_MEM_READ_WRITE, properties, &fd, info().total_size(), &err);
+    if(err != CL_SUCCESS || buffer == nullptr)
+    {
+        ARM_COMPUTE_ERROR("Importing the dma-buf buffer failed: cl_arm_import_memory is unsupported by the driver or the buffer is unsuitable");
+    }
+
+    // Wrap without retaining: the cl::Buffer takes over the import's reference
+    _buffer = cl::Buffer(buffer, /* retainObject */ false);
+    info().set_is_resizable(false);
+}
+
+bool CLTensorAllocator::dma_buf_import_supported()
+{
+    CLSymbols::get().load_default();
+    return CLSymbols::get().clImportMemoryARM != nullptr;
+}
+
 void CLTensorAllocator::allocate()
 {
     ARM_COMPUTE_ERROR_ON(_buffer.get() != nullptr);
     if(_associated_memory_group == nullptr)
     {
         _buffer = cl::Buffer(CLScheduler::get().context(), CL_MEM_ALLOC_HOST_PTR | CL_MEM_READ_WRITE, info().total_size());
+        MemoryTracker::get().record_allocation(_buffer.get(), info().total_size());
     }
     else
     {
@@ -68,6 +106,7 @@ void CLTensorAllocator::free()
 {
     if(_associated_memory_group == nullptr)
     {
+        MemoryTracker::get().record_free(_buffer.get());
         _buffer = cl::Buffer();
         info().set_is_resizable(true);
     }
@@ -26,7 +26,9 @@
 #include "arm_compute/core/CL/ICLKernel.h"
 #include "arm_compute/runtime/CL/CLScheduler.h"
 
+#include <array>
 #include <chrono>
+#include <fstream>
 #include <limits>
 #include <string>
 
@@ -115,4 +117,90 @@ void CLTuner::import_lws_table(const std::unordered_map<std::string, cl::NDRange
 const std::unordered_map<std::string, cl::NDRange> &CLTuner::export_lws_table()
 {
     return _lws_table;
+}
+
+bool CLTuner::save_to_file(const std::string &filename) const
+{
+    std::ofstream fs(filename, std::ios::trunc);
+    if(!fs.is_open())
+    {
+        return false;
+    }
+
+    // One entry per line: config_id;dimensions;lws_x;lws_y;lws_z
+    for(const auto &kernel_data : _lws_table)
+    {
+        const cl::NDRange &lws = kernel_data.second;
+        fs << kernel_data.first << ";" << lws.dimensions();
+        for(size_t d = 0; d < lws.dimensions(); ++d)
+        {
+            fs << ";" << static_cast<const size_t *>(lws)[d];
+        }
+        fs << "\n";
+    }
+    return fs.good();
+}
+
+bool CLTuner::load_from_file(const std::string &filename)
+{
+    std::ifstream fs(filename);
+    if(!fs.is_open())
+    {
+        return false;
+    }
+
+    std::unordered_map<std::string, cl::NDRange> lws_table;
+    std::string                                  line;
+    while(std::getline(fs, line))
+    {
+        if(line.empty())
+        {
+            continue;
+        }
+
+        const size_t first_sep = line.find(';');
+        if(first_sep == std::string::npos)
+        {
+            return false;
+        }
+        const std::string config_id = line.substr(0, first_sep);
+
+        std::array<size_t, 3> values{ {} };
+        size_t                num_dimensions = 0;
+        size_t                pos            = first_sep + 1;
+        num_dimensions                       = strtoul(line.c_str() + pos, nullptr, 10);
+        if(num_dimensions > 3)
+        {
+            return false;
+        }
+        for(size_t d = 0; d < num_dimensions; ++d)
+        {
+            pos = line.find(';', pos);
+            if(pos == std::string::npos)
+            {
+                return false;
+            }
+            ++pos;
+            values[d] = strtoul(line.c_str() + pos, nullptr, 10);
+        }
+
+        switch(num_dimensions)
+        {
+            case 1:
+                lws_table.emplace(config_id, cl::NDRange(values[0]));
+                break;
+            case 2:
+                lws_table.emplace(config_id, cl::NDRange(values[0], values[1]));
+                break;
+            case 3:
+                lws_table.emplace(config_id, cl::NDRange(values[0], values[1], values[2]));
+                break;
+            default:
+                lws_table.emplace(config_id, cl::NullRange);
+                break;
+        }
+    }
+
+    _lws_table = std::move(lws_table);
+    return true;
 }
\ No newline at end of file
@@ -30,7 +30,8 @@ using namespace arm_compute;
 
 ICLSimpleFunction::ICLSimpleFunction() // NOLINT
     : _kernel(),
-      _border_handler()
+      _border_handler(),
+      _num_chunks(1)
 {
 }
 
@@ -39,5 +40,20 @@ void ICLSimpleFunction::run()
     ARM_COMPUTE_ERROR_ON_MSG(!_kernel, "The child class didn't set the CL kernel or function isn't configured");
 
     CLScheduler::get().enqueue(_border_handler, false);
-    CLScheduler::get().enqueue(*_kernel);
+    CLScheduler::get().enqueue_chunked(*_kernel, _num_chunks);
+}
+
+void ICLSimpleFunction::set_chunking(unsigned int num_chunks)
+{
+    ARM_COMPUTE_ERROR_ON(num_chunks == 0);
+
+    _num_chunks = num_chunks;
+}
+
+cl::Event ICLSimpleFunction::run_async(const std::vector<cl::Event> &wait_list)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_kernel, "The child class didn't set the CL kernel or function isn't configured");
+
+    CLScheduler::get().enqueue_with_events(_border_handler, wait_list, false);
+    return CLScheduler::get().enqueue_with_events(*_kernel, {});
 }
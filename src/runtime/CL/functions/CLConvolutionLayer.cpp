@@ -95,12 +95,14 @@ void CLConvolutionLayerReshapeWeights::run()
 }
 
 CLConvolutionLayer::CLConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _reshape_weights(), _input_im2col_kernel(), _input_interleave_kernel(), _mm_kernel(), _output_col2im_kernel(), _input_im2col_reshaped(),
-      _input_interleaved_reshaped(), _weights_reshaped(), _weights_transposed(), _gemm_output(), _has_bias(false), _is_fully_connected_convolution(false), _are_weights_reshaped(false)
+    : _memory_group(std::move(memory_manager)), _reshape_weights(), _input_im2col_kernel(), _input_interleave_kernel(), _mm_kernel(), _direct_conv_kernel(), _output_col2im_kernel(),
+      _input_im2col_reshaped(), _input_interleaved_reshaped(), _weights_reshaped(), _weights_transposed(), _gemm_output(), _has_bias(false), _is_fully_connected_convolution(false),
+      _are_weights_reshaped(false), _run_direct_convolution(false), _original_weights_retained(true)
 {
 }
 
-void CLConvolutionLayer::configure(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info)
+void CLConvolutionLayer::configure(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info,
+                                   const ActivationLayerInfo &act_info, const Size2D &dilation)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QS8, DataType::QS16, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
@@ -124,6 +126,9 @@ void CLConvolutionLayer::configure(const ICLTensor *input, const ICLTensor *weig
 
     _has_bias             = (biases != nullptr);
     _are_weights_reshaped = weights_info.are_reshaped();
+    // Pre-reshaped weights are read directly by the kernels; otherwise only the function's
+    // own reshaped copy is used after prepare()
+    _original_weights_retained = _are_weights_reshaped;
 
     // Get parameters from conv_info
     unsigned int stride_x = 0;
@@ -139,12 +144,32 @@ void CLConvolutionLayer::configure(const ICLTensor *input, const ICLTensor *weig
 
     const unsigned int kernel_width  = (_are_weights_reshaped) ? weights_info.kernel_size().first : weights->info()->dimension(0);
     const unsigned int kernel_height = (_are_weights_reshaped) ? weights_info.kernel_size().second : weights->info()->dimension(1);
-    std::tie(conv_w, conv_h) = scaled_dimensions(input->info()->dimension(0), input->info()->dimension(1), kernel_width, kernel_height,
+    std::tie(conv_w, conv_h) = scaled_dimensions(input->info()->dimension(0), input->info()->dimension(1),
+                                                 (kernel_width - 1) * dilation.width + 1, (kernel_height - 1) * dilation.height + 1,
                                                  conv_info);
 
     // Check if its a "fully connected" convolution
     _is_fully_connected_convolution = ((conv_w == 1) && (conv_h == 1));
 
+    // A 1x1 stride-1 convolution multiplies each pixel's channel vector by the weights matrix,
+    // so no im2col is needed: the direct convolution kernel reads the input in place and uses
+    // the weights as they come, removing the largest workspace and one full copy of the input
+    _run_direct_convolution = !_are_weights_reshaped && (kernel_width == 1) && (kernel_height == 1)
+                              && (stride_x == 1) && (stride_y == 1) && (pad_x == 0) && (pad_y == 0)
+                              && (dilation.width == 1) && (dilation.height == 1);
+
+    if(_run_direct_convolution)
+    {
+        // The direct kernel applies the bias itself and fuses the same activations as the
+        // matrix multiply kernel, so the whole layer collapses into a single kernel
+        _direct_conv_kernel.set_target(CLScheduler::get().target());
+        _direct_conv_kernel.configure(input, weights, biases, output, conv_info, act_info);
+        _original_weights_retained = true;
+
+        ARM_COMPUTE_ERROR_ON_MSG((output->info()->dimension(0) != conv_w) || (output->info()->dimension(1) != conv_h), "Output shape does not match the expected one");
+        return;
+    }
+
     unsigned int mat_weights_cols = weights->info()->dimension(3);
     unsigned int mat_weights_rows = weights->info()->dimension(0) * weights->info()->dimension(1) * weights->info()->dimension(2) + (_has_bias ? 1 : 0);
 
@@ -205,18 +230,18 @@ void CLConvolutionLayer::configure(const ICLTensor *input, const ICLTensor *weig
     _memory_group.manage(&_gemm_output);
 
     // Configure kernels
-    _input_im2col_kernel.configure(input, &_input_im2col_reshaped, Size2D(kernel_width, kernel_height), conv_info, _has_bias);
+    _input_im2col_kernel.configure(input, &_input_im2col_reshaped, Size2D(kernel_width, kernel_height), conv_info, _has_bias, dilation);
 
     // Configure matrix multiply
     if(_is_fully_connected_convolution)
     {
         // The matrix A and Matrix B have not been reshaped
-        _mm_kernel.configure(&_input_im2col_reshaped, weights, &_gemm_output, 1.0f, false);
+        _mm_kernel.configure(&_input_im2col_reshaped, weights, &_gemm_output, 1.0f, false, act_info);
     }
     else
     {
         _input_interleave_kernel.configure(&_input_im2col_reshaped, &_input_interleaved_reshaped);
-        _mm_kernel.configure(&_input_interleaved_reshaped, weights, &_gemm_output, 1.0f);
+        _mm_kernel.configure(&_input_interleaved_reshaped, weights, &_gemm_output, 1.0f, true, act_info);
         _input_interleaved_reshaped.allocator()->allocate();
     }
     _input_im2col_reshaped.allocator()->allocate();
@@ -232,29 +257,48 @@ void CLConvolutionLayer::configure(const ICLTensor *input, const ICLTensor *weig
     }
 }
 
-void CLConvolutionLayer::run()
+bool CLConvolutionLayer::original_weights_retained() const
 {
-    // Run weights reshaping (Runs once for every configure)
-    if(!_are_weights_reshaped)
+    return _original_weights_retained;
+}
+
+void CLConvolutionLayer::prepare()
+{
+    // Run weights reshaping (Runs once for every configure). The direct convolution
+    // path uses the original weights and never configures the reshape
+    if(!_are_weights_reshaped && !_run_direct_convolution)
     {
         _are_weights_reshaped = true;
         _reshape_weights.run();
     }
+}
+
+void CLConvolutionLayer::run()
+{
+    prepare();
 
     _memory_group.acquire();
 
-    // Run input reshaping
-    CLScheduler::get().enqueue(_input_im2col_kernel);
-    if(!_is_fully_connected_convolution)
+    if(_run_direct_convolution)
     {
-        CLScheduler::get().enqueue(_input_interleave_kernel);
+        // Run the 1x1 direct convolution, which reads the input in place
+        CLScheduler::get().enqueue(_direct_conv_kernel, false);
     }
+    else
+    {
+        // Run input reshaping
+        CLScheduler::get().enqueue(_input_im2col_kernel);
+        if(!_is_fully_connected_convolution)
+        {
+            CLScheduler::get().enqueue(_input_interleave_kernel);
+        }
 
-    // Runs matrix multiply on reshaped matrices
-    CLScheduler::get().enqueue(_mm_kernel);
+        // Runs matrix multiply on reshaped matrices
+        CLScheduler::get().enqueue(_mm_kernel);
 
-    // Reshape output matrix
-    CLScheduler::get().enqueue(_output_col2im_kernel, false);
+        // Reshape output matrix
+        CLScheduler::get().enqueue(_output_col2im_kernel, false);
+    }
 
     _memory_group.release();
 }
@@ -39,7 +39,7 @@ void CLDepthwiseSeparableConvolutionLayer::configure(ICLTensor *input, const ICL
                                                      ICLTensor           *output,
                                                      const PadStrideInfo &depthwise_conv_info, const PadStrideInfo &pointwise_conv_info)
 {
-    _depthwise_conv.configure(input, depthwise_out, depthwise_weights, depthwise_conv_info);
+    _depthwise_conv.configure(input, depthwise_out, depthwise_weights, nullptr, depthwise_conv_info);
     _pointwise_conv.configure(depthwise_out, pointwise_weights, biases, output, pointwise_conv_info);
 }
 
@@ -41,7 +41,7 @@ void CLFullyConnectedLayerReshapeWeights::configure(const ICLTensor *input, ICLT
 
 CLFullyConnectedLayer::CLFullyConnectedLayer(std::shared_ptr<IMemoryManager> memory_manager)
     : _memory_group(std::move(memory_manager)), _im2col_kernel(), _reshape_weights_kernel(), _mm_kernel(), _accumulate_biases_kernel(), _im2col_output(), _reshape_weights_output(),
-      _are_weights_reshaped(true), _is_fc_after_conv(true), _accumulate_biases(false)
+      _are_weights_reshaped(true), _is_fc_after_conv(true), _accumulate_biases(false), _original_weights_retained(true)
 {
 }
 
@@ -112,6 +112,8 @@ void CLFullyConnectedLayer::configure(const ICLTensor *input, const ICLTensor *w
     if(!_are_weights_reshaped)
     {
         weights_to_use = &_reshape_weights_output;
+        // The matrix multiply only reads the function's own reshaped copy after prepare()
+        _original_weights_retained = false;
 
         // Reshape the weights
         _reshape_weights_kernel.configure(weights, &_reshape_weights_output);
@@ -150,7 +152,12 @@ void CLFullyConnectedLayer::configure(const ICLTensor *input, const ICLTensor *w
     }
 }
 
-void CLFullyConnectedLayer::run()
+bool CLFullyConnectedLayer::original_weights_retained() const
+{
+    return _original_weights_retained;
+}
+
+void CLFullyConnectedLayer::prepare()
 {
     // Reshape of the weights (happens only once)
     if(!_are_weights_reshaped)
@@ -158,6 +165,11 @@ void CLFullyConnectedLayer::run()
         _are_weights_reshaped = true;
         _reshape_weights_kernel.run();
     }
+}
+
+void CLFullyConnectedLayer::run()
+{
+    prepare();
 
     _memory_group.acquire();
 
@@ -167,7 +179,7 @@ void CLFullyConnectedLayer::run()
         CLScheduler::get().enqueue(_im2col_kernel, false);
     }
 
-    // Run matrix multiply
+    // Run matrix multiply. The batch is folded into the rows of the product, so one dispatch covers the whole batch
     CLScheduler::get().enqueue(_mm_kernel, !_accumulate_biases);
 
     // Accumulate biases if provided
@@ -43,7 +43,7 @@ CLGEMM::CLGEMM(std::shared_ptr<IMemoryManager> memory_manager)
 {
 }
 
-void CLGEMM::configure(const ICLTensor *a, const ICLTensor *b, const ICLTensor *c, ICLTensor *output, float alpha, float beta)
+void CLGEMM::configure(const ICLTensor *a, const ICLTensor *b, const ICLTensor *c, ICLTensor *output, float alpha, float beta, const ActivationLayerInfo &act_info)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::QS8, DataType::QS16, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(a, b, output);
@@ -59,8 +59,12 @@ void CLGEMM::configure(const ICLTensor *a, const ICLTensor *b, const ICLTensor *
 
     ARM_COMPUTE_ERROR_ON_MSG(a->info()->dimension(0) != b->info()->dimension(1), "The product AB is defined only if the number of columns in A is equal to the number of rows in B");
 
-    // If the input tensor has less than 16 rows, we run a special version of GEMM without reshaping the input tensors
-    _is_interleaved_transposed = a->info()->dimension(1) > 16;
+    // The matrix addition kernel would run after the fused activation and corrupt the result
+    ARM_COMPUTE_ERROR_ON_MSG(act_info.enabled() && beta != 0 && c != nullptr, "Fused activation is not supported together with the addition of matrix C");
+
+    // If the input tensor has less than 16 rows, we run a special version of GEMM without reshaping the input tensors.
+    // Batched matrix multiplications also run without reshaping, as the non-reshaped kernel covers the whole batch in a single dispatch
+    _is_interleaved_transposed = a->info()->dimension(1) > 16 && a->info()->num_dimensions() < 3;
 
     const ICLTensor *matrix_a = a;
     const ICLTensor *matrix_b = b;
@@ -95,12 +99,11 @@ void CLGEMM::configure(const ICLTensor *a, const ICLTensor *b, const ICLTensor *
 
         // Configure transpose kernel
         _transpose_kernel.configure(b, &_tmp_b);
-
-        // Configure matrix multiply kernel
-        _mm_kernel.set_target(CLScheduler::get().target());
     }
 
-    _mm_kernel.configure(matrix_a, matrix_b, output, alpha, _is_interleaved_transposed);
+    // Configure matrix multiply kernel
+    _mm_kernel.set_target(CLScheduler::get().target());
+    _mm_kernel.configure(matrix_a, matrix_b, output, alpha, _is_interleaved_transposed, act_info);
 
     if(_is_interleaved_transposed)
     {
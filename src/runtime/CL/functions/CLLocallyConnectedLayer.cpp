@@ -116,7 +116,7 @@ void CLLocallyConnectedLayer::configure(const ICLTensor *input, const ICLTensor
     _gemm_output.allocator()->allocate();
 }
 
-void CLLocallyConnectedLayer::run()
+void CLLocallyConnectedLayer::prepare()
 {
     // Run weights reshaping (Runs once for every configure)
     if(_is_first_run)
@@ -124,6 +124,11 @@ void CLLocallyConnectedLayer::run()
         _is_first_run = false;
         CLScheduler::get().enqueue(_weights_reshape_kernel);
     }
+}
+
+void CLLocallyConnectedLayer::run()
+{
+    prepare();
 
     _memory_group.acquire();
 
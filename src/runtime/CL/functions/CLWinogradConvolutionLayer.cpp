@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/functions/CLWinogradConvolutionLayer.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/PixelValue.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+
+using namespace arm_compute;
+
+CLWinogradConvolutionLayer::CLWinogradConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager)
+    : _memory_group(std::move(memory_manager)), _border_handler(), _input_transform(), _filter_transform(), _batched_gemm(), _output_transform(), _input_transformed(), _filter_transformed(),
+      _batched_gemm_output(), _is_first_run(true)
+{
+}
+
+void CLWinogradConvolutionLayer::configure(ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights, output);
+    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(0) != 3 || weights->info()->dimension(1) != 3);
+    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(2) != input->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON_MSG(input->info()->num_dimensions() > 3, "Batched Winograd convolution is not supported");
+    ARM_COMPUTE_ERROR_ON(std::get<0>(conv_info.stride()) != 1 || std::get<1>(conv_info.stride()) != 1);
+
+    const unsigned int pad_x    = std::get<0>(conv_info.pad());
+    const unsigned int pad_y    = std::get<1>(conv_info.pad());
+    const unsigned int channels = input->info()->dimension(2);
+    const unsigned int filters  = weights->info()->dimension(3);
+
+    const unsigned int num_tiles_x = (input->info()->dimension(0) + pad_x * 2 - 2 + 1) / 2;
+    const unsigned int num_tiles_y = (input->info()->dimension(1) + pad_y * 2 - 2 + 1) / 2;
+    const unsigned int num_tiles   = num_tiles_x * num_tiles_y;
+
+    // Initialize the intermediate tensors: the 16 transform coefficients live on the z dimension
+    TensorShape input_transformed_shape(num_tiles, channels, 16);
+    _input_transformed.allocator()->init(TensorInfo(input_transformed_shape, 1, input->info()->data_type()));
+
+    TensorShape filter_transformed_shape(filters, channels, 16);
+    _filter_transformed.allocator()->init(TensorInfo(filter_transformed_shape, 1, weights->info()->data_type()));
+
+    TensorShape batched_gemm_output_shape(num_tiles, filters, 16);
+    _batched_gemm_output.allocator()->init(TensorInfo(batched_gemm_output_shape, 1, input->info()->data_type()));
+
+    // Manage intermediate buffers. The transformed filters are reused across runs and stay allocated
+    _memory_group.manage(&_input_transformed);
+    _memory_group.manage(&_batched_gemm_output);
+
+    // Configure kernels
+    _input_transform.configure(input, &_input_transformed, conv_info);
+    _filter_transform.configure(weights, &_filter_transformed);
+    _batched_gemm.configure(&_input_transformed, &_filter_transformed, &_batched_gemm_output);
+    _output_transform.configure(&_batched_gemm_output, biases, output, num_tiles_x);
+
+    // Configure border handler: the tile reads run over the input borders
+    _border_handler.configure(input, _input_transform.border_size(), BorderMode::CONSTANT, PixelValue(0));
+
+    // Allocate intermediate tensors
+    _input_transformed.allocator()->allocate();
+    _filter_transformed.allocator()->allocate();
+    _batched_gemm_output.allocator()->allocate();
+}
+
+void CLWinogradConvolutionLayer::prepare()
+{
+    // The filters only need transforming when they change
+    if(_is_first_run)
+    {
+        CLScheduler::get().enqueue(_filter_transform, false);
+        _is_first_run = false;
+    }
+}
+
+void CLWinogradConvolutionLayer::run()
+{
+    prepare();
+
+    _memory_group.acquire();
+
+    CLScheduler::get().enqueue(_border_handler, false);
+    CLScheduler::get().enqueue(_input_transform, false);
+    CLScheduler::get().enqueue(_batched_gemm, false);
+    CLScheduler::get().enqueue(_output_transform);
+
+    _memory_group.release();
+}
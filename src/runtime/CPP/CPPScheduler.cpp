@@ -27,15 +27,330 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Utils.h"
+#include "support/ToolchainSupport.h"
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
+#include <functional>
 #include <iostream>
 #include <mutex>
 #include <system_error>
 #include <thread>
+#include <vector>
+
+#if !defined(BARE_METAL) && defined(__linux__)
+#include <fstream>
+#include <pthread.h>
+#include <sched.h>
+#include <string>
+#endif /* !defined(BARE_METAL) && defined(__linux__) */
 
 namespace arm_compute
 {
+namespace
+{
+/** Chunked execution state shared by all threads taking part in a work-stealing run */
+struct StealableChunks
+{
+    /** Create the chunk pool
+     *
+     * @param[in] num_chunks Total number of chunks the window has been split into.
+     */
+    explicit StealableChunks(unsigned int num_chunks)
+        : claimed(num_chunks), workspaces(num_chunks, nullptr)
+    {
+        for(auto &flag : claimed)
+        {
+            flag.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    std::vector<std::atomic<bool>> claimed;    /**< One claim flag per chunk: set by the first thread to execute the chunk. */
+    std::vector<void *>            workspaces; /**< One scratch arena per chunk, matching the per-chunk thread ids. */
+};
+
+uint64_t now_ns();
+
+/** Cancellation bindings of one dispatch.
+ *
+ * The cancellation flag and deadline are thread-affine to the dispatching thread
+ * (see @ref IScheduler::set_cancellation_flag), so they are snapshotted there before the
+ * worker threads start and polled by the workers between window chunks.
+ */
+struct CancelPoint
+{
+    const std::atomic<bool> *flag{ nullptr };  /**< Cancellation flag bound to the dispatching thread, nullptr if none. */
+    uint64_t                 deadline_ns{ 0 }; /**< Deadline bound to the dispatching thread, 0 if none. */
+
+    /** Snapshot the calling thread's bindings. */
+    static CancelPoint capture()
+    {
+        CancelPoint cancel;
+        cancel.flag        = IScheduler::cancellation_flag();
+        cancel.deadline_ns = IScheduler::dispatch_deadline();
+        return cancel;
+    }
+
+    /** True when the dispatch must stop claiming further work. */
+    bool expired() const
+    {
+        if(flag != nullptr && flag->load(std::memory_order_relaxed))
+        {
+            return true;
+        }
+        return deadline_ns != 0 && now_ns() >= deadline_ns;
+    }
+};
+
+/** Execute a kernel over a set of stealable window chunks.
+ *
+ * Each thread first walks the chunks it owns from front to back, then scans the other threads'
+ * chunks from back to front (i.e. steals the work furthest away from the owner's current position).
+ *
+ * Every chunk executes as its own virtual thread (thread_id == chunk id, num_threads == number
+ * of chunks, private scratch arena), so the kernel-facing ThreadInfo contract - one run() call
+ * per reported thread - holds no matter how the chunks are distributed over the pool.
+ *
+ * @param[in] kernel          Kernel to execute.
+ * @param[in] max_window      Maximum window of the kernel.
+ * @param[in] split_dimension Dimension along which the window has been split.
+ * @param[in] num_chunks      Total number of chunks.
+ * @param[in] chunks          Shared chunk claim flags.
+ * @param[in] cancel          Cancellation bindings of the dispatch, polled between chunks.
+ * @param[in] info            Thread related information.
+ */
+void run_stealable_chunks(ICPPKernel *kernel, const Window &max_window, unsigned int split_dimension, unsigned int num_chunks, StealableChunks &chunks, const CancelPoint &cancel, const ThreadInfo &info)
+{
+    const unsigned int chunks_per_thread = num_chunks / info.num_threads;
+    const unsigned int first_own_chunk   = info.thread_id * chunks_per_thread;
+
+    auto run_chunk = [&](unsigned int chunk_id)
+    {
+        if(!chunks.claimed[chunk_id].exchange(true))
+        {
+            Window win = max_window.split_window(split_dimension, chunk_id, num_chunks);
+            win.validate();
+            // Each chunk runs as its own virtual thread: exactly num_threads run() calls are
+            // made in total, each with a distinct thread id and its own scratch arena. This
+            // preserves the contracts of kernels which stripe work by thread id and of
+            // reductions which count run() arrivals, regardless of which pool thread ends up
+            // claiming which chunk.
+            ThreadInfo chunk_info  = info;
+            chunk_info.thread_id   = static_cast<int>(chunk_id);
+            chunk_info.num_threads = static_cast<int>(num_chunks);
+            chunk_info.workspace   = chunks.workspaces[chunk_id];
+            kernel->run(win, chunk_info);
+        }
+    };
+
+    // Owned chunks, front to back
+    for(unsigned int c = 0; c < chunks_per_thread; ++c)
+    {
+        if(cancel.expired())
+        {
+            return;
+        }
+        run_chunk(first_own_chunk + c);
+    }
+    // Remaining chunks (including the remainder chunks not owned by anyone), back to front
+    for(unsigned int c = num_chunks; c > 0; --c)
+    {
+        if(cancel.expired())
+        {
+            return;
+        }
+        run_chunk(c - 1);
+    }
+}
+/** Description of one CPU core used to build the affinity masks */
+struct CoreDesc
+{
+    unsigned int cpu;     /**< Linux CPU id */
+    CPUCluster   cluster; /**< Cluster the core belongs to */
+};
+
+/** Enumerate the CPU cores and classify them into big/LITTLE clusters.
+ *
+ * Reuses the /proc/cpuinfo "CPU part" information already used for CPUInfo detection:
+ * the cores carrying the highest part id present in the system form the big cluster,
+ * all the others the LITTLE one. On single-cluster systems every core is reported as big.
+ *
+ * @return One entry per online core. Empty if the information is not available.
+ */
+std::vector<CoreDesc> enumerate_cores()
+{
+    std::vector<CoreDesc> cores;
+#if !defined(BARE_METAL) && defined(__linux__)
+    std::ifstream             cpuinfo("/proc/cpuinfo");
+    std::string               line;
+    std::vector<unsigned int> parts;
+    int                       current_cpu = -1;
+
+    while(std::getline(cpuinfo, line))
+    {
+        if(line.compare(0, 9, "processor") == 0)
+        {
+            current_cpu = strtol(line.substr(line.find(':') + 1).c_str(), nullptr, 0);
+            cores.push_back(CoreDesc{ static_cast<unsigned int>(current_cpu), CPUCluster::Unknown });
+            parts.push_back(0);
+        }
+        else if(current_cpu >= 0 && line.compare(0, 8, "CPU part") == 0)
+        {
+            parts.back() = strtoul(line.substr(line.find(':') + 1).c_str(), nullptr, 0);
+        }
+    }
+
+    if(!cores.empty())
+    {
+        const unsigned int max_part = *std::max_element(parts.begin(), parts.end());
+        for(size_t i = 0; i < cores.size(); ++i)
+        {
+            cores[i].cluster = (parts[i] == max_part) ? CPUCluster::Big : CPUCluster::Little;
+        }
+    }
+#endif /* !defined(BARE_METAL) && defined(__linux__) */
+    return cores;
+}
+
+/** List the CPUs belonging to a NUMA node, from /sys/devices/system/node.
+ *
+ * @param[in] numa_node Node to query.
+ *
+ * @return The node's CPU ids. Empty if the node does not exist or the kernel has no NUMA support.
+ */
+std::vector<unsigned int> numa_node_cpus(int numa_node)
+{
+    std::vector<unsigned int> cpus;
+#if !defined(BARE_METAL) && defined(__linux__)
+    std::ifstream cpulist("/sys/devices/system/node/node" + std::to_string(numa_node) + "/cpulist");
+    std::string   range;
+    while(std::getline(cpulist, range, ','))
+    {
+        const size_t       dash  = range.find('-');
+        const unsigned int first = strtoul(range.c_str(), nullptr, 10);
+        const unsigned int last  = (dash == std::string::npos) ? first : strtoul(range.c_str() + dash + 1, nullptr, 10);
+        for(unsigned int cpu = first; cpu <= last; ++cpu)
+        {
+            cpus.push_back(cpu);
+        }
+    }
+#else  /* !defined(BARE_METAL) && defined(__linux__) */
+    ARM_COMPUTE_UNUSED(numa_node);
+#endif /* !defined(BARE_METAL) && defined(__linux__) */
+    return cpus;
+}
+
+/** Current timestamp of a monotonic clock, in nanoseconds. Used for telemetry events. */
+uint64_t now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/** Busy-wait until @p predicate returns true or @p spin_us microseconds have elapsed.
+ *
+ * @param[in] predicate Condition to poll.
+ * @param[in] spin_us   Maximum time to spin in microseconds.
+ *
+ * @return The last value returned by the predicate.
+ */
+template <typename Predicate>
+bool spin_until(Predicate &&predicate, unsigned int spin_us)
+{
+    if(spin_us == 0)
+    {
+        return predicate();
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(spin_us);
+    do
+    {
+        if(predicate())
+        {
+            return true;
+        }
+    }
+    while(std::chrono::steady_clock::now() < deadline);
+
+    return predicate();
+}
+} // namespace
+
+/** Serializes concurrent dispatching threads' entries into the worker pool, with a priority lane.
+ *
+ * Only one dispatch owns the pool at a time. When several threads wait for it, Interactive
+ * dispatchers (see @ref IScheduler::set_caller_priority) are admitted first: a latency-critical
+ * caller waits at most for the kernel currently on the pool, never for the backlog of kernels
+ * another caller still has waiting at the gate or in the asynchronous queue.
+ */
+class PoolGate
+{
+public:
+    /** Take ownership of the pool, waiting until it is free.
+     *
+     * @param[in] interactive True to enter through the priority lane.
+     */
+    void acquire(bool interactive)
+    {
+        std::unique_lock<std::mutex> lock(_m);
+        if(interactive)
+        {
+            ++_waiting_interactive;
+            _cv.wait(lock, [&] { return !_busy; });
+            --_waiting_interactive;
+        }
+        else
+        {
+            // Normal entries hold back while an interactive dispatcher is waiting
+            _cv.wait(lock, [&] { return !_busy && _waiting_interactive == 0; });
+        }
+        _busy = true;
+    }
+
+    /** Release ownership of the pool. */
+    void release()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_m);
+            _busy = false;
+        }
+        _cv.notify_all();
+    }
+
+private:
+    std::mutex              _m;
+    std::condition_variable _cv;
+    bool                    _busy{ false };
+    unsigned int            _waiting_interactive{ 0 };
+};
+
+/** Scoped ownership of a @ref PoolGate, entered with the calling thread's priority. */
+class PoolGateLock
+{
+public:
+    /** Acquire the gate for the duration of the scope.
+     *
+     * @param[in] gate Gate guarding the pool.
+     */
+    explicit PoolGateLock(PoolGate &gate)
+        : _gate(gate)
+    {
+        _gate.acquire(IScheduler::caller_priority() == IScheduler::Priority::Interactive);
+    }
+
+    PoolGateLock(const PoolGateLock &) = delete;
+    PoolGateLock &operator=(const PoolGateLock &) = delete;
+
+    ~PoolGateLock()
+    {
+        _gate.release();
+    }
+
+private:
+    PoolGate &_gate;
+};
+
 class Thread
 {
 public:
@@ -50,32 +365,55 @@ public:
     /** Destructor. Make the thread join. */
     ~Thread();
 
-    /** Request the worker thread to start executing the given kernel
-     * This function will return as soon as the kernel has been sent to the worker thread.
+    /** Request the worker thread to start executing the given workload
+     * This function will return as soon as the workload has been sent to the worker thread.
      * wait() needs to be called to ensure the execution is complete.
      */
-    void start(ICPPKernel *kernel, const Window &window, const ThreadInfo &info);
+    void start(std::function<void()> workload);
 
-    /** Wait for the current kernel execution to complete. */
+    /** Wait for the current workload execution to complete. */
     void wait();
 
+    /** Sets the time the thread busy-waits before parking, both when waiting for
+     * new work and when the dispatcher waits for this thread's completion.
+     *
+     * @param[in] spin_wait_us Spin duration in microseconds. 0 parks immediately.
+     */
+    void set_spin_wait_duration(unsigned int spin_wait_us);
+
+    /** Pin the worker thread to the given CPU and record the cluster the CPU belongs to.
+     *
+     * @param[in] cpu     Linux CPU id to pin the thread to.
+     * @param[in] cluster Cluster the CPU belongs to.
+     */
+    void set_affinity(unsigned int cpu, CPUCluster cluster);
+
+    /** Remove any core pinning from the worker thread. */
+    void clear_affinity();
+
+    /** Returns the cluster the thread is pinned to.
+     *
+     * @return The cluster, CPUCluster::Unknown when the thread is not pinned.
+     */
+    CPUCluster cluster() const;
+
     /** Function ran by the worker thread. */
     void worker_thread();
 
 private:
     std::thread             _thread;
-    ICPPKernel             *_kernel{ nullptr };
-    Window                  _window;
-    ThreadInfo              _info;
+    std::function<void()>   _workload{ nullptr };
     std::mutex              _m;
     std::condition_variable _cv;
-    bool                    _wait_for_work{ false };
-    bool                    _job_complete{ true };
+    std::atomic<bool>       _wait_for_work{ false };
+    std::atomic<bool>       _job_complete{ true };
+    unsigned int            _spin_wait_us{ 0 };
+    CPUCluster              _cluster{ CPUCluster::Unknown };
     std::exception_ptr      _current_exception;
 };
 
 Thread::Thread()
-    : _thread(), _window(), _info(), _m(), _cv(), _current_exception(nullptr)
+    : _thread(), _m(), _cv(), _current_exception(nullptr)
 {
     _thread = std::thread(&Thread::worker_thread, this);
 }
@@ -85,30 +423,31 @@ Thread::~Thread()
     // Make sure worker thread has ended
     if(_thread.joinable())
     {
-        start(nullptr, Window(), ThreadInfo());
+        start(nullptr);
         _thread.join();
     }
 }
 
-void Thread::start(ICPPKernel *kernel, const Window &window, const ThreadInfo &info)
+void Thread::start(std::function<void()> workload)
 {
-    _kernel = kernel;
-    _window = window;
-    _info   = info;
+    _workload = std::move(workload);
 
     {
         std::lock_guard<std::mutex> lock(_m);
-        _wait_for_work = true;
-        _job_complete  = false;
+        _job_complete.store(false, std::memory_order_relaxed);
+        _wait_for_work.store(true, std::memory_order_release);
     }
     _cv.notify_one();
 }
 
 void Thread::wait()
 {
+    // Spin first: for small kernels the completion flag is usually already set,
+    // which saves the futex round-trip of the blocking wait.
+    if(!spin_until([&] { return _job_complete.load(std::memory_order_acquire); }, _spin_wait_us))
     {
         std::unique_lock<std::mutex> lock(_m);
-        _cv.wait(lock, [&] { return _job_complete; });
+        _cv.wait(lock, [&] { return _job_complete.load(std::memory_order_acquire); });
     }
 
     if(_current_exception)
@@ -117,47 +456,236 @@ void Thread::wait()
     }
 }
 
+void Thread::set_spin_wait_duration(unsigned int spin_wait_us)
+{
+    _spin_wait_us = spin_wait_us;
+}
+
+void Thread::set_affinity(unsigned int cpu, CPUCluster cluster)
+{
+    _cluster = cluster;
+#if !defined(BARE_METAL) && defined(__linux__)
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(cpu, &cpuset);
+    pthread_setaffinity_np(_thread.native_handle(), sizeof(cpu_set_t), &cpuset);
+#else  /* !defined(BARE_METAL) && defined(__linux__) */
+    ARM_COMPUTE_UNUSED(cpu);
+#endif /* !defined(BARE_METAL) && defined(__linux__) */
+}
+
+void Thread::clear_affinity()
+{
+    _cluster = CPUCluster::Unknown;
+#if !defined(BARE_METAL) && defined(__linux__)
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    for(unsigned int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+    {
+        CPU_SET(cpu, &cpuset);
+    }
+    pthread_setaffinity_np(_thread.native_handle(), sizeof(cpu_set_t), &cpuset);
+#endif /* !defined(BARE_METAL) && defined(__linux__) */
+}
+
+CPUCluster Thread::cluster() const
+{
+    return _cluster;
+}
+
 void Thread::worker_thread()
 {
     while(true)
     {
-        std::unique_lock<std::mutex> lock(_m);
-        _cv.wait(lock, [&] { return _wait_for_work; });
-        _wait_for_work = false;
+        // Spin-then-park: stay in userspace if the next dispatch arrives within the spin window.
+        if(!spin_until([&] { return _wait_for_work.load(std::memory_order_acquire); }, _spin_wait_us))
+        {
+            std::unique_lock<std::mutex> lock(_m);
+            _cv.wait(lock, [&] { return _wait_for_work.load(std::memory_order_acquire); });
+        }
+        _wait_for_work.store(false, std::memory_order_relaxed);
 
         _current_exception = nullptr;
 
         // Time to exit
-        if(_kernel == nullptr)
+        if(_workload == nullptr)
         {
             return;
         }
 
         try
         {
-            _window.validate();
-            _kernel->run(_window, _info);
+            _workload();
         }
         catch(...)
         {
             _current_exception = std::current_exception();
         }
 
-        _job_complete = true;
-        lock.unlock();
+        {
+            std::lock_guard<std::mutex> lock(_m);
+            _job_complete.store(true, std::memory_order_release);
+        }
         _cv.notify_one();
     }
 }
 
+/** FIFO queue which executes asynchronously submitted kernels on a dedicated dispatcher thread.
+ *
+ * Kernels run strictly in submission order, so a submission's dependencies are implicitly
+ * satisfied as long as they refer to earlier tickets (which submit() validates).
+ */
+class AsyncKernelQueue
+{
+public:
+    using Ticket = IScheduler::Ticket;
+
+    /** Create the queue and start the dispatcher thread.
+     *
+     * @param[in] execute Callback used to run one kernel on the scheduler's thread pool.
+     */
+    explicit AsyncKernelQueue(std::function<void(ICPPKernel *, unsigned int)> execute)
+        : _execute(std::move(execute)), _thread(&AsyncKernelQueue::dispatcher, this)
+    {
+    }
+
+    AsyncKernelQueue(const AsyncKernelQueue &) = delete;
+    AsyncKernelQueue &operator=(const AsyncKernelQueue &) = delete;
+
+    /** Destructor: drain the queue and join the dispatcher thread. */
+    ~AsyncKernelQueue()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_m);
+            _exit = true;
+        }
+        _cv_submit.notify_one();
+        _thread.join();
+    }
+
+    /** Queue a kernel for execution.
+     *
+     * @param[in] kernel          Kernel to execute.
+     * @param[in] split_dimension Dimension along which to split the kernel's execution window.
+     * @param[in] dependencies    Tickets this kernel depends on; must all be earlier submissions.
+     *
+     * @return The ticket identifying this submission.
+     */
+    Ticket submit(ICPPKernel *kernel, unsigned int split_dimension, const std::vector<Ticket> &dependencies)
+    {
+        std::lock_guard<std::mutex> lock(_m);
+        for(Ticket dep : dependencies)
+        {
+            ARM_COMPUTE_UNUSED(dep);
+            ARM_COMPUTE_ERROR_ON_MSG(dep > _next_ticket, "Dependencies must refer to previously submitted kernels");
+        }
+        const Ticket ticket = ++_next_ticket;
+        _jobs.push_back(Job{ kernel, split_dimension, ticket });
+        _cv_submit.notify_one();
+        return ticket;
+    }
+
+    /** Block until the given submission has executed.
+     *
+     * @param[in] ticket Ticket returned by submit().
+     */
+    void wait_for(Ticket ticket)
+    {
+        std::unique_lock<std::mutex> lock(_m);
+        _cv_done.wait(lock, [&] { return _completed >= ticket; });
+        rethrow_pending(lock);
+    }
+
+    /** Block until every submission has executed. */
+    void wait_all()
+    {
+        std::unique_lock<std::mutex> lock(_m);
+        const Ticket last = _next_ticket;
+        _cv_done.wait(lock, [&] { return _completed >= last; });
+        rethrow_pending(lock);
+    }
+
+private:
+    struct Job
+    {
+        ICPPKernel  *kernel;
+        unsigned int split_dimension;
+        Ticket       ticket;
+    };
+
+    /** Rethrow the first exception raised by a queued kernel, if any. Expects @p lock to be held. */
+    void rethrow_pending(std::unique_lock<std::mutex> &lock)
+    {
+        ARM_COMPUTE_UNUSED(lock);
+        if(_exception != nullptr)
+        {
+            std::exception_ptr e = _exception;
+            _exception           = nullptr;
+            std::rethrow_exception(e);
+        }
+    }
+
+    /** Function ran by the dispatcher thread. */
+    void dispatcher()
+    {
+        while(true)
+        {
+            Job job{};
+            {
+                std::unique_lock<std::mutex> lock(_m);
+                _cv_submit.wait(lock, [&] { return _exit || !_jobs.empty(); });
+                if(_jobs.empty())
+                {
+                    return;
+                }
+                job = _jobs.front();
+                _jobs.pop_front();
+            }
+
+            try
+            {
+                _execute(job.kernel, job.split_dimension);
+            }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(_m);
+                if(_exception == nullptr)
+                {
+                    _exception = std::current_exception();
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(_m);
+                _completed = job.ticket;
+            }
+            _cv_done.notify_all();
+        }
+    }
+
+    std::function<void(ICPPKernel *, unsigned int)> _execute;
+    std::mutex              _m;
+    std::condition_variable _cv_submit;
+    std::condition_variable _cv_done;
+    std::deque<Job>         _jobs{};
+    Ticket                  _next_ticket{ 0 };
+    Ticket                  _completed{ 0 };
+    bool                    _exit{ false };
+    std::exception_ptr      _exception{ nullptr };
+    std::thread             _thread;
+};
+
 CPPScheduler &CPPScheduler::get()
 {
     static CPPScheduler scheduler;
     return scheduler;
 }
 
-CPPScheduler::CPPScheduler()
-    : _num_threads(std::thread::hardware_concurrency()),
-      _threads(_num_threads - 1)
+CPPScheduler::CPPScheduler(unsigned int num_threads)
+    : _num_threads(num_threads == 0 ? std::thread::hardware_concurrency() : num_threads),
+      _mode(Mode::Static),
+      _threads(_num_threads - 1),
+      _pool_gate(support::cpp14::make_unique<PoolGate>())
 {
 }
 
@@ -165,6 +693,92 @@ void CPPScheduler::set_num_threads(unsigned int num_threads)
 {
     _num_threads = num_threads == 0 ? std::thread::hardware_concurrency() : num_threads;
     _threads.resize(_num_threads - 1);
+    apply_affinity_policy();
+}
+
+void CPPScheduler::set_numa_node(int numa_node)
+{
+    if(numa_node < 0)
+    {
+        for(auto &thread : _threads)
+        {
+            thread.clear_affinity();
+        }
+        return;
+    }
+
+    const std::vector<unsigned int> cpus = numa_node_cpus(numa_node);
+    if(cpus.empty())
+    {
+        return;
+    }
+
+    // The node's cores usually all belong to the same cluster; look their cluster up so
+    // ThreadInfo keeps reporting it correctly.
+    const std::vector<CoreDesc> cores = enumerate_cores();
+    unsigned int                i     = 0;
+    for(auto &thread : _threads)
+    {
+        const unsigned int cpu     = cpus[i++ % cpus.size()];
+        CPUCluster         cluster = CPUCluster::Unknown;
+        for(const auto &core : cores)
+        {
+            if(core.cpu == cpu)
+            {
+                cluster = core.cluster;
+                break;
+            }
+        }
+        thread.set_affinity(cpu, cluster);
+    }
+}
+
+void CPPScheduler::set_affinity_policy(AffinityPolicy policy)
+{
+    IScheduler::set_affinity_policy(policy);
+    apply_affinity_policy();
+}
+
+void CPPScheduler::apply_affinity_policy()
+{
+    if(_affinity_policy == AffinityPolicy::None)
+    {
+        for(auto &thread : _threads)
+        {
+            thread.clear_affinity();
+        }
+        return;
+    }
+
+    const std::vector<CoreDesc> cores = enumerate_cores();
+    if(cores.empty())
+    {
+        return;
+    }
+
+    // Build the list of candidate cores for the requested policy
+    std::vector<CoreDesc> candidates;
+    for(const auto &core : cores)
+    {
+        if((_affinity_policy == AffinityPolicy::OnePerCore)
+           || (_affinity_policy == AffinityPolicy::PinToBig && core.cluster == CPUCluster::Big)
+           || (_affinity_policy == AffinityPolicy::PinToLittle && core.cluster == CPUCluster::Little))
+        {
+            candidates.push_back(core);
+        }
+    }
+    // Single-cluster system: fall back to the whole core list
+    if(candidates.empty())
+    {
+        candidates = cores;
+    }
+
+    unsigned int i = 0;
+    for(auto &thread : _threads)
+    {
+        const CoreDesc &core = candidates[i++ % candidates.size()];
+        thread.set_affinity(core.cpu, core.cluster);
+    }
 }
 
 unsigned int CPPScheduler::num_threads() const
@@ -172,29 +786,548 @@ unsigned int CPPScheduler::num_threads() const
     return _num_threads;
 }
 
+void CPPScheduler::set_mode(Mode mode)
+{
+    _mode = mode;
+}
+
+CPPScheduler::Mode CPPScheduler::mode() const
+{
+    return _mode;
+}
+
+void CPPScheduler::schedule(ICPPKernel *kernel, unsigned int split_dimension_0, unsigned int split_dimension_1)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
+    ARM_COMPUTE_ERROR_ON(split_dimension_0 == split_dimension_1);
+
+    // Keep synchronous dispatches ordered with respect to asynchronous submissions;
+    // Interactive callers overtake the queue at the pool gate instead of draining it
+    if(_async_queue != nullptr && caller_priority() == Priority::Normal)
+    {
+        _async_queue->wait_all();
+    }
+
+    prepare_workspaces(_num_threads);
+
+    ThreadInfo info;
+    info.cpu_info       = _info;
+    info.workspace      = thread_workspace(0);
+    info.workspace_size = workspace_size();
+
+    const Window      &max_window       = kernel->window();
+    const unsigned int num_iterations_0 = max_window.num_iterations(split_dimension_0);
+    const unsigned int num_iterations_1 = max_window.num_iterations(split_dimension_1);
+
+    if(num_iterations_0 == 0 || num_iterations_1 == 0)
+    {
+        return;
+    }
+
+    // Small workloads are not worth the worker wake-up latency: run them inline
+    if(_inline_cost_threshold != 0 && num_iterations_0 * num_iterations_1 * kernel->cost_per_iteration() <= _inline_cost_threshold)
+    {
+        run_instrumented(kernel, split_dimension_0, num_iterations_0 * num_iterations_1, info, [&] { kernel->run(max_window, info); });
+        return;
+    }
+
+    // Factorize the thread count into the MxN tile grid which keeps most threads busy
+    const unsigned int pool_size = concurrency_limit(kernel);
+    unsigned int       grid_0    = 1;
+    unsigned int       grid_1    = 1;
+    for(unsigned int m = 1; m <= pool_size; ++m)
+    {
+        if(pool_size % m != 0)
+        {
+            continue;
+        }
+        const unsigned int candidate_0 = std::min(m, num_iterations_0);
+        const unsigned int candidate_1 = std::min(pool_size / m, num_iterations_1);
+        if(candidate_0 * candidate_1 > grid_0 * grid_1)
+        {
+            grid_0 = candidate_0;
+            grid_1 = candidate_1;
+        }
+    }
+    info.num_threads = grid_0 * grid_1;
+
+    if(!kernel->is_parallelisable() || info.num_threads == 1)
+    {
+        run_instrumented(kernel, split_dimension_0, num_iterations_0 * num_iterations_1, info, [&] { kernel->run(max_window, info); });
+        return;
+    }
+
+    PoolGateLock pool_lock(*_pool_gate);
+
+    int  t         = 0;
+    auto thread_it = _threads.begin();
+
+    for(; t < info.num_threads - 1; ++t, ++thread_it)
+    {
+        Window win = max_window.split_window(split_dimension_0, t % grid_0, grid_0);
+        win        = win.split_window(split_dimension_1, t / grid_0, grid_1);
+        info.thread_id = t;
+        info.cluster   = thread_it->cluster();
+        info.workspace = thread_workspace(t);
+        thread_it->set_spin_wait_duration(_spin_wait_us);
+        thread_it->start([this, kernel, win, info, split_dimension_0, num_iterations_0, num_iterations_1]
+        {
+            run_instrumented(kernel, split_dimension_0, num_iterations_0 * num_iterations_1, info, [&]
+            {
+                win.validate();
+                kernel->run(win, info);
+            });
+        });
+    }
+
+    // Run last tile on main thread
+    Window win = max_window.split_window(split_dimension_0, t % grid_0, grid_0);
+    win        = win.split_window(split_dimension_1, t / grid_0, grid_1);
+    info.thread_id = t;
+    info.cluster   = CPUCluster::Unknown;
+    info.workspace = thread_workspace(t);
+    run_instrumented(kernel, split_dimension_0, num_iterations_0 * num_iterations_1, info, [&]
+    {
+        win.validate();
+        kernel->run(win, info);
+    });
+
+    try
+    {
+        for(auto &thread : _threads)
+        {
+            thread.wait();
+        }
+    }
+    catch(const std::system_error &e)
+    {
+        std::cerr << "Caught system_error with code " << e.code() << " meaning " << e.what() << '\n';
+    }
+}
+
+void CPPScheduler::schedule_concurrent(ICPPKernel *kernel_0, unsigned int split_dimension_0, ICPPKernel *kernel_1, unsigned int split_dimension_1)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(kernel_0 == nullptr || kernel_1 == nullptr, "Both kernels of a concurrent dispatch must be set");
+
+    // Keep synchronous dispatches ordered with respect to asynchronous submissions;
+    // Interactive callers overtake the queue at the pool gate instead of draining it
+    if(_async_queue != nullptr && caller_priority() == Priority::Normal)
+    {
+        _async_queue->wait_all();
+    }
+
+    const unsigned int num_iterations_0 = kernel_0->window().num_iterations(split_dimension_0);
+    const unsigned int num_iterations_1 = kernel_1->window().num_iterations(split_dimension_1);
+
+    // Without at least one thread for each kernel there is nothing to partition
+    if(_num_threads < 2 || num_iterations_0 == 0 || num_iterations_1 == 0)
+    {
+        if(num_iterations_0 != 0)
+        {
+            schedule(kernel_0, split_dimension_0);
+        }
+        if(num_iterations_1 != 0)
+        {
+            schedule(kernel_1, split_dimension_1);
+        }
+        return;
+    }
+
+    prepare_workspaces(_num_threads);
+
+    PoolGateLock pool_lock(*_pool_gate);
+
+    // Partition the pool: the first kernel gets at most its concurrency limit and always
+    // leaves at least one thread for the second
+    unsigned int num_threads_0 = std::min(std::min(num_iterations_0, concurrency_limit(kernel_0)), _num_threads - 1);
+    if(!kernel_0->is_parallelisable())
+    {
+        num_threads_0 = 1;
+    }
+    unsigned int num_threads_1 = std::min(num_iterations_1, std::min(concurrency_limit(kernel_1), _num_threads - num_threads_0));
+    if(!kernel_1->is_parallelisable())
+    {
+        num_threads_1 = 1;
+    }
+
+    ThreadInfo info;
+    info.cpu_info       = _info;
+    info.workspace_size = workspace_size();
+
+    unsigned int slot      = 0;
+    auto         thread_it = _threads.begin();
+
+    // All shares of the first kernel run on worker threads
+    for(unsigned int t = 0; t < num_threads_0; ++t, ++thread_it, ++slot)
+    {
+        Window win       = kernel_0->window().split_window(split_dimension_0, t, num_threads_0);
+        info.thread_id   = t;
+        info.num_threads = num_threads_0;
+        info.cluster     = thread_it->cluster();
+        info.workspace   = thread_workspace(slot);
+        thread_it->set_spin_wait_duration(_spin_wait_us);
+        thread_it->start([this, kernel_0, win, info, split_dimension_0, num_iterations_0]
+        {
+            run_instrumented(kernel_0, split_dimension_0, num_iterations_0, info, [&]
+            {
+                win.validate();
+                kernel_0->run(win, info);
+            });
+        });
+    }
+
+    // The second kernel runs on the remaining workers, with its last share on the main thread
+    for(unsigned int t = 0; t + 1 < num_threads_1; ++t, ++thread_it, ++slot)
+    {
+        Window win       = kernel_1->window().split_window(split_dimension_1, t, num_threads_1);
+        info.thread_id   = t;
+        info.num_threads = num_threads_1;
+        info.cluster     = thread_it->cluster();
+        info.workspace   = thread_workspace(slot);
+        thread_it->set_spin_wait_duration(_spin_wait_us);
+        thread_it->start([this, kernel_1, win, info, split_dimension_1, num_iterations_1]
+        {
+            run_instrumented(kernel_1, split_dimension_1, num_iterations_1, info, [&]
+            {
+                win.validate();
+                kernel_1->run(win, info);
+            });
+        });
+    }
+
+    Window win       = kernel_1->window().split_window(split_dimension_1, num_threads_1 - 1, num_threads_1);
+    info.thread_id   = num_threads_1 - 1;
+    info.num_threads = num_threads_1;
+    info.cluster     = CPUCluster::Unknown;
+    info.workspace   = thread_workspace(slot);
+    run_instrumented(kernel_1, split_dimension_1, num_iterations_1, info, [&]
+    {
+        win.validate();
+        kernel_1->run(win, info);
+    });
+
+    try
+    {
+        for(auto &thread : _threads)
+        {
+            thread.wait();
+        }
+    }
+    catch(const std::system_error &e)
+    {
+        std::cerr << "Caught system_error with code " << e.code() << " meaning " << e.what() << '\n';
+    }
+}
+
 void CPPScheduler::schedule(ICPPKernel *kernel, unsigned int split_dimension)
+{
+    // Keep synchronous dispatches ordered with respect to asynchronous submissions;
+    // Interactive callers overtake the queue at the pool gate instead of draining it
+    if(_async_queue != nullptr && caller_priority() == Priority::Normal)
+    {
+        _async_queue->wait_all();
+    }
+    execute(kernel, kernel->window(), tuned_split_dimension(kernel, split_dimension));
+}
+
+void CPPScheduler::schedule_window(ICPPKernel *kernel, const Window &window, unsigned int split_dimension)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
+
+    // Keep synchronous dispatches ordered with respect to asynchronous submissions;
+    // Interactive callers overtake the queue at the pool gate instead of draining it
+    if(_async_queue != nullptr && caller_priority() == Priority::Normal)
+    {
+        _async_queue->wait_all();
+    }
+    execute(kernel, window, tuned_split_dimension(kernel, split_dimension));
+}
+
+IScheduler::Ticket CPPScheduler::schedule_async(ICPPKernel *kernel, unsigned int split_dimension, const std::vector<Ticket> &dependencies)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
+
+    if(_async_queue == nullptr)
+    {
+        _async_queue = support::cpp14::make_unique<AsyncKernelQueue>([this](ICPPKernel *k, unsigned int dim)
+        {
+            execute(k, k->window(), dim);
+        });
+    }
+    return _async_queue->submit(kernel, split_dimension, dependencies);
+}
+
+void CPPScheduler::schedule_sequence(const std::vector<WorkItem> &items)
+{
+    // Keep sequence runs ordered with respect to asynchronous submissions;
+    // Interactive callers overtake the queue at the pool gate instead of draining it
+    if(_async_queue != nullptr && caller_priority() == Priority::Normal)
+    {
+        _async_queue->wait_all();
+    }
+
+    if(items.empty())
+    {
+        return;
+    }
+
+    prepare_workspaces(_num_threads);
+
+    /** Per-kernel execution state shared by all workers of the sequence */
+    struct SequenceItem
+    {
+        ICPPKernel               *kernel{ nullptr };    /**< Kernel to execute */
+        Window                    window{};             /**< Execution window of the kernel */
+        unsigned int              split_dimension{ 0 }; /**< Dimension the window is split along */
+        unsigned int              num_slices{ 0 };      /**< Number of window slices */
+        unsigned int              num_iterations{ 0 };  /**< Total window iterations, for telemetry */
+        std::atomic<unsigned int> next_slice{ 0 };      /**< Claim counter: index of the next unclaimed slice */
+        std::atomic<unsigned int> remaining{ 0 };       /**< Slices claimed but not yet completed */
+    };
+
+    // Pre-compute every kernel's slicing so the workers only touch the two atomics while running
+    std::deque<SequenceItem> sequence;
+    for(const WorkItem &item : items)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(item.kernel == nullptr, "Sequence items must carry a kernel");
+        sequence.emplace_back();
+        SequenceItem &seq   = sequence.back();
+        seq.kernel          = item.kernel;
+        seq.window          = item.kernel->window();
+        seq.split_dimension = tuned_split_dimension(item.kernel, item.split_dimension);
+        seq.num_iterations  = seq.window.num_iterations(seq.split_dimension);
+        seq.num_slices      = std::min(seq.num_iterations, item.kernel->is_parallelisable() ? concurrency_limit(item.kernel) : 1U);
+        seq.remaining.store(seq.num_slices, std::memory_order_relaxed);
+    }
+
+    PoolGateLock pool_lock(*_pool_gate);
+
+    // Snapshot the dispatching thread's cancellation bindings for the workers to poll
+    const CancelPoint cancel = CancelPoint::capture();
+
+    std::atomic<bool>  abort{ false };
+    std::exception_ptr first_exception = nullptr;
+    std::mutex         exception_mutex;
+
+    auto worker = [&](const ThreadInfo &info)
+    {
+        for(SequenceItem &seq : sequence)
+        {
+            // Claim and run slices until the kernel runs out of them (or the dispatch is cancelled)
+            unsigned int slice = 0;
+            while(!abort.load(std::memory_order_relaxed) && !cancel.expired() && (slice = seq.next_slice.fetch_add(1, std::memory_order_relaxed)) < seq.num_slices)
+            {
+                try
+                {
+                    run_instrumented(seq.kernel, seq.split_dimension, seq.num_iterations, info, [&]
+                    {
+                        Window win = seq.window.split_window(seq.split_dimension, slice, seq.num_slices);
+                        win.validate();
+                        seq.kernel->run(win, info);
+                    });
+                }
+                catch(...)
+                {
+                    std::lock_guard<std::mutex> lock(exception_mutex);
+                    if(first_exception == nullptr)
+                    {
+                        first_exception = std::current_exception();
+                    }
+                    abort.store(true, std::memory_order_relaxed);
+                }
+                seq.remaining.fetch_sub(1, std::memory_order_acq_rel);
+            }
+
+            // The next kernel reads this one's output: spin on the completion counter instead of
+            // returning to the pool, so the whole sequence costs a single pool entry/exit
+            while(seq.remaining.load(std::memory_order_acquire) != 0)
+            {
+                if(abort.load(std::memory_order_relaxed) || cancel.expired())
+                {
+                    return;
+                }
+            }
+            if(abort.load(std::memory_order_relaxed) || cancel.expired())
+            {
+                return;
+            }
+        }
+    };
+
+    ThreadInfo info;
+    info.cpu_info       = _info;
+    info.num_threads    = _num_threads;
+    info.workspace_size = workspace_size();
+
+    int  t         = 0;
+    auto thread_it = _threads.begin();
+    for(; t < static_cast<int>(_num_threads) - 1; ++t, ++thread_it)
+    {
+        info.thread_id = t;
+        info.cluster   = thread_it->cluster();
+        info.workspace = thread_workspace(t);
+        thread_it->set_spin_wait_duration(_spin_wait_us);
+        thread_it->start([&worker, info]
+        {
+            worker(info);
+        });
+    }
+
+    // The main thread takes part in the sequence like any worker
+    info.thread_id = t;
+    info.cluster   = CPUCluster::Unknown;
+    info.workspace = thread_workspace(t);
+    worker(info);
+
+    try
+    {
+        for(auto &thread : _threads)
+        {
+            thread.wait();
+        }
+    }
+    catch(const std::system_error &e)
+    {
+        std::cerr << "Caught system_error with code " << e.code() << " meaning " << e.what() << '\n';
+    }
+
+    if(first_exception != nullptr)
+    {
+        std::rethrow_exception(first_exception);
+    }
+}
+
+void CPPScheduler::wait_for(Ticket ticket)
+{
+    if(_async_queue != nullptr)
+    {
+        _async_queue->wait_for(ticket);
+    }
+}
+
+void CPPScheduler::wait_all()
+{
+    if(_async_queue != nullptr)
+    {
+        _async_queue->wait_all();
+    }
+}
+
+CPPScheduler::~CPPScheduler() = default;
+
+void CPPScheduler::run_instrumented(ICPPKernel *kernel, unsigned int split_dimension, unsigned int num_iterations, const ThreadInfo &info, const std::function<void()> &workload)
+{
+    if(!telemetry_enabled())
+    {
+        workload();
+        return;
+    }
+
+    KernelEvent event;
+    event.kernel_name     = kernel->name();
+    event.split_dimension = split_dimension;
+    event.num_iterations  = num_iterations;
+    event.thread_id       = info.thread_id;
+    event.num_threads     = info.num_threads;
+    event.start_ns        = now_ns();
+    workload();
+    event.end_ns = now_ns();
+    record_kernel_event(event);
+}
+
+void CPPScheduler::execute(ICPPKernel *kernel, const Window &window, unsigned int split_dimension)
 {
     ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
 
     /** [Scheduler example] */
+    prepare_workspaces(_num_threads);
+
     ThreadInfo info;
-    info.cpu_info = _info;
+    info.cpu_info       = _info;
+    info.workspace      = thread_workspace(0);
+    info.workspace_size = workspace_size();
 
-    const Window      &max_window     = kernel->window();
+    const Window      &max_window     = window;
     const unsigned int num_iterations = max_window.num_iterations(split_dimension);
-    info.num_threads                  = std::min(num_iterations, _num_threads);
+    info.num_threads                  = std::min(num_iterations, concurrency_limit(kernel));
 
     if(num_iterations == 0)
     {
         return;
     }
 
+    // Small workloads are not worth the worker wake-up latency: run them inline
+    if(_inline_cost_threshold != 0 && num_iterations * kernel->cost_per_iteration() <= _inline_cost_threshold)
+    {
+        info.num_threads = 1;
+        run_instrumented(kernel, split_dimension, num_iterations, info, [&] { kernel->run(max_window, info); });
+        return;
+    }
+
     if(!kernel->is_parallelisable() || info.num_threads == 1)
     {
-        kernel->run(max_window, info);
+        run_instrumented(kernel, split_dimension, num_iterations, info, [&] { kernel->run(max_window, info); });
+    }
+    else if(_mode == Mode::WorkStealing)
+    {
+        PoolGateLock pool_lock(*_pool_gate);
+
+        // Snapshot the dispatching thread's cancellation bindings for the workers to poll
+        const CancelPoint cancel = CancelPoint::capture();
+        // One chunk per pool thread: chunk ids double as the thread ids the kernels see, and
+        // those must stay within the range callers size their per-thread resources for (e.g.
+        // the packing workspace of NEGEMMMatrixMultiplyKernel).
+        const unsigned int num_chunks = std::min(num_iterations, static_cast<unsigned int>(info.num_threads));
+        StealableChunks    chunks(num_chunks);
+
+        for(unsigned int c = 0; c < num_chunks; ++c)
+        {
+            chunks.workspaces[c] = thread_workspace(static_cast<int>(c));
+        }
+
+        int  t         = 0;
+        auto thread_it = _threads.begin();
+
+        for(; t < info.num_threads - 1; ++t, ++thread_it)
+        {
+            info.thread_id = t;
+            info.cluster   = thread_it->cluster();
+            info.workspace = thread_workspace(t);
+            thread_it->set_spin_wait_duration(_spin_wait_us);
+            thread_it->start([this, kernel, &max_window, split_dimension, num_iterations, num_chunks, &chunks, cancel, info]
+            {
+                run_instrumented(kernel, split_dimension, num_iterations, info, [&]
+                {
+                    run_stealable_chunks(kernel, max_window, split_dimension, num_chunks, chunks, cancel, info);
+                });
+            });
+        }
+
+        // Run last part on main thread
+        info.thread_id = t;
+        info.cluster   = CPUCluster::Unknown;
+        info.workspace = thread_workspace(t);
+        run_instrumented(kernel, split_dimension, num_iterations, info, [&]
+        {
+            run_stealable_chunks(kernel, max_window, split_dimension, num_chunks, chunks, cancel, info);
+        });
+
+        try
+        {
+            for(auto &thread : _threads)
+            {
+                thread.wait();
+            }
+        }
+        catch(const std::system_error &e)
+        {
+            std::cerr << "Caught system_error with code " << e.code() << " meaning " << e.what() << '\n';
+        }
     }
     else
     {
+        PoolGateLock pool_lock(*_pool_gate);
+
         int  t         = 0;
         auto thread_it = _threads.begin();
 
@@ -202,13 +1335,29 @@ void CPPScheduler::schedule(ICPPKernel *kernel, unsigned int split_dimension)
         {
             Window win     = max_window.split_window(split_dimension, t, info.num_threads);
             info.thread_id = t;
-            thread_it->start(kernel, win, info);
+            info.cluster   = thread_it->cluster();
+            info.workspace = thread_workspace(t);
+            thread_it->set_spin_wait_duration(_spin_wait_us);
+            thread_it->start([this, kernel, win, info, split_dimension, num_iterations]
+            {
+                run_instrumented(kernel, split_dimension, num_iterations, info, [&]
+                {
+                    win.validate();
+                    kernel->run(win, info);
+                });
+            });
         }
 
         // Run last part on main thread
         Window win     = max_window.split_window(split_dimension, t, info.num_threads);
         info.thread_id = t;
-        kernel->run(win, info);
+        info.cluster   = CPUCluster::Unknown;
+        info.workspace = thread_workspace(t);
+        run_instrumented(kernel, split_dimension, num_iterations, info, [&]
+        {
+            win.validate();
+            kernel->run(win, info);
+        });
 
         try
         {
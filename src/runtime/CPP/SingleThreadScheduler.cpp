@@ -26,6 +26,11 @@
 #include "arm_compute/core/CPP/ICPPKernel.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 
 namespace arm_compute
 {
@@ -41,12 +46,72 @@ void SingleThreadScheduler::set_num_threads(unsigned int num_threads)
     ARM_COMPUTE_ERROR_ON(num_threads != 1);
 }
 
+void SingleThreadScheduler::set_yield(std::function<void()> callback, unsigned int slice_us)
+{
+    _yield_callback = std::move(callback);
+    _slice_us       = slice_us;
+}
+
 void SingleThreadScheduler::schedule(ICPPKernel *kernel, unsigned int split_dimension)
 {
-    ARM_COMPUTE_UNUSED(split_dimension);
+    prepare_workspaces(1);
+
     ThreadInfo info;
-    info.cpu_info = cpu_info();
-    kernel->run(kernel->window(), info);
+    info.cpu_info       = cpu_info();
+    info.workspace      = thread_workspace(0);
+    info.workspace_size = workspace_size();
+
+    const Window      &max_window     = kernel->window();
+    const unsigned int num_iterations = max_window.num_iterations(split_dimension);
+    if(!_yield_callback || _slice_us == 0 || num_iterations <= 1)
+    {
+        kernel->run(max_window, info);
+        return;
+    }
+
+    const int start = max_window[split_dimension].start();
+    const int step  = max_window[split_dimension].step();
+
+    unsigned int done = 0;
+    while(done < num_iterations)
+    {
+        // Size the slice from the throughput measured on the previous ones; the first slice
+        // after the estimate resets is a single window step
+        unsigned int slice = std::max(1u, static_cast<unsigned int>(_iterations_per_us * static_cast<float>(_slice_us)));
+        slice              = std::min(slice, num_iterations - done);
+
+        Window window = max_window;
+        window.set(split_dimension, Window::Dimension(start + static_cast<int>(done) * step, start + static_cast<int>(done + slice) * step, step));
+
+        const auto slice_start = std::chrono::steady_clock::now();
+        kernel->run(window, info);
+        const float duration_us = std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - slice_start).count();
+
+        // Smooth the estimate so one slice preempted by an RTOS task does not collapse the next
+        const float measured = static_cast<float>(slice) / std::max(duration_us, 1.f);
+        _iterations_per_us   = (_iterations_per_us == 0.f) ? measured : 0.5f * (_iterations_per_us + measured);
+
+        done += slice;
+        if(done == num_iterations)
+        {
+            break;
+        }
+
+        // A cancelled or over-deadline dispatch stops claiming further slices, matching the
+        // window-chunk polling of the pooled schedulers
+        const std::atomic<bool> *cancelled = cancellation_flag();
+        if(cancelled != nullptr && cancelled->load(std::memory_order_relaxed))
+        {
+            break;
+        }
+        const uint64_t deadline = dispatch_deadline();
+        if(deadline != 0 && static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()) >= deadline)
+        {
+            break;
+        }
+
+        _yield_callback();
+    }
 }
 
 unsigned int SingleThreadScheduler::num_threads() const
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPUTuner.h"
+
+#include "support/ToolchainSupport.h"
+
+#include <fstream>
+
+using namespace arm_compute;
+
+void CPUTuner::import_split_table(const std::unordered_map<std::string, unsigned int> &split_table)
+{
+    _split_table.clear();
+    _split_table = split_table;
+}
+
+const std::unordered_map<std::string, unsigned int> &CPUTuner::export_split_table() const
+{
+    return _split_table;
+}
+
+void CPUTuner::set_split_dimension(const std::string &kernel_name, unsigned int split_dimension)
+{
+    _split_table[kernel_name] = split_dimension;
+}
+
+unsigned int CPUTuner::optimal_split_dimension(const char *kernel_name, unsigned int default_split_dimension) const
+{
+    if(kernel_name == nullptr)
+    {
+        return default_split_dimension;
+    }
+
+    const auto entry = _split_table.find(kernel_name);
+    if(entry == _split_table.end())
+    {
+        return default_split_dimension;
+    }
+
+    return entry->second;
+}
+
+void CPUTuner::set_num_threads(unsigned int num_threads)
+{
+    _num_threads = num_threads;
+}
+
+unsigned int CPUTuner::num_threads() const
+{
+    return _num_threads;
+}
+
+bool CPUTuner::save_to_file(const std::string &filename) const
+{
+    std::ofstream fs(filename, std::ios::trunc);
+    if(!fs.is_open())
+    {
+        return false;
+    }
+
+    // Device-wide recommendation first, then one entry per line: kernel_name;split_dimension
+    if(_num_threads != 0)
+    {
+        fs << "threads;" << _num_threads << "\n";
+    }
+    for(const auto &kernel_data : _split_table)
+    {
+        fs << kernel_data.first << ";" << kernel_data.second << "\n";
+    }
+    return fs.good();
+}
+
+bool CPUTuner::load_from_file(const std::string &filename)
+{
+    std::ifstream fs(filename);
+    if(!fs.is_open())
+    {
+        return false;
+    }
+
+    std::unordered_map<std::string, unsigned int> split_table;
+    unsigned int                                  num_threads = 0;
+    std::string                                   line;
+
+    while(std::getline(fs, line))
+    {
+        if(line.empty())
+        {
+            continue;
+        }
+
+        const size_t separator = line.find(';');
+        if(separator == std::string::npos || separator == 0 || separator + 1 >= line.size())
+        {
+            return false;
+        }
+
+        const std::string  key   = line.substr(0, separator);
+        const unsigned int value = static_cast<unsigned int>(support::cpp11::stoul(line.substr(separator + 1)));
+
+        if(key == "threads")
+        {
+            num_threads = value;
+        }
+        else
+        {
+            split_table[key] = value;
+        }
+    }
+
+    _split_table = std::move(split_table);
+    _num_threads = num_threads;
+
+    return true;
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/HugePagesAllocator.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/MemoryTracker.h"
+
+#include <cstddef>
+
+#if !defined(BARE_METAL) && defined(__linux__)
+#include <sys/mman.h>
+#endif /* !defined(BARE_METAL) && defined(__linux__) */
+
+using namespace arm_compute;
+
+namespace
+{
+/** Size of a 2MB huge page */
+constexpr size_t huge_page_size = 2 * 1024 * 1024;
+} // namespace
+
+void *HugePagesAllocator::allocate(size_t size, size_t alignment)
+{
+    ARM_COMPUTE_UNUSED(alignment);
+
+#if !defined(BARE_METAL) && defined(__linux__)
+    // Round the mapping up to a whole number of huge pages
+    const size_t mapped_size = ((size + huge_page_size - 1) / huge_page_size) * huge_page_size;
+
+    // Try an explicit huge page mapping first
+#if defined(MAP_HUGETLB)
+    void *ptr = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if(ptr != MAP_FAILED)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _mappings[ptr] = mapped_size;
+        MemoryTracker::get().record_allocation(ptr, mapped_size);
+        return ptr;
+    }
+#endif /* defined(MAP_HUGETLB) */
+
+    // No huge pages reserved: fall back to a regular mapping and ask for transparent huge pages
+    void *thp_ptr = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(thp_ptr != MAP_FAILED)
+    {
+#if defined(MADV_HUGEPAGE)
+        madvise(thp_ptr, mapped_size, MADV_HUGEPAGE);
+#endif /* defined(MADV_HUGEPAGE) */
+        std::lock_guard<std::mutex> lock(_mutex);
+        _mappings[thp_ptr] = mapped_size;
+        MemoryTracker::get().record_allocation(thp_ptr, mapped_size);
+        return thp_ptr;
+    }
+#endif /* !defined(BARE_METAL) && defined(__linux__) */
+
+    // Last resort: regular allocation
+    void *fallback_ptr = ::operator new(size);
+    MemoryTracker::get().record_allocation(fallback_ptr, size);
+    return fallback_ptr;
+}
+
+void HugePagesAllocator::free(void *ptr)
+{
+    if(ptr == nullptr)
+    {
+        return;
+    }
+
+    MemoryTracker::get().record_free(ptr);
+
+#if !defined(BARE_METAL) && defined(__linux__)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _mappings.find(ptr);
+        if(it != _mappings.end())
+        {
+            munmap(it->first, it->second);
+            _mappings.erase(it);
+            return;
+        }
+    }
+#endif /* !defined(BARE_METAL) && defined(__linux__) */
+
+    ::operator delete(ptr);
+}
@@ -23,7 +23,15 @@
  */
 #include "arm_compute/runtime/IScheduler.h"
 
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/CPUTuner.h"
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+
 #include <array>
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <fcntl.h>
@@ -32,6 +40,15 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#if defined(__aarch64__) && !defined(BARE_METAL)
+#include <sys/auxv.h>
+
+/* The dot product hwcap landed in Linux 4.14, define it for older toolchains */
+#ifndef HWCAP_ASIMDDP
+#define HWCAP_ASIMDDP (1 << 20)
+#endif /* HWCAP_ASIMDDP */
+#endif /* defined(__aarch64__) && !defined(BARE_METAL) */
+
 namespace
 {
 unsigned int get_cpu_impl()
@@ -123,6 +140,86 @@ unsigned int get_cpu_impl()
 
     return 0;
 }
+
+#ifndef BARE_METAL
+int read_sysfs_entry(const char *path, char *buff, size_t len)
+{
+    int fd = open(path, 0); // NOLINT
+    if(fd == -1)
+    {
+        return -1;
+    }
+
+    int charsread = read(fd, buff, len - 1);
+    close(fd);
+
+    if(charsread <= 0)
+    {
+        return -1;
+    }
+
+    buff[charsread] = '\0';
+    return charsread;
+}
+
+unsigned int parse_cache_size(const char *str)
+{
+    char             *suffix = nullptr;
+    unsigned long int size   = strtoul(str, &suffix, 0);
+
+    if(suffix != nullptr)
+    {
+        if(*suffix == 'K')
+        {
+            size *= 1024;
+        }
+        else if(*suffix == 'M')
+        {
+            size *= 1024 * 1024;
+        }
+    }
+
+    return size;
+}
+
+/* Read the size of the data (or unified) cache of the given level for the current CPU
+ * from the sysfs cache hierarchy, so the GEMM blocking parameters can be sized for the
+ * core the library actually runs on. Returns 0 if the geometry is not exposed.
+ */
+unsigned int get_cpu_cache_size(int cpu, int level)
+{
+    for(int index = 0;; ++index)
+    {
+        std::array<char, 64> buff{ {} };
+        std::array<char, 96> path{ {} };
+
+        snprintf(path.data(), path.size(), "/sys/devices/system/cpu/cpu%d/cache/index%d/level", cpu, index);
+        if(read_sysfs_entry(path.data(), buff.data(), buff.size()) < 0)
+        {
+            break;
+        }
+        if(strtol(buff.data(), nullptr, 0) != level)
+        {
+            continue;
+        }
+
+        // Skip instruction caches, only the data side matters for blocking
+        snprintf(path.data(), path.size(), "/sys/devices/system/cpu/cpu%d/cache/index%d/type", cpu, index);
+        if(read_sysfs_entry(path.data(), buff.data(), buff.size()) > 0 && strncmp(buff.data(), "Instruction", 11) == 0)
+        {
+            continue;
+        }
+
+        snprintf(path.data(), path.size(), "/sys/devices/system/cpu/cpu%d/cache/index%d/size", cpu, index);
+        if(read_sysfs_entry(path.data(), buff.data(), buff.size()) > 0)
+        {
+            return parse_cache_size(buff.data());
+        }
+    }
+
+    return 0;
+}
+#endif /* BARE_METAL */
 } // namespace
 
 namespace arm_compute
@@ -134,6 +231,18 @@ IScheduler::IScheduler()
         case 0xd03:
             _info.CPU = CPUTarget::A53;
             break;
+        case 0xd05:
+            _info.CPU = CPUTarget::A55;
+            break;
+        case 0xd08:
+            _info.CPU = CPUTarget::A72;
+            break;
+        case 0xd09:
+            _info.CPU = CPUTarget::A73;
+            break;
+        case 0xd0a:
+            _info.CPU = CPUTarget::A75;
+            break;
         default:
 #ifdef __arm__
             _info.CPU = CPUTarget::ARMV7;
@@ -145,8 +254,42 @@ IScheduler::IScheduler()
             break;
     }
 
+#if defined(__aarch64__) && !defined(BARE_METAL)
+    // The part number table above cannot know every core; trust the kernel's feature
+    // report for the dot product extension so the SDOT/UDOT kernels are picked up on
+    // any CPU implementing it
+    if((getauxval(AT_HWCAP) & HWCAP_ASIMDDP) != 0)
+    {
+        unsigned int target = static_cast<unsigned int>(_info.CPU) | static_cast<unsigned int>(CPUTarget::DOT);
+
+        // A core with the dot product extension implements at least ARMv8.2
+        if((target & static_cast<unsigned int>(CPUTarget::ARCH_MASK)) < static_cast<unsigned int>(CPUTarget::ARMV8_2))
+        {
+            target = (target & ~static_cast<unsigned int>(CPUTarget::ARCH_MASK)) | static_cast<unsigned int>(CPUTarget::ARMV8_2);
+        }
+
+        _info.CPU = static_cast<CPUTarget>(target);
+    }
+#endif /* defined(__aarch64__) && !defined(BARE_METAL) */
+
+    // Conservative defaults, overridden below when the kernel exposes the real cache geometry
     _info.L1_size = 31000;
     _info.L2_size = 500000;
+
+#ifndef BARE_METAL
+    const int          cpu     = std::max(sched_getcpu(), 0);
+    const unsigned int L1_size = get_cpu_cache_size(cpu, 1);
+    const unsigned int L2_size = get_cpu_cache_size(cpu, 2);
+
+    if(L1_size != 0)
+    {
+        _info.L1_size = L1_size;
+    }
+    if(L2_size != 0)
+    {
+        _info.L2_size = L2_size;
+    }
+#endif /* BARE_METAL */
 }
 
 void IScheduler::set_target(CPUTarget target)
@@ -158,4 +301,286 @@ CPUInfo IScheduler::cpu_info() const
 {
     return _info;
 }
+
+void IScheduler::set_tuner(CPUTuner *tuner)
+{
+    _tuner = tuner;
+
+    if(_tuner != nullptr && _tuner->num_threads() != 0)
+    {
+        set_num_threads(_tuner->num_threads());
+    }
+}
+
+CPUTuner *IScheduler::tuner() const
+{
+    return _tuner;
+}
+
+unsigned int IScheduler::tuned_split_dimension(const ICPPKernel *kernel, unsigned int split_dimension) const
+{
+    if(_tuner == nullptr || kernel == nullptr)
+    {
+        return split_dimension;
+    }
+
+    return _tuner->optimal_split_dimension(kernel->name(), split_dimension);
+}
+
+void IScheduler::schedule(ICPPKernel *kernel, unsigned int split_dimension_0, unsigned int split_dimension_1)
+{
+    ARM_COMPUTE_UNUSED(split_dimension_1);
+    schedule(kernel, split_dimension_0);
+}
+
+void IScheduler::schedule_window(ICPPKernel *kernel, const Window &window, unsigned int split_dimension)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
+    ARM_COMPUTE_UNUSED(split_dimension);
+
+    prepare_workspaces(1);
+
+    ThreadInfo info;
+    info.cpu_info       = _info;
+    info.workspace      = thread_workspace(0);
+    info.workspace_size = workspace_size();
+
+    kernel->run(window, info);
+}
+
+void IScheduler::schedule_roi(ICPPKernel *kernel, const Coordinates &anchor, const TensorShape &shape, unsigned int split_dimension)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
+
+    const Window roi_window = kernel->window().clipped_to(anchor, shape);
+
+    // Nothing of the kernel's window falls inside the region of interest
+    for(size_t d = 0; d < shape.num_dimensions(); ++d)
+    {
+        if(roi_window[d].step() != 0 && roi_window[d].end() == roi_window[d].start())
+        {
+            return;
+        }
+    }
+
+    schedule_window(kernel, roi_window, split_dimension);
+}
+
+void IScheduler::schedule_sequence(const std::vector<WorkItem> &items)
+{
+    // Sequential fallback: every kernel is a full dispatch of its own
+    for(const WorkItem &item : items)
+    {
+        schedule(item.kernel, item.split_dimension);
+    }
+}
+
+void IScheduler::schedule_concurrent(ICPPKernel *kernel_0, unsigned int split_dimension_0, ICPPKernel *kernel_1, unsigned int split_dimension_1)
+{
+    // Sequential fallback: schedulers without a thread pool to partition run the kernels
+    // back to back
+    schedule(kernel_0, split_dimension_0);
+    schedule(kernel_1, split_dimension_1);
+}
+
+IScheduler::Ticket IScheduler::schedule_async(ICPPKernel *kernel, unsigned int split_dimension, const std::vector<Ticket> &dependencies)
+{
+    // Synchronous fallback: by the time the ticket is returned the kernel (and thus
+    // everything it could depend on) has already executed.
+    ARM_COMPUTE_UNUSED(dependencies);
+    schedule(kernel, split_dimension);
+    return ++_next_ticket;
+}
+
+void IScheduler::wait_for(Ticket ticket)
+{
+    ARM_COMPUTE_UNUSED(ticket);
+}
+
+void IScheduler::wait_all()
+{
+}
+
+void IScheduler::set_affinity_policy(AffinityPolicy policy)
+{
+    _affinity_policy = policy;
+}
+
+IScheduler::AffinityPolicy IScheduler::affinity_policy() const
+{
+    return _affinity_policy;
+}
+
+void IScheduler::set_telemetry_enabled(bool enabled)
+{
+    if(enabled && _telemetry == nullptr)
+    {
+        _telemetry = support::cpp14::make_unique<Telemetry>();
+    }
+    if(_telemetry != nullptr)
+    {
+        _telemetry->enabled = enabled;
+    }
+}
+
+bool IScheduler::telemetry_enabled() const
+{
+    return _telemetry != nullptr && _telemetry->enabled;
+}
+
+std::vector<IScheduler::KernelEvent> IScheduler::drain_telemetry()
+{
+    std::vector<KernelEvent> events;
+    if(_telemetry == nullptr)
+    {
+        return events;
+    }
+
+    const unsigned int total = _telemetry->next.exchange(0);
+    const unsigned int count = std::min(total, telemetry_capacity);
+    events.reserve(count);
+    // When the buffer has wrapped the oldest remaining event lives right after the write cursor
+    const unsigned int first = (total > telemetry_capacity) ? (total % telemetry_capacity) : 0;
+    for(unsigned int i = 0; i < count; ++i)
+    {
+        events.push_back(_telemetry->events[(first + i) % telemetry_capacity]);
+    }
+    return events;
+}
+
+void IScheduler::record_kernel_event(const KernelEvent &event)
+{
+    if(!telemetry_enabled())
+    {
+        return;
+    }
+    const unsigned int slot  = _telemetry->next.fetch_add(1, std::memory_order_relaxed) % telemetry_capacity;
+    _telemetry->events[slot] = event;
+}
+
+void IScheduler::set_inline_cost_threshold(unsigned int threshold)
+{
+    _inline_cost_threshold = threshold;
+}
+
+unsigned int IScheduler::inline_cost_threshold() const
+{
+    return _inline_cost_threshold;
+}
+
+void IScheduler::set_bandwidth_bound_threads(unsigned int num_threads)
+{
+    _bandwidth_bound_threads = num_threads;
+}
+
+unsigned int IScheduler::bandwidth_bound_threads() const
+{
+    return _bandwidth_bound_threads;
+}
+
+unsigned int IScheduler::concurrency_limit(const ICPPKernel *kernel) const
+{
+    const unsigned int pool_size = num_threads();
+
+    if(kernel->resource_profile() != ICPPKernel::ResourceProfile::BANDWIDTH_BOUND)
+    {
+        return pool_size;
+    }
+
+    const unsigned int cap = (_bandwidth_bound_threads != 0) ? _bandwidth_bound_threads : std::max(1u, pool_size / 2);
+    return std::min(cap, pool_size);
+}
+
+void IScheduler::set_spin_wait_duration(unsigned int spin_wait_us)
+{
+    _spin_wait_us = spin_wait_us;
+}
+
+unsigned int IScheduler::spin_wait_duration() const
+{
+    return _spin_wait_us;
+}
+
+namespace
+{
+// Thread-affine dispatch bindings: each thread submitting kernels carries its own priority,
+// cancellation flag and deadline, so concurrent callers sharing a scheduler do not interfere
+thread_local IScheduler::Priority     caller_priority_tls   = IScheduler::Priority::Normal;
+thread_local const std::atomic<bool> *cancellation_flag_tls = nullptr;
+thread_local uint64_t                 dispatch_deadline_tls = 0;
+} // namespace
+
+void IScheduler::set_caller_priority(Priority priority)
+{
+    caller_priority_tls = priority;
+}
+
+IScheduler::Priority IScheduler::caller_priority()
+{
+    return caller_priority_tls;
+}
+
+void IScheduler::set_cancellation_flag(const std::atomic<bool> *flag)
+{
+    cancellation_flag_tls = flag;
+}
+
+const std::atomic<bool> *IScheduler::cancellation_flag()
+{
+    return cancellation_flag_tls;
+}
+
+void IScheduler::set_dispatch_deadline(uint64_t deadline_ns)
+{
+    dispatch_deadline_tls = deadline_ns;
+}
+
+uint64_t IScheduler::dispatch_deadline()
+{
+    return dispatch_deadline_tls;
+}
+
+void IScheduler::reserve_workspace(size_t size)
+{
+    if(size <= _workspace_size)
+    {
+        return;
+    }
+    _workspace_size = size;
+    // Drop the outgrown arenas: prepare_workspaces() re-creates them at the new size
+    _workspaces.clear();
+}
+
+size_t IScheduler::workspace_size() const
+{
+    return _workspace_size;
+}
+
+void IScheduler::prepare_workspaces(unsigned int num_threads)
+{
+    if(_workspace_size == 0)
+    {
+        return;
+    }
+    if(_workspaces.size() < num_threads)
+    {
+        _workspaces.resize(num_threads);
+    }
+    for(auto &workspace : _workspaces)
+    {
+        if(workspace == nullptr)
+        {
+            workspace = support::cpp14::make_unique<uint8_t[]>(_workspace_size);
+        }
+    }
+}
+
+void *IScheduler::thread_workspace(int thread_id) const
+{
+    if(static_cast<size_t>(thread_id) >= _workspaces.size())
+    {
+        return nullptr;
+    }
+    return _workspaces[thread_id].get();
+}
 } // namespace arm_compute
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/Im2ColCache.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+#include "support/ToolchainSupport.h"
+
+using namespace arm_compute;
+
+Im2ColCache &Im2ColCache::get()
+{
+    static Im2ColCache cache;
+    return cache;
+}
+
+void Im2ColCache::set_enabled(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _enabled = enabled;
+}
+
+bool Im2ColCache::is_enabled() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _enabled;
+}
+
+ITensor *Im2ColCache::acquire(const ITensor *input, const std::string &geometry, const TensorInfo &info, bool &produce)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    const Key key(input, geometry);
+    auto      it = _cache.find(key);
+
+    if(it == _cache.end())
+    {
+        Entry entry;
+        entry.tensor = support::cpp14::make_unique<Tensor>();
+        entry.tensor->allocator()->init(info);
+        entry.tensor->allocator()->allocate();
+        it = _cache.emplace(key, std::move(entry)).first;
+    }
+
+    // The first function configured with this key recomputes the reshape every frame; the
+    // graph's execution order guarantees it runs before the consumers
+    produce                 = !it->second.has_producer;
+    it->second.has_producer = true;
+
+    return it->second.tensor.get();
+}
+
+void Im2ColCache::clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _cache.clear();
+}
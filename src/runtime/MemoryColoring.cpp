@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/MemoryColoring.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Utils.h"
+
+#include <algorithm>
+
+using namespace arm_compute;
+
+constexpr size_t MemoryColoring::cache_line_size;
+
+MemoryColoring &MemoryColoring::get()
+{
+    static MemoryColoring coloring;
+    return coloring;
+}
+
+void MemoryColoring::set_enabled(bool enabled)
+{
+    _enabled = enabled;
+}
+
+bool MemoryColoring::is_enabled() const
+{
+    return _enabled;
+}
+
+void MemoryColoring::configure(size_t stride, size_t window)
+{
+    ARM_COMPUTE_ERROR_ON(stride == 0 || window == 0);
+
+    // Keep offsets line-quantized and the window a whole number of strides, so the cycling
+    // sequence always lands on line boundaries
+    _stride = ceil_to_multiple(stride, cache_line_size);
+    _window = ceil_to_multiple(window, _stride);
+    _next   = 0;
+}
+
+void MemoryColoring::configure_from(const CPUInfo &info)
+{
+    if(info.L1_size > 0)
+    {
+        configure(_stride, std::max<size_t>(info.L1_size / 4, _stride));
+    }
+}
+
+size_t MemoryColoring::next_offset()
+{
+    if(!_enabled)
+    {
+        return 0;
+    }
+
+    return _next.fetch_add(_stride) % _window;
+}
+
+size_t MemoryColoring::max_offset() const
+{
+    return _enabled ? (_window - _stride) : 0;
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/MemoryTracker.h"
+
+#include <mutex>
+
+using namespace arm_compute;
+
+MemoryTracker &MemoryTracker::get()
+{
+    static MemoryTracker tracker;
+    return tracker;
+}
+
+void MemoryTracker::record_allocation(const void *ptr, size_t size)
+{
+    if(ptr == nullptr)
+    {
+        return;
+    }
+
+    std::lock_guard<arm_compute::Mutex> lock(_mutex);
+    _allocations[ptr] = size;
+    _live += size;
+    if(_live > _peak)
+    {
+        _peak = _live;
+    }
+}
+
+void MemoryTracker::record_free(const void *ptr)
+{
+    if(ptr == nullptr)
+    {
+        return;
+    }
+
+    std::lock_guard<arm_compute::Mutex> lock(_mutex);
+    auto it = _allocations.find(ptr);
+    if(it != _allocations.end())
+    {
+        _live -= it->second;
+        _allocations.erase(it);
+    }
+}
+
+size_t MemoryTracker::live_bytes() const
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mutex);
+    return _live;
+}
+
+size_t MemoryTracker::peak_bytes() const
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mutex);
+    return _peak;
+}
+
+void MemoryTracker::reset_peak()
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mutex);
+    _peak = _live;
+}
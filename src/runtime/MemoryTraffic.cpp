@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/MemoryTraffic.h"
+
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <limits>
+
+using namespace arm_compute;
+
+uint64_t arm_compute::compute_tensor_traffic(const Window &window, const ITensorInfo &info)
+{
+    uint64_t elements = 1;
+
+    for(size_t d = 0; d < Coordinates::num_max_dimensions; ++d)
+    {
+        const Window::Dimension &dim = window[d];
+
+        if(dim.step() == 0)
+        {
+            // Collapsed dimension: the kernel does not move along it
+            continue;
+        }
+
+        if(d < info.num_dimensions())
+        {
+            // Elements of the tensor covered by the window along this dimension
+            const int extent = std::min<int>(dim.end(), info.dimension(d)) - dim.start();
+            elements *= std::max(extent, 1);
+        }
+        else
+        {
+            // Broadcast dimension: the whole tensor is traversed once per iteration
+            elements *= std::max<size_t>(window.num_iterations(d), 1);
+        }
+    }
+
+    return elements * info.element_size();
+}
+
+KernelTraffic arm_compute::estimate_kernel_traffic(const Window &window, std::initializer_list<const ITensorInfo *> inputs, std::initializer_list<const ITensorInfo *> outputs)
+{
+    KernelTraffic traffic{};
+
+    for(const ITensorInfo *input : inputs)
+    {
+        if(input != nullptr)
+        {
+            traffic.bytes_read += compute_tensor_traffic(window, *input);
+        }
+    }
+
+    for(const ITensorInfo *output : outputs)
+    {
+        if(output != nullptr)
+        {
+            traffic.bytes_written += compute_tensor_traffic(window, *output);
+        }
+    }
+
+    return traffic;
+}
+
+KernelBandwidth arm_compute::achieved_bandwidth(const std::vector<IScheduler::KernelEvent> &events, const KernelTraffic &traffic)
+{
+    KernelBandwidth bandwidth{};
+
+    if(events.empty())
+    {
+        return bandwidth;
+    }
+
+    uint64_t start_ns = std::numeric_limits<uint64_t>::max();
+    uint64_t end_ns   = 0;
+
+    for(const IScheduler::KernelEvent &event : events)
+    {
+        start_ns = std::min(start_ns, event.start_ns);
+        end_ns   = std::max(end_ns, event.end_ns);
+    }
+
+    bandwidth.kernel_name = events.front().kernel_name;
+    bandwidth.bytes       = traffic.bytes_read + traffic.bytes_written;
+    bandwidth.duration_ns = (end_ns > start_ns) ? (end_ns - start_ns) : 0;
+
+    // One byte per nanosecond is exactly one GB/s
+    if(bandwidth.duration_ns != 0)
+    {
+        bandwidth.gigabytes_per_second = static_cast<double>(bandwidth.bytes) / static_cast<double>(bandwidth.duration_ns);
+    }
+
+    return bandwidth;
+}
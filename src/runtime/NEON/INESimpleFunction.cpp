@@ -33,8 +33,19 @@ INESimpleFunction::INESimpleFunction() // NOLINT
 {
 }
 
+void INESimpleFunction::set_actual_shape(const TensorShape &shape)
+{
+    _kernel->trim_window(shape);
+    _border_handler.trim_window(shape);
+}
+
 void INESimpleFunction::run()
 {
     NEScheduler::get().schedule(&_border_handler, Window::DimZ);
-    NEScheduler::get().schedule(_kernel.get(), Window::DimY);
+
+    // Split along the batch dimension when it offers more parallelism than Y: each
+    // thread then processes whole images of a batch instead of slivers of every image
+    const Window      &win       = _kernel->window();
+    const unsigned int split_dim = (win.num_iterations(Window::DimZ) > win.num_iterations(Window::DimY)) ? Window::DimZ : Window::DimY;
+    NEScheduler::get().schedule(_kernel.get(), split_dim);
 }
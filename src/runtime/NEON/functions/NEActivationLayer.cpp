@@ -23,14 +23,18 @@
  */
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 
+#include "arm_compute/core/Error.h"
 #include "arm_compute/core/NEON/kernels/NEActivationLayerKernel.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "support/ToolchainSupport.h"
 
 using namespace arm_compute;
 
-void NEActivationLayer::configure(ITensor *input, ITensor *output, ActivationLayerInfo activation_info)
+void NEActivationLayer::configure(ITensor *input, ITensor *output, ActivationLayerInfo activation_info, ITensor *zero_mask)
 {
+    ARM_COMPUTE_ERROR_ON_MSG(input->info()->data_type() == DataType::F16 && !cpu_has_fp16(NEScheduler::get().cpu_info()),
+                             "Half-precision arithmetic requires an ARMv8.2-A CPU");
     auto k = arm_compute::support::cpp14::make_unique<NEActivationLayerKernel>();
-    k->configure(input, output, activation_info);
+    k->configure(input, output, activation_info, zero_mask);
     _kernel = std::move(k);
 }
@@ -33,17 +33,52 @@
 using namespace arm_compute;
 
 NEBatchNormalizationLayer::NEBatchNormalizationLayer()
-    : _norm_kernel()
+    : _norm_kernel(), _fold_kernel(), _scale(), _shift(), _is_folded(false), _is_first_run(false)
 {
 }
 
 void NEBatchNormalizationLayer::configure(ITensor *input, ITensor *output, const ITensor *mean, const ITensor *var, const ITensor *beta, const ITensor *gamma, float epsilon)
 {
-    // Configure kernel
-    _norm_kernel.configure(input, output, mean, var, beta, gamma, epsilon);
+    // At inference time the parameters are frozen, so for F32 they are collapsed once into the
+    // two tensors of the equivalent affine transform and a slim fused multiply-add kernel is run
+    _is_folded    = input->info()->data_type() == DataType::F32;
+    _is_first_run = true;
+
+    if(_is_folded)
+    {
+        _scale.allocator()->init(TensorInfo(mean->info()->tensor_shape(), 1, mean->info()->data_type()));
+        _shift.allocator()->init(TensorInfo(mean->info()->tensor_shape(), 1, mean->info()->data_type()));
+
+        _fold_kernel.configure(mean, var, beta, gamma, epsilon, &_scale, &_shift);
+        _norm_kernel.configure(input, output, &_scale, &_shift);
+
+        _scale.allocator()->allocate();
+        _shift.allocator()->allocate();
+    }
+    else
+    {
+        _norm_kernel.configure(input, output, mean, var, beta, gamma, epsilon);
+    }
+}
+
+const ITensor *NEBatchNormalizationLayer::folded_scale() const
+{
+    return _is_folded ? &_scale : nullptr;
+}
+
+const ITensor *NEBatchNormalizationLayer::folded_shift() const
+{
+    return _is_folded ? &_shift : nullptr;
 }
 
 void NEBatchNormalizationLayer::run()
 {
+    if(_is_folded && _is_first_run)
+    {
+        // The parameter tensors are only guaranteed to contain data at run time: fold them once
+        NEScheduler::get().schedule(&_fold_kernel, Window::DimX);
+        _is_first_run = false;
+    }
+
     NEScheduler::get().schedule(&_norm_kernel, Window::DimY);
 }
@@ -27,6 +27,7 @@
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/NEON/kernels/NECannyEdgeKernel.h"
 #include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
+#include "arm_compute/core/NEON/kernels/NESobel3x3Kernel.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
@@ -36,14 +37,36 @@
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "support/ToolchainSupport.h"
 
+#include <algorithm>
 #include <cstring>
 #include <utility>
 
 using namespace arm_compute;
 
+namespace
+{
+/** Runs the kernel over the rows of its window which fall into [start, end) */
+void schedule_strip(ICPPKernel *kernel, const Window &full_win, int start, int end)
+{
+    const int y_start = std::max(static_cast<int>(full_win.y().start()), start);
+    const int y_end   = std::min(static_cast<int>(full_win.y().end()), end);
+
+    if(y_start >= y_end)
+    {
+        return;
+    }
+
+    Window win(full_win);
+    win.set(Window::DimY, Window::Dimension(y_start, y_end, full_win.y().step()));
+
+    NEScheduler::get().schedule_window(kernel, win, Window::DimY);
+}
+} // namespace
+
 NECannyEdge::NECannyEdge(std::shared_ptr<IMemoryManager> memory_manager) // NOLINT
     : _memory_group(std::move(memory_manager)),
       _sobel(),
+      _sobel_kernel(),
       _gradient(),
       _non_max_suppr(),
       _edge_trace(),
@@ -54,7 +77,8 @@ NECannyEdge::NECannyEdge(std::shared_ptr<IMemoryManager> memory_manager) // NOLI
       _magnitude(),
       _phase(),
       _nonmax(),
-      _output(nullptr)
+      _output(nullptr),
+      _tile_chaining(false)
 {
 }
 
@@ -70,6 +94,12 @@ void NECannyEdge::configure(ITensor *input, ITensor *output, int32_t upper_thr,
 
     _output = output;
 
+    // A 3x3 gradient with undefined borders needs no border fill between the
+    // stages, so they can be chained over strips of rows which stay cache
+    // resident. The two-pass Sobel variants and filled borders keep the
+    // staged full-frame execution.
+    _tile_chaining = (gradient_size == 3) && (border_mode == BorderMode::UNDEFINED);
+
     const TensorShape &shape = input->info()->tensor_shape();
     TensorInfo         gradient_info;
     TensorInfo         magnitude_info;
@@ -99,7 +129,14 @@ void NECannyEdge::configure(ITensor *input, ITensor *output, int32_t upper_thr,
     _memory_group.manage(&_gy);
 
     // Configure/Init sobelNxN
-    if(gradient_size == 3)
+    if(_tile_chaining)
+    {
+        // Drive the kernel directly so it can be dispatched strip by strip
+        auto k = arm_compute::support::cpp14::make_unique<NESobel3x3Kernel>();
+        k->configure(input, &_gx, &_gy, true);
+        _sobel_kernel = std::move(k);
+    }
+    else if(gradient_size == 3)
     {
         auto k = arm_compute::support::cpp14::make_unique<NESobel3x3>();
         k->configure(input, &_gx, &_gy, border_mode, constant_border_value);
@@ -170,22 +207,50 @@ void NECannyEdge::configure(ITensor *input, ITensor *output, int32_t upper_thr,
 
 void NECannyEdge::run()
 {
-    ARM_COMPUTE_ERROR_ON_MSG(_sobel == nullptr, "Unconfigured function");
+    ARM_COMPUTE_ERROR_ON_MSG(_sobel == nullptr && _sobel_kernel == nullptr, "Unconfigured function");
     ARM_COMPUTE_ERROR_ON(_output == nullptr);
 
     _memory_group.acquire();
 
-    // Run sobelNxN
-    _sobel->run();
+    if(_tile_chaining)
+    {
+        // Chain Sobel, gradient and non-maxima suppression over strips of rows:
+        // each strip's gx/gy/magnitude/phase rows are consumed while still cache
+        // resident instead of making full-frame round-trips to memory.
+        const Window &sobel_win = _sobel_kernel->window();
+        const Window &grad_win  = _gradient->window();
+        const Window &nms_win   = _non_max_suppr.window();
+
+        // Size the strip so the intermediate rows it produces fit in a typical L2 cache
+        constexpr size_t target_working_set = 512 * 1024;
+        const size_t     bytes_per_row      = 2 * _gx.info()->strides_in_bytes()[1] + _magnitude.info()->strides_in_bytes()[1] + _phase.info()->strides_in_bytes()[1];
+        const int        strip_rows         = std::max(static_cast<int>(target_working_set / bytes_per_row), 8);
+
+        const int height = static_cast<int>(_nonmax.info()->dimension(1));
+
+        for(int y = 0; y < height; y += strip_rows)
+        {
+            // Strips overlap by one row on each side: suppressing a row needs
+            // the magnitude of both of its neighbours
+            schedule_strip(_sobel_kernel.get(), sobel_win, y - 1, y + strip_rows + 1);
+            schedule_strip(_gradient.get(), grad_win, y - 1, y + strip_rows + 1);
+            schedule_strip(&_non_max_suppr, nms_win, y, y + strip_rows);
+        }
+    }
+    else
+    {
+        // Run sobelNxN
+        _sobel->run();
 
-    // Fill border before non-maxima suppression. Nop for border mode undefined.
-    NEScheduler::get().schedule(&_border_mag_gradient, Window::DimZ);
+        // Fill border before non-maxima suppression. Nop for border mode undefined.
+        NEScheduler::get().schedule(&_border_mag_gradient, Window::DimZ);
 
-    // Run gradient
-    NEScheduler::get().schedule(_gradient.get(), Window::DimY);
+        // Run gradient
+        NEScheduler::get().schedule(_gradient.get(), Window::DimY);
 
-    // Run non-maxima suppression
-    NEScheduler::get().schedule(&_non_max_suppr, Window::DimY);
+        // Run non-maxima suppression
+        NEScheduler::get().schedule(&_non_max_suppr, Window::DimY);
+    }
 
     ARM_COMPUTE_ERROR_ON(_output->buffer() == nullptr);
     memset(_output->buffer(), 0, _output->info()->total_size());
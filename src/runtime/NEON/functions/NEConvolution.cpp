@@ -34,11 +34,33 @@
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "support/ToolchainSupport.h"
 
+#include <algorithm>
 #include <array>
 #include <utility>
 
 using namespace arm_compute;
 
+namespace
+{
+/** Dispatches the kernel on the rows of its window which overlap [start, end) */
+void run_rows(ICPPKernel *kernel, int start, int end)
+{
+    const Window &full_win = kernel->window();
+    const int     y_start  = std::max(static_cast<int>(full_win.y().start()), start);
+    const int     y_end    = std::min(static_cast<int>(full_win.y().end()), end);
+
+    if(y_start >= y_end)
+    {
+        return;
+    }
+
+    Window win(full_win);
+    win.set(Window::DimY, Window::Dimension(y_start, y_end, full_win.y().step()));
+
+    NEScheduler::get().schedule_window(kernel, win, Window::DimY);
+}
+} // namespace
+
 void NEConvolution3x3::configure(ITensor *input, ITensor *output, const int16_t *conv, uint32_t scale, BorderMode border_mode, uint8_t constant_border_value)
 {
     auto k = arm_compute::support::cpp14::make_unique<NEConvolution3x3Kernel>();
@@ -104,8 +126,23 @@ void                   NEConvolutionSquare<matrix_size>::run()
     {
         _memory_group.acquire();
 
-        NEScheduler::get().schedule(&_kernel_hor, Window::DimY);
-        NEScheduler::get().schedule(&_kernel_vert, Window::DimY);
+        // Strip-mine the two passes so each strip of the intermediate is consumed by the
+        // vertical pass while it is still in the cache, instead of streaming the whole
+        // image-sized buffer through memory twice. The horizontal strips overlap by the
+        // filter radius: the vertical pass reads that many intermediate rows above and below
+        const int radius = static_cast<int>(matrix_size / 2);
+        const int height = static_cast<int>(_tmp.info()->dimension(1));
+
+        // Size the strips so input, intermediate and output rows fit comfortably in the L2 cache
+        constexpr size_t target_working_set = 512 * 1024;
+        const size_t     bytes_per_row      = _tmp.info()->strides_in_bytes()[1] * 3; // input + intermediate + output, approximated by the widest of the three
+        const int        strip_rows         = std::max(static_cast<int>(target_working_set / bytes_per_row), 4 * radius);
+
+        for(int y = 0; y < height; y += strip_rows)
+        {
+            run_rows(&_kernel_hor, y - radius, y + strip_rows + radius);
+            run_rows(&_kernel_vert, y, y + strip_rows);
+        }
 
         _memory_group.release();
     }
@@ -23,13 +23,14 @@
  */
 #include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
 
-#include "arm_compute/core/NEON/kernels/arm32/NEGEMMAArch32Kernel.h"
-#include "arm_compute/core/NEON/kernels/arm64/NEGEMMAArch64Kernel.h"
+#include "arm_compute/core/NEON/NEKernelRegistry.h"
 #include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/Size2D.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/Im2ColCache.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/WeightsCache.h"
 #include "support/ToolchainSupport.h"
 
 namespace arm_compute
@@ -106,12 +107,36 @@ void NEConvolutionLayerReshapeWeights::run()
 }
 
 NEConvolutionLayer::NEConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _input_im2col_kernel(), _input_interleave_kernel(), _reshape_weights(), _mm_kernel(), _mm_optimised_kernel(nullptr), _output_col2im_kernel(),
-      _input_im2col_reshaped(), _input_interleaved_reshaped(), _weights_reshaped(), _gemm_output(), _workspace(), _has_bias(false), _is_fully_connected_convolution(false), _are_weights_reshaped(false)
+    : _memory_group(std::move(memory_manager)), _input_im2col_kernel(), _input_interleave_kernel(), _reshape_weights(), _mm_kernel(), _mm_optimised_kernel(nullptr), _direct_conv_kernel(),
+      _accumulate_bias_kernel(), _output_col2im_kernel(), _input_im2col_reshaped(), _im2col_output(nullptr), _input_interleaved_reshaped(), _weights_reshaped(), _gemm_output(), _accumulator(),
+      _workspace(), _original_weights(nullptr), _weights_transform(), _has_bias(false), _run_im2col(true), _is_fully_connected_convolution(false), _are_weights_reshaped(false),
+      _run_implicit_gemm(false), _run_direct_convolution(false), _original_weights_retained(true)
 {
 }
 
-void NEConvolutionLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info)
+const ITensor *NEConvolutionLayer::prepare_reshaped_weights(const ITensor *weights, const ITensor *biases, const TensorInfo &info, const char *transform, bool transpose1xW)
+{
+    ITensor *weights_reshaped = &_weights_reshaped;
+
+    if(WeightsCache::get().is_enabled())
+    {
+        // Share the reshaped form between all function instances configured with the same weights
+        _original_weights  = weights;
+        _weights_transform = std::string(transform) + ((biases != nullptr) ? "_bias" : "");
+        weights_reshaped   = WeightsCache::get().acquire(weights, _weights_transform, info);
+    }
+    else
+    {
+        _weights_reshaped.allocator()->init(info);
+    }
+
+    _reshape_weights.configure(weights, biases, weights_reshaped, transpose1xW);
+
+    return weights_reshaped;
+}
+
+void NEConvolutionLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info,
+                                   const ActivationLayerInfo &act_info, const Size2D &dilation)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QS8, DataType::QS16, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
@@ -147,26 +172,99 @@ void NEConvolutionLayer::configure(const ITensor *input, const ITensor *weights,
 
     const unsigned int kernel_width  = (_are_weights_reshaped) ? weights_info.kernel_size().first : weights->info()->dimension(0);
     const unsigned int kernel_height = (_are_weights_reshaped) ? weights_info.kernel_size().second : weights->info()->dimension(1);
-    std::tie(conv_w, conv_h) = scaled_dimensions(input->info()->dimension(0), input->info()->dimension(1), kernel_width, kernel_height,
+
+    // The dilated kernel covers ((size - 1) * dilation + 1) input elements in each dimension
+    std::tie(conv_w, conv_h) = scaled_dimensions(input->info()->dimension(0), input->info()->dimension(1),
+                                                 (kernel_width - 1) * dilation.width + 1, (kernel_height - 1) * dilation.height + 1,
                                                  conv_info);
 
     // Check if its a "fully connected" convolution, i.e. the output size is 1x1xnum_kernels
     _is_fully_connected_convolution = ((conv_w == 1) && (conv_h == 1));
 
-#if defined(__arm__)
-    if(NEScheduler::get().cpu_info().CPU == CPUTarget::ARMV7 && dt == DataType::F32)
+    // Use the implicit GEMM path when possible: the GEMM A operand is gathered on the fly from
+    // the input, removing the im2col and interleave intermediates. Fused activations run in the
+    // col2im output stage which the implicit path bypasses, so they fall back to the GEMM path
+    _run_implicit_gemm = (dt == DataType::F32) && !_is_fully_connected_convolution && !_are_weights_reshaped && (input->info()->num_dimensions() <= 3) && !act_info.enabled()
+                         && (dilation.width == 1) && (dilation.height == 1);
+
+    // A 1x1 stride-1 convolution multiplies each pixel's channel vector by the weights matrix,
+    // so no im2col is needed: the direct convolution kernel reads the input in place and uses
+    // the weights as they come, removing the largest workspace and one full copy of the input.
+    // F32 keeps going through the implicit GEMM path above, where the assembly GEMM is faster.
+    // Fixed point types need the bias accumulate stage to narrow the promoted accumulator back
+    // to the output type, so without biases they stay on the GEMM path
+    _run_direct_convolution = !_run_implicit_gemm && !_are_weights_reshaped && (kernel_width == 1) && (kernel_height == 1)
+                              && (stride_x == 1) && (stride_y == 1) && (pad_x == 0) && (pad_y == 0)
+                              && !act_info.enabled() && (dilation.width == 1) && (dilation.height == 1)
+                              && (_has_bias || !is_data_type_fixed_point(dt));
+
+    // Unless the weights come in pre-reshaped or the implicit GEMM and direct paths read them
+    // directly, the kernels only ever see the function's own reshaped copy
+    _original_weights_retained = _run_implicit_gemm || _run_direct_convolution || _are_weights_reshaped;
+
+    if(_run_direct_convolution)
     {
-        _mm_optimised_kernel = support::cpp14::make_unique<NEGEMMAArch32Kernel>();
+        // For a 1x1 stride-1 kernel every load starts inside the valid region and can only run
+        // over into the allocated right-hand padding, whose results land in the output padding,
+        // so no border fill is required
+        switch(dt)
+        {
+            case DataType::QS8:
+            {
+                _accumulator.allocator()->init(TensorInfo(output->info()->tensor_shape(), 1, DataType::QS16, fixed_point_position));
+                _memory_group.manage(&_accumulator);
+                _direct_conv_kernel.configure(input, weights, &_accumulator, conv_info);
+                _accumulate_bias_kernel.configure(&_accumulator, biases, output);
+                _accumulator.allocator()->allocate();
+                break;
+            }
+            case DataType::QS16:
+            {
+                _accumulator.allocator()->init(TensorInfo(output->info()->tensor_shape(), 1, DataType::QS32, fixed_point_position));
+                _memory_group.manage(&_accumulator);
+                _direct_conv_kernel.configure(input, weights, &_accumulator, conv_info);
+                _accumulate_bias_kernel.configure(&_accumulator, biases, output);
+                _accumulator.allocator()->allocate();
+                break;
+            }
+            case DataType::F16:
+            case DataType::F32:
+            {
+                _direct_conv_kernel.configure(input, weights, output, conv_info);
+                if(_has_bias)
+                {
+                    _accumulate_bias_kernel.configure(output, biases);
+                }
+                break;
+            }
+            default:
+            {
+                ARM_COMPUTE_ERROR("Data type not supported");
+                break;
+            }
+        }
+
+        ARM_COMPUTE_ERROR_ON_MSG((output->info()->dimension(0) != conv_w) || (output->info()->dimension(1) != conv_h), "Output shape does not match the expected one");
+        return;
     }
-#elif defined(__aarch64__)
-    if(NEScheduler::get().cpu_info().CPU >= CPUTarget::ARMV8 && dt == DataType::F32)
+
+#if defined(__arm__) || defined(__aarch64__)
+    if(!_run_implicit_gemm && dt == DataType::F32)
     {
-        _mm_optimised_kernel = support::cpp14::make_unique<NEGEMMAArch64Kernel>();
+        // Resolve the best micro-architecture variant for the CPU we are running on
+        _mm_optimised_kernel = NEKernelRegistry::get().create_as<NEGEMMAssemblyBaseKernel>("gemm_interleaved_f32", NEScheduler::get().cpu_info());
     }
 #endif /* defined(__arm__) || defined(__aarch64__) */
 
+    // F32 adds the bias in the col2im output stage while the element is still in-register,
+    // instead of appending a bias row to the weights and a ones column to the im2col output.
+    // That trims one row of multiply-accumulates from the GEMM and the ones writes from im2col.
+    // The implicit GEMM and pre-reshaped weights paths keep the appended row: the former
+    // bypasses col2im and the latter receives weights that already contain it
+    const bool fuse_bias_in_output_stage = _has_bias && (dt == DataType::F32) && !_are_weights_reshaped && !_run_implicit_gemm;
+
     unsigned int mat_weights_cols = weights->info()->dimension(3);
-    unsigned int mat_weights_rows = weights->info()->dimension(0) * weights->info()->dimension(1) * weights->info()->dimension(2) + (_has_bias ? 1 : 0);
+    unsigned int mat_weights_rows = weights->info()->dimension(0) * weights->info()->dimension(1) * weights->info()->dimension(2) + ((_has_bias && !fuse_bias_in_output_stage) ? 1 : 0);
 
     // Reshape weights if needed
     if(_mm_optimised_kernel != nullptr)
@@ -181,9 +279,7 @@ void NEConvolutionLayer::configure(const ITensor *input, const ITensor *weights,
             TensorShape reshaped_weights_shape{ mat_weights_cols, mat_weights_rows };
 
             // Create tensor to store the reshaped weights
-            _weights_reshaped.allocator()->init(TensorInfo(reshaped_weights_shape, 1, dt, fixed_point_position));
-            _reshape_weights.configure(weights, biases, &_weights_reshaped, false /* 1xW transpose */);
-            weights = &_weights_reshaped;
+            weights = prepare_reshaped_weights(weights, fuse_bias_in_output_stage ? nullptr : biases, TensorInfo(reshaped_weights_shape, 1, dt, fixed_point_position), "conv_reshape", false /* 1xW transpose */);
         }
     }
     else
@@ -211,12 +307,29 @@ void NEConvolutionLayer::configure(const ITensor *input, const ITensor *weights,
             }
 
             // Create tensor to store the reshaped weights
-            _weights_reshaped.allocator()->init(TensorInfo(reshaped_weights_shape, 1, dt, fixed_point_position));
-            _reshape_weights.configure(weights, biases, &_weights_reshaped, !_is_fully_connected_convolution /* 1xW transpose */);
-            weights = &_weights_reshaped;
+            weights = prepare_reshaped_weights(weights, fuse_bias_in_output_stage ? nullptr : biases, TensorInfo(reshaped_weights_shape, 1, dt, fixed_point_position),
+                                               _is_fully_connected_convolution ? "conv_reshape" : "conv_reshape_t1xw", !_is_fully_connected_convolution /* 1xW transpose */);
         }
     }
 
+    if(_run_implicit_gemm)
+    {
+        // The A operand tiles are gathered on the fly into the scheduler's per-thread scratch
+        // arena, so no im2col, interleave or GEMM output intermediates are required
+        NEScheduler::get().reserve_workspace(4 * mat_weights_rows * sizeof(float));
+
+        _implicit_gemm_kernel.configure(input, weights, output, Size2D(kernel_width, kernel_height), conv_info, _has_bias);
+
+        ARM_COMPUTE_ERROR_ON_MSG((output->info()->dimension(0) != conv_w) || (output->info()->dimension(1) != conv_h), "Output shape does not match the expected one");
+
+        // Allocate intermediate tensor
+        if(_original_weights == nullptr)
+        {
+            _weights_reshaped.allocator()->allocate();
+        }
+        return;
+    }
+
     // Create tensor to store im2col reshaped inputs
     const unsigned int mat_input_cols = mat_weights_rows;
     const unsigned int mat_input_rows = conv_w * conv_h;
@@ -225,8 +338,27 @@ void NEConvolutionLayer::configure(const ITensor *input, const ITensor *weights,
     shape_im2col.set(0, mat_input_cols);
     shape_im2col.set(1, mat_input_rows);
     shape_im2col.set(2, 1);
-    _input_im2col_reshaped.allocator()->init(TensorInfo(shape_im2col, 1, dt, fixed_point_position));
-    _memory_group.manage(&_input_im2col_reshaped);
+    const TensorInfo im2col_info(shape_im2col, 1, dt, fixed_point_position);
+
+    _im2col_output = &_input_im2col_reshaped;
+    _run_im2col    = true;
+
+    if(Im2ColCache::get().is_enabled())
+    {
+        // Convolutions over the same feature map share one im2col result: only the first
+        // function configured with this input and geometry recomputes it each frame. The
+        // shared tensor is owned by the cache so it stays live across every consumer's run
+        std::string geometry = "im2col_" + support::cpp11::to_string(kernel_width) + "x" + support::cpp11::to_string(kernel_height)
+                               + "_s" + support::cpp11::to_string(conv_info.stride().first) + "x" + support::cpp11::to_string(conv_info.stride().second)
+                               + "_p" + support::cpp11::to_string(conv_info.pad().first) + "x" + support::cpp11::to_string(conv_info.pad().second)
+                               + "_d" + support::cpp11::to_string(dilation.width) + "x" + support::cpp11::to_string(dilation.height) + ((_has_bias && !fuse_bias_in_output_stage) ? "_bias" : "");
+        _im2col_output = Im2ColCache::get().acquire(input, geometry, im2col_info, _run_im2col);
+    }
+    else
+    {
+        _input_im2col_reshaped.allocator()->init(im2col_info);
+        _memory_group.manage(&_input_im2col_reshaped);
+    }
 
     // Create tensor (interleave) to prepare input tensor for GEMM
     if(!_is_fully_connected_convolution && _mm_optimised_kernel == nullptr)
@@ -239,14 +371,17 @@ void NEConvolutionLayer::configure(const ITensor *input, const ITensor *weights,
     }
 
     // Create GEMM output tensor
-    TensorShape shape_gemm(_input_im2col_reshaped.info()->tensor_shape());
+    TensorShape shape_gemm(_im2col_output->info()->tensor_shape());
     shape_gemm.set(0, mat_weights_cols);
     shape_gemm.set(1, mat_input_rows);
     _gemm_output.allocator()->init(TensorInfo(shape_gemm, 1, dt, fixed_point_position));
     _memory_group.manage(&_gemm_output);
 
     // Configure kernels
-    _input_im2col_kernel.configure(input, &_input_im2col_reshaped, Size2D(kernel_width, kernel_height), conv_info, _has_bias);
+    if(_run_im2col)
+    {
+        _input_im2col_kernel.configure(input, _im2col_output, Size2D(kernel_width, kernel_height), conv_info, _has_bias && !fuse_bias_in_output_stage, dilation);
+    }
 
 #if defined(__arm__) || defined(__aarch64__)
     if(_mm_optimised_kernel != nullptr)
@@ -255,7 +390,7 @@ void NEConvolutionLayer::configure(const ITensor *input, const ITensor *weights,
 
         const int M = _gemm_output.info()->tensor_shape().y();
         const int N = _gemm_output.info()->tensor_shape().x();
-        const int K = _input_im2col_reshaped.info()->tensor_shape().x();
+        const int K = _im2col_output->info()->tensor_shape().x();
 
 #if defined(__arm__)
         GemmInterleaved<sgemm_8x6, float, float> gemm(&ci, M, N, K, false, false);
@@ -270,11 +405,11 @@ void NEConvolutionLayer::configure(const ITensor *input, const ITensor *weights,
         // Configure matrix multiplication kernel
         if(_is_fully_connected_convolution)
         {
-            _mm_optimised_kernel->configure(&_input_im2col_reshaped, weights, &_gemm_output, &_workspace, 1.f, 0.f, false, false);
+            _mm_optimised_kernel->configure(_im2col_output, weights, &_gemm_output, &_workspace, 1.f, 0.f, false, false);
         }
         else
         {
-            _mm_optimised_kernel->configure(&_input_im2col_reshaped, weights, &_gemm_output, &_workspace);
+            _mm_optimised_kernel->configure(_im2col_output, weights, &_gemm_output, &_workspace);
         }
 
         _workspace.allocator()->allocate();
@@ -284,61 +419,106 @@ void NEConvolutionLayer::configure(const ITensor *input, const ITensor *weights,
     {
         if(_is_fully_connected_convolution)
         {
-            _mm_kernel.configure(&_input_im2col_reshaped, weights, &_gemm_output, 1.0f);
+            _mm_kernel.configure(_im2col_output, weights, &_gemm_output, 1.0f);
         }
         else
         {
-            _input_interleave_kernel.configure(&_input_im2col_reshaped, &_input_interleaved_reshaped);
+            _input_interleave_kernel.configure(_im2col_output, &_input_interleaved_reshaped);
             _mm_kernel.configure(&_input_interleaved_reshaped, weights, &_gemm_output, 1.0f);
             _input_interleaved_reshaped.allocator()->allocate();
         }
     }
 
-    _input_im2col_reshaped.allocator()->allocate();
-    _output_col2im_kernel.configure(&_gemm_output, output, std::make_pair(conv_w, conv_h));
+    if(_im2col_output == &_input_im2col_reshaped)
+    {
+        _input_im2col_reshaped.allocator()->allocate();
+    }
+    _output_col2im_kernel.configure(&_gemm_output, output, std::make_pair(conv_w, conv_h), act_info, fuse_bias_in_output_stage ? biases : nullptr);
     _gemm_output.allocator()->allocate();
 
     ARM_COMPUTE_ERROR_ON_MSG((output->info()->dimension(0) != conv_w) || (output->info()->dimension(1) != conv_h), "Output shape does not match the expected one");
 
     // Allocate intermediate tensor
-    if(!_are_weights_reshaped)
+    if(!_are_weights_reshaped && _original_weights == nullptr)
     {
         _weights_reshaped.allocator()->allocate();
     }
 }
 
-void NEConvolutionLayer::run()
+bool NEConvolutionLayer::original_weights_retained() const
+{
+    return _original_weights_retained;
+}
+
+void NEConvolutionLayer::prepare()
 {
-    // Run weights reshaping (Runs once for every configure)
-    if(!_are_weights_reshaped)
+    // Run weights reshaping (Runs once for every configure). The direct convolution
+    // path uses the original weights and never configures the reshape
+    if(!_are_weights_reshaped && !_run_direct_convolution)
     {
         _are_weights_reshaped = true;
-        _reshape_weights.run();
+
+        // Skip the reshape when another function instance or a cache restore already produced it
+        if(_original_weights == nullptr || !WeightsCache::get().is_reshaped(_original_weights, _weights_transform))
+        {
+            _reshape_weights.run();
+
+            if(_original_weights != nullptr)
+            {
+                WeightsCache::get().mark_reshaped(_original_weights, _weights_transform);
+            }
+        }
     }
+}
 
-    _memory_group.acquire();
+void NEConvolutionLayer::run()
+{
+    prepare();
 
-    // Run input reshaping
-    NEScheduler::get().schedule(&_input_im2col_kernel, Window::DimY);
+    _memory_group.acquire();
 
-    // Runs matrix multiply on reshaped matrices
-    if(_mm_optimised_kernel != nullptr)
+    if(_run_implicit_gemm)
+    {
+        // Run the implicit GEMM convolution, the A operand is gathered directly from the input
+        NEScheduler::get().schedule(&_implicit_gemm_kernel, Window::DimY);
+    }
+    else if(_run_direct_convolution)
     {
-        NEScheduler::get().schedule(_mm_optimised_kernel.get(), Window::DimY);
+        // Run the 1x1 direct convolution, which reads the input in place
+        NEScheduler::get().schedule(&_direct_conv_kernel, Window::DimZ);
+
+        if(_has_bias)
+        {
+            NEScheduler::get().schedule(&_accumulate_bias_kernel, Window::DimY);
+        }
     }
     else
     {
-        if(!_is_fully_connected_convolution)
+        // Run input reshaping, unless another function sharing the cached im2col result does it
+        if(_run_im2col)
         {
-            // Run interleave
-            NEScheduler::get().schedule(&_input_interleave_kernel, Window::DimY);
+            NEScheduler::get().schedule(&_input_im2col_kernel, Window::DimY);
         }
 
-        NEScheduler::get().schedule(&_mm_kernel, Window::DimY);
-    }
+        // Runs matrix multiply on reshaped matrices
+        if(_mm_optimised_kernel != nullptr)
+        {
+            NEScheduler::get().schedule(_mm_optimised_kernel.get(), Window::DimY);
+        }
+        else
+        {
+            if(!_is_fully_connected_convolution)
+            {
+                // Run interleave
+                NEScheduler::get().schedule(&_input_interleave_kernel, Window::DimY);
+            }
+
+            NEScheduler::get().schedule(&_mm_kernel, Window::DimY);
+        }
 
-    // Reshape output matrix
-    NEScheduler::get().schedule(&_output_col2im_kernel, Window::DimY);
+        // Reshape output matrix
+        NEScheduler::get().schedule(&_output_col2im_kernel, Window::DimY);
+    }
 
     _memory_group.release();
 }
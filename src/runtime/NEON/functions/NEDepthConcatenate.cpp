@@ -64,6 +64,28 @@ void NEDepthConcatenate::configure(std::vector<ITensor *> inputs_vector, ITensor
     }
 }
 
+std::vector<std::unique_ptr<SubTensor>> NEDepthConcatenate::create_subtensor_outputs(const std::vector<TensorShape> &branch_shapes, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+    ARM_COMPUTE_ERROR_ON(branch_shapes.size() < 2);
+
+    std::vector<std::unique_ptr<SubTensor>> subtensors;
+    subtensors.reserve(branch_shapes.size());
+
+    size_t depth_offset = 0;
+    for(const auto &shape : branch_shapes)
+    {
+        // Pure depth slices: every branch must span the full x/y extent of the output
+        ARM_COMPUTE_ERROR_ON(shape.x() != output->info()->dimension(0) || shape.y() != output->info()->dimension(1));
+
+        subtensors.emplace_back(support::cpp14::make_unique<SubTensor>(output, shape, Coordinates(0, 0, static_cast<int>(depth_offset))));
+        depth_offset += shape[2];
+    }
+    ARM_COMPUTE_ERROR_ON_MSG(depth_offset != output->info()->dimension(2), "Branch depths do not add up to the output depth");
+
+    return subtensors;
+}
+
 void NEDepthConcatenate::run()
 {
     for(unsigned i = 0; i < _num_inputs; ++i)
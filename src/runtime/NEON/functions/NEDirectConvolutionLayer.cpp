@@ -40,6 +40,9 @@ NEDirectConvolutionLayer::NEDirectConvolutionLayer(std::shared_ptr<IMemoryManage
 
 void NEDirectConvolutionLayer::configure(ITensor *input, const ITensor *weights, const ITensor *bias, ITensor *output, const PadStrideInfo &conv_info)
 {
+    ARM_COMPUTE_ERROR_ON_MSG(input->info()->data_type() == DataType::F16 && !cpu_has_fp16(NEScheduler::get().cpu_info()),
+                             "Half-precision arithmetic requires an ARMv8.2-A CPU");
+
     // Free accumulator
     if(_accumulator.buffer() != nullptr)
     {
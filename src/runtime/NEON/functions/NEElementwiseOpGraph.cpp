@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEElementwiseOpGraph.h"
+
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+using namespace arm_compute;
+
+NEElementwiseOpGraph::NodeId NEElementwiseOpGraph::add_input(const ITensor *input)
+{
+    return _kernel.add_input(input);
+}
+
+NEElementwiseOpGraph::NodeId NEElementwiseOpGraph::add_threshold(NodeId src, uint8_t threshold, uint8_t false_value, uint8_t true_value, ThresholdType type, uint8_t upper)
+{
+    return _kernel.add_threshold(src, threshold, false_value, true_value, type, upper);
+}
+
+NEElementwiseOpGraph::NodeId NEElementwiseOpGraph::add_and(NodeId src0, NodeId src1)
+{
+    return _kernel.add_and(src0, src1);
+}
+
+NEElementwiseOpGraph::NodeId NEElementwiseOpGraph::add_or(NodeId src0, NodeId src1)
+{
+    return _kernel.add_or(src0, src1);
+}
+
+NEElementwiseOpGraph::NodeId NEElementwiseOpGraph::add_xor(NodeId src0, NodeId src1)
+{
+    return _kernel.add_xor(src0, src1);
+}
+
+NEElementwiseOpGraph::NodeId NEElementwiseOpGraph::add_not(NodeId src)
+{
+    return _kernel.add_not(src);
+}
+
+void NEElementwiseOpGraph::add_output(NodeId node, ITensor *output)
+{
+    _kernel.add_output(node, output);
+}
+
+void NEElementwiseOpGraph::configure()
+{
+    _kernel.configure();
+}
+
+void NEElementwiseOpGraph::run()
+{
+    NEScheduler::get().schedule(&_kernel, Window::DimY);
+}
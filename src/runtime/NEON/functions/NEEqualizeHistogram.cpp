@@ -43,6 +43,10 @@ void NEEqualizeHistogram::configure(const IImage *input, IImage *output)
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
 
+    // Reserve per-thread scratch for the local histograms: the bins and the
+    // fold counter of the merge
+    NEScheduler::get().reserve_workspace((nr_bins + 1) * sizeof(uint32_t));
+
     // Configure kernels
     _histogram_kernel.configure(input, &_hist);
     _cd_histogram_kernel.configure(input, &_hist, &_cum_dist, &_cd_lut);
@@ -23,15 +23,53 @@
  */
 #include "arm_compute/runtime/NEON/functions/NEFlattenLayer.h"
 
-#include "arm_compute/core/NEON/kernels/NEIm2ColKernel.h"
+#include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/Size2D.h"
-#include "support/ToolchainSupport.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
 
 using namespace arm_compute;
 
+NEFlattenLayer::NEFlattenLayer()
+    : _kernel(), _input(nullptr), _output(nullptr), _is_aliased(false), _is_prepared(false)
+{
+}
+
 void NEFlattenLayer::configure(const ITensor *input, ITensor *output)
 {
-    auto k = arm_compute::support::cpp14::make_unique<NEIm2ColKernel>();
-    k->configure(input, output, Size2D(1, 1), PadStrideInfo(1, 1, 0, 0), false);
-    _kernel = std::move(k);
+    _input  = input;
+    _output = output;
+
+    _kernel.configure(input, output, Size2D(1, 1), PadStrideInfo(1, 1, 0, 0), false);
+}
+
+void NEFlattenLayer::prepare()
+{
+    if(_is_prepared)
+    {
+        return;
+    }
+    _is_prepared = true;
+
+    // Flattening a dense tensor preserves the memory layout, so when the output has no buffer of
+    // its own yet it can borrow the input's memory instead of copying. The decision is taken here
+    // rather than at configure time, as neighbouring kernels may still extend the tensors' padding
+    // between configure() and the first run.
+    auto *output_tensor = dynamic_cast<Tensor *>(_output);
+    if(output_tensor != nullptr && output_tensor->buffer() == nullptr && _input->buffer() != nullptr
+       && !_input->info()->has_padding() && !_output->info()->has_padding())
+    {
+        output_tensor->allocator()->import_memory(_input->buffer(), _input->info()->total_size());
+        _is_aliased = true;
+    }
+}
+
+void NEFlattenLayer::run()
+{
+    prepare();
+
+    if(!_is_aliased)
+    {
+        NEScheduler::get().schedule(&_kernel, Window::DimY);
+    }
 }
\ No newline at end of file
@@ -26,6 +26,7 @@
 #include "arm_compute/core/Size2D.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/WeightsCache.h"
 
 #include <algorithm>
 #include <cmath>
@@ -104,8 +105,9 @@ void NEFullyConnectedLayerReshapeWeights::run()
 }
 
 NEFullyConnectedLayer::NEFullyConnectedLayer(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _im2col_kernel(), _reshape_weights_kernel(), _interleave4x4_kernel(), _mm_kernel(), _accumulate_biases_kernel(), _im2col_output(), _interleave4x4_output(),
-      _reshape_weights_output(), _are_weights_reshaped(false), _is_batched_fc_layer(false), _linearize_input(false), _accumulate_biases(false)
+    : _memory_group(std::move(memory_manager)), _im2col_kernel(), _reshape_weights_kernel(), _interleave4x4_kernel(), _mm_kernel(), _gemv_kernel(), _accumulate_biases_kernel(), _im2col_output(),
+      _interleave4x4_output(), _reshape_weights_output(), _original_weights(nullptr), _weights_transform(), _are_weights_reshaped(false), _is_batched_fc_layer(false), _use_gemv(false),
+      _linearize_input(false), _accumulate_biases(false), _original_weights_retained(true)
 {
 }
 
@@ -142,12 +144,19 @@ void NEFullyConnectedLayer::configure(const ITensor *input, const ITensor *weigh
     ARM_COMPUTE_ERROR_ON(input->info()->tensor_shape().total_size_upper(num_input_dimensions) != output->info()->tensor_shape().total_size_upper(1));
     ARM_COMPUTE_ERROR_ON(weights->info()->num_dimensions() > 2);
 
+    // Batch-1 F32 runs the dedicated SGEMV kernel, which streams the weights in the same
+    // transposed 1xW layout the batched path uses and is bound by memory bandwidth only
+    _use_gemv = !_is_batched_fc_layer && (data_type == DataType::F32) && !are_weights_reshaped;
+
     const size_t   interleave_width = 16 / input->info()->element_size();
+    const bool     apply_1xw        = _is_batched_fc_layer || _use_gemv;
     const ITensor *weights_to_use   = weights;
 
-    if(!are_weights_reshaped && (transpose_weights || _is_batched_fc_layer))
+    if(!are_weights_reshaped && (transpose_weights || apply_1xw))
     {
         weights_to_use = &_reshape_weights_output;
+        // The matrix multiply only reads the function's own reshaped copy after prepare()
+        _original_weights_retained = false;
 
         TensorShape reshaped_weights_shape(weights->info()->tensor_shape());
 
@@ -159,22 +168,35 @@ void NEFullyConnectedLayer::configure(const ITensor *input, const ITensor *weigh
             reshaped_weights_shape.set(1, shape_x);
         }
 
-        // If the we run multiple batches we need 1xW transpose, too.
-        if(_is_batched_fc_layer)
+        // If the we run multiple batches or the SGEMV kernel we need 1xW transpose, too.
+        if(apply_1xw)
         {
             const float shape_x = reshaped_weights_shape.x();
             reshaped_weights_shape.set(0, reshaped_weights_shape.y() * interleave_width);
             reshaped_weights_shape.set(1, static_cast<unsigned int>(std::ceil(shape_x / interleave_width)));
         }
 
-        _reshape_weights_output.allocator()->init(TensorInfo(reshaped_weights_shape, 1, data_type, fixed_point_position));
+        ITensor *reshape_output = &_reshape_weights_output;
+
+        if(WeightsCache::get().is_enabled())
+        {
+            // Share the reshaped form between all function instances configured with the same weights
+            _original_weights  = weights;
+            _weights_transform = std::string("fc") + (transpose_weights ? "_t" : "") + (apply_1xw ? "_t1xw" : "");
+            reshape_output     = WeightsCache::get().acquire(weights, _weights_transform, TensorInfo(reshaped_weights_shape, 1, data_type, fixed_point_position));
+            weights_to_use     = reshape_output;
+        }
+        else
+        {
+            _reshape_weights_output.allocator()->init(TensorInfo(reshaped_weights_shape, 1, data_type, fixed_point_position));
+        }
 
         // Reshape the weights
-        _reshape_weights_kernel.configure(weights, &_reshape_weights_output, transpose_weights, _is_batched_fc_layer);
+        _reshape_weights_kernel.configure(weights, reshape_output, transpose_weights, apply_1xw);
     }
 
     // Check correct shape of weights
-    if(_is_batched_fc_layer)
+    if(apply_1xw)
     {
         // Transpose + Transpose1xW
         ARM_COMPUTE_ERROR_ON(weights_to_use->info()->tensor_shape().x() != linear_input_size * interleave_width);
@@ -217,19 +239,36 @@ void NEFullyConnectedLayer::configure(const ITensor *input, const ITensor *weigh
     }
 
     // Configure matrix multiply kernel
-    _mm_kernel.configure(multiply_input, weights_to_use, output, 1.0f);
+    if(_use_gemv)
+    {
+        _gemv_kernel.configure(multiply_input, weights_to_use, output);
+    }
+    else
+    {
+        _mm_kernel.configure(multiply_input, weights_to_use, output, 1.0f);
+    }
 
     if(_accumulate_biases)
     {
         ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
         ARM_COMPUTE_ERROR_ON(biases->info()->tensor_shape().x() != output->info()->tensor_shape().x());
 
-        // Configure accumulate biases kernel
-        _accumulate_biases_kernel.configure(output, biases);
+        if(!_use_gemv && data_type == DataType::F32)
+        {
+            // The bias add runs in-register before the multiply kernel's output store, saving the
+            // full read and re-write of the output matrix the separate accumulate pass costs
+            _mm_kernel.set_fused_epilogue(biases, nullptr, 0.f);
+            _accumulate_biases = false;
+        }
+        else
+        {
+            // Configure accumulate biases kernel
+            _accumulate_biases_kernel.configure(output, biases);
+        }
     }
 
     // Allocate the transpose tensor if the are_weights_reshaped flag is false and once all the configure methods have been called
-    if(!are_weights_reshaped && (transpose_weights || _is_batched_fc_layer))
+    if(!are_weights_reshaped && (transpose_weights || apply_1xw) && _original_weights == nullptr)
     {
         // Allocate the tensor for the weights reshaped
         _reshape_weights_output.allocator()->allocate();
@@ -246,14 +285,34 @@ void NEFullyConnectedLayer::configure(const ITensor *input, const ITensor *weigh
     }
 }
 
-void NEFullyConnectedLayer::run()
+bool NEFullyConnectedLayer::original_weights_retained() const
+{
+    return _original_weights_retained;
+}
+
+void NEFullyConnectedLayer::prepare()
 {
     // Reshape of the weights (happens only once)
     if(!_are_weights_reshaped)
     {
         _are_weights_reshaped = true;
-        _reshape_weights_kernel.run();
+
+        // Skip the reshape when another function instance or a cache restore already produced it
+        if(_original_weights == nullptr || !WeightsCache::get().is_reshaped(_original_weights, _weights_transform))
+        {
+            _reshape_weights_kernel.run();
+
+            if(_original_weights != nullptr)
+            {
+                WeightsCache::get().mark_reshaped(_original_weights, _weights_transform);
+            }
+        }
     }
+}
+
+void NEFullyConnectedLayer::run()
+{
+    prepare();
 
     _memory_group.acquire();
 
@@ -270,7 +329,14 @@ void NEFullyConnectedLayer::run()
     }
 
     // Run matrix multiply
-    NEScheduler::get().schedule(&_mm_kernel, _is_batched_fc_layer ? Window::DimY : Window::DimX);
+    if(_use_gemv)
+    {
+        NEScheduler::get().schedule(&_gemv_kernel, Window::DimX);
+    }
+    else
+    {
+        NEScheduler::get().schedule(&_mm_kernel, _is_batched_fc_layer ? Window::DimY : Window::DimX);
+    }
 
     // Accumulate biases if provided
     if(_accumulate_biases)
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEFuseBatchNormalization.h"
+
+#include "arm_compute/core/NEON/kernels/NEFuseBatchNormalizationKernel.h"
+#include "support/ToolchainSupport.h"
+
+using namespace arm_compute;
+
+void NEFuseBatchNormalization::configure(const ITensor *weights, const ITensor *bias, ITensor *fused_weights, ITensor *fused_bias,
+                                         const ITensor *mean, const ITensor *var, const ITensor *beta, const ITensor *gamma, float epsilon)
+{
+    auto k = arm_compute::support::cpp14::make_unique<NEFuseBatchNormalizationKernel>();
+    k->configure(weights, bias, fused_weights, fused_bias, mean, var, beta, gamma, epsilon);
+    _kernel = std::move(k);
+}
+
+void NEFuseBatchNormalization::configure(const ITensor *weights, const ITensor *bias, ITensor *fused_weights, ITensor *fused_bias,
+                                         const ITensor *scale, const ITensor *shift)
+{
+    auto k = arm_compute::support::cpp14::make_unique<NEFuseBatchNormalizationKernel>();
+    k->configure(weights, bias, fused_weights, fused_bias, scale, shift);
+    _kernel = std::move(k);
+}
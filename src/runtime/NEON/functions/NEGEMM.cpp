@@ -26,8 +26,7 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensor.h"
-#include "arm_compute/core/NEON/kernels/arm32/NEGEMMAArch32Kernel.h"
-#include "arm_compute/core/NEON/kernels/arm64/NEGEMMAArch64Kernel.h"
+#include "arm_compute/core/NEON/NEKernelRegistry.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Validate.h"
@@ -38,8 +37,10 @@
 namespace arm_compute
 {
 #include "arm_compute/core/NEON/kernels/assembly/gemm_interleaved.hpp"
+#include "arm_compute/core/NEON/kernels/assembly/gemv_transposed.hpp"
 #include "arm_compute/core/NEON/kernels/assembly/kernels/a32_sgemm_8x6.hpp"
 #include "arm_compute/core/NEON/kernels/assembly/kernels/a64_sgemm_12x8.hpp"
+#include "arm_compute/core/NEON/kernels/assembly/kernels/a64_sgemv_trans.hpp"
 } // namespace arm_compute
 
 #include <cmath>
@@ -48,13 +49,15 @@ namespace arm_compute
 {
 NEGEMM::NEGEMM(std::shared_ptr<IMemoryManager> memory_manager)
     : _memory_group(std::move(memory_manager)), _interleave_kernel(), _transpose_kernel(), _mm_kernel(), _mm_optimised_kernel(nullptr), _ma_kernel(), _tmp_a(), _tmp_b(), _workspace(),
-      _run_vector_matrix_multiplication(false), _run_addition(false)
+      _run_vector_matrix_multiplication(false), _run_interleave(false), _run_addition(false)
 {
 }
 
 void NEGEMM::configure(const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d, float alpha, float beta)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F32, DataType::F16, DataType::QS8, DataType::QS16);
+    ARM_COMPUTE_ERROR_ON_MSG(a->info()->data_type() == DataType::F16 && !cpu_has_fp16(NEScheduler::get().cpu_info()),
+                             "Half-precision arithmetic requires an ARMv8.2-A CPU");
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(a, b, d);
     ARM_COMPUTE_ERROR_ON_MSG(a->info()->dimension(0) != b->info()->dimension(1), "The product AB is defined only if the number of columns in A is equal to the number of rows in B");
 
@@ -74,27 +77,60 @@ void NEGEMM::configure(const ITensor *a, const ITensor *b, const ITensor *c, ITe
     // If so, all the kernels for reshaping the tensors can be skipped
     if(_run_vector_matrix_multiplication)
     {
-        // Configure the matrix multiply kernel
-        _mm_kernel.configure(a, b, d, alpha);
+#if defined(__aarch64__)
+        if(a->info()->data_type() == DataType::F32 && (c == nullptr || beta == 0.f))
+        {
+            // Resolve the best micro-architecture variant for the CPU we are running on
+            _mm_optimised_kernel = NEKernelRegistry::get().create_as<NEGEMMAssemblyBaseKernel>("gemv_trans_f32", NEScheduler::get().cpu_info());
+        }
 
-        // Configure matrix addition kernel
-        if(beta != 0 && c != nullptr)
+        if(_mm_optimised_kernel != nullptr)
         {
-            _ma_kernel.configure(c, d, beta);
-            _run_addition = true;
+            struct CPUInfo ci = NEScheduler::get().cpu_info();
+
+            const int N = d->info()->tensor_shape().x();
+            const int K = a->info()->tensor_shape().x();
+
+            GemvTransposed<sgemv_trans, float, float> gemv(&ci, N, K);
+
+            constexpr size_t alignment = 4096;
+            _workspace.allocator()->init(TensorInfo(TensorShape{ (gemv.get_working_size() + alignment - 1) * NEScheduler::get().num_threads() }, 1, DataType::U8));
+            _memory_group.manage(&_workspace);
+
+            // Configure matrix multiplication kernel
+            _mm_optimised_kernel->configure(a, b, d, &_workspace, alpha, 0.f);
+
+            _workspace.allocator()->allocate();
+        }
+        else
+#endif /* defined(__aarch64__) */
+        {
+            // Configure the matrix multiply kernel
+            _mm_kernel.configure(a, b, d, alpha);
+
+            // Configure matrix addition kernel. F32 accumulates beta * C in-register before the
+            // multiply kernel's output store instead of re-reading the whole output in a second pass
+            if(beta != 0 && c != nullptr)
+            {
+                if(a->info()->data_type() == DataType::F32)
+                {
+                    _mm_kernel.set_fused_epilogue(nullptr, c, beta);
+                }
+                else
+                {
+                    _ma_kernel.configure(c, d, beta);
+                    _run_addition = true;
+                }
+            }
         }
     }
     else
     {
-#if defined(__arm__)
-        if(NEScheduler::get().cpu_info().CPU == CPUTarget::ARMV7 && a->info()->data_type() == DataType::F32 && (c == nullptr || beta == 0.f))
-        {
-            _mm_optimised_kernel = support::cpp14::make_unique<NEGEMMAArch32Kernel>();
-        }
-#elif defined(__aarch64__)
-        if(NEScheduler::get().cpu_info().CPU >= CPUTarget::ARMV8 && a->info()->data_type() == DataType::F32 && (c == nullptr || beta == 0.f))
+#if defined(__arm__) || defined(__aarch64__)
+        if(a->info()->data_type() == DataType::F32 && (c == nullptr || beta == 0.f))
         {
-            _mm_optimised_kernel = support::cpp14::make_unique<NEGEMMAArch64Kernel>();
+            // Resolve the best micro-architecture variant for the CPU we are running on
+            _mm_optimised_kernel = NEKernelRegistry::get().create_as<NEGEMMAssemblyBaseKernel>("gemm_interleaved_f32", NEScheduler::get().cpu_info());
         }
 #endif /* defined(__arm__) || defined(__aarch64__) */
 
@@ -125,44 +161,70 @@ void NEGEMM::configure(const ITensor *a, const ITensor *b, const ITensor *c, ITe
         else
 #endif /* defined(__arm__) || defined(__aarch64__) */
         {
-            TensorShape shape_tmp_a = a->info()->tensor_shape();
             TensorShape shape_tmp_b = b->info()->tensor_shape();
 
-            shape_tmp_a.set(0, a->info()->dimension(0) * 4);
-            shape_tmp_a.set(1, std::ceil(a->info()->dimension(1) / 4.0f));
-
             const unsigned int transpose_w = 16 / data_size_from_type(b->info()->data_type());
             shape_tmp_b.set(0, b->info()->dimension(1) * transpose_w);
             shape_tmp_b.set(1, std::ceil(b->info()->dimension(0) / static_cast<float>(transpose_w)));
 
-            TensorInfo info_a(shape_tmp_a, 1, a->info()->data_type(), a->info()->fixed_point_position());
             TensorInfo info_b(shape_tmp_b, 1, b->info()->data_type(), a->info()->fixed_point_position());
 
-            _tmp_a.allocator()->init(info_a);
             _tmp_b.allocator()->init(info_b);
-
-            // Manage intermediate buffers
-            _memory_group.manage(&_tmp_a);
             _memory_group.manage(&_tmp_b);
 
-            // Configure interleave kernel
-            _interleave_kernel.configure(a, &_tmp_a);
-
             // Configure transpose kernel
             _transpose_kernel.configure(b, &_tmp_b);
 
-            // Configure matrix multiplication kernel
-            _mm_kernel.configure(&_tmp_a, &_tmp_b, d, alpha);
+            if(a->info()->data_type() == DataType::F32)
+            {
+                // F32 packs the A panels inside the multiply kernel itself, skipping the standalone
+                // interleave pass and its full round-trip of the A operand every run
+                _workspace.allocator()->init(TensorInfo(TensorShape{ NEGEMMMatrixMultiplyKernel::packing_workspace_size(a->info()->dimension(0), NEScheduler::get().num_threads()) }, 1, DataType::U8));
+                _memory_group.manage(&_workspace);
+
+                // Configure matrix multiplication kernel
+                _mm_kernel.configure(a, &_tmp_b, d, &_workspace, alpha);
+
+                _workspace.allocator()->allocate();
+            }
+            else
+            {
+                TensorShape shape_tmp_a = a->info()->tensor_shape();
+
+                shape_tmp_a.set(0, a->info()->dimension(0) * 4);
+                shape_tmp_a.set(1, std::ceil(a->info()->dimension(1) / 4.0f));
+
+                TensorInfo info_a(shape_tmp_a, 1, a->info()->data_type(), a->info()->fixed_point_position());
+
+                _tmp_a.allocator()->init(info_a);
+                _memory_group.manage(&_tmp_a);
+
+                // Configure interleave kernel
+                _interleave_kernel.configure(a, &_tmp_a);
+                _run_interleave = true;
+
+                // Configure matrix multiplication kernel
+                _mm_kernel.configure(&_tmp_a, &_tmp_b, d, alpha);
+
+                _tmp_a.allocator()->allocate();
+            }
 
             // Allocate once the all configure methods have been called
-            _tmp_a.allocator()->allocate();
             _tmp_b.allocator()->allocate();
 
-            // Configure matrix addition kernel
+            // Configure matrix addition kernel. F32 accumulates beta * C in-register before the
+            // multiply kernel's output store instead of re-reading the whole output in a second pass
             if(beta != 0 && c != nullptr)
             {
-                _ma_kernel.configure(c, d, beta);
-                _run_addition = true;
+                if(a->info()->data_type() == DataType::F32)
+                {
+                    _mm_kernel.set_fused_epilogue(nullptr, c, beta);
+                }
+                else
+                {
+                    _ma_kernel.configure(c, d, beta);
+                    _run_addition = true;
+                }
             }
         }
     }
@@ -181,8 +243,11 @@ void NEGEMM::run()
     {
         if(!_run_vector_matrix_multiplication)
         {
-            // Run interleave kernel
-            NEScheduler::get().schedule(&_interleave_kernel, Window::DimY);
+            // Run interleave kernel unless the multiply kernel packs its own A panels
+            if(_run_interleave)
+            {
+                NEScheduler::get().schedule(&_interleave_kernel, Window::DimY);
+            }
 
             // Run transpose kernel
             NEScheduler::get().schedule(&_transpose_kernel, Window::DimY);
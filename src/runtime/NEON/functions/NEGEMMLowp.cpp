@@ -31,19 +31,116 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/TensorAllocator.h"
+#include "support/ToolchainSupport.h"
+
+#include <cmath>
 
 using namespace arm_compute;
 
+namespace
+{
+/** Decompose a positive real multiplier into a Q31 fixed-point multiplier and the shift to apply after it.
+ *
+ * The result is quantized_multiplier / 2^31 * 2^shift, with quantized_multiplier in [2^30, 2^31);
+ * a negative shift denotes a rounding right shift, matching the kernel's epilogue.
+ */
+void quantize_multiplier(float multiplier, int32_t &quantized_multiplier, int32_t &shift)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(multiplier <= 0.f, "Requantization multipliers must be positive");
+
+    int   exponent = 0;
+    float mantissa = std::frexp(multiplier, &exponent);
+
+    int64_t q = static_cast<int64_t>(support::cpp11::round(mantissa * (1ll << 31)));
+    if(q == (1ll << 31))
+    {
+        q /= 2;
+        ++exponent;
+    }
+
+    quantized_multiplier = static_cast<int32_t>(q);
+    shift                = exponent;
+}
+} // namespace
+
 NEGEMMLowp::NEGEMMLowp(std::shared_ptr<IMemoryManager> memory_manager)
     : _memory_group(std::move(memory_manager)), _interleave_kernel(), _transpose_kernel(), _mm_kernel(), _tmp_a(), _tmp_b()
 {
 }
 
+void NEGEMMLowp::configure(const ITensor *a, const ITensor *b, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::QASYMM8);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(a, b, output);
+    ARM_COMPUTE_ERROR_ON_MSG(a->info()->quantization_info().empty() || b->info()->quantization_info().empty() || output->info()->quantization_info().empty(),
+                             "QASYMM8 tensors must carry quantization information");
+
+    const QuantizationInfo a_info   = a->info()->quantization_info();
+    const QuantizationInfo b_info   = b->info()->quantization_info();
+    const QuantizationInfo out_info = output->info()->quantization_info();
+
+    // The int32 accumulator holds sum((a_q - a_offset) * (b_q - b_offset)), i.e. real values scaled by
+    // (a_scale * b_scale). Requantizing to the output space therefore multiplies by
+    // multiplier = (a_scale * b_scale) / out_scale, approximated here as output_mult_int / 2^shift.
+    // The largest shift keeping output_mult_int within 8 bits is used to limit the risk of overflowing
+    // the int32 multiplication performed by the kernel.
+    const float multiplier = (a_info.scale * b_info.scale) / out_info.scale;
+
+    int32_t shift           = 16;
+    int32_t output_mult_int = 0;
+    for(; shift >= 0; --shift)
+    {
+        output_mult_int = static_cast<int32_t>(support::cpp11::round(multiplier * (1 << shift)));
+        if(output_mult_int <= 255)
+        {
+            break;
+        }
+    }
+    ARM_COMPUTE_ERROR_ON_MSG(output_mult_int == 0, "Requantization multiplier is too small to be approximated");
+
+    // The kernel adds output_offset before the multiplication, so the output zero-point has to be
+    // expressed in accumulator units
+    const int32_t output_offset = static_cast<int32_t>(support::cpp11::round(out_info.offset / multiplier));
+
+    configure(a, b, output, -a_info.offset, -b_info.offset, output_offset, output_mult_int, shift);
+}
+
+void NEGEMMLowp::configure(const ITensor *a, const ITensor *b, ITensor *output, int32_t a_offset, int32_t b_offset, int32_t output_offset, const std::vector<float> &output_multipliers)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(output);
+    ARM_COMPUTE_ERROR_ON_MSG(output_multipliers.size() != output->info()->dimension(0), "One real multiplier per output column is required");
+
+    std::vector<int32_t> quantized_multipliers(output_multipliers.size());
+    std::vector<int32_t> shifts(output_multipliers.size());
+    for(size_t i = 0; i < output_multipliers.size(); ++i)
+    {
+        quantize_multiplier(output_multipliers[i], quantized_multipliers[i], shifts[i]);
+    }
+
+    configure_reshaping(a, b, output);
+
+    _mm_kernel.configure(&_tmp_a, &_tmp_b, output, a_offset, b_offset, output_offset, quantized_multipliers, shifts);
+
+    // Allocate once the matrix multiply kernel has set its access windows, as they define the padding
+    _tmp_a.allocator()->allocate();
+    _tmp_b.allocator()->allocate();
+}
+
 void NEGEMMLowp::configure(const ITensor *a, const ITensor *b, ITensor *output, int32_t a_offset, int32_t b_offset, int32_t output_offset, int32_t output_mult_int, int32_t shift)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::U8);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(b, 1, DataType::U8);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
+    configure_reshaping(a, b, output);
+
+    _mm_kernel.configure(&_tmp_a, &_tmp_b, output, a_offset, b_offset, output_offset, output_mult_int, shift);
+
+    _tmp_a.allocator()->allocate();
+    _tmp_b.allocator()->allocate();
+}
+
+void NEGEMMLowp::configure_reshaping(const ITensor *a, const ITensor *b, const ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::U8, DataType::QASYMM8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(b, 1, DataType::U8, DataType::QASYMM8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::QASYMM8);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(a, b, output);
     ARM_COMPUTE_ERROR_ON_MSG(a->info()->dimension(0) != b->info()->dimension(1), "The product AB is defined only if the number of columns in A is equal to the number of rows in B");
     ARM_COMPUTE_ERROR_ON_MSG(a->info()->dimension(1) != output->info()->dimension(1), "The C matrix must have the same number of rows as the matrix A");
@@ -69,10 +166,6 @@ void NEGEMMLowp::configure(const ITensor *a, const ITensor *b, ITensor *output,
 
     _interleave_kernel.configure(a, &_tmp_a);
     _transpose_kernel.configure(b, &_tmp_b);
-    _mm_kernel.configure(&_tmp_a, &_tmp_b, output, a_offset, b_offset, output_offset, output_mult_int, shift);
-
-    _tmp_a.allocator()->allocate();
-    _tmp_b.allocator()->allocate();
 }
 
 void NEGEMMLowp::run()
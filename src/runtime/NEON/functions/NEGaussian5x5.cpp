@@ -23,46 +23,31 @@
  */
 #include "arm_compute/runtime/NEON/functions/NEGaussian5x5.h"
 
+#include "arm_compute/core/Error.h"
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/NEON/kernels/NEGaussian5x5Kernel.h"
 #include "arm_compute/core/PixelValue.h"
-#include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
-#include "arm_compute/runtime/TensorAllocator.h"
 
 using namespace arm_compute;
 
 NEGaussian5x5::NEGaussian5x5(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _kernel_hor(), _kernel_vert(), _tmp(), _border_handler()
+    : _kernel(), _border_handler()
 {
+    ARM_COMPUTE_UNUSED(memory_manager);
 }
 
 void NEGaussian5x5::configure(ITensor *input, ITensor *output, BorderMode border_mode, uint8_t constant_border_value)
 {
-    // Init temporary buffer
-    TensorInfo tensor_info(input->info()->tensor_shape(), 1, DataType::S16);
-    _tmp.allocator()->init(tensor_info);
+    // Create and configure the fused kernel: the horizontal pass feeds the vertical
+    // pass through a strip-sized ring buffer, no frame-sized intermediate is needed
+    _kernel.configure(input, output, border_mode == BorderMode::UNDEFINED);
 
-    // Manage intermediate buffers
-    _memory_group.manage(&_tmp);
-
-    // Create and configure kernels for the two passes
-    _kernel_hor.configure(input, &_tmp, border_mode == BorderMode::UNDEFINED);
-    _kernel_vert.configure(&_tmp, output, border_mode == BorderMode::UNDEFINED);
-
-    _tmp.allocator()->allocate();
-
-    _border_handler.configure(input, _kernel_hor.border_size(), border_mode, PixelValue(constant_border_value));
+    _border_handler.configure(input, _kernel.border_size(), border_mode, PixelValue(constant_border_value));
 }
 
 void NEGaussian5x5::run()
 {
     NEScheduler::get().schedule(&_border_handler, Window::DimZ);
-
-    _memory_group.acquire();
-
-    NEScheduler::get().schedule(&_kernel_hor, Window::DimY);
-    NEScheduler::get().schedule(&_kernel_vert, Window::DimY);
-
-    _memory_group.release();
+    NEScheduler::get().schedule(&_kernel, Window::DimY);
 }
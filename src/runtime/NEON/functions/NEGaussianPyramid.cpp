@@ -24,14 +24,15 @@
 #include "arm_compute/runtime/NEON/functions/NEGaussianPyramid.h"
 
 #include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/NEON/kernels/NEGaussianPyramidKernel.h"
 #include "arm_compute/core/NEON/kernels/NEScaleKernel.h"
 #include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
-#include "arm_compute/runtime/NEON/functions/NEGaussian5x5.h"
 #include "arm_compute/runtime/Pyramid.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
@@ -41,6 +42,28 @@
 
 using namespace arm_compute;
 
+namespace
+{
+/** Pre-compute the X byte offset of the input pixel sampled for each output pixel of a
+ * nearest-neighbour U8 resample, mirroring the coordinate rounding of @ref NEScale */
+void precompute_nearest_offsets(ITensor *offsets, float wr)
+{
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, offsets->info()->dimension(0), 1));
+    win.set(Window::DimY, Window::Dimension(0, offsets->info()->dimension(1), 1));
+
+    Iterator offsets_it(offsets, win);
+
+    execute_window_loop(win, [&](const Coordinates & id)
+    {
+        const size_t in_xi = (id.x() + 0.5f) * wr;
+
+        *reinterpret_cast<int32_t *>(offsets_it.ptr()) = in_xi;
+    },
+    offsets_it);
+}
+} // namespace
+
 NEGaussianPyramid::NEGaussianPyramid()
     : _input(nullptr), _pyramid(nullptr), _tmp()
 {
@@ -48,8 +71,7 @@ NEGaussianPyramid::NEGaussianPyramid()
 
 NEGaussianPyramidHalf::NEGaussianPyramidHalf() // NOLINT
     : _border_handler(),
-      _horizontal_reduction(),
-      _vertical_reduction()
+      _reduction()
 {
 }
 
@@ -70,30 +92,19 @@ void NEGaussianPyramidHalf::configure(const ITensor *input, IPyramid *pyramid, B
 
     if(num_levels > 1)
     {
-        _border_handler       = arm_compute::support::cpp14::make_unique<NEFillBorderKernel[]>(num_levels - 1);
-        _horizontal_reduction = arm_compute::support::cpp14::make_unique<NEGaussianPyramidHorKernel[]>(num_levels - 1);
-        _vertical_reduction   = arm_compute::support::cpp14::make_unique<NEGaussianPyramidVertKernel[]>(num_levels - 1);
-
-        // Apply half scale to the X dimension of the tensor shape
-        TensorShape tensor_shape = pyramid->info()->tensor_shape();
-        tensor_shape.set(0, (pyramid->info()->width() + 1) * SCALE_PYRAMID_HALF);
-
-        PyramidInfo pyramid_info(num_levels - 1, SCALE_PYRAMID_HALF, tensor_shape, Format::S16);
-        _tmp.init(pyramid_info);
+        _border_handler = arm_compute::support::cpp14::make_unique<NEFillBorderKernel[]>(num_levels - 1);
+        _reduction      = arm_compute::support::cpp14::make_unique<NEGaussianPyramidFusedKernel[]>(num_levels - 1);
 
         for(unsigned int i = 0; i < num_levels - 1; ++i)
         {
-            /* Configure horizontal kernel */
-            _horizontal_reduction[i].configure(_pyramid->get_pyramid_level(i), _tmp.get_pyramid_level(i), border_mode == BorderMode::UNDEFINED);
-
-            /* Configure vertical kernel */
-            _vertical_reduction[i].configure(_tmp.get_pyramid_level(i), _pyramid->get_pyramid_level(i + 1), border_mode == BorderMode::UNDEFINED);
+            /* Configure fused level reduction kernel. The horizontal result is
+             * consumed directly by the vertical pass, so no intermediate
+             * pyramid is needed */
+            _reduction[i].configure(_pyramid->get_pyramid_level(i), _pyramid->get_pyramid_level(i + 1), border_mode == BorderMode::UNDEFINED);
 
             /* Configure border */
-            _border_handler[i].configure(_pyramid->get_pyramid_level(i), _horizontal_reduction[i].border_size(), border_mode, PixelValue(constant_border_value));
+            _border_handler[i].configure(_pyramid->get_pyramid_level(i), _reduction[i].border_size(), border_mode, PixelValue(constant_border_value));
         }
-
-        _tmp.allocate();
     }
 }
 
@@ -110,14 +121,16 @@ void NEGaussianPyramidHalf::run()
     for(unsigned int i = 0; i < num_levels - 1; ++i)
     {
         NEScheduler::get().schedule(_border_handler.get() + i, Window::DimZ);
-        NEScheduler::get().schedule(_horizontal_reduction.get() + i, Window::DimY);
-        NEScheduler::get().schedule(_vertical_reduction.get() + i, Window::DimY);
+        NEScheduler::get().schedule(_reduction.get() + i, Window::DimY);
     }
 }
 
 NEGaussianPyramidOrb::NEGaussianPyramidOrb() // NOLINT
-    : _gaus5x5(),
-      _scale_nearest()
+    : _border_handler(),
+      _gaus5x5(),
+      _scale_nearest(),
+      _offsets(),
+      _sequence()
 {
 }
 
@@ -138,19 +151,45 @@ void NEGaussianPyramidOrb::configure(const ITensor *input, IPyramid *pyramid, Bo
 
     if(num_levels > 1)
     {
-        _gaus5x5       = arm_compute::support::cpp14::make_unique<NEGaussian5x5[]>(num_levels - 1);
-        _scale_nearest = arm_compute::support::cpp14::make_unique<NEScale[]>(num_levels - 1);
+        _border_handler = arm_compute::support::cpp14::make_unique<NEFillBorderKernel[]>(num_levels - 1);
+        _gaus5x5        = arm_compute::support::cpp14::make_unique<NEGaussian5x5FusedKernel[]>(num_levels - 1);
+        _scale_nearest  = arm_compute::support::cpp14::make_unique<NEScaleKernel[]>(num_levels - 1);
+        _offsets        = arm_compute::support::cpp14::make_unique<Tensor[]>(num_levels - 1);
 
         PyramidInfo pyramid_info(num_levels - 1, SCALE_PYRAMID_ORB, pyramid->info()->tensor_shape(), Format::U8);
         _tmp.init(pyramid_info);
 
+        _sequence.clear();
+        _sequence.reserve(3 * (num_levels - 1));
+
         for(unsigned int i = 0; i < num_levels - 1; ++i)
         {
+            ITensor *level_in  = _pyramid->get_pyramid_level(i);
+            ITensor *filtered  = _tmp.get_pyramid_level(i);
+            ITensor *level_out = _pyramid->get_pyramid_level(i + 1);
+
             /* Configure gaussian 5x5 */
-            _gaus5x5[i].configure(_pyramid->get_pyramid_level(i), _tmp.get_pyramid_level(i), border_mode, constant_border_value);
+            _gaus5x5[i].configure(level_in, filtered, border_mode == BorderMode::UNDEFINED);
+
+            /* Configure border */
+            _border_handler[i].configure(level_in, _gaus5x5[i].border_size(), border_mode, PixelValue(constant_border_value));
+
+            /* Configure scale. The level's scale ratio never changes, so the
+             * nearest-neighbour offset table is built here once and reused by
+             * every frame */
+            const TensorShape shape(level_out->info()->dimension(0), level_out->info()->dimension(1));
+            _offsets[i].allocator()->init(TensorInfo(shape, Format::S32));
+
+            _scale_nearest[i].configure(filtered, nullptr, nullptr, &_offsets[i], level_out, InterpolationPolicy::NEAREST_NEIGHBOR, true);
+
+            _offsets[i].allocator()->allocate();
 
-            /* Configure scale */
-            _scale_nearest[i].configure(_tmp.get_pyramid_level(i), _pyramid->get_pyramid_level(i + 1), InterpolationPolicy::NEAREST_NEIGHBOR, BorderMode::UNDEFINED);
+            const auto wr = static_cast<float>(filtered->info()->dimension(0)) / static_cast<float>(level_out->info()->dimension(0));
+            precompute_nearest_offsets(&_offsets[i], wr);
+
+            _sequence.push_back({ &_border_handler[i], Window::DimZ });
+            _sequence.push_back({ &_gaus5x5[i], Window::DimY });
+            _sequence.push_back({ &_scale_nearest[i], Window::DimY });
         }
 
         _tmp.allocate();
@@ -161,15 +200,11 @@ void NEGaussianPyramidOrb::run()
 {
     ARM_COMPUTE_ERROR_ON_MSG(_pyramid == nullptr, "Unconfigured function");
 
-    /* Get number of pyramid levels */
-    const size_t num_levels = _pyramid->info()->num_levels();
-
     /* The first level of the pyramid has the input image */
     _pyramid->get_pyramid_level(0)->copy_from(*_input);
 
-    for(unsigned int i = 0; i < num_levels - 1; ++i)
-    {
-        _gaus5x5[i].run();
-        _scale_nearest[i].run();
-    }
+    /* Levels depend on their parent, so the chain runs in order; the pre-built sequence
+     * keeps the worker pool resident across all levels instead of paying a pool
+     * round-trip per kernel */
+    NEScheduler::get().schedule_sequence(_sequence);
 }
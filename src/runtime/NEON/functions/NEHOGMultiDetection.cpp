@@ -234,15 +234,17 @@ void NEHOGMultiDetection::run()
     _gradient_kernel.run();
 
     // Run orientation binning kernel
+    // The cell grids can be small, so split the execution window along both dimensions to keep
+    // every core busy even when a single dimension has fewer iterations than there are threads
     for(size_t i = 0; i < _num_orient_bin_kernel; ++i)
     {
-        NEScheduler::get().schedule(_orient_bin_kernel.get() + i, Window::DimY);
+        NEScheduler::get().schedule(_orient_bin_kernel.get() + i, Window::DimY, Window::DimX);
     }
 
     // Run block normalization kernel
     for(size_t i = 0; i < _num_block_norm_kernel; ++i)
     {
-        NEScheduler::get().schedule(_block_norm_kernel.get() + i, Window::DimY);
+        NEScheduler::get().schedule(_block_norm_kernel.get() + i, Window::DimY, Window::DimX);
     }
 
     // Run HOG detector kernel
@@ -31,28 +31,97 @@
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "support/ToolchainSupport.h"
 
+#include <algorithm>
+#include <cstring>
+
 using namespace arm_compute;
 
 NEHistogram::NEHistogram()
-    : _histogram_kernel(), _local_hist(), _window_lut(arm_compute::support::cpp14::make_unique<uint32_t[]>(window_lut_default_size)), _local_hist_size(0)
+    : _histogram_kernel(), _snapshot_kernel(), _window_lut(arm_compute::support::cpp14::make_unique<uint32_t[]>(window_lut_default_size)), _input(nullptr), _output(nullptr), _snapshot(),
+      _stale_dist(nullptr), _incremental(false), _has_snapshot(false)
 {
 }
 
-void NEHistogram::configure(const IImage *input, IDistribution1D *output)
+void NEHistogram::configure(const IImage *input, IDistribution1D *output, bool incremental)
 {
     ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input);
     ARM_COMPUTE_ERROR_ON(nullptr == output);
 
-    // Allocate space for threads local histograms
-    _local_hist_size = output->num_bins() * NEScheduler::get().num_threads();
-    _local_hist      = arm_compute::support::cpp14::make_unique<uint32_t[]>(_local_hist_size);
+    _input       = input;
+    _output      = output;
+    _incremental = incremental;
+
+    // Reserve per-thread scratch for the local histograms: the bins, the
+    // overflow bin for out-of-range pixels and the fold counter of the merge
+    NEScheduler::get().reserve_workspace((output->num_bins() + 2) * sizeof(uint32_t));
 
     // Configure kernel
-    _histogram_kernel.configure(input, output, _local_hist.get(), _window_lut.get());
+    _histogram_kernel.configure(input, output, _window_lut.get());
+
+    if(_incremental)
+    {
+        // Snapshot of the last processed frame and the distribution holding the stale
+        // contribution of a changed region; the kernel windows of both kernels match,
+        // so clipping a region behaves identically on the snapshot and the input
+        _snapshot.allocator()->init(TensorInfo(input->info()->tensor_shape(), Format::U8));
+        _snapshot.allocator()->allocate();
+        _stale_dist = arm_compute::support::cpp14::make_unique<Distribution1D>(output->num_bins(), output->offset(), output->range());
+        _snapshot_kernel.configure(&_snapshot, _stale_dist.get(), _window_lut.get());
+    }
+}
+
+void NEHistogram::update(const Coordinates &anchor, const TensorShape &shape)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_incremental, "NEHistogram was not configured as incremental");
+    ARM_COMPUTE_ERROR_ON_MSG(!_has_snapshot, "update() requires a prior run()");
+
+    // Remove the snapshot's contribution over the changed region
+    _stale_dist->clear();
+    NEScheduler::get().schedule_roi(&_snapshot_kernel, anchor, shape, Window::DimY);
+
+    uint32_t *const       out_bins   = _output->buffer();
+    const uint32_t *const stale_bins = _stale_dist->buffer();
+    for(size_t b = 0; b < _output->num_bins(); ++b)
+    {
+        out_bins[b] -= stale_bins[b];
+    }
+
+    // Accumulate the current pixels of the region; the kernel only ever adds to the output
+    NEScheduler::get().schedule_roi(&_histogram_kernel, anchor, shape, Window::DimY);
+
+    // Refresh the snapshot over the region, clipped to the image
+    const int width   = _input->info()->dimension(0);
+    const int height  = _input->info()->dimension(1);
+    const int start_x = std::min(std::max(anchor[0], 0), width);
+    const int start_y = std::min(std::max(anchor[1], 0), height);
+    const int end_x   = std::min(start_x + static_cast<int>(shape[0]), width);
+    const int end_y   = std::min(start_y + static_cast<int>(shape[1]), height);
+    refresh_snapshot(start_x, end_x, start_y, end_y);
 }
 
 void NEHistogram::run()
 {
     // Calculate histogram of input.
     NEScheduler::get().schedule(&_histogram_kernel, Window::DimY);
+
+    if(_incremental)
+    {
+        refresh_snapshot(0, _input->info()->dimension(0), 0, _input->info()->dimension(1));
+        _has_snapshot = true;
+    }
+}
+
+void NEHistogram::refresh_snapshot(int start_x, int end_x, int start_y, int end_y)
+{
+    if(end_x <= start_x)
+    {
+        return;
+    }
+
+    const size_t row_size = end_x - start_x;
+    for(int y = start_y; y < end_y; ++y)
+    {
+        const Coordinates pos(start_x, y);
+        std::memcpy(_snapshot.ptr_to_element(pos), _input->ptr_to_element(pos), row_size);
+    }
 }
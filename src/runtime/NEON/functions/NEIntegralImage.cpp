@@ -23,18 +23,27 @@
  */
 #include "arm_compute/runtime/NEON/functions/NEIntegralImage.h"
 
-#include "arm_compute/core/NEON/kernels/NEIntegralImageKernel.h"
 #include "arm_compute/core/Types.h"
-#include "support/ToolchainSupport.h"
-
-#include <utility>
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 
 using namespace arm_compute;
 
+NEIntegralImage::NEIntegralImage()
+    : _hor_kernel(), _vert_kernel(), _border_handler()
+{
+}
+
 void NEIntegralImage::configure(const ITensor *input, ITensor *output)
 {
-    auto k = arm_compute::support::cpp14::make_unique<NEIntegralImageKernel>();
-    k->configure(input, output);
-    _kernel = std::move(k);
-    _border_handler.configure(output, _kernel->border_size(), BorderMode::CONSTANT, static_cast<float>(0.f));
+    _hor_kernel.configure(input, output);
+    _vert_kernel.configure(output);
+    _border_handler.configure(output, _hor_kernel.border_size(), BorderMode::CONSTANT, static_cast<float>(0.f));
+}
+
+void NEIntegralImage::run()
+{
+    NEScheduler::get().schedule(&_border_handler, Window::DimZ);
+    NEScheduler::get().schedule(&_hor_kernel, Window::DimY);
+    NEScheduler::get().schedule(&_vert_kernel, Window::DimX);
 }
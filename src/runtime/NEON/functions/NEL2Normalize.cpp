@@ -23,35 +23,26 @@
  */
 #include "arm_compute/runtime/NEON/functions/NEL2Normalize.h"
 
-#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Error.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
 using namespace arm_compute;
 
 NEL2Normalize::NEL2Normalize(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _reduce_func(), _normalize_kernel(), _sumsq()
+    : _normalize_kernel()
 {
+    ARM_COMPUTE_UNUSED(memory_manager);
 }
 
 void NEL2Normalize::configure(ITensor *input, ITensor *output, unsigned int axis, float epsilon)
 {
-    // Manage intermediate buffers
-    _memory_group.manage(&_sumsq);
-
-    // Configure Kernels
-    _reduce_func.configure(input, &_sumsq, axis, ReductionOperation::SUM_SQUARE);
-    _normalize_kernel.configure(input, &_sumsq, output, axis, epsilon);
-
-    // Allocate intermediate tensors
-    _sumsq.allocator()->allocate();
+    // Fused mode: the kernel computes each row's sum of squares in its first traversal and
+    // rescales the row immediately, replacing the former reduction pass plus re-read of the
+    // input with a single scheduling
+    _normalize_kernel.configure(input, nullptr, output, axis, epsilon);
 }
 
 void NEL2Normalize::run()
 {
-    _memory_group.acquire();
-
-    _reduce_func.run();
     NEScheduler::get().schedule(&_normalize_kernel, Window::DimY);
-
-    _memory_group.release();
 }
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NELSTMCell.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include <cstdint>
+#include <cstring>
+
+using namespace arm_compute;
+
+NELSTMCell::NELSTMCell(std::shared_ptr<IMemoryManager> memory_manager)
+    : _memory_group(std::move(memory_manager)), _fc(), _update_kernel(), _packed_weights(), _packed_input(), _gates(), _input(nullptr), _input_weights(nullptr), _recurrent_weights(nullptr),
+      _hidden_state(nullptr), _is_first_run(true)
+{
+}
+
+void NELSTMCell::configure(const ITensor *input, const ITensor *input_weights, const ITensor *recurrent_weights, const ITensor *bias, ITensor *hidden_state, ITensor *cell_state)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, input_weights, recurrent_weights, bias, hidden_state, cell_state);
+    ARM_COMPUTE_ERROR_ON(input->info()->num_dimensions() > 1);
+    ARM_COMPUTE_ERROR_ON(hidden_state->info()->num_dimensions() > 1);
+
+    const size_t input_size  = input->info()->dimension(0);
+    const size_t hidden_size = hidden_state->info()->dimension(0);
+
+    ARM_COMPUTE_ERROR_ON(cell_state->info()->dimension(0) != hidden_size);
+    ARM_COMPUTE_ERROR_ON(bias->info()->dimension(0) != 4 * hidden_size);
+    ARM_COMPUTE_ERROR_ON(input_weights->info()->dimension(0) != input_size || input_weights->info()->dimension(1) != 4 * hidden_size);
+    ARM_COMPUTE_ERROR_ON(recurrent_weights->info()->dimension(0) != hidden_size || recurrent_weights->info()->dimension(1) != 4 * hidden_size);
+
+    const DataType data_type = input->info()->data_type();
+
+    _input             = input;
+    _input_weights     = input_weights;
+    _recurrent_weights = recurrent_weights;
+    _hidden_state      = hidden_state;
+    _is_first_run      = true;
+
+    // The input and recurrent weights are packed side by side so one matrix multiply of
+    // [ x ; h ] produces the pre-activations of all four gates at once
+    _packed_weights.allocator()->init(TensorInfo(TensorShape(input_size + hidden_size, 4 * hidden_size), 1, data_type));
+    _packed_input.allocator()->init(TensorInfo(TensorShape(input_size + hidden_size), 1, data_type));
+    _gates.allocator()->init(TensorInfo(TensorShape(4 * hidden_size), 1, data_type));
+
+    _memory_group.manage(&_packed_input);
+    _memory_group.manage(&_gates);
+
+    _fc.configure(&_packed_input, &_packed_weights, bias, &_gates);
+    _update_kernel.configure(&_gates, cell_state, hidden_state);
+
+    _packed_input.allocator()->allocate();
+    _gates.allocator()->allocate();
+    _packed_weights.allocator()->allocate();
+}
+
+void NELSTMCell::prepare()
+{
+    // Pack the weights (happens only once)
+    if(_is_first_run)
+    {
+        _is_first_run = false;
+
+        const size_t input_size        = _input_weights->info()->dimension(0);
+        const size_t hidden_size       = _recurrent_weights->info()->dimension(0);
+        const size_t in_stride         = _input_weights->info()->strides_in_bytes()[1];
+        const size_t recurrent_stride  = _recurrent_weights->info()->strides_in_bytes()[1];
+        const size_t packed_stride     = _packed_weights.info()->strides_in_bytes()[1];
+        const uint8_t *input_base      = _input_weights->buffer() + _input_weights->info()->offset_first_element_in_bytes();
+        const uint8_t *recurrent_base  = _recurrent_weights->buffer() + _recurrent_weights->info()->offset_first_element_in_bytes();
+        uint8_t       *packed_base     = _packed_weights.buffer() + _packed_weights.info()->offset_first_element_in_bytes();
+
+        for(size_t row = 0; row < 4 * hidden_size; ++row)
+        {
+            uint8_t *packed_row = packed_base + row * packed_stride;
+            std::memcpy(packed_row, input_base + row * in_stride, input_size * sizeof(float));
+            std::memcpy(packed_row + input_size * sizeof(float), recurrent_base + row * recurrent_stride, hidden_size * sizeof(float));
+        }
+    }
+}
+
+void NELSTMCell::run()
+{
+    prepare();
+
+    _memory_group.acquire();
+
+    // Pack [ x ; h ] into the combined input vector
+    const size_t input_size  = _input->info()->dimension(0);
+    const size_t hidden_size = _hidden_state->info()->dimension(0);
+    uint8_t     *packed_ptr  = _packed_input.buffer() + _packed_input.info()->offset_first_element_in_bytes();
+
+    std::memcpy(packed_ptr, _input->buffer() + _input->info()->offset_first_element_in_bytes(), input_size * sizeof(float));
+    std::memcpy(packed_ptr + input_size * sizeof(float), _hidden_state->buffer() + _hidden_state->info()->offset_first_element_in_bytes(), hidden_size * sizeof(float));
+
+    // Compute the pre-activations of all four gates with one matrix multiply
+    _fc.run();
+
+    // Apply the gate activations and update both states in a single pass
+    NEScheduler::get().schedule(&_update_kernel, Window::DimX);
+
+    _memory_group.release();
+}
@@ -28,14 +28,16 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <tuple>
 
 using namespace arm_compute;
 
 NELocallyConnectedLayer::NELocallyConnectedLayer(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _input_im2col_kernel(), _weights_reshape_kernel(), _mm_kernel(), _output_col2im_kernel(), _input_im2col_reshaped(), _weights_reshaped(), _gemm_output(),
-      _is_first_run(false)
+    : _memory_group(std::move(memory_manager)), _input_im2col_kernel(), _weights_reshape_kernel(), _mm_kernel(), _output_col2im_kernel(), _input_im2col_reshaped(), _weights_reshaped(),
+      _weights_packed(), _gemm_output(), _is_first_run(false)
 {
 }
 
@@ -87,6 +89,12 @@ void NELocallyConnectedLayer::configure(const ITensor *input, const ITensor *wei
 
     _weights_reshaped.allocator()->init(TensorInfo(shape_wr, 1, weights->info()->data_type()));
 
+    // The reshaped weights are repacked once into contiguous panels of four interleaved columns per
+    // output position, so the matrix multiply streams each panel of four outputs without strided row loads
+    const TensorShape shape_wp(mat_weights_rows * 4, static_cast<size_t>(std::ceil(mat_weights_cols / 4.f)), mat_weights_num);
+
+    _weights_packed.allocator()->init(TensorInfo(shape_wp, 1, weights->info()->data_type()));
+
     // Create tensor to store im2col reshaped inputs
     const size_t mat_input_cols = mat_weights_rows;
     const size_t mat_input_rows = conv_w * conv_h;
@@ -110,23 +118,65 @@ void NELocallyConnectedLayer::configure(const ITensor *input, const ITensor *wei
     // Configure kernels
     _input_im2col_kernel.configure(input, &_input_im2col_reshaped, Size2D(kernel_width, kernel_height), conv_info, _has_bias);
     _weights_reshape_kernel.configure(weights, biases, &_weights_reshaped);
-    _mm_kernel.configure(&_input_im2col_reshaped, &_weights_reshaped, &_gemm_output);
+    _mm_kernel.configure(&_input_im2col_reshaped, &_weights_packed, &_gemm_output, true);
     _output_col2im_kernel.configure(&_gemm_output, output, std::make_pair(conv_w, conv_h));
 
     // Allocate intermediate tensors
     _weights_reshaped.allocator()->allocate();
+    _weights_packed.allocator()->allocate();
     _input_im2col_reshaped.allocator()->allocate();
     _gemm_output.allocator()->allocate();
 }
 
-void NELocallyConnectedLayer::run()
+void NELocallyConnectedLayer::prepare()
 {
     // Run weights reshaping (Runs once for every configure)
     if(_is_first_run)
     {
         _is_first_run = false;
         NEScheduler::get().schedule(&_weights_reshape_kernel, 3);
+
+        // Pack the reshaped weights into contiguous panels of four interleaved columns per output position
+        const size_t   num_cols     = _weights_reshaped.info()->dimension(0);
+        const size_t   num_rows     = _weights_reshaped.info()->dimension(1);
+        const size_t   num_pos      = _weights_reshaped.info()->dimension(2);
+        const size_t   num_panels   = _weights_packed.info()->dimension(1);
+        const size_t   src_stride_y = _weights_reshaped.info()->strides_in_bytes()[1];
+        const size_t   src_stride_z = _weights_reshaped.info()->strides_in_bytes()[2];
+        const size_t   dst_stride_y = _weights_packed.info()->strides_in_bytes()[1];
+        const size_t   dst_stride_z = _weights_packed.info()->strides_in_bytes()[2];
+        const uint8_t *src_base     = _weights_reshaped.buffer() + _weights_reshaped.info()->offset_first_element_in_bytes();
+        uint8_t       *dst_base     = _weights_packed.buffer() + _weights_packed.info()->offset_first_element_in_bytes();
+
+        for(size_t pos = 0; pos < num_pos; ++pos)
+        {
+            for(size_t panel = 0; panel < num_panels; ++panel)
+            {
+                const size_t col0       = panel * 4;
+                const size_t valid_cols = std::min(num_cols - col0, static_cast<size_t>(4));
+                auto         dst        = reinterpret_cast<float *>(dst_base + panel * dst_stride_y + pos * dst_stride_z);
+
+                for(size_t row = 0; row < num_rows; ++row, dst += 4)
+                {
+                    const auto src = reinterpret_cast<const float *>(src_base + col0 * sizeof(float) + row * src_stride_y + pos * src_stride_z);
+
+                    for(size_t col = 0; col < valid_cols; ++col)
+                    {
+                        dst[col] = src[col];
+                    }
+                    for(size_t col = valid_cols; col < 4; ++col)
+                    {
+                        dst[col] = 0.f;
+                    }
+                }
+            }
+        }
     }
+}
+
+void NELocallyConnectedLayer::run()
+{
+    prepare();
 
     _memory_group.acquire();
 
@@ -23,26 +23,74 @@
  */
 #include "arm_compute/runtime/NEON/functions/NEMeanStdDev.h"
 
+#include "arm_compute/core/Error.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
+#include <cmath>
+
 using namespace arm_compute;
 
 NEMeanStdDev::NEMeanStdDev()
-    : _mean_stddev_kernel(), _fill_border_kernel(), _global_sum(0), _global_sum_squared(0)
+    : _mean_stddev_kernel(), _fill_border_kernel(), _global_sum(0), _global_sum_squared(0), _mean(nullptr), _stddev(nullptr), _alpha(1.f), _frame_mean(0.f), _frame_stddev(0.f), _ew_mean(0.f),
+      _ew_var(0.f), _has_history(false)
 {
 }
 
-void NEMeanStdDev::configure(IImage *input, float *mean, float *stddev)
+void NEMeanStdDev::configure(IImage *input, float *mean, float *stddev, float alpha)
 {
-    _mean_stddev_kernel.configure(input, mean, &_global_sum, stddev, &_global_sum_squared);
+    ARM_COMPUTE_ERROR_ON(alpha <= 0.f || alpha > 1.f);
+
+    _mean   = mean;
+    _stddev = stddev;
+    _alpha  = alpha;
+
+    if(_alpha < 1.f)
+    {
+        // Let the kernel reduce into the per-frame statistics; run() blends them into the
+        // exponentially-weighted history before writing the user outputs
+        _mean_stddev_kernel.configure(input, &_frame_mean, &_global_sum, (stddev != nullptr) ? &_frame_stddev : nullptr, &_global_sum_squared);
+    }
+    else
+    {
+        _mean_stddev_kernel.configure(input, mean, &_global_sum, stddev, &_global_sum_squared);
+    }
     _fill_border_kernel.configure(input, _mean_stddev_kernel.border_size(), BorderMode::CONSTANT, PixelValue(static_cast<uint8_t>(0)));
 }
 
+void NEMeanStdDev::reset_history()
+{
+    _has_history = false;
+}
+
 void NEMeanStdDev::run()
 {
     _global_sum         = 0;
     _global_sum_squared = 0;
 
     NEScheduler::get().schedule(&_fill_border_kernel, Window::DimZ);
-    NEScheduler::get().schedule(&_mean_stddev_kernel, Window::DimY);
+    // Split over both dimensions so short-and-wide frames still occupy the whole pool
+    NEScheduler::get().schedule(&_mean_stddev_kernel, Window::DimY, Window::DimX);
+
+    if(_alpha < 1.f)
+    {
+        // Blend mean and variance: variances mix linearly, standard deviations do not
+        const float frame_var = _frame_stddev * _frame_stddev;
+        if(_has_history)
+        {
+            _ew_mean += _alpha * (_frame_mean - _ew_mean);
+            _ew_var += _alpha * (frame_var - _ew_var);
+        }
+        else
+        {
+            _ew_mean     = _frame_mean;
+            _ew_var      = frame_var;
+            _has_history = true;
+        }
+
+        *_mean = _ew_mean;
+        if(_stddev != nullptr)
+        {
+            *_stddev = std::sqrt(_ew_var);
+        }
+    }
 }
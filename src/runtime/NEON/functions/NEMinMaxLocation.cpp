@@ -28,23 +28,20 @@
 using namespace arm_compute;
 
 NEMinMaxLocation::NEMinMaxLocation()
-    : _min_max(), _min_max_loc()
+    : _min_max_loc()
 {
 }
 
 void NEMinMaxLocation::configure(const IImage *input, void *min, void *max, ICoordinates2DArray *min_loc, ICoordinates2DArray *max_loc, uint32_t *min_count, uint32_t *max_count)
 {
-    _min_max.configure(input, min, max);
     _min_max_loc.configure(input, min, max, min_loc, max_loc, min_count, max_count);
+
+    // Reserve per-thread scratch for the partial results of the single-pass search
+    NEScheduler::get().reserve_workspace(_min_max_loc.workspace_size());
 }
 
 void NEMinMaxLocation::run()
 {
-    _min_max.reset();
-
-    /* Run min max kernel */
-    NEScheduler::get().schedule(&_min_max, Window::DimY);
-
-    /* Run min max location */
+    /* Run the single-pass min max location kernel */
     NEScheduler::get().schedule(&_min_max_loc, Window::DimY);
 }
@@ -28,6 +28,7 @@
 #include "arm_compute/core/NEON/kernels/NELKTrackerKernel.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NEScharr3x3.h"
 #include "arm_compute/runtime/Pyramid.h"
@@ -48,13 +49,17 @@ NEOpticalFlow::NEOpticalFlow(std::shared_ptr<IMemoryManager> memory_manager) //
       _old_points(nullptr),
       _new_points_internal(),
       _old_points_internal(),
-      _num_levels(0)
+      _num_levels(0),
+      _old_pyramid(nullptr),
+      _new_pyramid(nullptr),
+      _pyramid_handoff(false),
+      _frame_parity(0)
 {
 }
 
 void NEOpticalFlow::configure(const Pyramid *old_pyramid, const Pyramid *new_pyramid, const IKeyPointArray *old_points, const IKeyPointArray *new_points_estimates,
                               IKeyPointArray *new_points, Termination termination, float epsilon, unsigned int num_iterations, size_t window_dimension,
-                              bool use_initial_estimate, BorderMode border_mode, uint8_t constant_border_value)
+                              bool use_initial_estimate, BorderMode border_mode, uint8_t constant_border_value, bool pyramid_handoff)
 {
     ARM_COMPUTE_ERROR_ON(nullptr == old_pyramid);
     ARM_COMPUTE_ERROR_ON(nullptr == new_pyramid);
@@ -71,11 +76,20 @@ void NEOpticalFlow::configure(const Pyramid *old_pyramid, const Pyramid *new_pyr
     _old_points           = old_points;
     _new_points           = new_points;
     _new_points_estimates = new_points_estimates;
+    _old_pyramid          = old_pyramid;
+    _new_pyramid          = new_pyramid;
+    _pyramid_handoff      = pyramid_handoff;
+    _frame_parity         = 0;
 
     const float pyr_scale = old_pyramid->info()->scale();
 
-    _func_scharr    = arm_compute::support::cpp14::make_unique<NEScharr3x3[]>(_num_levels);
-    _kernel_tracker = arm_compute::support::cpp14::make_unique<NELKTrackerKernel[]>(_num_levels);
+    // In handoff mode the two pyramids alternate roles every frame, so a second set of kernels
+    // is configured with the roles reversed and run() picks the set matching the frame parity.
+    // The Scharr gradients are intermediates of a single frame and are shared between the sets
+    const unsigned int num_kernel_sets = pyramid_handoff ? 2 : 1;
+
+    _func_scharr    = arm_compute::support::cpp14::make_unique<NEScharr3x3[]>(num_kernel_sets * _num_levels);
+    _kernel_tracker = arm_compute::support::cpp14::make_unique<NELKTrackerKernel[]>(num_kernel_sets * _num_levels);
     _scharr_gx      = arm_compute::support::cpp14::make_unique<Tensor[]>(_num_levels);
     _scharr_gy      = arm_compute::support::cpp14::make_unique<Tensor[]>(_num_levels);
 
@@ -102,34 +116,78 @@ void NEOpticalFlow::configure(const Pyramid *old_pyramid, const Pyramid *new_pyr
         _memory_group.manage(_scharr_gx.get() + i);
         _memory_group.manage(_scharr_gy.get() + i);
 
-        // Init Scharr kernel
-        _func_scharr[i].configure(old_ith_input, _scharr_gx.get() + i, _scharr_gy.get() + i, border_mode, constant_border_value);
+        for(unsigned int set = 0; set < num_kernel_sets; ++set)
+        {
+            // The second kernel set tracks from the "new" pyramid towards the "old" one
+            IImage *set_old_input = (set == 0) ? old_ith_input : new_ith_input;
+            IImage *set_new_input = (set == 0) ? new_ith_input : old_ith_input;
+
+            // Init Scharr kernel
+            _func_scharr[set * _num_levels + i].configure(set_old_input, _scharr_gx.get() + i, _scharr_gy.get() + i, border_mode, constant_border_value);
 
-        // Init Lucas-Kanade kernel
-        _kernel_tracker[i].configure(old_ith_input, new_ith_input, _scharr_gx.get() + i, _scharr_gy.get() + i,
-                                     old_points, new_points_estimates, new_points,
-                                     &_old_points_internal, &_new_points_internal,
-                                     termination, use_initial_estimate, epsilon, num_iterations, window_dimension,
-                                     i, _num_levels, pyr_scale);
+            // Init Lucas-Kanade kernel
+            _kernel_tracker[set * _num_levels + i].configure(set_old_input, set_new_input, _scharr_gx.get() + i, _scharr_gy.get() + i,
+                                                             old_points, new_points_estimates, new_points,
+                                                             &_old_points_internal, &_new_points_internal,
+                                                             termination, use_initial_estimate, epsilon, num_iterations, window_dimension,
+                                                             i, _num_levels, pyr_scale);
+        }
 
         _scharr_gx[i].allocator()->allocate();
         _scharr_gy[i].allocator()->allocate();
     }
 }
 
+const Pyramid *NEOpticalFlow::input_pyramid() const
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_num_levels == 0, "Unconfigured function");
+
+    return (_frame_parity == 0) ? _new_pyramid : _old_pyramid;
+}
+
 void NEOpticalFlow::run()
 {
     ARM_COMPUTE_ERROR_ON_MSG(_num_levels == 0, "Unconfigured function");
 
     _memory_group.acquire();
 
+    // Pick the kernel set matching the current roles of the two pyramids
+    const unsigned int base = _frame_parity * _num_levels;
+
+    // Compute the image gradients of every level up front: the Scharr kernels parallelize over
+    // image rows and keep the whole pool busy, unlike the keypoint-bound tracker below
     for(unsigned int level = _num_levels; level > 0; --level)
     {
-        // Run Scharr kernel
-        _func_scharr[level - 1].run();
+        _func_scharr[base + level - 1].run();
+    }
 
-        // Run Lucas-Kanade kernel
-        NEScheduler::get().schedule(_kernel_tracker.get() + level - 1, Window::DimX);
+    // With a sparse keypoint set the static per-thread batches are small and the number of
+    // refinement iterations varies per keypoint, so over-decompose the batches and let the
+    // threads which run out of keypoints steal from the slower ones
+    const bool use_work_stealing = (Scheduler::get_type() == Scheduler::Type::CPP);
+    CPPScheduler::Mode prev_mode{};
+
+    if(use_work_stealing)
+    {
+        prev_mode = CPPScheduler::get().mode();
+        CPPScheduler::get().set_mode(CPPScheduler::Mode::WorkStealing);
+    }
+
+    // Run Lucas-Kanade kernel from the coarsest to the finest level
+    for(unsigned int level = _num_levels; level > 0; --level)
+    {
+        NEScheduler::get().schedule(_kernel_tracker.get() + base + level - 1, Window::DimX);
+    }
+
+    if(use_work_stealing)
+    {
+        CPPScheduler::get().set_mode(prev_mode);
+    }
+
+    // The frame just consumed as "new" becomes the next frame's "old" pyramid
+    if(_pyramid_handoff)
+    {
+        _frame_parity ^= 1;
     }
 
     _memory_group.release();
@@ -23,7 +23,9 @@
  */
 #include "arm_compute/runtime/NEON/functions/NEPoolingLayer.h"
 
+#include "arm_compute/core/Error.h"
 #include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Utils.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "support/ToolchainSupport.h"
@@ -35,23 +37,34 @@ NEPoolingLayer::NEPoolingLayer()
 {
 }
 
-void NEPoolingLayer::configure(ITensor *input, ITensor *output, const PoolingLayerInfo &pool_info)
+void NEPoolingLayer::configure(ITensor *input, ITensor *output, const PoolingLayerInfo &pool_info, const ITensor *zero_mask)
 {
+    ARM_COMPUTE_ERROR_ON_MSG(input->info()->data_type() == DataType::F16 && !cpu_has_fp16(NEScheduler::get().cpu_info()),
+                             "Half-precision arithmetic requires an ARMv8.2-A CPU");
     // Check if we have Global Pooling Layer
     _is_global_pooling_layer = (input->info()->dimension(0) == pool_info.pool_size()) && (input->info()->dimension(1) == pool_info.pool_size());
 
     // Configure pooling kernel
-    _pooling_layer_kernel.configure(input, output, pool_info);
+    _pooling_layer_kernel.configure(input, output, pool_info, zero_mask);
 
     // Configure border depending on operation required
     BorderMode border_mode = (pool_info.pool_type() == PoolingType::MAX) ? BorderMode::REPLICATE : BorderMode::CONSTANT;
-    _border_handler.configure(input, _pooling_layer_kernel.border_size(), border_mode, PixelValue(static_cast<float>(0.f)));
+    PixelValue zero_value(static_cast<float>(0.f));
+    if(is_data_type_quantized_asymmetric(input->info()->data_type()))
+    {
+        // For asymmetric quantized inputs the padding value is the quantized zero-point
+        zero_value = PixelValue(static_cast<uint8_t>(input->info()->quantization_info().offset));
+    }
+    _border_handler.configure(input, _pooling_layer_kernel.border_size(), border_mode, zero_value);
 }
 
 void NEPoolingLayer::run()
 {
-    // Fill border
-    NEScheduler::get().schedule(&_border_handler, Window::DimY);
+    // Fill border, unless the kernel handles its edge windows itself and needs none
+    if(!_pooling_layer_kernel.border_size().empty())
+    {
+        NEScheduler::get().schedule(&_border_handler, Window::DimY);
+    }
 
     // Run pooling layer
     NEScheduler::get().schedule(&_pooling_layer_kernel, _is_global_pooling_layer ? Window::DimZ : Window::DimY);
@@ -26,34 +26,49 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
+#include <limits>
+
 using namespace arm_compute;
 
 namespace
 {
 /** Define dimension to split the window
  *
- * @param[in] axis Reduction axis
+ * The first dimension that survives the reduction is chosen so that each thread owns a
+ * disjoint set of output elements and no cross-thread combination is needed. When every
+ * dimension is reduced all window extents are 1 and the reduction runs on a single thread.
+ *
+ * @param[in] axes Reduction axes
  *
  * @return The dimension to split the window
  */
-size_t reduction_window_split_dimension(unsigned int axis)
+size_t reduction_window_split_dimension(const Coordinates &axes)
 {
-    switch(axis)
+    for(size_t d = 0; d < Coordinates::num_max_dimensions; ++d)
     {
-        case 0:
-            return Window::DimY;
-        default:
-            ARM_COMPUTE_ERROR("Unsupported reduction axis");
+        bool reduced = false;
+        for(size_t i = 0; i < axes.num_dimensions(); ++i)
+        {
+            reduced = reduced || (static_cast<size_t>(axes[i]) == d);
+        }
+        if(!reduced)
+        {
+            return d;
+        }
     }
+    return Window::DimY;
 }
-BorderMode reduction_operation_border_mode(ReductionOperation op)
+/** Neutral element to fill the border with, so the padded tail of each row can be accumulated whole */
+PixelValue reduction_operation_border_value(ReductionOperation op)
 {
     switch(op)
     {
-        case ReductionOperation::SUM_SQUARE:
-            return BorderMode::CONSTANT;
+        case ReductionOperation::MAX:
+            return PixelValue(-std::numeric_limits<float>::max());
+        case ReductionOperation::MIN:
+            return PixelValue(std::numeric_limits<float>::max());
         default:
-            return BorderMode::CONSTANT;
+            return PixelValue(0.f);
     }
 }
 } // namespace
@@ -64,17 +79,20 @@ NEReductionOperation::NEReductionOperation()
 }
 
 void NEReductionOperation::configure(ITensor *input, ITensor *output, unsigned int axis, ReductionOperation op)
+{
+    configure(input, output, Coordinates(static_cast<int>(axis)), op);
+}
+
+void NEReductionOperation::configure(ITensor *input, ITensor *output, const Coordinates &axes, ReductionOperation op)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
 
     // Configure reduction kernel
-    _reduction_kernel.configure(input, output, axis, op);
-    _window_split = reduction_window_split_dimension(axis);
+    _reduction_kernel.configure(input, output, axes, op);
+    _window_split = reduction_window_split_dimension(axes);
 
     // Configure fill border kernel
-    BorderSize fill_border_size = (axis == 0) ? _reduction_kernel.border_size() : BorderSize();
-    BorderMode fill_border_mode = reduction_operation_border_mode(op);
-    _fill_border_kernel.configure(input, fill_border_size, fill_border_mode, PixelValue(static_cast<float>(0.f)));
+    _fill_border_kernel.configure(input, _reduction_kernel.border_size(), BorderMode::CONSTANT, reduction_operation_border_value(op));
 }
 
 void NEReductionOperation::run()
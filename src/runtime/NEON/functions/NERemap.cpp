@@ -25,18 +25,21 @@
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/ITensor.h"
-#include "arm_compute/core/NEON/kernels/NERemapKernel.h"
 #include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/TensorAllocator.h"
-#include "support/ToolchainSupport.h"
-
-#include <utility>
 
 using namespace arm_compute;
 
-void NERemap::configure(ITensor *input, const ITensor *map_x, const ITensor *map_y, ITensor *output, InterpolationPolicy policy, BorderMode border_mode, uint8_t constant_border_value)
+NERemap::NERemap()
+    : _remap_kernel(), _border_handler(), _compiled_maps(false), _maps_compiled(false)
+{
+}
+
+void NERemap::configure(ITensor *input, const ITensor *map_x, const ITensor *map_y, ITensor *output, InterpolationPolicy policy, BorderMode border_mode, uint8_t constant_border_value,
+                        bool compiled_maps)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
@@ -44,10 +47,29 @@ void NERemap::configure(ITensor *input, const ITensor *map_x, const ITensor *map
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(map_y, 1, DataType::F32);
     ARM_COMPUTE_ERROR_ON_MSG(policy == InterpolationPolicy::AREA, "Area interpolation is not supported");
 
-    auto k = arm_compute::support::cpp14::make_unique<NERemapKernel>();
+    _compiled_maps = compiled_maps;
+    _maps_compiled = false;
+
+    _remap_kernel.configure(input, map_x, map_y, output, policy, compiled_maps);
+    _border_handler.configure(input, _remap_kernel.border_size(), border_mode, PixelValue(constant_border_value));
+}
 
-    k->configure(input, map_x, map_y, output, policy);
+void NERemap::set_actual_shape(const TensorShape &shape)
+{
+    _remap_kernel.trim_window(shape);
+    _border_handler.trim_window(shape);
+}
+
+void NERemap::run()
+{
+    // One-shot: the maps are immutable in compiled mode, so the first run pays for the
+    // coordinate evaluation once and every later frame is a pure gather loop
+    if(_compiled_maps && !_maps_compiled)
+    {
+        _remap_kernel.compile_maps();
+        _maps_compiled = true;
+    }
 
-    _kernel = std::move(k);
-    _border_handler.configure(input, _kernel->border_size(), border_mode, PixelValue(constant_border_value));
+    NEScheduler::get().schedule(&_border_handler, Window::DimZ);
+    NEScheduler::get().schedule(&_remap_kernel, Window::DimY);
 }
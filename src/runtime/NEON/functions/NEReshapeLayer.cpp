@@ -23,16 +23,52 @@
  */
 #include "arm_compute/runtime/NEON/functions/NEReshapeLayer.h"
 
-#include "arm_compute/core/NEON/kernels/NEReshapeLayerKernel.h"
-#include "support/ToolchainSupport.h"
-
-#include <utility>
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
 
 using namespace arm_compute;
 
+NEReshapeLayer::NEReshapeLayer()
+    : _kernel(), _input(nullptr), _output(nullptr), _is_aliased(false), _is_prepared(false)
+{
+}
+
 void NEReshapeLayer::configure(const ITensor *input, ITensor *output)
 {
-    auto k = arm_compute::support::cpp14::make_unique<NEReshapeLayerKernel>();
-    k->configure(input, output);
-    _kernel = std::move(k);
+    _input  = input;
+    _output = output;
+
+    _kernel.configure(input, output);
+}
+
+void NEReshapeLayer::prepare()
+{
+    if(_is_prepared)
+    {
+        return;
+    }
+    _is_prepared = true;
+
+    // The copy can be elided when both tensors are dense and the output has no buffer of its own
+    // yet: the reshape is then a pure metadata change and the output can borrow the input's memory.
+    // The decision is taken here rather than at configure time, as neighbouring kernels may still
+    // extend the tensors' padding between configure() and the first run.
+    auto *output_tensor = dynamic_cast<Tensor *>(_output);
+    if(output_tensor != nullptr && output_tensor->buffer() == nullptr && _input->buffer() != nullptr
+       && !_input->info()->has_padding() && !_output->info()->has_padding())
+    {
+        output_tensor->allocator()->import_memory(_input->buffer(), _input->info()->total_size());
+        _is_aliased = true;
+    }
+}
+
+void NEReshapeLayer::run()
+{
+    prepare();
+
+    if(!_is_aliased)
+    {
+        NEScheduler::get().schedule(&_kernel, Window::DimY);
+    }
 }
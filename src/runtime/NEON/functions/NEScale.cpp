@@ -175,5 +175,10 @@ void NEScale::configure(ITensor *input, ITensor *output, InterpolationPolicy pol
 void NEScale::run()
 {
     NEScheduler::get().schedule(&_border_handler, Window::DimZ);
-    NEScheduler::get().schedule(&_scale_kernel, Window::DimY);
+
+    // Split along the batch dimension when it offers more parallelism than Y: each
+    // thread then processes whole images of a batch instead of slivers of every image
+    const Window      &win       = _scale_kernel.window();
+    const unsigned int split_dim = (win.num_iterations(Window::DimZ) > win.num_iterations(Window::DimY)) ? Window::DimZ : Window::DimY;
+    NEScheduler::get().schedule(&_scale_kernel, split_dim);
 }
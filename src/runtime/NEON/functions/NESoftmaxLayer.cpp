@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/NEON/kernels/NESoftmaxLayerKernel.h"
+#include "arm_compute/core/Utils.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include <cfloat>
@@ -32,13 +33,23 @@
 using namespace arm_compute;
 
 NESoftmaxLayer::NESoftmaxLayer(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _max_kernel(), _shift_exp_sum_kernel(), _norm_kernel(), _fill_border_kernel(), _max(), _sum(), _tmp()
+    : _memory_group(std::move(memory_manager)), _max_kernel(), _shift_exp_sum_kernel(), _norm_kernel(), _softmax_kernel(), _fill_border_kernel(), _max(), _sum(), _tmp(), _run_fused(false)
 {
 }
 
 void NESoftmaxLayer::configure(ITensor *input, ITensor *output)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QS8, DataType::QS16, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QS8, DataType::QASYMM8, DataType::QS16, DataType::F16, DataType::F32);
+
+    // Use the fused kernel for floating point and asymmetric quantized types: it computes the
+    // whole softmax per row in a single pass over memory and needs no intermediate tensors or
+    // border handling
+    _run_fused = is_data_type_float(input->info()->data_type()) || input->info()->data_type() == DataType::QASYMM8;
+    if(_run_fused)
+    {
+        _softmax_kernel.configure(input, output);
+        return;
+    }
 
     // Create intermediate tensors shapes
     TensorInfo tensor_info_tmp(input->info()->tensor_shape(), input->info()->num_channels(), input->info()->data_type(), input->info()->fixed_point_position());
@@ -69,6 +80,12 @@ void NESoftmaxLayer::configure(ITensor *input, ITensor *output)
 
 void NESoftmaxLayer::run()
 {
+    if(_run_fused)
+    {
+        NEScheduler::get().schedule(&_softmax_kernel, Window::DimY);
+        return;
+    }
+
     _memory_group.acquire();
 
     NEScheduler::get().schedule(&_fill_border_kernel, Window::DimY);
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NETileCache.h"
+
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace arm_compute;
+
+NETileCache::NETileCache()
+    : _checksum_kernel(), _kernel(nullptr), _input(nullptr), _output(nullptr), _checksums(), _prev_checksums(), _cached_output(), _tile_rows(0), _halo_rows(0), _num_tiles(0), _first_run(true)
+{
+}
+
+void NETileCache::configure(INEKernel *kernel, const ITensor *input, ITensor *output, unsigned int tile_rows, unsigned int halo_rows)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(kernel, input, output);
+    ARM_COMPUTE_ERROR_ON(tile_rows == 0);
+    ARM_COMPUTE_ERROR_ON(input->info()->num_dimensions() > 2);
+    ARM_COMPUTE_ERROR_ON(output->info()->num_dimensions() > 2);
+
+    _kernel    = kernel;
+    _input     = input;
+    _output    = output;
+    _tile_rows = tile_rows;
+    _halo_rows = halo_rows;
+    _num_tiles = DIV_CEIL(std::max<size_t>(input->info()->dimension(1), 1), tile_rows);
+    _first_run = true;
+
+    _checksums.allocator()->init(TensorInfo(TensorShape(_num_tiles), 1, DataType::U32));
+    _checksum_kernel.configure(input, &_checksums, tile_rows);
+    _checksums.allocator()->allocate();
+
+    _prev_checksums.resize(_num_tiles);
+    _cached_output.resize(std::max<size_t>(output->info()->dimension(1), 1) * output->info()->dimension(0) * output->info()->element_size());
+}
+
+void NETileCache::copy_output_rows(unsigned int row_start, unsigned int row_end, bool to_cache)
+{
+    const size_t row_size = _output->info()->dimension(0) * _output->info()->element_size();
+
+    for(unsigned int y = row_start; y < row_end; ++y)
+    {
+        uint8_t *tensor_row = _output->ptr_to_element(Coordinates(0, static_cast<int>(y)));
+        uint8_t *cache_row  = _cached_output.data() + y * row_size;
+
+        if(to_cache)
+        {
+            std::memcpy(cache_row, tensor_row, row_size);
+        }
+        else
+        {
+            std::memcpy(tensor_row, cache_row, row_size);
+        }
+    }
+}
+
+void NETileCache::run()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_kernel == nullptr, "NETileCache has not been configured");
+
+    NEScheduler::get().schedule(&_checksum_kernel, Window::DimX);
+
+    const auto         sums  = reinterpret_cast<const uint32_t *>(_checksums.buffer());
+    const unsigned int in_h  = std::max<size_t>(_input->info()->dimension(1), 1);
+    const unsigned int out_h = std::max<size_t>(_output->info()->dimension(1), 1);
+
+    if(_first_run)
+    {
+        NEScheduler::get().schedule(_kernel, Window::DimY);
+        copy_output_rows(0, out_h, true /* to_cache */);
+        _first_run = false;
+    }
+    else
+    {
+        // A changed tile also invalidates the neighbours reading into it through the halo
+        const unsigned int halo_tiles = DIV_CEIL(_halo_rows, _tile_rows);
+
+        std::vector<bool> dirty(_num_tiles, false);
+
+        for(unsigned int t = 0; t < _num_tiles; ++t)
+        {
+            if(sums[t] != _prev_checksums[t])
+            {
+                const unsigned int first = (t > halo_tiles) ? t - halo_tiles : 0;
+                const unsigned int last  = std::min(t + halo_tiles, _num_tiles - 1);
+
+                for(unsigned int d = first; d <= last; ++d)
+                {
+                    dirty[d] = true;
+                }
+            }
+        }
+
+        const Window &full   = _kernel->window();
+        const int     y_step = full.y().step();
+
+        ThreadInfo info;
+        info.cpu_info = NEScheduler::get().cpu_info();
+
+        for(unsigned int t = 0; t < _num_tiles; ++t)
+        {
+            // Input tiles map onto output row bands by the height ratio; consecutive tiles
+            // partition the output rows as both bounds use the same rounding
+            const unsigned int out_start = (t * _tile_rows) * out_h / in_h;
+            const unsigned int out_end   = std::min<unsigned int>(out_h, ((t + 1) * _tile_rows) * out_h / in_h);
+
+            if(out_start >= out_end)
+            {
+                continue;
+            }
+
+            if(dirty[t])
+            {
+                // Clamp the band into the kernel's window, respecting its row step
+                const int win_start = full.y().start() + ((static_cast<int>(out_start) - full.y().start()) / y_step) * y_step;
+                const int win_end   = std::min(full.y().start() + DIV_CEIL(static_cast<int>(out_end) - full.y().start(), y_step) * y_step, full.y().end());
+
+                Window win(full);
+                win.set(Window::DimY, Window::Dimension(win_start, win_end, y_step));
+
+                _kernel->run(win, info);
+
+                copy_output_rows(out_start, out_end, true /* to_cache */);
+            }
+            else
+            {
+                copy_output_rows(out_start, out_end, false /* to_cache */);
+            }
+        }
+    }
+
+    std::copy(sums, sums + _num_tiles, _prev_checksums.begin());
+}
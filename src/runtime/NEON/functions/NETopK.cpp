@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NETopK.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Merge the per-thread candidate slots into the final top-k, ties broken towards the lowest index */
+template <typename T>
+void merge_candidates(const Tensor &candidate_values, const Tensor &candidate_indices, const Tensor &candidate_counts, ITensor *values, ITensor *indices, unsigned int k)
+{
+    const int num_slots = candidate_counts.info()->dimension(0);
+
+    std::vector<std::pair<T, uint32_t>> candidates;
+    candidates.reserve(num_slots * k);
+
+    for(int slot = 0; slot < num_slots; ++slot)
+    {
+        const auto slot_values  = reinterpret_cast<const T *>(candidate_values.ptr_to_element(Coordinates(0, slot)));
+        const auto slot_indices = reinterpret_cast<const uint32_t *>(candidate_indices.ptr_to_element(Coordinates(0, slot)));
+        const auto slot_count   = *reinterpret_cast<const uint32_t *>(candidate_counts.ptr_to_element(Coordinates(slot)));
+
+        for(uint32_t i = 0; i < slot_count; ++i)
+        {
+            candidates.emplace_back(slot_values[i], slot_indices[i]);
+        }
+    }
+
+    const size_t num_selected = std::min<size_t>(k, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + num_selected, candidates.end(), [](const std::pair<T, uint32_t> &a, const std::pair<T, uint32_t> &b)
+    {
+        return (a.first != b.first) ? (a.first > b.first) : (a.second < b.second);
+    });
+
+    const auto out_values  = reinterpret_cast<T *>(values->buffer() + values->info()->offset_first_element_in_bytes());
+    const auto out_indices = reinterpret_cast<uint32_t *>(indices->buffer() + indices->info()->offset_first_element_in_bytes());
+
+    for(size_t i = 0; i < num_selected; ++i)
+    {
+        out_values[i]  = candidates[i].first;
+        out_indices[i] = candidates[i].second;
+    }
+}
+} // namespace
+
+NETopK::NETopK()
+    : _kernel(), _candidate_values(), _candidate_indices(), _candidate_counts(), _values(nullptr), _indices(nullptr), _k(0)
+{
+}
+
+void NETopK::configure(const ITensor *input, ITensor *values, ITensor *indices, unsigned int k)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(values);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(indices);
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*values->info(), TensorShape(k), 1, input->info()->data_type(), input->info()->fixed_point_position());
+    auto_init_if_empty(*indices->info(), TensorShape(k), 1, DataType::U32, 0);
+
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, values);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(indices, 1, DataType::U32);
+    ARM_COMPUTE_ERROR_ON(values->info()->dimension(0) != k);
+    ARM_COMPUTE_ERROR_ON(indices->info()->dimension(0) != k);
+
+    _values  = values;
+    _indices = indices;
+    _k       = k;
+
+    // One candidate slot per scheduler thread; a thread executing several chunks of the
+    // window accumulates into the same slot
+    const unsigned int num_slots = NEScheduler::get().num_threads();
+
+    _candidate_values.allocator()->init(TensorInfo(TensorShape(k, num_slots), 1, input->info()->data_type(), input->info()->fixed_point_position()));
+    _candidate_indices.allocator()->init(TensorInfo(TensorShape(k, num_slots), 1, DataType::U32));
+    _candidate_counts.allocator()->init(TensorInfo(TensorShape(num_slots), 1, DataType::U32));
+
+    _kernel.configure(input, &_candidate_values, &_candidate_indices, &_candidate_counts, k);
+
+    _candidate_values.allocator()->allocate();
+    _candidate_indices.allocator()->allocate();
+    _candidate_counts.allocator()->allocate();
+}
+
+void NETopK::run()
+{
+    // The kernel accumulates into the candidate slots, so the counts must be reset per run
+    std::memset(_candidate_counts.buffer() + _candidate_counts.info()->offset_first_element_in_bytes(), 0, _candidate_counts.info()->dimension(0) * sizeof(uint32_t));
+
+    NEScheduler::get().schedule(&_kernel, Window::DimX);
+
+    switch(_values->info()->data_type())
+    {
+        case DataType::QASYMM8:
+            merge_candidates<uint8_t>(_candidate_values, _candidate_indices, _candidate_counts, _values, _indices, _k);
+            break;
+        case DataType::F32:
+            merge_candidates<float>(_candidate_values, _candidate_indices, _candidate_counts, _values, _indices, _k);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported data type.");
+            break;
+    }
+}
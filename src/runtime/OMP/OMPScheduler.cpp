@@ -56,10 +56,16 @@ void OMPScheduler::set_num_threads(unsigned int num_threads)
 
 void OMPScheduler::schedule(ICPPKernel *kernel, unsigned int split_dimension)
 {
+    split_dimension = tuned_split_dimension(kernel, split_dimension);
+
     ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
 
+    prepare_workspaces(_num_threads);
+
     ThreadInfo info;
-    info.cpu_info = _info;
+    info.cpu_info       = _info;
+    info.workspace      = thread_workspace(0);
+    info.workspace_size = workspace_size();
 
     const Window      &max_window     = kernel->window();
     const unsigned int num_iterations = max_window.num_iterations(split_dimension);
@@ -78,6 +84,7 @@ void OMPScheduler::schedule(ICPPKernel *kernel, unsigned int split_dimension)
             {
                 Window win     = max_window.split_window(split_dimension, t, info.num_threads);
                 info.thread_id = t;
+                info.workspace = thread_workspace(t);
                 kernel->run(win, info);
             }
         }
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/OffsetLifetimeManager.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/IAllocator.h"
+#include "arm_compute/runtime/IMemoryGroup.h"
+#include "arm_compute/runtime/OffsetMemoryPool.h"
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <vector>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Alignment of each tensor within the arena, so that neighbouring tensors never share a cache line */
+constexpr size_t arena_alignment = 64;
+
+size_t align_up(size_t value)
+{
+    return (value + arena_alignment - 1) & ~(arena_alignment - 1);
+}
+} // namespace
+
+OffsetLifetimeManager::OffsetLifetimeManager()
+    : _active_group(nullptr), _active_elements(), _finalized_groups(), _blob(0)
+{
+}
+
+void OffsetLifetimeManager::register_group(IMemoryGroup *group)
+{
+    if(_active_group == nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON(group == nullptr);
+        _active_group = group;
+    }
+}
+
+void OffsetLifetimeManager::start_lifetime(void *obj)
+{
+    ARM_COMPUTE_ERROR_ON(obj == nullptr);
+    ARM_COMPUTE_ERROR_ON_MSG(std::find_if(std::begin(_active_elements), std::end(_active_elements), [&obj](const Element & e)
+    {
+        return obj == e.id;
+    }) != std::end(_active_elements),
+    "Memory object is already registered!");
+
+    // Insert object in groups and mark its finalized state to false
+    _active_elements.emplace_back(obj);
+}
+
+void OffsetLifetimeManager::end_lifetime(void *obj, void **handle, size_t size)
+{
+    ARM_COMPUTE_ERROR_ON(obj == nullptr);
+
+    // Find object
+    auto it = std::find_if(std::begin(_active_elements), std::end(_active_elements), [&obj](const Element & e)
+    {
+        return obj == e.id;
+    });
+    ARM_COMPUTE_ERROR_ON(it == std::end(_active_elements));
+
+    // Update object fields and mark object as complete
+    it->handle = handle;
+    it->size   = size;
+    it->status = true;
+
+    // Check if all object are finalized and reset active group
+    if(are_all_finalized())
+    {
+        // Update finalized groups
+        _finalized_groups[_active_group].insert(std::end(_finalized_groups[_active_group]), std::begin(_active_elements), std::end(_active_elements));
+
+        // Update blob size and group mappings
+        update_blob_and_mappings();
+
+        // Reset state
+        _active_elements.clear();
+        _active_group = nullptr;
+    }
+}
+
+std::unique_ptr<IMemoryPool> OffsetLifetimeManager::create_pool(IAllocator *allocator)
+{
+    ARM_COMPUTE_ERROR_ON(allocator == nullptr);
+    return support::cpp14::make_unique<OffsetMemoryPool>(allocator, _blob);
+}
+
+bool OffsetLifetimeManager::are_all_finalized() const
+{
+    return !std::any_of(std::begin(_active_elements), std::end(_active_elements), [](const Element e)
+    {
+        return !e.status;
+    });
+}
+
+MappingType OffsetLifetimeManager::mapping_type() const
+{
+    return MappingType::OFFSETS;
+}
+
+size_t OffsetLifetimeManager::total_pool_size() const
+{
+    return _blob;
+}
+
+std::vector<size_t> OffsetLifetimeManager::pool_chunk_sizes() const
+{
+    return { _blob };
+}
+
+size_t OffsetLifetimeManager::total_registered_size() const
+{
+    size_t total = 0;
+    for(const auto &group : _finalized_groups)
+    {
+        for(const auto &e : group.second)
+        {
+            total += e.size;
+        }
+    }
+    return total;
+}
+
+void OffsetLifetimeManager::print_placement(std::ostream &os) const
+{
+    os << "Pool size: " << _blob << " bytes in a single arena\n";
+    os << "Registered size: " << total_registered_size() << " bytes\n";
+
+    int group_idx = 0;
+    for(const auto &group : _finalized_groups)
+    {
+        auto &group_mappings = group.first->mappings();
+        os << "Group " << group_idx++ << ":\n";
+        for(const auto &e : group.second)
+        {
+            const auto it = group_mappings.find(e.handle);
+            os << "  tensor " << e.id << " size " << e.size << " -> offset ";
+            if(it != group_mappings.end())
+            {
+                os << it->second;
+            }
+            else
+            {
+                os << "unknown";
+            }
+            os << "\n";
+        }
+    }
+}
+
+void OffsetLifetimeManager::update_blob_and_mappings()
+{
+    ARM_COMPUTE_ERROR_ON(!are_all_finalized());
+    ARM_COMPUTE_ERROR_ON(_active_group == nullptr);
+
+    // Update blob size: groups that run at different times re-use the same arena
+    size_t group_size = std::accumulate(std::begin(_active_elements), std::end(_active_elements), static_cast<size_t>(0), [](size_t total, const Element & e)
+    {
+        return total + align_up(e.size);
+    });
+    _blob = std::max(_blob, group_size);
+
+    // Calculate group mappings: pack the group's elements back to back in registration order,
+    // which is the order the function configured (and will run) them, so each producer-consumer
+    // pair of intermediates ends up in adjacent, cache-line aligned memory
+    auto &group_mappings = _active_group->mappings();
+    size_t offset        = 0;
+    for(auto &e : _active_elements)
+    {
+        group_mappings[e.handle] = offset;
+        offset += align_up(e.size);
+        ARM_COMPUTE_ERROR_ON(offset > _blob);
+    }
+}
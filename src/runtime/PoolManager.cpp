@@ -27,48 +27,76 @@
 #include "arm_compute/runtime/IMemoryPool.h"
 #include "support/ToolchainSupport.h"
 
-#include <list>
+#include <algorithm>
+#include <atomic>
 
 using namespace arm_compute;
 
 PoolManager::PoolManager()
-    : _free_pools(), _occupied_pools(), _sem(), _mtx()
+    : _pools(), _occupied(), _sem(), _mtx(), _last_freed(0)
 {
 }
 
 IMemoryPool *PoolManager::lock_pool()
 {
-    ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty() && _occupied_pools.empty(), "Haven't setup any pools!");
+    ARM_COMPUTE_ERROR_ON_MSG(_pools.empty(), "Haven't setup any pools!");
 
+    // Claim one of the free slots; blocks only when all pools are in flight
     _sem->wait();
-    std::lock_guard<arm_compute::Mutex> lock(_mtx);
-    ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty(), "Empty pool must exist as semaphore has been signalled");
-    _occupied_pools.splice(std::begin(_occupied_pools), _free_pools, std::begin(_free_pools));
-    return _occupied_pools.front().get();
+
+    // The claim guarantees a free slot exists, so the lock-free scan below always succeeds.
+    // Start the scan at the most recently freed slot: in a sequential run loop that pool's
+    // address range is the one whose cache lines are still hot, so handing it out again keeps
+    // consecutive layers working in the same memory
+    const size_t num_pools = _pools.size();
+    const size_t start     = _last_freed.load(std::memory_order_relaxed);
+    while(true)
+    {
+        for(size_t n = 0; n < num_pools; ++n)
+        {
+            const size_t i        = (start + n) % num_pools;
+            bool         expected = false;
+            if(_occupied[i].compare_exchange_strong(expected, true, std::memory_order_acquire))
+            {
+                return _pools[i].get();
+            }
+        }
+    }
 }
 
 void PoolManager::unlock_pool(IMemoryPool *pool)
 {
-    ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty() && _occupied_pools.empty(), "Haven't setup any pools!");
+    ARM_COMPUTE_ERROR_ON_MSG(_pools.empty(), "Haven't setup any pools!");
 
-    std::lock_guard<arm_compute::Mutex> lock(_mtx);
-    auto it = std::find_if(std::begin(_occupied_pools), std::end(_occupied_pools), [pool](const std::unique_ptr<IMemoryPool> &pool_it)
+    // Find the slot of the pool; the registered set doesn't change while pools are locked
+    auto it = std::find_if(std::begin(_pools), std::end(_pools), [pool](const std::unique_ptr<IMemoryPool> &pool_it)
     {
         return pool_it.get() == pool;
     });
-    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_occupied_pools), "Pool to be unlocked couldn't be found!");
-    _free_pools.splice(std::begin(_free_pools), _occupied_pools, it);
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_pools), "Pool to be unlocked couldn't be found!");
+
+    const size_t slot = it - std::begin(_pools);
+    _last_freed.store(slot, std::memory_order_relaxed);
+    _occupied[slot].store(false, std::memory_order_release);
     _sem->signal();
 }
 
 void PoolManager::register_pool(std::unique_ptr<IMemoryPool> pool)
 {
     std::lock_guard<arm_compute::Mutex> lock(_mtx);
-    ARM_COMPUTE_ERROR_ON_MSG(!_occupied_pools.empty(), "All pools should be free in order to register a new one!");
+    for(size_t i = 0; i < _pools.size(); ++i)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(_occupied[i].load(), "All pools should be free in order to register a new one!");
+    }
 
-    // Set pool
-    _free_pools.push_front(std::move(pool));
+    // Add pool
+    _pools.push_back(std::move(pool));
 
-    // Update semaphore
-    _sem = arm_compute::support::cpp14::make_unique<arm_compute::Semaphore>(_free_pools.size());
+    // Rebuild occupancy flags and semaphore; all slots start free
+    _occupied = arm_compute::support::cpp14::make_unique<std::atomic<bool>[]>(_pools.size());
+    for(size_t i = 0; i < _pools.size(); ++i)
+    {
+        _occupied[i].store(false, std::memory_order_relaxed);
+    }
+    _sem = arm_compute::support::cpp14::make_unique<arm_compute::Semaphore>(_pools.size());
 }
@@ -46,6 +46,13 @@ Scheduler::Type Scheduler::_scheduler_type = Scheduler::Type::CPP;
 Scheduler::Type Scheduler::_scheduler_type = Scheduler::Type::ST;
 #endif /* ARM_COMPUTE_*_SCHEDULER */
 
+thread_local IScheduler *Scheduler::_thread_scheduler = nullptr;
+
+void Scheduler::bind_to_thread(IScheduler *scheduler)
+{
+    _thread_scheduler = scheduler;
+}
+
 void Scheduler::set(Type t)
 {
     ARM_COMPUTE_ERROR_ON(!Scheduler::is_available(t));
@@ -95,6 +102,11 @@ Scheduler::Type Scheduler::get_type()
 
 IScheduler &Scheduler::get()
 {
+    if(_thread_scheduler != nullptr)
+    {
+        return *_thread_scheduler;
+    }
+
     switch(_scheduler_type)
     {
         case Type::ST:
@@ -26,14 +26,44 @@
 #include "arm_compute/core/Coordinates.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/MemoryColoring.h"
 #include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/MemoryTracker.h"
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#ifndef BARE_METAL
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif /* BARE_METAL */
 
 using namespace arm_compute;
 
 namespace
 {
+/** Minimum zero-run length worth breaking a literal run for; shorter runs cost less than a chunk header */
+constexpr size_t min_zero_run = 8;
+
+/** Appends a 32-bit little-endian value to the compressed stream */
+void append_u32(std::vector<uint8_t> &out, uint32_t value)
+{
+    out.push_back(value & 0xFF);
+    out.push_back((value >> 8) & 0xFF);
+    out.push_back((value >> 16) & 0xFF);
+    out.push_back((value >> 24) & 0xFF);
+}
+
+/** Reads a 32-bit little-endian value from the compressed stream */
+uint32_t read_u32(const uint8_t *in)
+{
+    return static_cast<uint32_t>(in[0]) | (static_cast<uint32_t>(in[1]) << 8) | (static_cast<uint32_t>(in[2]) << 16) | (static_cast<uint32_t>(in[3]) << 24);
+}
+
 bool validate_subtensor_shape(const TensorInfo &parent_info, const TensorInfo &child_info, const Coordinates &coords)
 {
     bool               is_valid     = true;
@@ -65,7 +95,7 @@ bool validate_subtensor_shape(const TensorInfo &parent_info, const TensorInfo &c
 } // namespace
 
 TensorAllocator::TensorAllocator(Tensor *owner)
-    : _associated_memory_group(nullptr), _buffer(nullptr), _owner(owner)
+    : _associated_memory_group(nullptr), _buffer(nullptr), _owner(owner), _is_imported(false), _compressed(), _is_compressed(false), _shm_name(), _shm_owner(false), _color_offset(0)
 {
 }
 
@@ -73,8 +103,18 @@ TensorAllocator::~TensorAllocator()
 {
     if((_associated_memory_group == nullptr) && (_buffer != nullptr))
     {
-        delete[] _buffer;
-        _buffer = nullptr;
+        if(!_shm_name.empty())
+        {
+            release_shared();
+        }
+        else if(!_is_imported)
+        {
+            MemoryTracker::get().record_free(_buffer - _color_offset);
+            delete[](_buffer - _color_offset);
+        }
+        _buffer       = nullptr;
+        _is_imported  = false;
+        _color_offset = 0;
         info().set_is_resizable(true);
     }
 }
@@ -83,11 +123,22 @@ TensorAllocator::TensorAllocator(TensorAllocator &&o) noexcept
     : ITensorAllocator(std::move(o)),
       _associated_memory_group(o._associated_memory_group),
       _buffer(o._buffer),
-      _owner(o._owner)
+      _owner(o._owner),
+      _is_imported(o._is_imported),
+      _compressed(std::move(o._compressed)),
+      _is_compressed(o._is_compressed),
+      _shm_name(std::move(o._shm_name)),
+      _shm_owner(o._shm_owner),
+      _color_offset(o._color_offset)
 {
     o._associated_memory_group = nullptr;
     o._buffer                  = nullptr;
     o._owner                   = nullptr;
+    o._is_imported             = false;
+    o._is_compressed           = false;
+    o._shm_name.clear();
+    o._shm_owner    = false;
+    o._color_offset = 0;
 }
 
 TensorAllocator &TensorAllocator::operator=(TensorAllocator &&o) noexcept
@@ -103,6 +154,23 @@ TensorAllocator &TensorAllocator::operator=(TensorAllocator &&o) noexcept
         _owner   = o._owner;
         o._owner = nullptr;
 
+        _is_imported   = o._is_imported;
+        o._is_imported = false;
+
+        _compressed = std::move(o._compressed);
+
+        _is_compressed   = o._is_compressed;
+        o._is_compressed = false;
+
+        _shm_name = std::move(o._shm_name);
+        o._shm_name.clear();
+
+        _shm_owner   = o._shm_owner;
+        o._shm_owner = false;
+
+        _color_offset   = o._color_offset;
+        o._color_offset = 0;
+
         ITensorAllocator::operator=(std::move(o));
     }
     return *this;
@@ -138,7 +206,11 @@ void TensorAllocator::allocate()
     ARM_COMPUTE_ERROR_ON(_buffer != nullptr);
     if(_associated_memory_group == nullptr)
     {
-        _buffer = new uint8_t[info().total_size()]();
+        // Stagger the buffer start across cache sets so concurrently-accessed tensors do not
+        // evict each other's lines; a zero offset when coloring is disabled
+        _color_offset = MemoryColoring::get().next_offset();
+        _buffer       = new uint8_t[info().total_size() + _color_offset]() + _color_offset;
+        MemoryTracker::get().record_allocation(_buffer - _color_offset, info().total_size() + _color_offset);
     }
     else
     {
@@ -149,14 +221,253 @@ void TensorAllocator::allocate()
 
 void TensorAllocator::free()
 {
-    if((_associated_memory_group == nullptr) && (_buffer != nullptr))
+    if((_associated_memory_group == nullptr) && (_buffer != nullptr || _is_compressed))
     {
-        delete[] _buffer;
-        _buffer = nullptr;
+        if((_buffer != nullptr) && !_shm_name.empty())
+        {
+            release_shared();
+        }
+        else if((_buffer != nullptr) && !_is_imported)
+        {
+            MemoryTracker::get().record_free(_buffer - _color_offset);
+            delete[](_buffer - _color_offset);
+        }
+        _buffer       = nullptr;
+        _is_imported  = false;
+        _color_offset = 0;
+        std::vector<uint8_t>().swap(_compressed);
+        _is_compressed = false;
         info().set_is_resizable(true);
     }
 }
 
+void TensorAllocator::compress()
+{
+    ARM_COMPUTE_ERROR_ON(_associated_memory_group != nullptr);
+    ARM_COMPUTE_ERROR_ON(_is_imported);
+    ARM_COMPUTE_ERROR_ON(!_shm_name.empty());
+    ARM_COMPUTE_ERROR_ON(_buffer == nullptr);
+    ARM_COMPUTE_ERROR_ON(_is_compressed);
+
+    const size_t total_size = info().total_size();
+    _compressed.reserve(total_size / 4);
+
+    // Encode the contents as (zero run, literal run) chunks; a literal run only breaks for a
+    // zero run long enough to amortize the chunk header
+    size_t pos = 0;
+    while(pos < total_size)
+    {
+        const size_t zero_start = pos;
+        while(pos < total_size && _buffer[pos] == 0)
+        {
+            ++pos;
+        }
+        const size_t zero_count = pos - zero_start;
+
+        const size_t lit_start = pos;
+        size_t       lit_end   = pos;
+        size_t       run       = 0;
+        for(size_t scan = pos; scan < total_size; ++scan)
+        {
+            run = (_buffer[scan] == 0) ? run + 1 : 0;
+            if(run >= min_zero_run)
+            {
+                break;
+            }
+            if(_buffer[scan] != 0)
+            {
+                lit_end = scan + 1;
+            }
+        }
+
+        append_u32(_compressed, static_cast<uint32_t>(zero_count));
+        append_u32(_compressed, static_cast<uint32_t>(lit_end - lit_start));
+        _compressed.insert(std::end(_compressed), _buffer + lit_start, _buffer + lit_end);
+
+        // Trailing zeros not covered by the literal run are consumed by the next chunk's zero
+        // scan, or recovered by the zero-initialised buffer on decompression
+        pos = lit_end;
+    }
+    _compressed.shrink_to_fit();
+
+    MemoryTracker::get().record_free(_buffer - _color_offset);
+    delete[](_buffer - _color_offset);
+    _buffer        = nullptr;
+    _color_offset  = 0;
+    _is_compressed = true;
+}
+
+void TensorAllocator::decompress()
+{
+    ARM_COMPUTE_ERROR_ON(!_is_compressed);
+    ARM_COMPUTE_ERROR_ON(_buffer != nullptr);
+
+    const size_t total_size = info().total_size();
+    _color_offset           = MemoryColoring::get().next_offset();
+    _buffer                 = new uint8_t[total_size + _color_offset]() + _color_offset;
+    MemoryTracker::get().record_allocation(_buffer - _color_offset, total_size + _color_offset);
+
+    // Zero runs are already in place thanks to the zero-initialised allocation
+    size_t pos = 0;
+    size_t in  = 0;
+    while(in < _compressed.size())
+    {
+        const uint32_t zero_count    = read_u32(_compressed.data() + in);
+        const uint32_t literal_count = read_u32(_compressed.data() + in + 4);
+        in += 8;
+        pos += zero_count;
+        ARM_COMPUTE_ERROR_ON(pos + literal_count > total_size);
+        std::memcpy(_buffer + pos, _compressed.data() + in, literal_count);
+        in += literal_count;
+        pos += literal_count;
+    }
+
+    std::vector<uint8_t>().swap(_compressed);
+    _is_compressed = false;
+}
+
+bool TensorAllocator::is_compressed() const
+{
+    return _is_compressed;
+}
+
+size_t TensorAllocator::compressed_size() const
+{
+    return _compressed.size();
+}
+
+void TensorAllocator::import_memory(void *memory, size_t size)
+{
+    ARM_COMPUTE_ERROR_ON(memory == nullptr);
+    ARM_COMPUTE_ERROR_ON(_buffer != nullptr);
+    ARM_COMPUTE_ERROR_ON(_associated_memory_group != nullptr);
+    ARM_COMPUTE_ERROR_ON_MSG(size < info().total_size(), "Imported memory is smaller than the tensor's total size");
+    ARM_COMPUTE_ERROR_ON_MSG(reinterpret_cast<uintptr_t>(memory) % info().element_size() != 0, "Imported memory is not aligned to the tensor's element size");
+    ARM_COMPUTE_UNUSED(size);
+
+    _buffer      = reinterpret_cast<uint8_t *>(memory);
+    _is_imported = true;
+    info().set_is_resizable(false);
+}
+
+void TensorAllocator::allocate_shared(const std::string &name)
+{
+#ifndef BARE_METAL
+    ARM_COMPUTE_ERROR_ON(_buffer != nullptr);
+    ARM_COMPUTE_ERROR_ON(_associated_memory_group != nullptr);
+    ARM_COMPUTE_ERROR_ON_MSG(name.empty() || name.front() != '/', "Shared memory region names must start with '/'");
+    ARM_COMPUTE_ERROR_ON_MSG(name.size() >= sizeof(SharedTensorHandle::name), "Shared memory region name is too long");
+    ARM_COMPUTE_ERROR_ON_MSG(info().has_padding(), "Shared tensors must be padding-less, allocate before padding is extended");
+
+    const size_t size = info().total_size();
+
+    const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    ARM_COMPUTE_ERROR_ON_MSG(fd == -1, "Failed to create the shared memory region");
+
+    if(ftruncate(fd, size) == -1)
+    {
+        close(fd);
+        shm_unlink(name.c_str());
+        ARM_COMPUTE_ERROR("Failed to size the shared memory region");
+    }
+
+    void *mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if(mapping == MAP_FAILED)
+    {
+        shm_unlink(name.c_str());
+        ARM_COMPUTE_ERROR("Failed to map the shared memory region");
+    }
+
+    MemoryTracker::get().record_allocation(mapping, size);
+    _buffer    = reinterpret_cast<uint8_t *>(mapping);
+    _shm_name  = name;
+    _shm_owner = true;
+    info().set_is_resizable(false);
+#else  /* BARE_METAL */
+    ARM_COMPUTE_UNUSED(name);
+    ARM_COMPUTE_ERROR("Shared memory tensors are not supported on bare metal");
+#endif /* BARE_METAL */
+}
+
+void TensorAllocator::import_shared(const SharedTensorHandle &handle)
+{
+#ifndef BARE_METAL
+    ARM_COMPUTE_ERROR_ON(_buffer != nullptr);
+    ARM_COMPUTE_ERROR_ON(_associated_memory_group != nullptr);
+    ARM_COMPUTE_ERROR_ON(handle.num_dimensions == 0 || handle.num_dimensions > TensorShape::num_max_dimensions);
+
+    // Rebuild the layout the exporting process described; shared tensors carry no padding,
+    // so shape and data type fully determine the strides
+    TensorShape shape;
+    shape.set_num_dimensions(handle.num_dimensions);
+    for(unsigned int i = 0; i < handle.num_dimensions; ++i)
+    {
+        shape.set(i, handle.shape[i]);
+    }
+
+    TensorInfo imported_info(shape, handle.num_channels, static_cast<DataType>(handle.data_type), handle.fixed_point_position);
+    if(imported_info.data_type() == DataType::QASYMM8)
+    {
+        imported_info.set_quantization_info(QuantizationInfo(handle.quantization_scale, handle.quantization_offset));
+    }
+    init(imported_info);
+
+    const size_t size = info().total_size();
+
+    const int fd = shm_open(handle.name, O_RDWR, 0);
+    ARM_COMPUTE_ERROR_ON_MSG(fd == -1, "Failed to open the shared memory region");
+
+    void *mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    ARM_COMPUTE_ERROR_ON_MSG(mapping == MAP_FAILED, "Failed to map the shared memory region");
+
+    MemoryTracker::get().record_allocation(mapping, size);
+    _buffer    = reinterpret_cast<uint8_t *>(mapping);
+    _shm_name  = handle.name;
+    _shm_owner = false;
+    info().set_is_resizable(false);
+#else  /* BARE_METAL */
+    ARM_COMPUTE_UNUSED(handle);
+    ARM_COMPUTE_ERROR("Shared memory tensors are not supported on bare metal");
+#endif /* BARE_METAL */
+}
+
+SharedTensorHandle TensorAllocator::export_handle() const
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_shm_name.empty(), "The tensor is not backed by a shared memory region");
+
+    const TensorInfo &tensor_info = info();
+
+    SharedTensorHandle handle{};
+    std::strncpy(handle.name, _shm_name.c_str(), sizeof(handle.name) - 1);
+    handle.num_dimensions = tensor_info.num_dimensions();
+    for(unsigned int i = 0; i < handle.num_dimensions; ++i)
+    {
+        handle.shape[i] = tensor_info.tensor_shape()[i];
+    }
+    handle.num_channels         = tensor_info.num_channels();
+    handle.data_type            = static_cast<int32_t>(tensor_info.data_type());
+    handle.fixed_point_position = tensor_info.fixed_point_position();
+    handle.quantization_scale   = tensor_info.quantization_info().scale;
+    handle.quantization_offset  = tensor_info.quantization_info().offset;
+    return handle;
+}
+
+void TensorAllocator::release_shared()
+{
+#ifndef BARE_METAL
+    MemoryTracker::get().record_free(_buffer);
+    munmap(_buffer, info().total_size());
+    if(_shm_owner)
+    {
+        shm_unlink(_shm_name.c_str());
+    }
+#endif /* BARE_METAL */
+    _shm_name.clear();
+    _shm_owner = false;
+}
+
 void TensorAllocator::set_associated_memory_group(MemoryGroup *associated_memory_group)
 {
     ARM_COMPUTE_ERROR_ON(associated_memory_group == nullptr);
@@ -167,6 +478,7 @@ void TensorAllocator::set_associated_memory_group(MemoryGroup *associated_memory
 
 uint8_t *TensorAllocator::lock()
 {
+    ARM_COMPUTE_ERROR_ON_MSG(_is_compressed, "Tensor contents are compressed: call decompress() first");
     return _buffer;
 }
 
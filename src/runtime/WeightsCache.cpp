@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/WeightsCache.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+#include "support/ToolchainSupport.h"
+
+#include <fstream>
+
+using namespace arm_compute;
+
+WeightsCache &WeightsCache::get()
+{
+    static WeightsCache cache;
+    return cache;
+}
+
+void WeightsCache::set_enabled(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _enabled = enabled;
+}
+
+bool WeightsCache::is_enabled() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _enabled;
+}
+
+WeightsCache::Key WeightsCache::make_key(const ITensor *weights, const std::string &transform) const
+{
+    // Key by buffer identity, so that distinct tensor objects wrapping the same memory (e.g.
+    // per-stream instances of one network sharing imported weights) resolve to one entry.
+    // Tensors not allocated yet fall back to object identity
+    const void *id = (weights->buffer() != nullptr) ? static_cast<const void *>(weights->buffer()) : static_cast<const void *>(weights);
+    return Key(id, transform);
+}
+
+WeightsCache::Key WeightsCache::resolve_key(const ITensor *weights, const std::string &transform) const
+{
+    // Use the key recorded at acquire time when there is one: it stays valid even if the
+    // weights tensor has been allocated (or freed) since the function was configured
+    const auto alias = _aliases.find(AliasKey(weights, transform));
+    return (alias != _aliases.end()) ? alias->second : make_key(weights, transform);
+}
+
+ITensor *WeightsCache::acquire(const ITensor *weights, const std::string &transform, const TensorInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(weights);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    const Key key                          = make_key(weights, transform);
+    _aliases[AliasKey(weights, transform)] = key;
+    auto it                                = _cache.find(key);
+
+    if(it == _cache.end())
+    {
+        // Build an identifier for on disk persistence from the transform, the tensor geometry
+        // and a running index disambiguating layers that share the same geometry. It is stable
+        // across runs as long as the functions are configured in the same order
+        std::string uid = transform;
+        for(size_t i = 0; i < info.tensor_shape().num_dimensions(); ++i)
+        {
+            uid += "_" + support::cpp11::to_string(info.tensor_shape()[i]);
+        }
+        uid += "_dt" + support::cpp11::to_string(static_cast<int>(info.data_type()));
+
+        const std::string prefix = uid + "_";
+        unsigned int      index  = 0;
+        for(const auto &entry : _cache)
+        {
+            if(entry.second.uid.compare(0, prefix.size(), prefix) == 0)
+            {
+                ++index;
+            }
+        }
+        uid = prefix + support::cpp11::to_string(index);
+
+        Entry entry;
+        entry.tensor = support::cpp14::make_unique<Tensor>();
+        entry.uid    = uid;
+        entry.tensor->allocator()->init(info);
+        entry.tensor->allocator()->allocate();
+
+        it = _cache.emplace(key, std::move(entry)).first;
+    }
+
+    return it->second.tensor.get();
+}
+
+bool WeightsCache::is_reshaped(const ITensor *weights, const std::string &transform) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    const auto it = _cache.find(resolve_key(weights, transform));
+    return (it != _cache.end()) && it->second.reshaped;
+}
+
+void WeightsCache::mark_reshaped(const ITensor *weights, const std::string &transform)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    const auto it = _cache.find(resolve_key(weights, transform));
+    if(it != _cache.end())
+    {
+        it->second.reshaped = true;
+    }
+}
+
+bool WeightsCache::save(const std::string &directory) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    bool saved_all = true;
+
+    for(const auto &entry : _cache)
+    {
+        if(!entry.second.reshaped)
+        {
+            saved_all = false;
+            continue;
+        }
+
+        std::ofstream out(directory + "/" + entry.second.uid + ".bin", std::ios::out | std::ios::binary);
+        if(!out)
+        {
+            saved_all = false;
+            continue;
+        }
+
+        out.write(reinterpret_cast<const char *>(entry.second.tensor->buffer()), entry.second.tensor->info()->total_size());
+        saved_all = saved_all && out.good();
+    }
+
+    return saved_all;
+}
+
+bool WeightsCache::load(const std::string &directory)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    bool loaded_all = true;
+
+    for(auto &entry : _cache)
+    {
+        if(entry.second.reshaped)
+        {
+            continue;
+        }
+
+        const std::streamsize size = entry.second.tensor->info()->total_size();
+
+        std::ifstream in(directory + "/" + entry.second.uid + ".bin", std::ios::in | std::ios::binary);
+        if(!in)
+        {
+            loaded_all = false;
+            continue;
+        }
+
+        in.read(reinterpret_cast<char *>(entry.second.tensor->buffer()), size);
+        if(in.gcount() == size)
+        {
+            entry.second.reshaped = true;
+        }
+        else
+        {
+            loaded_all = false;
+        }
+    }
+
+    return loaded_all;
+}
+
+void WeightsCache::clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _cache.clear();
+    _aliases.clear();
+}
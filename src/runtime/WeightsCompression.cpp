@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/WeightsCompression.h"
+
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+/** Index of the centroid closest to @p value in a sorted centroid array */
+unsigned int nearest_code(const std::vector<float> &centroids, float value)
+{
+    const auto it = std::lower_bound(centroids.begin(), centroids.end(), value);
+    if(it == centroids.begin())
+    {
+        return 0;
+    }
+    if(it == centroids.end())
+    {
+        return centroids.size() - 1;
+    }
+
+    const unsigned int hi = it - centroids.begin();
+    return ((value - centroids[hi - 1]) <= (centroids[hi] - value)) ? (hi - 1) : hi;
+}
+} // namespace
+
+namespace arm_compute
+{
+void compress_weights_codebook(const ITensor *weights, ITensor *codes, ITensor *codebook, ITensor *scales, unsigned int num_iterations)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(codes, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(codebook, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(scales, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON(weights->info()->num_dimensions() > 2);
+    ARM_COMPUTE_ERROR_ON(codes->info()->dimension(0) != weights->info()->dimension(0));
+    ARM_COMPUTE_ERROR_ON(codes->info()->dimension(1) != weights->info()->dimension(1));
+    ARM_COMPUTE_ERROR_ON_MSG(codebook->info()->dimension(0) != 256, "The codebook must hold 256 entries");
+    ARM_COMPUTE_ERROR_ON(scales->info()->dimension(0) != weights->info()->dimension(1));
+
+    const size_t width  = weights->info()->dimension(0);
+    const size_t height = std::max<size_t>(weights->info()->dimension(1), 1);
+
+    const auto scales_ptr = reinterpret_cast<float *>(scales->ptr_to_element(Coordinates(0)));
+
+    // Normalise each row by its maximum magnitude so one codebook covers rows of very
+    // different dynamic range
+    std::vector<float> normalized(width * height);
+    for(size_t y = 0; y < height; ++y)
+    {
+        const auto row = reinterpret_cast<const float *>(weights->ptr_to_element(Coordinates(0, static_cast<int>(y))));
+
+        float max_abs = 0.f;
+        for(size_t x = 0; x < width; ++x)
+        {
+            max_abs = std::max(max_abs, std::abs(row[x]));
+        }
+        scales_ptr[y] = (max_abs != 0.f) ? max_abs : 1.f;
+
+        for(size_t x = 0; x < width; ++x)
+        {
+            normalized[y * width + x] = row[x] / scales_ptr[y];
+        }
+    }
+
+    // Lloyd's k-means on the normalised values, centroids kept sorted so the assignment
+    // step is a binary search; means of contiguous partitions stay sorted across iterations
+    std::vector<float> centroids(256);
+    for(size_t i = 0; i < centroids.size(); ++i)
+    {
+        centroids[i] = -1.f + 2.f * i / (centroids.size() - 1);
+    }
+
+    std::vector<double> sums(centroids.size());
+    std::vector<size_t> counts(centroids.size());
+    for(unsigned int iter = 0; iter < num_iterations; ++iter)
+    {
+        std::fill(sums.begin(), sums.end(), 0.0);
+        std::fill(counts.begin(), counts.end(), 0);
+
+        for(const float value : normalized)
+        {
+            const unsigned int code = nearest_code(centroids, value);
+            sums[code] += value;
+            ++counts[code];
+        }
+
+        for(size_t i = 0; i < centroids.size(); ++i)
+        {
+            if(counts[i] != 0)
+            {
+                centroids[i] = static_cast<float>(sums[i] / counts[i]);
+            }
+        }
+    }
+
+    const auto codebook_ptr = reinterpret_cast<float *>(codebook->ptr_to_element(Coordinates(0)));
+    std::copy(centroids.begin(), centroids.end(), codebook_ptr);
+
+    for(size_t y = 0; y < height; ++y)
+    {
+        const auto codes_row = codes->ptr_to_element(Coordinates(0, static_cast<int>(y)));
+        for(size_t x = 0; x < width; ++x)
+        {
+            codes_row[x] = static_cast<uint8_t>(nearest_code(centroids, normalized[y * width + x]));
+        }
+    }
+}
+} // namespace arm_compute
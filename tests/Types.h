@@ -42,6 +42,13 @@ enum class FixedPointOp
     RECIPROCAL /**< Reciprocal */
 };
 
+/** Cache state a benchmark iteration starts from */
+enum class CacheState
+{
+    WARM, /**< Tensor data may still be cached from the previous iteration */
+    COLD  /**< CPU caches are flushed before each iteration */
+};
+
 template <typename MinMaxType>
 struct MinMaxLocationValues
 {
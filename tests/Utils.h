@@ -486,6 +486,27 @@ inline std::string get_typestring(DataType data_type)
             ARM_COMPUTE_ERROR("NOT SUPPORTED!");
     }
 }
+
+/** Evict tensor data from the CPU caches.
+ *
+ * Streams through a buffer larger than typical last-level caches so
+ * subsequent accesses to any tensor start from memory. Used by benchmark
+ * fixtures to produce cold-cache numbers without privileged cache
+ * maintenance instructions.
+ */
+inline void flush_cpu_cache()
+{
+    // 8 MiB exceeds the L2 of the CPUs the library targets
+    constexpr size_t            flush_size = 8 * 1024 * 1024;
+    static std::vector<uint8_t> buffer(flush_size);
+
+    volatile uint8_t sink = 0;
+    for(size_t i = 0; i < buffer.size(); i += 64)
+    {
+        ++buffer[i];
+        sink += buffer[i];
+    }
+}
 } // namespace test
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_TEST_UTILS_H__ */
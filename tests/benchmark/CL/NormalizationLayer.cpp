@@ -50,23 +50,27 @@ TEST_SUITE(CL)
 REGISTER_FIXTURE_DATA_TEST_CASE(AlexNetNormalizationLayer, CLNormalizationLayerFixture, framework::DatasetMode::ALL,
                                 framework::dataset::combine(framework::dataset::combine(datasets::AlexNetNormalizationLayerDataset(),
                                                                                         data_types),
-                                                            framework::dataset::make("Batches", 1)));
+                                                            framework::dataset::combine(framework::dataset::make("Batches", 1),
+                                                                                        framework::dataset::make("CacheState", CacheState::WARM))));
 
 REGISTER_FIXTURE_DATA_TEST_CASE(GoogLeNetInceptionV1NormalizationLayer, CLNormalizationLayerFixture, framework::DatasetMode::ALL,
                                 framework::dataset::combine(framework::dataset::combine(datasets::GoogLeNetInceptionV1NormalizationLayerDataset(),
                                                                                         data_types),
-                                                            framework::dataset::make("Batches", 1)));
+                                                            framework::dataset::combine(framework::dataset::make("Batches", 1),
+                                                                                        framework::dataset::make("CacheState", CacheState::WARM))));
 
 TEST_SUITE(NIGHTLY)
 REGISTER_FIXTURE_DATA_TEST_CASE(AlexNetNormalizationLayer, CLNormalizationLayerFixture, framework::DatasetMode::NIGHTLY,
                                 framework::dataset::combine(framework::dataset::combine(datasets::AlexNetNormalizationLayerDataset(),
                                                                                         data_types),
-                                                            framework::dataset::make("Batches", { 4, 8 })));
+                                                            framework::dataset::combine(framework::dataset::make("Batches", { 4, 8 }),
+                                                                                        framework::dataset::make("CacheState", CacheState::WARM))));
 
 REGISTER_FIXTURE_DATA_TEST_CASE(GoogLeNetInceptionV1NormalizationLayer, CLNormalizationLayerFixture, framework::DatasetMode::NIGHTLY,
                                 framework::dataset::combine(framework::dataset::combine(datasets::GoogLeNetInceptionV1NormalizationLayerDataset(),
                                                                                         data_types),
-                                                            framework::dataset::make("Batches", { 4, 8 })));
+                                                            framework::dataset::combine(framework::dataset::make("Batches", { 4, 8 }),
+                                                                                        framework::dataset::make("CacheState", CacheState::WARM))));
 TEST_SUITE_END()
 TEST_SUITE_END()
 } // namespace test
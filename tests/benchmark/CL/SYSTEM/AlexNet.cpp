@@ -59,8 +59,9 @@ TEST_SUITE(CL)
 TEST_SUITE(SYSTEM_TEST)
 
 REGISTER_FIXTURE_DATA_TEST_CASE(AlexNet, CLAlexNetFixture, framework::DatasetMode::ALL,
-                                framework::dataset::combine(framework::dataset::make("DataType", { DataType::F16, DataType::F32 }),
-                                                            framework::dataset::make("Batches", { 1, 4, 8 })));
+                                framework::dataset::combine(framework::dataset::combine(framework::dataset::make("DataType", { DataType::F16, DataType::F32 }),
+                                                                                        framework::dataset::make("Batches", { 1, 4, 8 })),
+                                                            framework::dataset::make("Threads", { 1 })));
 
 TEST_SUITE_END()
 TEST_SUITE_END()
@@ -52,7 +52,8 @@ TEST_SUITE(CL)
 TEST_SUITE(SYSTEM_TEST)
 
 REGISTER_FIXTURE_DATA_TEST_CASE(LeNet5, CLLeNet5Fixture, framework::DatasetMode::ALL,
-                                framework::dataset::make("Batches", { 1, 4, 8 }));
+                                framework::dataset::combine(framework::dataset::make("Batches", { 1, 4, 8 }),
+                                                            framework::dataset::make("Threads", { 1 })));
 
 TEST_SUITE_END()
 TEST_SUITE_END()
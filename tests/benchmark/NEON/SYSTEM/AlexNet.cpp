@@ -68,8 +68,9 @@ TEST_SUITE(NEON)
 TEST_SUITE(SYSTEM_TEST)
 
 REGISTER_FIXTURE_DATA_TEST_CASE(AlexNet, NEAlexNetFixture, framework::DatasetMode::ALL,
-                                framework::dataset::combine(alex_net_data_types,
-                                                            framework::dataset::make("Batches", { 1, 4, 8 })));
+                                framework::dataset::combine(framework::dataset::combine(alex_net_data_types,
+                                                                                        framework::dataset::make("Batches", { 1, 4, 8 })),
+                                                            framework::dataset::make("Threads", { 1, 2, 4 })));
 
 TEST_SUITE_END()
 TEST_SUITE_END()
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "tests/benchmark/fixtures/SchedulerDispatchFixture.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace
+{
+// Only the scheduler implementations compiled into the library can be benchmarked
+const auto scheduler_types = framework::dataset::make("Scheduler",
+{
+    Scheduler::Type::ST,
+#if ARM_COMPUTE_CPP_SCHEDULER
+    Scheduler::Type::CPP,
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+#if ARM_COMPUTE_OPENMP_SCHEDULER
+    Scheduler::Type::OMP,
+#endif /* ARM_COMPUTE_OPENMP_SCHEDULER */
+});
+
+const auto threads = framework::dataset::make("Threads", { 1, 2, 4, 8 });
+
+// 0 isolates the pure wake/split/join overhead, 64 additions per window
+// iteration model a kernel whose work barely exceeds the dispatch cost
+const auto work_per_iteration = framework::dataset::make("WorkPerIteration", { 0U, 64U });
+
+const auto split_dimensions = framework::dataset::make("SplitDimension", { static_cast<unsigned int>(Window::DimX), static_cast<unsigned int>(Window::DimY) });
+} // namespace
+
+TEST_SUITE(SCHEDULER)
+
+REGISTER_FIXTURE_DATA_TEST_CASE(DispatchOverhead, SchedulerDispatchFixture, framework::DatasetMode::ALL,
+                                framework::dataset::combine(framework::dataset::combine(framework::dataset::combine(scheduler_types, threads), work_per_iteration),
+                                                            split_dimensions));
+
+TEST_SUITE_END()
+} // namespace test
+} // namespace arm_compute
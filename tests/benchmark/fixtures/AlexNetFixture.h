@@ -24,6 +24,7 @@
 #ifndef ARM_COMPUTE_TEST_ALEXNETFIXTURE
 #define ARM_COMPUTE_TEST_ALEXNETFIXTURE
 
+#include "arm_compute/runtime/Scheduler.h"
 #include "tests/AssetsLibrary.h"
 #include "tests/Utils.h"
 #include "tests/framework/Fixture.h"
@@ -49,11 +50,14 @@ class AlexNetFixture : public framework::Fixture
 {
 public:
     template <typename...>
-    void setup(DataType data_type, int batches)
+    void setup(DataType data_type, int batches, int threads)
     {
         constexpr bool weights_reshaped     = true;
         constexpr int  fixed_point_position = 4;
 
+        _previous_num_threads = Scheduler::get().num_threads();
+        Scheduler::get().set_num_threads(threads);
+
         network.init(data_type, fixed_point_position, batches, weights_reshaped);
         network.build();
         network.allocate();
@@ -68,6 +72,7 @@ public:
     void teardown()
     {
         network.clear();
+        Scheduler::get().set_num_threads(_previous_num_threads);
     }
 
 private:
@@ -83,6 +88,7 @@ private:
              PoolingLayerFunction,
              SoftmaxLayerFunction>
              network{};
+    unsigned int _previous_num_threads{ 1 };
 };
 } // namespace test
 } // namespace arm_compute
@@ -53,7 +53,7 @@ public:
         dst     = create_tensor<TensorType>(dst_shape, data_type, 1, fixed_point_position);
 
         // Create and configure function
-        depth_conv.configure(&src, &dst, &weights, info);
+        depth_conv.configure(&src, &dst, &weights, nullptr, info);
 
         // Allocate tensors
         src.allocator()->allocate();
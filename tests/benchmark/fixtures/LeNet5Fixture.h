@@ -24,6 +24,7 @@
 #ifndef ARM_COMPUTE_TEST_LENET5FIXTURE
 #define ARM_COMPUTE_TEST_LENET5FIXTURE
 
+#include "arm_compute/runtime/Scheduler.h"
 #include "tests/AssetsLibrary.h"
 #include "tests/Utils.h"
 #include "tests/framework/Fixture.h"
@@ -44,8 +45,11 @@ class LeNet5Fixture : public framework::Fixture
 {
 public:
     template <typename...>
-    void setup(int batches)
+    void setup(int batches, int threads)
     {
+        _previous_num_threads = Scheduler::get().num_threads();
+        Scheduler::get().set_num_threads(threads);
+
         network.init(batches);
         network.build();
         network.allocate();
@@ -60,6 +64,7 @@ public:
     void teardown()
     {
         network.clear();
+        Scheduler::get().set_num_threads(_previous_num_threads);
     }
 
 private:
@@ -71,6 +76,7 @@ private:
              PoolingLayerFunction,
              SoftmaxLayerFunction>
              network{};
+    unsigned int _previous_num_threads{ 1 };
 };
 } // namespace test
 } // namespace arm_compute
@@ -27,6 +27,7 @@
 #include "arm_compute/core/TensorShape.h"
 #include "arm_compute/core/Types.h"
 #include "tests/Globals.h"
+#include "tests/Types.h"
 #include "tests/Utils.h"
 #include "tests/framework/Fixture.h"
 
@@ -40,8 +41,10 @@ class NormalizationLayerFixture : public framework::Fixture
 {
 public:
     template <typename...>
-    void setup(TensorShape shape, NormalizationLayerInfo info, DataType data_type, int batches)
+    void setup(TensorShape shape, NormalizationLayerInfo info, DataType data_type, int batches, CacheState cache_state)
     {
+        _cache_state = cache_state;
+
         // Set batched in source and destination shapes
         const unsigned int fixed_point_position = 4;
         shape.set(shape.num_dimensions(), batches);
@@ -61,6 +64,14 @@ public:
         library->fill_tensor_uniform(Accessor(src), 0);
     }
 
+    void pre_run()
+    {
+        if(_cache_state == CacheState::COLD)
+        {
+            flush_cpu_cache();
+        }
+    }
+
     void run()
     {
         norm_layer.run();
@@ -76,6 +87,7 @@ private:
     TensorType src{};
     TensorType dst{};
     Function   norm_layer{};
+    CacheState _cache_state{ CacheState::WARM };
 };
 } // namespace test
 } // namespace arm_compute
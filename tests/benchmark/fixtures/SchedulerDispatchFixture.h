@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_SCHEDULERDISPATCHFIXTURE
+#define ARM_COMPUTE_TEST_SCHEDULERDISPATCHFIXTURE
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "tests/framework/Fixture.h"
+
+#include <ostream>
+#include <sstream>
+#include <string>
+
+namespace arm_compute
+{
+/** Formatted output of the Scheduler::Type type. */
+inline ::std::ostream &operator<<(::std::ostream &os, Scheduler::Type type)
+{
+    switch(type)
+    {
+        case Scheduler::Type::ST:
+            os << "ST";
+            break;
+        case Scheduler::Type::CPP:
+            os << "CPP";
+            break;
+        case Scheduler::Type::OMP:
+            os << "OMP";
+            break;
+        case Scheduler::Type::CUSTOM:
+            os << "CUSTOM";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
+    }
+
+    return os;
+}
+
+inline std::string to_string(Scheduler::Type type)
+{
+    std::stringstream str;
+    str << type;
+    return str.str();
+}
+
+namespace test
+{
+/** Kernel that performs a configurable amount of busy work per window iteration.
+ *
+ * With zero work per iteration the time of a dispatch is pure scheduler
+ * overhead: waking the worker threads, splitting the window and joining.
+ */
+class SchedulerDispatchKernel : public ICPPKernel
+{
+public:
+    const char *name() const override
+    {
+        return "SchedulerDispatchKernel";
+    }
+
+    /** Set the kernel's window and the amount of work per window iteration.
+     *
+     * @param[in] window              Maximum window the kernel will be executed on.
+     * @param[in] work_per_iteration  Number of additions performed per window iteration. 0 makes the kernel empty.
+     */
+    void configure(const Window &window, unsigned int work_per_iteration)
+    {
+        _work_per_iteration = work_per_iteration;
+        ICPPKernel::configure(window);
+    }
+
+    void run(const Window &window, const ThreadInfo &info) override
+    {
+        ARM_COMPUTE_UNUSED(info);
+
+        size_t num_iterations = 1;
+        for(size_t d = 0; d < Coordinates::num_max_dimensions; ++d)
+        {
+            num_iterations *= window.num_iterations(d);
+        }
+
+        // Volatile so the busy work can't be optimised away
+        volatile size_t sink = 0;
+        for(size_t i = 0; i < num_iterations * _work_per_iteration; ++i)
+        {
+            sink += i;
+        }
+    }
+
+private:
+    unsigned int _work_per_iteration{ 0 };
+};
+
+/** Fixture measuring the dispatch cost of a scheduler implementation.
+ *
+ * Each run performs a fixed batch of dispatches so the per-dispatch cost is
+ * well above the timer resolution even for an empty kernel.
+ */
+class SchedulerDispatchFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(Scheduler::Type scheduler_type, int threads, unsigned int work_per_iteration, unsigned int split_dimension)
+    {
+        _previous_type   = Scheduler::get_type();
+        _split_dimension = split_dimension;
+
+        Scheduler::set(scheduler_type);
+        _previous_num_threads = Scheduler::get().num_threads();
+        Scheduler::get().set_num_threads(threads);
+
+        // Enough iterations along both dimensions to split evenly across 8 threads
+        Window window;
+        window.set(Window::DimX, Window::Dimension(0, 64, 1));
+        window.set(Window::DimY, Window::Dimension(0, 64, 1));
+        _kernel.configure(window, work_per_iteration);
+    }
+
+    void run()
+    {
+        for(unsigned int i = 0; i < num_dispatches; ++i)
+        {
+            Scheduler::get().schedule(&_kernel, _split_dimension);
+        }
+    }
+
+    void teardown()
+    {
+        Scheduler::get().set_num_threads(_previous_num_threads);
+        Scheduler::set(_previous_type);
+    }
+
+private:
+    static constexpr unsigned int num_dispatches = 100;
+
+    SchedulerDispatchKernel _kernel{};
+    Scheduler::Type         _previous_type{ Scheduler::Type::ST };
+    unsigned int            _previous_num_threads{ 1 };
+    unsigned int            _split_dimension{ Window::DimY };
+};
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_SCHEDULERDISPATCHFIXTURE */
@@ -0,0 +1,370 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "BaselineComparison.h"
+
+#include "Framework.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+namespace
+{
+/** Baseline statistics of one measurement */
+struct BaselineEntry
+{
+    double avg{ 0. };
+    double min{ 0. };
+    double max{ 0. };
+};
+
+using BaselineMap = std::map<std::string, std::map<std::string, BaselineEntry>>;
+
+/** Minimal recursive descent parser covering the subset of JSON the JSON printer emits */
+class JSONReader
+{
+public:
+    explicit JSONReader(const std::string &text)
+        : _text(text)
+    {
+    }
+
+    void skip_whitespace()
+    {
+        while(_pos < _text.size() && (_text[_pos] == ' ' || _text[_pos] == '\t' || _text[_pos] == '\n' || _text[_pos] == '\r'))
+        {
+            ++_pos;
+        }
+    }
+
+    char peek()
+    {
+        skip_whitespace();
+        if(_pos >= _text.size())
+        {
+            throw std::runtime_error("Unexpected end of baseline file");
+        }
+        return _text[_pos];
+    }
+
+    bool consume(char c)
+    {
+        if(peek() == c)
+        {
+            ++_pos;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c)
+    {
+        if(!consume(c))
+        {
+            throw std::runtime_error(std::string("Malformed baseline file: expected '") + c + "'");
+        }
+    }
+
+    std::string parse_string()
+    {
+        expect('"');
+        std::string value;
+        while(_pos < _text.size() && _text[_pos] != '"')
+        {
+            if(_text[_pos] == '\\' && _pos + 1 < _text.size())
+            {
+                ++_pos;
+            }
+            value += _text[_pos++];
+        }
+        expect('"');
+        return value;
+    }
+
+    double parse_number()
+    {
+        skip_whitespace();
+        size_t       end   = _pos;
+        const double value = std::stod(_text.substr(_pos), &end);
+        _pos += end;
+        return value;
+    }
+
+    /** Skips a value of any type, including nested objects and arrays */
+    void skip_value()
+    {
+        const char c = peek();
+        if(c == '"')
+        {
+            parse_string();
+        }
+        else if(c == '{')
+        {
+            expect('{');
+            if(!consume('}'))
+            {
+                do
+                {
+                    parse_string();
+                    expect(':');
+                    skip_value();
+                }
+                while(consume(','));
+                expect('}');
+            }
+        }
+        else if(c == '[')
+        {
+            expect('[');
+            if(!consume(']'))
+            {
+                do
+                {
+                    skip_value();
+                }
+                while(consume(','));
+                expect(']');
+            }
+        }
+        else
+        {
+            // Number, boolean or null
+            while(_pos < _text.size() && _text[_pos] != ',' && _text[_pos] != '}' && _text[_pos] != ']')
+            {
+                ++_pos;
+            }
+        }
+    }
+
+private:
+    const std::string &_text;
+    size_t             _pos{ 0 };
+};
+
+/** Reads the per-measurement statistics of one test */
+std::map<std::string, BaselineEntry> parse_measurements(JSONReader &reader)
+{
+    std::map<std::string, BaselineEntry> measurements;
+
+    reader.expect('{');
+    if(reader.consume('}'))
+    {
+        return measurements;
+    }
+    do
+    {
+        const std::string name = reader.parse_string();
+        reader.expect(':');
+
+        BaselineEntry entry;
+        reader.expect('{');
+        if(!reader.consume('}'))
+        {
+            do
+            {
+                const std::string field = reader.parse_string();
+                reader.expect(':');
+                if(field == "avg")
+                {
+                    entry.avg = reader.parse_number();
+                }
+                else if(field == "min")
+                {
+                    entry.min = reader.parse_number();
+                }
+                else if(field == "max")
+                {
+                    entry.max = reader.parse_number();
+                }
+                else
+                {
+                    reader.skip_value();
+                }
+            }
+            while(reader.consume(','));
+            reader.expect('}');
+        }
+
+        measurements.emplace(name, entry);
+    }
+    while(reader.consume(','));
+    reader.expect('}');
+
+    return measurements;
+}
+
+/** Extracts the "tests" section of a JSON printer output */
+BaselineMap load_baseline(const std::string &path)
+{
+    std::ifstream file(path);
+    if(!file.good())
+    {
+        throw std::runtime_error("Can't open baseline file: " + path);
+    }
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    const std::string text = buffer.str();
+
+    BaselineMap baseline;
+    JSONReader  reader(text);
+
+    reader.expect('{');
+    if(reader.consume('}'))
+    {
+        return baseline;
+    }
+    do
+    {
+        const std::string key = reader.parse_string();
+        reader.expect(':');
+        if(key != "tests")
+        {
+            reader.skip_value();
+            continue;
+        }
+
+        reader.expect('{');
+        if(reader.consume('}'))
+        {
+            continue;
+        }
+        do
+        {
+            const std::string test_name = reader.parse_string();
+            reader.expect(':');
+
+            std::map<std::string, BaselineEntry> test_measurements;
+            reader.expect('{');
+            if(!reader.consume('}'))
+            {
+                do
+                {
+                    const std::string section = reader.parse_string();
+                    reader.expect(':');
+                    if(section == "measurements")
+                    {
+                        test_measurements = parse_measurements(reader);
+                    }
+                    else
+                    {
+                        reader.skip_value();
+                    }
+                }
+                while(reader.consume(','));
+                reader.expect('}');
+            }
+
+            baseline.emplace(test_name, std::move(test_measurements));
+        }
+        while(reader.consume(','));
+        reader.expect('}');
+    }
+    while(reader.consume(','));
+
+    return baseline;
+}
+} // namespace
+
+int report_baseline_comparison(const std::string &baseline_path, double threshold_percent,
+                               const std::map<TestInfo, TestResult> &results, std::ostream &os)
+{
+    const BaselineMap baseline = load_baseline(baseline_path);
+
+    int num_regressions = 0;
+    int num_compared    = 0;
+
+    os << std::fixed << std::setprecision(2);
+
+    for(const auto &test : results)
+    {
+        const auto baseline_test = baseline.find(test.first.name);
+        if(baseline_test == baseline.end())
+        {
+            continue;
+        }
+
+        for(const auto &measurement : test.second.measurements)
+        {
+            const auto baseline_measurement = baseline_test->second.find(measurement.first);
+            if(baseline_measurement == baseline_test->second.end() || measurement.second.empty())
+            {
+                continue;
+            }
+
+            const BaselineEntry &base = baseline_measurement->second;
+            if(base.avg <= 0.)
+            {
+                continue;
+            }
+
+            double current_avg = 0.;
+            for(const auto &value : measurement.second)
+            {
+                current_avg += value.value;
+            }
+            current_avg /= measurement.second.size();
+
+            // Allow the requested threshold plus half the baseline's own
+            // relative spread, so inherently noisy benchmarks don't trip
+            // the gate on every run
+            const double noise   = (base.max - base.min) / base.avg;
+            const double allowed = threshold_percent / 100. + 0.5 * noise;
+            const double delta   = (current_avg - base.avg) / base.avg;
+
+            ++num_compared;
+
+            const char *verdict = "OK";
+            if(delta > allowed)
+            {
+                verdict = "REGRESSION";
+                ++num_regressions;
+            }
+            else if(delta < -allowed)
+            {
+                verdict = "IMPROVEMENT";
+            }
+
+            os << verdict << ": " << test.first.name << " / " << measurement.first
+               << ": " << base.avg << " -> " << current_avg
+               << " (" << (delta >= 0. ? "+" : "") << delta * 100. << "%, allowed +" << allowed * 100. << "%)\n";
+        }
+    }
+
+    os << "Compared " << num_compared << " measurements against " << baseline_path
+       << ": " << num_regressions << " regression(s)\n";
+
+    return num_regressions;
+}
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
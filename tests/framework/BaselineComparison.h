@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_BASELINE_COMPARISON
+#define ARM_COMPUTE_TEST_BASELINE_COMPARISON
+
+#include "TestResult.h"
+
+#include <map>
+#include <ostream>
+#include <string>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+struct TestInfo;
+
+/** Compares the measurements of a run against the JSON output of a previous run.
+ *
+ * Loads the baseline produced by the JSON printer and reports, per benchmark
+ * and measurement, the relative delta against the baseline average. A delta
+ * only counts as a regression when it exceeds the given threshold plus half
+ * the baseline's own relative spread, so noisy benchmarks do not trip the
+ * gate on every run. All measurements are treated as lower-is-better, which
+ * holds for the time, cycle and byte counts the instruments produce.
+ *
+ * @param[in]  baseline_path     Path to the baseline JSON file.
+ * @param[in]  threshold_percent Minimum relative increase (in percent) treated as a regression.
+ * @param[in]  results           Results of the current run.
+ * @param[out] os                Stream the comparison report is written to.
+ *
+ * @return Number of detected regressions.
+ */
+int report_baseline_comparison(const std::string &baseline_path, double threshold_percent,
+                               const std::map<TestInfo, TestResult> &results, std::ostream &os);
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_BASELINE_COMPARISON */
@@ -47,6 +47,14 @@ public:
      */
     void setup() {};
 
+    /** Hook executed before each iteration of the test case.
+     *
+     * Runs outside of the profiled section, so it can restore a
+     * well-defined machine state (e.g. cold caches) without the time it
+     * takes being attributed to the test.
+     */
+    void pre_run() {};
+
     /** Teardown function.
      *
      * The function is called after the test case finished.
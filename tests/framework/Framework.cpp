@@ -30,9 +30,14 @@
 #include "arm_compute/runtime/CL/CLScheduler.h"
 #endif /* ARM_COMPUTE_CL */
 
+#include <algorithm>
 #include <chrono>
+#include <condition_variable>
+#include <exception>
 #include <iostream>
+#include <mutex>
 #include <sstream>
+#include <thread>
 #include <type_traits>
 
 namespace arm_compute
@@ -44,12 +49,17 @@ namespace framework
 Framework::Framework()
 {
     _available_instruments.emplace(InstrumentType::WALL_CLOCK_TIMER, Instrument::make_instrument<WallClockTimer>);
+    _available_instruments.emplace(InstrumentType::MEMORY_USAGE, Instrument::make_instrument<MemoryUsage>);
+    _available_instruments.emplace(InstrumentType::SCHEDULER_TIMER, Instrument::make_instrument<SchedulerTimer>);
 #ifdef PMU_ENABLED
     _available_instruments.emplace(InstrumentType::PMU, Instrument::make_instrument<PMUCounter>);
 #endif /* PMU_ENABLED */
 #ifdef MALI_ENABLED
     _available_instruments.emplace(InstrumentType::MALI, Instrument::make_instrument<MaliCounter>);
 #endif /* MALI_ENABLED */
+#ifdef ARM_COMPUTE_CL
+    _available_instruments.emplace(InstrumentType::OPENCL_TIMER, Instrument::make_instrument<OpenCLTimer>);
+#endif /* ARM_COMPUTE_CL */
 }
 
 std::set<InstrumentType> Framework::available_instruments() const
@@ -196,6 +206,17 @@ void Framework::set_num_iterations(int num_iterations)
     _num_iterations = num_iterations;
 }
 
+int Framework::num_streams() const
+{
+    return _num_streams;
+}
+
+void Framework::set_num_streams(int num_streams)
+{
+    ARM_COMPUTE_ERROR_ON(num_streams < 1);
+    _num_streams = num_streams;
+}
+
 void Framework::set_throw_errors(bool throw_errors)
 {
     _throw_errors = throw_errors;
@@ -226,6 +247,118 @@ bool Framework::error_on_missing_assets() const
     return _error_on_missing_assets;
 }
 
+Profiler::MeasurementsMap Framework::run_test_streams(TestCaseFactory &test_factory)
+{
+    // Each stream gets its own test case instance and therefore its own
+    // tensors; the scheduler is shared so the streams contend for the same
+    // cores, like concurrently served inference requests would.
+    std::vector<std::unique_ptr<TestCase>> streams;
+
+    const auto setup_start = std::chrono::high_resolution_clock::now();
+
+    for(int i = 0; i < _num_streams; ++i)
+    {
+        streams.emplace_back(test_factory.make());
+        streams.back()->do_setup();
+    }
+
+    const auto setup_end = std::chrono::high_resolution_clock::now();
+
+    std::vector<std::vector<double>> latencies_us(_num_streams);
+    std::vector<std::exception_ptr>  errors(_num_streams);
+
+    std::mutex              mutex;
+    std::condition_variable condition;
+    int                     num_ready = 0;
+    bool                    start     = false;
+
+    auto stream_main = [&](int stream_id)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            ++num_ready;
+            condition.notify_all();
+            condition.wait(lock, [&]
+            {
+                return start;
+            });
+        }
+
+        try
+        {
+            for(int i = 0; i < _num_iterations; ++i)
+            {
+                const auto begin = std::chrono::high_resolution_clock::now();
+                streams[stream_id]->do_run();
+                const auto end = std::chrono::high_resolution_clock::now();
+
+                latencies_us[stream_id].push_back(std::chrono::duration<double, std::micro>(end - begin).count());
+            }
+        }
+        catch(...)
+        {
+            errors[stream_id] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+
+    for(int i = 0; i < _num_streams; ++i)
+    {
+        threads.emplace_back(stream_main, i);
+    }
+
+    std::chrono::time_point<std::chrono::high_resolution_clock> run_start;
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [&]
+        {
+            return num_ready == _num_streams;
+        });
+
+        run_start = std::chrono::high_resolution_clock::now();
+        start     = true;
+        condition.notify_all();
+    }
+
+    for(auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    const double wall_seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - run_start).count();
+
+    for(auto &error : errors)
+    {
+        if(error != nullptr)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    for(auto &stream : streams)
+    {
+        stream->do_teardown();
+    }
+
+    Profiler::MeasurementsMap measurements;
+    measurements["Setup/Wall clock time"].emplace_back(std::chrono::duration<double, std::micro>(setup_end - setup_start).count(), "us");
+    measurements["Streams/Throughput"].emplace_back(_num_streams * _num_iterations / wall_seconds, "items/s");
+
+    for(int i = 0; i < _num_streams; ++i)
+    {
+        std::vector<double> &latencies = latencies_us[i];
+        std::sort(latencies.begin(), latencies.end());
+
+        const size_t p95_index = (latencies.size() * 95 + 99) / 100;
+
+        measurements["Streams/Stream #" + support::cpp11::to_string(i) + " p95 latency"].emplace_back(latencies[(p95_index > 0) ? p95_index - 1 : 0], "us");
+    }
+
+    return measurements;
+}
+
 void Framework::run_test(const TestInfo &info, TestCaseFactory &test_factory)
 {
     if(test_factory.status() == TestCaseFactory::Status::DISABLED)
@@ -252,26 +385,48 @@ void Framework::run_test(const TestInfo &info, TestCaseFactory &test_factory)
 
     try
     {
-        std::unique_ptr<TestCase> test_case = test_factory.make();
-
         try
         {
-            test_case->do_setup();
-
-            for(int i = 0; i < _num_iterations; ++i)
+            if(_num_streams > 1)
+            {
+                result.measurements = run_test_streams(test_factory);
+            }
+            else
             {
-                profiler.start();
-                test_case->do_run();
+                std::unique_ptr<TestCase> test_case = test_factory.make();
+
+                // Time-to-first-inference is dominated by the setup phase
+                // (configure(), CL program builds, allocations), so report it
+                // alongside the run measurements to catch regressions there
+                const auto setup_start = std::chrono::high_resolution_clock::now();
+                test_case->do_setup();
 #ifdef ARM_COMPUTE_CL
                 if(opencl_is_available())
                 {
                     CLScheduler::get().sync();
                 }
 #endif /* ARM_COMPUTE_CL */
-                profiler.stop();
-            }
+                const auto setup_end = std::chrono::high_resolution_clock::now();
+
+                for(int i = 0; i < _num_iterations; ++i)
+                {
+                    test_case->do_pre_run();
+                    profiler.start();
+                    test_case->do_run();
+#ifdef ARM_COMPUTE_CL
+                    if(opencl_is_available())
+                    {
+                        CLScheduler::get().sync();
+                    }
+#endif /* ARM_COMPUTE_CL */
+                    profiler.stop();
+                }
+
+                test_case->do_teardown();
 
-            test_case->do_teardown();
+                result.measurements = profiler.measurements();
+                result.measurements["Setup/Wall clock time"].emplace_back(std::chrono::duration<double, std::micro>(setup_end - setup_start).count(), "us");
+            }
 
             // Change status to success if no error has happend
             if(result.status == TestResult::Status::NOT_RUN)
@@ -421,8 +576,6 @@ void Framework::run_test(const TestInfo &info, TestCaseFactory &test_factory)
         }
     }
 
-    result.measurements = profiler.measurements();
-
     set_test_result(info, result);
     log_test_end(info);
 }
@@ -479,6 +632,11 @@ bool Framework::run()
     return (static_cast<unsigned int>(num_successful_tests) == _test_results.size());
 }
 
+const std::map<TestInfo, TestResult> &Framework::test_results() const
+{
+    return _test_results;
+}
+
 void Framework::set_test_result(TestInfo info, TestResult result)
 {
     _test_results.emplace(std::move(info), std::move(result));
@@ -209,6 +209,23 @@ public:
      */
     void set_num_iterations(int num_iterations);
 
+    /** Number of concurrent streams each test is run with.
+     *
+     * @return Number of streams.
+     */
+    int num_streams() const;
+
+    /** Set the number of concurrent streams.
+     *
+     * With more than one stream every benchmark runs as that many
+     * concurrently executing instances (with separate tensors) sharing the
+     * scheduler, and reports aggregate throughput and per-stream latency
+     * instead of the configured instruments' measurements.
+     *
+     * @param[in] num_streams Number of streams.
+     */
+    void set_num_streams(int num_streams);
+
     /** Should errors be caught or thrown by the framework.
      *
      * @return True if errors are thrown.
@@ -294,6 +311,12 @@ public:
      */
     LogLevel log_level() const;
 
+    /** Results of the last run, keyed by test info.
+     *
+     * @return Map of test results.
+     */
+    const std::map<TestInfo, TestResult> &test_results() const;
+
 private:
     Framework();
     ~Framework() = default;
@@ -302,6 +325,7 @@ private:
     Framework &operator=(const Framework &) = delete;
 
     void run_test(const TestInfo &info, TestCaseFactory &test_factory);
+    Profiler::MeasurementsMap run_test_streams(TestCaseFactory &test_factory);
     std::map<TestResult::Status, int> count_test_results() const;
 
     /** Returns the current test suite name.
@@ -318,6 +342,7 @@ private:
     std::vector<std::unique_ptr<TestCaseFactory>> _test_factories{};
     std::map<TestInfo, TestResult> _test_results{};
     int      _num_iterations{ 1 };
+    int      _num_streams{ 1 };
     bool     _throw_errors{ false };
     bool     _stop_on_error{ false };
     bool     _error_on_missing_assets{ false };
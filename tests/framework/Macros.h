@@ -109,6 +109,11 @@
     {                                               \
         apply(this, &FIXTURE::setup<As...>, _data); \
     }
+#define FIXTURE_PRE_RUN(FIXTURE) \
+    void do_pre_run() override   \
+    {                            \
+        FIXTURE::pre_run();      \
+    }
 #define FIXTURE_RUN(FIXTURE) \
     void do_run() override   \
     {                        \
@@ -222,6 +227,7 @@
     public:                                                                     \
         TEST_CASE_CONSTRUCTOR(TEST_NAME)                                            \
         FIXTURE_SETUP(FIXTURE)                                                      \
+        FIXTURE_PRE_RUN(FIXTURE)                                                    \
         FIXTURE_RUN(FIXTURE)                                                        \
         FIXTURE_TEARDOWN(FIXTURE)                                                   \
     };                                                                              \
@@ -243,6 +249,7 @@
     public:                                                                                                                     \
         DATA_TEST_CASE_CONSTRUCTOR(TEST_NAME, DATASET)                                                                              \
         FIXTURE_DATA_SETUP(FIXTURE)                                                                                                 \
+        FIXTURE_PRE_RUN(FIXTURE)                                                                                                    \
         FIXTURE_RUN(FIXTURE)                                                                                                        \
         FIXTURE_TEARDOWN(FIXTURE)                                                                                                   \
     };                                                                                                                              \
@@ -41,6 +41,7 @@ class TestCase
 {
 public:
     virtual void do_setup() {};
+    virtual void do_pre_run() {};
     virtual void do_run() {};
     virtual void do_teardown() {};
 
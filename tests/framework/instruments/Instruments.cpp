@@ -45,6 +45,9 @@ InstrumentType instrument_type_from_name(const std::string &name)
         { "pmu_cycles", InstrumentType::PMU_CYCLE_COUNTER },
         { "pmu_instructions", InstrumentType::PMU_INSTRUCTION_COUNTER },
         { "mali", InstrumentType::MALI },
+        { "opencl_timer", InstrumentType::OPENCL_TIMER },
+        { "memory_usage", InstrumentType::MEMORY_USAGE },
+        { "scheduler_timer", InstrumentType::SCHEDULER_TIMER },
     };
 
     try
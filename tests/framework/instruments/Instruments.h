@@ -25,8 +25,13 @@
 #define ARM_COMPUTE_TEST_INSTRUMENTS
 
 #include "MaliCounter.h"
+#include "MemoryUsage.h"
 #include "PMUCounter.h"
+#include "SchedulerTimer.h"
 #include "WallClockTimer.h"
+#ifdef ARM_COMPUTE_CL
+#include "OpenCLTimer.h"
+#endif /* ARM_COMPUTE_CL */
 
 #include <sstream>
 #include <string>
@@ -46,6 +51,9 @@ enum class InstrumentType : unsigned int
     PMU_CYCLE_COUNTER       = 0x0201,
     PMU_INSTRUCTION_COUNTER = 0x0202,
     MALI                    = 0x0300,
+    OPENCL_TIMER            = 0x0400,
+    MEMORY_USAGE            = 0x0500,
+    SCHEDULER_TIMER         = 0x0600,
 };
 
 InstrumentType instrument_type_from_name(const std::string &name);
@@ -77,6 +85,15 @@ inline ::std::stringstream &operator<<(::std::stringstream &stream, InstrumentTy
         case InstrumentType::MALI:
             stream << "MALI";
             break;
+        case InstrumentType::OPENCL_TIMER:
+            stream << "OPENCL_TIMER";
+            break;
+        case InstrumentType::MEMORY_USAGE:
+            stream << "MEMORY_USAGE";
+            break;
+        case InstrumentType::SCHEDULER_TIMER:
+            stream << "SCHEDULER_TIMER";
+            break;
         case InstrumentType::ALL:
             stream << "ALL";
             break;
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "MemoryUsage.h"
+
+#include "arm_compute/runtime/MemoryTracker.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+std::string MemoryUsage::id() const
+{
+    return "Memory Usage";
+}
+
+void MemoryUsage::start()
+{
+    // Restart the high-water mark so only this measurement's allocations can raise it
+    MemoryTracker::get().reset_peak();
+}
+
+void MemoryUsage::stop()
+{
+    _live_bytes = MemoryTracker::get().live_bytes();
+    _peak_bytes = MemoryTracker::get().peak_bytes();
+}
+
+Instrument::MeasurementsMap MemoryUsage::measurements() const
+{
+    return MeasurementsMap
+    {
+        { "Live memory", Measurement(_live_bytes, "bytes") },
+        { "Peak memory", Measurement(_peak_bytes, "bytes") },
+    };
+}
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
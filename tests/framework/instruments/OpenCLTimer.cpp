@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "OpenCLTimer.h"
+
+#include "arm_compute/runtime/CL/CLScheduler.h"
+#include "support/ToolchainSupport.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+namespace
+{
+OpenCLTimer                           *active_timer = nullptr;
+CLSymbols::clEnqueueNDRangeKernel_func real_enqueue = nullptr;
+
+/** Forwards to the real clEnqueueNDRangeKernel, attaching a profiling event to every enqueue */
+cl_int profiling_enqueue_ndrange_kernel(cl_command_queue command_queue, cl_kernel kernel, cl_uint work_dim,
+                                        const size_t *global_work_offset, const size_t *global_work_size, const size_t *local_work_size,
+                                        cl_uint num_events_in_wait_list, const cl_event *event_wait_list, cl_event *event)
+{
+    // Attach an event if the caller did not ask for one
+    cl_event  profiling_event = nullptr;
+    cl_event *event_ptr       = (event != nullptr) ? event : &profiling_event;
+
+    const cl_int error = real_enqueue(command_queue, kernel, work_dim, global_work_offset, global_work_size, local_work_size, num_events_in_wait_list, event_wait_list, event_ptr);
+
+    if(error == CL_SUCCESS && active_timer != nullptr)
+    {
+        // Retain only when the caller keeps its own reference to the event
+        const bool caller_owns_event = (event != nullptr);
+        active_timer->add_kernel(kernel, ::cl::Event(*event_ptr, caller_owns_event));
+    }
+
+    return error;
+}
+} // namespace
+
+OpenCLTimer::OpenCLTimer()
+{
+    // The scheduler queue must collect profiling information for the events to carry timestamps
+    auto                       &scheduler  = CLScheduler::get();
+    cl_command_queue_properties properties = scheduler.queue().getInfo<CL_QUEUE_PROPERTIES>();
+    if((properties & CL_QUEUE_PROFILING_ENABLE) == 0)
+    {
+        scheduler.set_queue(::cl::CommandQueue(scheduler.context(), properties | CL_QUEUE_PROFILING_ENABLE));
+    }
+}
+
+std::string OpenCLTimer::id() const
+{
+    return "OpenCL Timer";
+}
+
+void OpenCLTimer::start()
+{
+    _kernels.clear();
+
+    // Intercept kernel enqueues for the duration of the measurement
+    CLSymbols::get().load_default();
+    real_enqueue                            = CLSymbols::get().clEnqueueNDRangeKernel;
+    CLSymbols::get().clEnqueueNDRangeKernel = profiling_enqueue_ndrange_kernel;
+    active_timer                            = this;
+}
+
+void OpenCLTimer::stop()
+{
+    // Restore the real enqueue function before anything else runs on the queue
+    active_timer                            = nullptr;
+    CLSymbols::get().clEnqueueNDRangeKernel = real_enqueue;
+
+    // The framework syncs the scheduler before stopping the instruments, but
+    // sync again in case the instrument is used standalone
+    CLScheduler::get().sync();
+}
+
+void OpenCLTimer::add_kernel(cl_kernel kernel, const ::cl::Event &event)
+{
+    const std::string name = ::cl::Kernel(kernel, true).getInfo<CL_KERNEL_FUNCTION_NAME>();
+    _kernels.push_back(kernel_info{ name, event });
+}
+
+Instrument::MeasurementsMap OpenCLTimer::measurements() const
+{
+    MeasurementsMap measurements;
+
+    unsigned int kernel_number = 0;
+    for(const auto &kernel : _kernels)
+    {
+        const cl_ulong start = kernel.event.getProfilingInfo<CL_PROFILING_COMMAND_START>();
+        const cl_ulong end   = kernel.event.getProfilingInfo<CL_PROFILING_COMMAND_END>();
+
+        // The profiling timestamps are in nanoseconds
+        measurements.emplace(kernel.name + " #" + support::cpp11::to_string(kernel_number++), Measurement((end - start) / 1000.0, "us"));
+    }
+
+    return measurements;
+}
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
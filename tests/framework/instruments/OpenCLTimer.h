@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_OPENCL_TIMER
+#define ARM_COMPUTE_TEST_OPENCL_TIMER
+
+#include "Instrument.h"
+
+#include "arm_compute/core/CL/OpenCL.h"
+
+#include <list>
+#include <string>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+/** Instrument measuring device-side kernel execution time through OpenCL event profiling.
+ *
+ * Enables CL_QUEUE_PROFILING_ENABLE on the CLScheduler queue and intercepts
+ * every kernel enqueue between @ref start and @ref stop to collect the
+ * device start/end timestamps of each kernel, free of the queue submission
+ * and driver overhead a host-side wall clock folds in.
+ */
+class OpenCLTimer : public Instrument
+{
+public:
+    /** Default constructor. Swaps the scheduler queue for a profiling-enabled one if needed. */
+    OpenCLTimer();
+
+    std::string     id() const override;
+    void            start() override;
+    void            stop() override;
+    MeasurementsMap measurements() const override;
+
+    /** Record an enqueued kernel and the event profiling it.
+     *
+     * Called by the interception hook installed by @ref start.
+     *
+     * @param[in] kernel Enqueued kernel.
+     * @param[in] event  Event attached to the kernel enqueue.
+     */
+    void add_kernel(cl_kernel kernel, const ::cl::Event &event);
+
+private:
+    struct kernel_info
+    {
+        std::string name;  /**< Kernel function name */
+        ::cl::Event event; /**< Event profiling the kernel's execution */
+    };
+    std::list<kernel_info> _kernels{};
+};
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_OPENCL_TIMER */
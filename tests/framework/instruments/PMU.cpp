@@ -66,6 +66,13 @@ void PMU::open(uint64_t config)
     open(_perf_config);
 }
 
+void PMU::open(uint32_t type, uint64_t config)
+{
+    _perf_config.type   = type;
+    _perf_config.config = config;
+    open(_perf_config);
+}
+
 void PMU::open(const perf_event_attr &perf_config)
 {
     // Measure this process/thread (+ children) on any CPU
@@ -66,6 +66,13 @@ public:
     /** Open the specified counter based on the default configuration. */
     void open(uint64_t config);
 
+    /** Open the specified counter of the given event type.
+     *
+     * @param[in] type   Event type (e.g. PERF_TYPE_HW_CACHE).
+     * @param[in] config Counter identifier.
+     */
+    void open(uint32_t type, uint64_t config);
+
     /** Open the specified configuration. */
     void open(const perf_event_attr &perf_config);
 
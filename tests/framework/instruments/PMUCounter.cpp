@@ -29,6 +29,48 @@ namespace test
 {
 namespace framework
 {
+namespace
+{
+/** Builds a PERF_TYPE_HW_CACHE event identifier from its cache, operation and result parts */
+uint64_t cache_event(uint64_t cache_id, uint64_t op_id, uint64_t result_id)
+{
+    return cache_id | (op_id << 8) | (result_id << 16);
+}
+} // namespace
+
+PMUCounter::PMUCounter()
+{
+    // Distinguishing frontend-bound from cache-bound regressions needs the
+    // refill and branch miss events, but they are not exposed by every
+    // kernel/core combination: failing to open one only drops its measurement
+    try
+    {
+        _pmu_l1d_refills.open(PERF_TYPE_HW_CACHE, cache_event(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS));
+        _has_l1d_refills = true;
+    }
+    catch(const std::runtime_error &)
+    {
+    }
+
+    try
+    {
+        _pmu_l2_refills.open(PERF_TYPE_HW_CACHE, cache_event(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS));
+        _has_l2_refills = true;
+    }
+    catch(const std::runtime_error &)
+    {
+    }
+
+    try
+    {
+        _pmu_branch_misses.open(PERF_COUNT_HW_BRANCH_MISSES);
+        _has_branch_misses = true;
+    }
+    catch(const std::runtime_error &)
+    {
+    }
+}
+
 std::string PMUCounter::id() const
 {
     return "PMU Counter";
@@ -38,6 +80,21 @@ void PMUCounter::start()
 {
     _pmu_cycles.reset();
     _pmu_instructions.reset();
+
+    if(_has_l1d_refills)
+    {
+        _pmu_l1d_refills.reset();
+    }
+
+    if(_has_l2_refills)
+    {
+        _pmu_l2_refills.reset();
+    }
+
+    if(_has_branch_misses)
+    {
+        _pmu_branch_misses.reset();
+    }
 }
 
 void PMUCounter::stop()
@@ -59,15 +116,59 @@ void PMUCounter::stop()
     {
         _instructions = 0;
     }
+
+    try
+    {
+        _l1d_refills = _has_l1d_refills ? _pmu_l1d_refills.get_value<long long>() : 0;
+    }
+    catch(const std::runtime_error &)
+    {
+        _l1d_refills = 0;
+    }
+
+    try
+    {
+        _l2_refills = _has_l2_refills ? _pmu_l2_refills.get_value<long long>() : 0;
+    }
+    catch(const std::runtime_error &)
+    {
+        _l2_refills = 0;
+    }
+
+    try
+    {
+        _branch_misses = _has_branch_misses ? _pmu_branch_misses.get_value<long long>() : 0;
+    }
+    catch(const std::runtime_error &)
+    {
+        _branch_misses = 0;
+    }
 }
 
 Instrument::MeasurementsMap PMUCounter::measurements() const
 {
-    return MeasurementsMap
+    MeasurementsMap measurements
     {
         { "CPU cycles", Measurement(_cycles, "cycles") },
         { "CPU instructions", Measurement(_instructions, "instructions") },
     };
+
+    if(_has_l1d_refills)
+    {
+        measurements.emplace("L1D cache refills", Measurement(_l1d_refills, "refills"));
+    }
+
+    if(_has_l2_refills)
+    {
+        measurements.emplace("L2 cache refills", Measurement(_l2_refills, "refills"));
+    }
+
+    if(_has_branch_misses)
+    {
+        measurements.emplace("Branch misses", Measurement(_branch_misses, "misses"));
+    }
+
+    return measurements;
 }
 } // namespace framework
 } // namespace test
@@ -33,10 +33,18 @@ namespace test
 {
 namespace framework
 {
-/** Implementation of an instrument to count CPU cycles. */
+/** Implementation of an instrument to count CPU cycles, instructions, cache refills and branch misses. */
 class PMUCounter : public Instrument
 {
 public:
+    /** Default constructor.
+     *
+     * The cycle and instruction counters are always available; the cache
+     * refill and branch miss counters are opened on a best effort basis as
+     * not every kernel/core combination exposes them.
+     */
+    PMUCounter();
+
     std::string     id() const override;
     void            start() override;
     void            stop() override;
@@ -45,8 +53,17 @@ public:
 private:
     PMU       _pmu_cycles{ PERF_COUNT_HW_CPU_CYCLES };
     PMU       _pmu_instructions{ PERF_COUNT_HW_INSTRUCTIONS };
+    PMU       _pmu_l1d_refills{};
+    PMU       _pmu_l2_refills{};
+    PMU       _pmu_branch_misses{};
     long long _cycles{ 0 };
     long long _instructions{ 0 };
+    long long _l1d_refills{ 0 };
+    long long _l2_refills{ 0 };
+    long long _branch_misses{ 0 };
+    bool      _has_l1d_refills{ false };
+    bool      _has_l2_refills{ false };
+    bool      _has_branch_misses{ false };
 };
 } // namespace framework
 } // namespace test
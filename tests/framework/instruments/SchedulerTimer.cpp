@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "SchedulerTimer.h"
+
+#include "arm_compute/runtime/Scheduler.h"
+
+#include <map>
+#include <string>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+std::string SchedulerTimer::id() const
+{
+    return "Scheduler Timer";
+}
+
+void SchedulerTimer::start()
+{
+    _events.clear();
+
+    // Discard events recorded outside the measurement
+    Scheduler::get().set_telemetry_enabled(true);
+    Scheduler::get().drain_telemetry();
+}
+
+void SchedulerTimer::stop()
+{
+    _events = Scheduler::get().drain_telemetry();
+    Scheduler::get().set_telemetry_enabled(false);
+}
+
+Instrument::MeasurementsMap SchedulerTimer::measurements() const
+{
+    // Each dispatch produces one event per thread; dividing every thread's
+    // share by the thread count of its dispatch approximates the wall time
+    // the kernel kept the scheduler busy
+    std::map<std::string, double> time_per_kernel;
+    for(const auto &event : _events)
+    {
+        if(event.kernel_name == nullptr || event.num_threads <= 0)
+        {
+            continue;
+        }
+        time_per_kernel[event.kernel_name] += static_cast<double>(event.end_ns - event.start_ns) / event.num_threads;
+    }
+
+    MeasurementsMap measurements;
+    for(const auto &kernel : time_per_kernel)
+    {
+        measurements.emplace(kernel.first, Measurement(kernel.second / 1000.0, "us"));
+    }
+
+    return measurements;
+}
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
@@ -27,6 +27,7 @@
 #include "../instruments/Measurement.h"
 
 #include <algorithm>
+#include <vector>
 
 namespace arm_compute
 {
@@ -189,7 +190,20 @@ void JSONPrinter::print_measurements(const Profiler::MeasurementsMap &measuremen
             return support::cpp11::to_string(measurement.value);
         };
 
+        // Median and 95th percentile over all iterations, for gating that
+        // should not be thrown off by a single outlier
+        std::vector<Measurement> sorted_values(i_it->second.cbegin(), i_it->second.cend());
+        std::sort(sorted_values.begin(), sorted_values.end(), cmp_measurements);
+
+        const size_t num_sorted = sorted_values.size();
+        const double median     = (num_sorted % 2 == 0) ? (sorted_values[num_sorted / 2 - 1].value + sorted_values[num_sorted / 2].value) / 2.
+                                  : sorted_values[num_sorted / 2].value;
+        const size_t p95_index  = (num_sorted * 95 + 99) / 100;
+        const double p95        = sorted_values[(p95_index > 0) ? p95_index - 1 : 0].value;
+
         *_stream << R"("avg" : )" << (sum_values / num_values) << ",";
+        *_stream << R"("median" : )" << median << ",";
+        *_stream << R"("p95" : )" << p95 << ",";
         *_stream << R"("min" : )" << minmax_values.first->value << ",";
         *_stream << R"("max" : )" << minmax_values.second->value << ",";
         *_stream << R"("raw" : [)" << join(i_it->second.begin(), i_it->second.end(), ",", measurement_to_string) << "],";
@@ -23,6 +23,7 @@
  */
 #include "support/ToolchainSupport.h"
 #include "tests/AssetsLibrary.h"
+#include "tests/framework/BaselineComparison.h"
 #include "tests/framework/DatasetModes.h"
 #include "tests/framework/Exceptions.h"
 #include "tests/framework/Framework.h"
@@ -36,6 +37,7 @@
 #ifdef ARM_COMPUTE_CL
 #include "arm_compute/runtime/CL/CLScheduler.h"
 #endif /* ARM_COMPUTE_CL */
+#include "arm_compute/core/CPP/CPPTypes.h"
 #include "arm_compute/runtime/Scheduler.h"
 
 #include <fstream>
@@ -112,6 +114,8 @@ int main(int argc, char **argv)
     iterations->set_help("Number of iterations per test case");
     auto threads = parser.add_option<framework::SimpleOption<int>>("threads", 1);
     threads->set_help("Number of threads to use");
+    auto streams = parser.add_option<framework::SimpleOption<int>>("streams", 1);
+    streams->set_help("Number of concurrent instances each benchmark is run with");
     auto log_format = parser.add_option<framework::EnumOption<framework::LogFormat>>("log-format", supported_log_formats, framework::LogFormat::PRETTY);
     log_format->set_help("Output format for measurements and failures");
     auto filter = parser.add_option<framework::SimpleOption<std::string>>("filter", ".*");
@@ -136,6 +140,10 @@ int main(int argc, char **argv)
     test_instruments->set_help("Test if the instruments work on the platform");
     auto error_on_missing_assets = parser.add_option<framework::ToggleOption>("error-on-missing-assets", false);
     error_on_missing_assets->set_help("Mark a test as failed instead of skipping it when assets are missing");
+    auto baseline = parser.add_option<framework::SimpleOption<std::string>>("baseline");
+    baseline->set_help("Compare measurements against the JSON output of a previous run");
+    auto baseline_threshold = parser.add_option<framework::SimpleOption<double>>("baseline-threshold", 5.);
+    baseline_threshold->set_help("Relative increase (in percent) over the baseline treated as a regression");
     auto assets = parser.add_positional_option<framework::SimpleOption<std::string>>("assets");
     assets->set_help("Path to the assets directory");
 
@@ -190,13 +198,27 @@ int main(int argc, char **argv)
             printer->print_entry("Seed", support::cpp11::to_string(seed->value()));
             printer->print_entry("Iterations", support::cpp11::to_string(iterations->value()));
             printer->print_entry("Threads", support::cpp11::to_string(threads->value()));
+            printer->print_entry("Streams", support::cpp11::to_string(streams->value()));
             {
                 using support::cpp11::to_string;
                 printer->print_entry("Dataset mode", to_string(dataset_mode->value()));
             }
+
+            const CPUInfo cpu_info = Scheduler::get().cpu_info();
+            printer->print_entry("CPU target", support::cpp11::to_string(static_cast<unsigned int>(cpu_info.CPU)));
+            printer->print_entry("CPU L1 cache", support::cpp11::to_string(cpu_info.L1_size));
+            printer->print_entry("CPU L2 cache", support::cpp11::to_string(cpu_info.L2_size));
+            printer->print_entry("CPU fp16", cpu_has_fp16(cpu_info) ? "true" : "false");
+#ifdef ARM_COMPUTE_CL
+            if(opencl_is_available())
+            {
+                printer->print_entry("GPU target", support::cpp11::to_string(static_cast<int>(CLScheduler::get().target())));
+            }
+#endif /* ARM_COMPUTE_CL */
         }
 
         framework.init(instruments->value(), iterations->value(), dataset_mode->value(), filter->value(), filter_id->value(), log_level->value());
+        framework.set_num_streams(streams->value());
         framework.set_printer(printer.get());
         framework.set_throw_errors(throw_errors->value());
         framework.set_stop_on_error(stop_on_error->value());
@@ -235,6 +257,13 @@ int main(int argc, char **argv)
 
         success = framework.run();
 
+        if(baseline->is_set())
+        {
+            // Written to stderr so a JSON log on stdout stays parseable
+            const int num_regressions = framework::report_baseline_comparison(baseline->value(), baseline_threshold->value(), framework.test_results(), std::cerr);
+            success                   = success && (num_regressions == 0);
+        }
+
         if(log_level->value() > framework::LogLevel::NONE)
         {
             printer->print_global_footer();
@@ -72,6 +72,23 @@ const auto data_f32 = combine(datasets::SmallDirectConvolutionShapes(),
                                               combine(data_pad_f32,
                                                       framework::dataset::make("NumKernels", { 1, 4, 8, 16 })))));
 
+/** Direct convolution data set for the configurations only supported for F32: 7x7 kernels and stride 4. */
+const auto data_pad_f32_7x7 = combine(framework::dataset::make("PadX", 0, 4),
+                                      combine(framework::dataset::make("PadY", 0, 4),
+                                              framework::dataset::make("KernelSize", 7)));
+
+const auto data_f32_7x7 = combine(datasets::SmallDirectConvolutionShapes(),
+                                  combine(framework::dataset::make("StrideX", 1, 5),
+                                          combine(framework::dataset::make("StrideY", 1, 5),
+                                                  combine(data_pad_f32_7x7,
+                                                          framework::dataset::make("NumKernels", { 1, 4 })))));
+
+const auto data_f32_stride4 = combine(datasets::SmallDirectConvolutionShapes(),
+                                      combine(framework::dataset::make("StrideX", { 4 }),
+                                              combine(framework::dataset::make("StrideY", { 4 }),
+                                                      combine(data_pad_f32,
+                                                              framework::dataset::make("NumKernels", { 1, 4 })))));
+
 const auto data_qs8 = combine(datasets::SmallDirectConvolutionShapes(),
                               combine(framework::dataset::make("StrideX", 1, 3),
                                       combine(framework::dataset::make("StrideY", 1, 3),
@@ -111,6 +128,16 @@ FIXTURE_DATA_TEST_CASE(Run, NEDirectConvolutionLayerFixture<float>, framework::D
     // Validate output
     validate(Accessor(_target), _reference, tolerance_fp32);
 }
+FIXTURE_DATA_TEST_CASE(Run7x7, NEDirectConvolutionLayerFixture<float>, framework::DatasetMode::ALL, combine(data_f32_7x7, framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+FIXTURE_DATA_TEST_CASE(RunStride4, NEDirectConvolutionLayerFixture<float>, framework::DatasetMode::ALL, combine(data_f32_stride4, framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
 TEST_SUITE_END()
 TEST_SUITE_END()
 
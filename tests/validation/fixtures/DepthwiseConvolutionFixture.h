@@ -79,7 +79,7 @@ protected:
 
         // Create Depthwise Convolution configure function
         FunctionType depthwise_convolution;
-        depthwise_convolution.configure(&src, &dst, &weights, pad_stride_info);
+        depthwise_convolution.configure(&src, &dst, &weights, nullptr, pad_stride_info);
 
         // Allocate tensors
         src.allocator()->allocate();
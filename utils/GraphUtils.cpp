@@ -32,9 +32,11 @@
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/PixelValue.h"
+#include "arm_compute/runtime/Tensor.h"
 #include "libnpy/npy.hpp"
 
 #include <algorithm>
+#include <cstring>
 #include <iomanip>
 #include <ostream>
 #include <random>
@@ -363,4 +365,49 @@ bool NumPyBinLoader::access_tensor(ITensor &tensor)
         });
     }
     return true;
+}
+
+ContainerWeightsAccessor::ContainerWeightsAccessor(std::shared_ptr<arm_compute::utils::ModelContainer> container, std::string entry)
+    : _container(std::move(container)), _entry(std::move(entry))
+{
+    ARM_COMPUTE_ERROR_ON(_container == nullptr);
+}
+
+bool ContainerWeightsAccessor::access_tensor(ITensor &tensor)
+{
+    size_t      blob_size = 0;
+    const void *blob      = _container->find(_entry, blob_size);
+    ARM_COMPUTE_ERROR_ON_MSG(blob == nullptr, "Entry not found in model container");
+    ARM_COMPUTE_ERROR_ON_MSG(blob_size < tensor.info()->total_size(), "Model container entry is smaller than the tensor");
+
+    // Unpadded CPU tensors can use the mapped blob as their backing memory directly: drop the
+    // freshly allocated buffer and import the mapping instead. The blob is never written to,
+    // so the read-only pages stay shared between processes.
+    auto *cpu_tensor = dynamic_cast<arm_compute::Tensor *>(&tensor);
+    if(cpu_tensor != nullptr && tensor.info()->padding().empty())
+    {
+        cpu_tensor->allocator()->free();
+        cpu_tensor->allocator()->import_memory(const_cast<void *>(blob), blob_size);
+        return true;
+    }
+
+    // Padded or OpenCL tensors (mapped by the caller) are filled by copying out of the mapping
+    if(tensor.info()->padding().empty())
+    {
+        std::memcpy(tensor.buffer(), blob, tensor.info()->total_size());
+    }
+    else
+    {
+        Window window;
+        window.use_tensor_dimensions(tensor.info()->tensor_shape());
+
+        const auto *src          = static_cast<const uint8_t *>(blob);
+        const size_t element_size = tensor.info()->element_size();
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            std::memcpy(tensor.ptr_to_element(id), src, element_size);
+            src += element_size;
+        });
+    }
+    return true;
 }
\ No newline at end of file
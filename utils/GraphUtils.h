@@ -27,7 +27,9 @@
 #include "arm_compute/core/PixelValue.h"
 #include "arm_compute/graph/ITensorAccessor.h"
 #include "arm_compute/graph/Types.h"
+#include "utils/ModelContainer.h"
 
+#include <memory>
 #include <random>
 #include <string>
 #include <vector>
@@ -175,6 +177,33 @@ public:
 private:
     const std::string _filename;
 };
+
+/** Accessor filling a tensor from a @ref arm_compute::utils::ModelContainer entry
+ *
+ * All accessors of one network share the same container instance, so loading the weights costs
+ * a single mmap instead of one file open per layer. Unpadded CPU tensors import the mapped
+ * region directly as their backing memory (zero-copy, read-only); padded or OpenCL tensors are
+ * filled by copying out of the mapping.
+ */
+class ContainerWeightsAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] container Container holding the weights, shared between all the network's accessors. Must outlive the graph.
+     * @param[in] entry     Name of the container entry to load
+     */
+    ContainerWeightsAccessor(std::shared_ptr<arm_compute::utils::ModelContainer> container, std::string entry);
+    /** Allows instances to move constructed */
+    ContainerWeightsAccessor(ContainerWeightsAccessor &&) = default;
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override;
+
+private:
+    std::shared_ptr<arm_compute::utils::ModelContainer> _container;
+    const std::string                                   _entry;
+};
 } // namespace graph_utils
 } // namespace arm_compute
 
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "utils/ModelContainer.h"
+
+#include "arm_compute/core/Error.h"
+
+#include <cstring>
+#include <fstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace arm_compute::utils;
+
+namespace
+{
+constexpr char     container_magic[4] = { 'A', 'C', 'L', 'C' };
+constexpr uint32_t container_version  = 1;
+constexpr size_t   entry_name_length  = 64;   /* Zero-padded entry name field, including the terminator */
+constexpr size_t   blob_alignment     = 4096; /* Blobs start on page boundaries */
+
+/** On-disk container header */
+struct ContainerHeader
+{
+    char     magic[4];
+    uint32_t version;
+    uint64_t num_entries;
+};
+
+/** On-disk entry index record */
+struct ContainerEntry
+{
+    char     name[entry_name_length];
+    uint64_t offset;
+    uint64_t size;
+};
+} // namespace
+
+ModelContainer::ModelContainer(const std::string &path)
+    : _fd(-1), _mapping(nullptr), _length(0), _entries()
+{
+    _fd = open(path.c_str(), O_RDONLY);
+    ARM_COMPUTE_ERROR_ON_MSG(_fd < 0, "Failed to open model container");
+
+    struct stat file_info;
+    ARM_COMPUTE_ERROR_ON(fstat(_fd, &file_info) != 0);
+    _length = static_cast<size_t>(file_info.st_size);
+    ARM_COMPUTE_ERROR_ON_MSG(_length < sizeof(ContainerHeader), "Model container is truncated");
+
+    // A single shared read-only mapping: the pages are populated on first touch and shared
+    // with every other process mapping the same file
+    _mapping = mmap(nullptr, _length, PROT_READ, MAP_SHARED, _fd, 0);
+    ARM_COMPUTE_ERROR_ON_MSG(_mapping == MAP_FAILED, "Failed to map model container");
+
+    const auto *base = static_cast<const uint8_t *>(_mapping);
+    ContainerHeader header;
+    std::memcpy(&header, base, sizeof(header));
+    ARM_COMPUTE_ERROR_ON_MSG(std::memcmp(header.magic, container_magic, sizeof(container_magic)) != 0, "Not a model container file");
+    ARM_COMPUTE_ERROR_ON_MSG(header.version != container_version, "Unsupported model container version");
+    ARM_COMPUTE_ERROR_ON_MSG(sizeof(ContainerHeader) + header.num_entries * sizeof(ContainerEntry) > _length, "Model container index is truncated");
+
+    for(uint64_t i = 0; i < header.num_entries; ++i)
+    {
+        ContainerEntry entry;
+        std::memcpy(&entry, base + sizeof(ContainerHeader) + i * sizeof(ContainerEntry), sizeof(entry));
+        entry.name[entry_name_length - 1] = '\0';
+        ARM_COMPUTE_ERROR_ON_MSG(entry.offset + entry.size > _length, "Model container entry is truncated");
+        _entries[std::string(entry.name)] = std::make_pair(base + entry.offset, static_cast<size_t>(entry.size));
+    }
+}
+
+ModelContainer::~ModelContainer()
+{
+    if(_mapping != nullptr && _mapping != MAP_FAILED)
+    {
+        munmap(_mapping, _length);
+    }
+    if(_fd >= 0)
+    {
+        close(_fd);
+    }
+}
+
+const void *ModelContainer::find(const std::string &name, size_t &size) const
+{
+    const auto it = _entries.find(name);
+    if(it == _entries.end())
+    {
+        return nullptr;
+    }
+    size = it->second.second;
+    return it->second.first;
+}
+
+bool ModelContainer::contains(const std::string &name) const
+{
+    return _entries.find(name) != _entries.end();
+}
+
+void ModelContainerWriter::add_entry(const std::string &name, const void *data, size_t size)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(name.length() >= entry_name_length, "Entry name is too long");
+    const auto *bytes = static_cast<const uint8_t *>(data);
+    _entries.emplace_back(name, std::vector<uint8_t>(bytes, bytes + size));
+}
+
+void ModelContainerWriter::write(const std::string &path) const
+{
+    std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+    ARM_COMPUTE_ERROR_ON_MSG(!stream.good(), "Failed to open model container for writing");
+
+    ContainerHeader header = {};
+    std::memcpy(header.magic, container_magic, sizeof(container_magic));
+    header.version     = container_version;
+    header.num_entries = _entries.size();
+    stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    // Lay the blobs out after the index, each aligned so the loader can hand out
+    // pointers suitable for direct import into tensors
+    uint64_t                    offset = sizeof(ContainerHeader) + _entries.size() * sizeof(ContainerEntry);
+    std::vector<ContainerEntry> index;
+    for(const auto &entry : _entries)
+    {
+        offset = (offset + blob_alignment - 1) / blob_alignment * blob_alignment;
+        ContainerEntry record = {};
+        std::strncpy(record.name, entry.first.c_str(), entry_name_length - 1);
+        record.offset = offset;
+        record.size   = entry.second.size();
+        index.push_back(record);
+        offset += entry.second.size();
+    }
+    for(const auto &record : index)
+    {
+        stream.write(reinterpret_cast<const char *>(&record), sizeof(record));
+    }
+    for(size_t i = 0; i < _entries.size(); ++i)
+    {
+        stream.seekp(index[i].offset);
+        stream.write(reinterpret_cast<const char *>(_entries[i].second.data()), _entries[i].second.size());
+    }
+    ARM_COMPUTE_ERROR_ON_MSG(!stream.good(), "Failed to write model container");
+}
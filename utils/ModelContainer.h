@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __UTILS_MODEL_CONTAINER_H__
+#define __UTILS_MODEL_CONTAINER_H__
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace utils
+{
+/** Single-file container holding all the weight blobs of a model, loaded with one mmap
+ *
+ * Loading a network from per-layer numpy files costs one open/read/close per blob, which on
+ * slow flash storage dominates model load time. A container bundles every blob into one file
+ * that is mapped once: blob lookups return pointers straight into the mapping, so load time is
+ * bound by page faults on the bytes actually touched and the read-only pages are shared between
+ * all processes mapping the same file.
+ *
+ * File layout (all integers little-endian):
+ *   - 16 byte header: magic "ACLC", uint32 version (1), uint64 number of entries
+ *   - entry index: per entry a 64 byte zero-padded name, uint64 offset, uint64 size
+ *   - blob data, each blob starting at a 4096-byte aligned offset
+ *
+ * Entry names are free-form, so besides weights a container can also carry application-defined
+ * blobs (e.g. a serialized network description or labels).
+ */
+class ModelContainer
+{
+public:
+    /** Maps the given container file into memory and parses its entry index
+     *
+     * @param[in] path Path of the container file to load
+     */
+    ModelContainer(const std::string &path);
+    /** Destructor, unmaps the file */
+    ~ModelContainer();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    ModelContainer(const ModelContainer &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    ModelContainer &operator=(const ModelContainer &) = delete;
+
+    /** Looks up an entry by name
+     *
+     * @param[in]  name Name of the entry
+     * @param[out] size Size of the entry in bytes, if found
+     *
+     * @return Pointer into the read-only mapping, or nullptr if there is no such entry
+     */
+    const void *find(const std::string &name, size_t &size) const;
+    /** Checks whether the container holds an entry with the given name
+     *
+     * @param[in] name Name of the entry
+     *
+     * @return True if the entry exists
+     */
+    bool contains(const std::string &name) const;
+
+private:
+    int    _fd;      /**< File descriptor of the mapped container */
+    void  *_mapping; /**< Base address of the read-only mapping */
+    size_t _length;  /**< Length of the mapping in bytes */
+    std::map<std::string, std::pair<const void *, size_t>> _entries; /**< Entry name to (data, size) */
+};
+
+/** Helper writing a @ref ModelContainer file from individual blobs
+ *
+ * Typically used once, offline, to convert a directory of per-layer numpy files into a
+ * container that is then shipped with the application.
+ */
+class ModelContainerWriter
+{
+public:
+    /** Default Constructor */
+    ModelContainerWriter() = default;
+
+    /** Appends a blob to the container
+     *
+     * @param[in] name Name of the entry, at most 63 characters
+     * @param[in] data Blob contents, copied by this call
+     * @param[in] size Size of the blob in bytes
+     */
+    void add_entry(const std::string &name, const void *data, size_t size);
+    /** Writes the container file
+     *
+     * @param[in] path Path of the file to write
+     */
+    void write(const std::string &path) const;
+
+private:
+    std::vector<std::pair<std::string, std::vector<uint8_t>>> _entries{}; /**< Blobs in insertion order */
+};
+} // namespace utils
+} // namespace arm_compute
+#endif /* __UTILS_MODEL_CONTAINER_H__ */
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "utils/TensorTransfer.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+
+#if defined(__arm__) || defined(__aarch64__)
+#include <arm_neon.h>
+#endif /* defined(__arm__) || defined(__aarch64__) */
+
+#include <cstring>
+
+using namespace arm_compute;
+
+void arm_compute::utils::import_tensor_data(ITensor &tensor, const void *buffer, size_t row_stride_bytes)
+{
+    ARM_COMPUTE_ERROR_ON(tensor.buffer() == nullptr);
+    ARM_COMPUTE_ERROR_ON(buffer == nullptr);
+
+    const ITensorInfo &info       = *tensor.info();
+    const size_t       row_size   = info.dimension(0) * info.element_size();
+    const size_t       src_stride = (row_stride_bytes != 0) ? row_stride_bytes : row_size;
+    ARM_COMPUTE_ERROR_ON(src_stride < row_size);
+
+    // One copy per row: collapse the row dimension to a single step so the iterator walks
+    // row starts only, skipping the tensor's padding between them
+    Window win;
+    win.use_tensor_dimensions(info.tensor_shape());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    const auto *src = static_cast<const uint8_t *>(buffer);
+    Iterator    out(&tensor, win);
+    execute_window_loop(win, [&](const Coordinates &)
+    {
+        std::memcpy(out.ptr(), src, row_size);
+        src += src_stride;
+    },
+    out);
+}
+
+void arm_compute::utils::export_tensor_data(const ITensor &tensor, void *buffer, size_t row_stride_bytes)
+{
+    ARM_COMPUTE_ERROR_ON(tensor.buffer() == nullptr);
+    ARM_COMPUTE_ERROR_ON(buffer == nullptr);
+
+    const ITensorInfo &info       = *tensor.info();
+    const size_t       row_size   = info.dimension(0) * info.element_size();
+    const size_t       dst_stride = (row_stride_bytes != 0) ? row_stride_bytes : row_size;
+    ARM_COMPUTE_ERROR_ON(dst_stride < row_size);
+
+    Window win;
+    win.use_tensor_dimensions(info.tensor_shape());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    auto    *dst = static_cast<uint8_t *>(buffer);
+    Iterator in(&tensor, win);
+    execute_window_loop(win, [&](const Coordinates &)
+    {
+        std::memcpy(dst, in.ptr(), row_size);
+        dst += dst_stride;
+    },
+    in);
+}
+
+void arm_compute::utils::import_interleaved_channels(ITensor &tensor, const uint8_t *buffer, size_t row_stride_bytes)
+{
+    ARM_COMPUTE_ERROR_ON(tensor.buffer() == nullptr);
+    ARM_COMPUTE_ERROR_ON(buffer == nullptr);
+    ARM_COMPUTE_ERROR_ON(tensor.info()->data_type() != DataType::U8);
+    ARM_COMPUTE_ERROR_ON(tensor.info()->strides_in_bytes()[0] != 1);
+
+    const ITensorInfo &info     = *tensor.info();
+    const size_t       width    = info.dimension(0);
+    const size_t       height   = info.dimension(1);
+    const size_t       channels = info.dimension(2);
+
+    const size_t src_stride = (row_stride_bytes != 0) ? row_stride_bytes : width * channels;
+    ARM_COMPUTE_ERROR_ON(src_stride < width * channels);
+
+    const size_t   stride_y = info.strides_in_bytes()[1];
+    const size_t   stride_z = info.strides_in_bytes()[2];
+    uint8_t *const base     = tensor.buffer() + info.offset_first_element_in_bytes();
+
+    for(size_t y = 0; y < height; ++y)
+    {
+        const uint8_t *src = buffer + y * src_stride;
+        size_t         x   = 0;
+
+#if defined(__arm__) || defined(__aarch64__)
+        if(channels == 3)
+        {
+            // A deinterleaving load splits 48 packed bytes into one 16-byte run per channel
+            uint8_t *const plane0 = base + y * stride_y;
+            uint8_t *const plane1 = plane0 + stride_z;
+            uint8_t *const plane2 = plane1 + stride_z;
+            for(; x + 16 <= width; x += 16)
+            {
+                const uint8x16x3_t pixels = vld3q_u8(src + x * 3);
+                vst1q_u8(plane0 + x, pixels.val[0]);
+                vst1q_u8(plane1 + x, pixels.val[1]);
+                vst1q_u8(plane2 + x, pixels.val[2]);
+            }
+        }
+#endif /* defined(__arm__) || defined(__aarch64__) */
+
+        for(; x < width; ++x)
+        {
+            for(size_t c = 0; c < channels; ++c)
+            {
+                *(base + c * stride_z + y * stride_y + x) = src[x * channels + c];
+            }
+        }
+    }
+}
+
+void arm_compute::utils::export_interleaved_channels(const ITensor &tensor, uint8_t *buffer, size_t row_stride_bytes)
+{
+    ARM_COMPUTE_ERROR_ON(tensor.buffer() == nullptr);
+    ARM_COMPUTE_ERROR_ON(buffer == nullptr);
+    ARM_COMPUTE_ERROR_ON(tensor.info()->data_type() != DataType::U8);
+    ARM_COMPUTE_ERROR_ON(tensor.info()->strides_in_bytes()[0] != 1);
+
+    const ITensorInfo &info     = *tensor.info();
+    const size_t       width    = info.dimension(0);
+    const size_t       height   = info.dimension(1);
+    const size_t       channels = info.dimension(2);
+
+    const size_t dst_stride = (row_stride_bytes != 0) ? row_stride_bytes : width * channels;
+    ARM_COMPUTE_ERROR_ON(dst_stride < width * channels);
+
+    const size_t         stride_y = info.strides_in_bytes()[1];
+    const size_t         stride_z = info.strides_in_bytes()[2];
+    const uint8_t *const base     = tensor.buffer() + info.offset_first_element_in_bytes();
+
+    for(size_t y = 0; y < height; ++y)
+    {
+        uint8_t *dst = buffer + y * dst_stride;
+        size_t   x   = 0;
+
+#if defined(__arm__) || defined(__aarch64__)
+        if(channels == 3)
+        {
+            // An interleaving store packs one 16-byte run per channel back into 48 bytes
+            const uint8_t *const plane0 = base + y * stride_y;
+            const uint8_t *const plane1 = plane0 + stride_z;
+            const uint8_t *const plane2 = plane1 + stride_z;
+            for(; x + 16 <= width; x += 16)
+            {
+                uint8x16x3_t pixels;
+                pixels.val[0] = vld1q_u8(plane0 + x);
+                pixels.val[1] = vld1q_u8(plane1 + x);
+                pixels.val[2] = vld1q_u8(plane2 + x);
+                vst3q_u8(dst + x * 3, pixels);
+            }
+        }
+#endif /* defined(__arm__) || defined(__aarch64__) */
+
+        for(; x < width; ++x)
+        {
+            for(size_t c = 0; c < channels; ++c)
+            {
+                dst[x * channels + c] = *(base + c * stride_z + y * stride_y + x);
+            }
+        }
+    }
+}
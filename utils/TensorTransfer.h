@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __UTILS_TENSOR_TRANSFER_H__
+#define __UTILS_TENSOR_TRANSFER_H__
+
+#include "arm_compute/core/ITensor.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace utils
+{
+/* Bulk tensor import/export helpers.
+ *
+ * Marshalling a frame into a tensor with element-wise Iterator loops costs more than the first
+ * kernel that processes it. These helpers copy whole rows at a time, honoring the tensor's
+ * padding, and convert between the channel-packed layouts camera APIs deliver and the planar
+ * layout the CNN kernels expect. OpenCL tensors must be mapped (see @ref map) before calling.
+ */
+
+/** Copies a dense or strided user buffer into a tensor, row by row
+ *
+ * @param[out] tensor           Destination tensor, must be allocated. Any data type.
+ * @param[in]  buffer           Source buffer holding the tensor's elements in row-major order
+ * @param[in]  row_stride_bytes (Optional) Distance between consecutive source rows in bytes.
+ *                              0 (the default) means the rows are packed densely.
+ */
+void import_tensor_data(ITensor &tensor, const void *buffer, size_t row_stride_bytes = 0);
+
+/** Copies a tensor's elements into a dense or strided user buffer, row by row
+ *
+ * @param[in]  tensor           Source tensor, must be allocated. Any data type.
+ * @param[out] buffer           Destination buffer receiving the tensor's elements in row-major order
+ * @param[in]  row_stride_bytes (Optional) Distance between consecutive destination rows in bytes.
+ *                              0 (the default) means the rows are packed densely.
+ */
+void export_tensor_data(const ITensor &tensor, void *buffer, size_t row_stride_bytes = 0);
+
+/** Deinterleaves a channel-packed U8 buffer into the planes of a 3D tensor
+ *
+ * A buffer holding WxH pixels of C packed channels (e.g. R G B R G B ... camera frames) is
+ * split into the C planes of a [W, H, C] tensor. The three-channel case uses a NEON
+ * deinterleaving load on ARM targets.
+ *
+ * @param[out] tensor           Destination tensor of shape [W, H, C], must be allocated. Data type supported: U8.
+ * @param[in]  buffer           Source buffer holding WxH pixels of C interleaved channels
+ * @param[in]  row_stride_bytes (Optional) Distance between consecutive source rows in bytes.
+ *                              0 (the default) means the rows are packed densely (W * C bytes).
+ */
+void import_interleaved_channels(ITensor &tensor, const uint8_t *buffer, size_t row_stride_bytes = 0);
+
+/** Interleaves the planes of a 3D tensor into a channel-packed U8 buffer
+ *
+ * The inverse of @ref import_interleaved_channels: the C planes of a [W, H, C] tensor are
+ * packed into a buffer of WxH pixels with C interleaved channels.
+ *
+ * @param[in]  tensor           Source tensor of shape [W, H, C], must be allocated. Data type supported: U8.
+ * @param[out] buffer           Destination buffer receiving WxH pixels of C interleaved channels
+ * @param[in]  row_stride_bytes (Optional) Distance between consecutive destination rows in bytes.
+ *                              0 (the default) means the rows are packed densely (W * C bytes).
+ */
+void export_interleaved_channels(const ITensor &tensor, uint8_t *buffer, size_t row_stride_bytes = 0);
+} // namespace utils
+} // namespace arm_compute
+
+#endif /* __UTILS_TENSOR_TRANSFER_H__ */
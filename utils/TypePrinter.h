@@ -189,6 +189,31 @@ inline std::string to_string(const FixedPointOp &op)
     return str.str();
 }
 
+/** Formatted output of the CacheState type. */
+inline ::std::ostream &operator<<(::std::ostream &os, const CacheState &state)
+{
+    switch(state)
+    {
+        case CacheState::WARM:
+            os << "WARM";
+            break;
+        case CacheState::COLD:
+            os << "COLD";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
+    }
+
+    return os;
+}
+
+inline std::string to_string(const CacheState &state)
+{
+    std::stringstream str;
+    str << state;
+    return str.str();
+}
+
 /** Formatted output of the activation function type. */
 inline ::std::ostream &operator<<(::std::ostream &os, const ActivationLayerInfo::ActivationFunction &act_function)
 {